@@ -0,0 +1,91 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Run-time detection of x86 instruction sets
+
+#include "Intrinsics.hpp"
+
+#if DILIGENT_AVX2_SUPPORTED && !DILIGENT_AVX2_ENABLED && defined(_MSC_VER)
+#    include <intrin.h>
+#endif
+
+namespace Diligent
+{
+
+#if DILIGENT_AVX2_SUPPORTED
+
+/// Instruction sets supported by the CPU the application is running on.
+
+/// Functions compiled with DILIGENT_TARGET_SSE41 or DILIGENT_TARGET_AVX2 may only
+/// be called if the corresponding flag is set.
+struct X86Features
+{
+    bool SSE41 = false;
+    bool AVX2  = false;
+
+    X86Features()
+    {
+#    if DILIGENT_AVX2_ENABLED
+        // The whole module is compiled for AVX2
+        SSE41 = true;
+        AVX2  = true;
+#    elif defined(_MSC_VER)
+        int CPUInfo[4] = {};
+        __cpuid(CPUInfo, 0);
+        const int MaxLeaf = CPUInfo[0];
+
+        __cpuid(CPUInfo, 1);
+        SSE41 = (CPUInfo[2] & (1 << 19)) != 0;
+
+        // AVX registers can only be used if the OS saves them on context switches (OSXSAVE + XCR0 bits 1 and 2)
+        const bool AVX     = (CPUInfo[2] & (1 << 28)) != 0;
+        const bool OSXSAVE = (CPUInfo[2] & (1 << 27)) != 0;
+        if (MaxLeaf >= 7 && AVX && OSXSAVE && (_xgetbv(0) & 0x6) == 0x6)
+        {
+            __cpuidex(CPUInfo, 7, 0);
+            AVX2 = (CPUInfo[1] & (1 << 5)) != 0;
+        }
+#    else
+        __builtin_cpu_init();
+        SSE41 = __builtin_cpu_supports("sse4.1") != 0;
+        AVX2  = __builtin_cpu_supports("avx2") != 0;
+#    endif
+    }
+};
+
+/// Returns the instruction sets supported by the CPU. The features are detected on the first call.
+inline const X86Features& GetX86Features()
+{
+    static const X86Features Features;
+    return Features;
+}
+
+#endif // DILIGENT_AVX2_SUPPORTED
+
+} // namespace Diligent
@@ -1,5 +1,5 @@
 /*
- *  Copyright 2019-2022 Diligent Graphics LLC
+ *  Copyright 2019-2025 Diligent Graphics LLC
  *
  *  Licensed under the Apache License, Version 2.0 (the "License");
  *  you may not use this file except in compliance with the License.
@@ -34,6 +34,9 @@
 namespace Diligent
 {
 
+struct IThreadPool;
+class Float16;
+
 /// Computes the minimum and the maximum value in a 2D floating-point array
 
 /// \param[in]  pData		   - A pointer to the array data.
@@ -42,11 +45,75 @@ namespace Diligent
 /// \param[in]  Height		   - 2D array height.
 /// \param[out] MinValue	   - Minimum value.
 /// \param[out] MaxValue	   - Maximum value.
+/// \param[in]  pThreadPool    - Optional thread pool. If it is not null and the array is
+///                              large enough, the array is split into tiles of rows that are
+///                              processed in parallel.
+///
+/// \remarks   On x86, the function uses SSE4.1 or AVX2 instructions, whichever is the best
+///            one supported by the CPU. The choice is made once, on the first call.
+///            On other platforms, the function uses scalar code.
+///            If the array contains NaN values, the result is undefined.
 void GetArray2DMinMaxValue(const float* pData,
                            size_t       StrideInFloats,
                            Uint32       Width,
                            Uint32       Height,
                            float&       MinValue,
-                           float&       MaxValue);
+                           float&       MaxValue,
+                           IThreadPool* pThreadPool = nullptr);
+
+/// Computes the minimum and the maximum value in a 2D 16-bit unsigned integer array
+
+/// \param[in]  pData		     - A pointer to the array data.
+/// \param[in]  StrideInElements - Row stride in array elements.
+/// \param[in]  Width		     - 2D array width.
+/// \param[in]  Height		     - 2D array height.
+/// \param[out] MinValue	     - Minimum value.
+/// \param[out] MaxValue	     - Maximum value.
+/// \param[in]  pThreadPool      - Optional thread pool, see the float version of the function.
+void GetArray2DMinMaxValue(const Uint16* pData,
+                           size_t        StrideInElements,
+                           Uint32        Width,
+                           Uint32        Height,
+                           Uint16&       MinValue,
+                           Uint16&       MaxValue,
+                           IThreadPool*  pThreadPool = nullptr);
+
+/// Computes the minimum and the maximum value in a 2D 32-bit signed integer array
+
+/// \param[in]  pData		     - A pointer to the array data.
+/// \param[in]  StrideInElements - Row stride in array elements.
+/// \param[in]  Width		     - 2D array width.
+/// \param[in]  Height		     - 2D array height.
+/// \param[out] MinValue	     - Minimum value.
+/// \param[out] MaxValue	     - Maximum value.
+/// \param[in]  pThreadPool      - Optional thread pool, see the float version of the function.
+void GetArray2DMinMaxValue(const Int32* pData,
+                           size_t       StrideInElements,
+                           Uint32       Width,
+                           Uint32       Height,
+                           Int32&       MinValue,
+                           Int32&       MaxValue,
+                           IThreadPool* pThreadPool = nullptr);
+
+/// Computes the minimum and the maximum value in a 2D half-precision floating-point array
+
+/// \param[in]  pData		     - A pointer to the array data.
+/// \param[in]  StrideInElements - Row stride in array elements.
+/// \param[in]  Width		     - 2D array width.
+/// \param[in]  Height		     - 2D array height.
+/// \param[out] MinValue	     - Minimum value.
+/// \param[out] MaxValue	     - Maximum value.
+/// \param[in]  pThreadPool      - Optional thread pool, see the float version of the function.
+///
+/// \remarks   Values are compared without conversion to 32-bit floats.
+///            Negative zero is considered to be less than positive zero.
+///            If the array contains NaN values, the result is undefined.
+void GetArray2DMinMaxValue(const Float16* pData,
+                           size_t         StrideInElements,
+                           Uint32         Width,
+                           Uint32         Height,
+                           Float16&       MinValue,
+                           Float16&       MaxValue,
+                           IThreadPool*   pThreadPool = nullptr);
 
 } // namespace Diligent
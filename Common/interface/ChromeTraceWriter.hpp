@@ -0,0 +1,120 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Declaration of Diligent::ChromeTraceWriter class
+
+#include <chrono>
+#include <string>
+
+#include "../../Primitives/interface/BasicTypes.h"
+
+namespace Diligent
+{
+
+/// Writes events in the Chrome trace event JSON format that can be loaded
+/// in chrome://tracing or https://ui.perfetto.dev.
+
+/// All profilers in the engine write their traces with this class, so that the traces use
+/// the same process ids, thread ids and clock, and can be merged by concatenating
+/// their traceEvents arrays:
+///
+///     ChromeTraceWriter Writer;
+///     Writer.AddProcessName(ChromeTraceWriter::CPUProcessId, "CPU");
+///     Writer.AddCompleteEvent("Zone", "Category", ChromeTraceWriter::CPUProcessId,
+///                             ChromeTraceWriter::GetThreadId(), StartTime, Duration);
+///     std::string Trace = Writer.Finish();
+///
+/// Timestamps are given in nanoseconds on the trace clock (see GetTimestamp()) and are
+/// written in microseconds with nanosecond precision.
+class ChromeTraceWriter
+{
+public:
+    /// Process id of CPU events.
+    static constexpr Uint32 CPUProcessId = 1;
+
+    /// Process id of GPU events.
+    static constexpr Uint32 GPUProcessId = 2;
+
+    ChromeTraceWriter();
+
+    /// Returns the time point on the trace clock, in nanoseconds.
+    static Uint64 GetTimestamp(std::chrono::steady_clock::time_point Time) noexcept;
+
+    /// Returns the current time on the trace clock, in nanoseconds.
+    static Uint64 GetTimestamp() noexcept
+    {
+        return GetTimestamp(std::chrono::steady_clock::now());
+    }
+
+    /// Returns the trace id of the calling thread.
+
+    /// Thread ids are assigned in the order in which threads first call this method
+    /// and are never reused within the module.
+    static Uint32 GetThreadId() noexcept;
+
+    /// Adds the process name metadata event.
+    void AddProcessName(Uint32 ProcessId, const char* Name);
+
+    /// Adds the thread name metadata event.
+    void AddThreadName(Uint32 ProcessId, Uint32 ThreadId, const char* Name);
+
+    /// Adds a complete ("X") event.
+
+    /// \param [in] Name      - Event name.
+    /// \param [in] Category  - Event category. May be null.
+    /// \param [in] ProcessId - Process id, e.g. CPUProcessId or GPUProcessId.
+    /// \param [in] ThreadId  - Thread id, see GetThreadId().
+    /// \param [in] StartTime - Start time on the trace clock, in nanoseconds.
+    /// \param [in] Duration  - Event duration, in nanoseconds.
+    void AddCompleteEvent(const char* Name,
+                          const char* Category,
+                          Uint32      ProcessId,
+                          Uint32      ThreadId,
+                          Uint64      StartTime,
+                          Uint64      Duration);
+
+    /// Completes the trace and returns the JSON string. No events may be added after this call.
+    std::string Finish();
+
+    /// Writes the trace to a file.
+    static bool Save(const char* FilePath, const std::string& Trace);
+
+    /// Appends a JSON string literal to Json. Quotes and backslashes are escaped,
+    /// and control characters are written as \u00XX escape sequences.
+    static void AppendJSONString(std::string& Json, const char* Str);
+
+private:
+    void BeginEvent();
+
+    std::string m_Json;
+    bool        m_HasEvents = false;
+    bool        m_Finished  = false;
+};
+
+} // namespace Diligent
@@ -104,7 +104,8 @@ struct GeometryPrimitiveAttributes
     /// This parameter defines the fidelity of the geometry primitive.
     /// For example, for a cube geometry primitive, the cube faces are subdivided
     /// into `Subdivision x Subdivision` quads, producing `(Subdivision + 1)^2` vertices
-    /// per face.
+    /// per face. A sphere is built from the same subdivided cube, but the vertices on the
+    /// cube edges are shared by the adjacent faces, producing `6 * Subdivision^2 + 2` vertices.
     Uint32 NumSubdivisions DEFAULT_INITIALIZER(0);
 
 #if DILIGENT_CPP_INTERFACE
@@ -172,9 +173,120 @@ struct GeometryPrimitiveInfo
 
     /// The size of the vertex in bytes.
     Uint32 VertexSize DEFAULT_INITIALIZER(0);
+
+    /// The number of meshlets.
+
+    /// This value is only set by Diligent::WriteGeometryPrimitive and is zero otherwise.
+    Uint32 NumMeshlets DEFAULT_INITIALIZER(0);
 };
 typedef struct GeometryPrimitiveInfo GeometryPrimitiveInfo;
 
+
+/// Geometry primitive index order.
+// clang-format off
+DILIGENT_TYPED_ENUM(GEOMETRY_PRIMITIVE_INDEX_ORDER, Uint8)
+{
+    /// Triangles of each face are emitted row by row.
+
+    /// This is the order used by Diligent::CreateGeometryPrimitive.
+    GEOMETRY_PRIMITIVE_INDEX_ORDER_LINEAR = 0u,
+
+    /// Triangles of each face are emitted in narrow vertical bands whose width
+    /// is derived from the post-transform vertex cache size, so that every vertex
+    /// is transformed approximately once per band.
+    GEOMETRY_PRIMITIVE_INDEX_ORDER_VERTEX_CACHE,
+
+    /// Index order count.
+    GEOMETRY_PRIMITIVE_INDEX_ORDER_COUNT
+};
+// clang-format on
+
+
+/// Geometry primitive meshlet.
+
+/// A meshlet is a contiguous range of indices that references a rectangular
+/// patch of face vertices.
+struct GeometryPrimitiveMeshlet
+{
+    /// The first index of the meshlet.
+    Uint32 FirstIndex DEFAULT_INITIALIZER(0);
+
+    /// The number of indices in the meshlet.
+    Uint32 NumIndices DEFAULT_INITIALIZER(0);
+
+    /// The number of unique vertices referenced by the meshlet.
+    Uint32 NumVertices DEFAULT_INITIALIZER(0);
+
+    /// The center of the meshlet bounding sphere.
+    float BoundSphereCenter[3] DEFAULT_INITIALIZER({});
+
+    /// The radius of the meshlet bounding sphere.
+    float BoundSphereRadius DEFAULT_INITIALIZER(0);
+};
+typedef struct GeometryPrimitiveMeshlet GeometryPrimitiveMeshlet;
+
+
+/// Geometry primitive streaming attributes, see Diligent::WriteGeometryPrimitive.
+
+/// All ranges are specified in elements (vertices, indices or meshlets) rather than bytes,
+/// which allows writing a large primitive in chunks into mapped memory windows of
+/// arbitrary size, for example, a Diligent::IVertexPoolAllocation.
+struct GeometryPrimitiveStreamAttribs
+{
+    /// Index order, see Diligent::GEOMETRY_PRIMITIVE_INDEX_ORDER.
+    GEOMETRY_PRIMITIVE_INDEX_ORDER IndexOrder DEFAULT_INITIALIZER(GEOMETRY_PRIMITIVE_INDEX_ORDER_VERTEX_CACHE);
+
+    /// The size of the post-transform vertex cache that the index order is optimized for.
+
+    /// This value is only used when IndexOrder is Diligent::GEOMETRY_PRIMITIVE_INDEX_ORDER_VERTEX_CACHE.
+    Uint32 VertexCacheSize DEFAULT_INITIALIZER(16);
+
+    /// The maximum number of vertices in a meshlet.
+
+    /// If this value is zero, meshlets are not generated.
+    Uint32 MaxMeshletVertices DEFAULT_INITIALIZER(64);
+
+    /// The maximum number of triangles in a meshlet.
+    Uint32 MaxMeshletTriangles DEFAULT_INITIALIZER(124);
+
+    /// A pointer to the memory where vertices [FirstVertex, FirstVertex + NumVertices) will be written.
+
+    /// The memory must be large enough to hold NumVertices * GeometryPrimitiveInfo::VertexSize bytes.
+    /// The vertex layout is the same as the one produced by Diligent::CreateGeometryPrimitive.
+    void* pVertexData DEFAULT_INITIALIZER(nullptr);
+
+    /// The first vertex to write.
+    Uint32 FirstVertex DEFAULT_INITIALIZER(0);
+
+    /// The number of vertices to write.
+    Uint32 NumVertices DEFAULT_INITIALIZER(0);
+
+    /// A pointer to the memory where indices [FirstIndex, FirstIndex + NumIndices) will be written.
+    Uint32* pIndexData DEFAULT_INITIALIZER(nullptr);
+
+    /// The first index to write. Must be a multiple of 3.
+    Uint32 FirstIndex DEFAULT_INITIALIZER(0);
+
+    /// The number of indices to write. Must be a multiple of 3.
+    Uint32 NumIndices DEFAULT_INITIALIZER(0);
+
+    /// The value that is added to every index, for instance the start vertex of a vertex pool allocation.
+    Uint32 BaseVertex DEFAULT_INITIALIZER(0);
+
+    /// A pointer to the array where meshlets [FirstMeshlet, FirstMeshlet + NumMeshlets) will be written.
+
+    /// Meshlet indices are relative to the start of the index data and are not affected by
+    /// FirstIndex.
+    GeometryPrimitiveMeshlet* pMeshlets DEFAULT_INITIALIZER(nullptr);
+
+    /// The first meshlet to write.
+    Uint32 FirstMeshlet DEFAULT_INITIALIZER(0);
+
+    /// The number of meshlets to write.
+    Uint32 NumMeshlets DEFAULT_INITIALIZER(0);
+};
+typedef struct GeometryPrimitiveStreamAttribs GeometryPrimitiveStreamAttribs;
+
 /// Returns the size of the geometry primitive vertex in bytes.
 Uint32 GetGeometryPrimitiveVertexSize(GEOMETRY_PRIMITIVE_VERTEX_FLAGS VertexFlags);
 
@@ -194,6 +306,24 @@ void DILIGENT_GLOBAL_FUNCTION(CreateGeometryPrimitive)(const GeometryPrimitiveAt
                                                        IDataBlob**                           ppVertices,
                                                        IDataBlob**                           ppIndices,
                                                        GeometryPrimitiveInfo* pInfo          DEFAULT_VALUE(nullptr));
+
+/// Writes geometry primitive data into caller-provided memory.
+
+/// \param [in]  Attribs       - Geometry primitive attributes, see Diligent::GeometryPrimitiveAttributes.
+/// \param [in]  StreamAttribs - Streaming attributes that define the index order and the destination
+///                              memory, see Diligent::GeometryPrimitiveStreamAttribs.
+/// \param [out] pInfo         - A pointer to the structure that will receive information about the
+///                              whole geometry primitive. See Diligent::GeometryPrimitiveInfo.
+///
+/// \remarks   The function can be first called with null data pointers to query the
+///            total number of vertices, indices and meshlets, and then called repeatedly
+///            to write the primitive in chunks. The output only depends on Attribs and
+///            on the layout members of StreamAttribs (IndexOrder, VertexCacheSize, MaxMeshletVertices
+///            and MaxMeshletTriangles), so these must be the same for all chunks.
+void DILIGENT_GLOBAL_FUNCTION(WriteGeometryPrimitive)(const GeometryPrimitiveAttributes REF    Attribs,
+                                                      const GeometryPrimitiveStreamAttribs REF StreamAttribs,
+                                                      GeometryPrimitiveInfo* pInfo             DEFAULT_VALUE(nullptr));
+
 #include "../../Primitives/interface/UndefRefMacro.h"
 
 DILIGENT_END_NAMESPACE // namespace Diligent
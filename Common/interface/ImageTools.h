@@ -100,6 +100,22 @@ struct ComputeImageDifferenceAttribs
 
     /// Scale factor for the difference image
     float Scale DEFAULT_INITIALIZER(1.f);
+
+    /// The maximum number of pixels that may differ above the threshold.
+
+    /// Once the number of pixels that differ above the threshold exceeds this value,
+    /// the function stops processing the image. In this case, NumDiffPixelsAboveThreshold
+    /// is greater than MaxDiffPixelsAboveThreshold, and the remaining difference information
+    /// as well as the difference image only cover the processed rows.
+    /// The default value (~0u) means that the entire image is always processed.
+    Uint32 MaxDiffPixelsAboveThreshold DEFAULT_INITIALIZER(~0u);
+
+    /// An optional thread pool to process the image in.
+
+    /// If not null, the image is split into tiles of rows that are processed by the
+    /// pool threads together with the calling thread. Unless the function stops early
+    /// (see MaxDiffPixelsAboveThreshold), the result is identical to the serial one.
+    struct IThreadPool* pThreadPool DEFAULT_INITIALIZER(nullptr);
 };
 typedef struct ComputeImageDifferenceAttribs ComputeImageDifferenceAttribs;
 
@@ -115,6 +131,10 @@ typedef struct ComputeImageDifferenceAttribs ComputeImageDifferenceAttribs;
 /// The root mean square difference is calculated as the square root of
 /// the average of the squares of all differences, not counting pixels that
 /// are equal.
+///
+/// Images with 3 or 4 channels are processed with SIMD instructions
+/// when both images have the same number of channels and the difference image
+/// is either not requested or uses the same number of channels with unit scale.
 void DILIGENT_GLOBAL_FUNCTION(ComputeImageDifference)(const ComputeImageDifferenceAttribs REF Attribs, ImageDiffInfo REF ImageDiff);
 
 
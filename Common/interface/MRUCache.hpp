@@ -0,0 +1,144 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Defines Diligent::MRUCache class
+
+#include <array>
+#include <algorithm>
+#include <functional>
+
+#include "../../Primitives/interface/BasicTypes.h"
+#include "../../Platforms/Basic/interface/DebugUtilities.hpp"
+
+namespace Diligent
+{
+
+/// A small fixed-size cache of the most recently used key-value pairs.
+
+/// The cache is intended to be used as a front cache of a larger shared cache
+/// by a single thread, and is not thread-safe. Entries are kept in the order
+/// of use, and the least recently used entry is evicted when a new entry is added
+/// to the full cache.
+///
+/// Every cache entry is tagged with the generation of the shared cache. When an entry
+/// is removed from the shared cache, the shared cache increments the generation, which
+/// invalidates all entries of all front caches:
+///
+///     const Uint32 Generation = SharedCache.GetGeneration();
+///     if (const DataType* pData = FrontCache.Find(Key, Generation))
+///         return *pData;
+///     DataType Data = SharedCache.Get(Key);
+///     FrontCache.Add(Key, Data, Generation);
+///
+/// Note that the generation must be read before the shared cache is accessed.
+template <typename KeyType, typename DataType, size_t MaxEntries = 4, typename KeyHasher = std::hash<KeyType>>
+class MRUCache
+{
+public:
+    /// Finds the data in the cache.
+
+    /// \param [in] Key        - The data key.
+    /// \param [in] Generation - The current generation of the shared cache.
+    ///
+    /// \return     A pointer to the data, or null if the data is not found.
+    ///             The pointer remains valid until the next call to Find(), Add() or Clear().
+    const DataType* Find(const KeyType& Key, Uint32 Generation)
+    {
+        if (Generation != m_Generation)
+        {
+            Clear();
+            m_Generation = Generation;
+            return nullptr;
+        }
+
+        const size_t Hash = KeyHasher{}(Key);
+        for (size_t i = 0; i < m_NumEntries; ++i)
+        {
+            if (m_Entries[i].Hash == Hash && m_Entries[i].Key == Key)
+            {
+                // Move the entry to the front
+                std::rotate(m_Entries.begin(), m_Entries.begin() + i, m_Entries.begin() + i + 1);
+                return &m_Entries[0].Data;
+            }
+        }
+
+        return nullptr;
+    }
+
+    /// Adds the data to the front of the cache.
+
+    /// \param [in] Key        - The data key.
+    /// \param [in] Data       - The data.
+    /// \param [in] Generation - The generation of the shared cache that was read
+    ///                          before the data was retrieved.
+    void Add(const KeyType& Key, const DataType& Data, Uint32 Generation)
+    {
+        if (Generation != m_Generation)
+        {
+            // The shared cache has been modified since the data was retrieved
+            // or the cache has not been used yet.
+            Clear();
+            m_Generation = Generation;
+        }
+
+        if (m_NumEntries < MaxEntries)
+            ++m_NumEntries;
+        // Move the last entry to the front and overwrite it
+        std::rotate(m_Entries.begin(), m_Entries.begin() + m_NumEntries - 1, m_Entries.begin() + m_NumEntries);
+
+        Entry& NewEntry = m_Entries[0];
+        NewEntry.Key    = Key;
+        NewEntry.Data   = Data;
+        NewEntry.Hash   = KeyHasher{}(Key);
+    }
+
+    /// Removes all entries from the cache.
+    void Clear()
+    {
+        for (size_t i = 0; i < m_NumEntries; ++i)
+            m_Entries[i] = Entry{};
+        m_NumEntries = 0;
+    }
+
+    size_t GetNumEntries() const { return m_NumEntries; }
+
+private:
+    struct Entry
+    {
+        KeyType  Key{};
+        DataType Data{};
+        size_t   Hash = 0;
+    };
+    std::array<Entry, MaxEntries> m_Entries;
+
+    size_t m_NumEntries = 0;
+    Uint32 m_Generation = 0;
+};
+
+} // namespace Diligent
@@ -614,10 +614,10 @@ class MakeNewRCObj
 public:
     MakeNewRCObj(AllocatorType& Allocator, const Char* Description, const char* FileName, const Int32 LineNumber, IObject* pOwner = nullptr) noexcept :
         // clang-format off
-        m_pAllocator{&Allocator},
-        m_pOwner{pOwner}
+        m_pAllocator    {&Allocator },
+        m_pOwner        {pOwner     },
+        m_Description   {Description}
 #ifdef DILIGENT_DEVELOPMENT
-      , m_dvpDescription{Description}
       , m_dvpFileName   {FileName   }
       , m_dvpLineNumber {LineNumber }
     // clang-format on
@@ -628,9 +628,9 @@ public:
     MakeNewRCObj(IObject* pOwner = nullptr) noexcept :
         // clang-format off
         m_pAllocator    {nullptr},
-        m_pOwner        {pOwner }
+        m_pOwner        {pOwner },
+        m_Description   {nullptr}
 #ifdef DILIGENT_DEVELOPMENT
-      , m_dvpDescription{nullptr}
       , m_dvpFileName   {nullptr}
       , m_dvpLineNumber {0      }
 #endif
@@ -662,9 +662,11 @@ public:
         try
         {
 #ifndef DILIGENT_DEVELOPMENT
-            static constexpr const char* m_dvpDescription = "<Unavailable in release build>";
-            static constexpr const char* m_dvpFileName    = "<Unavailable in release build>";
-            static constexpr Int32       m_dvpLineNumber  = -1;
+            // The description is passed to the allocator in all builds, so that allocators
+            // can account memory by object type. File name and line number are only kept in
+            // development builds.
+            static constexpr const char* m_dvpFileName   = "<Unavailable in release build>";
+            static constexpr Int32       m_dvpLineNumber = -1;
 #endif
             // Operators new and delete of RefCountedObject are private and only accessible
             // by methods of MakeNewRCObj
@@ -672,11 +674,11 @@ public:
             {
                 if constexpr (alignof(ObjectType) > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
                 {
-                    pObj = new (std::align_val_t{alignof(ObjectType)}, *m_pAllocator, m_dvpDescription, m_dvpFileName, m_dvpLineNumber) ObjectType{pRefCounters, std::forward<CtorArgTypes>(CtorArgs)...};
+                    pObj = new (std::align_val_t{alignof(ObjectType)}, *m_pAllocator, m_Description, m_dvpFileName, m_dvpLineNumber) ObjectType{pRefCounters, std::forward<CtorArgTypes>(CtorArgs)...};
                 }
                 else
                 {
-                    pObj = new (*m_pAllocator, m_dvpDescription, m_dvpFileName, m_dvpLineNumber) ObjectType{pRefCounters, std::forward<CtorArgTypes>(CtorArgs)...};
+                    pObj = new (*m_pAllocator, m_Description, m_dvpFileName, m_dvpLineNumber) ObjectType{pRefCounters, std::forward<CtorArgTypes>(CtorArgs)...};
                 }
             }
             else
@@ -698,9 +700,9 @@ public:
 private:
     AllocatorType* const m_pAllocator;
     IObject* const       m_pOwner;
+    const Char* const    m_Description;
 
 #ifdef DILIGENT_DEVELOPMENT
-    const Char* const m_dvpDescription;
     const char* const m_dvpFileName;
     Int32 const       m_dvpLineNumber;
 #endif
@@ -144,6 +144,18 @@ enum class SerializerMode
     Measure
 };
 
+/// Defines how arrays are read in SerializerMode::Read mode
+enum class SerializerArrayReadMode
+{
+    /// Arrays are always copied to the allocator memory.
+    Copy,
+
+    /// Arrays of trivially serializable elements that are read into const pointers
+    /// reference the serialized data directly when it is properly aligned for
+    /// the element type. The serialized data must outlive the deserialized objects.
+    ZeroCopy
+};
+
 
 template <SerializerMode Mode>
 class Serializer
@@ -189,6 +201,17 @@ public:
         static_assert(Mode == SerializerMode::Read || Mode == SerializerMode::Write, "Only Read or Write mode is supported");
     }
 
+    Serializer(const SerializedData& Data, SerializerArrayReadMode ArrayReadMode) :
+        // clang-format off
+        m_Start         {static_cast<TPointer>(Data.Ptr())},
+        m_End           {m_Start + Data.Size()},
+        m_Ptr           {m_Start},
+        m_ZeroCopyArrays{ArrayReadMode == SerializerArrayReadMode::ZeroCopy}
+    // clang-format on
+    {
+        static_assert(Mode == SerializerMode::Read, "Array read mode is only supported in Read mode");
+    }
+
     template <typename T>
     TEnable<T> Serialize(ConstQual<T>& Value)
     {
@@ -250,10 +273,24 @@ public:
     template <typename Arg0Type, typename... ArgTypes>
     bool operator()(Arg0Type& Arg0, ArgTypes&... Args)
     {
-        if (!Serialize<RawType<Arg0Type>>(Arg0))
-            return false;
+        if constexpr (Mode == SerializerMode::Read && IsTriviallySerializable<RawType<Arg0Type>>::value)
+        {
+            // Check the bounds once for all leading trivially serializable arguments
+            constexpr size_t Size = GetTriviallySerializableSize<Arg0Type, ArgTypes...>();
+            if (m_Ptr + Size > m_End)
+            {
+                UNEXPECTED("Note enough data to read ", Size, " bytes");
+                return false;
+            }
+            return ReadUnchecked(Arg0, Args...);
+        }
+        else
+        {
+            if (!Serialize<RawType<Arg0Type>>(Arg0))
+                return false;
 
-        return operator()(Args...);
+            return operator()(Args...);
+        }
     }
 
     template <typename Arg0Type>
@@ -296,6 +333,41 @@ private:
     template <typename T>
     bool Copy(T* pData, size_t Size);
 
+    // Returns the total size of the leading trivially serializable types
+    template <typename Arg0Type, typename... ArgTypes>
+    static constexpr size_t GetTriviallySerializableSize()
+    {
+        if constexpr (!IsTriviallySerializable<RawType<Arg0Type>>::value)
+            return 0;
+        else if constexpr (sizeof...(ArgTypes) == 0)
+            return sizeof(Arg0Type);
+        else
+            return sizeof(Arg0Type) + GetTriviallySerializableSize<ArgTypes...>();
+    }
+
+    // Reads the leading trivially serializable arguments without checking the bounds.
+    // The caller must make sure that there is enough data.
+    template <typename Arg0Type, typename... ArgTypes>
+    bool ReadUnchecked(Arg0Type& Arg0, ArgTypes&... Args)
+    {
+        static_assert(Mode == SerializerMode::Read, "This method is only allowed in Read mode");
+        if constexpr (IsTriviallySerializable<RawType<Arg0Type>>::value)
+        {
+            static_assert(IsAlignedBaseClass<Arg0Type>::Value, "There is unused space at the end of the structure that may be filled with garbage. Use padding to zero-initialize this space and avoid nasty issues.");
+            std::memcpy(static_cast<void*>(&Arg0), m_Ptr, sizeof(Arg0));
+            m_Ptr += sizeof(Arg0);
+
+            if constexpr (sizeof...(ArgTypes) > 0)
+                return ReadUnchecked(Args...);
+            else
+                return true;
+        }
+        else
+        {
+            return operator()(Arg0, Args...);
+        }
+    }
+
     void AlignOffset(size_t Alignment)
     {
         const size_t Size       = GetSize();
@@ -309,6 +381,8 @@ private:
     TPointer const m_End   = nullptr;
 
     TPointer m_Ptr = nullptr;
+
+    const bool m_ZeroCopyArrays = false;
 };
 
 #define CHECK_REMAINING_SIZE(Size, ...) \
@@ -495,6 +569,55 @@ bool Serializer<Mode>::SerializeArrayRaw(DynamicLinearAllocator* Allocator,
                           });
 }
 
+template <>
+template <typename ElemPtrType, typename CountType>
+bool Serializer<SerializerMode::Read>::SerializeArrayRaw(DynamicLinearAllocator* Allocator,
+                                                         ElemPtrType&            DstArray,
+                                                         CountType&              Count)
+{
+    using ElemType = RawType<decltype(DstArray[0])>;
+    if constexpr (IsTriviallySerializable<ElemType>::value)
+    {
+        static_assert(IsAlignedBaseClass<ElemType>::Value, "There is unused space at the end of the structure that may be filled with garbage. Use padding to zero-initialize this space and avoid nasty issues.");
+        VERIFY_EXPR(DstArray == nullptr);
+
+        if (!(*this)(Count))
+            return false;
+
+        // Check the bounds once for the entire array
+        const size_t Size = sizeof(ElemType) * static_cast<size_t>(Count);
+        CHECK_REMAINING_SIZE(Size, "Note enough data to read ", Count, " array elements");
+        if (Count == 0)
+            return true;
+
+        if constexpr (std::is_const<std::remove_reference_t<decltype(DstArray[0])>>::value)
+        {
+            if (m_ZeroCopyArrays && reinterpret_cast<size_t>(m_Ptr) % alignof(ElemType) == 0)
+            {
+                DstArray = reinterpret_cast<const ElemType*>(m_Ptr);
+                m_Ptr += Size;
+                return true;
+            }
+        }
+
+        VERIFY_EXPR(Allocator != nullptr);
+        ElemType* pDstElements = Allocator->Allocate<ElemType>(Count);
+        std::memcpy(static_cast<void*>(pDstElements), m_Ptr, Size);
+        m_Ptr += Size;
+        DstArray = pDstElements;
+
+        return true;
+    }
+    else
+    {
+        return SerializeArray(Allocator, DstArray, Count,
+                              [](Serializer<SerializerMode::Read>& Ser, auto& Elem) //
+                              {
+                                  return Ser(Elem);
+                              });
+    }
+}
+
 #undef CHECK_REMAINING_SIZE
 
 } // namespace Diligent
@@ -265,6 +265,12 @@ DILIGENT_BEGIN_INTERFACE(IThreadPool, IObject)
     /// Returns the number of currently running tasks
     VIRTUAL Uint32 METHOD(GetRunningTaskCount)(THIS) CONST PURE;
 
+    /// Returns the number of worker threads the pool was created with.
+
+    /// Tasks may also be processed by the application threads that call
+    /// ProcessTask(), which are not included in this number.
+    VIRTUAL Uint32 METHOD(GetThreadCount)(THIS) CONST PURE;
+
 
     /// Stops all worker threads after draining queued tasks.
 
@@ -348,6 +354,7 @@ DILIGENT_END_INTERFACE
 #    define IThreadPool_WaitForAllTasks(This)       CALL_IFACE_METHOD(ThreadPool, WaitForAllTasks, This)
 #    define IThreadPool_GetQueueSize(This)          CALL_IFACE_METHOD(ThreadPool, GetQueueSize, This)
 #    define IThreadPool_GetRunningTaskCount(This)   CALL_IFACE_METHOD(ThreadPool, GetRunningTaskCount, This)
+#    define IThreadPool_GetThreadCount(This)        CALL_IFACE_METHOD(ThreadPool, GetThreadCount, This)
 #    define IThreadPool_StopThreads(This)           CALL_IFACE_METHOD(ThreadPool, StopThreads, This)
 #    define IThreadPool_ProcessTask(This, ...)      CALL_IFACE_METHOD(ThreadPool, ProcessTask, This, __VA_ARGS__)
 
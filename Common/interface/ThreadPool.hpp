@@ -31,10 +31,12 @@
 
 #include "ThreadPool.h"
 
+#include <algorithm>
 #include <atomic>
 #include <cmath>
 #include <condition_variable>
 #include <functional>
+#include <memory>
 #include <mutex>
 
 #include "../../Platforms/Basic/interface/DebugUtilities.hpp"
@@ -266,4 +268,75 @@ RefCntAutoPtr<IAsyncTask> EnqueueAsyncWork(IThreadPool* pThreadPool,
     return EnqueueAsyncWork(pThreadPool, nullptr, 0, std::move(Handler), fPriority);
 }
 
+/// Calls the handler for every index in [0, NumItems) and waits until all items are processed.
+
+/// \param [in] pThreadPool - An optional thread pool. If null, all items are processed by the calling thread.
+/// \param [in] NumItems    - The number of items to process.
+/// \param [in] Handler     - The function to call for every item index.
+///
+/// The items are processed by the pool threads together with the calling thread.
+/// The function only waits for the items that are being processed, not for the tasks
+/// that have not started yet, so it may also be called from a task running in the pool.
+/// Tasks that start after the function has returned find no items left and exit.
+inline void ParallelFor(IThreadPool* pThreadPool, size_t NumItems, const std::function<void(size_t)>& Handler)
+{
+    if (pThreadPool == nullptr || NumItems <= 1)
+    {
+        for (size_t i = 0; i < NumItems; ++i)
+            Handler(i);
+        return;
+    }
+
+    struct ParallelForState
+    {
+        ParallelForState(const std::function<void(size_t)>& _Handler, size_t _NumItems) :
+            Handler{_Handler},
+            NumItems{_NumItems}
+        {}
+
+        const std::function<void(size_t)>& Handler;
+        const size_t                       NumItems;
+
+        std::atomic<size_t> NextItem{0};
+
+        std::mutex              CompletedMtx;
+        std::condition_variable CompletedCV;
+        size_t                  NumCompleted = 0;
+
+        // Processes items until there are none left
+        void Run()
+        {
+            for (size_t i = NextItem.fetch_add(1); i < NumItems; i = NextItem.fetch_add(1))
+            {
+                Handler(i);
+
+                std::lock_guard<std::mutex> Lock{CompletedMtx};
+                if (++NumCompleted == NumItems)
+                    CompletedCV.notify_all();
+            }
+        }
+    };
+
+    // The state is shared with the tasks that may start after ParallelFor() has returned
+    std::shared_ptr<ParallelForState> pState = std::make_shared<ParallelForState>(Handler, NumItems);
+
+    // The calling thread processes items too, so one task less than the number of items is needed.
+    // Every task keeps pulling items until none are left, so there is no point in enqueuing more
+    // tasks than there are worker threads in the pool.
+    const size_t NumTasks = (std::min)(NumItems - 1, size_t{pThreadPool->GetThreadCount()});
+    for (size_t i = 0; i < NumTasks; ++i)
+    {
+        EnqueueAsyncWork(pThreadPool,
+                         [pState](Uint32 ThreadId) {
+                             pState->Run();
+                             return ASYNC_TASK_STATUS_COMPLETE;
+                         });
+    }
+
+    pState->Run();
+
+    std::unique_lock<std::mutex> Lock{pState->CompletedMtx};
+    pState->CompletedCV.wait(Lock, [&pState]() { return pState->NumCompleted == pState->NumItems; });
+}
+
 } // namespace Diligent
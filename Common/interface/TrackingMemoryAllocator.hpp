@@ -0,0 +1,148 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Declaration of Diligent::TrackingMemoryAllocator class
+
+#include <mutex>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "../../Primitives/interface/MemoryAllocator.h"
+#include "DefaultRawMemoryAllocator.hpp"
+
+namespace Diligent
+{
+
+/// Memory allocator that aggregates allocation statistics per description tag.
+
+/// The allocator forwards all requests to the underlying raw allocator and
+/// accounts every allocation to the tag given by its dbgDescription argument
+/// (e.g. the description passed to ALLOCATE_RAW or NEW_RC_OBJ).
+/// Statistics are collected in release builds too, so the allocator can be used
+/// in production to find out which subsystems own the memory:
+///
+///     static TrackingMemoryAllocator Allocator;
+///     SetRawAllocator(&Allocator);
+///     ...
+///     Allocator.DumpReport();
+///
+/// Counters are kept per thread, so the allocator does not add any locks or
+/// atomic read-modify-write operations to the allocation path once the
+/// thread has seen the tag.
+///
+/// \note   The allocator must outlive all allocations made through it.
+class TrackingMemoryAllocator final : public IMemoryAllocator
+{
+public:
+    explicit TrackingMemoryAllocator(IMemoryAllocator& RawAllocator = DefaultRawMemoryAllocator::GetAllocator());
+    ~TrackingMemoryAllocator();
+
+    // clang-format off
+    TrackingMemoryAllocator             (const TrackingMemoryAllocator&) = delete;
+    TrackingMemoryAllocator             (TrackingMemoryAllocator&&)      = delete;
+    TrackingMemoryAllocator& operator = (const TrackingMemoryAllocator&) = delete;
+    TrackingMemoryAllocator& operator = (TrackingMemoryAllocator&&)      = delete;
+    // clang-format on
+
+    /// Allocates block of memory
+    virtual void* Allocate(size_t Size, const Char* dbgDescription, const char* dbgFileName, const Int32 dbgLineNumber) override final;
+
+    /// Releases memory
+    virtual void Free(void* Ptr) override final;
+
+    /// Allocates block of memory with specified alignment
+    virtual void* AllocateAligned(size_t Size, size_t Alignment, const Char* dbgDescription, const char* dbgFileName, const Int32 dbgLineNumber) override final;
+
+    /// Releases memory allocated with AllocateAligned
+    virtual void FreeAligned(void* Ptr) override final;
+
+    /// Allocation statistics of a single tag
+    struct TagStats
+    {
+        /// Tag name, i.e. the allocation description
+        std::string Tag;
+
+        /// The number of bytes currently allocated
+        Int64 LiveBytes = 0;
+
+        /// The number of currently live allocations
+        Int64 LiveAllocations = 0;
+
+        /// The total number of allocations made so far
+        Uint64 NumAllocations = 0;
+
+        /// The total number of frees made so far
+        Uint64 NumFrees = 0;
+
+        /// The total number of bytes allocated so far
+        Uint64 AllocatedBytes = 0;
+    };
+
+    /// Returns statistics of all tags that have been used, sorted by the number of live bytes.
+    std::vector<TagStats> GetStats() const;
+
+    /// Returns statistics accumulated over all tags.
+    TagStats GetTotals() const;
+
+    /// Returns a human-readable report.
+
+    /// \param [in] MaxTags - The maximum number of tags to include in the report.
+    ///                       If 0, all tags are included.
+    std::string GetReport(size_t MaxTags = 0) const;
+
+    /// Prints the report to the debug output.
+    void DumpReport(size_t MaxTags = 0) const;
+
+private:
+    struct ThreadData;
+
+    void* AllocateWithHeader(size_t Size, size_t Alignment, const Char* dbgDescription);
+    void* FreeWithHeader(void* Ptr);
+
+    ThreadData& GetThreadData();
+    Uint32      GetTagId(ThreadData& Data, const Char* Tag);
+    Uint32      RegisterTag(const Char* Tag);
+
+private:
+    IMemoryAllocator& m_RawAllocator;
+
+    // Unique allocator id that identifies the allocator in the thread-local storage
+    const Uint64 m_Id;
+
+    mutable std::mutex                      m_TagsMtx;
+    std::unordered_map<std::string, Uint32> m_TagIds;
+    std::vector<std::string>                m_TagNames;
+
+    mutable std::mutex                       m_ThreadsMtx;
+    std::vector<std::unique_ptr<ThreadData>> m_Threads;
+};
+
+} // namespace Diligent
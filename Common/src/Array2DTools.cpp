@@ -27,10 +27,15 @@
 #include "Array2DTools.hpp"
 
 #include <algorithm>
+#include <utility>
+#include <vector>
 
 #include "Intrinsics.hpp"
 #include "DebugUtilities.hpp"
 #include "Align.hpp"
+#include "Float16.hpp"
+#include "ThreadPool.hpp"
+#include "X86Features.hpp"
 
 namespace Diligent
 {
@@ -38,94 +43,389 @@ namespace Diligent
 namespace
 {
 
-void GetArray2DMinMaxValueGeneric(const float* pData,
-                                  size_t       StrideInFloats,
-                                  Uint32       Width,
-                                  Uint32       Height,
-                                  float&       MinValue,
-                                  float&       MaxValue)
+// Elements are compared through keys. For all types except Float16, the key is the element itself.
+template <typename T>
+struct MinMaxKey
 {
-    for (size_t row = 0; row < Height; ++row)
+    using Type = T;
+
+    static Type FromElement(T Val) { return Val; }
+    static T    ToElement(Type Key) { return Key; }
+};
+
+// Half-precision floats are compared as 16-bit signed integers: for negative values, all bits except
+// the sign are flipped, which reverses their order. The transform is its own inverse.
+template <>
+struct MinMaxKey<Float16>
+{
+    using Type = Int16;
+
+    static Type FromElement(Float16 Val)
+    {
+        const Int16 Bits = static_cast<Int16>(Val.Raw());
+        return static_cast<Int16>(Bits ^ ((Bits >> 15) & 0x7FFF));
+    }
+    static Float16 ToElement(Type Key)
+    {
+        return Float16{static_cast<Uint16>(Key ^ ((Key >> 15) & 0x7FFF))};
+    }
+};
+
+template <typename T>
+using MinMaxKeyType = typename MinMaxKey<T>::Type;
+
+// Updates MinKey and MaxKey with the values in NumRows rows starting at pData.
+// MinKey and MaxKey must be initialized with the key of any element in the rows.
+template <typename T>
+using GetRowsMinMaxProcType = void (*)(const T* pData, size_t Stride, Uint32 Width, Uint32 NumRows, MinMaxKeyType<T>& MinKey, MinMaxKeyType<T>& MaxKey);
+
+template <typename T>
+void GetRowsMinMaxGeneric(const T*          pData,
+                          size_t            Stride,
+                          Uint32            Width,
+                          Uint32            NumRows,
+                          MinMaxKeyType<T>& MinKey,
+                          MinMaxKeyType<T>& MaxKey)
+{
+    for (size_t row = 0; row < NumRows; ++row)
     {
-        const float* pRowStart = pData + row * StrideInFloats;
-        const float* pRowEnd   = pRowStart + Width;
-        for (const float* ptr = pRowStart; ptr < pRowEnd; ++ptr)
+        const T* pRowStart = pData + row * Stride;
+        const T* pRowEnd   = pRowStart + Width;
+        for (const T* ptr = pRowStart; ptr < pRowEnd; ++ptr)
         {
-            MinValue = std::min(MinValue, *ptr);
-            MaxValue = std::max(MaxValue, *ptr);
+            const MinMaxKeyType<T> Key = MinMaxKey<T>::FromElement(*ptr);
+
+            MinKey = std::min(MinKey, Key);
+            MaxKey = std::max(MaxKey, Key);
         }
     }
 }
 
-#if DILIGENT_AVX2_ENABLED
-bool GetArray2DMinMaxValueAVX2(const float* pData,
-                               size_t       StrideInFloats,
-                               Uint32       Width,
-                               Uint32       Height,
-                               float&       MinValue,
-                               float&       MaxValue)
-{
-    MinValue   = pData[0];
-    MaxValue   = pData[0];
-    auto mmMin = _mm256_set1_ps(MinValue);
-    auto mmMax = _mm256_set1_ps(MaxValue);
-    for (size_t row = 0; row < Height; ++row)
+// Reduces the lanes of the min/max vectors and combines the result with MinKey and MaxKey
+template <typename Ops>
+void CombineLanes(const typename Ops::KeyType (&Mins)[Ops::NumLanes],
+                  const typename Ops::KeyType (&Maxs)[Ops::NumLanes],
+                  typename Ops::KeyType& MinKey,
+                  typename Ops::KeyType& MaxKey)
+{
+    for (Uint32 i = 0; i < Ops::NumLanes; ++i)
+    {
+        MinKey = std::min(MinKey, Mins[i]);
+        MaxKey = std::max(MaxKey, Maxs[i]);
+    }
+}
+
+#if DILIGENT_AVX2_SUPPORTED
+
+template <typename T>
+struct SSE41Ops;
+
+template <>
+struct SSE41Ops<float>
+{
+    using ElementType = float;
+    using KeyType     = float;
+    using VectorType  = __m128;
+
+    static constexpr Uint32 NumLanes = 4;
+
+    // clang-format off
+    static DILIGENT_TARGET_SSE41 VectorType Load(const float* pSrc)          { return _mm_loadu_ps(pSrc); }
+    static DILIGENT_TARGET_SSE41 VectorType Set1(float Key)                  { return _mm_set1_ps(Key); }
+    static DILIGENT_TARGET_SSE41 VectorType Min(VectorType a, VectorType b)  { return _mm_min_ps(a, b); }
+    static DILIGENT_TARGET_SSE41 VectorType Max(VectorType a, VectorType b)  { return _mm_max_ps(a, b); }
+    static DILIGENT_TARGET_SSE41 void       Store(float* pDst, VectorType v) { _mm_storeu_ps(pDst, v); }
+    // clang-format on
+};
+
+template <>
+struct SSE41Ops<Int32>
+{
+    using ElementType = Int32;
+    using KeyType     = Int32;
+    using VectorType  = __m128i;
+
+    static constexpr Uint32 NumLanes = 4;
+
+    // clang-format off
+    static DILIGENT_TARGET_SSE41 VectorType Load(const Int32* pSrc)          { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc)); }
+    static DILIGENT_TARGET_SSE41 VectorType Set1(Int32 Key)                  { return _mm_set1_epi32(Key); }
+    static DILIGENT_TARGET_SSE41 VectorType Min(VectorType a, VectorType b)  { return _mm_min_epi32(a, b); }
+    static DILIGENT_TARGET_SSE41 VectorType Max(VectorType a, VectorType b)  { return _mm_max_epi32(a, b); }
+    static DILIGENT_TARGET_SSE41 void       Store(Int32* pDst, VectorType v) { _mm_storeu_si128(reinterpret_cast<__m128i*>(pDst), v); }
+    // clang-format on
+};
+
+template <>
+struct SSE41Ops<Uint16>
+{
+    using ElementType = Uint16;
+    using KeyType     = Uint16;
+    using VectorType  = __m128i;
+
+    static constexpr Uint32 NumLanes = 8;
+
+    // clang-format off
+    static DILIGENT_TARGET_SSE41 VectorType Load(const Uint16* pSrc)          { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc)); }
+    static DILIGENT_TARGET_SSE41 VectorType Set1(Uint16 Key)                  { return _mm_set1_epi16(static_cast<short>(Key)); }
+    static DILIGENT_TARGET_SSE41 VectorType Min(VectorType a, VectorType b)   { return _mm_min_epu16(a, b); }
+    static DILIGENT_TARGET_SSE41 VectorType Max(VectorType a, VectorType b)   { return _mm_max_epu16(a, b); }
+    static DILIGENT_TARGET_SSE41 void       Store(Uint16* pDst, VectorType v) { _mm_storeu_si128(reinterpret_cast<__m128i*>(pDst), v); }
+    // clang-format on
+};
+
+template <>
+struct SSE41Ops<Float16>
+{
+    using ElementType = Float16;
+    using KeyType     = Int16;
+    using VectorType  = __m128i;
+
+    static constexpr Uint32 NumLanes = 8;
+
+    static DILIGENT_TARGET_SSE41 VectorType Load(const Float16* pSrc)
+    {
+        const __m128i Bits = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc));
+        return _mm_xor_si128(Bits, _mm_and_si128(_mm_srai_epi16(Bits, 15), _mm_set1_epi16(0x7FFF)));
+    }
+    // clang-format off
+    static DILIGENT_TARGET_SSE41 VectorType Set1(Int16 Key)                  { return _mm_set1_epi16(Key); }
+    static DILIGENT_TARGET_SSE41 VectorType Min(VectorType a, VectorType b)  { return _mm_min_epi16(a, b); }
+    static DILIGENT_TARGET_SSE41 VectorType Max(VectorType a, VectorType b)  { return _mm_max_epi16(a, b); }
+    static DILIGENT_TARGET_SSE41 void       Store(Int16* pDst, VectorType v) { _mm_storeu_si128(reinterpret_cast<__m128i*>(pDst), v); }
+    // clang-format on
+};
+
+template <typename T>
+struct AVX2Ops;
+
+template <>
+struct AVX2Ops<float>
+{
+    using ElementType = float;
+    using KeyType     = float;
+    using VectorType  = __m256;
+
+    static constexpr Uint32 NumLanes = 8;
+
+    // clang-format off
+    // NOTE: MSVC generates vmovups when using _mm256_load_ps regardless,
+    //       so no reason to bother with aligning the pointer.
+    static DILIGENT_TARGET_AVX2 VectorType Load(const float* pSrc)          { return _mm256_loadu_ps(pSrc); }
+    static DILIGENT_TARGET_AVX2 VectorType Set1(float Key)                  { return _mm256_set1_ps(Key); }
+    static DILIGENT_TARGET_AVX2 VectorType Min(VectorType a, VectorType b)  { return _mm256_min_ps(a, b); }
+    static DILIGENT_TARGET_AVX2 VectorType Max(VectorType a, VectorType b)  { return _mm256_max_ps(a, b); }
+    static DILIGENT_TARGET_AVX2 void       Store(float* pDst, VectorType v) { _mm256_storeu_ps(pDst, v); }
+    // clang-format on
+};
+
+template <>
+struct AVX2Ops<Int32>
+{
+    using ElementType = Int32;
+    using KeyType     = Int32;
+    using VectorType  = __m256i;
+
+    static constexpr Uint32 NumLanes = 8;
+
+    // clang-format off
+    static DILIGENT_TARGET_AVX2 VectorType Load(const Int32* pSrc)          { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pSrc)); }
+    static DILIGENT_TARGET_AVX2 VectorType Set1(Int32 Key)                  { return _mm256_set1_epi32(Key); }
+    static DILIGENT_TARGET_AVX2 VectorType Min(VectorType a, VectorType b)  { return _mm256_min_epi32(a, b); }
+    static DILIGENT_TARGET_AVX2 VectorType Max(VectorType a, VectorType b)  { return _mm256_max_epi32(a, b); }
+    static DILIGENT_TARGET_AVX2 void       Store(Int32* pDst, VectorType v) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(pDst), v); }
+    // clang-format on
+};
+
+template <>
+struct AVX2Ops<Uint16>
+{
+    using ElementType = Uint16;
+    using KeyType     = Uint16;
+    using VectorType  = __m256i;
+
+    static constexpr Uint32 NumLanes = 16;
+
+    // clang-format off
+    static DILIGENT_TARGET_AVX2 VectorType Load(const Uint16* pSrc)          { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pSrc)); }
+    static DILIGENT_TARGET_AVX2 VectorType Set1(Uint16 Key)                  { return _mm256_set1_epi16(static_cast<short>(Key)); }
+    static DILIGENT_TARGET_AVX2 VectorType Min(VectorType a, VectorType b)   { return _mm256_min_epu16(a, b); }
+    static DILIGENT_TARGET_AVX2 VectorType Max(VectorType a, VectorType b)   { return _mm256_max_epu16(a, b); }
+    static DILIGENT_TARGET_AVX2 void       Store(Uint16* pDst, VectorType v) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(pDst), v); }
+    // clang-format on
+};
+
+template <>
+struct AVX2Ops<Float16>
+{
+    using ElementType = Float16;
+    using KeyType     = Int16;
+    using VectorType  = __m256i;
+
+    static constexpr Uint32 NumLanes = 16;
+
+    static DILIGENT_TARGET_AVX2 VectorType Load(const Float16* pSrc)
     {
-        const float* pRowStart = pData + row * StrideInFloats;
-        const float* pRowEnd   = pRowStart + Width;
-        const float* pAVXEnd   = pRowEnd - 8;
+        const __m256i Bits = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pSrc));
+        return _mm256_xor_si256(Bits, _mm256_and_si256(_mm256_srai_epi16(Bits, 15), _mm256_set1_epi16(0x7FFF)));
+    }
+    // clang-format off
+    static DILIGENT_TARGET_AVX2 VectorType Set1(Int16 Key)                  { return _mm256_set1_epi16(Key); }
+    static DILIGENT_TARGET_AVX2 VectorType Min(VectorType a, VectorType b)  { return _mm256_min_epi16(a, b); }
+    static DILIGENT_TARGET_AVX2 VectorType Max(VectorType a, VectorType b)  { return _mm256_max_epi16(a, b); }
+    static DILIGENT_TARGET_AVX2 void       Store(Int16* pDst, VectorType v) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(pDst), v); }
+    // clang-format on
+};
+
+// The SSE4.1 and AVX2 versions are identical except for the target attribute: GCC and clang
+// do not allow inlining the intrinsics into a function that does not enable the instruction set.
+template <typename Ops>
+DILIGENT_TARGET_SSE41 void GetRowsMinMaxSSE41(const typename Ops::ElementType* pData,
+                                              size_t                           Stride,
+                                              Uint32                           Width,
+                                              Uint32                           NumRows,
+                                              typename Ops::KeyType&           MinKey,
+                                              typename Ops::KeyType&           MaxKey)
+{
+    if (Width < Ops::NumLanes)
+    {
+        GetRowsMinMaxGeneric(pData, Stride, Width, NumRows, MinKey, MaxKey);
+        return;
+    }
 
-        const float* Ptr = pRowStart;
-        for (; Ptr < pAVXEnd; Ptr += 8)
+    auto vMin = Ops::Set1(MinKey);
+    auto vMax = Ops::Set1(MaxKey);
+    for (size_t row = 0; row < NumRows; ++row)
+    {
+        const typename Ops::ElementType* pRow = pData + row * Stride;
+        for (Uint32 col = 0; col < Width; col += Ops::NumLanes)
         {
-            // NOTE: MSVC generates vmovups when using _mm256_load_ps regardless,
-            //       so no reason to bother with aligning the pointer.
-            auto mmVal = _mm256_loadu_ps(Ptr);
+            // The last vector overlaps the previous one, which does not affect the min and max.
+            const auto vVal = Ops::Load(pRow + std::min(col, Width - Ops::NumLanes));
 
-            mmMin = _mm256_min_ps(mmMin, mmVal);
-            mmMax = _mm256_max_ps(mmMax, mmVal);
+            vMin = Ops::Min(vMin, vVal);
+            vMax = Ops::Max(vMax, vVal);
         }
+    }
+
+    typename Ops::KeyType Mins[Ops::NumLanes];
+    typename Ops::KeyType Maxs[Ops::NumLanes];
+    Ops::Store(Mins, vMin);
+    Ops::Store(Maxs, vMax);
+    CombineLanes<Ops>(Mins, Maxs, MinKey, MaxKey);
+}
+
+template <typename Ops>
+DILIGENT_TARGET_AVX2 void GetRowsMinMaxAVX2(const typename Ops::ElementType* pData,
+                                            size_t                           Stride,
+                                            Uint32                           Width,
+                                            Uint32                           NumRows,
+                                            typename Ops::KeyType&           MinKey,
+                                            typename Ops::KeyType&           MaxKey)
+{
+    if (Width < Ops::NumLanes)
+    {
+        GetRowsMinMaxSSE41<SSE41Ops<typename Ops::ElementType>>(pData, Stride, Width, NumRows, MinKey, MaxKey);
+        return;
+    }
 
-        for (; Ptr < pRowEnd; ++Ptr)
+    auto vMin = Ops::Set1(MinKey);
+    auto vMax = Ops::Set1(MaxKey);
+    for (size_t row = 0; row < NumRows; ++row)
+    {
+        const typename Ops::ElementType* pRow = pData + row * Stride;
+        for (Uint32 col = 0; col < Width; col += Ops::NumLanes)
         {
-            MinValue = std::min(MinValue, *Ptr);
-            MaxValue = std::max(MaxValue, *Ptr);
+            const auto vVal = Ops::Load(pRow + std::min(col, Width - Ops::NumLanes));
+
+            vMin = Ops::Min(vMin, vVal);
+            vMax = Ops::Max(vMax, vVal);
         }
     }
 
-// Shuffle only works within 128-bit halves
-#    define MAKE_SHUFFLE(i0, i1, i2, i3) ((i0 << 0) | (i1 << 2) | (i2 << 4) | (i3 << 6))
-    constexpr int Shuffle1032 = MAKE_SHUFFLE(1, 0, 3, 2);
-    // |  0  |  1  |  2  |  3  |       |  1  |  0  |  3  |  2  |
-    // |  A  |  B  |  C  |  D  |   =>  |  B  |  A  |  D  |  C  |
-    mmMin = _mm256_min_ps(mmMin, _mm256_permute_ps(mmMin, Shuffle1032));
-    mmMax = _mm256_max_ps(mmMax, _mm256_permute_ps(mmMax, Shuffle1032));
-
-    constexpr int Shuffle2301 = MAKE_SHUFFLE(2, 3, 0, 1);
-    //       0           1           2          3                    2           3           0           1
-    // | max(A, B) | max(A, B) | max(C, D) | max(C, D) |  =>  | max(C, D) | max(C, D) | max(A, B) | max(A, B) |
-    mmMin = _mm256_min_ps(mmMin, _mm256_permute_ps(mmMin, Shuffle2301));
-    mmMax = _mm256_max_ps(mmMax, _mm256_permute_ps(mmMax, Shuffle2301));
-
-    // Note that _mm256_permute_ps is faster than _mm256_permutevar8x32_ps
-    const auto SelectElement4 = _mm256_set1_epi32(4);
-    // We only need to do min/max between elements 4 and 0
-    mmMin = _mm256_min_ps(mmMin, _mm256_permutevar8x32_ps(mmMin, SelectElement4));
-    mmMax = _mm256_max_ps(mmMax, _mm256_permutevar8x32_ps(mmMax, SelectElement4));
-
-    // Extract lower 128 bits
-    auto mMin0123 = _mm256_castps256_ps128(mmMin);
-    auto mMax0123 = _mm256_castps256_ps128(mmMax);
-
-    float Min0, Max0;
-    _mm_store_ss(&Min0, mMin0123);
-    _mm_store_ss(&Max0, mMax0123);
-    MinValue = std::min(Min0, MinValue);
-    MaxValue = std::max(Max0, MaxValue);
-
-    return true;
+    typename Ops::KeyType Mins[Ops::NumLanes];
+    typename Ops::KeyType Maxs[Ops::NumLanes];
+    Ops::Store(Mins, vMin);
+    Ops::Store(Maxs, vMax);
+    CombineLanes<Ops>(Mins, Maxs, MinKey, MaxKey);
 }
+
+#endif // DILIGENT_AVX2_SUPPORTED
+
+template <typename T>
+GetRowsMinMaxProcType<T> SelectGetRowsMinMaxProc()
+{
+#if DILIGENT_AVX2_SUPPORTED
+    const X86Features& Features = GetX86Features();
+    if (Features.AVX2)
+        return GetRowsMinMaxAVX2<AVX2Ops<T>>;
+    if (Features.SSE41)
+        return GetRowsMinMaxSSE41<SSE41Ops<T>>;
+    return GetRowsMinMaxGeneric<T>;
+#else
+    return GetRowsMinMaxGeneric<T>;
 #endif
+}
+
+template <typename T>
+void GetArray2DMinMaxValueImpl(const T*     pData,
+                               size_t       Stride,
+                               Uint32       Width,
+                               Uint32       Height,
+                               T&           MinValue,
+                               T&           MaxValue,
+                               IThreadPool* pThreadPool)
+{
+    if (Width == 0 || Height == 0)
+        return;
+
+    DEV_CHECK_ERR(pData != nullptr, "Data pointer must not be null");
+    DEV_CHECK_ERR(Height == 1 || Stride >= Width, "Row stride (", Stride, ") must be at least ", Width);
+    DEV_CHECK_ERR(AlignDown(pData, alignof(T)) == pData, "Data pointer is not naturally aligned");
+
+    // The implementation is selected once, on the first call
+    static const GetRowsMinMaxProcType<T> GetRowsMinMax = SelectGetRowsMinMaxProc<T>();
+
+    using KeyType = MinMaxKeyType<T>;
+
+    // Tiles of about 64K elements are large enough to amortize the scheduling overhead
+    // and small enough to balance the load between the threads.
+    const Uint32 RowsPerTile = std::max(65536u / Width, 1u);
+    const Uint32 NumTiles    = (Height + RowsPerTile - 1) / RowsPerTile;
+    // Smaller arrays are processed faster than the tasks can be started.
+    constexpr size_t MinParallelElements = size_t{1} << 18;
+    if (pThreadPool != nullptr && NumTiles > 1 && size_t{Width} * Height >= MinParallelElements)
+    {
+        std::vector<std::pair<KeyType, KeyType>> TileMinMax(NumTiles);
+        ParallelFor(pThreadPool, NumTiles, [&](size_t Tile) {
+            const Uint32 StartRow = static_cast<Uint32>(Tile) * RowsPerTile;
+            const T*     pTile    = pData + StartRow * Stride;
+
+            KeyType MinKey = MinMaxKey<T>::FromElement(pTile[0]);
+            KeyType MaxKey = MinKey;
+            GetRowsMinMax(pTile, Stride, Width, std::min(RowsPerTile, Height - StartRow), MinKey, MaxKey);
+            TileMinMax[Tile] = {MinKey, MaxKey};
+        });
+
+        KeyType MinKey = TileMinMax[0].first;
+        KeyType MaxKey = TileMinMax[0].second;
+        for (const auto& Tile : TileMinMax)
+        {
+            MinKey = std::min(MinKey, Tile.first);
+            MaxKey = std::max(MaxKey, Tile.second);
+        }
+        MinValue = MinMaxKey<T>::ToElement(MinKey);
+        MaxValue = MinMaxKey<T>::ToElement(MaxKey);
+    }
+    else
+    {
+        KeyType MinKey = MinMaxKey<T>::FromElement(pData[0]);
+        KeyType MaxKey = MinKey;
+        GetRowsMinMax(pData, Stride, Width, Height, MinKey, MaxKey);
+        MinValue = MinMaxKey<T>::ToElement(MinKey);
+        MaxValue = MinMaxKey<T>::ToElement(MaxKey);
+    }
+}
 
 } // namespace
 
@@ -134,22 +434,43 @@ void GetArray2DMinMaxValue(const float* pData,
                            Uint32       Width,
                            Uint32       Height,
                            float&       MinValue,
-                           float&       MaxValue)
+                           float&       MaxValue,
+                           IThreadPool* pThreadPool)
 {
-    if (Width == 0 || Height == 0)
-        return;
+    GetArray2DMinMaxValueImpl(pData, StrideInFloats, Width, Height, MinValue, MaxValue, pThreadPool);
+}
 
-    DEV_CHECK_ERR(pData != nullptr, "Data pointer must not be null");
-    DEV_CHECK_ERR(Height == 1 || StrideInFloats >= Width, "Row stride (", StrideInFloats, ") must be at least ", Width);
-    DEV_CHECK_ERR(AlignDown(pData, alignof(float)) == pData, "Data pointer is not naturally aligned");
+void GetArray2DMinMaxValue(const Uint16* pData,
+                           size_t        StrideInElements,
+                           Uint32        Width,
+                           Uint32        Height,
+                           Uint16&       MinValue,
+                           Uint16&       MaxValue,
+                           IThreadPool*  pThreadPool)
+{
+    GetArray2DMinMaxValueImpl(pData, StrideInElements, Width, Height, MinValue, MaxValue, pThreadPool);
+}
 
-    MinValue = MaxValue = pData[0];
-#if DILIGENT_AVX2_ENABLED
-    if (GetArray2DMinMaxValueAVX2(pData, StrideInFloats, Width, Height, MinValue, MaxValue))
-        return;
-#endif
+void GetArray2DMinMaxValue(const Int32* pData,
+                           size_t       StrideInElements,
+                           Uint32       Width,
+                           Uint32       Height,
+                           Int32&       MinValue,
+                           Int32&       MaxValue,
+                           IThreadPool* pThreadPool)
+{
+    GetArray2DMinMaxValueImpl(pData, StrideInElements, Width, Height, MinValue, MaxValue, pThreadPool);
+}
 
-    GetArray2DMinMaxValueGeneric(pData, StrideInFloats, Width, Height, MinValue, MaxValue);
+void GetArray2DMinMaxValue(const Float16* pData,
+                           size_t         StrideInElements,
+                           Uint32         Width,
+                           Uint32         Height,
+                           Float16&       MinValue,
+                           Float16&       MaxValue,
+                           IThreadPool*   pThreadPool)
+{
+    GetArray2DMinMaxValueImpl(pData, StrideInElements, Width, Height, MinValue, MaxValue, pThreadPool);
 }
 
 } // namespace Diligent
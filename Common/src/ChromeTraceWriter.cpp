@@ -0,0 +1,180 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "pch.h"
+#include "ChromeTraceWriter.hpp"
+
+#include <atomic>
+#include <cstdio>
+
+#include "FileWrapper.hpp"
+#include "DebugUtilities.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+// Chrome trace timestamps are in microseconds
+void AppendMicroseconds(std::string& Json, Uint64 Nanoseconds)
+{
+    char Buffer[32];
+    snprintf(Buffer, sizeof(Buffer), "%llu.%03u",
+             static_cast<unsigned long long>(Nanoseconds / 1000),
+             static_cast<unsigned int>(Nanoseconds % 1000));
+    Json += Buffer;
+}
+
+} // namespace
+
+ChromeTraceWriter::ChromeTraceWriter() :
+    m_Json{"{\"traceEvents\":["}
+{
+}
+
+Uint64 ChromeTraceWriter::GetTimestamp(std::chrono::steady_clock::time_point Time) noexcept
+{
+    // Use the clock epoch rather than a module-local start time, so that
+    // the traces written by different modules are on the same timeline.
+    return static_cast<Uint64>(std::chrono::duration_cast<std::chrono::nanoseconds>(Time.time_since_epoch()).count());
+}
+
+Uint32 ChromeTraceWriter::GetThreadId() noexcept
+{
+    static std::atomic<Uint32> NextThreadId{0};
+    thread_local const Uint32  ThreadId = NextThreadId.fetch_add(1);
+    return ThreadId;
+}
+
+void ChromeTraceWriter::BeginEvent()
+{
+    VERIFY(!m_Finished, "No events may be added after the trace has been finished");
+    if (m_HasEvents)
+        m_Json.push_back(',');
+    m_Json += "\n{";
+    m_HasEvents = true;
+}
+
+void ChromeTraceWriter::AddProcessName(Uint32 ProcessId, const char* Name)
+{
+    BeginEvent();
+
+    char Buffer[64];
+    snprintf(Buffer, sizeof(Buffer), "\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%u,\"tid\":0,\"args\":{\"name\":", ProcessId);
+    m_Json += Buffer;
+    AppendJSONString(m_Json, Name);
+    m_Json += "}}";
+}
+
+void ChromeTraceWriter::AddThreadName(Uint32 ProcessId, Uint32 ThreadId, const char* Name)
+{
+    BeginEvent();
+
+    char Buffer[96];
+    snprintf(Buffer, sizeof(Buffer), "\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%u,\"tid\":%u,\"args\":{\"name\":", ProcessId, ThreadId);
+    m_Json += Buffer;
+    AppendJSONString(m_Json, Name);
+    m_Json += "}}";
+}
+
+void ChromeTraceWriter::AddCompleteEvent(const char* Name,
+                                         const char* Category,
+                                         Uint32      ProcessId,
+                                         Uint32      ThreadId,
+                                         Uint64      StartTime,
+                                         Uint64      Duration)
+{
+    BeginEvent();
+
+    m_Json += "\"name\":";
+    AppendJSONString(m_Json, Name);
+    m_Json += ",\"cat\":";
+    AppendJSONString(m_Json, Category);
+
+    char Buffer[64];
+    snprintf(Buffer, sizeof(Buffer), ",\"ph\":\"X\",\"pid\":%u,\"tid\":%u,\"ts\":", ProcessId, ThreadId);
+    m_Json += Buffer;
+    AppendMicroseconds(m_Json, StartTime);
+    m_Json += ",\"dur\":";
+    AppendMicroseconds(m_Json, Duration);
+    m_Json.push_back('}');
+}
+
+std::string ChromeTraceWriter::Finish()
+{
+    VERIFY(!m_Finished, "The trace has already been finished");
+    m_Finished = true;
+
+    m_Json += "\n],\"displayTimeUnit\":\"ms\"}\n";
+    return std::move(m_Json);
+}
+
+bool ChromeTraceWriter::Save(const char* FilePath, const std::string& Trace)
+{
+    FileWrapper File{FilePath, EFileAccessMode::Overwrite};
+    if (!File)
+    {
+        LOG_ERROR_MESSAGE("Failed to open file '", FilePath, "' to save the trace");
+        return false;
+    }
+
+    if (!File->Write(Trace.data(), Trace.size()))
+    {
+        LOG_ERROR_MESSAGE("Failed to write the trace to file '", FilePath, "'");
+        return false;
+    }
+
+    return true;
+}
+
+void ChromeTraceWriter::AppendJSONString(std::string& Json, const char* Str)
+{
+    Json.push_back('"');
+    for (const char* c = Str != nullptr ? Str : ""; *c != '\0'; ++c)
+    {
+        const unsigned char Char = static_cast<unsigned char>(*c);
+        if (Char == '"' || Char == '\\')
+        {
+            Json.push_back('\\');
+            Json.push_back(*c);
+        }
+        else if (Char < 0x20)
+        {
+            // Control characters must be escaped
+            char Buffer[8];
+            snprintf(Buffer, sizeof(Buffer), "\\u%04x", static_cast<unsigned int>(Char));
+            Json += Buffer;
+        }
+        else
+        {
+            Json.push_back(*c);
+        }
+    }
+    Json.push_back('"');
+}
+
+} // namespace Diligent
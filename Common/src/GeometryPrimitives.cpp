@@ -27,6 +27,8 @@
 #include "GeometryPrimitives.h"
 
 #include <array>
+#include <algorithm>
+#include <cfloat>
 
 #include "DebugUtilities.hpp"
 #include "BasicMath.hpp"
@@ -42,13 +44,370 @@ Uint32 GetGeometryPrimitiveVertexSize(GEOMETRY_PRIMITIVE_VERTEX_FLAGS VertexFlag
             ((VertexFlags & GEOMETRY_PRIMITIVE_VERTEX_FLAG_TEXCOORD) ? sizeof(float2) : 0));
 }
 
+namespace
+{
+
+static constexpr Uint32 NumCubeFaces = 6;
+
+// Describes how triangles of a subdivided cube face are ordered.
+//
+//   Each face is split into vertical bands that are BandWidth quads wide.
+//   Quads in a band are traversed row by row, so that the vertices of the
+//   previous row are still in the post-transform cache when the next row
+//   is processed. Each band is further split into meshlets that are
+//   MeshletRows rows tall.
+//
+//    Band 0   Band 1
+//   ________ ____
+//  |  |  |  |  |  |
+//  |__|__|__|__|__|  <- Meshlet 0
+//  |  |  |  |  |  |
+//  |__|__|__|__|__|
+//  |  |  |  |  |  |  <- Meshlet 1
+//  |__|__|__|__|__|
+//
+struct CubeFaceLayout
+{
+    Uint32 NumSubdivisions = 0;
+    Uint32 BandWidth       = 0;
+    Uint32 NumBands        = 0;
+    Uint32 MeshletRows     = 0; // Zero if meshlets are not generated
+    Uint32 BandMeshlets    = 0;
+
+    Uint32 NumFaceTriangles = 0;
+    Uint32 NumFaceMeshlets  = 0;
+
+    // Vertices stored for each face. When the edges are shared, a vertex that lies on
+    // several faces is only stored by the face with the smallest index.
+    struct FaceVertexRange
+    {
+        Uint32 FirstVertex = 0;
+        Uint32 x0          = 0; // First stored column
+        Uint32 y0          = 0; // First stored row
+        Uint32 NumCols     = 0;
+        Uint32 NumRows     = 0;
+
+        bool Contains(Uint32 x, Uint32 y) const
+        {
+            return x >= x0 && x - x0 < NumCols && y >= y0 && y - y0 < NumRows;
+        }
+    };
+    std::array<FaceVertexRange, NumCubeFaces> FaceVertices;
+
+    Uint32 NumVertices = 0;
+
+    // Whether the vertices on the cube edges are shared by the adjacent faces
+    const bool SharedEdges;
+
+    CubeFaceLayout(Uint32 _NumSubdivisions, const GeometryPrimitiveStreamAttribs& StreamAttribs, bool _SharedEdges) :
+        NumSubdivisions{_NumSubdivisions},
+        SharedEdges{_SharedEdges}
+    {
+        const Uint32 N = NumSubdivisions;
+
+        BandWidth = N;
+        if (StreamAttribs.IndexOrder == GEOMETRY_PRIMITIVE_INDEX_ORDER_VERTEX_CACHE)
+        {
+            // The first row of a band loads 2 * (BandWidth + 1) vertices that must all
+            // remain in the cache until they are reused by the next row.
+            BandWidth = std::max(StreamAttribs.VertexCacheSize / 2, 2u) - 1;
+            if (StreamAttribs.MaxMeshletVertices >= 4 && StreamAttribs.MaxMeshletTriangles >= 2)
+            {
+                // Make sure that at least one row of the band fits into a meshlet
+                BandWidth = std::min(BandWidth, StreamAttribs.MaxMeshletVertices / 2 - 1);
+                BandWidth = std::min(BandWidth, StreamAttribs.MaxMeshletTriangles / 2);
+            }
+            BandWidth = std::min(BandWidth, N);
+        }
+        NumBands = (N + BandWidth - 1) / BandWidth;
+
+        if (StreamAttribs.MaxMeshletVertices > 0)
+        {
+            const Uint32 MaxRowsByVerts = StreamAttribs.MaxMeshletVertices / (BandWidth + 1);
+            const Uint32 MaxRowsByTris  = StreamAttribs.MaxMeshletTriangles / (BandWidth * 2);
+            MeshletRows                 = std::min(MaxRowsByVerts > 0 ? MaxRowsByVerts - 1 : 0, MaxRowsByTris);
+            MeshletRows                 = std::min(MeshletRows, N);
+            if (MeshletRows > 0)
+                BandMeshlets = (N + MeshletRows - 1) / MeshletRows;
+        }
+
+        NumFaceTriangles = N * N * 2;
+        NumFaceMeshlets  = NumBands * BandMeshlets;
+
+        for (Uint32 Face = 0; Face < NumCubeFaces; ++Face)
+        {
+            Uint32 x0 = 0, x1 = N;
+            Uint32 y0 = 0, y1 = N;
+            if (SharedEdges)
+            {
+                // Skip the edges that are shared with faces that have smaller indices
+                if (GetAdjacentFace(Face, 0, 0, 0, N) < Face) x0 = 1;
+                if (GetAdjacentFace(Face, N, 0, N, N) < Face) x1 = N - 1;
+                if (GetAdjacentFace(Face, 0, 0, N, 0) < Face) y0 = 1;
+                if (GetAdjacentFace(Face, 0, N, N, N) < Face) y1 = N - 1;
+            }
+
+            FaceVertexRange& Range{FaceVertices[Face]};
+            Range.FirstVertex = NumVertices;
+            Range.x0          = x0;
+            Range.y0          = y0;
+            Range.NumCols     = x1 + 1 - x0;
+            Range.NumRows     = y1 + 1 - y0;
+            NumVertices += Range.NumCols * Range.NumRows;
+        }
+        VERIFY_EXPR(NumVertices == (SharedEdges ? 6 * N * N + 2 : 6 * (N + 1) * (N + 1)));
+    }
+
+    Uint32 GetBandWidth(Uint32 Band) const
+    {
+        return std::min(BandWidth, NumSubdivisions - Band * BandWidth);
+    }
+
+    // Returns the index of the vertex (x, y) of the face
+    Uint32 GetVertexIndex(Uint32 Face, Uint32 x, Uint32 y) const
+    {
+        if (SharedEdges && !FaceVertices[Face].Contains(x, y))
+        {
+            // The vertex is stored by another face
+            const uint3 L = GetLatticePos(Face, x, y);
+            Face          = GetFirstFace(GetLatticeFaces(L));
+            GetFaceXY(Face, L, x, y);
+        }
+
+        const FaceVertexRange& Range{FaceVertices[Face]};
+        VERIFY_EXPR(Range.Contains(x, y));
+        return Range.FirstVertex + (y - Range.y0) * Range.NumCols + (x - Range.x0);
+    }
+
+    // Returns the face and the face coordinates of the vertex
+    void GetFaceVertex(Uint32 Vertex, Uint32& Face, Uint32& x, Uint32& y) const
+    {
+        Face = 0;
+        while (Face + 1 < NumCubeFaces && Vertex >= FaceVertices[Face + 1].FirstVertex)
+            ++Face;
+
+        const FaceVertexRange& Range{FaceVertices[Face]};
+        Vertex -= Range.FirstVertex;
+        x = Range.x0 + Vertex % Range.NumCols;
+        y = Range.y0 + Vertex / Range.NumCols;
+    }
+
+private:
+    // Returns the integer coordinates of the face vertex on the cube lattice.
+    // Coordinates are in the range [0, N] and match the vertex positions computed by ComputeCubeVertex.
+    uint3 GetLatticePos(Uint32 Face, Uint32 x, Uint32 y) const
+    {
+        const Uint32 N = NumSubdivisions;
+        switch (Face)
+        {
+            case 0: return uint3{N, N - y, x};
+            case 1: return uint3{0, N - y, N - x};
+            case 2: return uint3{x, N, N - y};
+            case 3: return uint3{x, 0, y};
+            case 4: return uint3{N - x, N - y, N};
+            case 5: return uint3{x, N - y, 0};
+            default:
+                UNEXPECTED("Invalid face index");
+                return uint3{};
+        }
+    }
+
+    // Inverse of GetLatticePos
+    void GetFaceXY(Uint32 Face, const uint3& L, Uint32& x, Uint32& y) const
+    {
+        const Uint32 N = NumSubdivisions;
+        switch (Face)
+        {
+            case 0: x = L.z, y = N - L.y; break;
+            case 1: x = N - L.z, y = N - L.y; break;
+            case 2: x = L.x, y = N - L.z; break;
+            case 3: x = L.x, y = L.z; break;
+            case 4: x = N - L.x, y = N - L.y; break;
+            case 5: x = L.x, y = N - L.y; break;
+            default:
+                UNEXPECTED("Invalid face index");
+        }
+    }
+
+    // Returns the bit mask of the faces the lattice point lies on
+    Uint32 GetLatticeFaces(const uint3& L) const
+    {
+        const Uint32 N = NumSubdivisions;
+        return (L.x == N ? 1u << 0 : 0u) |
+            (L.x == 0 ? 1u << 1 : 0u) |
+            (L.y == N ? 1u << 2 : 0u) |
+            (L.y == 0 ? 1u << 3 : 0u) |
+            (L.z == N ? 1u << 4 : 0u) |
+            (L.z == 0 ? 1u << 5 : 0u);
+    }
+
+    static Uint32 GetFirstFace(Uint32 FaceMask)
+    {
+        VERIFY_EXPR(FaceMask != 0);
+        Uint32 Face = 0;
+        while ((FaceMask & (1u << Face)) == 0)
+            ++Face;
+        return Face;
+    }
+
+    // Returns the face that shares the edge (x0, y0) - (x1, y1) with the given face
+    Uint32 GetAdjacentFace(Uint32 Face, Uint32 x0, Uint32 y0, Uint32 x1, Uint32 y1) const
+    {
+        const Uint32 FaceMask = GetLatticeFaces(GetLatticePos(Face, x0, y0)) & GetLatticeFaces(GetLatticePos(Face, x1, y1)) & ~(1u << Face);
+        return GetFirstFace(FaceMask);
+    }
+};
+
+// Iterates over the triangles in the order defined by the cube face layout.
+class CubeTriangleCursor
+{
+public:
+    CubeTriangleCursor(const CubeFaceLayout& Layout, Uint32 Triangle) :
+        m_Layout{Layout}
+    {
+        const Uint32 N = m_Layout.NumSubdivisions;
+
+        m_Face = Triangle / m_Layout.NumFaceTriangles;
+        Triangle %= m_Layout.NumFaceTriangles;
+
+        // All bands but the last one have the same width
+        m_Band = Triangle / (m_Layout.BandWidth * N * 2);
+        Triangle -= m_Band * m_Layout.BandWidth * N * 2;
+        m_Width = m_Layout.GetBandWidth(m_Band);
+
+        m_y = Triangle / (m_Width * 2);
+        Triangle %= m_Width * 2;
+        m_x   = Triangle / 2;
+        m_Tri = Triangle % 2;
+    }
+
+    void GetIndices(Uint32& i0, Uint32& i1, Uint32& i2) const
+    {
+        //  01     11
+        //   *-----*
+        //   |   .'|
+        //   | .'  |
+        //   *'----*
+        //  00     10
+        const Uint32 x   = m_Band * m_Layout.BandWidth + m_x;
+        const Uint32 v00 = m_Layout.GetVertexIndex(m_Face, x, m_y);
+        const Uint32 v10 = m_Layout.GetVertexIndex(m_Face, x + 1, m_y);
+        const Uint32 v01 = m_Layout.GetVertexIndex(m_Face, x, m_y + 1);
+        const Uint32 v11 = m_Layout.GetVertexIndex(m_Face, x + 1, m_y + 1);
+        if (m_Tri == 0)
+        {
+            i0 = v00;
+            i1 = v10;
+            i2 = v11;
+        }
+        else
+        {
+            i0 = v00;
+            i1 = v11;
+            i2 = v01;
+        }
+    }
+
+    void operator++()
+    {
+        if (++m_Tri < 2)
+            return;
+        m_Tri = 0;
+
+        if (++m_x < m_Width)
+            return;
+        m_x = 0;
+
+        if (++m_y < m_Layout.NumSubdivisions)
+            return;
+        m_y = 0;
+
+        if (++m_Band < m_Layout.NumBands)
+        {
+            m_Width = m_Layout.GetBandWidth(m_Band);
+            return;
+        }
+        m_Band  = 0;
+        m_Width = m_Layout.GetBandWidth(0);
+
+        ++m_Face;
+    }
+
+private:
+    const CubeFaceLayout& m_Layout;
+
+    Uint32 m_Face  = 0;
+    Uint32 m_Band  = 0;
+    Uint32 m_Width = 0;
+    Uint32 m_x     = 0;
+    Uint32 m_y     = 0;
+    Uint32 m_Tri   = 0;
+};
+
 template <typename VertexHandlerType>
-void CreateCubeGeometryInternal(Uint32                          NumSubdivisions,
-                                GEOMETRY_PRIMITIVE_VERTEX_FLAGS VertexFlags,
-                                IDataBlob**                     ppVertices,
-                                IDataBlob**                     ppIndices,
-                                GeometryPrimitiveInfo*          pInfo,
-                                VertexHandlerType&&             HandleVertex)
+void ComputeCubeVertex(const CubeFaceLayout& Layout,
+                       Uint32                FaceIndex,
+                       Uint32                x,
+                       Uint32                y,
+                       float3&               Pos,
+                       float3&               Normal,
+                       float2&               UV,
+                       VertexHandlerType&&   HandleVertex)
+{
+    static constexpr std::array<float3, NumCubeFaces> FaceNormals{
+        float3{+1, 0, 0},
+        float3{-1, 0, 0},
+        float3{0, +1, 0},
+        float3{0, -1, 0},
+        float3{0, 0, +1},
+        float3{0, 0, -1},
+    };
+
+    // 6 ______7______ 8
+    //  |    .'|    .'|
+    //  |  .'  |  .'  |
+    //  |.'____|.'____|
+    // 3|    .'|4   .'|5
+    //  |  .'  |  .'  |
+    //  |.'____|.'____|
+    // 0       1      2
+
+    const Uint32 N = Layout.NumSubdivisions;
+
+    UV = float2{
+        static_cast<float>(x) / N,
+        static_cast<float>(y) / N,
+    };
+
+    float2 XY{
+        UV.x - 0.5f,
+        0.5f - UV.y,
+    };
+
+    switch (FaceIndex)
+    {
+        case 0: Pos = float3{+0.5f, XY.y, +XY.x}; break;
+        case 1: Pos = float3{-0.5f, XY.y, -XY.x}; break;
+        case 2: Pos = float3{XY.x, +0.5f, +XY.y}; break;
+        case 3: Pos = float3{XY.x, -0.5f, -XY.y}; break;
+        case 4: Pos = float3{-XY.x, XY.y, +0.5f}; break;
+        case 5: Pos = float3{+XY.x, XY.y, -0.5f}; break;
+    }
+
+    Normal = FaceNormals[FaceIndex];
+    HandleVertex(Pos, Normal, UV);
+}
+
+// Generates a subdivided cube. If SharedEdges is true, the vertices on the cube edges
+// are shared by the adjacent faces, which is only correct if the vertex handler computes
+// the same attributes for them (e.g. for the sphere).
+template <typename VertexHandlerType>
+void WriteCubeGeometryInternal(Uint32                                NumSubdivisions,
+                               bool                                  SharedEdges,
+                               GEOMETRY_PRIMITIVE_VERTEX_FLAGS       VertexFlags,
+                               const GeometryPrimitiveStreamAttribs& StreamAttribs,
+                               GeometryPrimitiveInfo*                pInfo,
+                               VertexHandlerType&&                   HandleVertex)
 {
     if (NumSubdivisions == 0)
     {
@@ -69,166 +428,241 @@ void CreateCubeGeometryInternal(Uint32                          NumSubdivisions,
     //  |  .'  |  .'  |
     //  |.'____|.'____|
     //
-    const Uint32 NumFaceVertices  = (NumSubdivisions + 1) * (NumSubdivisions + 1);
-    const Uint32 NumFaceTriangles = NumSubdivisions * NumSubdivisions * 2;
-    const Uint32 NumFaceIndices   = NumFaceTriangles * 3;
-    const Uint32 VertexSize       = GetGeometryPrimitiveVertexSize(VertexFlags);
-    const Uint32 NumFaces         = 6;
-    const Uint32 VertexDataSize   = NumFaceVertices * NumFaces * VertexSize;
-    const Uint32 IndexDataSize    = NumFaceIndices * NumFaces * sizeof(Uint32);
+    const CubeFaceLayout Layout{NumSubdivisions, StreamAttribs, SharedEdges};
+
+    const Uint32 VertexSize   = GetGeometryPrimitiveVertexSize(VertexFlags);
+    const Uint32 NumVertices  = Layout.NumVertices;
+    const Uint32 NumTriangles = Layout.NumFaceTriangles * NumCubeFaces;
+    const Uint32 NumMeshlets  = Layout.NumFaceMeshlets * NumCubeFaces;
 
     if (pInfo != nullptr)
     {
-        pInfo->NumVertices = NumFaceVertices * NumFaces;
-        pInfo->NumIndices  = NumFaceIndices * NumFaces;
+        pInfo->NumVertices = NumVertices;
+        pInfo->NumIndices  = NumTriangles * 3;
         pInfo->VertexSize  = VertexSize;
+        pInfo->NumMeshlets = NumMeshlets;
     }
 
-    RefCntAutoPtr<DataBlobImpl> pVertexData;
-    Uint8*                      pVert = nullptr;
-    if (ppVertices != nullptr && VertexFlags != GEOMETRY_PRIMITIVE_VERTEX_FLAG_NONE)
+    if (StreamAttribs.pVertexData != nullptr && StreamAttribs.NumVertices > 0 && VertexFlags != GEOMETRY_PRIMITIVE_VERTEX_FLAG_NONE)
     {
-        pVertexData = DataBlobImpl::Create(VertexDataSize);
-        DEV_CHECK_ERR(*ppVertices == nullptr, "*ppVertices is not null, which may cause memory leak");
-        pVertexData->QueryInterface(IID_DataBlob, ppVertices);
-        pVert = pVertexData->GetDataPtr<Uint8>();
+        if (StreamAttribs.FirstVertex + StreamAttribs.NumVertices > NumVertices)
+        {
+            UNEXPECTED("Vertex range [", StreamAttribs.FirstVertex, ", ", StreamAttribs.FirstVertex + StreamAttribs.NumVertices,
+                       ") is out of bounds: the primitive only has ", NumVertices, " vertices");
+            return;
+        }
+
+        Uint8* pVert = static_cast<Uint8*>(StreamAttribs.pVertexData);
+        for (Uint32 v = StreamAttribs.FirstVertex; v < StreamAttribs.FirstVertex + StreamAttribs.NumVertices; ++v)
+        {
+            Uint32 Face, x, y;
+            Layout.GetFaceVertex(v, Face, x, y);
+
+            float3 Pos;
+            float3 Normal;
+            float2 UV;
+            ComputeCubeVertex(Layout, Face, x, y, Pos, Normal, UV, HandleVertex);
+
+            if (VertexFlags & GEOMETRY_PRIMITIVE_VERTEX_FLAG_POSITION)
+            {
+                memcpy(pVert, &Pos, sizeof(Pos));
+                pVert += sizeof(Pos);
+            }
+
+            if (VertexFlags & GEOMETRY_PRIMITIVE_VERTEX_FLAG_NORMAL)
+            {
+                memcpy(pVert, &Normal, sizeof(Normal));
+                pVert += sizeof(Normal);
+            }
+
+            if (VertexFlags & GEOMETRY_PRIMITIVE_VERTEX_FLAG_TEXCOORD)
+            {
+                memcpy(pVert, &UV, sizeof(UV));
+                pVert += sizeof(UV);
+            }
+        }
+        VERIFY_EXPR(pVert == static_cast<Uint8*>(StreamAttribs.pVertexData) + size_t{StreamAttribs.NumVertices} * VertexSize);
     }
 
-    RefCntAutoPtr<DataBlobImpl> pIndexData;
-    Uint32*                     pIdx = nullptr;
-    if (ppIndices != nullptr)
+    if (StreamAttribs.pIndexData != nullptr && StreamAttribs.NumIndices > 0)
     {
-        pIndexData = DataBlobImpl::Create(IndexDataSize);
-        DEV_CHECK_ERR(*ppIndices == nullptr, "*ppIndices is not null, which may cause memory leak");
-        pIndexData->QueryInterface(IID_DataBlob, ppIndices);
-        pIdx = pIndexData->GetDataPtr<Uint32>();
-    }
+        DEV_CHECK_ERR(StreamAttribs.FirstIndex % 3 == 0, "FirstIndex (", StreamAttribs.FirstIndex, ") must be a multiple of 3");
+        DEV_CHECK_ERR(StreamAttribs.NumIndices % 3 == 0, "NumIndices (", StreamAttribs.NumIndices, ") must be a multiple of 3");
 
-    static constexpr std::array<float3, NumFaces> FaceNormals{
-        float3{+1, 0, 0},
-        float3{-1, 0, 0},
-        float3{0, +1, 0},
-        float3{0, -1, 0},
-        float3{0, 0, +1},
-        float3{0, 0, -1},
-    };
+        const Uint32 FirstTriangle = StreamAttribs.FirstIndex / 3;
+        const Uint32 EndTriangle   = FirstTriangle + StreamAttribs.NumIndices / 3;
+        if (EndTriangle > NumTriangles)
+        {
+            UNEXPECTED("Index range [", StreamAttribs.FirstIndex, ", ", StreamAttribs.FirstIndex + StreamAttribs.NumIndices,
+                       ") is out of bounds: the primitive only has ", NumTriangles * 3, " indices");
+            return;
+        }
 
-    for (Uint32 FaceIndex = 0; FaceIndex < NumFaces; ++FaceIndex)
+        Uint32* pIdx = StreamAttribs.pIndexData;
+
+        CubeTriangleCursor Cursor{Layout, FirstTriangle};
+        for (Uint32 t = FirstTriangle; t < EndTriangle; ++t, ++Cursor)
+        {
+            Uint32 i0, i1, i2;
+            Cursor.GetIndices(i0, i1, i2);
+            *pIdx++ = StreamAttribs.BaseVertex + i0;
+            *pIdx++ = StreamAttribs.BaseVertex + i1;
+            *pIdx++ = StreamAttribs.BaseVertex + i2;
+        }
+    }
+
+    if (StreamAttribs.pMeshlets != nullptr && StreamAttribs.NumMeshlets > 0)
     {
-        if (pVert != nullptr)
+        if (StreamAttribs.FirstMeshlet + StreamAttribs.NumMeshlets > NumMeshlets)
+        {
+            UNEXPECTED("Meshlet range [", StreamAttribs.FirstMeshlet, ", ", StreamAttribs.FirstMeshlet + StreamAttribs.NumMeshlets,
+                       ") is out of bounds: the primitive only has ", NumMeshlets, " meshlets");
+            return;
+        }
+
+        const Uint32 N = Layout.NumSubdivisions;
+        for (Uint32 m = StreamAttribs.FirstMeshlet; m < StreamAttribs.FirstMeshlet + StreamAttribs.NumMeshlets; ++m)
         {
-            // 6 ______7______ 8
-            //  |    .'|    .'|
-            //  |  .'  |  .'  |
-            //  |.'____|.'____|
-            // 3|    .'|4   .'|5
-            //  |  .'  |  .'  |
-            //  |.'____|.'____|
-            // 0       1      2
-
-            for (Uint32 y = 0; y <= NumSubdivisions; ++y)
+            const Uint32 Face      = m / Layout.NumFaceMeshlets;
+            const Uint32 Band      = (m % Layout.NumFaceMeshlets) / Layout.BandMeshlets;
+            const Uint32 FirstRow  = (m % Layout.BandMeshlets) * Layout.MeshletRows;
+            const Uint32 NumRows   = std::min(Layout.MeshletRows, N - FirstRow);
+            const Uint32 Width     = Layout.GetBandWidth(Band);
+            const Uint32 FirstQuad = Band * Layout.BandWidth;
+
+            const Uint32 FirstTriangle = Face * Layout.NumFaceTriangles + Band * Layout.BandWidth * N * 2 + FirstRow * Width * 2;
+
+            GeometryPrimitiveMeshlet& Meshlet = StreamAttribs.pMeshlets[m - StreamAttribs.FirstMeshlet];
+
+            Meshlet.FirstIndex  = FirstTriangle * 3;
+            Meshlet.NumIndices  = NumRows * Width * 2 * 3;
+            Meshlet.NumVertices = (NumRows + 1) * (Width + 1);
+
+            float3 MinPos{+FLT_MAX};
+            float3 MaxPos{-FLT_MAX};
+            for (Uint32 y = FirstRow; y <= FirstRow + NumRows; ++y)
             {
-                for (Uint32 x = 0; x <= NumSubdivisions; ++x)
+                for (Uint32 x = FirstQuad; x <= FirstQuad + Width; ++x)
                 {
-                    float2 UV{
-                        static_cast<float>(x) / NumSubdivisions,
-                        static_cast<float>(y) / NumSubdivisions,
-                    };
-
-                    float2 XY{
-                        UV.x - 0.5f,
-                        0.5f - UV.y,
-                    };
-
-                    float3 Pos;
-                    switch (FaceIndex)
-                    {
-                        case 0: Pos = float3{+0.5f, XY.y, +XY.x}; break;
-                        case 1: Pos = float3{-0.5f, XY.y, -XY.x}; break;
-                        case 2: Pos = float3{XY.x, +0.5f, +XY.y}; break;
-                        case 3: Pos = float3{XY.x, -0.5f, -XY.y}; break;
-                        case 4: Pos = float3{-XY.x, XY.y, +0.5f}; break;
-                        case 5: Pos = float3{+XY.x, XY.y, -0.5f}; break;
-                    }
-
-                    float3 Normal = FaceNormals[FaceIndex];
-                    HandleVertex(Pos, Normal, UV);
-
-                    if (VertexFlags & GEOMETRY_PRIMITIVE_VERTEX_FLAG_POSITION)
-                    {
-                        memcpy(pVert, &Pos, sizeof(Pos));
-                        pVert += sizeof(Pos);
-                    }
-
-                    if (VertexFlags & GEOMETRY_PRIMITIVE_VERTEX_FLAG_NORMAL)
-                    {
-                        memcpy(pVert, &Normal, sizeof(Normal));
-                        pVert += sizeof(Normal);
-                    }
-
-                    if (VertexFlags & GEOMETRY_PRIMITIVE_VERTEX_FLAG_TEXCOORD)
-                    {
-                        memcpy(pVert, &UV, sizeof(UV));
-                        pVert += sizeof(UV);
-                    }
+                    float3 Pos, Normal;
+                    float2 UV;
+                    ComputeCubeVertex(Layout, Face, x, y, Pos, Normal, UV, HandleVertex);
+                    MinPos = min(MinPos, Pos);
+                    MaxPos = max(MaxPos, Pos);
                 }
             }
-        }
 
-        if (pIdx != nullptr)
-        {
-            Uint32 FaceBaseVertex = FaceIndex * NumFaceVertices;
-            for (Uint32 y = 0; y < NumSubdivisions; ++y)
+            const float3 Center = (MinPos + MaxPos) * 0.5f;
+
+            float Radius = 0;
+            for (Uint32 y = FirstRow; y <= FirstRow + NumRows; ++y)
             {
-                for (Uint32 x = 0; x < NumSubdivisions; ++x)
+                for (Uint32 x = FirstQuad; x <= FirstQuad + Width; ++x)
                 {
-                    //  01     11
-                    //   *-----*
-                    //   |   .'|
-                    //   | .'  |
-                    //   *'----*
-                    //  00     10
-                    Uint32 v00 = FaceBaseVertex + y * (NumSubdivisions + 1) + x;
-                    Uint32 v10 = v00 + 1;
-                    Uint32 v01 = v00 + NumSubdivisions + 1;
-                    Uint32 v11 = v01 + 1;
-
-                    *pIdx++ = v00;
-                    *pIdx++ = v10;
-                    *pIdx++ = v11;
-
-                    *pIdx++ = v00;
-                    *pIdx++ = v11;
-                    *pIdx++ = v01;
+                    float3 Pos, Normal;
+                    float2 UV;
+                    ComputeCubeVertex(Layout, Face, x, y, Pos, Normal, UV, HandleVertex);
+                    Radius = std::max(Radius, length(Pos - Center));
                 }
             }
+
+            Meshlet.BoundSphereCenter[0] = Center.x;
+            Meshlet.BoundSphereCenter[1] = Center.y;
+            Meshlet.BoundSphereCenter[2] = Center.z;
+            Meshlet.BoundSphereRadius    = Radius;
         }
     }
+}
+
+template <typename VertexHandlerType>
+void CreateCubeGeometryInternal(Uint32                          NumSubdivisions,
+                                bool                            SharedEdges,
+                                GEOMETRY_PRIMITIVE_VERTEX_FLAGS VertexFlags,
+                                IDataBlob**                     ppVertices,
+                                IDataBlob**                     ppIndices,
+                                GeometryPrimitiveInfo*          pInfo,
+                                VertexHandlerType&&             HandleVertex)
+{
+    GeometryPrimitiveStreamAttribs StreamAttribs;
+    StreamAttribs.IndexOrder         = GEOMETRY_PRIMITIVE_INDEX_ORDER_LINEAR;
+    StreamAttribs.MaxMeshletVertices = 0;
+
+    GeometryPrimitiveInfo Info;
+    WriteCubeGeometryInternal(NumSubdivisions, SharedEdges, VertexFlags, StreamAttribs, &Info, HandleVertex);
+    if (Info.NumVertices == 0)
+        return;
+
+    if (pInfo != nullptr)
+    {
+        *pInfo = Info;
+    }
+
+    RefCntAutoPtr<DataBlobImpl> pVertexData;
+    if (ppVertices != nullptr && VertexFlags != GEOMETRY_PRIMITIVE_VERTEX_FLAG_NONE)
+    {
+        pVertexData = DataBlobImpl::Create(size_t{Info.NumVertices} * Info.VertexSize);
+        DEV_CHECK_ERR(*ppVertices == nullptr, "*ppVertices is not null, which may cause memory leak");
+        pVertexData->QueryInterface(IID_DataBlob, ppVertices);
+
+        StreamAttribs.pVertexData = pVertexData->GetDataPtr();
+        StreamAttribs.NumVertices = Info.NumVertices;
+    }
+
+    RefCntAutoPtr<DataBlobImpl> pIndexData;
+    if (ppIndices != nullptr)
+    {
+        pIndexData = DataBlobImpl::Create(size_t{Info.NumIndices} * sizeof(Uint32));
+        DEV_CHECK_ERR(*ppIndices == nullptr, "*ppIndices is not null, which may cause memory leak");
+        pIndexData->QueryInterface(IID_DataBlob, ppIndices);
+
+        StreamAttribs.pIndexData = pIndexData->GetDataPtr<Uint32>();
+        StreamAttribs.NumIndices = Info.NumIndices;
+    }
 
-    VERIFY_EXPR(pVert == nullptr || pVert == pVertexData->GetConstDataPtr<Uint8>() + VertexDataSize);
-    VERIFY_EXPR(pIdx == nullptr || pIdx == pIndexData->GetConstDataPtr<Uint32>() + IndexDataSize / sizeof(Uint32));
+    WriteCubeGeometryInternal(NumSubdivisions, SharedEdges, VertexFlags, StreamAttribs, nullptr, HandleVertex);
 }
 
+auto GetCubeVertexHandler(const CubeGeometryPrimitiveAttributes& Attribs)
+{
+    const float Size = Attribs.Size;
+    return [Size](float3& Pos, float3& Normal, float2& UV) {
+        Pos *= Size;
+    };
+}
+
+auto GetSphereVertexHandler(const SphereGeometryPrimitiveAttributes& Attribs)
+{
+    const float Radius = Attribs.Radius;
+    return [Radius](float3& Pos, float3& Normal, float2& UV) {
+        Normal = normalize(Pos);
+        Pos    = Normal * Radius;
+
+        UV.x = 0.5f + atan2(Normal.z, Normal.x) / (2 * PI_F);
+        UV.y = 0.5f - asin(Normal.y) / PI_F;
+    };
+}
+
+} // namespace
+
 void CreateCubeGeometry(const CubeGeometryPrimitiveAttributes& Attribs,
                         IDataBlob**                            ppVertices,
                         IDataBlob**                            ppIndices,
                         GeometryPrimitiveInfo*                 pInfo)
 {
-    const float Size = Attribs.Size;
-    if (Size <= 0)
+    if (Attribs.Size <= 0)
     {
         UNEXPECTED("Size must be positive");
         return;
     }
 
+    // Faces of the cube have different normals, so the edge vertices are not shared
     CreateCubeGeometryInternal(Attribs.NumSubdivisions,
+                               /*SharedEdges = */ false,
                                Attribs.VertexFlags,
                                ppVertices,
                                ppIndices,
                                pInfo,
-                               [&](float3& Pos, float3& Normal, float2& UV) {
-                                   Pos *= Size;
-                               });
+                               GetCubeVertexHandler(Attribs));
 }
 
 void CreateSphereGeometry(const SphereGeometryPrimitiveAttributes& Attribs,
@@ -236,25 +670,20 @@ void CreateSphereGeometry(const SphereGeometryPrimitiveAttributes& Attribs,
                           IDataBlob**                              ppIndices,
                           GeometryPrimitiveInfo*                   pInfo)
 {
-    const float Radius = Attribs.Radius;
-    if (Radius <= 0)
+    if (Attribs.Radius <= 0)
     {
         UNEXPECTED("Radius must be positive");
         return;
     }
 
+    // All sphere vertex attributes are computed from the position, so the edge vertices are shared
     CreateCubeGeometryInternal(Attribs.NumSubdivisions,
+                               /*SharedEdges = */ true,
                                Attribs.VertexFlags,
                                ppVertices,
                                ppIndices,
                                pInfo,
-                               [&](float3& Pos, float3& Normal, float2& UV) {
-                                   Normal = normalize(Pos);
-                                   Pos    = Normal * Radius;
-
-                                   UV.x = 0.5f + atan2(Normal.z, Normal.x) / (2 * PI_F);
-                                   UV.y = 0.5f - asin(Normal.y) / PI_F;
-                               });
+                               GetSphereVertexHandler(Attribs));
 }
 
 void CreateGeometryPrimitive(const GeometryPrimitiveAttributes& Attribs,
@@ -285,6 +714,48 @@ void CreateGeometryPrimitive(const GeometryPrimitiveAttributes& Attribs,
     }
 }
 
+void WriteGeometryPrimitive(const GeometryPrimitiveAttributes&    Attribs,
+                            const GeometryPrimitiveStreamAttribs& StreamAttribs,
+                            GeometryPrimitiveInfo*                pInfo)
+{
+    DEV_CHECK_ERR(StreamAttribs.IndexOrder < GEOMETRY_PRIMITIVE_INDEX_ORDER_COUNT, "Invalid index order");
+
+    static_assert(GEOMETRY_PRIMITIVE_TYPE_COUNT == 3, "Please update the switch below to handle the new geometry primitive type");
+    switch (Attribs.Type)
+    {
+        case GEOMETRY_PRIMITIVE_TYPE_UNDEFINED:
+            UNEXPECTED("Undefined geometry primitive type");
+            break;
+
+        case GEOMETRY_PRIMITIVE_TYPE_CUBE:
+        {
+            const CubeGeometryPrimitiveAttributes& CubeAttribs = static_cast<const CubeGeometryPrimitiveAttributes&>(Attribs);
+            if (CubeAttribs.Size <= 0)
+            {
+                UNEXPECTED("Size must be positive");
+                return;
+            }
+            WriteCubeGeometryInternal(Attribs.NumSubdivisions, /*SharedEdges = */ false, Attribs.VertexFlags, StreamAttribs, pInfo, GetCubeVertexHandler(CubeAttribs));
+            break;
+        }
+
+        case GEOMETRY_PRIMITIVE_TYPE_SPHERE:
+        {
+            const SphereGeometryPrimitiveAttributes& SphereAttribs = static_cast<const SphereGeometryPrimitiveAttributes&>(Attribs);
+            if (SphereAttribs.Radius <= 0)
+            {
+                UNEXPECTED("Radius must be positive");
+                return;
+            }
+            WriteCubeGeometryInternal(Attribs.NumSubdivisions, /*SharedEdges = */ true, Attribs.VertexFlags, StreamAttribs, pInfo, GetSphereVertexHandler(SphereAttribs));
+            break;
+        }
+
+        default:
+            UNEXPECTED("Unknown geometry primitive type");
+    }
+}
+
 } // namespace Diligent
 
 extern "C"
@@ -301,4 +772,11 @@ extern "C"
     {
         Diligent::CreateGeometryPrimitive(Attribs, ppVertices, ppIndices, pInfo);
     }
+
+    void Diligent_WriteGeometryPrimitive(const Diligent::GeometryPrimitiveAttributes&    Attribs,
+                                         const Diligent::GeometryPrimitiveStreamAttribs& StreamAttribs,
+                                         Diligent::GeometryPrimitiveInfo*                pInfo)
+    {
+        Diligent::WriteGeometryPrimitive(Attribs, StreamAttribs, pInfo);
+    }
 }
@@ -27,13 +27,404 @@
 #include "ImageTools.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cmath>
+#include <vector>
 
+#include "Intrinsics.hpp"
 #include "DebugUtilities.hpp"
+#include "ThreadPool.hpp"
+#include "X86Features.hpp"
+
+#if DILIGENT_SSE_SUPPORTED && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#    include <emmintrin.h>
+#    define DILIGENT_IMAGE_DIFF_SSE2 1
+#endif
 
 namespace Diligent
 {
 
+namespace
+{
+
+// Image difference statistics. Unlike floating-point sums, integer sums can be
+// accumulated per tile and combined in any order without losing precision.
+struct ImageDiffStats
+{
+    Uint64 NumDiffPixels               = 0;
+    Uint64 NumDiffPixelsAboveThreshold = 0;
+    Uint64 SumDiff                     = 0;
+    Uint64 SumDiffSq                   = 0;
+    Uint32 MaxDiff                     = 0;
+
+    void AddPixel(Uint32 PixelDiff, Uint32 Threshold)
+    {
+        if (PixelDiff == 0)
+            return;
+
+        ++NumDiffPixels;
+        SumDiff += PixelDiff;
+        SumDiffSq += Uint64{PixelDiff} * PixelDiff;
+        MaxDiff = std::max(MaxDiff, PixelDiff);
+        if (PixelDiff > Threshold)
+            ++NumDiffPixelsAboveThreshold;
+    }
+
+    ImageDiffStats& operator+=(const ImageDiffStats& rhs)
+    {
+        NumDiffPixels += rhs.NumDiffPixels;
+        NumDiffPixelsAboveThreshold += rhs.NumDiffPixelsAboveThreshold;
+        SumDiff += rhs.SumDiff;
+        SumDiffSq += rhs.SumDiffSq;
+        MaxDiff = std::max(MaxDiff, rhs.MaxDiff);
+        return *this;
+    }
+};
+
+// Selects the first byte of every pixel in a 16-byte block of 3- or 4-channel pixels.
+// A block contains 5 RGB pixels (the last byte belongs to the next block) or 4 RGBA pixels.
+alignas(16) constexpr Uint8 PixelMask3[16] = {0xFF, 0, 0, 0xFF, 0, 0, 0xFF, 0, 0, 0xFF, 0, 0, 0xFF, 0, 0, 0};
+alignas(16) constexpr Uint8 PixelMask4[16] = {0xFF, 0, 0, 0, 0xFF, 0, 0, 0, 0xFF, 0, 0, 0, 0xFF, 0, 0, 0};
+
+template <Uint32 NumChannels>
+struct PixelBlock
+{
+    static_assert(NumChannels == 3 || NumChannels == 4, "Only 3- and 4-channel pixels are supported");
+
+    static constexpr Uint32 NumPixels = 16 / NumChannels;
+    static constexpr Uint32 Size      = NumPixels * NumChannels;
+
+    // Every block adds at most 2 * 255^2 to each 32-bit lane of the sum of squares.
+    // Flushing the lanes to 64-bit sums after this many blocks keeps them from overflowing.
+    static constexpr Uint32 MaxBlocksPerBatch = 8192;
+
+    static const Uint8* GetPixelMask() { return NumChannels == 3 ? PixelMask3 : PixelMask4; }
+
+    // Returns the number of 16-byte blocks in a row that can be loaded without reading past the row end
+    static Uint32 GetNumBlocks(Uint32 Width)
+    {
+        const Uint32 RowSize = Width * NumChannels;
+        return RowSize >= 16 ? (RowSize - 16) / Size + 1 : 0;
+    }
+};
+
+#if DILIGENT_IMAGE_DIFF_SSE2
+// Computes the difference for the leading part of the row and returns the number of processed pixels.
+template <Uint32 NumChannels>
+Uint32 ComputeRowDifferenceSSE2(const Uint8*    pRow1,
+                                const Uint8*    pRow2,
+                                Uint8*          pDiffRow,
+                                Uint32          Width,
+                                Uint32          Threshold,
+                                ImageDiffStats& Stats)
+{
+    using Block = PixelBlock<NumChannels>;
+
+    const Uint32 NumBlocks = Block::GetNumBlocks(Width);
+    if (NumBlocks == 0)
+        return 0;
+
+    const __m128i Zero      = _mm_setzero_si128();
+    const __m128i One       = _mm_set1_epi8(1);
+    const __m128i PixelMask = _mm_load_si128(reinterpret_cast<const __m128i*>(Block::GetPixelMask()));
+
+    // Unsigned comparison X > Threshold is performed as max(X, Threshold + 1) == X.
+    // Bytes between pixels are zero and never pass the test.
+    const bool    CountAboveThreshold = Threshold < 255;
+    const __m128i ThresholdPlus1      = _mm_set1_epi8(static_cast<char>(CountAboveThreshold ? Threshold + 1 : 255));
+
+    __m128i MaxDiff     = Zero;
+    __m128i NumDiff64   = Zero;
+    __m128i NumAbove64  = Zero;
+    __m128i SumDiff64   = Zero;
+    __m128i SumDiffSq64 = Zero;
+    for (Uint32 block = 0; block < NumBlocks;)
+    {
+        const Uint32 BatchEnd    = std::min(block + Block::MaxBlocksPerBatch, NumBlocks);
+        __m128i      SumDiffSq32 = Zero;
+        for (; block < BatchEnd; ++block)
+        {
+            const size_t  Offset = size_t{block} * Block::Size;
+            const __m128i Src1   = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pRow1 + Offset));
+            const __m128i Src2   = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pRow2 + Offset));
+
+            // |Src1 - Src2|
+            const __m128i ChannelDiff = _mm_or_si128(_mm_subs_epu8(Src1, Src2), _mm_subs_epu8(Src2, Src1));
+            if (pDiffRow != nullptr)
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(pDiffRow + Offset), ChannelDiff);
+
+            // Compute the maximum of the pixel channels in the first byte of every pixel
+            __m128i PixelDiff = _mm_max_epu8(ChannelDiff, _mm_srli_si128(ChannelDiff, 1));
+            PixelDiff         = NumChannels == 3 ?
+                _mm_max_epu8(PixelDiff, _mm_srli_si128(ChannelDiff, 2)) :
+                _mm_max_epu8(PixelDiff, _mm_srli_si128(PixelDiff, 2));
+            PixelDiff = _mm_and_si128(PixelDiff, PixelMask);
+
+            MaxDiff   = _mm_max_epu8(MaxDiff, PixelDiff);
+            SumDiff64 = _mm_add_epi64(SumDiff64, _mm_sad_epu8(PixelDiff, Zero));
+
+            const __m128i IsDiff = _mm_cmpeq_epi8(_mm_max_epu8(PixelDiff, One), PixelDiff);
+            NumDiff64            = _mm_add_epi64(NumDiff64, _mm_sad_epu8(_mm_and_si128(IsDiff, One), Zero));
+            if (CountAboveThreshold)
+            {
+                const __m128i IsAbove = _mm_cmpeq_epi8(_mm_max_epu8(PixelDiff, ThresholdPlus1), PixelDiff);
+                NumAbove64            = _mm_add_epi64(NumAbove64, _mm_sad_epu8(_mm_and_si128(IsAbove, One), Zero));
+            }
+
+            const __m128i DiffLo = _mm_unpacklo_epi8(PixelDiff, Zero);
+            const __m128i DiffHi = _mm_unpackhi_epi8(PixelDiff, Zero);
+            SumDiffSq32          = _mm_add_epi32(SumDiffSq32, _mm_add_epi32(_mm_madd_epi16(DiffLo, DiffLo), _mm_madd_epi16(DiffHi, DiffHi)));
+        }
+        SumDiffSq64 = _mm_add_epi64(SumDiffSq64, _mm_unpacklo_epi32(SumDiffSq32, Zero));
+        SumDiffSq64 = _mm_add_epi64(SumDiffSq64, _mm_unpackhi_epi32(SumDiffSq32, Zero));
+    }
+
+    alignas(16) Uint64 Sums[4][2];
+    _mm_store_si128(reinterpret_cast<__m128i*>(Sums[0]), NumDiff64);
+    _mm_store_si128(reinterpret_cast<__m128i*>(Sums[1]), NumAbove64);
+    _mm_store_si128(reinterpret_cast<__m128i*>(Sums[2]), SumDiff64);
+    _mm_store_si128(reinterpret_cast<__m128i*>(Sums[3]), SumDiffSq64);
+    Stats.NumDiffPixels += Sums[0][0] + Sums[0][1];
+    Stats.NumDiffPixelsAboveThreshold += Sums[1][0] + Sums[1][1];
+    Stats.SumDiff += Sums[2][0] + Sums[2][1];
+    Stats.SumDiffSq += Sums[3][0] + Sums[3][1];
+
+    alignas(16) Uint8 MaxBytes[16];
+    _mm_store_si128(reinterpret_cast<__m128i*>(MaxBytes), MaxDiff);
+    Stats.MaxDiff = std::max(Stats.MaxDiff, Uint32{*std::max_element(MaxBytes, MaxBytes + 16)});
+
+    return NumBlocks * Block::NumPixels;
+}
+#endif
+
+#if DILIGENT_AVX2_SUPPORTED
+// Loads two consecutive blocks into the two 128-bit lanes
+template <Uint32 NumChannels>
+DILIGENT_TARGET_AVX2 __m256i LoadBlockPair(const Uint8* pBlocks)
+{
+    const __m128i Lo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pBlocks));
+    const __m128i Hi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pBlocks + PixelBlock<NumChannels>::Size));
+    return _mm256_inserti128_si256(_mm256_castsi128_si256(Lo), Hi, 1);
+}
+
+// Same as ComputeRowDifferenceSSE2, but processes two blocks at a time.
+// The function is compiled for AVX2 and is only called if the CPU supports it.
+template <Uint32 NumChannels>
+DILIGENT_TARGET_AVX2 Uint32 ComputeRowDifferenceAVX2(const Uint8*    pRow1,
+                                const Uint8*    pRow2,
+                                Uint8*          pDiffRow,
+                                Uint32          Width,
+                                Uint32          Threshold,
+                                ImageDiffStats& Stats)
+{
+    using Block = PixelBlock<NumChannels>;
+
+    const Uint32 NumPairs = Block::GetNumBlocks(Width) / 2;
+    if (NumPairs == 0)
+        return 0;
+
+    // Two blocks are loaded into the two 128-bit lanes. Byte shifts work within
+    // the lanes, so the lanes are processed exactly like in the SSE2 version.
+    const __m256i Zero      = _mm256_setzero_si256();
+    const __m256i One       = _mm256_set1_epi8(1);
+    const __m256i PixelMask = _mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<const __m128i*>(Block::GetPixelMask())));
+
+    const bool    CountAboveThreshold = Threshold < 255;
+    const __m256i ThresholdPlus1      = _mm256_set1_epi8(static_cast<char>(CountAboveThreshold ? Threshold + 1 : 255));
+
+    __m256i MaxDiff     = Zero;
+    __m256i NumDiff64   = Zero;
+    __m256i NumAbove64  = Zero;
+    __m256i SumDiff64   = Zero;
+    __m256i SumDiffSq64 = Zero;
+    for (Uint32 pair = 0; pair < NumPairs;)
+    {
+        const Uint32 BatchEnd    = std::min(pair + Block::MaxBlocksPerBatch, NumPairs);
+        __m256i      SumDiffSq32 = Zero;
+        for (; pair < BatchEnd; ++pair)
+        {
+            const size_t  Offset = size_t{pair} * Block::Size * 2;
+            const __m256i Src1   = LoadBlockPair<NumChannels>(pRow1 + Offset);
+            const __m256i Src2   = LoadBlockPair<NumChannels>(pRow2 + Offset);
+
+            const __m256i ChannelDiff = _mm256_or_si256(_mm256_subs_epu8(Src1, Src2), _mm256_subs_epu8(Src2, Src1));
+            if (pDiffRow != nullptr)
+            {
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(pDiffRow + Offset), _mm256_castsi256_si128(ChannelDiff));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(pDiffRow + Offset + Block::Size), _mm256_extracti128_si256(ChannelDiff, 1));
+            }
+
+            __m256i PixelDiff = _mm256_max_epu8(ChannelDiff, _mm256_srli_si256(ChannelDiff, 1));
+            PixelDiff         = NumChannels == 3 ?
+                _mm256_max_epu8(PixelDiff, _mm256_srli_si256(ChannelDiff, 2)) :
+                _mm256_max_epu8(PixelDiff, _mm256_srli_si256(PixelDiff, 2));
+            PixelDiff = _mm256_and_si256(PixelDiff, PixelMask);
+
+            MaxDiff   = _mm256_max_epu8(MaxDiff, PixelDiff);
+            SumDiff64 = _mm256_add_epi64(SumDiff64, _mm256_sad_epu8(PixelDiff, Zero));
+
+            const __m256i IsDiff = _mm256_cmpeq_epi8(_mm256_max_epu8(PixelDiff, One), PixelDiff);
+            NumDiff64            = _mm256_add_epi64(NumDiff64, _mm256_sad_epu8(_mm256_and_si256(IsDiff, One), Zero));
+            if (CountAboveThreshold)
+            {
+                const __m256i IsAbove = _mm256_cmpeq_epi8(_mm256_max_epu8(PixelDiff, ThresholdPlus1), PixelDiff);
+                NumAbove64            = _mm256_add_epi64(NumAbove64, _mm256_sad_epu8(_mm256_and_si256(IsAbove, One), Zero));
+            }
+
+            const __m256i DiffLo = _mm256_unpacklo_epi8(PixelDiff, Zero);
+            const __m256i DiffHi = _mm256_unpackhi_epi8(PixelDiff, Zero);
+            SumDiffSq32          = _mm256_add_epi32(SumDiffSq32, _mm256_add_epi32(_mm256_madd_epi16(DiffLo, DiffLo), _mm256_madd_epi16(DiffHi, DiffHi)));
+        }
+        SumDiffSq64 = _mm256_add_epi64(SumDiffSq64, _mm256_unpacklo_epi32(SumDiffSq32, Zero));
+        SumDiffSq64 = _mm256_add_epi64(SumDiffSq64, _mm256_unpackhi_epi32(SumDiffSq32, Zero));
+    }
+
+    alignas(32) Uint64 Sums[4][4];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(Sums[0]), NumDiff64);
+    _mm256_store_si256(reinterpret_cast<__m256i*>(Sums[1]), NumAbove64);
+    _mm256_store_si256(reinterpret_cast<__m256i*>(Sums[2]), SumDiff64);
+    _mm256_store_si256(reinterpret_cast<__m256i*>(Sums[3]), SumDiffSq64);
+    Stats.NumDiffPixels += Sums[0][0] + Sums[0][1] + Sums[0][2] + Sums[0][3];
+    Stats.NumDiffPixelsAboveThreshold += Sums[1][0] + Sums[1][1] + Sums[1][2] + Sums[1][3];
+    Stats.SumDiff += Sums[2][0] + Sums[2][1] + Sums[2][2] + Sums[2][3];
+    Stats.SumDiffSq += Sums[3][0] + Sums[3][1] + Sums[3][2] + Sums[3][3];
+
+    alignas(32) Uint8 MaxBytes[32];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(MaxBytes), MaxDiff);
+    Stats.MaxDiff = std::max(Stats.MaxDiff, Uint32{*std::max_element(MaxBytes, MaxBytes + 32)});
+
+    return NumPairs * 2 * Block::NumPixels;
+}
+#endif
+
+// Computes the difference for the leading part of the row using SIMD instructions
+// and returns the number of processed pixels.
+using ComputeRowDifferenceProcType = Uint32 (*)(const Uint8*    pRow1,
+                                                const Uint8*    pRow2,
+                                                Uint8*          pDiffRow,
+                                                Uint32          Width,
+                                                Uint32          Threshold,
+                                                ImageDiffStats& Stats);
+
+// Selects the fastest SIMD implementation supported by the CPU, or returns null if there is none
+template <Uint32 NumChannels>
+ComputeRowDifferenceProcType SelectComputeRowDifferenceProc()
+{
+#if DILIGENT_AVX2_SUPPORTED
+    if (GetX86Features().AVX2)
+        return ComputeRowDifferenceAVX2<NumChannels>;
+#endif
+#if DILIGENT_IMAGE_DIFF_SSE2
+    return ComputeRowDifferenceSSE2<NumChannels>;
+#else
+    return nullptr;
+#endif
+}
+
+class ImageDifferenceComputer
+{
+public:
+    explicit ImageDifferenceComputer(const ComputeImageDifferenceAttribs& Attribs) :
+        m_Attribs{Attribs},
+        m_NumSrcChannels{std::min(Attribs.NumChannels1, Attribs.NumChannels2)},
+        m_NumDiffChannels{Attribs.NumDiffChannels != 0 ? Attribs.NumDiffChannels : m_NumSrcChannels}
+    {
+        // With unit scale and the same layout, the difference image is the absolute channel difference
+        const bool IsSIMDDiffImageCompatible =
+            Attribs.pDiffImage == nullptr ||
+            (m_NumDiffChannels == m_NumSrcChannels && Attribs.Scale == 1.f);
+        if (Attribs.NumChannels1 == Attribs.NumChannels2 && IsSIMDDiffImageCompatible)
+        {
+            // The implementation is selected once, on the first call
+            static const ComputeRowDifferenceProcType ComputeRowDifference3 = SelectComputeRowDifferenceProc<3>();
+            static const ComputeRowDifferenceProcType ComputeRowDifference4 = SelectComputeRowDifferenceProc<4>();
+            if (m_NumSrcChannels == 3)
+                m_ComputeRowDifferenceSIMD = ComputeRowDifference3;
+            else if (m_NumSrcChannels == 4)
+                m_ComputeRowDifferenceSIMD = ComputeRowDifference4;
+        }
+    }
+
+    // Processes rows [StartRow, EndRow) and returns false if the difference budget has been exceeded
+    bool ProcessRows(Uint32 StartRow, Uint32 EndRow, ImageDiffStats& Stats)
+    {
+        for (Uint32 row = StartRow; row < EndRow; ++row)
+        {
+            if (m_BudgetExceeded.load(std::memory_order_relaxed))
+                return false;
+
+            const Uint64 NumAbove = Stats.NumDiffPixelsAboveThreshold;
+            ProcessRow(row, Stats);
+
+            if (m_Attribs.MaxDiffPixelsAboveThreshold != ~0u)
+            {
+                const Uint64 RowNumAbove = Stats.NumDiffPixelsAboveThreshold - NumAbove;
+                if (m_NumDiffPixelsAboveThreshold.fetch_add(RowNumAbove) + RowNumAbove > m_Attribs.MaxDiffPixelsAboveThreshold)
+                {
+                    m_BudgetExceeded.store(true);
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+private:
+    void ProcessRow(Uint32 row, ImageDiffStats& Stats) const
+    {
+        const Uint8* pRow1    = static_cast<const Uint8*>(m_Attribs.pImage1) + size_t{row} * m_Attribs.Stride1;
+        const Uint8* pRow2    = static_cast<const Uint8*>(m_Attribs.pImage2) + size_t{row} * m_Attribs.Stride2;
+        Uint8*       pDiffRow = m_Attribs.pDiffImage != nullptr ? static_cast<Uint8*>(m_Attribs.pDiffImage) + size_t{row} * m_Attribs.DiffStride : nullptr;
+
+        Uint32 StartCol = 0;
+        if (m_ComputeRowDifferenceSIMD != nullptr)
+            StartCol = m_ComputeRowDifferenceSIMD(pRow1, pRow2, pDiffRow, m_Attribs.Width, m_Attribs.Threshold, Stats);
+
+        const Uint32 NumChannels1 = m_Attribs.NumChannels1;
+        const Uint32 NumChannels2 = m_Attribs.NumChannels2;
+        for (Uint32 col = StartCol; col < m_Attribs.Width; ++col)
+        {
+            Uint32 PixelDiff = 0;
+            for (Uint32 ch = 0; ch < m_NumSrcChannels; ++ch)
+            {
+                const Uint32 ChannelDiff = static_cast<Uint32>(
+                    std::abs(static_cast<int>(pRow1[col * NumChannels1 + ch]) -
+                             static_cast<int>(pRow2[col * NumChannels2 + ch])));
+                PixelDiff = std::max(PixelDiff, ChannelDiff);
+
+                if (pDiffRow != nullptr && ch < m_NumDiffChannels)
+                {
+                    pDiffRow[col * m_NumDiffChannels + ch] = static_cast<Uint8>(std::min(ChannelDiff * m_Attribs.Scale, 255.f));
+                }
+            }
+
+            if (pDiffRow != nullptr)
+            {
+                for (Uint32 ch = m_NumSrcChannels; ch < m_NumDiffChannels; ++ch)
+                {
+                    pDiffRow[col * m_NumDiffChannels + ch] = ch == 3 ? 255 : 0;
+                }
+            }
+
+            Stats.AddPixel(PixelDiff, m_Attribs.Threshold);
+        }
+    }
+
+private:
+    const ComputeImageDifferenceAttribs& m_Attribs;
+
+    const Uint32 m_NumSrcChannels;
+    const Uint32 m_NumDiffChannels;
+
+    // SIMD row kernel, or null if it can't be used
+    ComputeRowDifferenceProcType m_ComputeRowDifferenceSIMD = nullptr;
+
+    std::atomic<Uint64> m_NumDiffPixelsAboveThreshold{0};
+    std::atomic<bool>   m_BudgetExceeded{false};
+};
+
+} // namespace
+
 void ComputeImageDifference(const ComputeImageDifferenceAttribs& Attribs,
                             ImageDiffInfo&                       Diff)
 {
@@ -79,55 +470,37 @@ void ComputeImageDifference(const ComputeImageDifferenceAttribs& Attribs,
         }
     }
 
-    for (Uint32 row = 0; row < Attribs.Height; ++row)
-    {
-        const Uint8* pRow1    = reinterpret_cast<const Uint8*>(Attribs.pImage1) + row * Attribs.Stride1;
-        const Uint8* pRow2    = reinterpret_cast<const Uint8*>(Attribs.pImage2) + row * Attribs.Stride2;
-        Uint8*       pDiffRow = Attribs.pDiffImage != nullptr ? reinterpret_cast<Uint8*>(Attribs.pDiffImage) + row * Attribs.DiffStride : nullptr;
-
-        for (Uint32 col = 0; col < Attribs.Width; ++col)
-        {
-            Uint32 PixelDiff = 0;
-            for (Uint32 ch = 0; ch < NumSrcChannels; ++ch)
-            {
-                const Uint32 ChannelDiff = static_cast<Uint32>(
-                    std::abs(static_cast<int>(pRow1[col * Attribs.NumChannels1 + ch]) -
-                             static_cast<int>(pRow2[col * Attribs.NumChannels2 + ch])));
-                PixelDiff = std::max(PixelDiff, ChannelDiff);
-
-                if (pDiffRow != nullptr && ch < NumDiffChannels)
-                {
-                    pDiffRow[col * NumDiffChannels + ch] = static_cast<Uint8>(std::min(ChannelDiff * Attribs.Scale, 255.f));
-                }
-            }
-
-            if (pDiffRow != nullptr)
-            {
-                for (Uint32 ch = NumSrcChannels; ch < NumDiffChannels; ++ch)
-                {
-                    pDiffRow[col * NumDiffChannels + ch] = ch == 3 ? 255 : 0;
-                }
-            }
+    ImageDifferenceComputer Computer{Attribs};
 
-            if (PixelDiff != 0)
-            {
-                ++Diff.NumDiffPixels;
-                Diff.AvgDiff += static_cast<float>(PixelDiff);
-                Diff.RmsDiff += static_cast<float>(PixelDiff * PixelDiff);
-                Diff.MaxDiff = std::max(Diff.MaxDiff, PixelDiff);
-
-                if (PixelDiff > Attribs.Threshold)
-                {
-                    ++Diff.NumDiffPixelsAboveThreshold;
-                }
-            }
-        }
+    ImageDiffStats Stats;
+    // Tiles of about 64K pixels are large enough to amortize the scheduling overhead
+    // and small enough to balance the load between the threads.
+    const Uint32 RowsPerTile = std::max(65536u / std::max(Attribs.Width, 1u), 1u);
+    const Uint32 NumTiles    = (Attribs.Height + RowsPerTile - 1) / RowsPerTile;
+    if (Attribs.pThreadPool != nullptr && NumTiles > 1)
+    {
+        // Tile statistics are combined in a fixed order, so the result does not
+        // depend on how the tiles were distributed between the threads.
+        std::vector<ImageDiffStats> TileStats(NumTiles);
+        ParallelFor(Attribs.pThreadPool, NumTiles, [&](size_t Tile) {
+            const Uint32 StartRow = static_cast<Uint32>(Tile) * RowsPerTile;
+            Computer.ProcessRows(StartRow, std::min(StartRow + RowsPerTile, Attribs.Height), TileStats[Tile]);
+        });
+        for (const ImageDiffStats& Tile : TileStats)
+            Stats += Tile;
+    }
+    else
+    {
+        Computer.ProcessRows(0, Attribs.Height, Stats);
     }
 
-    if (Diff.NumDiffPixels > 0)
+    Diff.NumDiffPixels               = static_cast<Uint32>(Stats.NumDiffPixels);
+    Diff.NumDiffPixelsAboveThreshold = static_cast<Uint32>(Stats.NumDiffPixelsAboveThreshold);
+    Diff.MaxDiff                     = Stats.MaxDiff;
+    if (Stats.NumDiffPixels > 0)
     {
-        Diff.AvgDiff /= static_cast<float>(Diff.NumDiffPixels);
-        Diff.RmsDiff = std::sqrt(Diff.RmsDiff / static_cast<float>(Diff.NumDiffPixels));
+        Diff.AvgDiff = static_cast<float>(static_cast<double>(Stats.SumDiff) / static_cast<double>(Stats.NumDiffPixels));
+        Diff.RmsDiff = static_cast<float>(std::sqrt(static_cast<double>(Stats.SumDiffSq) / static_cast<double>(Stats.NumDiffPixels)));
     }
 }
 
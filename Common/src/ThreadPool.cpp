@@ -51,7 +51,8 @@ public:
 
     ThreadPoolImpl(IReferenceCounters*         pRefCounters,
                    const ThreadPoolCreateInfo& PoolCI) :
-        TBase{pRefCounters}
+        TBase{pRefCounters},
+        m_NumThreads{StaticCast<Uint32>(PoolCI.NumThreads)}
     {
         m_WorkerThreads.reserve(PoolCI.NumThreads);
         for (Uint32 i = 0; i < PoolCI.NumThreads; ++i)
@@ -358,6 +359,11 @@ public:
         return m_NumRunningTasks.load();
     }
 
+    virtual Uint32 DILIGENT_CALL_TYPE GetThreadCount() const override final
+    {
+        return m_NumThreads;
+    }
+
     ~ThreadPoolImpl()
     {
         StopThreads();
@@ -366,6 +372,7 @@ public:
     }
 
 private:
+    const Uint32             m_NumThreads;
     std::vector<std::thread> m_WorkerThreads;
 
     struct QueuedTaskInfo
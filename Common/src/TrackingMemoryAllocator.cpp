@@ -0,0 +1,401 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "pch.h"
+#include "TrackingMemoryAllocator.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstring>
+#include <sstream>
+#include <iomanip>
+#include <limits>
+
+#include "Align.hpp"
+#include "DebugUtilities.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+constexpr char UnknownTag[]  = "<Unknown>";
+constexpr char OverflowTag[] = "<Other>";
+
+constexpr Uint32 UnknownTagId  = 0;
+constexpr Uint32 OverflowTagId = 1;
+
+constexpr Uint32 TagsPerChunk = 64;
+constexpr Uint32 MaxTagChunks = 64;
+constexpr Uint32 MaxTags      = TagsPerChunk * MaxTagChunks;
+
+// The header is placed right before the memory returned to the caller
+struct AllocationHeader
+{
+    size_t Size;
+    Uint32 TagId;
+    // Offset from the start of the raw allocation to the user memory
+    Uint32 Offset;
+};
+
+constexpr size_t MinHeaderAlignment = alignof(std::max_align_t);
+
+struct TagCounters
+{
+    // Counters are only modified by the owning thread, so relaxed load/store
+    // pairs are used instead of atomic read-modify-write operations.
+    std::atomic<Int64>  LiveBytes{0};
+    std::atomic<Int64>  LiveAllocations{0};
+    std::atomic<Uint64> NumAllocations{0};
+    std::atomic<Uint64> NumFrees{0};
+    std::atomic<Uint64> AllocatedBytes{0};
+};
+
+template <typename T>
+void Add(std::atomic<T>& Counter, T Value)
+{
+    Counter.store(Counter.load(std::memory_order_relaxed) + Value, std::memory_order_relaxed);
+}
+
+std::atomic<Uint64> g_NextAllocatorId{1};
+
+TrackingMemoryAllocator::TagStats AccumulateTotals(const std::vector<TrackingMemoryAllocator::TagStats>& Stats)
+{
+    TrackingMemoryAllocator::TagStats Totals;
+    Totals.Tag = "Total";
+    for (const TrackingMemoryAllocator::TagStats& Stat : Stats)
+    {
+        Totals.LiveBytes += Stat.LiveBytes;
+        Totals.LiveAllocations += Stat.LiveAllocations;
+        Totals.NumAllocations += Stat.NumAllocations;
+        Totals.NumFrees += Stat.NumFrees;
+        Totals.AllocatedBytes += Stat.AllocatedBytes;
+    }
+    return Totals;
+}
+
+} // namespace
+
+struct TrackingMemoryAllocator::ThreadData
+{
+    ThreadData()
+    {
+        for (std::atomic<TagCounters*>& Chunk : Chunks)
+            Chunk.store(nullptr, std::memory_order_relaxed);
+    }
+
+    ~ThreadData()
+    {
+        for (std::atomic<TagCounters*>& Chunk : Chunks)
+            delete[] Chunk.load(std::memory_order_relaxed);
+    }
+
+    // Only called by the owning thread
+    TagCounters& GetCounters(Uint32 TagId)
+    {
+        VERIFY_EXPR(TagId < MaxTags);
+        std::atomic<TagCounters*>& Chunk   = Chunks[TagId / TagsPerChunk];
+        TagCounters*               pChunk = Chunk.load(std::memory_order_relaxed);
+        if (pChunk == nullptr)
+        {
+            pChunk = new TagCounters[TagsPerChunk];
+            // Publish the chunk to the threads that collect the statistics
+            Chunk.store(pChunk, std::memory_order_release);
+        }
+        return pChunk[TagId % TagsPerChunk];
+    }
+
+    // Counters are allocated in chunks that are never moved, so that other threads
+    // can safely read them while the owning thread adds new tags.
+    std::array<std::atomic<TagCounters*>, MaxTagChunks> Chunks;
+
+    // Direct-mapped cache of tag ids indexed by the description pointer.
+    // Descriptions are normally string literals, so the cache hit rate is very high.
+    static constexpr size_t TagCacheSize = 256;
+
+    struct TagCacheEntry
+    {
+        const Char* Tag   = nullptr;
+        Uint32      TagId = 0;
+    };
+    std::array<TagCacheEntry, TagCacheSize> TagCache;
+};
+
+TrackingMemoryAllocator::TrackingMemoryAllocator(IMemoryAllocator& RawAllocator) :
+    m_RawAllocator{RawAllocator},
+    m_Id{g_NextAllocatorId.fetch_add(1)}
+{
+    const Uint32 UnknownId  = RegisterTag(UnknownTag);
+    const Uint32 OverflowId = RegisterTag(OverflowTag);
+    VERIFY_EXPR(UnknownId == UnknownTagId && OverflowId == OverflowTagId);
+    (void)UnknownId;
+    (void)OverflowId;
+}
+
+TrackingMemoryAllocator::~TrackingMemoryAllocator()
+{
+}
+
+TrackingMemoryAllocator::ThreadData& TrackingMemoryAllocator::GetThreadData()
+{
+    struct ThreadDataCache
+    {
+        Uint64      AllocatorId = 0;
+        ThreadData* pData       = nullptr;
+    };
+    // Most applications use a single allocator, so caching the last used one is sufficient
+    static thread_local ThreadDataCache Cache;
+    if (Cache.AllocatorId == m_Id)
+        return *Cache.pData;
+
+    static thread_local std::unordered_map<Uint64, ThreadData*> AllocatorThreadData;
+
+    ThreadData*& pData = AllocatorThreadData[m_Id];
+    if (pData == nullptr)
+    {
+        // Thread data is owned by the allocator and is kept after the thread exits,
+        // so that allocations freed by other threads are accounted correctly.
+        std::unique_ptr<ThreadData> pNewData = std::make_unique<ThreadData>();
+
+        pData = pNewData.get();
+
+        std::lock_guard<std::mutex> Lock{m_ThreadsMtx};
+        m_Threads.emplace_back(std::move(pNewData));
+    }
+
+    Cache = {m_Id, pData};
+    return *pData;
+}
+
+Uint32 TrackingMemoryAllocator::RegisterTag(const Char* Tag)
+{
+    std::lock_guard<std::mutex> Lock{m_TagsMtx};
+
+    auto it = m_TagIds.find(Tag);
+    if (it != m_TagIds.end())
+        return it->second;
+
+    if (m_TagNames.size() >= MaxTags)
+    {
+        // Allocations with too many distinct descriptions are accounted to the overflow tag
+        return OverflowTagId;
+    }
+
+    const Uint32 TagId = static_cast<Uint32>(m_TagNames.size());
+    m_TagNames.emplace_back(Tag);
+    m_TagIds.emplace(Tag, TagId);
+    return TagId;
+}
+
+Uint32 TrackingMemoryAllocator::GetTagId(ThreadData& Data, const Char* Tag)
+{
+    if (Tag == nullptr || Tag[0] == '\0')
+        return UnknownTagId;
+
+    ThreadData::TagCacheEntry& Entry = Data.TagCache[(reinterpret_cast<size_t>(Tag) >> 3) % ThreadData::TagCacheSize];
+    if (Entry.Tag != Tag)
+    {
+        // Note that the description pointer may be reused for a different string,
+        // e.g. when descriptions are built dynamically. The tag is then accounted to
+        // the string the pointer referenced when it was first seen by this thread.
+        Entry.Tag   = Tag;
+        Entry.TagId = RegisterTag(Tag);
+    }
+    return Entry.TagId;
+}
+
+void* TrackingMemoryAllocator::AllocateWithHeader(size_t Size, size_t Alignment, const Char* dbgDescription)
+{
+    ThreadData&  Data  = GetThreadData();
+    const Uint32 TagId = GetTagId(Data, dbgDescription);
+
+    const size_t HeaderSize = AlignUp(sizeof(AllocationHeader), std::max(Alignment, MinHeaderAlignment));
+    VERIFY_EXPR(HeaderSize <= std::numeric_limits<Uint32>::max());
+
+    Uint8* pRawMem = Alignment != 0 ?
+        static_cast<Uint8*>(m_RawAllocator.AllocateAligned(Size + HeaderSize, Alignment, dbgDescription, __FILE__, __LINE__)) :
+        static_cast<Uint8*>(m_RawAllocator.Allocate(Size + HeaderSize, dbgDescription, __FILE__, __LINE__));
+    if (pRawMem == nullptr)
+        return nullptr;
+
+    Uint8*           pUserMem = pRawMem + HeaderSize;
+    AllocationHeader Header{Size, TagId, static_cast<Uint32>(HeaderSize)};
+    memcpy(pUserMem - sizeof(AllocationHeader), &Header, sizeof(Header));
+
+    TagCounters& Counters = Data.GetCounters(TagId);
+    Add<Int64>(Counters.LiveBytes, static_cast<Int64>(Size));
+    Add<Int64>(Counters.LiveAllocations, 1);
+    Add<Uint64>(Counters.NumAllocations, 1);
+    Add<Uint64>(Counters.AllocatedBytes, Size);
+
+    return pUserMem;
+}
+
+void* TrackingMemoryAllocator::FreeWithHeader(void* Ptr)
+{
+    Uint8* pUserMem = static_cast<Uint8*>(Ptr);
+
+    AllocationHeader Header;
+    memcpy(&Header, pUserMem - sizeof(AllocationHeader), sizeof(Header));
+    VERIFY(Header.TagId < MaxTags, "Invalid allocation header. The memory may not have been allocated by this allocator or may have been corrupted.");
+
+    TagCounters& Counters = GetThreadData().GetCounters(Header.TagId);
+    Add<Int64>(Counters.LiveBytes, -static_cast<Int64>(Header.Size));
+    Add<Int64>(Counters.LiveAllocations, -1);
+    Add<Uint64>(Counters.NumFrees, 1);
+
+    return pUserMem - Header.Offset;
+}
+
+void* TrackingMemoryAllocator::Allocate(size_t Size, const Char* dbgDescription, const char* dbgFileName, const Int32 dbgLineNumber)
+{
+    VERIFY_EXPR(Size > 0);
+    return AllocateWithHeader(Size, 0, dbgDescription);
+}
+
+void TrackingMemoryAllocator::Free(void* Ptr)
+{
+    if (Ptr == nullptr)
+        return;
+    m_RawAllocator.Free(FreeWithHeader(Ptr));
+}
+
+void* TrackingMemoryAllocator::AllocateAligned(size_t Size, size_t Alignment, const Char* dbgDescription, const char* dbgFileName, const Int32 dbgLineNumber)
+{
+    VERIFY_EXPR(Size > 0 && Alignment > 0);
+    VERIFY(IsPowerOfTwo(Alignment), "Alignment (", Alignment, ") must be a power of two");
+    return AllocateWithHeader(Size, Alignment, dbgDescription);
+}
+
+void TrackingMemoryAllocator::FreeAligned(void* Ptr)
+{
+    if (Ptr == nullptr)
+        return;
+    m_RawAllocator.FreeAligned(FreeWithHeader(Ptr));
+}
+
+std::vector<TrackingMemoryAllocator::TagStats> TrackingMemoryAllocator::GetStats() const
+{
+    std::vector<TagStats> Stats;
+    {
+        std::lock_guard<std::mutex> Lock{m_TagsMtx};
+        Stats.resize(m_TagNames.size());
+        for (size_t i = 0; i < m_TagNames.size(); ++i)
+            Stats[i].Tag = m_TagNames[i];
+    }
+
+    {
+        std::lock_guard<std::mutex> Lock{m_ThreadsMtx};
+        for (const std::unique_ptr<ThreadData>& pData : m_Threads)
+        {
+            for (Uint32 ChunkIdx = 0; ChunkIdx < MaxTagChunks; ++ChunkIdx)
+            {
+                const TagCounters* pChunk = pData->Chunks[ChunkIdx].load(std::memory_order_acquire);
+                if (pChunk == nullptr)
+                    continue;
+
+                for (Uint32 i = 0; i < TagsPerChunk; ++i)
+                {
+                    // The tag may have been registered after the names were copied
+                    const size_t TagId = size_t{ChunkIdx} * TagsPerChunk + i;
+                    if (TagId >= Stats.size())
+                        break;
+
+                    const TagCounters& Counters = pChunk[i];
+                    TagStats&          Dst      = Stats[TagId];
+                    Dst.LiveBytes += Counters.LiveBytes.load(std::memory_order_relaxed);
+                    Dst.LiveAllocations += Counters.LiveAllocations.load(std::memory_order_relaxed);
+                    Dst.NumAllocations += Counters.NumAllocations.load(std::memory_order_relaxed);
+                    Dst.NumFrees += Counters.NumFrees.load(std::memory_order_relaxed);
+                    Dst.AllocatedBytes += Counters.AllocatedBytes.load(std::memory_order_relaxed);
+                }
+            }
+        }
+    }
+
+    // Remove tags that have never been used (e.g. the reserved ones)
+    Stats.erase(std::remove_if(Stats.begin(), Stats.end(), [](const TagStats& Stat) { return Stat.NumAllocations == 0; }), Stats.end());
+
+    std::sort(Stats.begin(), Stats.end(),
+              [](const TagStats& Lhs, const TagStats& Rhs) {
+                  if (Lhs.LiveBytes != Rhs.LiveBytes)
+                      return Lhs.LiveBytes > Rhs.LiveBytes;
+                  return Lhs.AllocatedBytes > Rhs.AllocatedBytes;
+              });
+
+    return Stats;
+}
+
+TrackingMemoryAllocator::TagStats TrackingMemoryAllocator::GetTotals() const
+{
+    return AccumulateTotals(GetStats());
+}
+
+std::string TrackingMemoryAllocator::GetReport(size_t MaxTags) const
+{
+    const std::vector<TagStats> Stats = GetStats();
+
+    const TagStats              Totals = AccumulateTotals(Stats);
+
+    size_t TagColumnWidth = Totals.Tag.length();
+    for (size_t i = 0; i < Stats.size() && (MaxTags == 0 || i < MaxTags); ++i)
+        TagColumnWidth = std::max(TagColumnWidth, Stats[i].Tag.length());
+    TagColumnWidth += 2;
+
+    std::stringstream ss;
+
+    auto PrintRow = [&](const std::string& Tag, const auto& LiveBytes, const auto& LiveAllocs, const auto& NumAllocs, const auto& NumFrees, const auto& AllocatedBytes) {
+        ss << std::left << std::setw(static_cast<int>(TagColumnWidth)) << Tag << std::right
+           << std::setw(16) << LiveBytes
+           << std::setw(12) << LiveAllocs
+           << std::setw(14) << NumAllocs
+           << std::setw(14) << NumFrees
+           << std::setw(18) << AllocatedBytes << '\n';
+    };
+
+    ss << "Memory allocations by tag:\n";
+    PrintRow("Tag", "Live bytes", "Live allocs", "Allocs", "Frees", "Allocated bytes");
+    for (size_t i = 0; i < Stats.size() && (MaxTags == 0 || i < MaxTags); ++i)
+    {
+        const TagStats& Stat = Stats[i];
+        PrintRow(Stat.Tag, Stat.LiveBytes, Stat.LiveAllocations, Stat.NumAllocations, Stat.NumFrees, Stat.AllocatedBytes);
+    }
+    if (MaxTags != 0 && Stats.size() > MaxTags)
+        ss << "... " << (Stats.size() - MaxTags) << " more tags\n";
+    PrintRow(Totals.Tag, Totals.LiveBytes, Totals.LiveAllocations, Totals.NumAllocations, Totals.NumFrees, Totals.AllocatedBytes);
+
+    return ss.str();
+}
+
+void TrackingMemoryAllocator::DumpReport(size_t MaxTags) const
+{
+    LOG_INFO_MESSAGE(GetReport(MaxTags));
+}
+
+} // namespace Diligent
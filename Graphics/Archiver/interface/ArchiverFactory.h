@@ -352,6 +352,28 @@ DILIGENT_BEGIN_INTERFACE(IArchiverFactory, IObject)
     /// are destroyed.
     VIRTUAL void METHOD(SetMemoryAllocator)(THIS_
                                             IMemoryAllocator* pAllocator) CONST PURE;
+
+    /// Enables or disables the CPU profiler.
+
+    /// \param [in] Enable - Whether to enable the profiler.
+    ///
+    /// The profiler records the time spent on validating descriptions, creating resource
+    /// signatures, patching and reflecting shaders, and creating and binding shader resource
+    /// bindings. The events can be retrieved with GetCPUProfilerTrace().
+    ///
+    /// Similar to the memory allocator, the profiler is a global setting that applies to
+    /// the entire execution unit that contains the archiver implementation.
+    VIRTUAL void METHOD(EnableCPUProfiler)(THIS_
+                                           Bool Enable) CONST PURE;
+
+    /// Returns the events recorded by the CPU profiler and resets the profiler.
+
+    /// \param [out] ppTrace - Memory address where a pointer to the data blob with the
+    ///                        events in Chrome trace event JSON format will be written.
+    ///
+    /// The trace can be loaded in chrome://tracing or https://ui.perfetto.dev.
+    VIRTUAL void METHOD(GetCPUProfilerTrace)(THIS_
+                                             IDataBlob** ppTrace) CONST PURE;
 };
 DILIGENT_END_INTERFACE
 
@@ -369,6 +391,8 @@ DILIGENT_END_INTERFACE
 #    define IArchiverFactory_SetMessageCallback(This, ...)                      CALL_IFACE_METHOD(ArchiverFactory, SetMessageCallback,                     This, __VA_ARGS__)
 #    define IArchiverFactory_SetBreakOnError(This, ...)                         CALL_IFACE_METHOD(ArchiverFactory, SetBreakOnError,                        This, __VA_ARGS__)
 #    define IArchiverFactory_SetMemoryAllocator(This, ...)                      CALL_IFACE_METHOD(ArchiverFactory, SetMemoryAllocator,                     This, __VA_ARGS__)
+#    define IArchiverFactory_EnableCPUProfiler(This, ...)                       CALL_IFACE_METHOD(ArchiverFactory, EnableCPUProfiler,                      This, __VA_ARGS__)
+#    define IArchiverFactory_GetCPUProfilerTrace(This, ...)                     CALL_IFACE_METHOD(ArchiverFactory, GetCPUProfilerTrace,                    This, __VA_ARGS__)
 
 #endif
 
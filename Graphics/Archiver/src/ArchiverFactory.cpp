@@ -33,6 +33,8 @@
 #include "SerializationDeviceImpl.hpp"
 #include "EngineMemory.h"
 #include "PlatformDebug.hpp"
+#include "DataBlobImpl.hpp"
+#include "CPUZoneProfiler.hpp"
 
 namespace Diligent
 {
@@ -145,6 +147,10 @@ public:
 
     virtual void DILIGENT_CALL_TYPE SetMemoryAllocator(IMemoryAllocator* pAllocator) const override final;
 
+    virtual void DILIGENT_CALL_TYPE EnableCPUProfiler(Bool Enable) const override final;
+
+    virtual void DILIGENT_CALL_TYPE GetCPUProfilerTrace(IDataBlob** ppTrace) const override final;
+
 private:
     DummyReferenceCounters<ArchiverFactoryImpl> m_RefCounters;
 };
@@ -356,6 +362,23 @@ void ArchiverFactoryImpl::SetMemoryAllocator(IMemoryAllocator* pAllocator) const
     SetRawAllocator(pAllocator);
 }
 
+void ArchiverFactoryImpl::EnableCPUProfiler(Bool Enable) const
+{
+    CPUZoneProfiler::Enable(Enable != False);
+}
+
+void ArchiverFactoryImpl::GetCPUProfilerTrace(IDataBlob** ppTrace) const
+{
+    DEV_CHECK_ERR(ppTrace != nullptr, "ppTrace must not be null");
+    DEV_CHECK_ERR(*ppTrace == nullptr, "Overwriting reference to existing object may cause memory leaks");
+
+    const std::string Trace = CPUZoneProfiler::GetChromeTrace();
+    CPUZoneProfiler::Reset();
+
+    RefCntAutoPtr<DataBlobImpl> pTrace = DataBlobImpl::Create(Trace.length(), Trace.c_str());
+    *ppTrace = pTrace.Detach();
+}
+
 } // namespace
 
 
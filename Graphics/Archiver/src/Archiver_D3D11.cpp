@@ -137,6 +137,8 @@ void InitD3D11ShaderResourceCounters(const GraphicsPipelineStateCreateInfo& Crea
 template <typename CreateInfoType>
 void SerializedPipelineStateImpl::PatchShadersD3D11(const CreateInfoType& CreateInfo) noexcept(false)
 {
+    DILIGENT_CPU_PROFILE_ZONE("PatchShadersD3D11", "ShaderPatching");
+
     std::vector<ShaderStageInfoD3D11> ShaderStages;
     SHADER_TYPE                       ActiveShaderStages    = SHADER_TYPE_UNKNOWN;
     constexpr bool                    WaitUntilShadersReady = true;
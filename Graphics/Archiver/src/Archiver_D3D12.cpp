@@ -117,6 +117,8 @@ struct SerializedResourceSignatureImpl::SignatureTraits<PipelineResourceSignatur
 template <typename CreateInfoType>
 void SerializedPipelineStateImpl::PatchShadersD3D12(const CreateInfoType& CreateInfo) noexcept(false)
 {
+    DILIGENT_CPU_PROFILE_ZONE("PatchShadersD3D12", "ShaderPatching");
+
     std::vector<ShaderStageInfoD3D12> ShaderStages;
     SHADER_TYPE                       ActiveShaderStages    = SHADER_TYPE_UNKNOWN;
     constexpr bool                    WaitUntilShadersReady = true;
@@ -548,6 +548,8 @@ void SerializedPipelineStateImpl::PrepareDefaultSignatureGL(const CreateInfoType
 template <typename CreateInfoType>
 void SerializedPipelineStateImpl::PatchShadersGL(const CreateInfoType& CreateInfo) noexcept(false)
 {
+    DILIGENT_CPU_PROFILE_ZONE("PatchShadersGL", "ShaderPatching");
+
     std::vector<ShaderStageInfoGL> ShaderStages;
     SHADER_TYPE                    ActiveShaderStages    = SHADER_TYPE_UNKNOWN;
     constexpr bool                 WaitUntilShadersReady = true;
@@ -33,6 +33,7 @@
 #include <algorithm>
 
 #include "PSOSerializer.hpp"
+#include "CPUZoneProfiler.hpp"
 
 namespace Diligent
 {
@@ -138,6 +139,8 @@ void SerializedResourceSignatureImpl::CreateDeviceSignature(DeviceType
     VERIFY_EXPR(Type == Traits::Type || (Type == DeviceType::Metal_iOS && Traits::Type == DeviceType::Metal_MacOS));
     VERIFY(!m_pDeviceSignatures[static_cast<size_t>(Type)], "Signature for this device type has already been initialized");
 
+    DILIGENT_CPU_PROFILE_ZONE("CreateDeviceSignature", "Signature");
+
     auto  pDeviceSignature = std::make_unique<TPRS<SignatureImplType>>(GetReferenceCounters(), Desc, ShaderStages);
     auto& DeviceSignature  = *pDeviceSignature;
     // We must initialize at least one device signature before calling InitCommonData()
@@ -494,6 +494,8 @@ Uint32 GetSubpassIndex(const GraphicsPipelineStateCreateInfo& CI)
 template <typename CreateInfoType>
 void SerializedPipelineStateImpl::PatchShadersMtl(const CreateInfoType& CreateInfo, DeviceType DevType, const std::string& DumpDir) noexcept(false)
 {
+    DILIGENT_CPU_PROFILE_ZONE("PatchShadersMtl", "ShaderPatching");
+
     VERIFY_EXPR(DevType == DeviceType::Metal_MacOS || DevType == DeviceType::Metal_iOS);
 
     std::vector<ShaderStageInfoMtl> ShaderStages;
@@ -118,6 +118,8 @@ struct SerializedResourceSignatureImpl::SignatureTraits<PipelineResourceSignatur
 template <typename CreateInfoType>
 void SerializedPipelineStateImpl::PatchShadersVk(const CreateInfoType& CreateInfo) noexcept(false)
 {
+    DILIGENT_CPU_PROFILE_ZONE("PatchShadersVk", "ShaderPatching");
+
     std::vector<ShaderStageInfoVk> ShaderStages;
     SHADER_TYPE                    ActiveShaderStages    = SHADER_TYPE_UNKNOWN;
     constexpr bool                 WaitUntilShadersReady = true;
@@ -133,6 +133,8 @@ struct SerializedResourceSignatureImpl::SignatureTraits<PipelineResourceSignatur
 template <typename CreateInfoType>
 void SerializedPipelineStateImpl::PatchShadersWebGPU(const CreateInfoType& CreateInfo) noexcept(false)
 {
+    DILIGENT_CPU_PROFILE_ZONE("PatchShadersWebGPU", "ShaderPatching");
+
     std::vector<ShaderStageInfoWebGPU> ShaderStages;
     SHADER_TYPE                        ActiveShaderStages    = SHADER_TYPE_UNKNOWN;
     constexpr bool                     WaitUntilShadersReady = true;
@@ -0,0 +1,576 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+// Helper class that implements two-level segregated fit (TLSF) suballocation of a contiguous range of memory
+
+#pragma once
+
+#include <array>
+#include <vector>
+#include <unordered_map>
+#include <algorithm>
+
+#include "../../../Primitives/interface/MemoryAllocator.h"
+#include "../../../Platforms/interface/PlatformMisc.hpp"
+#include "../../../Platforms/Basic/interface/DebugUtilities.hpp"
+#include "../../../Common/interface/Align.hpp"
+#include "../../../Common/interface/STDAllocator.hpp"
+
+namespace Diligent
+{
+
+// The class implements two-level segregated fit (TLSF) suballocation strategy that performs
+// allocations and deallocations in constant time.
+//
+// Free blocks are distributed between size classes. The first level splits sizes into power-of-two
+// ranges, while the second level linearly subdivides every range into SLIndexCount classes.
+// Every size class keeps a list of free blocks, and two levels of bitmaps indicate which lists
+// are not empty:
+//
+//    FL bitmap:      0   1   1   0   1   ...
+//                        |   |       |
+//    SL bitmaps:         |   |       '-> 0 0 1 0 ... 0     [2^(fl+3), 2^(fl+4)) split into 16 classes
+//                        |   '---------> 1 0 0 0 ... 0
+//                        '-------------> 0 0 0 1 ... 0 --> Block --> Block --> ...
+//
+// To find a block for an allocation, the size is rounded up to the next size class, so that any block
+// in that class is large enough. The first non-empty class is then found using bit scan operations.
+// Every block also references its physical neighbors, which allows merging adjacent free blocks in
+// constant time when an allocation is released.
+//
+// Similar to VariableSizeAllocationsManager, the class only manages offsets and does not own any memory.
+// Unlike VariableSizeAllocationsManager, the offset returned by Allocate() is always aligned: the alignment
+// padding is returned to the free list as a separate block.
+class TLSFAllocationsManager
+{
+public:
+    using OffsetType = size_t;
+
+    struct CreateInfo
+    {
+        IMemoryAllocator& Allocator;
+        OffsetType        MaxSize = 0;
+
+        // Minimal alignment of all allocations. All offsets and sizes are multiples of this value.
+        OffsetType MinAlignment = 16;
+    };
+
+    explicit TLSFAllocationsManager(const CreateInfo& CI) :
+        // clang-format off
+        m_Blocks         {STD_ALLOCATOR_RAW_MEM(Block,  CI.Allocator, "Allocator for vector<Block>")},
+        m_UnusedBlockIds {STD_ALLOCATOR_RAW_MEM(Uint32, CI.Allocator, "Allocator for vector<Uint32>")},
+        m_AllocatedBlocks{0, std::hash<OffsetType>{}, std::equal_to<OffsetType>{}, STD_ALLOCATOR_RAW_MEM(TAllocatedBlocksMap::value_type, CI.Allocator, "Allocator for unordered_map<OffsetType, Uint32>")},
+        m_MaxSize        {CI.MaxSize     },
+        m_MinAlignment   {CI.MinAlignment}
+    // clang-format on
+    {
+        VERIFY(IsPowerOfTwo(m_MinAlignment), "Minimal alignment (", m_MinAlignment, ") must be power of 2");
+        VERIFY(m_MaxSize % m_MinAlignment == 0, "Max size (", m_MaxSize, ") must be a multiple of the minimal alignment (", m_MinAlignment, ")");
+
+        m_FreeLists.fill(InvalidBlockId);
+        m_SLBitmaps.fill(0);
+
+        if (m_MaxSize > 0)
+        {
+            m_HeadBlockId = CreateBlock(0, m_MaxSize);
+            InsertFreeBlock(m_HeadBlockId);
+            m_FreeSize = m_MaxSize;
+        }
+    }
+
+    TLSFAllocationsManager(OffsetType MaxSize, IMemoryAllocator& Allocator) :
+        TLSFAllocationsManager{CreateInfo{Allocator, MaxSize}}
+    {}
+
+    ~TLSFAllocationsManager()
+    {
+        VERIFY(m_AllocatedBlocks.empty(), "Not all allocations have been released");
+    }
+
+    // clang-format off
+    TLSFAllocationsManager(TLSFAllocationsManager&& rhs) noexcept :
+        m_Blocks         {std::move(rhs.m_Blocks)         },
+        m_UnusedBlockIds {std::move(rhs.m_UnusedBlockIds) },
+        m_AllocatedBlocks{std::move(rhs.m_AllocatedBlocks)},
+        m_FLBitmap       {rhs.m_FLBitmap      },
+        m_SLBitmaps      {rhs.m_SLBitmaps     },
+        m_FreeLists      {rhs.m_FreeLists     },
+        m_HeadBlockId    {rhs.m_HeadBlockId   },
+        m_MaxSize        {rhs.m_MaxSize       },
+        m_FreeSize       {rhs.m_FreeSize      },
+        m_MinAlignment   {rhs.m_MinAlignment  },
+        m_NumFreeBlocks  {rhs.m_NumFreeBlocks }
+    {
+        rhs.m_AllocatedBlocks.clear();
+        rhs.m_FLBitmap      = 0;
+        rhs.m_SLBitmaps.fill(0);
+        rhs.m_FreeLists.fill(InvalidBlockId);
+        rhs.m_HeadBlockId   = InvalidBlockId;
+        rhs.m_MaxSize       = 0;
+        rhs.m_FreeSize      = 0;
+        rhs.m_NumFreeBlocks = 0;
+    }
+
+    TLSFAllocationsManager& operator = (      TLSFAllocationsManager&&) = delete;
+    TLSFAllocationsManager             (const TLSFAllocationsManager&)  = delete;
+    TLSFAllocationsManager& operator = (const TLSFAllocationsManager&)  = delete;
+    // clang-format on
+
+    struct Allocation
+    {
+        // clang-format off
+        Allocation(OffsetType offset, OffsetType size) :
+            UnalignedOffset{offset},
+            Size           {size  }
+        {}
+        // clang-format on
+
+        Allocation() {}
+
+        static constexpr OffsetType InvalidOffset = ~OffsetType{0};
+        static Allocation           InvalidAllocation()
+        {
+            return Allocation{InvalidOffset, 0};
+        }
+
+        bool IsValid() const
+        {
+            return UnalignedOffset != InvalidOffset;
+        }
+
+        bool operator==(const Allocation& rhs) const noexcept
+        {
+            return UnalignedOffset == rhs.UnalignedOffset &&
+                Size == rhs.Size;
+        }
+
+        // For compatibility with VariableSizeAllocationsManager::Allocation, the offset is
+        // called "unaligned", though it is always aligned by the requested alignment.
+        OffsetType UnalignedOffset = InvalidOffset;
+        OffsetType Size            = 0;
+    };
+
+    Allocation Allocate(OffsetType Size, OffsetType Alignment)
+    {
+        VERIFY_EXPR(Size > 0);
+        VERIFY(IsPowerOfTwo(Alignment), "Alignment (", Alignment, ") must be power of 2");
+
+        Alignment = (std::max)(Alignment, m_MinAlignment);
+        Size      = AlignUp(Size, m_MinAlignment);
+
+        // All block offsets are multiples of the minimal alignment, so at most
+        // Alignment - MinAlignment bytes are required to align the offset.
+        const OffsetType SearchSize = Size + (Alignment - m_MinAlignment);
+        if (SearchSize > m_FreeSize)
+            return Allocation::InvalidAllocation();
+
+        Uint32 BlockId = FindFreeBlock(SearchSize);
+        if (BlockId == InvalidBlockId)
+            return Allocation::InvalidAllocation();
+
+        RemoveFreeBlock(BlockId);
+
+        const OffsetType AlignedOffset = AlignUp(m_Blocks[BlockId].Offset, Alignment);
+        const OffsetType Padding       = AlignedOffset - m_Blocks[BlockId].Offset;
+        VERIFY_EXPR(Padding + Size <= m_Blocks[BlockId].Size);
+        if (Padding > 0)
+        {
+            // Return the alignment padding to the free list
+            //
+            //   Block.Offset    AlignedOffset
+            //      |<-Padding->|<-------Size------->|
+            //
+            const Uint32 AlignedBlockId = SplitBlock(BlockId, Padding);
+            InsertFreeBlock(BlockId);
+            BlockId = AlignedBlockId;
+        }
+
+        if (m_Blocks[BlockId].Size > Size)
+        {
+            const Uint32 TailBlockId = SplitBlock(BlockId, Size);
+            InsertFreeBlock(TailBlockId);
+        }
+
+        Block& AllocatedBlock = m_Blocks[BlockId];
+        VERIFY_EXPR(AllocatedBlock.Offset == AlignedOffset && AllocatedBlock.Size == Size);
+        AllocatedBlock.IsFree = false;
+        m_AllocatedBlocks.emplace(AllocatedBlock.Offset, BlockId);
+
+        m_FreeSize -= Size;
+
+#ifdef DILIGENT_DEBUG
+        DbgVerifyConsistency();
+#endif
+        return Allocation{AlignedOffset, Size};
+    }
+
+    void Free(Allocation&& allocation)
+    {
+        VERIFY_EXPR(allocation.IsValid());
+        Free(allocation.UnalignedOffset, allocation.Size);
+        allocation = Allocation{};
+    }
+
+    void Free(OffsetType Offset, OffsetType Size)
+    {
+        auto it = m_AllocatedBlocks.find(Offset);
+        if (it == m_AllocatedBlocks.end())
+        {
+            UNEXPECTED("Allocation at offset ", Offset, " is not found");
+            return;
+        }
+
+        Uint32 BlockId = it->second;
+        m_AllocatedBlocks.erase(it);
+
+        VERIFY(m_Blocks[BlockId].Size == Size, "Allocation size (", Size, ") does not match the block size (", m_Blocks[BlockId].Size, ")");
+        VERIFY_EXPR(!m_Blocks[BlockId].IsFree);
+        m_Blocks[BlockId].IsFree = true;
+        m_FreeSize += m_Blocks[BlockId].Size;
+
+        // Merge with the previous block
+        //
+        //   PrevBlock.Offset             Block.Offset
+        //       |                          |
+        //       |<-----PrevBlock.Size----->|<-----Block.Size----->|
+        //
+        const Uint32 PrevBlockId = m_Blocks[BlockId].PrevPhys;
+        if (PrevBlockId != InvalidBlockId && m_Blocks[PrevBlockId].IsFree)
+        {
+            RemoveFreeBlock(PrevBlockId);
+            MergeWithNext(PrevBlockId);
+            BlockId = PrevBlockId;
+        }
+
+        // Merge with the next block
+        const Uint32 NextBlockId = m_Blocks[BlockId].NextPhys;
+        if (NextBlockId != InvalidBlockId && m_Blocks[NextBlockId].IsFree)
+        {
+            RemoveFreeBlock(NextBlockId);
+            MergeWithNext(BlockId);
+        }
+
+        InsertFreeBlock(BlockId);
+
+#ifdef DILIGENT_DEBUG
+        DbgVerifyConsistency();
+#endif
+    }
+
+    // clang-format off
+    bool       IsFull()      const { return m_FreeSize == 0;         }
+    bool       IsEmpty()     const { return m_FreeSize == m_MaxSize; }
+    OffsetType GetMaxSize()  const { return m_MaxSize;               }
+    OffsetType GetFreeSize() const { return m_FreeSize;              }
+    OffsetType GetUsedSize() const { return m_MaxSize - m_FreeSize;  }
+    // clang-format on
+
+    size_t GetNumFreeBlocks() const { return m_NumFreeBlocks; }
+    size_t GetNumAllocations() const { return m_AllocatedBlocks.size(); }
+
+    OffsetType GetMaxFreeBlockSize() const
+    {
+        if (m_FLBitmap == 0)
+            return 0;
+
+        // The largest block is in the last non-empty size class
+        const Uint32 fl = PlatformMisc::GetMSB(m_FLBitmap);
+        const Uint32 sl = PlatformMisc::GetMSB(m_SLBitmaps[fl]);
+
+        OffsetType MaxSize = 0;
+        for (Uint32 BlockId = m_FreeLists[fl * SLIndexCount + sl]; BlockId != InvalidBlockId; BlockId = m_Blocks[BlockId].NextFree)
+            MaxSize = (std::max)(MaxSize, m_Blocks[BlockId].Size);
+        return MaxSize;
+    }
+
+private:
+    static constexpr Uint32 InvalidBlockId = ~Uint32{0};
+
+    // Number of second-level size classes is 2^SLIndexLog2
+    static constexpr Uint32     SLIndexLog2    = 4;
+    static constexpr Uint32     SLIndexCount   = 1u << SLIndexLog2;
+    static constexpr OffsetType SmallBlockSize = OffsetType{1} << SLIndexLog2;
+    static constexpr Uint32     FLIndexCount   = sizeof(OffsetType) * 8 - SLIndexLog2 + 1;
+    static_assert(FLIndexCount <= 64, "First-level bitmap must fit into 64 bits");
+    static_assert(SLIndexCount <= 32, "Second-level bitmap must fit into 32 bits");
+
+    struct Block
+    {
+        OffsetType Offset = 0;
+        OffsetType Size   = 0;
+
+        // Physical neighbors
+        Uint32 PrevPhys = InvalidBlockId;
+        Uint32 NextPhys = InvalidBlockId;
+
+        // Neighbors in the free list
+        Uint32 PrevFree = InvalidBlockId;
+        Uint32 NextFree = InvalidBlockId;
+
+        bool IsFree = false;
+    };
+
+    static void MappingInsert(OffsetType Size, Uint32& fl, Uint32& sl)
+    {
+        if (Size < SmallBlockSize)
+        {
+            // Small sizes are mapped linearly to the first-level class 0
+            fl = 0;
+            sl = static_cast<Uint32>(Size);
+        }
+        else
+        {
+            const Uint32 MSB = PlatformMisc::GetMSB(Size);
+
+            sl = static_cast<Uint32>(Size >> (MSB - SLIndexLog2)) ^ SLIndexCount;
+            fl = MSB - SLIndexLog2 + 1;
+        }
+        VERIFY_EXPR(fl < FLIndexCount && sl < SLIndexCount);
+    }
+
+    Uint32 FindFreeBlock(OffsetType Size) const
+    {
+        // Round the size up to the next size class so that any block in this class is large enough
+        OffsetType RoundedSize = Size;
+        if (Size >= SmallBlockSize)
+        {
+            const OffsetType Round = (OffsetType{1} << (PlatformMisc::GetMSB(Size) - SLIndexLog2)) - 1;
+            if (Size <= ~OffsetType{0} - Round)
+                RoundedSize += Round;
+        }
+
+        Uint32 fl = 0, sl = 0;
+        MappingInsert(RoundedSize, fl, sl);
+
+        Uint32 SLMap = m_SLBitmaps[fl] & (~0u << sl);
+        if (SLMap == 0)
+        {
+            const Uint64 FLMap = (fl + 1 < 64) ? m_FLBitmap & (~Uint64{0} << (fl + 1)) : 0;
+            if (FLMap != 0)
+            {
+                fl    = PlatformMisc::GetLSB(FLMap);
+                SLMap = m_SLBitmaps[fl];
+                VERIFY_EXPR(SLMap != 0);
+            }
+        }
+
+        if (SLMap != 0)
+        {
+            sl = PlatformMisc::GetLSB(SLMap);
+            VERIFY_EXPR(m_FreeLists[fl * SLIndexCount + sl] != InvalidBlockId);
+            return m_FreeLists[fl * SLIndexCount + sl];
+        }
+
+        // There are no blocks in larger classes, but the class of the requested size itself
+        // may contain a block that is large enough. This is only possible when the allocation
+        // size is close to the size of the largest free block, so the list is usually short.
+        MappingInsert(Size, fl, sl);
+        for (Uint32 BlockId = m_FreeLists[fl * SLIndexCount + sl]; BlockId != InvalidBlockId; BlockId = m_Blocks[BlockId].NextFree)
+        {
+            if (m_Blocks[BlockId].Size >= Size)
+                return BlockId;
+        }
+
+        return InvalidBlockId;
+    }
+
+    Uint32 CreateBlock(OffsetType Offset, OffsetType Size)
+    {
+        Uint32 BlockId = InvalidBlockId;
+        if (!m_UnusedBlockIds.empty())
+        {
+            BlockId = m_UnusedBlockIds.back();
+            m_UnusedBlockIds.pop_back();
+        }
+        else
+        {
+            BlockId = static_cast<Uint32>(m_Blocks.size());
+            m_Blocks.emplace_back();
+        }
+
+        Block& NewBlock = m_Blocks[BlockId];
+        NewBlock        = Block{};
+        NewBlock.Offset = Offset;
+        NewBlock.Size   = Size;
+        return BlockId;
+    }
+
+    void InsertFreeBlock(Uint32 BlockId)
+    {
+        Block& FreeBlock = m_Blocks[BlockId];
+        FreeBlock.IsFree = true;
+
+        Uint32 fl = 0, sl = 0;
+        MappingInsert(FreeBlock.Size, fl, sl);
+
+        Uint32& ListHead   = m_FreeLists[fl * SLIndexCount + sl];
+        FreeBlock.PrevFree = InvalidBlockId;
+        FreeBlock.NextFree = ListHead;
+        if (ListHead != InvalidBlockId)
+            m_Blocks[ListHead].PrevFree = BlockId;
+        ListHead = BlockId;
+
+        m_FLBitmap |= Uint64{1} << fl;
+        m_SLBitmaps[fl] |= 1u << sl;
+
+        ++m_NumFreeBlocks;
+    }
+
+    void RemoveFreeBlock(Uint32 BlockId)
+    {
+        Block& FreeBlock = m_Blocks[BlockId];
+        VERIFY_EXPR(FreeBlock.IsFree);
+
+        Uint32 fl = 0, sl = 0;
+        MappingInsert(FreeBlock.Size, fl, sl);
+
+        if (FreeBlock.PrevFree != InvalidBlockId)
+            m_Blocks[FreeBlock.PrevFree].NextFree = FreeBlock.NextFree;
+        if (FreeBlock.NextFree != InvalidBlockId)
+            m_Blocks[FreeBlock.NextFree].PrevFree = FreeBlock.PrevFree;
+
+        Uint32& ListHead = m_FreeLists[fl * SLIndexCount + sl];
+        if (ListHead == BlockId)
+        {
+            ListHead = FreeBlock.NextFree;
+            if (ListHead == InvalidBlockId)
+            {
+                m_SLBitmaps[fl] &= ~(1u << sl);
+                if (m_SLBitmaps[fl] == 0)
+                    m_FLBitmap &= ~(Uint64{1} << fl);
+            }
+        }
+
+        FreeBlock.PrevFree = InvalidBlockId;
+        FreeBlock.NextFree = InvalidBlockId;
+        FreeBlock.IsFree   = false;
+
+        VERIFY_EXPR(m_NumFreeBlocks > 0);
+        --m_NumFreeBlocks;
+    }
+
+    // Splits the block in two. The original block keeps the first Size bytes.
+    // Returns the id of the new block that contains the rest of the original block.
+    Uint32 SplitBlock(Uint32 BlockId, OffsetType Size)
+    {
+        VERIFY_EXPR(Size > 0 && Size < m_Blocks[BlockId].Size);
+
+        // Note that CreateBlock() may invalidate references to m_Blocks elements
+        const Uint32 NewBlockId = CreateBlock(m_Blocks[BlockId].Offset + Size, m_Blocks[BlockId].Size - Size);
+
+        Block& OrigBlock = m_Blocks[BlockId];
+        Block& NewBlock  = m_Blocks[NewBlockId];
+
+        OrigBlock.Size = Size;
+
+        NewBlock.PrevPhys = BlockId;
+        NewBlock.NextPhys = OrigBlock.NextPhys;
+        if (OrigBlock.NextPhys != InvalidBlockId)
+            m_Blocks[OrigBlock.NextPhys].PrevPhys = NewBlockId;
+        OrigBlock.NextPhys = NewBlockId;
+
+        return NewBlockId;
+    }
+
+    // Merges the block with its next physical neighbor and releases the neighbor
+    void MergeWithNext(Uint32 BlockId)
+    {
+        Block&       CurrBlock   = m_Blocks[BlockId];
+        const Uint32 NextBlockId = CurrBlock.NextPhys;
+        VERIFY_EXPR(NextBlockId != InvalidBlockId);
+        Block& NextBlock = m_Blocks[NextBlockId];
+        VERIFY_EXPR(CurrBlock.Offset + CurrBlock.Size == NextBlock.Offset);
+
+        CurrBlock.Size += NextBlock.Size;
+        CurrBlock.NextPhys = NextBlock.NextPhys;
+        if (NextBlock.NextPhys != InvalidBlockId)
+            m_Blocks[NextBlock.NextPhys].PrevPhys = BlockId;
+
+        NextBlock = Block{};
+        m_UnusedBlockIds.push_back(NextBlockId);
+    }
+
+#ifdef DILIGENT_DEBUG
+    void DbgVerifyConsistency() const
+    {
+        OffsetType CurrOffset     = 0;
+        OffsetType TotalFreeSize  = 0;
+        size_t     NumFreeBlocks  = 0;
+        size_t     NumAllocations = 0;
+        bool       PrevIsFree     = false;
+        for (Uint32 BlockId = m_HeadBlockId; BlockId != InvalidBlockId; BlockId = m_Blocks[BlockId].NextPhys)
+        {
+            const Block& CurrBlock = m_Blocks[BlockId];
+            VERIFY(CurrBlock.Offset == CurrOffset, "Blocks are not contiguous");
+            VERIFY(CurrBlock.Size > 0, "Zero-size block");
+            VERIFY(!(PrevIsFree && CurrBlock.IsFree), "Two adjacent free blocks must have been merged");
+            if (CurrBlock.IsFree)
+            {
+                TotalFreeSize += CurrBlock.Size;
+                ++NumFreeBlocks;
+            }
+            else
+            {
+                ++NumAllocations;
+            }
+            PrevIsFree = CurrBlock.IsFree;
+            CurrOffset += CurrBlock.Size;
+        }
+        VERIFY(CurrOffset == m_MaxSize, "Blocks do not cover the entire range");
+        VERIFY(TotalFreeSize == m_FreeSize, "Incorrect free size");
+        VERIFY(NumFreeBlocks == m_NumFreeBlocks, "Incorrect number of free blocks");
+        VERIFY(NumAllocations == m_AllocatedBlocks.size(), "Incorrect number of allocations");
+    }
+#endif
+
+private:
+    using TAllocatedBlocksMap =
+        std::unordered_map<OffsetType,
+                           Uint32,
+                           std::hash<OffsetType>,
+                           std::equal_to<OffsetType>,
+                           STDAllocatorRawMem<std::pair<const OffsetType, Uint32>>>;
+
+    std::vector<Block, STDAllocatorRawMem<Block>>   m_Blocks;
+    std::vector<Uint32, STDAllocatorRawMem<Uint32>> m_UnusedBlockIds;
+
+    // Offset -> block id of all allocated blocks
+    TAllocatedBlocksMap m_AllocatedBlocks;
+
+    Uint64                                           m_FLBitmap = 0;
+    std::array<Uint32, FLIndexCount>                 m_SLBitmaps{};
+    std::array<Uint32, FLIndexCount * SLIndexCount> m_FreeLists{};
+
+    // The block at offset 0
+    Uint32 m_HeadBlockId = InvalidBlockId;
+
+    OffsetType m_MaxSize       = 0;
+    OffsetType m_FreeSize      = 0;
+    OffsetType m_MinAlignment  = 16;
+    size_t     m_NumFreeBlocks = 0;
+};
+
+} // namespace Diligent
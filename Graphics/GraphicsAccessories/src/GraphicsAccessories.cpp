@@ -1574,7 +1574,7 @@ const char* GetDeviceFeatureStateString(DEVICE_FEATURE_STATE State, bool bGetFul
 
 const char* GetRenderDeviceTypeString(RENDER_DEVICE_TYPE DeviceType, bool bGetEnumString)
 {
-    static_assert(RENDER_DEVICE_TYPE_COUNT == 8, "Did you add a new device type? Please update the switch below.");
+    static_assert(RENDER_DEVICE_TYPE_COUNT == 9, "Did you add a new device type? Please update the switch below.");
     switch (DeviceType)
     {
         // clang-format off
@@ -1586,6 +1586,7 @@ const char* GetRenderDeviceTypeString(RENDER_DEVICE_TYPE DeviceType, bool bGetEn
         case RENDER_DEVICE_TYPE_VULKAN:    return bGetEnumString ? "RENDER_DEVICE_TYPE_VULKAN"    : "Vulkan";     break;
         case RENDER_DEVICE_TYPE_METAL:     return bGetEnumString ? "RENDER_DEVICE_TYPE_METAL"     : "Metal";      break;
         case RENDER_DEVICE_TYPE_WEBGPU:    return bGetEnumString ? "RENDER_DEVICE_TYPE_WEBGPU"    : "WebGPU";     break;
+        case RENDER_DEVICE_TYPE_NULL:      return bGetEnumString ? "RENDER_DEVICE_TYPE_NULL"      : "Null";       break;
         // clang-format on
         default: UNEXPECTED("Unknown/unsupported device type"); return "UNKNOWN";
     }
@@ -1593,7 +1594,7 @@ const char* GetRenderDeviceTypeString(RENDER_DEVICE_TYPE DeviceType, bool bGetEn
 
 const char* GetRenderDeviceTypeShortString(RENDER_DEVICE_TYPE DeviceType, bool Capital)
 {
-    static_assert(RENDER_DEVICE_TYPE_COUNT == 8, "Did you add a new device type? Please update the switch below.");
+    static_assert(RENDER_DEVICE_TYPE_COUNT == 9, "Did you add a new device type? Please update the switch below.");
     switch (DeviceType)
     {
         // clang-format off
@@ -1605,6 +1606,7 @@ const char* GetRenderDeviceTypeShortString(RENDER_DEVICE_TYPE DeviceType, bool C
         case RENDER_DEVICE_TYPE_VULKAN:    return Capital ? "VK"        : "vk";        break;
         case RENDER_DEVICE_TYPE_METAL:     return Capital ? "MTL"       : "mtl";       break;
         case RENDER_DEVICE_TYPE_WEBGPU:    return Capital ? "WGPU"      : "wgpu";      break;
+        case RENDER_DEVICE_TYPE_NULL:      return Capital ? "NULL"      : "null";      break;
         // clang-format on
         default: UNEXPECTED("Unknown/unsupported device type"); return "UNKNOWN";
     }
@@ -1936,7 +1938,7 @@ BIND_FLAGS SwapChainUsageFlagsToBindFlags(SWAP_CHAIN_USAGE_FLAGS SwapChainUsage)
 
 ARCHIVE_DEVICE_DATA_FLAGS RenderDeviceTypeToArchiveDataFlag(RENDER_DEVICE_TYPE DevType)
 {
-    static_assert(RENDER_DEVICE_TYPE_COUNT == 8, "Please update the switch below to handle the new device type");
+    static_assert(RENDER_DEVICE_TYPE_COUNT == 9, "Please update the switch below to handle the new device type");
     switch (DevType)
     {
         case RENDER_DEVICE_TYPE_D3D11:
@@ -1967,6 +1969,10 @@ ARCHIVE_DEVICE_DATA_FLAGS RenderDeviceTypeToArchiveDataFlag(RENDER_DEVICE_TYPE D
         case RENDER_DEVICE_TYPE_WEBGPU:
             return ARCHIVE_DEVICE_DATA_FLAG_WEBGPU;
 
+        case RENDER_DEVICE_TYPE_NULL:
+            // Archives do not contain data for the null device
+            return ARCHIVE_DEVICE_DATA_FLAG_NONE;
+
         default:
             UNEXPECTED("Unexpected device type");
             return ARCHIVE_DEVICE_DATA_FLAG_NONE;
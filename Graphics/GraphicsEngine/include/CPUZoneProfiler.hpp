@@ -0,0 +1,149 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Defines the CPU zone profiler used to instrument object creation in the engine.
+
+#include <atomic>
+#include <string>
+#include <vector>
+
+#include "../../../Primitives/interface/BasicTypes.h"
+
+namespace Diligent
+{
+
+/// Lightweight CPU profiler that records scoped zones (see DILIGENT_CPU_PROFILE_ZONE).
+
+/// The profiler is disabled by default. When it is disabled, a zone only costs
+/// a relaxed atomic load. When it is enabled, every thread records completed zones into its own
+/// fixed-size ring buffer, so the oldest events are overwritten when the buffer is full.
+/// When a thread exits, its events are moved to a shared ring buffer of the same size
+/// and the memory of the thread's buffer is released.
+///
+/// The profiler is a global setting that applies to the entire execution unit
+/// (executable or shared library that contains the engine implementation).
+class CPUZoneProfiler
+{
+public:
+    /// The maximum number of events stored per thread.
+    static constexpr size_t RingBufferSize = 16384;
+
+    struct Event
+    {
+        /// Zone name. Must be a string with static storage duration.
+        const char* Name = nullptr;
+
+        /// Zone category. Must be a string with static storage duration.
+        const char* Category = nullptr;
+
+        /// Start time on the trace clock, in nanoseconds (see ChromeTraceWriter::GetTimestamp()).
+        Uint64 StartTime = 0;
+
+        /// Zone duration, in nanoseconds.
+        Uint64 Duration = 0;
+
+        /// Trace id of the thread that recorded the event (see ChromeTraceWriter::GetThreadId()).
+        Uint32 ThreadId = 0;
+    };
+
+    static void Enable(bool Enable) noexcept
+    {
+        sm_Enabled.store(Enable, std::memory_order_relaxed);
+    }
+
+    static bool IsEnabled() noexcept
+    {
+        return sm_Enabled.load(std::memory_order_relaxed);
+    }
+
+    /// Returns the current time on the trace clock, in nanoseconds.
+    static Uint64 GetTime() noexcept;
+
+    /// Records a completed zone in the calling thread's ring buffer.
+    static void RecordEvent(const char* Name, const char* Category, Uint64 StartTime, Uint64 EndTime) noexcept;
+
+    /// Returns all recorded events from all threads sorted by start time.
+    static std::vector<Event> GetEvents();
+
+    /// Returns the recorded events in Chrome trace event JSON format
+    /// that can be loaded in chrome://tracing or https://ui.perfetto.dev.
+    /// The trace is written by ChromeTraceWriter and can be merged with other engine traces.
+    static std::string GetChromeTrace();
+
+    /// Discards all recorded events.
+    static void Reset();
+
+    /// Returns the number of ring buffers of the threads that are currently alive and have recorded events.
+    static size_t GetNumThreadRingBuffers();
+
+private:
+    static std::atomic<bool> sm_Enabled;
+};
+
+/// Records the time spent in the enclosing scope when the profiler is enabled.
+class CPUProfileZone
+{
+public:
+    CPUProfileZone(const char* Name, const char* Category) noexcept
+    {
+        if (CPUZoneProfiler::IsEnabled())
+        {
+            m_Name      = Name;
+            m_Category  = Category;
+            m_StartTime = CPUZoneProfiler::GetTime();
+        }
+    }
+
+    ~CPUProfileZone()
+    {
+        if (m_Name != nullptr)
+            CPUZoneProfiler::RecordEvent(m_Name, m_Category, m_StartTime, CPUZoneProfiler::GetTime());
+    }
+
+    // clang-format off
+    CPUProfileZone           (const CPUProfileZone&)  = delete;
+    CPUProfileZone           (      CPUProfileZone&&) = delete;
+    CPUProfileZone& operator=(const CPUProfileZone&)  = delete;
+    CPUProfileZone& operator=(      CPUProfileZone&&) = delete;
+    // clang-format on
+
+private:
+    const char* m_Name      = nullptr;
+    const char* m_Category  = nullptr;
+    Uint64      m_StartTime = 0;
+};
+
+#define DILIGENT_CPU_PROFILE_ZONE_NAME0(Line) _CPUProfileZone##Line
+#define DILIGENT_CPU_PROFILE_ZONE_NAME(Line)  DILIGENT_CPU_PROFILE_ZONE_NAME0(Line)
+
+/// Profiles the enclosing scope. Name and Category must be string literals.
+#define DILIGENT_CPU_PROFILE_ZONE(Name, Category) \
+    ::Diligent::CPUProfileZone DILIGENT_CPU_PROFILE_ZONE_NAME(__LINE__) { Name, Category }
+
+} // namespace Diligent
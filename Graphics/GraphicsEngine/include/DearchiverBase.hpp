@@ -73,6 +73,12 @@ public:
     virtual void DILIGENT_CALL_TYPE UnpackPipelineState(const PipelineStateUnpackInfo& DeArchiveInfo,
                                                         IPipelineState**               ppPSO) override final;
 
+    /// Implementation of IDearchiver::UnpackPipelineStates().
+    virtual void DILIGENT_CALL_TYPE UnpackPipelineStates(const PipelineStateUnpackInfo* pUnpackInfos,
+                                                         Uint32                         NumPipelines,
+                                                         IThreadPool*                   pThreadPool,
+                                                         IPipelineState**               ppPSOs) override final;
+
     /// Implementation of IDearchiver::UnpackResourceSignature().
     virtual void DILIGENT_CALL_TYPE UnpackResourceSignature(const ResourceSignatureUnpackInfo& DeArchiveInfo,
                                                             IPipelineResourceSignature**       ppSignature) override final;
@@ -81,6 +87,14 @@ public:
     virtual void DILIGENT_CALL_TYPE UnpackRenderPass(const RenderPassUnpackInfo& DeArchiveInfo,
                                                      IRenderPass**               ppRP) override final;
 
+    /// Implementation of IDearchiver::GetDeviceData().
+    virtual void DILIGENT_CALL_TYPE GetDeviceData(RENDER_DEVICE_TYPE DeviceType,
+                                                  IDataBlob**        ppData) const override final;
+
+    /// Implementation of IDearchiver::SetDeviceData().
+    virtual void DILIGENT_CALL_TYPE SetDeviceData(RENDER_DEVICE_TYPE DeviceType,
+                                                  IDataBlob*         pData) override final;
+
     /// Implementation of IDearchiver::Store().
     virtual bool DILIGENT_CALL_TYPE Store(IDataBlob** ppArchive) const override final;
 
@@ -207,9 +221,35 @@ private:
                           PSOData<CreateInfoType>& PSO,
                           IRenderDevice*           pDevice);
 
+    RefCntAutoPtr<IShader> UnpackPSOShader(ArchiveData&   Archive,
+                                           DeviceType     DevType,
+                                           Uint32         Idx,
+                                           bool           SkipReflection,
+                                           IRenderDevice* pDevice);
+
+    // Loads the device-independent PSO data and the shader indices from the archive
+    template <typename CreateInfoType>
+    bool LoadPSOData(const PipelineStateUnpackInfo& UnpackInfo,
+                     PSOData<CreateInfoType>&       PSO,
+                     ArchiveData*&                  pArchiveData);
+
+    // Unpacks the objects the PSO depends on and creates the pipeline
+    template <typename CreateInfoType>
+    void CreatePipelineState(const PipelineStateUnpackInfo& UnpackInfo,
+                             ArchiveData&                   Archive,
+                             PSOData<CreateInfoType>&       PSO,
+                             PSO_CREATE_FLAGS               ExtraFlags,
+                             IPipelineState**               ppPSO);
+
     template <typename CreateInfoType>
     void UnpackPipelineStateImpl(const PipelineStateUnpackInfo& UnpackInfo, IPipelineState** ppPSO);
 
+    // A pipeline state unpacked by UnpackPipelineStates()
+    struct PSOBatchItem;
+
+    template <typename CreateInfoType>
+    struct TypedPSOBatchItem;
+
     ArchiveData* FindArchive(ResourceType ResType, const char* ResName);
 
 private:
@@ -219,6 +259,9 @@ private:
     std::unordered_map<NamedResourceKey, size_t, NamedResourceKey::Hasher> m_ResNameToArchiveIdx;
 
     std::vector<ArchiveData> m_Archives;
+
+    // Device-specific data set by SetDeviceData() that replaces the data of the loaded archives
+    std::array<RefCntAutoPtr<IDataBlob>, static_cast<size_t>(DeviceType::Count)> m_DeviceData;
 };
 
 
@@ -260,7 +303,7 @@ RefCntAutoPtr<IPipelineResourceSignature> DearchiverBase::UnpackResourceSignatur
     if (!Data)
         return {};
 
-    Serializer<SerializerMode::Read> Ser{Data};
+    Serializer<SerializerMode::Read> Ser{Data, SerializerArrayReadMode::ZeroCopy};
 
     bool SpecialDesc = false;
     if (!Ser(SpecialDesc))
@@ -44,7 +44,7 @@
 
 // Device object archive structure:
 //
-// | Header |  Resource Data  |  Shader Data  |
+// | Header |  Resource Data  |  Shader Data  |  Device Data  |
 //
 //     |  Resource Data  | = | Res1 | Res2 | ... | ResN |
 //
@@ -52,6 +52,8 @@
 //
 //     |  Shader Data  | =  |  OpenGL shaders | D3D11 shaders | ...  | Metal-iOS shaders |
 //
+//     |  Device Data  | =  |  OpenGL data | D3D11 data | ...  | Metal-iOS data |
+//
 // The header contains general information such as:
 // - Magic number
 // - Archive version
@@ -65,6 +67,9 @@
 //
 // Shader data contains an array of shaders for each device type
 //
+// Device data contains device-specific data that is not associated with any
+// resource (e.g. OpenGL program binaries).
+//
 //
 // For pipelines, device-specific data is the array of shader indices in the
 // archive's shader array, e.g.:
@@ -128,7 +133,7 @@ public:
     };
 
     static constexpr Uint32 HeaderMagicNumber = 0xDE00000A;
-    static constexpr Uint32 ArchiveVersion    = 10;
+    static constexpr Uint32 ArchiveVersion    = 11;
 
     struct ArchiveHeader
     {
@@ -263,7 +268,7 @@ public:
         // Use string copy from the map
         Name = it->first.GetName();
 
-        Serializer<SerializerMode::Read> Ser{it->second.Common};
+        Serializer<SerializerMode::Read> Ser{it->second.Common, SerializerArrayReadMode::ZeroCopy};
 
         auto Res = ResData.Deserialize(Name, Ser);
         VERIFY_EXPR(Ser.IsEnded());
@@ -300,6 +305,14 @@ public:
         return m_NamedResources;
     }
 
+    const SerializedData& GetDeviceData(DeviceType Type) const noexcept
+    {
+        return m_DeviceData[static_cast<size_t>(Type)];
+    }
+
+    // Makes a copy of the data
+    void SetDeviceData(DeviceType Type, const void* pData, size_t Size) noexcept(false);
+
     void Clear() noexcept;
 
 private:
@@ -309,6 +322,9 @@ private:
     // Shaders
     std::array<std::vector<SerializedData>, static_cast<size_t>(DeviceType::Count)> m_DeviceShaders;
 
+    // Device-specific data that is not associated with any resource
+    std::array<SerializedData, static_cast<size_t>(DeviceType::Count)> m_DeviceData;
+
     // Strong reference to the original data blob.
     // Resources will not make copies and reference this data.
     RefCntAutoPtr<IDataBlob> m_pArchiveData;
@@ -487,6 +487,8 @@ public:
                                                         IResourceMapping*           pResourceMapping,
                                                         BIND_SHADER_RESOURCES_FLAGS Flags) override final
     {
+        DILIGENT_CPU_PROFILE_ZONE("BindStaticResources", "SRB");
+
         const PIPELINE_TYPE PipelineType = GetPipelineType();
         for (Uint32 ShaderInd = 0; ShaderInd < m_StaticResStageIndex.size(); ++ShaderInd)
         {
@@ -515,6 +517,8 @@ public:
         }
         DEV_CHECK_ERR(*ppShaderResourceBinding == nullptr, "Overwriting existing shader resource binding pointer may cause memory leaks.");
 
+        DILIGENT_CPU_PROFILE_ZONE("CreateShaderResourceBinding", "SRB");
+
         PipelineResourceSignatureImplType* pThisImpl{static_cast<PipelineResourceSignatureImplType*>(this)};
         FixedBlockMemoryAllocator&         SRBAllocator{pThisImpl->GetDevice()->GetSRBAllocator()};
         ShaderResourceBindingImplType*     pResBindingImpl{NEW_RC_OBJ(SRBAllocator, "ShaderResourceBinding instance", ShaderResourceBindingImplType)(pThisImpl)};
@@ -535,6 +539,8 @@ public:
             return;
         }
 
+        DILIGENT_CPU_PROFILE_ZONE("InitializeStaticSRBResources", "SRB");
+
         const PipelineResourceSignatureImplType* const pThisImpl = static_cast<const PipelineResourceSignatureImplType*>(this);
 #ifdef DILIGENT_DEVELOPMENT
         {
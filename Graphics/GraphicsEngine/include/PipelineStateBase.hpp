@@ -410,7 +410,10 @@ public:
     {
         try
         {
-            ValidatePSOCreateInfo(this->GetDevice(), CreateInfo);
+            {
+                DILIGENT_CPU_PROFILE_ZONE("ValidatePSOCreateInfo", "Validation");
+                ValidatePSOCreateInfo(this->GetDevice(), CreateInfo);
+            }
 
             Uint64 DeviceQueuesMask = this->GetDevice()->GetCommandQueueMask();
             DEV_CHECK_ERR((this->m_Desc.ImmediateContextMask & DeviceQueuesMask) != 0,
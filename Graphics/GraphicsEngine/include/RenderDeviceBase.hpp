@@ -52,6 +52,7 @@
 #include "IndexWrapper.hpp"
 #include "ThreadPool.hpp"
 #include "SpinLock.hpp"
+#include "CPUZoneProfiler.hpp"
 
 namespace Diligent
 {
@@ -472,6 +473,7 @@ protected:
     template <typename PSOCreateInfoType, typename... ExtraArgsType>
     void CreatePipelineStateImpl(IPipelineState** ppPipelineState, const PSOCreateInfoType& PSOCreateInfo, const ExtraArgsType&... ExtraArgs)
     {
+        DILIGENT_CPU_PROFILE_ZONE("CreatePipelineState", "PipelineState");
         CreateDeviceObject("Pipeline State", PSOCreateInfo.PSODesc, ppPipelineState,
                            [&]() //
                            {
@@ -609,6 +611,7 @@ protected:
     template <typename... ExtraArgsType>
     void CreatePipelineResourceSignatureImpl(IPipelineResourceSignature** ppSignature, const PipelineResourceSignatureDesc& Desc, const ExtraArgsType&... ExtraArgs)
     {
+        DILIGENT_CPU_PROFILE_ZONE("CreatePipelineResourceSignature", "Signature");
         CreateDeviceObject("Pipeline Resource Signature", Desc, ppSignature,
                            [&]() //
                            {
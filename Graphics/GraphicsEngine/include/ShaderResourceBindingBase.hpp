@@ -41,9 +41,11 @@
 #include "RefCntAutoPtr.hpp"
 #include "GraphicsAccessories.hpp"
 #include "ShaderResourceCacheCommon.hpp"
+#include "ShaderResourceVariableBase.hpp"
 #include "FixedLinearAllocator.hpp"
 #include "SRBMemoryAllocator.hpp"
 #include "EngineMemory.h"
+#include "CPUZoneProfiler.hpp"
 
 namespace Diligent
 {
@@ -241,6 +243,8 @@ public:
                                                   IResourceMapping*           pResMapping,
                                                   BIND_SHADER_RESOURCES_FLAGS Flags) override final
     {
+        DILIGENT_CPU_PROFILE_ZONE("BindResources", "SRB");
+
         ProcessVariables(ShaderStages,
                          [pResMapping, Flags](ShaderVariableManagerImplType& Mgr) //
                          {
@@ -266,6 +270,21 @@ public:
         return StaleVarTypes;
     }
 
+    /// Implementation of IShaderResourceBinding::SetVariables().
+    virtual void DILIGENT_CALL_TYPE SetVariables(const ShaderVariableBinding* pBindings,
+                                                 Uint32                       NumBindings,
+                                                 SET_SHADER_RESOURCE_FLAGS    Flags) override final
+    {
+        if (NumBindings == 0)
+            return;
+
+        DILIGENT_CPU_PROFILE_ZONE("SetVariables", "SRB");
+
+        DEV_CHECK_ERR(pBindings != nullptr, "pBindings must not be null when NumBindings (", NumBindings, ") is not zero");
+        using ShaderResourceBindingImplType = typename EngineImplTraits::ShaderResourceBindingImplType;
+        static_cast<ShaderResourceBindingImplType*>(this)->BindVariables(pBindings, NumBindings, Flags);
+    }
+
     ShaderResourceCacheImplType&       GetResourceCache() { return m_ShaderResourceCache; }
     const ShaderResourceCacheImplType& GetResourceCache() const { return m_ShaderResourceCache; }
 
@@ -306,6 +325,81 @@ private:
         }
     }
 
+protected:
+    /// Returns the variable referenced by the binding, or null if the binding is invalid.
+    /// If ppVarMgr is not null, it receives the variable manager of the binding's shader stage.
+    auto GetBindingVariable(const ShaderVariableBinding&          Binding,
+                            const ShaderVariableManagerImplType** ppVarMgr = nullptr) const
+    {
+        using VariableType = decltype(m_pShaderVarMgrs[0].GetVariable(Uint32{0}));
+
+        const PIPELINE_TYPE PipelineType = GetPipelineType();
+        if (!IsConsistentShaderType(Binding.ShaderType, PipelineType))
+        {
+            DEV_ERROR("Shader stage ", GetShaderTypeLiteralName(Binding.ShaderType), " is invalid for ", GetPipelineTypeString(PipelineType),
+                      " pipeline resource signature '", m_pPRS->GetDesc().Name, "'.");
+            return VariableType{nullptr};
+        }
+
+        const int MgrInd = m_ActiveShaderStageIndex[GetShaderTypePipelineIndex(Binding.ShaderType, PipelineType)];
+        if (MgrInd < 0)
+        {
+            DEV_ERROR("Shader stage ", GetShaderTypeLiteralName(Binding.ShaderType), " has no mutable or dynamic variables in pipeline resource signature '",
+                      m_pPRS->GetDesc().Name, "'.");
+            return VariableType{nullptr};
+        }
+
+        VERIFY_EXPR(static_cast<Uint32>(MgrInd) < GetNumShaders());
+        const ShaderVariableManagerImplType& VarMgr = m_pShaderVarMgrs[MgrInd];
+        if (Binding.VariableIndex >= VarMgr.GetVariableCount())
+        {
+            DEV_ERROR("Variable index ", Binding.VariableIndex, " is out of range: shader stage ", GetShaderTypeLiteralName(Binding.ShaderType),
+                      " has only ", VarMgr.GetVariableCount(), " variables in pipeline resource signature '", m_pPRS->GetDesc().Name, "'.");
+            return VariableType{nullptr};
+        }
+
+        if (ppVarMgr != nullptr)
+            *ppVarMgr = &VarMgr;
+
+        VariableType pVar = VarMgr.GetVariable(Binding.VariableIndex);
+#ifdef DILIGENT_DEVELOPMENT
+        {
+            ShaderResourceDesc ResDesc;
+            pVar->GetResourceDesc(ResDesc);
+            DEV_CHECK_ERR(Binding.FirstElement + Binding.NumElements <= ResDesc.ArraySize,
+                          "Element range (", Binding.FirstElement, " .. ", Binding.FirstElement + Binding.NumElements - 1,
+                          ") of variable '", ResDesc.Name, "' is out of array bounds 0 .. ", ResDesc.ArraySize - 1);
+            DEV_CHECK_ERR(Binding.ppObjects != nullptr || Binding.NumElements == 0,
+                          "ppObjects must not be null for variable '", ResDesc.Name, "'");
+            DEV_CHECK_ERR((Binding.BufferOffset == 0 && Binding.BufferRange == 0) || ResDesc.Type == SHADER_RESOURCE_TYPE_CONSTANT_BUFFER,
+                          "Buffer range can only be specified for constant buffers, but variable '", ResDesc.Name, "' is ",
+                          GetShaderResourceTypeLiteralName(ResDesc.Type));
+        }
+#endif
+        return pVar;
+    }
+
+    // Binds the resources directly through the variable implementation: the bindings are validated
+    // once by GetBindingVariable(), and IShaderResourceVariable::SetArray() would check them again.
+    // Backends whose variable managers do not return the implementation type hide this method,
+    // as do the backends that can combine descriptor updates.
+    void BindVariables(const ShaderVariableBinding* pBindings,
+                       Uint32                       NumBindings,
+                       SET_SHADER_RESOURCE_FLAGS    Flags)
+    {
+        for (Uint32 i = 0; i < NumBindings; ++i)
+        {
+            const ShaderVariableBinding& Binding = pBindings[i];
+
+            auto pVar = GetBindingVariable(Binding);
+            if (pVar == nullptr)
+                continue;
+
+            for (Uint32 elem = 0; elem < Binding.NumElements; ++elem)
+                pVar->BindResource(BindResourceInfo{Binding.FirstElement + elem, Binding.ppObjects[elem], Flags, Binding.BufferOffset, Binding.BufferRange});
+        }
+    }
+
 protected:
     /// Strong reference to pipeline resource signature. We must use strong reference, because
     /// shader resource binding uses pipeline resource signature's memory allocator to allocate
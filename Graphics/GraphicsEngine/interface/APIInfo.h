@@ -30,7 +30,7 @@
 /// \file
 /// Diligent API information
 
-#define DILIGENT_API_VERSION 256020
+#define DILIGENT_API_VERSION 256035
 
 #include "../../../Primitives/interface/BasicTypes.h"
 
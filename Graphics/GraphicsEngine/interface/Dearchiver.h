@@ -272,6 +272,42 @@ DILIGENT_BEGIN_INTERFACE(IDearchiver, IObject)
                                              const PipelineStateUnpackInfo REF UnpackInfo,
                                              IPipelineState**                  ppPSO) PURE;
 
+    /// Unpacks a batch of pipeline state objects from the device object archive.
+
+    /// \param [in]  pUnpackInfos - A pointer to an array of NumPipelines pipeline state unpack infos,
+    ///                             see Diligent::PipelineStateUnpackInfo.
+    /// \param [in]  NumPipelines - The number of pipelines to unpack.
+    /// \param [in]  pThreadPool  - An optional thread pool to unpack the pipelines in. If null,
+    ///                             all work is performed by the calling thread.
+    /// \param [out] ppPSOs       - A pointer to an array of NumPipelines memory locations where
+    ///                             pointers to the unpacked pipeline state objects will be stored.
+    ///                             The function calls AddRef() for every returned object.
+    ///                             If a pipeline can't be unpacked, null is written to its location.
+    ///
+    /// \remarks    Resource signatures, render passes and shaders shared by the pipelines in
+    ///             the batch are unpacked once. The archive data is always deserialized in parallel,
+    ///             while device objects are created in parallel only when none of the devices is an
+    ///             OpenGL or WebGPU device.
+    ///
+    ///             If the same pipeline (same type and name) is requested more than once and none of
+    ///             the requests uses ModifyPipelineStateCreateInfo callback, it is unpacked only once
+    ///             and the same object is returned for every request.
+    ///
+    ///             The pipelines are created with Diligent::PSO_CREATE_FLAG_ASYNCHRONOUS flag, so when
+    ///             the device supports asynchronous shader compilation, the method may return before
+    ///             the pipelines are ready. Use IPipelineState::GetStatus() to check the pipeline status.
+    ///
+    ///             ModifyPipelineStateCreateInfo callbacks may be called from the pool threads.
+    ///
+    /// \note   This method is thread-safe. The calling thread takes part in the work and never
+    ///         waits for the tasks that have not started, so the method may also be called
+    ///         from a task running in pThreadPool.
+    VIRTUAL void METHOD(UnpackPipelineStates)(THIS_
+                                              const PipelineStateUnpackInfo* pUnpackInfos,
+                                              Uint32                         NumPipelines,
+                                              IThreadPool*                   pThreadPool,
+                                              IPipelineState**               ppPSOs) PURE;
+
     /// Unpacks resource signature from the device object archive.
 
     /// \param [in]  UnpackInfo  - Resource signature unpack info, see Diligent::ResourceSignatureUnpackInfo.
@@ -298,6 +334,33 @@ DILIGENT_BEGIN_INTERFACE(IDearchiver, IObject)
                                           const RenderPassUnpackInfo REF UnpackInfo,
                                           IRenderPass**                  ppRP) PURE;
 
+    /// Returns the device-specific data of the loaded archives.
+
+    /// \param [in]  DeviceType - Render device type.
+    /// \param [out] ppData     - Address of the memory location where the pointer to the data
+    ///                           blob will be written. If there is no data for the device type,
+    ///                           null will be written. The function calls AddRef().
+    ///
+    /// \remarks    Device-specific data is not associated with any resource, for example
+    ///             OpenGL program binaries written by IRenderDeviceGL::StoreProgramBinaries().
+    ///             If the data was set by IDearchiver::SetDeviceData(), that data is returned.
+    ///             Otherwise, the data of the first loaded archive that contains it is returned.
+    VIRTUAL void METHOD(GetDeviceData)(THIS_
+                                       enum RENDER_DEVICE_TYPE DeviceType,
+                                       IDataBlob**             ppData) CONST PURE;
+
+    /// Sets the device-specific data that will be written to the archive by IDearchiver::Store().
+
+    /// \param [in] DeviceType - Render device type.
+    /// \param [in] pData      - Device-specific data. The data replaces the data of the loaded archives.
+    ///                          If null, the data of the loaded archives is written.
+    ///
+    /// \warning    This method is not thread-safe and must not be called simultaneously
+    ///             with other methods.
+    VIRTUAL void METHOD(SetDeviceData)(THIS_
+                                       enum RENDER_DEVICE_TYPE DeviceType,
+                                       IDataBlob*              pData) PURE;
+
     /// Writes archive data to the data blob.
 
     /// \param [in] ppArchive - Memory location where a pointer to the archive data blob will be written.
@@ -329,8 +392,11 @@ DILIGENT_END_INTERFACE
 #    define IDearchiver_LoadArchive(This, ...)             CALL_IFACE_METHOD(Dearchiver, LoadArchive,             This, __VA_ARGS__)
 #    define IDearchiver_UnpackShader(This, ...)            CALL_IFACE_METHOD(Dearchiver, UnpackShader,            This, __VA_ARGS__)
 #    define IDearchiver_UnpackPipelineState(This, ...)     CALL_IFACE_METHOD(Dearchiver, UnpackPipelineState,     This, __VA_ARGS__)
+#    define IDearchiver_UnpackPipelineStates(This, ...)    CALL_IFACE_METHOD(Dearchiver, UnpackPipelineStates,    This, __VA_ARGS__)
 #    define IDearchiver_UnpackResourceSignature(This, ...) CALL_IFACE_METHOD(Dearchiver, UnpackResourceSignature, This, __VA_ARGS__)
 #    define IDearchiver_UnpackRenderPass(This, ...)        CALL_IFACE_METHOD(Dearchiver, UnpackRenderPass,        This, __VA_ARGS__)
+#    define IDearchiver_GetDeviceData(This, ...)           CALL_IFACE_METHOD(Dearchiver, GetDeviceData,           This, __VA_ARGS__)
+#    define IDearchiver_SetDeviceData(This, ...)           CALL_IFACE_METHOD(Dearchiver, SetDeviceData,           This, __VA_ARGS__)
 #    define IDearchiver_Store(This, ...)                   CALL_IFACE_METHOD(Dearchiver, Store,                   This, __VA_ARGS__)
 #    define IDearchiver_Reset(This)                        CALL_IFACE_METHOD(Dearchiver, Reset,                   This)
 #    define IDearchiver_GetContentVersion(This)            CALL_IFACE_METHOD(Dearchiver, GetContentVersion,       This)
@@ -0,0 +1,123 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Definition of the Diligent::DescriptionInternPool class.
+
+#include <memory>
+
+#include "InputLayout.h"
+#include "PipelineResourceSignature.h"
+#include "PipelineState.h"
+
+namespace Diligent
+{
+
+/// Thread-safe pool that stores a single immutable copy of equal strings and description arrays.
+
+/// Interning equal strings or arrays returns the same pointer, so interned descriptions
+/// can be compared by pointer. All strings referenced by array elements are interned as well.
+/// Interned data is owned by the pool and is never released until the pool is destroyed.
+/// Requests for the data that is already in the pool only take a shared lock and do not block
+/// each other; new data is added under the exclusive lock.
+///
+/// Unlike the C++ wrappers in GraphicsTypesX.hpp that keep a private copy of every string and
+/// array, objects that hold many similar descriptions (e.g. pipeline create infos) can
+/// keep shallow copies that point to the data in a shared pool.
+///
+/// \note Object pointers (e.g. shaders in ray-tracing shader groups) are treated as plain
+///       values: the pool does not keep references to the objects.
+class DescriptionInternPool
+{
+public:
+    DescriptionInternPool();
+    ~DescriptionInternPool();
+
+    // clang-format off
+    DescriptionInternPool           (const DescriptionInternPool&)  = delete;
+    DescriptionInternPool           (      DescriptionInternPool&&) = delete;
+    DescriptionInternPool& operator=(const DescriptionInternPool&)  = delete;
+    DescriptionInternPool& operator=(      DescriptionInternPool&&) = delete;
+    // clang-format on
+
+    /// Returns the interned copy of the string, or null if Str is null.
+    const char* GetString(const char* Str);
+
+    /// Returns the interned copy of the raw data, or null if Size is zero.
+    const void* GetData(const void* pData, size_t Size);
+
+    /// Returns the interned copy of the array, or null if Count is zero.
+    // clang-format off
+    const LayoutElement*                      GetArray(const LayoutElement*                      pElements, Uint32 Count);
+    const ShaderResourceVariableDesc*         GetArray(const ShaderResourceVariableDesc*         pElements, Uint32 Count);
+    const ImmutableSamplerDesc*               GetArray(const ImmutableSamplerDesc*               pElements, Uint32 Count);
+    const PipelineResourceDesc*               GetArray(const PipelineResourceDesc*               pElements, Uint32 Count);
+    const SpecializationConstant*             GetArray(const SpecializationConstant*             pElements, Uint32 Count);
+    const RayTracingGeneralShaderGroup*       GetArray(const RayTracingGeneralShaderGroup*       pElements, Uint32 Count);
+    const RayTracingTriangleHitShaderGroup*   GetArray(const RayTracingTriangleHitShaderGroup*   pElements, Uint32 Count);
+    const RayTracingProceduralHitShaderGroup* GetArray(const RayTracingProceduralHitShaderGroup* pElements, Uint32 Count);
+    // clang-format on
+
+    /// Returns the copy of the description whose strings and arrays are interned.
+    InputLayoutDesc               Intern(const InputLayoutDesc& Desc);
+    PipelineResourceLayoutDesc    Intern(const PipelineResourceLayoutDesc& Desc);
+    PipelineResourceSignatureDesc Intern(const PipelineResourceSignatureDesc& Desc);
+
+    /// Interning statistics.
+    struct Statistics
+    {
+        /// The number of unique strings stored in the pool.
+        size_t NumStrings = 0;
+
+        /// The number of unique arrays and data blocks stored in the pool.
+        size_t NumArrays = 0;
+
+        /// The total number of string, data and array requests.
+        Uint64 NumRequests = 0;
+
+        /// The number of requests that were satisfied by an existing entry.
+        Uint64 NumHits = 0;
+
+        /// The total size of the memory pages allocated by the pool, in bytes.
+        size_t MemorySize = 0;
+    };
+
+    /// Returns the pool statistics.
+    Statistics GetStatistics() const;
+
+    /// Returns the total size of the memory pages allocated by the pool, in bytes.
+
+    /// Unlike GetStatistics(), this method does not lock the pool.
+    size_t GetMemorySize() const;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> m_pImpl;
+};
+
+} // namespace Diligent
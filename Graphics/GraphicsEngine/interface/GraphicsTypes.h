@@ -1614,6 +1614,7 @@ enum RENDER_DEVICE_TYPE
     RENDER_DEVICE_TYPE_VULKAN,         ///< Vulkan device
     RENDER_DEVICE_TYPE_METAL,          ///< Metal device
     RENDER_DEVICE_TYPE_WEBGPU,         ///< WebGPU device
+    RENDER_DEVICE_TYPE_NULL,           ///< Null device that does not use any graphics API
     RENDER_DEVICE_TYPE_COUNT           ///< The total number of device types
 };
 
@@ -2581,6 +2582,10 @@ struct RenderDeviceInfo
     {
         return Type == RENDER_DEVICE_TYPE_WEBGPU;
     }
+    constexpr bool IsNullDevice() const
+    {
+        return Type == RENDER_DEVICE_TYPE_NULL;
+    }
 
     // for backward compatibility
     const NDCAttribs& GetNDCAttribs()const
@@ -3687,6 +3692,36 @@ struct EngineGLCreateInfo DILIGENT_DERIVE(EngineCreateInfo)
     /// * On Linux this affects the `DRI_PRIME` environment variable that is used by Mesa drivers that support PRIME.
     ADAPTER_TYPE PreferredAdapterType DEFAULT_INITIALIZER(ADAPTER_TYPE_UNKNOWN);
 
+    /// Whether to enable the program binary cache.
+
+    /// When the cache is enabled, the engine retrieves the binaries of linked programs using
+    /// `glGetProgramBinary` and creates new programs from the binaries using `glProgramBinary`
+    /// instead of linking them from source, if possible. Binaries can be saved and loaded using
+    /// IRenderDeviceGL::StoreProgramBinaries() and IRenderDeviceGL::LoadProgramBinaries(). The render
+    /// state cache does this automatically.
+    ///
+    /// \remarks  The cache is not available in WebGL and on devices that do not support any program binary formats.
+    Bool EnableProgramBinaryCache DEFAULT_INITIALIZER(False);
+
+    /// The size of the dynamic heap, in bytes.
+
+    /// On OpenGL 4.4+ and on devices that support `GL_ARB_buffer_storage`, the space for
+    /// dynamic uniform buffers (Diligent::USAGE_DYNAMIC buffers with Diligent::BIND_UNIFORM_BUFFER
+    /// bind flag only) is allocated from a persistently mapped ring buffer. Mapping such
+    /// a buffer does not require a driver call, and the buffer is bound at the offset of
+    /// the current allocation. Space is recycled when the GPU finishes the frame that used it,
+    /// see IDeviceContext::FinishFrame().
+    ///
+    /// Buffers allocated from the heap do not have their own GL buffer objects:
+    /// IBufferGL::GetGLBufferHandle() returns the handle of the heap buffer that is shared
+    /// by all such buffers, and the buffer data is located at an offset that changes every time
+    /// the buffer is mapped. Applications that access dynamic uniform buffers through their
+    /// GL handles must not enable the heap.
+    ///
+    /// The heap is disabled by default (the size is 0). In this case, dynamic buffers
+    /// are mapped using `glMapBufferRange`. A typical size is a few megabytes.
+    Uint32 DynamicHeapSize DEFAULT_INITIALIZER(0);
+
 #if PLATFORM_WEB
     /// WebGL context attributes.
     WebGLContextAttribs WebGLAttribs;
@@ -4201,6 +4236,19 @@ struct EngineVkCreateInfo DILIGENT_DERIVE(EngineCreateInfo)
     ///   DynamicHeapPageSize.
     Uint32 DynamicHeapPageSize              DEFAULT_INITIALIZER(256 << 10);
 
+    /// Size of the staging memory batch used to upload initial data of buffers and textures.
+    ///
+    /// When a buffer or a texture is created with initial data that must be copied through
+    /// the staging memory, the data is suballocated from the current batch of the command
+    /// queue, and copy commands are recorded into the batch command buffer. The batch is
+    /// submitted when the total size of its data reaches InitialDataUploadBatchSize,
+    /// when IRenderDeviceVk::FlushInitialDataUploads() is called, or before any other command
+    /// buffer is submitted to the same queue.
+    ///
+    /// Zero value (the default) disables batching: every resource uses a dedicated staging
+    /// buffer and a dedicated command buffer that are submitted immediately.
+    Uint32 InitialDataUploadBatchSize       DEFAULT_INITIALIZER(0);
+
     /// Query pool size for each query type.
     ///
     /// In Vulkan, queries are allocated from the pool, and
@@ -4312,6 +4360,18 @@ struct EngineWebGPUCreateInfo DILIGENT_DERIVE(EngineCreateInfo)
     /// the global dynamic heap to perform lock-free dynamic suballocations.
     Uint32 DynamicHeapPageSize DEFAULT_INITIALIZER(256 << 10);
 
+    /// Whether to write upload and dynamic data directly to mapped staging buffers.
+
+    /// By default, the data is first written to CPU memory and is then copied to the GPU
+    /// with `wgpuQueueWriteBuffer` when the context is flushed.
+    /// When this option is enabled, upload heap pages are staging buffers that are mapped at creation
+    /// and are mapped again asynchronously when the GPU is done with them, and the data is written
+    /// directly to the mapped memory. Dynamic heap pages are backed by the upload heap pages, and copies
+    /// to the dynamic buffer are batched into a single command buffer that is submitted with the context commands.
+    ///
+    /// \note  The option is ignored on the Web.
+    Bool UseMappedUploadMemory DEFAULT_INITIALIZER(False);
+
     /// Query pool size for each query type.
     Uint32 QueryPoolSizes[QUERY_TYPE_NUM_TYPES]
 #if DILIGENT_CPP_INTERFACE
@@ -45,6 +45,53 @@ static DILIGENT_CONSTEXPR INTERFACE_ID IID_ShaderResourceBinding =
     {0x61f8774, 0x9a09, 0x48e8, {0x84, 0x11, 0xb5, 0xbd, 0x20, 0x56, 0x1, 0x4}};
 
 
+/// Describes a range of array elements of a shader variable set by IShaderResourceBinding::SetVariables().
+struct ShaderVariableBinding
+{
+    /// Type of the shader that contains the variable.
+    /// Must be one of Diligent::SHADER_TYPE.
+    SHADER_TYPE ShaderType DEFAULT_INITIALIZER(SHADER_TYPE_UNKNOWN);
+
+    /// Variable index in the shader stage, see IShaderResourceBinding::GetVariableByIndex().
+    Uint32 VariableIndex DEFAULT_INITIALIZER(0);
+
+    /// The first array element to set.
+    Uint32 FirstElement DEFAULT_INITIALIZER(0);
+
+    /// The number of array elements to set.
+    Uint32 NumElements DEFAULT_INITIALIZER(1);
+
+    /// Pointer to the array of NumElements objects to bind.
+    /// Null elements reset the corresponding array elements.
+    IDeviceObject* const* ppObjects DEFAULT_INITIALIZER(nullptr);
+
+    /// For constant buffers only: offset, in bytes, to the start of the buffer range to bind.
+    /// The offset is applied to all elements, see IShaderResourceVariable::SetBufferRange().
+    Uint64 BufferOffset DEFAULT_INITIALIZER(0);
+
+    /// For constant buffers only: size, in bytes, of the buffer range to bind.
+    /// If BufferOffset and BufferRange are both zero, the entire buffer is bound.
+    Uint64 BufferRange DEFAULT_INITIALIZER(0);
+
+#if DILIGENT_CPP_INTERFACE
+    constexpr ShaderVariableBinding() noexcept {}
+
+    constexpr ShaderVariableBinding(SHADER_TYPE           _ShaderType,
+                                    Uint32                _VariableIndex,
+                                    IDeviceObject* const* _ppObjects,
+                                    Uint32                _FirstElement = ShaderVariableBinding{}.FirstElement,
+                                    Uint32                _NumElements  = ShaderVariableBinding{}.NumElements) noexcept :
+        ShaderType   {_ShaderType   },
+        VariableIndex{_VariableIndex},
+        FirstElement {_FirstElement },
+        NumElements  {_NumElements  },
+        ppObjects    {_ppObjects    }
+    {}
+#endif
+};
+typedef struct ShaderVariableBinding ShaderVariableBinding;
+
+
 #define DILIGENT_INTERFACE_NAME IShaderResourceBinding
 #include "../../../Primitives/interface/DefineInterfaceHelperMacros.h"
 
@@ -154,6 +201,27 @@ DILIGENT_BEGIN_INTERFACE(IShaderResourceBinding, IObject)
 
     /// Returns true if static resources have been initialized in this SRB.
     VIRTUAL Bool METHOD(StaticResourcesInitialized)(THIS) CONST PURE;
+
+
+    /// Binds resources to multiple variables in a single call.
+
+    /// \param [in] pBindings   - Pointer to the array of NumBindings variable bindings,
+    ///                           see Diligent::ShaderVariableBinding.
+    /// \param [in] NumBindings - The number of elements in pBindings array.
+    /// \param [in] Flags       - Flags, see Diligent::SET_SHADER_RESOURCE_FLAGS.
+    ///
+    /// The method is equivalent to calling IShaderResourceVariable::SetArray() or
+    /// IShaderResourceVariable::SetBufferRange() for every binding, but the bindings are validated
+    /// once, and the backend may combine descriptor updates (for instance, in Vulkan, all
+    /// descriptor writes are issued by a single vkUpdateDescriptorSets call, and consecutive array
+    /// elements are written by a single VkWriteDescriptorSet).
+    ///
+    /// \note  Variable indices are obtained from IShaderResourceBinding::GetVariableByIndex() and
+    ///        never change, so a material may build the array of bindings once and reuse it.
+    VIRTUAL void METHOD(SetVariables)(THIS_
+                                      const ShaderVariableBinding* pBindings,
+                                      Uint32                       NumBindings,
+                                      SET_SHADER_RESOURCE_FLAGS    Flags DEFAULT_VALUE(SET_SHADER_RESOURCE_FLAG_NONE)) PURE;
 };
 DILIGENT_END_INTERFACE
 
@@ -170,6 +238,7 @@ DILIGENT_END_INTERFACE
 #    define IShaderResourceBinding_GetVariableCount(This, ...)        CALL_IFACE_METHOD(ShaderResourceBinding, GetVariableCount,             This, __VA_ARGS__)
 #    define IShaderResourceBinding_GetVariableByIndex(This, ...)      CALL_IFACE_METHOD(ShaderResourceBinding, GetVariableByIndex,           This, __VA_ARGS__)
 #    define IShaderResourceBinding_StaticResourcesInitialized(This)   CALL_IFACE_METHOD(ShaderResourceBinding, StaticResourcesInitialized,   This)
+#    define IShaderResourceBinding_SetVariables(This, ...)            CALL_IFACE_METHOD(ShaderResourceBinding, SetVariables,                 This, __VA_ARGS__)
 
 // clang-format on
 
@@ -0,0 +1,243 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "CPUZoneProfiler.hpp"
+
+#include <algorithm>
+#include <array>
+#include <deque>
+#include <memory>
+#include <mutex>
+
+#include "ChromeTraceWriter.hpp"
+#include "SpinLock.hpp"
+#include "DebugUtilities.hpp"
+
+namespace Diligent
+{
+
+std::atomic<bool> CPUZoneProfiler::sm_Enabled{false};
+
+namespace
+{
+
+// Events recorded by a single thread. Only the owning thread writes to the buffer,
+// so the lock is only contended while the events are read.
+struct ThreadRingBuffer
+{
+    explicit ThreadRingBuffer(Uint32 _ThreadId) :
+        ThreadId{_ThreadId}
+    {}
+
+    const Uint32 ThreadId;
+
+    Threading::SpinLock Lock;
+
+    std::array<CPUZoneProfiler::Event, CPUZoneProfiler::RingBufferSize> Events;
+
+    // The total number of events recorded since the last reset.
+    size_t NumRecorded = 0;
+
+    template <typename HandlerType>
+    void ProcessEvents(HandlerType&& Handler) const
+    {
+        const size_t NumEvents = std::min(NumRecorded, CPUZoneProfiler::RingBufferSize);
+        // Process events in the order they were recorded
+        for (size_t i = NumRecorded - NumEvents; i < NumRecorded; ++i)
+            Handler(Events[i % CPUZoneProfiler::RingBufferSize]);
+    }
+};
+
+class ThreadRingBufferRegistry
+{
+public:
+    static ThreadRingBufferRegistry& Get()
+    {
+        static ThreadRingBufferRegistry Registry;
+        return Registry;
+    }
+
+    ThreadRingBuffer* CreateBuffer()
+    {
+        std::lock_guard<std::mutex> Guard{m_Mtx};
+        m_Buffers.emplace_back(std::make_unique<ThreadRingBuffer>(ChromeTraceWriter::GetThreadId()));
+        return m_Buffers.back().get();
+    }
+
+    // Called when the thread that owns the buffer exits. The events are moved to the
+    // shared ring of retired events, so that the memory of the buffer can be released
+    // while the events are not lost.
+    void RetireBuffer(ThreadRingBuffer* pBuffer)
+    {
+        std::lock_guard<std::mutex> Guard{m_Mtx};
+
+        auto it = std::find_if(m_Buffers.begin(), m_Buffers.end(),
+                               [pBuffer](const std::unique_ptr<ThreadRingBuffer>& pBuff) { return pBuff.get() == pBuffer; });
+        if (it == m_Buffers.end())
+        {
+            UNEXPECTED("Ring buffer is not found in the registry");
+            return;
+        }
+
+        {
+            Threading::SpinLockGuard BufferGuard{pBuffer->Lock};
+            pBuffer->ProcessEvents([this](const CPUZoneProfiler::Event& Evt) {
+                m_RetiredEvents.push_back(Evt);
+            });
+        }
+        while (m_RetiredEvents.size() > CPUZoneProfiler::RingBufferSize)
+            m_RetiredEvents.pop_front();
+
+        m_Buffers.erase(it);
+    }
+
+    template <typename HandlerType>
+    void ProcessEvents(HandlerType&& Handler)
+    {
+        std::lock_guard<std::mutex> Guard{m_Mtx};
+        for (const CPUZoneProfiler::Event& Evt : m_RetiredEvents)
+            Handler(Evt);
+        for (std::unique_ptr<ThreadRingBuffer>& pBuffer : m_Buffers)
+        {
+            Threading::SpinLockGuard BufferGuard{pBuffer->Lock};
+            pBuffer->ProcessEvents(Handler);
+        }
+    }
+
+    void Reset()
+    {
+        std::lock_guard<std::mutex> Guard{m_Mtx};
+        m_RetiredEvents.clear();
+        for (std::unique_ptr<ThreadRingBuffer>& pBuffer : m_Buffers)
+        {
+            Threading::SpinLockGuard BufferGuard{pBuffer->Lock};
+            pBuffer->NumRecorded = 0;
+        }
+    }
+
+    size_t GetNumBuffers()
+    {
+        std::lock_guard<std::mutex> Guard{m_Mtx};
+        return m_Buffers.size();
+    }
+
+private:
+    std::mutex                                     m_Mtx;
+    std::vector<std::unique_ptr<ThreadRingBuffer>> m_Buffers;
+
+    // Events of the threads that have exited, oldest first.
+    // The number of events is limited by the ring buffer size.
+    std::deque<CPUZoneProfiler::Event> m_RetiredEvents;
+};
+
+// Retires the ring buffer of the thread when the thread exits.
+// Objects with thread storage duration are destroyed before the registry.
+class ThreadRingBufferHolder
+{
+public:
+    ThreadRingBufferHolder() :
+        m_pBuffer{ThreadRingBufferRegistry::Get().CreateBuffer()}
+    {}
+
+    ~ThreadRingBufferHolder()
+    {
+        ThreadRingBufferRegistry::Get().RetireBuffer(m_pBuffer);
+    }
+
+    // clang-format off
+    ThreadRingBufferHolder           (const ThreadRingBufferHolder&)  = delete;
+    ThreadRingBufferHolder           (      ThreadRingBufferHolder&&) = delete;
+    ThreadRingBufferHolder& operator=(const ThreadRingBufferHolder&)  = delete;
+    ThreadRingBufferHolder& operator=(      ThreadRingBufferHolder&&) = delete;
+    // clang-format on
+
+    ThreadRingBuffer& GetBuffer() const { return *m_pBuffer; }
+
+private:
+    ThreadRingBuffer* const m_pBuffer;
+};
+
+ThreadRingBuffer& GetThreadRingBuffer()
+{
+    thread_local ThreadRingBufferHolder Holder;
+    return Holder.GetBuffer();
+}
+
+} // namespace
+
+Uint64 CPUZoneProfiler::GetTime() noexcept
+{
+    return ChromeTraceWriter::GetTimestamp();
+}
+
+void CPUZoneProfiler::RecordEvent(const char* Name, const char* Category, Uint64 StartTime, Uint64 EndTime) noexcept
+{
+    ThreadRingBuffer& Buffer = GetThreadRingBuffer();
+
+    Threading::SpinLockGuard Guard{Buffer.Lock};
+
+    Event& Evt{Buffer.Events[Buffer.NumRecorded % RingBufferSize]};
+    Evt.Name      = Name;
+    Evt.Category  = Category;
+    Evt.StartTime = StartTime;
+    Evt.Duration  = EndTime - StartTime;
+    Evt.ThreadId  = Buffer.ThreadId;
+    ++Buffer.NumRecorded;
+}
+
+std::vector<CPUZoneProfiler::Event> CPUZoneProfiler::GetEvents()
+{
+    std::vector<Event> Events;
+    ThreadRingBufferRegistry::Get().ProcessEvents([&Events](const Event& Evt) {
+        Events.push_back(Evt);
+    });
+
+    std::stable_sort(Events.begin(), Events.end(), [](const Event& E0, const Event& E1) {
+        return E0.StartTime < E1.StartTime;
+    });
+    return Events;
+}
+
+std::string CPUZoneProfiler::GetChromeTrace()
+{
+    ChromeTraceWriter Writer;
+    Writer.AddProcessName(ChromeTraceWriter::CPUProcessId, "CPU");
+    for (const Event& Evt : GetEvents())
+        Writer.AddCompleteEvent(Evt.Name, Evt.Category, ChromeTraceWriter::CPUProcessId, Evt.ThreadId, Evt.StartTime, Evt.Duration);
+    return Writer.Finish();
+}
+
+void CPUZoneProfiler::Reset()
+{
+    ThreadRingBufferRegistry::Get().Reset();
+}
+
+size_t CPUZoneProfiler::GetNumThreadRingBuffers()
+{
+    return ThreadRingBufferRegistry::Get().GetNumBuffers();
+}
+
+} // namespace Diligent
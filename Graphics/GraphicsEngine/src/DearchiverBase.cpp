@@ -25,8 +25,16 @@
  */
 
 #include "DearchiverBase.hpp"
+
+#include <set>
+#include <tuple>
+#include <unordered_map>
+#include <unordered_set>
+
 #include "PipelineStateBase.hpp"
 #include "PSOSerializer.hpp"
+#include "ThreadPool.hpp"
+#include "DataBlobImpl.hpp"
 
 namespace Diligent
 {
@@ -111,6 +119,8 @@ struct DearchiverBase::PSOData
     TPRSNames              PRSNames{};
     const char*            RenderPassName = nullptr;
 
+    DeviceObjectArchive::ShaderIndexArray ShaderIndices;
+
     // Strong references to pipeline resource signatures, render pass, etc.
     std::vector<RefCntAutoPtr<IDeviceObject>> Objects;
     std::vector<RefCntAutoPtr<IShader>>       Shaders;
@@ -122,6 +132,7 @@ struct DearchiverBase::PSOData
     {}
 
     bool Deserialize(const char* Name, Serializer<SerializerMode::Read>& Ser);
+    bool LoadShaderIndices(const DeviceObjectArchive& ObjArchive, DeviceType DevType);
     void AssignShaders();
     void CreatePipeline(IRenderDevice* pDevice, IPipelineState** ppPSO);
 
@@ -239,6 +250,24 @@ bool DearchiverBase::PSOData<CreateInfoType>::Deserialize(const char* Name, Seri
     return true;
 }
 
+template <typename CreateInfoType>
+bool DearchiverBase::PSOData<CreateInfoType>::LoadShaderIndices(const DeviceObjectArchive& ObjArchive, DeviceType DevType)
+{
+    const SerializedData& ShaderIdxData = ObjArchive.GetDeviceSpecificData(ArchiveResType, CreateInfo.PSODesc.Name, DevType);
+    if (!ShaderIdxData)
+        return false;
+
+    Serializer<SerializerMode::Read> Ser{ShaderIdxData, SerializerArrayReadMode::ZeroCopy};
+    if (!PSOSerializer<SerializerMode::Read>::SerializeShaderIndices(Ser, ShaderIndices, &Allocator))
+    {
+        LOG_ERROR_MESSAGE("Failed to deserialize PSO shader indices. Archive file may be corrupted or invalid.");
+        return false;
+    }
+    VERIFY(Ser.IsEnded(), "No other data besides shader indices is expected");
+
+    return true;
+}
+
 template <>
 const DearchiverBase::ResourceType DearchiverBase::PSOData<GraphicsPipelineStateCreateInfo>::ArchiveResType = DearchiverBase::ResourceType::GraphicsPipeline;
 template <>
@@ -404,82 +433,74 @@ void DearchiverBase::PSOData<RayTracingPipelineStateCreateInfo>::CreatePipeline(
     pDevice->CreateRayTracingPipelineState(CreateInfo, ppPSO);
 }
 
-template <typename CreateInfoType>
-bool DearchiverBase::UnpackPSOShaders(ArchiveData&             Archive,
-                                      PSOData<CreateInfoType>& PSO,
-                                      IRenderDevice*           pDevice)
+RefCntAutoPtr<IShader> DearchiverBase::UnpackPSOShader(ArchiveData&   Archive,
+                                                       DeviceType     DevType,
+                                                       Uint32         Idx,
+                                                       bool           SkipReflection,
+                                                       IRenderDevice* pDevice)
 {
-    const auto& pObjArchive = Archive.pObjArchive;
-    VERIFY_EXPR(pObjArchive);
-    const DeviceType      DevType       = GetArchiveDeviceType(pDevice);
-    const SerializedData& ShaderIdxData = pObjArchive->GetDeviceSpecificData(PSO.ArchiveResType, PSO.CreateInfo.PSODesc.Name, DevType);
-    if (!ShaderIdxData)
-        return false;
-
-    DynamicLinearAllocator Allocator{GetRawAllocator()};
+    ShaderCacheData& ShaderCache = Archive.CachedShaders[static_cast<size_t>(DevType)];
 
-    DeviceObjectArchive::ShaderIndexArray ShaderIndices;
     {
-        Serializer<SerializerMode::Read> Ser{ShaderIdxData};
-        if (!PSOSerializer<SerializerMode::Read>::SerializeShaderIndices(Ser, ShaderIndices, &Allocator))
+        std::unique_lock<std::mutex> ReadLock{ShaderCache.Mtx};
+        if (Idx < ShaderCache.Shaders.size())
         {
-            LOG_ERROR_MESSAGE("Failed to deserialize PSO shader indices. Archive file may be corrupted or invalid.");
-            return false;
+            // Try to get cached shader
+            if (RefCntAutoPtr<IShader> pShader = ShaderCache.Shaders[Idx])
+                return pShader;
         }
-        VERIFY(Ser.IsEnded(), "No other data besides shader indices is expected");
     }
 
-    ShaderCacheData& ShaderCache = Archive.CachedShaders[static_cast<size_t>(DevType)];
+    const SerializedData& SerializedShader = Archive.pObjArchive->GetSerializedShader(DevType, Idx);
+    if (!SerializedShader)
+        return {};
 
-    PSO.Shaders.resize(ShaderIndices.Count);
-    for (Uint32 i = 0; i < ShaderIndices.Count; ++i)
+    RefCntAutoPtr<IShader> pShader;
     {
-        RefCntAutoPtr<IShader>& pShader{PSO.Shaders[i]};
-
-        const Uint32 Idx = ShaderIndices.pIndices[i];
-
+        ShaderCreateInfo ShaderCI;
         {
-            std::unique_lock<std::mutex> ReadLock{ShaderCache.Mtx};
-            if (Idx < ShaderCache.Shaders.size())
+            Serializer<SerializerMode::Read> ShaderSer{SerializedShader};
+            if (!ShaderSerializer<SerializerMode::Read>::SerializeCI(ShaderSer, ShaderCI))
             {
-                // Try to get cached shader
-                pShader = ShaderCache.Shaders[Idx];
-                if (pShader)
-                    continue;
+                LOG_ERROR_MESSAGE("Failed to deserialize shader create info. Archive file may be corrupted or invalid.");
+                return {};
             }
+            VERIFY_EXPR(ShaderSer.IsEnded());
         }
 
-        const SerializedData& SerializedShader = pObjArchive->GetSerializedShader(DevType, Idx);
-        if (!SerializedShader)
-            return false;
+        if (SkipReflection)
+            ShaderCI.CompileFlags |= SHADER_COMPILE_FLAG_SKIP_REFLECTION;
 
-        {
-            ShaderCreateInfo ShaderCI;
-            {
-                Serializer<SerializerMode::Read> ShaderSer{SerializedShader};
-                if (!ShaderSerializer<SerializerMode::Read>::SerializeCI(ShaderSer, ShaderCI))
-                {
-                    LOG_ERROR_MESSAGE("Failed to deserialize shader create info. Archive file may be corrupted or invalid.");
-                    return false;
-                }
-                VERIFY_EXPR(ShaderSer.IsEnded());
-            }
+        pShader = UnpackShader(ShaderCI, pDevice);
+        if (!pShader)
+            return {};
+    }
 
-            if ((PSO.InternalCI.Flags & PSO_CREATE_INTERNAL_FLAG_NO_SHADER_REFLECTION) != 0)
-                ShaderCI.CompileFlags |= SHADER_COMPILE_FLAG_SKIP_REFLECTION;
+    // Add to the cache
+    {
+        std::unique_lock<std::mutex> WriteLock{ShaderCache.Mtx};
+        if (Idx >= ShaderCache.Shaders.size())
+            ShaderCache.Shaders.resize(size_t{Idx} + 1);
+        ShaderCache.Shaders[Idx] = pShader;
+    }
 
-            pShader = UnpackShader(ShaderCI, pDevice);
-            if (!pShader)
-                return false;
-        }
+    return pShader;
+}
 
-        // Add to the cache
-        {
-            std::unique_lock<std::mutex> WriteLock{ShaderCache.Mtx};
-            if (Idx >= ShaderCache.Shaders.size())
-                ShaderCache.Shaders.resize(size_t{Idx} + 1);
-            ShaderCache.Shaders[Idx] = pShader;
-        }
+template <typename CreateInfoType>
+bool DearchiverBase::UnpackPSOShaders(ArchiveData&             Archive,
+                                      PSOData<CreateInfoType>& PSO,
+                                      IRenderDevice*           pDevice)
+{
+    const DeviceType DevType        = GetArchiveDeviceType(pDevice);
+    const bool       SkipReflection = (PSO.InternalCI.Flags & PSO_CREATE_INTERNAL_FLAG_NO_SHADER_REFLECTION) != 0;
+
+    PSO.Shaders.resize(PSO.ShaderIndices.Count);
+    for (Uint32 i = 0; i < PSO.ShaderIndices.Count; ++i)
+    {
+        PSO.Shaders[i] = UnpackPSOShader(Archive, DevType, PSO.ShaderIndices.pIndices[i], SkipReflection, pDevice);
+        if (!PSO.Shaders[i])
+            return false;
     }
 
     return true;
@@ -590,30 +611,21 @@ static bool ModifyPipelineStateCreateInfo(PSOCreateInfoType&             CreateI
 }
 
 template <typename CreateInfoType>
-void DearchiverBase::UnpackPipelineStateImpl(const PipelineStateUnpackInfo& UnpackInfo,
-                                             IPipelineState**               ppPSO)
+bool DearchiverBase::LoadPSOData(const PipelineStateUnpackInfo& UnpackInfo,
+                                 PSOData<CreateInfoType>&       PSO,
+                                 ArchiveData*&                  pArchiveData)
 {
     VERIFY_EXPR(UnpackInfo.pDevice != nullptr);
 
     constexpr auto ResType = PSOData<CreateInfoType>::ArchiveResType;
 
-    // Do not cache modified PSOs
-    if (UnpackInfo.ModifyPipelineStateCreateInfo == nullptr)
-    {
-        // Since PSO names must be unique (for each PSO type), we use a single cache for all
-        // loaded archives.
-        if (m_Cache.PSO.Get(ResType, UnpackInfo.Name, ppPSO))
-            return;
-    }
-
     // Find the archive that contains this PSO
-    ArchiveData* pArchiveData = FindArchive(ResType, UnpackInfo.Name);
+    pArchiveData = FindArchive(ResType, UnpackInfo.Name);
     if (pArchiveData == nullptr)
-        return;
+        return false;
 
-    PSOData<CreateInfoType> PSO{GetRawAllocator()};
     if (!pArchiveData->pObjArchive->LoadResourceCommonData(ResType, UnpackInfo.Name, PSO))
-        return;
+        return false;
 
 #ifdef DILIGENT_DEVELOPMENT
     if (UnpackInfo.pDevice->GetDeviceInfo().IsD3DDevice())
@@ -624,13 +636,23 @@ void DearchiverBase::UnpackPipelineStateImpl(const PipelineStateUnpackInfo& Unpa
     }
 #endif
 
+    return PSO.LoadShaderIndices(*pArchiveData->pObjArchive, GetArchiveDeviceType(UnpackInfo.pDevice));
+}
+
+template <typename CreateInfoType>
+void DearchiverBase::CreatePipelineState(const PipelineStateUnpackInfo& UnpackInfo,
+                                         ArchiveData&                   Archive,
+                                         PSOData<CreateInfoType>&       PSO,
+                                         PSO_CREATE_FLAGS               ExtraFlags,
+                                         IPipelineState**               ppPSO)
+{
     if (!UnpackPSORenderPass(PSO, UnpackInfo.pDevice))
         return;
 
     if (!UnpackPSOSignatures(PSO, UnpackInfo.pDevice))
         return;
 
-    if (!UnpackPSOShaders(*pArchiveData, PSO, UnpackInfo.pDevice))
+    if (!UnpackPSOShaders(Archive, PSO, UnpackInfo.pDevice))
         return;
 
     PSO.AssignShaders();
@@ -638,14 +660,44 @@ void DearchiverBase::UnpackPipelineStateImpl(const PipelineStateUnpackInfo& Unpa
     PSO.CreateInfo.PSODesc.SRBAllocationGranularity = UnpackInfo.SRBAllocationGranularity;
     PSO.CreateInfo.PSODesc.ImmediateContextMask     = UnpackInfo.ImmediateContextMask;
     PSO.CreateInfo.pPSOCache                        = UnpackInfo.pCache;
+    PSO.CreateInfo.Flags |= ExtraFlags;
 
     if (!ModifyPipelineStateCreateInfo(PSO.CreateInfo, UnpackInfo))
         return;
 
     PSO.CreatePipeline(UnpackInfo.pDevice, ppPSO);
 
+    if (UnpackInfo.ModifyPipelineStateCreateInfo == nullptr && *ppPSO != nullptr)
+        m_Cache.PSO.Set(PSOData<CreateInfoType>::ArchiveResType, UnpackInfo.Name, *ppPSO);
+}
+
+template <typename CreateInfoType>
+void DearchiverBase::UnpackPipelineStateImpl(const PipelineStateUnpackInfo& UnpackInfo,
+                                             IPipelineState**               ppPSO)
+{
+    VERIFY_EXPR(UnpackInfo.pDevice != nullptr);
+
+    constexpr auto ResType = PSOData<CreateInfoType>::ArchiveResType;
+
+    // Do not cache modified PSOs
     if (UnpackInfo.ModifyPipelineStateCreateInfo == nullptr)
-        m_Cache.PSO.Set(ResType, UnpackInfo.Name, *ppPSO);
+    {
+        // Since PSO names must be unique (for each PSO type), we use a single cache for all
+        // loaded archives.
+        if (m_Cache.PSO.Get(ResType, UnpackInfo.Name, ppPSO))
+        {
+            // The pipeline may have been created asynchronously by UnpackPipelineStates()
+            (*ppPSO)->GetStatus(/*WaitForCompletion = */ true);
+            return;
+        }
+    }
+
+    PSOData<CreateInfoType> PSO{GetRawAllocator()};
+    ArchiveData*            pArchiveData = nullptr;
+    if (!LoadPSOData(UnpackInfo, PSO, pArchiveData))
+        return;
+
+    CreatePipelineState(UnpackInfo, *pArchiveData, PSO, PSO_CREATE_FLAG_NONE, ppPSO);
 }
 
 bool DearchiverBase::LoadArchive(const IDataBlob* pArchiveData, Uint32 ContentVersion, bool MakeCopy)
@@ -729,6 +781,229 @@ void DearchiverBase::UnpackPipelineState(const PipelineStateUnpackInfo& UnpackIn
     }
 }
 
+struct DearchiverBase::PSOBatchItem
+{
+    const PipelineStateUnpackInfo& UnpackInfo;
+
+    // The following members are initialized by Load()
+    ArchiveData*                          pArchive                 = nullptr;
+    const char*                           RenderPassName           = nullptr;
+    const char* const*                    SignatureNames           = nullptr; // Null if the PSO uses implicit signature
+    Uint32                                NumSignatures            = 0;
+    Uint32                                SRBAllocationGranularity = 1;
+    DeviceObjectArchive::ShaderIndexArray ShaderIndices;
+    bool                                  SkipReflection = false;
+
+    explicit PSOBatchItem(const PipelineStateUnpackInfo& _UnpackInfo) noexcept :
+        UnpackInfo{_UnpackInfo}
+    {}
+    virtual ~PSOBatchItem() {}
+
+    virtual ResourceType GetArchiveResType() const = 0;
+
+    // Returns false if the pipeline does not need to be created, i.e. if it was found
+    // in the cache (in which case it is written to ppPSO), or if the data failed to load.
+    virtual bool Load(DearchiverBase& Dearchiver, IPipelineState** ppPSO) = 0;
+
+    virtual void CreatePipeline(DearchiverBase& Dearchiver, IPipelineState** ppPSO) = 0;
+
+    static std::unique_ptr<PSOBatchItem> Create(const PipelineStateUnpackInfo& UnpackInfo);
+};
+
+template <typename CreateInfoType>
+struct DearchiverBase::TypedPSOBatchItem final : PSOBatchItem
+{
+    PSOData<CreateInfoType> PSO{GetRawAllocator()};
+
+    using PSOBatchItem::PSOBatchItem;
+
+    virtual ResourceType GetArchiveResType() const override final
+    {
+        return PSOData<CreateInfoType>::ArchiveResType;
+    }
+
+    virtual bool Load(DearchiverBase& Dearchiver, IPipelineState** ppPSO) override final
+    {
+        constexpr auto ResType = PSOData<CreateInfoType>::ArchiveResType;
+
+        // Do not cache modified PSOs
+        if (UnpackInfo.ModifyPipelineStateCreateInfo == nullptr && Dearchiver.m_Cache.PSO.Get(ResType, UnpackInfo.Name, ppPSO))
+            return false;
+
+        if (!Dearchiver.LoadPSOData(UnpackInfo, PSO, pArchive))
+            return false;
+
+        RenderPassName = PSO.RenderPassName;
+        if ((PSO.InternalCI.Flags & PSO_CREATE_INTERNAL_FLAG_IMPLICIT_SIGNATURE0) == 0)
+        {
+            SignatureNames = PSO.PRSNames.data();
+            NumSignatures  = PSO.CreateInfo.ResourceSignaturesCount;
+        }
+        SRBAllocationGranularity = PSO.CreateInfo.PSODesc.SRBAllocationGranularity;
+        ShaderIndices            = PSO.ShaderIndices;
+        SkipReflection           = (PSO.InternalCI.Flags & PSO_CREATE_INTERNAL_FLAG_NO_SHADER_REFLECTION) != 0;
+        return true;
+    }
+
+    virtual void CreatePipeline(DearchiverBase& Dearchiver, IPipelineState** ppPSO) override final
+    {
+        Dearchiver.CreatePipelineState(UnpackInfo, *pArchive, PSO, PSO_CREATE_FLAG_ASYNCHRONOUS, ppPSO);
+    }
+};
+
+std::unique_ptr<DearchiverBase::PSOBatchItem> DearchiverBase::PSOBatchItem::Create(const PipelineStateUnpackInfo& UnpackInfo)
+{
+    switch (UnpackInfo.PipelineType)
+    {
+        case PIPELINE_TYPE_GRAPHICS:
+        case PIPELINE_TYPE_MESH:
+            return std::make_unique<TypedPSOBatchItem<GraphicsPipelineStateCreateInfo>>(UnpackInfo);
+
+        case PIPELINE_TYPE_COMPUTE:
+            return std::make_unique<TypedPSOBatchItem<ComputePipelineStateCreateInfo>>(UnpackInfo);
+
+        case PIPELINE_TYPE_RAY_TRACING:
+            return std::make_unique<TypedPSOBatchItem<RayTracingPipelineStateCreateInfo>>(UnpackInfo);
+
+        case PIPELINE_TYPE_TILE:
+            return std::make_unique<TypedPSOBatchItem<TilePipelineStateCreateInfo>>(UnpackInfo);
+
+        case PIPELINE_TYPE_INVALID:
+        default:
+            LOG_ERROR_MESSAGE("Unsupported pipeline type");
+            return {};
+    }
+}
+
+void DearchiverBase::UnpackPipelineStates(const PipelineStateUnpackInfo* pUnpackInfos,
+                                          Uint32                         NumPipelines,
+                                          IThreadPool*                   pThreadPool,
+                                          IPipelineState**               ppPSOs)
+{
+    if (NumPipelines == 0)
+        return;
+
+    DEV_CHECK_ERR(pUnpackInfos != nullptr, "pUnpackInfos must not be null");
+    DEV_CHECK_ERR(ppPSOs != nullptr, "ppPSOs must not be null");
+    if (pUnpackInfos == nullptr || ppPSOs == nullptr)
+        return;
+
+    // Device objects can't be created by multiple threads in OpenGL and WebGPU
+    bool CreateInParallel = pThreadPool != nullptr;
+
+    std::vector<std::unique_ptr<PSOBatchItem>> Items(NumPipelines);
+
+    // Pipelines that are requested more than once are unpacked by the first item only.
+    // Modified pipelines are not cached and are never shared.
+    std::unordered_map<NamedResourceKey, Uint32, NamedResourceKey::Hasher> FirstItemIdx;
+    std::vector<std::pair<Uint32, Uint32>>                                 Duplicates; // {Item, First item}
+    for (Uint32 i = 0; i < NumPipelines; ++i)
+    {
+        const PipelineStateUnpackInfo& UnpackInfo = pUnpackInfos[i];
+
+        ppPSOs[i] = nullptr;
+        if (!VerifyPipelineStateUnpackInfo(UnpackInfo, &ppPSOs[i]))
+            continue;
+
+        Items[i] = PSOBatchItem::Create(UnpackInfo);
+        if (!Items[i])
+            continue;
+
+        if (UnpackInfo.ModifyPipelineStateCreateInfo == nullptr)
+        {
+            const auto it_inserted = FirstItemIdx.emplace(NamedResourceKey{Items[i]->GetArchiveResType(), UnpackInfo.Name}, i);
+            if (!it_inserted.second)
+            {
+                Duplicates.emplace_back(i, it_inserted.first->second);
+                Items[i].reset();
+                continue;
+            }
+        }
+
+        const RenderDeviceInfo& DeviceInfo = UnpackInfo.pDevice->GetDeviceInfo();
+        if (DeviceInfo.IsGLDevice() || DeviceInfo.IsWebGPUDevice())
+            CreateInParallel = false;
+    }
+
+    // Deserialize the pipeline data
+    ParallelFor(pThreadPool, NumPipelines, [&](size_t i) {
+        if (Items[i] && !Items[i]->Load(*this, &ppPSOs[i]))
+            Items[i].reset();
+    });
+
+    // Collect the signatures, render passes and shaders shared by the pipelines. The signature and
+    // render pass caches only keep weak references, so the batch holds strong references until
+    // all pipelines are created.
+    std::vector<std::function<RefCntAutoPtr<IDeviceObject>()>> SharedObjectJobs;
+    {
+        std::unordered_set<std::string>                              Signatures;
+        std::unordered_set<std::string>                              RenderPasses;
+        std::set<std::tuple<const ArchiveData*, DeviceType, Uint32>> Shaders;
+        for (const std::unique_ptr<PSOBatchItem>& pItem : Items)
+        {
+            if (!pItem)
+                continue;
+
+            IRenderDevice* const pDevice = pItem->UnpackInfo.pDevice;
+
+            for (Uint32 sign = 0; sign < pItem->NumSignatures; ++sign)
+            {
+                const char* Name = pItem->SignatureNames[sign];
+                if (Name == nullptr || !Signatures.emplace(Name).second)
+                    continue;
+
+                ResourceSignatureUnpackInfo SignUnpackInfo{pDevice, Name};
+                SignUnpackInfo.SRBAllocationGranularity = pItem->SRBAllocationGranularity;
+                SharedObjectJobs.emplace_back([this, SignUnpackInfo]() {
+                    return RefCntAutoPtr<IDeviceObject>{UnpackResourceSignature(SignUnpackInfo, false /*IsImplicit*/)};
+                });
+            }
+
+            if (pItem->RenderPassName != nullptr && *pItem->RenderPassName != 0 && RenderPasses.emplace(pItem->RenderPassName).second)
+            {
+                const RenderPassUnpackInfo RPUnpackInfo{pDevice, pItem->RenderPassName};
+                SharedObjectJobs.emplace_back([this, RPUnpackInfo]() {
+                    RefCntAutoPtr<IRenderPass> pRenderPass;
+                    UnpackRenderPass(RPUnpackInfo, &pRenderPass);
+                    return RefCntAutoPtr<IDeviceObject>{std::move(pRenderPass)};
+                });
+            }
+
+            const DeviceType DevType = GetArchiveDeviceType(pDevice);
+            for (Uint32 i = 0; i < pItem->ShaderIndices.Count; ++i)
+            {
+                const Uint32 Idx = pItem->ShaderIndices.pIndices[i];
+                if (!Shaders.emplace(pItem->pArchive, DevType, Idx).second)
+                    continue;
+
+                SharedObjectJobs.emplace_back([this, pArchive = pItem->pArchive, DevType, Idx, SkipReflection = pItem->SkipReflection, pDevice]() {
+                    return RefCntAutoPtr<IDeviceObject>{UnpackPSOShader(*pArchive, DevType, Idx, SkipReflection, pDevice)};
+                });
+            }
+        }
+    }
+
+    std::vector<RefCntAutoPtr<IDeviceObject>> SharedObjects(SharedObjectJobs.size());
+    ParallelFor(CreateInParallel ? pThreadPool : nullptr, SharedObjectJobs.size(), [&](size_t i) {
+        SharedObjects[i] = SharedObjectJobs[i]();
+    });
+
+    // Create the pipelines. All shared objects are now found in the caches.
+    ParallelFor(CreateInParallel ? pThreadPool : nullptr, NumPipelines, [&](size_t i) {
+        if (Items[i])
+            Items[i]->CreatePipeline(*this, &ppPSOs[i]);
+    });
+
+    for (const auto& Duplicate : Duplicates)
+    {
+        IPipelineState*& pPSO = ppPSOs[Duplicate.first];
+
+        pPSO = ppPSOs[Duplicate.second];
+        if (pPSO != nullptr)
+            pPSO->AddRef();
+    }
+}
+
 static bool ModifyShaderDesc(ShaderDesc&             Desc,
                              const ShaderUnpackInfo& UnpackInfo)
 {
@@ -858,6 +1133,50 @@ void DearchiverBase::UnpackRenderPass(const RenderPassUnpackInfo& UnpackInfo, IR
         m_Cache.RenderPass.Set(RPData::ArchiveResType, UnpackInfo.Name, *ppRP);
 }
 
+void DearchiverBase::GetDeviceData(RENDER_DEVICE_TYPE Type, IDataBlob** ppData) const
+{
+    if (ppData == nullptr)
+    {
+        DEV_ERROR("ppData must not be null");
+        return;
+    }
+    DEV_CHECK_ERR(*ppData == nullptr, "*ppData must be null - make sure you are not overwriting "
+                                      "reference to an existing object as this will cause memory leaks.");
+
+    const DeviceType DevType = RenderDeviceTypeToArchiveDeviceType(Type);
+    if (DevType >= DeviceType::Count)
+        return;
+
+    if (const RefCntAutoPtr<IDataBlob>& pData = m_DeviceData[static_cast<size_t>(DevType)])
+    {
+        *ppData = pData;
+        (*ppData)->AddRef();
+        return;
+    }
+
+    for (const ArchiveData& Archive : m_Archives)
+    {
+        const SerializedData& Data = Archive.pObjArchive->GetDeviceData(DevType);
+        if (Data)
+        {
+            *ppData = DataBlobImpl::Create(Data.Size(), Data.Ptr()).Detach();
+            return;
+        }
+    }
+}
+
+void DearchiverBase::SetDeviceData(RENDER_DEVICE_TYPE Type, IDataBlob* pData)
+{
+    const DeviceType DevType = RenderDeviceTypeToArchiveDeviceType(Type);
+    if (DevType >= DeviceType::Count)
+    {
+        DEV_ERROR("Device type ", GetRenderDeviceTypeString(Type), " does not use device-specific data");
+        return;
+    }
+
+    m_DeviceData[static_cast<size_t>(DevType)] = pData;
+}
+
 bool DearchiverBase::Store(IDataBlob** ppArchive) const
 {
     if (ppArchive == nullptr)
@@ -877,6 +1196,12 @@ bool DearchiverBase::Store(IDataBlob** ppArchive) const
                 MergedArchive.Merge(*Archive.pObjArchive);
         }
 
+        for (size_t i = 0; i < m_DeviceData.size(); ++i)
+        {
+            if (const RefCntAutoPtr<IDataBlob>& pData = m_DeviceData[i])
+                MergedArchive.SetDeviceData(static_cast<DeviceType>(i), pData->GetConstDataPtr(), StaticCast<size_t>(pData->GetSize()));
+        }
+
         MergedArchive.Serialize(ppArchive);
         return *ppArchive != nullptr;
     }
@@ -890,6 +1215,7 @@ void DearchiverBase::Reset()
 {
     m_Archives.clear();
     m_ResNameToArchiveIdx.clear();
+    m_DeviceData = {};
 }
 
 Uint32 DearchiverBase::GetContentVersion() const
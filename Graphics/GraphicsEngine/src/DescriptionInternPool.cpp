@@ -0,0 +1,341 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "DescriptionInternPool.hpp"
+
+#include <atomic>
+#include <mutex>
+#include <shared_mutex>
+#include <tuple>
+#include <unordered_set>
+#include <vector>
+
+#include "HashUtils.hpp"
+#include "DynamicLinearAllocator.hpp"
+#include "DefaultRawMemoryAllocator.hpp"
+#include "SharedMutex.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+// References an array stored in the pool.
+template <typename ElementType>
+struct InternedArrayKey
+{
+    const ElementType* pElements = nullptr;
+    Uint32             Count     = 0;
+    size_t             Hash      = 0;
+
+    bool operator==(const InternedArrayKey& RHS) const noexcept
+    {
+        if (Hash != RHS.Hash || Count != RHS.Count)
+            return false;
+
+        for (Uint32 i = 0; i < Count; ++i)
+        {
+            if (!(pElements[i] == RHS.pElements[i]))
+                return false;
+        }
+        return true;
+    }
+
+    struct Hasher
+    {
+        size_t operator()(const InternedArrayKey& Key) const noexcept
+        {
+            return Key.Hash;
+        }
+    };
+};
+
+// References a raw data block stored in the pool.
+struct InternedDataKey
+{
+    const void* pData = nullptr;
+    size_t      Size  = 0;
+    size_t      Hash  = 0;
+
+    bool operator==(const InternedDataKey& RHS) const noexcept
+    {
+        return Hash == RHS.Hash && Size == RHS.Size && memcmp(pData, RHS.pData, Size) == 0;
+    }
+
+    struct Hasher
+    {
+        size_t operator()(const InternedDataKey& Key) const noexcept
+        {
+            return Key.Hash;
+        }
+    };
+};
+
+template <typename ElementType>
+using InternedArraySet = std::unordered_set<InternedArrayKey<ElementType>, typename InternedArrayKey<ElementType>::Hasher>;
+
+// The hash functions below are called after all strings and data referenced by the element
+// have been interned, so pointers can be hashed instead of the contents.
+size_t HashElement(const LayoutElement& Elem) { return std::hash<LayoutElement>{}(Elem); }
+size_t HashElement(const ShaderResourceVariableDesc& Var) { return std::hash<ShaderResourceVariableDesc>{}(Var); }
+size_t HashElement(const ImmutableSamplerDesc& Sam) { return std::hash<ImmutableSamplerDesc>{}(Sam); }
+size_t HashElement(const PipelineResourceDesc& Res) { return std::hash<PipelineResourceDesc>{}(Res); }
+size_t HashElement(const SpecializationConstant& Const) { return ComputeHash(Const.Name, Const.ShaderStages, Const.Size, Const.pData); }
+size_t HashElement(const RayTracingGeneralShaderGroup& Group) { return ComputeHash(Group.Name, Group.pShader); }
+size_t HashElement(const RayTracingTriangleHitShaderGroup& Group) { return ComputeHash(Group.Name, Group.pClosestHitShader, Group.pAnyHitShader); }
+size_t HashElement(const RayTracingProceduralHitShaderGroup& Group) { return ComputeHash(Group.Name, Group.pIntersectionShader, Group.pClosestHitShader, Group.pAnyHitShader); }
+
+} // namespace
+
+struct DescriptionInternPool::Impl
+{
+    // Looks up the key under the shared lock, so that concurrent requests for the data that is
+    // already in the pool do not block each other. If the key is not found, the copy made by
+    // MakeCopy is inserted under the exclusive lock.
+    // The returned element is never modified or removed, so it can be read without the lock.
+    template <typename SetType, typename KeyType, typename MakeCopyType>
+    const typename SetType::value_type& FindOrAdd(SetType& Set, const KeyType& Key, MakeCopyType&& MakeCopy)
+    {
+        NumRequests.fetch_add(1, std::memory_order_relaxed);
+
+        {
+            std::shared_lock<Threading::SharedMutex> ReadLock{Mtx};
+
+            auto it = Set.find(Key);
+            if (it != Set.end())
+            {
+                NumHits.fetch_add(1, std::memory_order_relaxed);
+                return *it;
+            }
+        }
+
+        std::unique_lock<Threading::SharedMutex> WriteLock{Mtx};
+
+        // Another thread may have added the same data while the lock was released
+        auto it = Set.find(Key);
+        if (it != Set.end())
+        {
+            NumHits.fetch_add(1, std::memory_order_relaxed);
+            return *it;
+        }
+
+        const size_t NumBlocks = Allocator.GetBlockCount();
+
+        const auto& Elem = *Set.emplace(MakeCopy()).first;
+
+        if (Allocator.GetBlockCount() != NumBlocks)
+        {
+            size_t Size = 0;
+            Allocator.ProcessBlocks([&Size](const void*, size_t BlockSize) { Size += BlockSize; });
+            MemorySize.store(Size, std::memory_order_relaxed);
+        }
+
+        return Elem;
+    }
+
+    const char* GetString(const char* Str)
+    {
+        if (Str == nullptr)
+            return nullptr;
+
+        const HashMapStringKey& Key = FindOrAdd(Strings, HashMapStringKey{Str}, [&]() {
+            return HashMapStringKey{Allocator.CopyString(Str)};
+        });
+        return Key.GetStr();
+    }
+
+    const void* GetData(const void* pData, size_t Size)
+    {
+        if (Size == 0)
+            return nullptr;
+
+        VERIFY_EXPR(pData != nullptr);
+
+        const InternedDataKey  Key{pData, Size, ComputeHashRaw(pData, Size)};
+        const InternedDataKey& Interned = FindOrAdd(Data, Key, [&]() {
+            void* pDataCopy = Allocator.Allocate(Size, alignof(Uint64));
+            memcpy(pDataCopy, pData, Size);
+            return InternedDataKey{pDataCopy, Size, Key.Hash};
+        });
+        return Interned.pData;
+    }
+
+    // clang-format off
+    void InternStrings(LayoutElement&              Elem) { Elem.HLSLSemantic = GetString(Elem.HLSLSemantic); }
+    void InternStrings(ShaderResourceVariableDesc& Var)  { Var.Name          = GetString(Var.Name); }
+    void InternStrings(PipelineResourceDesc&       Res)  { Res.Name          = GetString(Res.Name); }
+    // clang-format on
+
+    void InternStrings(ImmutableSamplerDesc& Sam)
+    {
+        Sam.SamplerOrTextureName = GetString(Sam.SamplerOrTextureName);
+        Sam.Desc.Name            = GetString(Sam.Desc.Name);
+    }
+
+    void InternStrings(SpecializationConstant& Const)
+    {
+        Const.Name  = GetString(Const.Name);
+        Const.pData = GetData(Const.pData, Const.Size);
+    }
+
+    template <typename GroupType>
+    void InternStrings(GroupType& Group)
+    {
+        Group.Name = GetString(Group.Name);
+    }
+
+    template <typename ElementType>
+    const ElementType* GetArray(const ElementType* pElements, Uint32 Count)
+    {
+        if (Count == 0)
+            return nullptr;
+
+        VERIFY_EXPR(pElements != nullptr);
+
+        std::vector<ElementType> Elements{pElements, pElements + Count};
+
+        InternedArrayKey<ElementType> Key{Elements.data(), Count, 0};
+        for (ElementType& Elem : Elements)
+        {
+            InternStrings(Elem);
+            HashCombine(Key.Hash, HashElement(Elem));
+        }
+
+        InternedArraySet<ElementType>& Arrays = std::get<InternedArraySet<ElementType>>(ArraySets);
+
+        const InternedArrayKey<ElementType>& Interned = FindOrAdd(Arrays, Key, [&]() {
+            return InternedArrayKey<ElementType>{Allocator.CopyArray(Elements.data(), Count), Count, Key.Hash};
+        });
+        return Interned.pElements;
+    }
+
+    // Protects the allocator and the sets below
+    mutable Threading::SharedMutex Mtx;
+
+    DynamicLinearAllocator Allocator{DefaultRawMemoryAllocator::GetAllocator(), 16 << 10};
+
+    std::unordered_set<HashMapStringKey>                         Strings;
+    std::unordered_set<InternedDataKey, InternedDataKey::Hasher> Data;
+
+    std::tuple<InternedArraySet<LayoutElement>,
+               InternedArraySet<ShaderResourceVariableDesc>,
+               InternedArraySet<ImmutableSamplerDesc>,
+               InternedArraySet<PipelineResourceDesc>,
+               InternedArraySet<SpecializationConstant>,
+               InternedArraySet<RayTracingGeneralShaderGroup>,
+               InternedArraySet<RayTracingTriangleHitShaderGroup>,
+               InternedArraySet<RayTracingProceduralHitShaderGroup>>
+        ArraySets;
+
+    std::atomic<Uint64> NumRequests{0};
+    std::atomic<Uint64> NumHits{0};
+    std::atomic<size_t> MemorySize{0};
+};
+
+DescriptionInternPool::DescriptionInternPool() :
+    m_pImpl{std::make_unique<Impl>()}
+{
+}
+
+DescriptionInternPool::~DescriptionInternPool()
+{
+}
+
+const char* DescriptionInternPool::GetString(const char* Str)
+{
+    return m_pImpl->GetString(Str);
+}
+
+const void* DescriptionInternPool::GetData(const void* pData, size_t Size)
+{
+    return m_pImpl->GetData(pData, Size);
+}
+
+#define DEFINE_GET_ARRAY(ElementType)                                                              \
+    const ElementType* DescriptionInternPool::GetArray(const ElementType* pElements, Uint32 Count) \
+    {                                                                                              \
+        return m_pImpl->GetArray(pElements, Count);                                                \
+    }
+
+DEFINE_GET_ARRAY(LayoutElement)
+DEFINE_GET_ARRAY(ShaderResourceVariableDesc)
+DEFINE_GET_ARRAY(ImmutableSamplerDesc)
+DEFINE_GET_ARRAY(PipelineResourceDesc)
+DEFINE_GET_ARRAY(SpecializationConstant)
+DEFINE_GET_ARRAY(RayTracingGeneralShaderGroup)
+DEFINE_GET_ARRAY(RayTracingTriangleHitShaderGroup)
+DEFINE_GET_ARRAY(RayTracingProceduralHitShaderGroup)
+
+#undef DEFINE_GET_ARRAY
+
+InputLayoutDesc DescriptionInternPool::Intern(const InputLayoutDesc& Desc)
+{
+    InputLayoutDesc Interned{Desc};
+    Interned.LayoutElements = m_pImpl->GetArray(Desc.LayoutElements, Desc.NumElements);
+    return Interned;
+}
+
+PipelineResourceLayoutDesc DescriptionInternPool::Intern(const PipelineResourceLayoutDesc& Desc)
+{
+    PipelineResourceLayoutDesc Interned{Desc};
+    Interned.Variables         = m_pImpl->GetArray(Desc.Variables, Desc.NumVariables);
+    Interned.ImmutableSamplers = m_pImpl->GetArray(Desc.ImmutableSamplers, Desc.NumImmutableSamplers);
+    return Interned;
+}
+
+PipelineResourceSignatureDesc DescriptionInternPool::Intern(const PipelineResourceSignatureDesc& Desc)
+{
+    PipelineResourceSignatureDesc Interned{Desc};
+    Interned.Name                  = m_pImpl->GetString(Desc.Name);
+    Interned.Resources             = m_pImpl->GetArray(Desc.Resources, Desc.NumResources);
+    Interned.ImmutableSamplers     = m_pImpl->GetArray(Desc.ImmutableSamplers, Desc.NumImmutableSamplers);
+    Interned.CombinedSamplerSuffix = m_pImpl->GetString(Desc.CombinedSamplerSuffix);
+    return Interned;
+}
+
+DescriptionInternPool::Statistics DescriptionInternPool::GetStatistics() const
+{
+    Statistics Stats;
+    {
+        std::shared_lock<Threading::SharedMutex> Lock{m_pImpl->Mtx};
+
+        Stats.NumStrings = m_pImpl->Strings.size();
+        Stats.NumArrays  = m_pImpl->Data.size();
+        std::apply([&Stats](const auto&... Sets) { Stats.NumArrays += (Sets.size() + ...); }, m_pImpl->ArraySets);
+    }
+    Stats.NumRequests = m_pImpl->NumRequests.load(std::memory_order_relaxed);
+    Stats.NumHits     = m_pImpl->NumHits.load(std::memory_order_relaxed);
+    Stats.MemorySize  = m_pImpl->MemorySize.load(std::memory_order_relaxed);
+    return Stats;
+}
+
+size_t DescriptionInternPool::GetMemorySize() const
+{
+    return m_pImpl->MemorySize.load(std::memory_order_relaxed);
+}
+
+} // namespace Diligent
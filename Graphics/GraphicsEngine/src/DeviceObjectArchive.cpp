@@ -39,7 +39,7 @@ namespace Diligent
 
 DeviceObjectArchive::DeviceType RenderDeviceTypeToArchiveDeviceType(RENDER_DEVICE_TYPE Type)
 {
-    static_assert(RENDER_DEVICE_TYPE_COUNT == 8, "Did you add a new render device type? Please handle it here.");
+    static_assert(RENDER_DEVICE_TYPE_COUNT == 9, "Did you add a new render device type? Please handle it here.");
     switch (Type)
     {
             // clang-format off
@@ -56,6 +56,10 @@ DeviceObjectArchive::DeviceType RenderDeviceTypeToArchiveDeviceType(RENDER_DEVIC
         case RENDER_DEVICE_TYPE_WEBGPU:
             return DeviceObjectArchive::DeviceType::WebGPU;
 
+        case RENDER_DEVICE_TYPE_NULL:
+            // The null device does not use device-specific data
+            return DeviceObjectArchive::DeviceType::Count;
+
         // clang-format on
         default:
             UNEXPECTED("Unexpected device type");
@@ -155,6 +159,7 @@ void DeviceObjectArchive::Clear() noexcept
 {
     m_NamedResources.clear();
     m_DeviceShaders = {};
+    m_DeviceData    = {};
     m_pArchiveData.Release();
     m_ContentVersion = 0;
 }
@@ -231,6 +236,11 @@ bool DeviceObjectArchive::Deserialize(const CreateInfo& CI) noexcept
     {
         CHECK_ARCHIVE(ArchiveReader.SerializeShaders(Shaders), "Failed to read shader data from the device object archive.");
     }
+
+    for (SerializedData& DeviceData : m_DeviceData)
+    {
+        CHECK_ARCHIVE(Reader.Serialize(DeviceData), "Failed to read device data from the device object archive.");
+    }
 #undef CHECK_ARCHIVE
 
     return true;
@@ -276,6 +286,12 @@ void DeviceObjectArchive::Serialize(IDataBlob** ppDataBlob) const
             res = ArchiveSer.SerializeShaders(Shaders);
             VERIFY(res, "Failed to serialize shaders");
         }
+
+        for (const SerializedData& DeviceData : m_DeviceData)
+        {
+            res = Ser.Serialize(DeviceData);
+            VERIFY(res, "Failed to serialize device data");
+        }
     };
 
     Serializer<SerializerMode::Measure> Measurer;
@@ -519,9 +535,52 @@ std::string DeviceObjectArchive::ToString() const
         }
     }
 
+    // Print device data, e.g.
+    //
+    //   ------------------
+    //   Device Data
+    //     OpenGL 65536 bytes
+    {
+        size_t MaxSize       = 0;
+        size_t MaxDevNameLen = 0;
+        for (Uint32 dev = 0; dev < m_DeviceData.size(); ++dev)
+        {
+            if (const size_t DataSize = m_DeviceData[dev].Size())
+            {
+                MaxSize       = std::max(MaxSize, DataSize);
+                MaxDevNameLen = std::max(MaxDevNameLen, strlen(ArchiveDeviceTypeToString(dev)));
+            }
+        }
+
+        if (MaxSize > 0)
+        {
+            Output << SeparatorLine
+                   << "Device Data\n";
+            // ------------------
+            // Device Data
+
+            const size_t SizeFieldW = GetNumFieldWidth(MaxSize);
+            for (Uint32 dev = 0; dev < m_DeviceData.size(); ++dev)
+            {
+                const size_t DataSize = m_DeviceData[dev].Size();
+                if (DataSize == 0)
+                    continue;
+
+                Output << Ident1 << std::setw(static_cast<int>(MaxDevNameLen)) << std::left << ArchiveDeviceTypeToString(dev) << ' '
+                       << std::setw(static_cast<int>(SizeFieldW)) << std::right << DataSize << " bytes\n";
+                // ..OpenGL 65536 bytes
+            }
+        }
+    }
+
     return Output.str();
 }
 
+void DeviceObjectArchive::SetDeviceData(DeviceType Type, const void* pData, size_t Size) noexcept(false)
+{
+    m_DeviceData[static_cast<size_t>(Type)] = SerializedData{const_cast<void*>(pData), Size}.MakeCopy(GetRawAllocator());
+}
+
 
 void DeviceObjectArchive::RemoveDeviceData(DeviceType Dev) noexcept(false)
 {
@@ -529,6 +588,7 @@ void DeviceObjectArchive::RemoveDeviceData(DeviceType Dev) noexcept(false)
         res_it.second.DeviceSpecific[static_cast<size_t>(Dev)] = {};
 
     m_DeviceShaders[static_cast<size_t>(Dev)].clear();
+    m_DeviceData[static_cast<size_t>(Dev)] = {};
 }
 
 void DeviceObjectArchive::AppendDeviceData(const DeviceObjectArchive& Src, DeviceType Dev) noexcept(false)
@@ -555,6 +615,8 @@ void DeviceObjectArchive::AppendDeviceData(const DeviceObjectArchive& Src, Devic
     DstShaders.clear();
     for (const SerializedData& SrcShader : SrcShaders)
         DstShaders.emplace_back(SrcShader.MakeCopy(Allocator));
+
+    m_DeviceData[static_cast<size_t>(Dev)] = Src.m_DeviceData[static_cast<size_t>(Dev)].MakeCopy(Allocator);
 }
 
 void DeviceObjectArchive::Merge(const DeviceObjectArchive& Src) noexcept(false)
@@ -581,6 +643,20 @@ void DeviceObjectArchive::Merge(const DeviceObjectArchive& Src) noexcept(false)
             DstShaders.emplace_back(SrcShader.MakeCopy(Allocator));
     }
 
+    // Copy device data. Like resources, existing data is not overwritten.
+    for (size_t i = 0; i < m_DeviceData.size(); ++i)
+    {
+        const SerializedData& SrcData = Src.m_DeviceData[i];
+        if (!SrcData)
+            continue;
+
+        SerializedData& DstData = m_DeviceData[i];
+        if (!DstData)
+            DstData = SrcData.MakeCopy(Allocator);
+        else if (DstData != SrcData)
+            LOG_WARNING_MESSAGE("Failed to copy ", ArchiveDeviceTypeToString(static_cast<Uint32>(i)), " device data: the archive already contains different data.");
+    }
+
     // Copy named resources
     for (auto& src_res_it : Src.m_NamedResources)
     {
@@ -49,6 +49,8 @@ void ValidatePipelineResourceSignatureDesc(const PipelineResourceSignatureDesc&
                                            const IRenderDevice*                 pDevice,
                                            RENDER_DEVICE_TYPE                   DeviceType) noexcept(false)
 {
+    DILIGENT_CPU_PROFILE_ZONE("ValidatePipelineResourceSignatureDesc", "Validation");
+
     const RenderDeviceInfo& DeviceInfo = pDevice != nullptr ?
         pDevice->GetDeviceInfo() :
         RenderDeviceInfo{DeviceType, Version{}, DeviceFeatures{DEVICE_FEATURE_STATE_ENABLED}};
@@ -51,6 +51,12 @@ public:
     ~ShaderResourceBindingD3D11Impl();
 
     IMPLEMENT_QUERY_INTERFACE_IN_PLACE(IID_ShaderResourceBindingD3D11, TBase)
+
+    // Binds the resources through the implementations of the variables of different resource types.
+    // Hides ShaderResourceBindingBase::BindVariables().
+    void BindVariables(const ShaderVariableBinding* pBindings,
+                       Uint32                       NumBindings,
+                       SET_SHADER_RESOURCE_FLAGS    Flags);
 };
 
 } // namespace Diligent
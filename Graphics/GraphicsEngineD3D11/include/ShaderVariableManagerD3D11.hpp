@@ -34,6 +34,7 @@
 #include "ShaderResources.hpp"
 #include "ShaderResourceVariableBase.hpp"
 #include "ShaderResourceVariableD3D.h"
+#include "ShaderResourceBinding.h"
 #include "PipelineResourceAttribsD3D11.hpp"
 #include "ShaderResourceCacheD3D11.hpp"
 
@@ -206,6 +207,12 @@ public:
     IShaderResourceVariable* GetVariable(const Char* Name) const;
     IShaderResourceVariable* GetVariable(Uint32 Index) const;
 
+    // Binds the objects to the elements of the variable with the given index.
+    // Unlike IShaderResourceVariable::SetArray(), the binding is not validated.
+    void BindVariable(Uint32                       Index,
+                      const ShaderVariableBinding& Binding,
+                      SET_SHADER_RESOURCE_FLAGS    Flags) const;
+
     IObject& GetOwner() { return m_Owner; }
 
     Uint32 GetVariableCount() const;
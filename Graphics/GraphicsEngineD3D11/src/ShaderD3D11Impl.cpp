@@ -107,6 +107,8 @@ ShaderD3D11Impl::ShaderD3D11Impl(IReferenceCounters*     pRefCounters,
         IsDeviceInternal,
         GetD3D11ShaderModel(D3D11ShaderCI.FeatureLevel, ShaderCI.HLSLVersion),
         [LoadConstantBufferReflection = ShaderCI.LoadConstantBufferReflection](const ShaderDesc& Desc, IDataBlob* pShaderByteCode) {
+            DILIGENT_CPU_PROFILE_ZONE("LoadShaderResourcesD3D11", "Reflection");
+
             IMemoryAllocator&     Allocator  = GetRawAllocator();
             ShaderResourcesD3D11* pRawMem    = ALLOCATE(Allocator, "Allocator for ShaderResources", ShaderResourcesD3D11, 1);
             ShaderResourcesD3D11* pResources = new (pRawMem) ShaderResourcesD3D11 //
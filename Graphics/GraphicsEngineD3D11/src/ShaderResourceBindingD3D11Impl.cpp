@@ -45,4 +45,20 @@ ShaderResourceBindingD3D11Impl::~ShaderResourceBindingD3D11Impl()
 {
 }
 
+void ShaderResourceBindingD3D11Impl::BindVariables(const ShaderVariableBinding* pBindings,
+                                                   Uint32                       NumBindings,
+                                                   SET_SHADER_RESOURCE_FLAGS    Flags)
+{
+    for (Uint32 i = 0; i < NumBindings; ++i)
+    {
+        const ShaderVariableBinding& Binding = pBindings[i];
+
+        const ShaderVariableManagerD3D11* pVarMgr = nullptr;
+        if (GetBindingVariable(Binding, &pVarMgr) == nullptr)
+            continue;
+
+        pVarMgr->BindVariable(Binding.VariableIndex, Binding, Flags);
+    }
+}
+
 } // namespace Diligent
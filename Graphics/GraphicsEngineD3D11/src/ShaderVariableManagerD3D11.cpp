@@ -669,7 +669,7 @@ public:
     }
 
     template <typename ResourceType>
-    IShaderResourceVariable* TryResource()
+    ResourceType* TryResource()
     {
 #ifdef DILIGENT_DEBUG
         {
@@ -724,6 +724,41 @@ IShaderResourceVariable* ShaderVariableManagerD3D11::GetVariable(Uint32 Index) c
     return nullptr;
 }
 
+void ShaderVariableManagerD3D11::BindVariable(Uint32                       Index,
+                                              const ShaderVariableBinding& Binding,
+                                              SET_SHADER_RESOURCE_FLAGS    Flags) const
+{
+    auto BindElements = [&](auto* pVar) {
+        for (Uint32 elem = 0; elem < Binding.NumElements; ++elem)
+            pVar->BindResource(BindResourceInfo{Binding.FirstElement + elem, Binding.ppObjects[elem], Flags, Binding.BufferOffset, Binding.BufferRange});
+    };
+
+    ShaderVariableLocator VarLocator(*this, Index);
+
+    if (ConstBuffBindInfo* pCB = VarLocator.TryResource<ConstBuffBindInfo>())
+        return BindElements(pCB);
+
+    if (TexSRVBindInfo* pTexSRV = VarLocator.TryResource<TexSRVBindInfo>())
+        return BindElements(pTexSRV);
+
+    if (TexUAVBindInfo* pTexUAV = VarLocator.TryResource<TexUAVBindInfo>())
+        return BindElements(pTexUAV);
+
+    if (BuffSRVBindInfo* pBuffSRV = VarLocator.TryResource<BuffSRVBindInfo>())
+        return BindElements(pBuffSRV);
+
+    if (BuffUAVBindInfo* pBuffUAV = VarLocator.TryResource<BuffUAVBindInfo>())
+        return BindElements(pBuffUAV);
+
+    if (!m_pSignature->IsUsingCombinedSamplers())
+    {
+        if (SamplerBindInfo* pSampler = VarLocator.TryResource<SamplerBindInfo>())
+            return BindElements(pSampler);
+    }
+
+    LOG_ERROR(Index, " is not a valid variable index.");
+}
+
 Uint32 ShaderVariableManagerD3D11::GetVariableCount() const
 {
     return GetNumCBs() + GetNumTexSRVs() + GetNumTexUAVs() + GetNumBufSRVs() + GetNumBufUAVs() + GetNumSamplers();
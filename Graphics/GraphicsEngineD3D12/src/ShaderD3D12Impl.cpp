@@ -117,6 +117,8 @@ ShaderD3D12Impl::ShaderD3D12Impl(IReferenceCounters*     pRefCounters,
         GetD3D12ShaderModel(ShaderCI, D3D12ShaderCI.pDXCompiler, D3D12ShaderCI.MaxShaderVersion),
         [pDXCompiler      = D3D12ShaderCI.pDXCompiler,
          LoadCBReflection = ShaderCI.LoadConstantBufferReflection](const ShaderDesc& Desc, IDataBlob* pShaderByteCode) {
+            DILIGENT_CPU_PROFILE_ZONE("LoadShaderResourcesD3D12", "Reflection");
+
             IMemoryAllocator&     Allocator  = GetRawAllocator();
             ShaderResourcesD3D12* pRawMem    = ALLOCATE(Allocator, "Allocator for ShaderResources", ShaderResourcesD3D12, 1);
             ShaderResourcesD3D12* pResources = new (pRawMem) ShaderResourcesD3D12 //
@@ -0,0 +1,68 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Declaration of Diligent::QueryNullImpl class
+
+#include "EngineNullImplTraits.hpp"
+#include "QueryBase.hpp"
+
+namespace Diligent
+{
+
+/// Query implementation in null backend.
+
+/// Timestamp and duration queries measure CPU time at the moment the
+/// corresponding command is recorded. All other queries return zero results.
+class QueryNullImpl final : public QueryBase<EngineNullImplTraits>
+{
+public:
+    using TQueryBase = QueryBase<EngineNullImplTraits>;
+
+    QueryNullImpl(IReferenceCounters*   pRefCounters,
+                  RenderDeviceNullImpl* pDevice,
+                  const QueryDesc&      Desc);
+
+    ~QueryNullImpl() override;
+
+    /// Implementation of IQuery::GetData() in null backend.
+    bool DILIGENT_CALL_TYPE GetData(void* pData, Uint32 DataSize, bool AutoInvalidate) override final;
+
+    /// Implementation of IQuery::Invalidate() in null backend.
+    void DILIGENT_CALL_TYPE Invalidate() override final;
+
+    void OnBeginQuery(DeviceContextNullImpl* pContext);
+
+    void OnEndQuery(DeviceContextNullImpl* pContext);
+
+private:
+    Uint64 m_StartTime = 0;
+    Uint64 m_EndTime   = 0;
+};
+
+} // namespace Diligent
@@ -0,0 +1,189 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Declaration of Diligent::RenderDeviceNullImpl class
+
+#include "EngineNullImplTraits.hpp"
+#include "RenderDeviceBase.hpp"
+#include "DeviceContextNullImpl.hpp"
+#include "ShaderNullImpl.hpp"
+#include "PipelineResourceSignatureNullImpl.hpp"
+#include "PipelineStateNullImpl.hpp"
+#include "ShaderResourceBindingNullImpl.hpp"
+#include "BufferNullImpl.hpp"
+#include "BufferViewNullImpl.hpp"
+#include "TextureNullImpl.hpp"
+#include "TextureViewNullImpl.hpp"
+#include "SamplerNullImpl.hpp"
+#include "FenceNullImpl.hpp"
+#include "QueryNullImpl.hpp"
+#include "RenderPassNullImpl.hpp"
+#include "FramebufferNullImpl.hpp"
+#include "CommandListNullImpl.hpp"
+
+namespace Diligent
+{
+
+/// Render device implementation in null backend.
+
+/// The device does not use any graphics API. All resources are allocated in host memory,
+/// and all commands complete immediately.
+class RenderDeviceNullImpl final : public RenderDeviceBase<EngineNullImplTraits>
+{
+public:
+    using TRenderDeviceBase = RenderDeviceBase<EngineNullImplTraits>;
+
+    struct CreateInfo
+    {
+        IMemoryAllocator&          RawMemAllocator;
+        IEngineFactory* const      pEngineFactory;
+        const EngineCreateInfo&    EngineCI;
+        const GraphicsAdapterInfo& AdapterInfo;
+    };
+    RenderDeviceNullImpl(IReferenceCounters* pRefCounters, const CreateInfo& CI) noexcept(false);
+
+    ~RenderDeviceNullImpl() override;
+
+    /// Implementation of IRenderDevice::CreateBuffer() in null backend.
+    void DILIGENT_CALL_TYPE CreateBuffer(const BufferDesc& BuffDesc,
+                                         const BufferData* pBuffData,
+                                         IBuffer**         ppBuffer) override final;
+
+    /// Implementation of IRenderDevice::CreateShader() in null backend.
+    void DILIGENT_CALL_TYPE CreateShader(const ShaderCreateInfo& ShaderCI,
+                                         IShader**               ppShader,
+                                         IDataBlob**             ppCompilerOutput) override final;
+
+    /// Implementation of IRenderDevice::CreateTexture() in null backend.
+    void DILIGENT_CALL_TYPE CreateTexture(const TextureDesc& TexDesc,
+                                          const TextureData* pData,
+                                          ITexture**         ppTexture) override final;
+
+    /// Implementation of IRenderDevice::CreateSampler() in null backend.
+    void DILIGENT_CALL_TYPE CreateSampler(const SamplerDesc& SamplerDesc,
+                                          ISampler**         ppSampler) override final;
+
+    /// Implementation of IRenderDevice::CreateGraphicsPipelineState() in null backend.
+    void DILIGENT_CALL_TYPE CreateGraphicsPipelineState(const GraphicsPipelineStateCreateInfo& PSOCreateInfo,
+                                                        IPipelineState**                       ppPipelineState) override final;
+
+    /// Implementation of IRenderDevice::CreateComputePipelineState() in null backend.
+    void DILIGENT_CALL_TYPE CreateComputePipelineState(const ComputePipelineStateCreateInfo& PSOCreateInfo,
+                                                       IPipelineState**                      ppPipelineState) override final;
+
+    /// Implementation of IRenderDevice::CreateRayTracingPipelineState() in null backend.
+    void DILIGENT_CALL_TYPE CreateRayTracingPipelineState(const RayTracingPipelineStateCreateInfo& PSOCreateInfo,
+                                                          IPipelineState**                         ppPipelineState) override final;
+
+    /// Implementation of IRenderDevice::CreateFence() in null backend.
+    void DILIGENT_CALL_TYPE CreateFence(const FenceDesc& Desc,
+                                        IFence**         ppFence) override final;
+
+    /// Implementation of IRenderDevice::CreateQuery() in null backend.
+    void DILIGENT_CALL_TYPE CreateQuery(const QueryDesc& Desc,
+                                        IQuery**         ppQuery) override final;
+
+    /// Implementation of IRenderDevice::CreateRenderPass() in null backend.
+    void DILIGENT_CALL_TYPE CreateRenderPass(const RenderPassDesc& Desc,
+                                             IRenderPass**         ppRenderPass) override final;
+
+    /// Implementation of IRenderDevice::CreateFramebuffer() in null backend.
+    void DILIGENT_CALL_TYPE CreateFramebuffer(const FramebufferDesc& Desc,
+                                              IFramebuffer**         ppFramebuffer) override final;
+
+    /// Implementation of IRenderDevice::CreateBLAS() in null backend.
+    void DILIGENT_CALL_TYPE CreateBLAS(const BottomLevelASDesc& Desc,
+                                       IBottomLevelAS**         ppBLAS) override final;
+
+    /// Implementation of IRenderDevice::CreateTLAS() in null backend.
+    void DILIGENT_CALL_TYPE CreateTLAS(const TopLevelASDesc& Desc,
+                                       ITopLevelAS**         ppTLAS) override final;
+
+    /// Implementation of IRenderDevice::CreateSBT() in null backend.
+    void DILIGENT_CALL_TYPE CreateSBT(const ShaderBindingTableDesc& Desc,
+                                      IShaderBindingTable**         ppSBT) override final;
+
+    /// Implementation of IRenderDevice::CreatePipelineResourceSignature() in null backend.
+    void DILIGENT_CALL_TYPE CreatePipelineResourceSignature(const PipelineResourceSignatureDesc& Desc,
+                                                            IPipelineResourceSignature**         ppSignature) override final;
+
+    /// Implementation of IRenderDevice::CreateDeviceMemory() in null backend.
+    void DILIGENT_CALL_TYPE CreateDeviceMemory(const DeviceMemoryCreateInfo& CreateInfo,
+                                               IDeviceMemory**               ppMemory) override final;
+
+    /// Implementation of IRenderDevice::CreatePipelineStateCache() in null backend.
+    void DILIGENT_CALL_TYPE CreatePipelineStateCache(const PipelineStateCacheCreateInfo& CreateInfo,
+                                                     IPipelineStateCache**               ppPSOCache) override final;
+
+    /// Implementation of IRenderDevice::CreateDeferredContext() in null backend.
+    virtual void DILIGENT_CALL_TYPE CreateDeferredContext(IDeviceContext** ppContext) override final;
+
+    /// Implementation of IRenderDevice::ReleaseStaleResources() in null backend.
+    void DILIGENT_CALL_TYPE ReleaseStaleResources(bool ForceRelease = false) override final {}
+
+    /// Implementation of IRenderDevice::IdleGPU() in null backend.
+    void DILIGENT_CALL_TYPE IdleGPU() override final;
+
+    /// Implementation of IRenderDevice::GetSparseTextureFormatInfo() in null backend.
+    Bool DILIGENT_CALL_TYPE GetSparseTextureFormatInfo(TEXTURE_FORMAT           TexFormat,
+                                                       RESOURCE_DIMENSION       Dimension,
+                                                       Uint32                   SampleCount,
+                                                       SparseTextureFormatInfo& FormatInfo) const override final;
+
+public:
+    void CreatePipelineResourceSignature(const PipelineResourceSignatureDesc& Desc,
+                                         IPipelineResourceSignature**         ppSignature,
+                                         SHADER_TYPE                          ShaderStages,
+                                         bool                                 IsDeviceInternal);
+
+    void CreateBuffer(const BufferDesc& BuffDesc,
+                      const BufferData* pBuffData,
+                      IBuffer**         ppBuffer,
+                      bool              IsDeviceInternal);
+
+    void CreateTexture(const TextureDesc& TexDesc,
+                       const TextureData* pData,
+                       ITexture**         ppTexture,
+                       bool               IsDeviceInternal);
+
+    void CreateSampler(const SamplerDesc& SamplerDesc,
+                       ISampler**         ppSampler,
+                       bool               IsDeviceInternal);
+
+    Uint64 GetCommandQueueCount() const { return 1; }
+
+    Uint64 GetCommandQueueMask() const { return 1; }
+
+private:
+    void TestTextureFormat(TEXTURE_FORMAT TexFormat) override;
+
+    void FindSupportedTextureFormats();
+};
+
+} // namespace Diligent
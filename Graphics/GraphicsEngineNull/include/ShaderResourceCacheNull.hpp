@@ -0,0 +1,167 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Declaration of Diligent::ShaderResourceCacheNull class
+
+#include <memory>
+
+#include "ShaderResourceCacheCommon.hpp"
+#include "PipelineResourceSignature.h"
+#include "RefCntAutoPtr.hpp"
+#include "STDAllocator.hpp"
+#include "Align.hpp"
+#include "DebugUtilities.hpp"
+
+namespace Diligent
+{
+
+struct IMemoryAllocator;
+
+/// Shader resource cache of the null backend.
+
+/// The cache is a flat array of resources followed by the inline constant storage:
+///
+///  m_pMemory
+///  |
+///  V
+/// ||  Res[0]  |  ...  |  Res[n-1]  |  InlineConstantData[0]  |  ...  |  InlineConstantData[k-1]  ||
+///
+class ShaderResourceCacheNull : public ShaderResourceCacheBase
+{
+public:
+    explicit ShaderResourceCacheNull(ResourceCacheContentType ContentType) noexcept;
+
+    // clang-format off
+    ShaderResourceCacheNull           (const ShaderResourceCacheNull&)  = delete;
+    ShaderResourceCacheNull& operator=(const ShaderResourceCacheNull&)  = delete;
+    ShaderResourceCacheNull           (      ShaderResourceCacheNull&&) = delete;
+    ShaderResourceCacheNull& operator=(      ShaderResourceCacheNull&&) = delete;
+    // clang-format on
+
+    ~ShaderResourceCacheNull();
+
+    static size_t GetRequiredMemorySize(Uint32 NumResources, Uint32 TotalInlineConstants = 0);
+
+    void Initialize(IMemoryAllocator& MemAllocator, Uint32 NumResources, Uint32 TotalInlineConstants = 0);
+
+    void InitializeResources(Uint32 CacheOffset, Uint32 ArraySize, SHADER_RESOURCE_TYPE Type);
+
+    void InitializeInlineConstantBuffer(Uint32 CacheOffset, Uint32 InlineConstantOffset, Uint32 NumConstants);
+
+    struct Resource
+    {
+        // clang-format off
+        Resource() noexcept {}
+
+        Resource           (const Resource&)  = delete;
+        Resource           (      Resource&&) = delete;
+        Resource& operator=(const Resource&)  = delete;
+        Resource& operator=(      Resource&&) = delete;
+
+        SHADER_RESOURCE_TYPE         Type                = SHADER_RESOURCE_TYPE_UNKNOWN;
+        Uint32                       BufferDynamicOffset = 0;
+        RefCntAutoPtr<IDeviceObject> pObject;
+
+        // For constant and structured buffers only
+        Uint64                       BufferBaseOffset    = 0;
+        Uint64                       BufferRangeSize     = 0;
+
+        // For inline constants only - pointer to the constant data
+        Uint32*                      pInlineConstantData = nullptr;
+        // clang-format on
+
+        explicit operator bool() const { return pObject != nullptr; }
+    };
+
+    const Resource& GetResource(Uint32 CacheOffset) const
+    {
+        VERIFY(CacheOffset < m_NumResources, "Offset ", CacheOffset, " is out of range");
+        return GetResources()[CacheOffset];
+    }
+
+    void SetResource(Uint32                       CacheOffset,
+                     RefCntAutoPtr<IDeviceObject> pObject,
+                     Uint64                       BufferBaseOffset = 0,
+                     Uint64                       BufferRangeSize  = 0);
+
+    void ResetResource(Uint32 CacheOffset)
+    {
+        SetResource(CacheOffset, {});
+    }
+
+    void SetDynamicBufferOffset(Uint32 CacheOffset, Uint32 DynamicBufferOffset);
+
+    // Writes inline constant data to the cache.
+    // IMPORTANT: Does NOT call UpdateRevision() - inline constants can change after SRB commit.
+    void SetInlineConstants(Uint32      CacheOffset,
+                            const void* pConstants,
+                            Uint32      FirstConstant,
+                            Uint32      NumConstants);
+
+    // Copies inline constant data from the source cache to this cache
+    void CopyInlineConstants(const ShaderResourceCacheNull& SrcCache,
+                             Uint32                         SrcCacheOffset,
+                             Uint32                         DstCacheOffset,
+                             Uint32                         NumConstants);
+
+    Uint32 GetSize() const { return m_NumResources; }
+    bool   HasDynamicResources() const { return m_NumDynamicBuffers > 0; }
+    bool   HasInlineConstants() const { return m_TotalInlineConstants > 0; }
+
+    ResourceCacheContentType GetContentType() const { return m_ContentType; }
+
+private:
+    Resource* GetResources()
+    {
+        return reinterpret_cast<Resource*>(m_pMemory.get());
+    }
+    const Resource* GetResources() const
+    {
+        return reinterpret_cast<const Resource*>(m_pMemory.get());
+    }
+    Uint32* GetInlineConstantData(Uint32 Offset)
+    {
+        VERIFY(Offset < m_TotalInlineConstants, "Offset exceeds allocated inline constant storage");
+        return AlignUpPtr(reinterpret_cast<Uint32*>(GetResources() + m_NumResources)) + Offset;
+    }
+
+private:
+    std::unique_ptr<void, STDDeleter<void, IMemoryAllocator>> m_pMemory;
+
+    Uint32 m_NumResources         = 0;
+    Uint32 m_TotalInlineConstants = 0;
+
+    // The number of USAGE_DYNAMIC buffers bound in the resource cache
+    Uint32 m_NumDynamicBuffers = 0;
+
+    // Indicates what types of resources are stored in the cache
+    const ResourceCacheContentType m_ContentType;
+};
+
+} // namespace Diligent
@@ -0,0 +1,81 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Declaration of Diligent::TextureNullImpl class
+
+#include <vector>
+
+#include "EngineNullImplTraits.hpp"
+#include "Cast.hpp"
+#include "TextureBase.hpp"
+#include "TextureViewNullImpl.hpp" // Required by TextureBase
+
+namespace Diligent
+{
+
+/// Texture implementation in null backend.
+
+/// Subresources are kept in host memory using the staging texture layout
+/// (see GetStagingTextureSubresourceOffset()).
+class TextureNullImpl final : public TextureBase<EngineNullImplTraits>
+{
+public:
+    using TTextureBase = TextureBase<EngineNullImplTraits>;
+
+    TextureNullImpl(IReferenceCounters*        pRefCounters,
+                    FixedBlockMemoryAllocator& TexViewObjAllocator,
+                    RenderDeviceNullImpl*      pDevice,
+                    const TextureDesc&         Desc,
+                    const TextureData*         pInitData         = nullptr,
+                    bool                       bIsDeviceInternal = false);
+
+    ~TextureNullImpl() override;
+
+    /// Implementation of ITexture::GetNativeHandle() in null backend.
+    Uint64 DILIGENT_CALL_TYPE GetNativeHandle() override final { return BitCast<Uint64>(m_Data.data()); }
+
+    /// Returns the pointer to the texel at the given location of the subresource.
+    Uint8* GetSubresourceData(Uint32 MipLevel, Uint32 ArraySlice, Uint32 X = 0, Uint32 Y = 0, Uint32 Z = 0);
+
+    /// Returns the mapped subresource data for the given region.
+    MappedTextureSubresource GetMappedSubresource(Uint32 MipLevel, Uint32 ArraySlice, const Box& Region);
+
+    /// Writes the data to the region of the subresource. SubresData.pData must not be null.
+    void WriteRegion(Uint32 MipLevel, Uint32 ArraySlice, const Box& Region, const TextureSubResData& SubresData);
+
+    static constexpr Uint32 DataAlignment = 16;
+
+protected:
+    void CreateViewInternal(const TextureViewDesc& ViewDesc, ITextureView** ppView, bool bIsDefaultView) override;
+
+private:
+    std::vector<Uint8> m_Data;
+};
+
+} // namespace Diligent
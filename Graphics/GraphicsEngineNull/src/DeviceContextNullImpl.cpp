@@ -0,0 +1,719 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "pch.h"
+
+#include "DeviceContextNullImpl.hpp"
+
+#include <cstring>
+#include <algorithm>
+
+#include "RenderDeviceNullImpl.hpp"
+#include "TextureNullImpl.hpp"
+#include "BufferNullImpl.hpp"
+#include "PipelineStateNullImpl.hpp"
+#include "PipelineResourceSignatureNullImpl.hpp"
+#include "ShaderResourceCacheNull.hpp"
+#include "FenceNullImpl.hpp"
+#include "QueryNullImpl.hpp"
+#include "CommandListNullImpl.hpp"
+#include "GraphicsAccessories.hpp"
+#include "Align.hpp"
+
+namespace Diligent
+{
+
+DeviceContextNullImpl::DeviceContextNullImpl(IReferenceCounters*      pRefCounters,
+                                             RenderDeviceNullImpl*    pDevice,
+                                             const DeviceContextDesc& Desc) :
+    // clang-format off
+    TDeviceContextBase
+    {
+        pRefCounters,
+        pDevice,
+        Desc
+    },
+    m_CmdListAllocator{GetRawAllocator(), sizeof(CommandListNullImpl), 64}
+// clang-format on
+{
+}
+
+void DeviceContextNullImpl::Begin(Uint32 ImmediateContextId)
+{
+    DEV_CHECK_ERR(ImmediateContextId == 0, "Null device has only one immediate context");
+    TDeviceContextBase::Begin(DeviceContextIndex{ImmediateContextId}, COMMAND_QUEUE_TYPE_GRAPHICS);
+}
+
+void DeviceContextNullImpl::SetPipelineState(IPipelineState* pPipelineState)
+{
+    if (!TDeviceContextBase::SetPipelineState(pPipelineState, PipelineStateNullImpl::IID_InternalImpl))
+        return;
+
+    Uint32 DvpCompatibleSRBCount = 0;
+    PrepareCommittedResources(m_BindInfo, DvpCompatibleSRBCount);
+    // Commit all SRBs when PSO changes
+    m_BindInfo.StaleSRBMask |= m_BindInfo.ActiveSRBMask;
+}
+
+void DeviceContextNullImpl::TransitionShaderResources(IShaderResourceBinding* pShaderResourceBinding)
+{
+    DEV_CHECK_ERR(pShaderResourceBinding != nullptr, "Shader resource binding must not be null");
+}
+
+#ifdef DILIGENT_DEVELOPMENT
+void DeviceContextNullImpl::DvpValidateCommittedShaderResources()
+{
+    if (m_BindInfo.ResourcesValidated)
+        return;
+
+    DvpVerifySRBCompatibility(m_BindInfo);
+
+    m_BindInfo.ResourcesValidated = true;
+}
+#endif
+
+void DeviceContextNullImpl::CommitShaderResources(IShaderResourceBinding*        pShaderResourceBinding,
+                                                  RESOURCE_STATE_TRANSITION_MODE StateTransitionMode)
+{
+    TDeviceContextBase::CommitShaderResources(pShaderResourceBinding, StateTransitionMode, 0 /*Dummy*/);
+
+    ShaderResourceBindingNullImpl* pResBindingNull = ClassPtrCast<ShaderResourceBindingNullImpl>(pShaderResourceBinding);
+    m_BindInfo.Set(pResBindingNull->GetBindingIndex(), pResBindingNull);
+}
+
+void DeviceContextNullImpl::InvalidateState()
+{
+    TDeviceContextBase::InvalidateState();
+    m_BindInfo = {};
+}
+
+void DeviceContextNullImpl::SetStencilRef(Uint32 StencilRef)
+{
+    TDeviceContextBase::SetStencilRef(StencilRef, 0);
+}
+
+void DeviceContextNullImpl::SetBlendFactors(const float* pBlendFactors)
+{
+    TDeviceContextBase::SetBlendFactors(pBlendFactors, 0);
+}
+
+void DeviceContextNullImpl::SetVertexBuffers(Uint32                         StartSlot,
+                                             Uint32                         NumBuffersSet,
+                                             IBuffer* const*                ppBuffers,
+                                             const Uint64*                  pOffsets,
+                                             RESOURCE_STATE_TRANSITION_MODE StateTransitionMode,
+                                             SET_VERTEX_BUFFERS_FLAGS       Flags)
+{
+    TDeviceContextBase::SetVertexBuffers(StartSlot, NumBuffersSet, ppBuffers, pOffsets, StateTransitionMode, Flags);
+}
+
+void DeviceContextNullImpl::SetIndexBuffer(IBuffer*                       pIndexBuffer,
+                                           Uint64                         ByteOffset,
+                                           RESOURCE_STATE_TRANSITION_MODE StateTransitionMode)
+{
+    TDeviceContextBase::SetIndexBuffer(pIndexBuffer, ByteOffset, StateTransitionMode);
+}
+
+void DeviceContextNullImpl::SetViewports(Uint32          NumViewports,
+                                         const Viewport* pViewports,
+                                         Uint32          RTWidth,
+                                         Uint32          RTHeight)
+{
+    TDeviceContextBase::SetViewports(NumViewports, pViewports, RTWidth, RTHeight);
+}
+
+void DeviceContextNullImpl::SetScissorRects(Uint32 NumRects, const Rect* pRects, Uint32 RTWidth, Uint32 RTHeight)
+{
+    TDeviceContextBase::SetScissorRects(NumRects, pRects, RTWidth, RTHeight);
+}
+
+void DeviceContextNullImpl::SetRenderTargetsExt(const SetRenderTargetsAttribs& Attribs)
+{
+    if (TDeviceContextBase::SetRenderTargets(Attribs))
+        SetViewports(1, nullptr, 0, 0);
+}
+
+void DeviceContextNullImpl::BeginRenderPass(const BeginRenderPassAttribs& Attribs)
+{
+    TDeviceContextBase::BeginRenderPass(Attribs);
+}
+
+void DeviceContextNullImpl::NextSubpass()
+{
+    TDeviceContextBase::NextSubpass();
+}
+
+void DeviceContextNullImpl::EndRenderPass()
+{
+    TDeviceContextBase::EndRenderPass();
+}
+
+void DeviceContextNullImpl::PrepareForDraw(DRAW_FLAGS Flags)
+{
+    DEV_CHECK_ERR(m_pPipelineState != nullptr, "No PSO is bound in the context");
+
+#ifdef DILIGENT_DEVELOPMENT
+    DvpVerifyRenderTargets();
+#endif
+
+    const bool DynamicBuffersIntact  = (Flags & DRAW_FLAG_DYNAMIC_RESOURCE_BUFFERS_INTACT) != 0;
+    const bool InlineConstantsIntact = (Flags & DRAW_FLAG_INLINE_CONSTANTS_INTACT) != 0;
+    // There are no GPU bindings to update, but the stale mask is processed the same way
+    // as in other backends so that the CPU cost of the commit logic is accounted for.
+    if (CommittedShaderResources::SRBMaskType CommitSRBMask = m_BindInfo.GetCommitMask(DynamicBuffersIntact, InlineConstantsIntact))
+        m_BindInfo.StaleSRBMask &= ~CommitSRBMask;
+}
+
+void DeviceContextNullImpl::PrepareForDispatchCompute()
+{
+    DEV_CHECK_ERR(m_pPipelineState != nullptr, "No PSO is bound in the context");
+
+    if (CommittedShaderResources::SRBMaskType CommitSRBMask = m_BindInfo.GetCommitMask())
+        m_BindInfo.StaleSRBMask &= ~CommitSRBMask;
+}
+
+void DeviceContextNullImpl::Draw(const DrawAttribs& Attribs)
+{
+    TDeviceContextBase::Draw(Attribs, 0);
+
+#ifdef DILIGENT_DEVELOPMENT
+    DvpValidateCommittedShaderResources();
+#endif
+
+    if (Attribs.NumVertices == 0 || Attribs.NumInstances == 0)
+        return;
+
+    PrepareForDraw(Attribs.Flags);
+}
+
+void DeviceContextNullImpl::MultiDraw(const MultiDrawAttribs& Attribs)
+{
+    TDeviceContextBase::MultiDraw(Attribs, 0);
+
+#ifdef DILIGENT_DEVELOPMENT
+    DvpValidateCommittedShaderResources();
+#endif
+
+    if (Attribs.NumInstances == 0 || Attribs.DrawCount == 0)
+        return;
+
+    PrepareForDraw(Attribs.Flags);
+}
+
+void DeviceContextNullImpl::DrawIndexed(const DrawIndexedAttribs& Attribs)
+{
+    TDeviceContextBase::DrawIndexed(Attribs, 0);
+
+#ifdef DILIGENT_DEVELOPMENT
+    DvpValidateCommittedShaderResources();
+#endif
+
+    if (Attribs.NumIndices == 0 || Attribs.NumInstances == 0)
+        return;
+
+    PrepareForDraw(Attribs.Flags);
+}
+
+void DeviceContextNullImpl::MultiDrawIndexed(const MultiDrawIndexedAttribs& Attribs)
+{
+    TDeviceContextBase::MultiDrawIndexed(Attribs, 0);
+
+#ifdef DILIGENT_DEVELOPMENT
+    DvpValidateCommittedShaderResources();
+#endif
+
+    if (Attribs.NumInstances == 0 || Attribs.DrawCount == 0)
+        return;
+
+    PrepareForDraw(Attribs.Flags);
+}
+
+void DeviceContextNullImpl::DrawIndirect(const DrawIndirectAttribs& Attribs)
+{
+    TDeviceContextBase::DrawIndirect(Attribs, 0);
+
+#ifdef DILIGENT_DEVELOPMENT
+    DvpValidateCommittedShaderResources();
+#endif
+
+    PrepareForDraw(Attribs.Flags);
+}
+
+void DeviceContextNullImpl::DrawIndexedIndirect(const DrawIndexedIndirectAttribs& Attribs)
+{
+    TDeviceContextBase::DrawIndexedIndirect(Attribs, 0);
+
+#ifdef DILIGENT_DEVELOPMENT
+    DvpValidateCommittedShaderResources();
+#endif
+
+    PrepareForDraw(Attribs.Flags);
+}
+
+void DeviceContextNullImpl::DrawMesh(const DrawMeshAttribs& Attribs)
+{
+    UNSUPPORTED("DrawMesh is not supported by null device");
+}
+
+void DeviceContextNullImpl::DrawMeshIndirect(const DrawMeshIndirectAttribs& Attribs)
+{
+    UNSUPPORTED("DrawMeshIndirect is not supported by null device");
+}
+
+void DeviceContextNullImpl::DispatchCompute(const DispatchComputeAttribs& Attribs)
+{
+    TDeviceContextBase::DispatchCompute(Attribs, 0);
+
+#ifdef DILIGENT_DEVELOPMENT
+    DvpValidateCommittedShaderResources();
+#endif
+
+    if (Attribs.ThreadGroupCountX == 0 || Attribs.ThreadGroupCountY == 0 || Attribs.ThreadGroupCountZ == 0)
+        return;
+
+    PrepareForDispatchCompute();
+}
+
+void DeviceContextNullImpl::DispatchComputeIndirect(const DispatchComputeIndirectAttribs& Attribs)
+{
+    TDeviceContextBase::DispatchComputeIndirect(Attribs, 0);
+
+#ifdef DILIGENT_DEVELOPMENT
+    DvpValidateCommittedShaderResources();
+#endif
+
+    PrepareForDispatchCompute();
+}
+
+void DeviceContextNullImpl::ClearDepthStencil(ITextureView*                  pView,
+                                              CLEAR_DEPTH_STENCIL_FLAGS      ClearFlags,
+                                              float                          Depth,
+                                              Uint8                          Stencil,
+                                              RESOURCE_STATE_TRANSITION_MODE StateTransitionMode)
+{
+    // Render target contents are not emulated
+    TDeviceContextBase::ClearDepthStencil(pView);
+}
+
+void DeviceContextNullImpl::ClearRenderTarget(ITextureView*                  pView,
+                                              const void*                    RGBA,
+                                              RESOURCE_STATE_TRANSITION_MODE StateTransitionMode)
+{
+    // Render target contents are not emulated
+    TDeviceContextBase::ClearRenderTarget(pView);
+}
+
+void DeviceContextNullImpl::UpdateBuffer(IBuffer*                       pBuffer,
+                                         Uint64                         Offset,
+                                         Uint64                         Size,
+                                         const void*                    pData,
+                                         RESOURCE_STATE_TRANSITION_MODE StateTransitionMode)
+{
+    TDeviceContextBase::UpdateBuffer(pBuffer, Offset, Size, pData, StateTransitionMode);
+
+    BufferNullImpl* const pBufferNull = ClassPtrCast<BufferNullImpl>(pBuffer);
+    const BufferDesc&     BuffDesc    = pBufferNull->GetDesc();
+    if (BuffDesc.Usage == USAGE_DEFAULT || BuffDesc.Usage == USAGE_SPARSE)
+    {
+        memcpy(pBufferNull->GetData() + Offset, pData, StaticCast<size_t>(Size));
+    }
+    else
+    {
+        LOG_ERROR_MESSAGE(GetUsageString(BuffDesc.Usage), " buffers can't be updated using UpdateBuffer method");
+    }
+}
+
+void DeviceContextNullImpl::CopyBuffer(IBuffer*                       pSrcBuffer,
+                                       Uint64                         SrcOffset,
+                                       RESOURCE_STATE_TRANSITION_MODE SrcBufferTransitionMode,
+                                       IBuffer*                       pDstBuffer,
+                                       Uint64                         DstOffset,
+                                       Uint64                         Size,
+                                       RESOURCE_STATE_TRANSITION_MODE DstBufferTransitionMode)
+{
+    TDeviceContextBase::CopyBuffer(pSrcBuffer, SrcOffset, SrcBufferTransitionMode, pDstBuffer, DstOffset, Size, DstBufferTransitionMode);
+
+    const BufferNullImpl* const pSrcBufferNull = ClassPtrCast<BufferNullImpl>(pSrcBuffer);
+    BufferNullImpl* const       pDstBufferNull = ClassPtrCast<BufferNullImpl>(pDstBuffer);
+    // Source and destination ranges may belong to the same buffer
+    memmove(pDstBufferNull->GetData() + DstOffset, pSrcBufferNull->GetData() + SrcOffset, StaticCast<size_t>(Size));
+}
+
+Uint8* DeviceContextNullImpl::AllocateDynamicSpace(size_t Size)
+{
+    static constexpr size_t DynamicPageSize  = size_t{4} << 20;
+    static constexpr size_t DynamicAlignment = 16;
+
+    Size = AlignUp(Size, DynamicAlignment);
+    while (m_CurrDynamicPage < m_DynamicPages.size() &&
+           m_CurrDynamicPageOffset + Size > m_DynamicPages[m_CurrDynamicPage].size())
+    {
+        ++m_CurrDynamicPage;
+        m_CurrDynamicPageOffset = 0;
+    }
+    if (m_CurrDynamicPage == m_DynamicPages.size())
+        m_DynamicPages.emplace_back(std::max(Size, DynamicPageSize));
+
+    Uint8* const pData = m_DynamicPages[m_CurrDynamicPage].data() + m_CurrDynamicPageOffset;
+    m_CurrDynamicPageOffset += Size;
+    return pData;
+}
+
+void DeviceContextNullImpl::MapBuffer(IBuffer*  pBuffer,
+                                      MAP_TYPE  MapType,
+                                      MAP_FLAGS MapFlags,
+                                      PVoid&    pMappedData)
+{
+    TDeviceContextBase::MapBuffer(pBuffer, MapType, MapFlags, pMappedData);
+
+    BufferNullImpl* const pBufferNull = ClassPtrCast<BufferNullImpl>(pBuffer);
+    const BufferDesc&     BuffDesc    = pBufferNull->GetDesc();
+    if (MapType == MAP_WRITE && BuffDesc.Usage == USAGE_DYNAMIC)
+    {
+        Uint8*& pDynamicData = m_DynamicAllocations[pBufferNull->GetUniqueID()];
+        if ((MapFlags & MAP_FLAG_DISCARD) != 0 || pDynamicData == nullptr)
+        {
+            if ((MapFlags & MAP_FLAG_DISCARD) == 0)
+            {
+                LOG_ERROR_MESSAGE("Dynamic buffer '", BuffDesc.Name,
+                                  "' must be mapped with MAP_FLAG_DISCARD before it is mapped with MAP_FLAG_NO_OVERWRITE in the current frame");
+            }
+            pDynamicData = AllocateDynamicSpace(StaticCast<size_t>(BuffDesc.Size));
+        }
+        // With MAP_FLAG_NO_OVERWRITE, return the same region so that the data written by the
+        // previous maps in this frame is preserved.
+        pMappedData = pDynamicData;
+    }
+    else
+    {
+        // Staging and unified buffers live in host memory
+        pMappedData = pBufferNull->GetData();
+    }
+}
+
+void DeviceContextNullImpl::UnmapBuffer(IBuffer* pBuffer, MAP_TYPE MapType)
+{
+    TDeviceContextBase::UnmapBuffer(pBuffer, MapType);
+
+    BufferNullImpl* const pBufferNull = ClassPtrCast<BufferNullImpl>(pBuffer);
+    const BufferDesc&     BuffDesc    = pBufferNull->GetDesc();
+    if (MapType == MAP_WRITE && BuffDesc.Usage == USAGE_DYNAMIC)
+    {
+        auto it = m_DynamicAllocations.find(pBufferNull->GetUniqueID());
+        if (it != m_DynamicAllocations.end())
+        {
+            // Emulate the upload of the dynamic data to the GPU so that the buffer
+            // contents can be read back and copied.
+            memcpy(pBufferNull->GetData(), it->second, StaticCast<size_t>(BuffDesc.Size));
+        }
+        else
+        {
+            UNEXPECTED("Dynamic buffer '", BuffDesc.Name, "' has not been mapped in this context");
+        }
+    }
+}
+
+void DeviceContextNullImpl::UpdateTexture(ITexture*                      pTexture,
+                                          Uint32                         MipLevel,
+                                          Uint32                         Slice,
+                                          const Box&                     DstBox,
+                                          const TextureSubResData&       SubresData,
+                                          RESOURCE_STATE_TRANSITION_MODE SrcBufferStateTransitionMode,
+                                          RESOURCE_STATE_TRANSITION_MODE DstTextureStateTransitionMode)
+{
+    TDeviceContextBase::UpdateTexture(pTexture, MipLevel, Slice, DstBox, SubresData, SrcBufferStateTransitionMode, DstTextureStateTransitionMode);
+
+    TextureSubResData HostSubresData = SubresData;
+    if (SubresData.pSrcBuffer != nullptr)
+    {
+        HostSubresData.pData      = ClassPtrCast<const BufferNullImpl>(SubresData.pSrcBuffer)->GetData() + SubresData.SrcOffset;
+        HostSubresData.pSrcBuffer = nullptr;
+        HostSubresData.SrcOffset  = 0;
+    }
+
+    ClassPtrCast<TextureNullImpl>(pTexture)->WriteRegion(MipLevel, Slice, DstBox, HostSubresData);
+}
+
+void DeviceContextNullImpl::CopyTexture(const CopyTextureAttribs& CopyAttribs)
+{
+    TDeviceContextBase::CopyTexture(CopyAttribs);
+
+    TextureNullImpl* const pSrcTexNull = ClassPtrCast<TextureNullImpl>(CopyAttribs.pSrcTexture);
+    TextureNullImpl* const pDstTexNull = ClassPtrCast<TextureNullImpl>(CopyAttribs.pDstTexture);
+
+    Box SrcBox;
+    if (CopyAttribs.pSrcBox != nullptr)
+    {
+        SrcBox = *CopyAttribs.pSrcBox;
+    }
+    else
+    {
+        const MipLevelProperties MipProps = GetMipLevelProperties(pSrcTexNull->GetDesc(), CopyAttribs.SrcMipLevel);
+
+        SrcBox.MaxX = MipProps.LogicalWidth;
+        SrcBox.MaxY = MipProps.LogicalHeight;
+        SrcBox.MaxZ = MipProps.Depth;
+    }
+
+    const MappedTextureSubresource SrcData = pSrcTexNull->GetMappedSubresource(CopyAttribs.SrcMipLevel, CopyAttribs.SrcSlice, SrcBox);
+
+    TextureSubResData DstSubresData;
+    DstSubresData.pData       = SrcData.pData;
+    DstSubresData.Stride      = SrcData.Stride;
+    DstSubresData.DepthStride = SrcData.DepthStride;
+
+    const Box DstBox{
+        CopyAttribs.DstX,
+        CopyAttribs.DstX + SrcBox.Width(),
+        CopyAttribs.DstY,
+        CopyAttribs.DstY + SrcBox.Height(),
+        CopyAttribs.DstZ,
+        CopyAttribs.DstZ + SrcBox.Depth(),
+    };
+    pDstTexNull->WriteRegion(CopyAttribs.DstMipLevel, CopyAttribs.DstSlice, DstBox, DstSubresData);
+}
+
+void DeviceContextNullImpl::MapTextureSubresource(ITexture*                 pTexture,
+                                                  Uint32                    MipLevel,
+                                                  Uint32                    ArraySlice,
+                                                  MAP_TYPE                  MapType,
+                                                  MAP_FLAGS                 MapFlags,
+                                                  const Box*                pMapRegion,
+                                                  MappedTextureSubresource& MappedData)
+{
+    TDeviceContextBase::MapTextureSubresource(pTexture, MipLevel, ArraySlice, MapType, MapFlags, pMapRegion, MappedData);
+
+    TextureNullImpl* const pTextureNull = ClassPtrCast<TextureNullImpl>(pTexture);
+
+    Box FullExtentBox;
+    if (pMapRegion == nullptr)
+    {
+        const MipLevelProperties MipProps = GetMipLevelProperties(pTextureNull->GetDesc(), MipLevel);
+
+        FullExtentBox.MaxX = MipProps.LogicalWidth;
+        FullExtentBox.MaxY = MipProps.LogicalHeight;
+        FullExtentBox.MaxZ = MipProps.Depth;
+        pMapRegion         = &FullExtentBox;
+    }
+
+    MappedData = pTextureNull->GetMappedSubresource(MipLevel, ArraySlice, *pMapRegion);
+}
+
+void DeviceContextNullImpl::UnmapTextureSubresource(ITexture* pTexture, Uint32 MipLevel, Uint32 ArraySlice)
+{
+    TDeviceContextBase::UnmapTextureSubresource(pTexture, MipLevel, ArraySlice);
+}
+
+void DeviceContextNullImpl::FinishCommandList(ICommandList** ppCommandList)
+{
+    DEV_CHECK_ERR(IsDeferred(), "Only deferred contexts can record command list");
+    DEV_CHECK_ERR(m_pActiveRenderPass == nullptr, "Finishing command list inside an active render pass.");
+
+    CommandListNullImpl* pCmdListNull(NEW_RC_OBJ(m_CmdListAllocator, "CommandListNullImpl instance", CommandListNullImpl)(m_pDevice, this));
+    pCmdListNull->QueryInterface(IID_CommandList, reinterpret_cast<IObject**>(ppCommandList));
+
+    // Device context is now in default state
+    InvalidateState();
+
+    TDeviceContextBase::FinishCommandList();
+}
+
+void DeviceContextNullImpl::ExecuteCommandLists(Uint32               NumCommandLists,
+                                                ICommandList* const* ppCommandLists)
+{
+    DEV_CHECK_ERR(!IsDeferred(), "Only immediate context can execute command list");
+
+    if (NumCommandLists == 0)
+        return;
+    DEV_CHECK_ERR(ppCommandLists != nullptr, "ppCommandLists must not be null when NumCommandLists is not zero");
+
+    // Commands have been executed when they were recorded, so the lists only need to be released.
+    // Device context is now in default state.
+    InvalidateState();
+}
+
+void DeviceContextNullImpl::EnqueueSignal(IFence* pFence, Uint64 Value)
+{
+    TDeviceContextBase::EnqueueSignal(pFence, Value, 0);
+    // All previous commands have completed at this point
+    ClassPtrCast<FenceNullImpl>(pFence)->Signal(Value);
+}
+
+void DeviceContextNullImpl::DeviceWaitForFence(IFence* pFence, Uint64 Value)
+{
+    TDeviceContextBase::DeviceWaitForFence(pFence, Value, 0);
+}
+
+void DeviceContextNullImpl::WaitForIdle()
+{
+    DEV_CHECK_ERR(!IsDeferred(), "Only immediate contexts can be idled");
+}
+
+void DeviceContextNullImpl::BeginQuery(IQuery* pQuery)
+{
+    TDeviceContextBase::BeginQuery(pQuery, 0);
+    ClassPtrCast<QueryNullImpl>(pQuery)->OnBeginQuery(this);
+}
+
+void DeviceContextNullImpl::EndQuery(IQuery* pQuery)
+{
+    TDeviceContextBase::EndQuery(pQuery, 0);
+    ClassPtrCast<QueryNullImpl>(pQuery)->OnEndQuery(this);
+}
+
+void DeviceContextNullImpl::Flush()
+{
+    DEV_CHECK_ERR(!IsDeferred(), "Flush() should only be called for immediate contexts.");
+}
+
+void DeviceContextNullImpl::BuildBLAS(const BuildBLASAttribs& Attribs)
+{
+    UNSUPPORTED("BuildBLAS is not supported by null device");
+}
+
+void DeviceContextNullImpl::BuildTLAS(const BuildTLASAttribs& Attribs)
+{
+    UNSUPPORTED("BuildTLAS is not supported by null device");
+}
+
+void DeviceContextNullImpl::CopyBLAS(const CopyBLASAttribs& Attribs)
+{
+    UNSUPPORTED("CopyBLAS is not supported by null device");
+}
+
+void DeviceContextNullImpl::CopyTLAS(const CopyTLASAttribs& Attribs)
+{
+    UNSUPPORTED("CopyTLAS is not supported by null device");
+}
+
+void DeviceContextNullImpl::WriteBLASCompactedSize(const WriteBLASCompactedSizeAttribs& Attribs)
+{
+    UNSUPPORTED("WriteBLASCompactedSize is not supported by null device");
+}
+
+void DeviceContextNullImpl::WriteTLASCompactedSize(const WriteTLASCompactedSizeAttribs& Attribs)
+{
+    UNSUPPORTED("WriteTLASCompactedSize is not supported by null device");
+}
+
+void DeviceContextNullImpl::TraceRays(const TraceRaysAttribs& Attribs)
+{
+    UNSUPPORTED("TraceRays is not supported by null device");
+}
+
+void DeviceContextNullImpl::TraceRaysIndirect(const TraceRaysIndirectAttribs& Attribs)
+{
+    UNSUPPORTED("TraceRaysIndirect is not supported by null device");
+}
+
+void DeviceContextNullImpl::UpdateSBT(IShaderBindingTable*                 pSBT,
+                                      const UpdateIndirectRTBufferAttribs* pUpdateIndirectBufferAttribs)
+{
+    UNSUPPORTED("UpdateSBT is not supported by null device");
+}
+
+void DeviceContextNullImpl::SetShadingRate(SHADING_RATE          BaseRate,
+                                           SHADING_RATE_COMBINER PrimitiveCombiner,
+                                           SHADING_RATE_COMBINER TextureCombiner)
+{
+    UNSUPPORTED("SetShadingRate is not supported by null device");
+}
+
+void DeviceContextNullImpl::BindSparseResourceMemory(const BindSparseResourceMemoryAttribs& Attribs)
+{
+    UNSUPPORTED("BindSparseResourceMemory is not supported by null device");
+}
+
+void DeviceContextNullImpl::BeginDebugGroup(const Char* Name, const float* pColor)
+{
+    TDeviceContextBase::BeginDebugGroup(Name, pColor, 0);
+}
+
+void DeviceContextNullImpl::EndDebugGroup()
+{
+    TDeviceContextBase::EndDebugGroup(0);
+}
+
+void DeviceContextNullImpl::InsertDebugLabel(const Char* Label, const float* pColor)
+{
+    TDeviceContextBase::InsertDebugLabel(Label, pColor, 0);
+}
+
+void DeviceContextNullImpl::GenerateMips(ITextureView* pTexView)
+{
+    // Mip levels are not generated as texture contents are only preserved for CPU access
+    TDeviceContextBase::GenerateMips(pTexView);
+}
+
+void DeviceContextNullImpl::FinishFrame()
+{
+    if (m_pActiveRenderPass != nullptr)
+        LOG_ERROR_MESSAGE("Finishing frame inside an active render pass.");
+
+    // Dynamic allocations are only valid until the end of the frame
+    m_DynamicAllocations.clear();
+    m_CurrDynamicPage       = 0;
+    m_CurrDynamicPageOffset = 0;
+
+    TDeviceContextBase::EndFrame();
+}
+
+void DeviceContextNullImpl::TransitionResourceStates(Uint32 BarrierCount, const StateTransitionDesc* pResourceBarriers)
+{
+    DEV_CHECK_ERR(m_pActiveRenderPass == nullptr, "State transitions are not allowed inside a render pass");
+
+    for (Uint32 i = 0; i < BarrierCount; ++i)
+    {
+        const StateTransitionDesc& Barrier = pResourceBarriers[i];
+#ifdef DILIGENT_DEVELOPMENT
+        DvpVerifyStateTransitionDesc(Barrier);
+#endif
+
+        if (Barrier.TransitionType == STATE_TRANSITION_TYPE_BEGIN ||
+            (Barrier.Flags & STATE_TRANSITION_FLAG_UPDATE_STATE) == 0 ||
+            (Barrier.Flags & STATE_TRANSITION_FLAG_ALIASING) != 0)
+            continue;
+
+        if (RefCntAutoPtr<ITexture> pTexture{Barrier.pResource, IID_Texture})
+            pTexture->SetState(Barrier.NewState);
+        else if (RefCntAutoPtr<IBuffer> pBuffer{Barrier.pResource, IID_Buffer})
+            pBuffer->SetState(Barrier.NewState);
+    }
+}
+
+ICommandQueue* DeviceContextNullImpl::LockCommandQueue() { return nullptr; }
+
+void DeviceContextNullImpl::UnlockCommandQueue() {}
+
+void DeviceContextNullImpl::ResolveTextureSubresource(ITexture*                               pSrcTexture,
+                                                      ITexture*                               pDstTexture,
+                                                      const ResolveTextureSubresourceAttribs& ResolveAttribs)
+{
+    // Render target contents are not emulated
+    TDeviceContextBase::ResolveTextureSubresource(pSrcTexture, pDstTexture, ResolveAttribs);
+}
+
+} // namespace Diligent
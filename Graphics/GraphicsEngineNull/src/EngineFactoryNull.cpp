@@ -0,0 +1,299 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+/// \file
+/// Routines that initialize null-based engine implementation
+
+#include "pch.h"
+
+#include "EngineFactoryNull.h"
+#include "RenderDeviceNullImpl.hpp"
+#include "DeviceContextNullImpl.hpp"
+#include "EngineFactoryBase.hpp"
+#include "EngineMemory.h"
+
+namespace Diligent
+{
+
+/// Engine factory for null implementation
+class EngineFactoryNullImpl final : public EngineFactoryBase<IEngineFactoryNull>
+{
+public:
+    static EngineFactoryNullImpl* GetInstance()
+    {
+        static EngineFactoryNullImpl TheFactory;
+        return &TheFactory;
+    }
+
+    using TBase = EngineFactoryBase;
+
+    EngineFactoryNullImpl() :
+        TBase{IID_EngineFactoryNull}
+    {}
+
+    void DILIGENT_CALL_TYPE EnumerateAdapters(Version              MinVersion,
+                                              Uint32&              NumAdapters,
+                                              GraphicsAdapterInfo* Adapters) const override final;
+
+    void DILIGENT_CALL_TYPE CreateDearchiver(const DearchiverCreateInfo& CreateInfo,
+                                             IDearchiver**               ppDearchiver) const override final;
+
+    void DILIGENT_CALL_TYPE CreateDeviceAndContextsNull(const EngineCreateInfo& EngineCI,
+                                                        IRenderDevice**         ppDevice,
+                                                        IDeviceContext**        ppContexts) override final;
+};
+
+namespace
+{
+
+GraphicsAdapterInfo GetNullAdapterInfo()
+{
+    GraphicsAdapterInfo AdapterInfo;
+
+    static constexpr char Description[] = "Null device";
+    static_assert(sizeof(Description) <= sizeof(AdapterInfo.Description), "Description is too long");
+    memcpy(AdapterInfo.Description, Description, sizeof(Description));
+
+    AdapterInfo.Type   = ADAPTER_TYPE_SOFTWARE;
+    AdapterInfo.Vendor = ADAPTER_VENDOR_UNKNOWN;
+
+    // Enable all features that do not require shader execution or hardware-specific objects
+    {
+        DeviceFeatures& Features{AdapterInfo.Features};
+        Features = DeviceFeatures{DEVICE_FEATURE_STATE_ENABLED};
+
+        Features.ShaderResourceQueries         = DEVICE_FEATURE_STATE_DISABLED;
+        Features.MeshShaders                   = DEVICE_FEATURE_STATE_DISABLED;
+        Features.RayTracing                    = DEVICE_FEATURE_STATE_DISABLED;
+        Features.WaveOp                        = DEVICE_FEATURE_STATE_DISABLED;
+        Features.TileShaders                   = DEVICE_FEATURE_STATE_DISABLED;
+        Features.TransferQueueTimestampQueries = DEVICE_FEATURE_STATE_DISABLED;
+        Features.VariableRateShading           = DEVICE_FEATURE_STATE_DISABLED;
+        Features.SparseResources               = DEVICE_FEATURE_STATE_DISABLED;
+        Features.SubpassFramebufferFetch       = DEVICE_FEATURE_STATE_DISABLED;
+    }
+
+    // Set adapter memory info
+    {
+        AdapterMemoryInfo& MemoryInfo{AdapterInfo.Memory};
+        MemoryInfo.UnifiedMemoryCPUAccess = CPU_ACCESS_READ | CPU_ACCESS_WRITE;
+    }
+
+    // Draw command properties
+    {
+        DrawCommandProperties& DrawCommandInfo{AdapterInfo.DrawCommand};
+        DrawCommandInfo.MaxIndexValue        = ~0u;
+        DrawCommandInfo.MaxDrawIndirectCount = ~0u;
+        DrawCommandInfo.CapFlags =
+            DRAW_COMMAND_CAP_FLAG_BASE_VERTEX |
+            DRAW_COMMAND_CAP_FLAG_DRAW_INDIRECT |
+            DRAW_COMMAND_CAP_FLAG_DRAW_INDIRECT_FIRST_INSTANCE |
+            DRAW_COMMAND_CAP_FLAG_NATIVE_MULTI_DRAW_INDIRECT |
+            DRAW_COMMAND_CAP_FLAG_DRAW_INDIRECT_COUNTER_BUFFER;
+    }
+
+    // Set queue info
+    {
+        AdapterInfo.NumQueues                           = 1;
+        AdapterInfo.Queues[0].QueueType                 = COMMAND_QUEUE_TYPE_GRAPHICS;
+        AdapterInfo.Queues[0].MaxDeviceContexts         = 1;
+        AdapterInfo.Queues[0].TextureCopyGranularity[0] = 1;
+        AdapterInfo.Queues[0].TextureCopyGranularity[1] = 1;
+        AdapterInfo.Queues[0].TextureCopyGranularity[2] = 1;
+    }
+
+    // Set compute shader info
+    {
+        ComputeShaderProperties& ComputeShaderInfo{AdapterInfo.ComputeShader};
+
+        ComputeShaderInfo.MaxThreadGroupSizeX = 1024;
+        ComputeShaderInfo.MaxThreadGroupSizeY = 1024;
+        ComputeShaderInfo.MaxThreadGroupSizeZ = 64;
+
+        ComputeShaderInfo.MaxThreadGroupCountX = 65535;
+        ComputeShaderInfo.MaxThreadGroupCountY = 65535;
+        ComputeShaderInfo.MaxThreadGroupCountZ = 65535;
+
+        ComputeShaderInfo.SharedMemorySize          = 32768;
+        ComputeShaderInfo.MaxThreadGroupInvocations = 1024;
+    }
+
+    // Set texture info
+    {
+        TextureProperties& TextureInfo{AdapterInfo.Texture};
+
+        TextureInfo.MaxTexture1DDimension   = 16384;
+        TextureInfo.MaxTexture1DArraySlices = 2048;
+        TextureInfo.MaxTexture2DDimension   = 16384;
+        TextureInfo.MaxTexture2DArraySlices = 2048;
+        TextureInfo.MaxTexture3DDimension   = 2048;
+        TextureInfo.MaxTextureCubeDimension = 16384;
+
+        TextureInfo.Texture2DMSSupported       = True;
+        TextureInfo.Texture2DMSArraySupported  = True;
+        TextureInfo.TextureViewSupported       = True;
+        TextureInfo.CubemapArraysSupported     = True;
+        TextureInfo.TextureView2DOn3DSupported = True;
+    }
+
+    // Set buffer info
+    {
+        BufferProperties& BufferInfo{AdapterInfo.Buffer};
+        BufferInfo.ConstantBufferOffsetAlignment   = 16;
+        BufferInfo.StructuredBufferOffsetAlignment = 16;
+        BufferInfo.TextureUpdateOffsetAlignment    = 16;
+        BufferInfo.TextureUpdateStrideAlignment    = 16;
+        ASSERT_SIZEOF(BufferInfo, 16, "Did you add a new member to BufferProperties? Please initialize it here.");
+    }
+
+    // Set sampler info
+    {
+        SamplerProperties& SamplerInfo{AdapterInfo.Sampler};
+        SamplerInfo.BorderSamplingModeSupported = True;
+        SamplerInfo.MaxAnisotropy               = 16;
+        SamplerInfo.LODBiasSupported            = True;
+    }
+
+    return AdapterInfo;
+}
+
+} // namespace
+
+void EngineFactoryNullImpl::EnumerateAdapters(Version              MinVersion,
+                                              Uint32&              NumAdapters,
+                                              GraphicsAdapterInfo* Adapters) const
+{
+    if (Adapters == nullptr)
+        NumAdapters = 1;
+    else if (NumAdapters > 0)
+    {
+        NumAdapters = 1;
+        Adapters[0] = GetNullAdapterInfo();
+    }
+}
+
+void EngineFactoryNullImpl::CreateDearchiver(const DearchiverCreateInfo& CreateInfo,
+                                             IDearchiver**               ppDearchiver) const
+{
+    LOG_ERROR_MESSAGE("Device object archives are not supported by null device");
+    if (ppDearchiver != nullptr)
+        *ppDearchiver = nullptr;
+}
+
+void EngineFactoryNullImpl::CreateDeviceAndContextsNull(const EngineCreateInfo& EngineCI,
+                                                        IRenderDevice**         ppDevice,
+                                                        IDeviceContext**        ppContexts)
+{
+    if (EngineCI.EngineAPIVersion != DILIGENT_API_VERSION)
+    {
+        LOG_ERROR_MESSAGE("Diligent Engine runtime (", DILIGENT_API_VERSION, ") is not compatible with the client API version (", EngineCI.EngineAPIVersion, ")");
+        return;
+    }
+
+    VERIFY(ppDevice && ppContexts, "Null pointer provided");
+    if (!ppDevice || !ppContexts)
+        return;
+
+    if (EngineCI.NumImmediateContexts > 1)
+    {
+        LOG_ERROR_MESSAGE("Null backend does not support multiple immediate contexts");
+        return;
+    }
+
+    *ppDevice = nullptr;
+    memset(ppContexts, 0, sizeof(*ppContexts) * (size_t{1} + size_t{EngineCI.NumDeferredContexts}));
+
+    try
+    {
+        const GraphicsAdapterInfo AdapterInfo = GetNullAdapterInfo();
+        VerifyEngineCreateInfo(EngineCI, AdapterInfo);
+
+        IMemoryAllocator& RawMemAllocator = GetRawAllocator();
+
+        RenderDeviceNullImpl* pRenderDeviceNull{
+            NEW_RC_OBJ(RawMemAllocator, "RenderDeviceNullImpl instance", RenderDeviceNullImpl)(
+                RenderDeviceNullImpl::CreateInfo{
+                    RawMemAllocator,
+                    this,
+                    EngineCI,
+                    AdapterInfo,
+                })};
+        pRenderDeviceNull->QueryInterface(IID_RenderDevice, ppDevice);
+
+        DeviceContextNullImpl* pDeviceContextNull{
+            NEW_RC_OBJ(RawMemAllocator, "DeviceContextNullImpl instance", DeviceContextNullImpl)(
+                pRenderDeviceNull,
+                DeviceContextDesc{
+                    EngineCI.pImmediateContextInfo ? EngineCI.pImmediateContextInfo[0].Name : nullptr,
+                    pRenderDeviceNull->GetAdapterInfo().Queues[0].QueueType,
+                    False, // IsDeferred
+                    0,     // Context id
+                    0      // Queue id
+                })};
+        // We must call AddRef() (implicitly through QueryInterface()) because pRenderDeviceNull will
+        // keep a weak reference to the context
+        pDeviceContextNull->QueryInterface(IID_DeviceContext, ppContexts);
+        pRenderDeviceNull->SetImmediateContext(0, pDeviceContextNull);
+
+        for (Uint32 DeferredCtx = 0; DeferredCtx < EngineCI.NumDeferredContexts; ++DeferredCtx)
+        {
+            pRenderDeviceNull->CreateDeferredContext(ppContexts + 1 + DeferredCtx);
+        }
+    }
+    catch (const std::runtime_error&)
+    {
+        if (*ppDevice)
+        {
+            (*ppDevice)->Release();
+            *ppDevice = nullptr;
+        }
+        for (Uint32 ctx = 0; ctx < 1 + EngineCI.NumDeferredContexts; ++ctx)
+        {
+            if (ppContexts[ctx] != nullptr)
+            {
+                ppContexts[ctx]->Release();
+                ppContexts[ctx] = nullptr;
+            }
+        }
+
+        LOG_ERROR("Failed to create null render device and contexts");
+    }
+}
+
+API_QUALIFIER IEngineFactoryNull* GetEngineFactoryNull()
+{
+    return EngineFactoryNullImpl::GetInstance();
+}
+
+} // namespace Diligent
+
+extern "C"
+{
+    API_QUALIFIER Diligent::IEngineFactoryNull* Diligent_GetEngineFactoryNull()
+    {
+        return Diligent::GetEngineFactoryNull();
+    }
+}
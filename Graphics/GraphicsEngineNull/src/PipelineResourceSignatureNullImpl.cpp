@@ -0,0 +1,290 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "pch.h"
+
+#include "PipelineResourceSignatureNullImpl.hpp"
+#include "RenderDeviceNullImpl.hpp"
+
+namespace Diligent
+{
+
+PipelineResourceSignatureNullImpl::PipelineResourceSignatureNullImpl(IReferenceCounters*                  pRefCounters,
+                                                                     RenderDeviceNullImpl*                pDevice,
+                                                                     const PipelineResourceSignatureDesc& Desc,
+                                                                     SHADER_TYPE                          ShaderStages,
+                                                                     bool                                 bIsDeviceInternal) :
+    TPipelineResourceSignatureBase{pRefCounters, pDevice, Desc, ShaderStages, bIsDeviceInternal}
+{
+    try
+    {
+        Initialize(
+            GetRawAllocator(), DecoupleCombinedSamplers(Desc), /*CreateImmutableSamplers = */ true,
+            [this]() //
+            {
+                InitResourceLayout();
+            },
+            [this]() //
+            {
+                return ShaderResourceCacheNull::GetRequiredMemorySize(m_SRBCacheSize, m_TotalInlineConstants);
+            });
+    }
+    catch (...)
+    {
+        Destruct();
+        throw;
+    }
+}
+
+void PipelineResourceSignatureNullImpl::InitResourceLayout()
+{
+    // Index of the immutable sampler for every sampler in m_Desc.Resources, or InvalidImmutableSamplerIndex.
+    std::vector<Uint32> ResourceToImmutableSamplerInd(m_Desc.NumResources, InvalidImmutableSamplerIndex);
+    for (Uint32 i = 0; i < m_Desc.NumResources; ++i)
+    {
+        const PipelineResourceDesc& ResDesc = m_Desc.Resources[i];
+        if (ResDesc.ResourceType != SHADER_RESOURCE_TYPE_SAMPLER)
+            continue;
+
+        // Note that FindImmutableSampler() works properly both when combined texture samplers are used and when not.
+        const Uint32 SrcImmutableSamplerInd = FindImmutableSampler(ResDesc.ShaderStages, ResDesc.Name);
+        if (SrcImmutableSamplerInd != InvalidImmutableSamplerIndex)
+        {
+            ResourceToImmutableSamplerInd[i] = SrcImmutableSamplerInd;
+            // One immutable sampler may be used by different arrays in different shader stages - use the maximum array size
+            ImmutableSamplerAttribsNull& ImtblSampAttribs = m_pImmutableSamplerAttribs[SrcImmutableSamplerInd];
+            ImtblSampAttribs.ArraySize                    = std::max(ImtblSampAttribs.ArraySize, ResDesc.ArraySize);
+        }
+    }
+
+    // Allocate cache space for immutable samplers first
+    Uint32 SRBCacheOffset = 0;
+    for (Uint32 i = 0; i < m_Desc.NumImmutableSamplers; ++i)
+    {
+        ImmutableSamplerAttribsNull& ImtblSampAttribs = m_pImmutableSamplerAttribs[i];
+        ImtblSampAttribs.CacheOffset                  = SRBCacheOffset;
+        SRBCacheOffset += ImtblSampAttribs.ArraySize;
+    }
+
+    Uint32 StaticResourceCount = 0;
+    for (Uint32 i = 0; i < m_Desc.NumResources; ++i)
+    {
+        const PipelineResourceDesc& ResDesc = m_Desc.Resources[i];
+        if (ResDesc.VarType == SHADER_RESOURCE_VARIABLE_TYPE_STATIC && ResourceToImmutableSamplerInd[i] == InvalidImmutableSamplerIndex)
+            StaticResourceCount += ResDesc.GetArraySize();
+    }
+
+    if (m_pStaticResCache != nullptr)
+    {
+        m_pStaticResCache->Initialize(GetRawAllocator(), StaticResourceCount, m_TotalStaticInlineConstants);
+    }
+
+    // Current offset in the static resource cache
+    Uint32 StaticCacheOffset = 0;
+    // Current offset in static inline constant storage
+    Uint32 StaticInlineConstantOffset = 0;
+    Uint32 InlineConstantBufferIdx    = 0;
+
+    for (Uint32 i = 0; i < m_Desc.NumResources; ++i)
+    {
+        const PipelineResourceDesc& ResDesc = m_Desc.Resources[i];
+        VERIFY(i == 0 || ResDesc.VarType >= m_Desc.Resources[i - 1].VarType, "Resources must be sorted by variable type");
+
+        Uint32 AssignedSamplerInd     = ResourceAttribs::InvalidSamplerInd;
+        Uint32 SrcImmutableSamplerInd = ResourceToImmutableSamplerInd[i];
+        if (ResDesc.ResourceType == SHADER_RESOURCE_TYPE_TEXTURE_SRV)
+        {
+            AssignedSamplerInd = FindAssignedSampler(ResDesc, ResourceAttribs::InvalidSamplerInd);
+            if (AssignedSamplerInd != ResourceAttribs::InvalidSamplerInd)
+                SrcImmutableSamplerInd = ResourceToImmutableSamplerInd[AssignedSamplerInd];
+        }
+
+        const bool IsImmutableSampler = (ResDesc.ResourceType == SHADER_RESOURCE_TYPE_SAMPLER && SrcImmutableSamplerInd != InvalidImmutableSamplerIndex);
+
+        // Use GetArraySize() which returns 1 for inline constants
+        const Uint32 ArraySize = ResDesc.GetArraySize();
+
+        Uint32 CacheOffset = ~0u;
+        if (IsImmutableSampler)
+        {
+            // Note that the same immutable sampler may be assigned to multiple sampler resources in different shader stages
+            CacheOffset = m_pImmutableSamplerAttribs[SrcImmutableSamplerInd].CacheOffset;
+        }
+        else
+        {
+            CacheOffset = SRBCacheOffset;
+            SRBCacheOffset += ArraySize;
+        }
+
+        const bool IsStatic = ResDesc.VarType == SHADER_RESOURCE_VARIABLE_TYPE_STATIC && !IsImmutableSampler;
+        new (m_pResourceAttribs + i) ResourceAttribs{
+            AssignedSamplerInd,
+            ArraySize,
+            SrcImmutableSamplerInd != InvalidImmutableSamplerIndex,
+            CacheOffset,
+            IsStatic ? StaticCacheOffset : ~0u,
+        };
+
+        if (IsImmutableSampler)
+            continue;
+
+        const bool IsInlineConstantBuffer = (ResDesc.Flags & PIPELINE_RESOURCE_FLAG_INLINE_CONSTANTS) != 0;
+        if (IsInlineConstantBuffer)
+        {
+            VERIFY_EXPR(InlineConstantBufferIdx < m_NumInlineConstantBuffers);
+            InlineConstantBufferAttribsNull& InlineAttribs = m_pInlineConstantBuffers[InlineConstantBufferIdx++];
+            InlineAttribs.CacheOffset                      = CacheOffset;
+            InlineAttribs.NumConstants                     = ResDesc.ArraySize; // ArraySize is the number of 32-bit constants for inline constants
+        }
+
+        if (IsStatic)
+        {
+            if (IsInlineConstantBuffer)
+            {
+                m_pStaticResCache->InitializeInlineConstantBuffer(StaticCacheOffset, StaticInlineConstantOffset, ResDesc.ArraySize);
+                StaticInlineConstantOffset += ResDesc.ArraySize;
+            }
+            else
+            {
+                m_pStaticResCache->InitializeResources(StaticCacheOffset, ArraySize, ResDesc.ResourceType);
+            }
+            StaticCacheOffset += ArraySize;
+        }
+    }
+
+    VERIFY_EXPR(InlineConstantBufferIdx == m_NumInlineConstantBuffers);
+    VERIFY_EXPR(StaticCacheOffset == StaticResourceCount);
+    VERIFY_EXPR(StaticInlineConstantOffset == m_TotalStaticInlineConstants);
+
+    m_SRBCacheSize = SRBCacheOffset;
+}
+
+PipelineResourceSignatureNullImpl::~PipelineResourceSignatureNullImpl()
+{
+    Destruct();
+}
+
+void PipelineResourceSignatureNullImpl::InitSRBResourceCache(ShaderResourceCacheNull& ResourceCache)
+{
+    IMemoryAllocator& CacheMemAllocator = m_SRBMemAllocator.GetResourceCacheDataAllocator(0);
+    ResourceCache.Initialize(CacheMemAllocator, m_SRBCacheSize, m_TotalInlineConstants);
+
+    const ResourceCacheContentType CacheType = ResourceCache.GetContentType();
+
+    Uint32 InlineConstantOffset = 0;
+    for (Uint32 r = 0; r < GetTotalResourceCount(); ++r)
+    {
+        const PipelineResourceDesc& ResDesc = GetResourceDesc(r);
+        const ResourceAttribs&      Attr    = GetResourceAttribs(r);
+        if (ResDesc.ResourceType == SHADER_RESOURCE_TYPE_SAMPLER && Attr.IsImmutableSamplerAssigned())
+        {
+            // Skip immutable samplers
+            continue;
+        }
+
+        if ((ResDesc.Flags & PIPELINE_RESOURCE_FLAG_INLINE_CONSTANTS) != 0)
+        {
+            // For inline constants, ArraySize is the number of 32-bit constants
+            ResourceCache.InitializeInlineConstantBuffer(Attr.CacheOffset(CacheType), InlineConstantOffset, ResDesc.ArraySize);
+            InlineConstantOffset += ResDesc.ArraySize;
+        }
+        else
+        {
+            ResourceCache.InitializeResources(Attr.CacheOffset(CacheType), Attr.ArraySize, ResDesc.ResourceType);
+        }
+    }
+    VERIFY_EXPR(InlineConstantOffset == m_TotalInlineConstants);
+
+    // Initialize immutable samplers
+    for (Uint32 i = 0; i < m_Desc.NumImmutableSamplers; ++i)
+    {
+        const ImmutableSamplerAttribsNull& ImtblSampAttr = m_pImmutableSamplerAttribs[i];
+        VERIFY_EXPR(ImtblSampAttr.IsAllocated());
+        ResourceCache.InitializeResources(ImtblSampAttr.CacheOffset, ImtblSampAttr.ArraySize, SHADER_RESOURCE_TYPE_SAMPLER);
+
+        if (const RefCntAutoPtr<SamplerNullImpl>& pSampler = m_pImmutableSamplers[i])
+        {
+            for (Uint32 elem = 0; elem < ImtblSampAttr.ArraySize; ++elem)
+                ResourceCache.SetResource(ImtblSampAttr.CacheOffset + elem, pSampler);
+        }
+    }
+}
+
+void PipelineResourceSignatureNullImpl::CopyStaticResources(ShaderResourceCacheNull& DstResourceCache) const
+{
+    if (m_pStaticResCache == nullptr)
+        return;
+
+    // SrcResourceCache contains only static resources.
+    // In case of SRB, DstResourceCache contains static, mutable and dynamic resources.
+    // In case of Signature, DstResourceCache contains only static resources.
+    const ShaderResourceCacheNull&  SrcResourceCache = *m_pStaticResCache;
+    const std::pair<Uint32, Uint32> ResIdxRange      = GetResourceIndexRange(SHADER_RESOURCE_VARIABLE_TYPE_STATIC);
+    const ResourceCacheContentType  SrcCacheType     = SrcResourceCache.GetContentType();
+    const ResourceCacheContentType  DstCacheType     = DstResourceCache.GetContentType();
+
+    for (Uint32 r = ResIdxRange.first; r < ResIdxRange.second; ++r)
+    {
+        const PipelineResourceDesc& ResDesc = GetResourceDesc(r);
+        const ResourceAttribs&      Attr    = GetResourceAttribs(r);
+        VERIFY_EXPR(ResDesc.VarType == SHADER_RESOURCE_VARIABLE_TYPE_STATIC);
+
+        if (ResDesc.ResourceType == SHADER_RESOURCE_TYPE_SAMPLER && Attr.IsImmutableSamplerAssigned())
+        {
+            // Skip immutable samplers as they are initialized in InitSRBResourceCache()
+            continue;
+        }
+
+        if (ResDesc.Flags & PIPELINE_RESOURCE_FLAG_INLINE_CONSTANTS)
+        {
+            DstResourceCache.CopyInlineConstants(SrcResourceCache, Attr.CacheOffset(SrcCacheType), Attr.CacheOffset(DstCacheType),
+                                                 ResDesc.ArraySize); // ArraySize is the number of 32-bit constants for inline constants
+            continue;
+        }
+
+        for (Uint32 ArrInd = 0; ArrInd < ResDesc.ArraySize; ++ArrInd)
+        {
+            const ShaderResourceCacheNull::Resource& SrcCachedRes = SrcResourceCache.GetResource(Attr.CacheOffset(SrcCacheType) + ArrInd);
+            IDeviceObject*                           pObject      = SrcCachedRes.pObject;
+            if (pObject == nullptr)
+            {
+                if (DstCacheType == ResourceCacheContentType::SRB)
+                    LOG_ERROR_MESSAGE("No resource is assigned to static shader variable '", GetShaderResourcePrintName(ResDesc, ArrInd), "' in pipeline resource signature '", m_Desc.Name, "'.");
+                continue;
+            }
+
+            const Uint32                             DstCacheOffset = Attr.CacheOffset(DstCacheType) + ArrInd;
+            const ShaderResourceCacheNull::Resource& DstCachedRes   = DstResourceCache.GetResource(DstCacheOffset);
+            if (DstCachedRes.pObject != pObject)
+            {
+                DEV_CHECK_ERR(DstCachedRes.pObject == nullptr, "Static resource has already been initialized, and the new resource does not match previously assigned resource");
+                DstResourceCache.SetResource(DstCacheOffset, SrcCachedRes.pObject, SrcCachedRes.BufferBaseOffset, SrcCachedRes.BufferRangeSize);
+            }
+        }
+    }
+}
+
+} // namespace Diligent
@@ -0,0 +1,98 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "pch.h"
+
+#include "PipelineStateNullImpl.hpp"
+#include "RenderDeviceNullImpl.hpp"
+#include "RenderPassNullImpl.hpp"
+
+namespace Diligent
+{
+
+constexpr INTERFACE_ID PipelineStateNullImpl::IID_InternalImpl;
+
+PipelineStateNullImpl::PipelineStateNullImpl(IReferenceCounters*                    pRefCounters,
+                                             RenderDeviceNullImpl*                  pDevice,
+                                             const GraphicsPipelineStateCreateInfo& CreateInfo) :
+    TPipelineStateBase{pRefCounters, pDevice, CreateInfo}
+{
+    Construct<ShaderNullImpl>(CreateInfo);
+}
+
+PipelineStateNullImpl::PipelineStateNullImpl(IReferenceCounters*                   pRefCounters,
+                                             RenderDeviceNullImpl*                 pDevice,
+                                             const ComputePipelineStateCreateInfo& CreateInfo) :
+    TPipelineStateBase{pRefCounters, pDevice, CreateInfo}
+{
+    Construct<ShaderNullImpl>(CreateInfo);
+}
+
+PipelineStateNullImpl::~PipelineStateNullImpl()
+{
+    // Wait for asynchronous tasks to complete
+    TPipelineStateBase::GetStatus(/*WaitForCompletion =*/true);
+    Destruct();
+}
+
+template <typename PSOCreateInfoType>
+void PipelineStateNullImpl::InitInternalObjects(const PSOCreateInfoType& CreateInfo)
+{
+    TShaderStages ShaderStages;
+    ExtractShaders<ShaderNullImpl>(CreateInfo, ShaderStages, /*WaitUntilShadersReady = */ true);
+    VERIFY(!ShaderStages.empty(),
+           "There must be at least one shader stage in the pipeline. "
+           "This error should've been caught by PSO create info validation.");
+
+    // Memory must be released if an exception is thrown.
+    FixedLinearAllocator MemPool{GetRawAllocator()};
+
+    ReserveSpaceForPipelineDesc(CreateInfo, MemPool);
+    MemPool.Reserve();
+
+    InitializePipelineDesc(CreateInfo, MemPool);
+
+    const PSO_CREATE_INTERNAL_FLAGS InternalFlags = GetInternalCreateFlags(CreateInfo);
+    if (m_UsingImplicitSignature && (InternalFlags & PSO_CREATE_INTERNAL_FLAG_IMPLICIT_SIGNATURE0) == 0)
+    {
+        // There is no shader reflection, so the implicit signature only contains immutable samplers
+        const PipelineResourceSignatureDescWrapper SignDesc{m_Desc.Name, m_Desc.ResourceLayout, m_Desc.SRBAllocationGranularity};
+        InitDefaultSignature(SignDesc, GetActiveShaderStages(), false /*bIsDeviceInternal*/);
+        VERIFY_EXPR(m_Signatures[0]);
+    }
+}
+
+void PipelineStateNullImpl::InitializePipeline(const GraphicsPipelineStateCreateInfo& CreateInfo)
+{
+    InitInternalObjects(CreateInfo);
+}
+
+void PipelineStateNullImpl::InitializePipeline(const ComputePipelineStateCreateInfo& CreateInfo)
+{
+    InitInternalObjects(CreateInfo);
+}
+
+} // namespace Diligent
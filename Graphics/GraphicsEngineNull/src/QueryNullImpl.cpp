@@ -0,0 +1,130 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "pch.h"
+
+#include "QueryNullImpl.hpp"
+
+#include <chrono>
+#include <new>
+
+#include "RenderDeviceNullImpl.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+Uint64 GetTimestampNs()
+{
+    return static_cast<Uint64>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+} // namespace
+
+QueryNullImpl::QueryNullImpl(IReferenceCounters*   pRefCounters,
+                             RenderDeviceNullImpl* pDevice,
+                             const QueryDesc&      Desc) :
+    TQueryBase{pRefCounters, pDevice, Desc}
+{
+}
+
+QueryNullImpl::~QueryNullImpl() = default;
+
+void QueryNullImpl::OnBeginQuery(DeviceContextNullImpl* pContext)
+{
+    TQueryBase::OnBeginQuery(pContext);
+    m_StartTime = GetTimestampNs();
+}
+
+void QueryNullImpl::OnEndQuery(DeviceContextNullImpl* pContext)
+{
+    TQueryBase::OnEndQuery(pContext);
+    m_EndTime = GetTimestampNs();
+    if (m_Desc.Type == QUERY_TYPE_TIMESTAMP)
+        m_StartTime = m_EndTime;
+}
+
+bool QueryNullImpl::GetData(void* pData, Uint32 DataSize, bool AutoInvalidate)
+{
+    TQueryBase::CheckQueryDataPtr(pData, DataSize);
+    if (pData == nullptr)
+        return true;
+
+    // All commands complete immediately, so the data is always available
+    switch (m_Desc.Type)
+    {
+        case QUERY_TYPE_OCCLUSION:
+            reinterpret_cast<QueryDataOcclusion*>(pData)->NumSamples = 0;
+            break;
+
+        case QUERY_TYPE_BINARY_OCCLUSION:
+            reinterpret_cast<QueryDataBinaryOcclusion*>(pData)->AnySamplePassed = False;
+            break;
+
+        case QUERY_TYPE_PIPELINE_STATISTICS:
+        {
+            // Nothing is rasterized, so all counters are zero
+            QueryDataPipelineStatistics& QueryData{*reinterpret_cast<QueryDataPipelineStatistics*>(pData)};
+            new (&QueryData) QueryDataPipelineStatistics{};
+            break;
+        }
+
+        case QUERY_TYPE_TIMESTAMP:
+        {
+            QueryDataTimestamp& QueryData{*reinterpret_cast<QueryDataTimestamp*>(pData)};
+            QueryData.Counter   = m_EndTime;
+            QueryData.Frequency = 1000000000u; // Nanoseconds to seconds
+            break;
+        }
+
+        case QUERY_TYPE_DURATION:
+        {
+            QueryDataDuration& QueryData{*reinterpret_cast<QueryDataDuration*>(pData)};
+            QueryData.Duration  = m_EndTime - m_StartTime;
+            QueryData.Frequency = 1000000000u; // Nanoseconds to seconds
+            break;
+        }
+
+        default:
+            UNEXPECTED("Unexpected query type");
+    }
+
+    if (AutoInvalidate)
+        Invalidate();
+
+    return true;
+}
+
+void QueryNullImpl::Invalidate()
+{
+    m_StartTime = 0;
+    m_EndTime   = 0;
+    TQueryBase::Invalidate();
+}
+
+} // namespace Diligent
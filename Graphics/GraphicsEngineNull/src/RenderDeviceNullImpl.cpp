@@ -0,0 +1,284 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "pch.h"
+
+#include "RenderDeviceNullImpl.hpp"
+#include "GraphicsAccessories.hpp"
+
+namespace Diligent
+{
+
+class BottomLevelASNullImpl
+{};
+
+class TopLevelASNullImpl
+{};
+
+class ShaderBindingTableNullImpl
+{};
+
+class DeviceMemoryNullImpl
+{};
+
+RenderDeviceNullImpl::RenderDeviceNullImpl(IReferenceCounters* pRefCounters,
+                                           const CreateInfo&   CI) :
+    // clang-format off
+    TRenderDeviceBase
+    {
+        pRefCounters,
+        CI.RawMemAllocator,
+        CI.pEngineFactory,
+        CI.EngineCI,
+        CI.AdapterInfo
+    }
+// clang-format on
+{
+    FindSupportedTextureFormats();
+
+    m_DeviceInfo.Type = RENDER_DEVICE_TYPE_NULL;
+    m_DeviceInfo.NDC  = NDCAttribs{0.0f, 1.0f, -0.5f};
+
+    m_DeviceInfo.Features = EnableDeviceFeatures(CI.AdapterInfo.Features, CI.EngineCI.Features);
+
+    InitShaderCompilationThreadPool(CI.EngineCI.pAsyncShaderCompilationThreadPool, CI.EngineCI.NumAsyncShaderCompilationThreads);
+}
+
+RenderDeviceNullImpl::~RenderDeviceNullImpl()
+{
+}
+
+void RenderDeviceNullImpl::CreateBuffer(const BufferDesc& BuffDesc,
+                                        const BufferData* pBuffData,
+                                        IBuffer**         ppBuffer,
+                                        bool              bIsDeviceInternal)
+{
+    CreateBufferImpl(ppBuffer, BuffDesc, pBuffData, bIsDeviceInternal);
+}
+
+void RenderDeviceNullImpl::CreateBuffer(const BufferDesc& BuffDesc,
+                                        const BufferData* pBuffData,
+                                        IBuffer**         ppBuffer)
+{
+    CreateBuffer(BuffDesc, pBuffData, ppBuffer, false);
+}
+
+void RenderDeviceNullImpl::CreateTexture(const TextureDesc& TexDesc,
+                                         const TextureData* pData,
+                                         ITexture**         ppTexture)
+{
+    CreateTexture(TexDesc, pData, ppTexture, false);
+}
+
+void RenderDeviceNullImpl::CreateTexture(const TextureDesc& TexDesc,
+                                         const TextureData* pData,
+                                         ITexture**         ppTexture,
+                                         bool               IsDeviceInternal)
+{
+    CreateTextureImpl(ppTexture, TexDesc, pData, IsDeviceInternal);
+}
+
+void RenderDeviceNullImpl::CreateSampler(const SamplerDesc& SamplerDesc,
+                                         ISampler**         ppSampler,
+                                         bool               IsDeviceInternal)
+{
+    CreateSamplerImpl(ppSampler, SamplerDesc, IsDeviceInternal);
+}
+
+void RenderDeviceNullImpl::CreateSampler(const SamplerDesc& SamplerDesc,
+                                         ISampler**         ppSampler)
+{
+    CreateSampler(SamplerDesc, ppSampler, false);
+}
+
+void RenderDeviceNullImpl::CreateShader(const ShaderCreateInfo& ShaderCI,
+                                        IShader**               ppShader,
+                                        IDataBlob**             ppCompilerOutput)
+{
+    // Shaders are not compiled, so there is never any compiler output
+    if (ppCompilerOutput != nullptr)
+        *ppCompilerOutput = nullptr;
+
+    CreateShaderImpl(ppShader, ShaderCI);
+}
+
+void RenderDeviceNullImpl::CreatePipelineResourceSignature(const PipelineResourceSignatureDesc& Desc,
+                                                           IPipelineResourceSignature**         ppSignature)
+{
+    CreatePipelineResourceSignature(Desc, ppSignature, SHADER_TYPE_UNKNOWN, false);
+}
+
+void RenderDeviceNullImpl::CreatePipelineResourceSignature(const PipelineResourceSignatureDesc& Desc,
+                                                           IPipelineResourceSignature**         ppSignature,
+                                                           SHADER_TYPE                          ShaderStages,
+                                                           bool                                 IsDeviceInternal)
+{
+    CreatePipelineResourceSignatureImpl(ppSignature, Desc, ShaderStages, IsDeviceInternal);
+}
+
+void RenderDeviceNullImpl::CreateGraphicsPipelineState(const GraphicsPipelineStateCreateInfo& PSOCreateInfo,
+                                                       IPipelineState**                       ppPipelineState)
+{
+    CreatePipelineStateImpl(ppPipelineState, PSOCreateInfo);
+}
+
+void RenderDeviceNullImpl::CreateComputePipelineState(const ComputePipelineStateCreateInfo& PSOCreateInfo,
+                                                      IPipelineState**                      ppPipelineState)
+{
+    CreatePipelineStateImpl(ppPipelineState, PSOCreateInfo);
+}
+
+void RenderDeviceNullImpl::CreateRayTracingPipelineState(const RayTracingPipelineStateCreateInfo& PSOCreateInfo,
+                                                         IPipelineState**                         ppPipelineState)
+{
+    UNSUPPORTED("Ray tracing is not supported by null device");
+    *ppPipelineState = nullptr;
+}
+
+void RenderDeviceNullImpl::CreateFence(const FenceDesc& Desc,
+                                       IFence**         ppFence)
+{
+    CreateFenceImpl(ppFence, Desc);
+}
+
+void RenderDeviceNullImpl::CreateQuery(const QueryDesc& Desc,
+                                       IQuery**         ppQuery)
+{
+    CreateQueryImpl(ppQuery, Desc);
+}
+
+void RenderDeviceNullImpl::CreateRenderPass(const RenderPassDesc& Desc,
+                                            IRenderPass**         ppRenderPass)
+{
+    CreateRenderPassImpl(ppRenderPass, Desc);
+}
+
+void RenderDeviceNullImpl::CreateFramebuffer(const FramebufferDesc& Desc,
+                                             IFramebuffer**         ppFramebuffer)
+{
+    CreateFramebufferImpl(ppFramebuffer, Desc);
+}
+
+void RenderDeviceNullImpl::CreateBLAS(const BottomLevelASDesc& Desc,
+                                      IBottomLevelAS**         ppBLAS)
+{
+    UNSUPPORTED("CreateBLAS is not supported by null device");
+    *ppBLAS = nullptr;
+}
+
+void RenderDeviceNullImpl::CreateTLAS(const TopLevelASDesc& Desc,
+                                      ITopLevelAS**         ppTLAS)
+{
+    UNSUPPORTED("CreateTLAS is not supported by null device");
+    *ppTLAS = nullptr;
+}
+
+void RenderDeviceNullImpl::CreateSBT(const ShaderBindingTableDesc& Desc,
+                                     IShaderBindingTable**         ppSBT)
+{
+    UNSUPPORTED("CreateSBT is not supported by null device");
+    *ppSBT = nullptr;
+}
+
+void RenderDeviceNullImpl::CreateDeviceMemory(const DeviceMemoryCreateInfo& CreateInfo,
+                                              IDeviceMemory**               ppMemory)
+{
+    UNSUPPORTED("CreateDeviceMemory is not supported by null device");
+    *ppMemory = nullptr;
+}
+
+void RenderDeviceNullImpl::CreatePipelineStateCache(const PipelineStateCacheCreateInfo& CreateInfo,
+                                                    IPipelineStateCache**               ppPSOCache)
+{
+    *ppPSOCache = nullptr;
+}
+
+void RenderDeviceNullImpl::CreateDeferredContext(IDeviceContext** ppContext)
+{
+    CreateDeferredContextImpl(ppContext);
+}
+
+void RenderDeviceNullImpl::IdleGPU()
+{
+    // All commands complete immediately
+}
+
+Bool RenderDeviceNullImpl::GetSparseTextureFormatInfo(TEXTURE_FORMAT           TexFormat,
+                                                      RESOURCE_DIMENSION       Dimension,
+                                                      Uint32                   SampleCount,
+                                                      SparseTextureFormatInfo& FormatInfo) const
+{
+    UNSUPPORTED("GetSparseTextureFormatInfo is not supported by null device");
+    FormatInfo = {};
+    return false;
+}
+
+void RenderDeviceNullImpl::TestTextureFormat(TEXTURE_FORMAT TexFormat)
+{
+    VERIFY(m_TextureFormatsInfo[TexFormat].Supported, "Texture format is not supported");
+}
+
+void RenderDeviceNullImpl::FindSupportedTextureFormats()
+{
+    // clang-format off
+    constexpr RESOURCE_DIMENSION_SUPPORT AllTextureDimensions =
+        RESOURCE_DIMENSION_SUPPORT_TEX_1D       |
+        RESOURCE_DIMENSION_SUPPORT_TEX_1D_ARRAY |
+        RESOURCE_DIMENSION_SUPPORT_TEX_2D       |
+        RESOURCE_DIMENSION_SUPPORT_TEX_2D_ARRAY |
+        RESOURCE_DIMENSION_SUPPORT_TEX_3D       |
+        RESOURCE_DIMENSION_SUPPORT_TEX_CUBE     |
+        RESOURCE_DIMENSION_SUPPORT_TEX_CUBE_ARRAY;
+    // clang-format on
+
+    // Texture memory is never accessed by the GPU, so every format is reported as fully supported
+    for (Uint32 Fmt = TEX_FORMAT_UNKNOWN + 1; Fmt < TEX_FORMAT_NUM_FORMATS; ++Fmt)
+    {
+        TextureFormatInfoExt& FmtInfo = m_TextureFormatsInfo[Fmt];
+
+        FmtInfo.Supported  = true;
+        FmtInfo.Filterable = true;
+        FmtInfo.Dimensions = AllTextureDimensions;
+
+        if (FmtInfo.ComponentType == COMPONENT_TYPE_DEPTH || FmtInfo.ComponentType == COMPONENT_TYPE_DEPTH_STENCIL)
+        {
+            FmtInfo.BindFlags    = BIND_DEPTH_STENCIL | BIND_SHADER_RESOURCE;
+            FmtInfo.SampleCounts = SAMPLE_COUNT_1 | SAMPLE_COUNT_2 | SAMPLE_COUNT_4 | SAMPLE_COUNT_8;
+        }
+        else if (FmtInfo.ComponentType == COMPONENT_TYPE_COMPRESSED)
+        {
+            FmtInfo.BindFlags    = BIND_SHADER_RESOURCE;
+            FmtInfo.SampleCounts = SAMPLE_COUNT_1;
+        }
+        else
+        {
+            FmtInfo.BindFlags    = BIND_SHADER_RESOURCE | BIND_RENDER_TARGET | BIND_UNORDERED_ACCESS;
+            FmtInfo.SampleCounts = SAMPLE_COUNT_1 | SAMPLE_COUNT_2 | SAMPLE_COUNT_4 | SAMPLE_COUNT_8;
+        }
+    }
+}
+
+} // namespace Diligent
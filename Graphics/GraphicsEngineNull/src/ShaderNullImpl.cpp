@@ -0,0 +1,79 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "pch.h"
+
+#include "ShaderNullImpl.hpp"
+
+#include <cstring>
+
+#include "RenderDeviceNullImpl.hpp"
+
+namespace Diligent
+{
+
+constexpr INTERFACE_ID ShaderNullImpl::IID_InternalImpl;
+
+ShaderNullImpl::ShaderNullImpl(IReferenceCounters*     pRefCounters,
+                               RenderDeviceNullImpl*   pDevice,
+                               const ShaderCreateInfo& ShaderCI,
+                               bool                    IsDeviceInternal) :
+    TShaderBase{pRefCounters, pDevice, ShaderCI.Desc, pDevice->GetDeviceInfo(), pDevice->GetAdapterInfo(), IsDeviceInternal}
+{
+    if (ShaderCI.Source != nullptr)
+    {
+        const size_t SourceLength = ShaderCI.SourceLength != 0 ? ShaderCI.SourceLength : strlen(ShaderCI.Source);
+        m_Bytecode.assign(ShaderCI.Source, ShaderCI.Source + SourceLength);
+    }
+    else if (ShaderCI.ByteCode != nullptr)
+    {
+        const Uint8* pByteCode = static_cast<const Uint8*>(ShaderCI.ByteCode);
+        m_Bytecode.assign(pByteCode, pByteCode + ShaderCI.ByteCodeSize);
+    }
+
+    m_Status.store(SHADER_STATUS_READY);
+}
+
+ShaderNullImpl::~ShaderNullImpl() = default;
+
+void ShaderNullImpl::GetResourceDesc(Uint32 Index, ShaderResourceDesc& ResourceDesc) const
+{
+    DEV_ERROR("Shader '", m_Desc.Name, "' has no resources: shader reflection is not available in null backend");
+}
+
+const ShaderCodeBufferDesc* ShaderNullImpl::GetConstantBufferDesc(Uint32 Index) const
+{
+    DEV_ERROR("Shader '", m_Desc.Name, "' has no constant buffers: shader reflection is not available in null backend");
+    return nullptr;
+}
+
+void ShaderNullImpl::GetBytecode(const void** ppBytecode, Uint64& Size) const
+{
+    *ppBytecode = !m_Bytecode.empty() ? m_Bytecode.data() : nullptr;
+    Size        = m_Bytecode.size();
+}
+
+} // namespace Diligent
@@ -0,0 +1,189 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "pch.h"
+
+#include "ShaderResourceCacheNull.hpp"
+#include "EngineMemory.h"
+#include "BufferNullImpl.hpp"
+#include "BufferViewNullImpl.hpp"
+
+namespace Diligent
+{
+
+size_t ShaderResourceCacheNull::GetRequiredMemorySize(Uint32 NumResources, Uint32 TotalInlineConstants)
+{
+    size_t MemorySize = NumResources * sizeof(Resource);
+
+    MemorySize = AlignUp(MemorySize, alignof(Uint32));
+    MemorySize += TotalInlineConstants * sizeof(Uint32);
+
+    return MemorySize;
+}
+
+ShaderResourceCacheNull::ShaderResourceCacheNull(ResourceCacheContentType ContentType) noexcept :
+    m_ContentType{ContentType}
+{
+}
+
+ShaderResourceCacheNull::~ShaderResourceCacheNull()
+{
+    if (m_pMemory)
+    {
+        Resource* pResources = GetResources();
+        for (Uint32 res = 0; res < m_NumResources; ++res)
+            pResources[res].~Resource();
+    }
+}
+
+void ShaderResourceCacheNull::Initialize(IMemoryAllocator& MemAllocator, Uint32 NumResources, Uint32 TotalInlineConstants)
+{
+    VERIFY(!m_pMemory, "Memory has already been allocated");
+
+    m_NumResources         = NumResources;
+    m_TotalInlineConstants = TotalInlineConstants;
+
+    const size_t MemorySize = GetRequiredMemorySize(NumResources, TotalInlineConstants);
+    if (MemorySize > 0)
+    {
+        m_pMemory = decltype(m_pMemory){
+            ALLOCATE_RAW(MemAllocator, "Memory for shader resource cache data", MemorySize),
+            STDDeleter<void, IMemoryAllocator>(MemAllocator),
+        };
+        memset(m_pMemory.get(), 0, MemorySize);
+
+        Resource* pResources = GetResources();
+        for (Uint32 res = 0; res < m_NumResources; ++res)
+            new (pResources + res) Resource{};
+    }
+}
+
+void ShaderResourceCacheNull::InitializeResources(Uint32 CacheOffset, Uint32 ArraySize, SHADER_RESOURCE_TYPE Type)
+{
+    VERIFY(CacheOffset + ArraySize <= m_NumResources, "Resource range is out of bounds");
+    Resource* pResources = GetResources();
+    for (Uint32 elem = 0; elem < ArraySize; ++elem)
+        pResources[CacheOffset + elem].Type = Type;
+}
+
+void ShaderResourceCacheNull::InitializeInlineConstantBuffer(Uint32 CacheOffset, Uint32 InlineConstantOffset, Uint32 NumConstants)
+{
+    VERIFY(CacheOffset < m_NumResources, "Offset ", CacheOffset, " is out of range");
+    VERIFY(InlineConstantOffset + NumConstants <= m_TotalInlineConstants, "Inline constant range is out of bounds");
+
+    Resource& Res           = GetResources()[CacheOffset];
+    Res.Type                = SHADER_RESOURCE_TYPE_CONSTANT_BUFFER;
+    Res.pInlineConstantData = GetInlineConstantData(InlineConstantOffset);
+    Res.BufferRangeSize     = NumConstants * sizeof(Uint32);
+}
+
+static bool IsDynamicBuffer(const ShaderResourceCacheNull::Resource& Res)
+{
+    if (!Res.pObject)
+        return false;
+
+    const BufferNullImpl* pBuffer = nullptr;
+    if (Res.Type == SHADER_RESOURCE_TYPE_CONSTANT_BUFFER)
+        pBuffer = Res.pObject.ConstPtr<BufferNullImpl>();
+    else if (Res.Type == SHADER_RESOURCE_TYPE_BUFFER_SRV || Res.Type == SHADER_RESOURCE_TYPE_BUFFER_UAV)
+        pBuffer = Res.pObject.ConstPtr<BufferViewNullImpl>()->GetBuffer<const BufferNullImpl>();
+
+    return pBuffer != nullptr && pBuffer->GetDesc().Usage == USAGE_DYNAMIC;
+}
+
+void ShaderResourceCacheNull::SetResource(Uint32                       CacheOffset,
+                                          RefCntAutoPtr<IDeviceObject> pObject,
+                                          Uint64                       BufferBaseOffset,
+                                          Uint64                       BufferRangeSize)
+{
+    VERIFY(CacheOffset < m_NumResources, "Offset ", CacheOffset, " is out of range");
+    Resource& Res = GetResources()[CacheOffset];
+
+    if (IsDynamicBuffer(Res))
+    {
+        VERIFY(m_NumDynamicBuffers > 0, "Dynamic buffers counter is zero. This is a bug.");
+        --m_NumDynamicBuffers;
+    }
+
+    Res.pObject             = std::move(pObject);
+    Res.BufferBaseOffset    = 0;
+    Res.BufferRangeSize     = 0;
+    Res.BufferDynamicOffset = 0; // It is essential to reset dynamic offset
+
+    if (Res.Type == SHADER_RESOURCE_TYPE_CONSTANT_BUFFER)
+    {
+        Res.BufferBaseOffset = BufferBaseOffset;
+        Res.BufferRangeSize  = BufferRangeSize;
+        if (Res.BufferRangeSize == 0 && Res.pObject)
+            Res.BufferRangeSize = Res.pObject.ConstPtr<BufferNullImpl>()->GetDesc().Size - BufferBaseOffset;
+    }
+    else if ((Res.Type == SHADER_RESOURCE_TYPE_BUFFER_SRV || Res.Type == SHADER_RESOURCE_TYPE_BUFFER_UAV) && Res.pObject)
+    {
+        const BufferViewDesc& ViewDesc = Res.pObject.ConstPtr<BufferViewNullImpl>()->GetDesc();
+        Res.BufferBaseOffset           = ViewDesc.ByteOffset;
+        Res.BufferRangeSize            = ViewDesc.ByteWidth;
+    }
+
+    if (IsDynamicBuffer(Res))
+        ++m_NumDynamicBuffers;
+
+    UpdateRevision();
+}
+
+void ShaderResourceCacheNull::SetDynamicBufferOffset(Uint32 CacheOffset, Uint32 DynamicBufferOffset)
+{
+    VERIFY(CacheOffset < m_NumResources, "Offset ", CacheOffset, " is out of range");
+    Resource& Res = GetResources()[CacheOffset];
+    VERIFY(Res.Type == SHADER_RESOURCE_TYPE_CONSTANT_BUFFER || Res.Type == SHADER_RESOURCE_TYPE_BUFFER_SRV || Res.Type == SHADER_RESOURCE_TYPE_BUFFER_UAV,
+           "Dynamic offsets can only be set for buffers");
+    Res.BufferDynamicOffset = DynamicBufferOffset;
+}
+
+void ShaderResourceCacheNull::SetInlineConstants(Uint32      CacheOffset,
+                                                 const void* pConstants,
+                                                 Uint32      FirstConstant,
+                                                 Uint32      NumConstants)
+{
+    VERIFY(CacheOffset < m_NumResources, "Offset ", CacheOffset, " is out of range");
+    Resource& Res = GetResources()[CacheOffset];
+    VERIFY(Res.pInlineConstantData != nullptr, "Inline constant data pointer is not initialized");
+    VERIFY(pConstants != nullptr, "Source data is null");
+    VERIFY(FirstConstant + NumConstants <= Res.BufferRangeSize / sizeof(Uint32),
+           "Too many constants (", FirstConstant + NumConstants, ") for the allocated space (", Res.BufferRangeSize / sizeof(Uint32), ")");
+    memcpy(Res.pInlineConstantData + FirstConstant, pConstants, NumConstants * sizeof(Uint32));
+}
+
+void ShaderResourceCacheNull::CopyInlineConstants(const ShaderResourceCacheNull& SrcCache,
+                                                  Uint32                         SrcCacheOffset,
+                                                  Uint32                         DstCacheOffset,
+                                                  Uint32                         NumConstants)
+{
+    const Resource& SrcRes = SrcCache.GetResource(SrcCacheOffset);
+    VERIFY(SrcRes.pInlineConstantData != nullptr, "Source inline constant data pointer is not initialized");
+    SetInlineConstants(DstCacheOffset, SrcRes.pInlineConstantData, 0, NumConstants);
+}
+
+} // namespace Diligent
@@ -35,6 +35,7 @@
 #include "GLObjectWrapper.hpp"
 #include "AsyncWritableResource.hpp"
 #include "GLContextState.hpp"
+#include "GLDynamicHeap.hpp"
 
 namespace Diligent
 {
@@ -74,7 +75,28 @@ public:
 
     __forceinline void BufferMemoryBarrier(MEMORY_BARRIER RequiredBarriers, GLContextState& GLContextState);
 
-    const GLObjectWrappers::GLBufferObj& GetGLHandle() const { return m_GlBuffer; }
+    /// Returns the GL buffer object to bind. For buffers that use the dynamic heap, this
+    /// is the heap buffer shared by all such buffers, and GetDynamicOffset() must be added
+    /// to the bind offset. IBufferGL::GetGLBufferHandle() returns the same handle.
+    const GLObjectWrappers::GLBufferObj& GetGLHandle() const { return m_pDynamicHeap != nullptr ? m_pDynamicHeap->GetGLBuffer() : m_GlBuffer; }
+
+    /// Returns true if the buffer space is allocated from the dynamic heap.
+    bool UsesDynamicHeap() const { return m_pDynamicHeap != nullptr; }
+
+    /// Returns the offset of the current dynamic allocation in the heap buffer,
+    /// or zero if the buffer does not use the dynamic heap.
+    Uint64 GetDynamicOffset() const
+    {
+        if (m_pDynamicHeap == nullptr)
+            return 0;
+
+        DEV_CHECK_ERR(m_DynamicOffset != GLDynamicHeap::InvalidOffset,
+                      "Dynamic buffer '", m_Desc.Name, "' must be mapped with MAP_FLAG_DISCARD before it can be used");
+        DEV_CHECK_ERR(m_DvpMapFrameNumber == m_pDynamicHeap->GetFrameNumber(),
+                      "Dynamic allocation of dynamic buffer '", m_Desc.Name, "' in frame ", m_pDynamicHeap->GetFrameNumber(),
+                      " is out-of-date. Note: contents of all dynamic resources is discarded at the end of every frame. A buffer must be mapped before its first use in any frame.");
+        return static_cast<Uint64>(m_DynamicOffset);
+    }
 
     /// Implementation of IBufferGL::GetGLBufferHandle().
     virtual GLuint DILIGENT_CALL_TYPE GetGLBufferHandle() const override final { return GetGLHandle(); }
@@ -92,6 +114,15 @@ private:
     const Uint32                  m_BindTarget;
     const GLenum                  m_GLUsageHint;
 
+    // Dynamic heap that the buffer space is allocated from (see EngineGLCreateInfo::DynamicHeapSize).
+    // Null if the buffer uses its own GL buffer object.
+    GLDynamicHeap* const      m_pDynamicHeap  = nullptr;
+    GLDynamicHeap::OffsetType m_DynamicOffset = 0;
+#ifdef DILIGENT_DEVELOPMENT
+    // The heap frame number when the dynamic space was allocated
+    Uint64 m_DvpMapFrameNumber = ~Uint64{0};
+#endif
+
 #if PLATFORM_WEB
     struct MappedData
     {
@@ -298,6 +298,18 @@ public:
     /// Implementation of IDeviceContextGL::PurgeCurrentGLContextCaches().
     virtual void DILIGENT_CALL_TYPE PurgeCurrentGLContextCaches() override final;
 
+    /// Implementation of IDeviceContextGL::GetBindingStats().
+    virtual const DeviceContextGLBindingStats& DILIGENT_CALL_TYPE GetBindingStats() const override final
+    {
+        return m_ContextState.GetBindingStats();
+    }
+
+    /// Implementation of IDeviceContextGL::ClearBindingStats().
+    virtual void DILIGENT_CALL_TYPE ClearBindingStats() override final
+    {
+        m_ContextState.ClearBindingStats();
+    }
+
     GLContextState& GetContextState() { return m_ContextState; }
 
     void CommitRenderTargets();
@@ -35,6 +35,7 @@
 #include "UniqueIdentifier.hpp"
 #include "GLContext.hpp"
 #include "AsyncWritableResource.hpp"
+#include "DeviceContextGL.h"
 
 namespace Diligent
 {
@@ -59,6 +60,16 @@ public:
     void BindImage         (Uint32 Index, class BufferViewGLImpl* pBuffView, GLenum Access, GLenum Format);
     void BindStorageBlock  (Int32 Index, const GLObjectWrappers::GLBufferObj& Buff, GLintptr Offset, GLsizeiptr Size);
 
+    // Stage*() methods have the same effect as the corresponding Bind*() methods, but when
+    // GL_ARB_multi_bind is supported, the GL calls are deferred until CommitStagedBindings(),
+    // which binds every run of contiguous slots with a single multi-bind call.
+    void StageTexture      (Uint32 Index, GLenum BindTarget, const GLObjectWrappers::GLTextureObj& Tex);
+    void StageSampler      (Uint32 Index, const GLObjectWrappers::GLSamplerObj& GLSampler);
+    void StageUniformBuffer(Uint32 Index, const GLObjectWrappers::GLBufferObj& Buff, GLintptr Offset, GLsizeiptr Size);
+    void StageStorageBlock (Uint32 Index, const GLObjectWrappers::GLBufferObj& Buff, GLintptr Offset, GLsizeiptr Size);
+    void StageImage        (Uint32 Index, class TextureViewGLImpl* pTexView, GLint MipLevel, GLboolean IsLayered, GLint Layer, GLenum Access, GLenum Format);
+    void CommitStagedBindings();
+
     void EnsureMemoryBarrier(MEMORY_BARRIER RequiredBarriers, class AsyncWritableResource *pRes = nullptr);
     void SetPendingMemoryBarriers(MEMORY_BARRIER PendingBarriers);
 
@@ -96,6 +107,9 @@ public:
     void SetNumPatchVertices(Int32 NumVertices);
     void Invalidate();
 
+    const DeviceContextGLBindingStats& GetBindingStats() const { return m_BindingStats; }
+    void                               ClearBindingStats() { m_BindingStats = {}; }
+
     void InvalidateVAO()
     {
         m_VAOId = -1;
@@ -123,6 +137,7 @@ public:
         GLint MaxCombinedTexUnits          = 0;
         GLint MaxDrawBuffers               = 0;
         GLint MaxUniformBufferBindings     = 0;
+        bool  IsMultiBindSupported         = false;
     };
     const ContextCaps& GetContextCaps() { return m_Caps; }
 
@@ -241,6 +256,32 @@ private:
     std::vector<BoundImageInfo>   m_BoundImages;
     std::vector<BoundBufferInfo>  m_BoundStorageBlocks;
 
+    // Bindings deferred by Stage*() methods
+    struct StagedObject
+    {
+        Uint32 Slot     = 0;
+        GLuint GLHandle = 0;
+    };
+    struct StagedBuffer
+    {
+        Uint32     Slot     = 0;
+        GLuint     GLHandle = 0;
+        GLintptr   Offset   = 0;
+        GLsizeiptr Size     = 0;
+    };
+    std::vector<StagedObject> m_StagedTextures;
+    std::vector<StagedObject> m_StagedSamplers;
+    std::vector<StagedObject> m_StagedImages;
+    std::vector<StagedBuffer> m_StagedUniformBuffers;
+    std::vector<StagedBuffer> m_StagedStorageBlocks;
+
+    // Scratch arrays for multi-bind calls
+    std::vector<GLuint>     m_MultiBindHandles;
+    std::vector<GLintptr>   m_MultiBindOffsets;
+    std::vector<GLsizeiptr> m_MultiBindSizes;
+
+    DeviceContextGLBindingStats m_BindingStats;
+
     MEMORY_BARRIER m_PendingMemoryBarriers = MEMORY_BARRIER_NONE;
 
     class EnableStateHelper
@@ -0,0 +1,115 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Declaration of Diligent::GLDynamicHeap class
+
+#include <deque>
+#include <utility>
+
+#include "GraphicsTypes.h"
+#include "RingBuffer.hpp"
+#include "GLObjectWrapper.hpp"
+
+namespace Diligent
+{
+
+/// Persistently mapped ring buffer used to allocate space for dynamic uniform buffers.
+
+/// The heap is backed by a single GL buffer created with glBufferStorage() and mapped once
+/// with GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT. Mapping a dynamic buffer is then a simple
+/// ring buffer allocation, and the buffer is bound with glBindBufferRange() at the allocation offset.
+/// Space is released when the fence inserted at the end of the frame that used it is signaled.
+///
+/// \note   The heap requires OpenGL 4.4 or GL_ARB_buffer_storage. The class is not thread-safe.
+class GLDynamicHeap
+{
+public:
+    using OffsetType = RingBuffer::OffsetType;
+
+    static constexpr OffsetType InvalidOffset = RingBuffer::InvalidOffset;
+
+    GLDynamicHeap(Uint32 Size, Uint32 Alignment);
+    ~GLDynamicHeap();
+
+    // clang-format off
+    GLDynamicHeap             (const GLDynamicHeap&)  = delete;
+    GLDynamicHeap             (      GLDynamicHeap&&) = delete;
+    GLDynamicHeap& operator = (const GLDynamicHeap&)  = delete;
+    GLDynamicHeap& operator = (      GLDynamicHeap&&) = delete;
+    // clang-format on
+
+    /// Returns true if the device supports persistently mapped buffers.
+    static bool IsSupported(const Version& GLVersion, bool HasBufferStorageExt);
+
+    /// Allocates Size bytes from the heap and returns the offset of the allocation,
+    /// or InvalidOffset if the heap is exhausted.
+    ///
+    /// \remarks    If the heap is full, the method waits until the oldest frame
+    ///             completes on the GPU.
+    OffsetType Allocate(OffsetType Size);
+
+    /// Inserts a fence that protects the allocations made since the last call.
+    void FinishFrame();
+
+    /// Returns the number of times FinishFrame() has been called.
+    /// Allocations made before the last call must not be used by new commands.
+    Uint64 GetFrameNumber() const { return m_FrameNumber; }
+
+    Uint8* GetCPUAddress(OffsetType Offset) const
+    {
+        VERIFY_EXPR(Offset < m_Size);
+        return m_pCPUAddress + Offset;
+    }
+
+    const GLObjectWrappers::GLBufferObj& GetGLBuffer() const { return m_GLBuffer; }
+
+private:
+    void ReleaseCompletedFrames(bool WaitForOldest);
+
+    GLObjectWrappers::GLBufferObj m_GLBuffer;
+
+    Uint8*           m_pCPUAddress = nullptr;
+    const OffsetType m_Size;
+    const OffsetType m_Alignment;
+
+    RingBuffer m_RingBuffer;
+
+    // Allocations made since the last call to FinishFrame()
+    OffsetType m_CurrFrameSize = 0;
+
+    Uint64 m_NextFenceValue = 1;
+
+    Uint64 m_FrameNumber = 0;
+
+    std::deque<std::pair<Uint64, GLObjectWrappers::GLSyncObj>> m_PendingFences;
+
+    OffsetType m_PeakUsedSize = 0;
+};
+
+} // namespace Diligent
@@ -38,13 +38,46 @@ namespace Diligent
 
 class ShaderGLImpl;
 class GLContextState;
+class GLProgramCache;
+
+// Identifies the program binary in the program binary cache.
+// The key is the 128-bit hash of the sources and types of all attached shaders.
+struct GLProgramBinaryKey
+{
+    Uint64 Hash0 = 0;
+    Uint64 Hash1 = 0;
+
+    bool operator==(const GLProgramBinaryKey& Other) const noexcept
+    {
+        return Hash0 == Other.Hash0 && Hash1 == Other.Hash1;
+    }
+
+    struct Hasher
+    {
+        size_t operator()(const GLProgramBinaryKey& Key) const noexcept
+        {
+            return static_cast<size_t>(Key.Hash0 ^ Key.Hash1);
+        }
+    };
+};
 
 class GLProgram
 {
 public:
-    GLProgram(ShaderGLImpl* const* ppShaders,
-              Uint32               NumShaders,
-              bool                 IsSeparableProgram) noexcept;
+    // If pBinaryCache is not null, the binary of the successfully linked program
+    // is added to the cache with the given key.
+    GLProgram(ShaderGLImpl* const*      ppShaders,
+              Uint32                    NumShaders,
+              bool                      IsSeparableProgram,
+              GLProgramCache*           pBinaryCache = nullptr,
+              const GLProgramBinaryKey& BinaryKey    = {}) noexcept;
+
+    // Creates the program from the binary retrieved by glGetProgramBinary.
+    // The driver may reject the binary, in which case GetLinkStatus() returns LinkStatus::Failed.
+    GLProgram(const void* pBinary,
+              size_t      BinarySize,
+              GLenum      BinaryFormat,
+              bool        IsSeparableProgram) noexcept;
     ~GLProgram();
 
     const GLObjectWrappers::GLProgramObj& GetGLHandle() const { return m_GLProg; }
@@ -82,6 +115,9 @@ private:
     std::vector<const ShaderGLImpl*> m_AttachedShaders;
     std::string                      m_InfoLog;
 
+    GLProgramCache*    m_pBinaryCache = nullptr;
+    GLProgramBinaryKey m_BinaryKey;
+
     LinkStatus m_LinkStatus      = LinkStatus::Undefined;
     bool       m_BindingsApplied = false;
 
@@ -29,8 +29,11 @@
 #include <memory>
 #include <unordered_map>
 #include <mutex>
+#include <atomic>
 #include <vector>
+#include <string>
 
+#include "RenderDeviceGL.h"
 #include "GraphicsTypesX.hpp"
 #include "GLProgram.hpp"
 
@@ -38,6 +41,7 @@ namespace Diligent
 {
 
 class ShaderGLImpl;
+struct IDataBlob;
 
 /// Program cached contains linked programs for the given combination of shaders and resource layouts.
 class GLProgramCache
@@ -67,7 +71,31 @@ public:
 
     SharedGLProgramObjPtr GetProgram(const GetProgramAttribs& Attribs);
 
+    // Enables the program binary cache.
+    // DriverId identifies the driver and the GPU; binaries written by a different driver are not loaded.
+    void EnableBinaryCache(std::string DriverId);
+
+    bool IsBinaryCacheEnabled() const { return m_BinaryCacheEnabled; }
+
+    // Loads program binaries written by StoreProgramBinaries().
+    bool LoadProgramBinaries(const void* pData, size_t Size);
+
+    // Writes all program binaries to a data blob.
+    void StoreProgramBinaries(IDataBlob** ppData);
+
+    // Adds the binary of the linked program to the cache.
+    void AddProgramBinary(const GLProgramBinaryKey& Key, GLenum Format, std::vector<Uint8>&& Binary);
+
+    ProgramBinaryCacheStatsGL GetBinaryCacheStats() const;
+
 private:
+    static GLProgramBinaryKey ComputeBinaryKey(const GetProgramAttribs& Attribs);
+
+    // Creates the program from the cached binary. Returns null if there is no binary for the key
+    // or if the driver rejected the binary.
+    SharedGLProgramObjPtr CreateProgramFromBinary(const GLProgramBinaryKey& Key, bool IsSeparableProgram);
+
+
     struct ProgramCacheKey
     {
     public:
@@ -97,6 +125,23 @@ private:
 
     std::mutex                                                                           m_CacheMtx;
     std::unordered_map<ProgramCacheKey, std::weak_ptr<GLProgram>, ProgramCacheKeyHasher> m_Cache;
+
+    struct ProgramBinary
+    {
+        GLenum             Format = 0;
+        std::vector<Uint8> Data;
+    };
+    using ProgramBinaryMap = std::unordered_map<GLProgramBinaryKey, std::shared_ptr<const ProgramBinary>, GLProgramBinaryKey::Hasher>;
+
+    bool        m_BinaryCacheEnabled = false;
+    std::string m_DriverId;
+
+    std::mutex       m_BinariesMtx;
+    ProgramBinaryMap m_Binaries;
+
+    std::atomic<Uint32> m_NumBinaryHits{0};
+    std::atomic<Uint32> m_NumBinaryMisses{0};
+    std::atomic<Uint32> m_NumBinaryRejected{0};
 };
 
 } // namespace Diligent
@@ -144,7 +144,8 @@ public:
     // Updates inline constant buffers by mapping the shared dynamic UBOs and copying
     // data from the CPU-side staging buffer in the resource cache.
     void UpdateInlineConstantBuffers(const ShaderResourceCacheGL& ResourceCache,
-                                     class GLContextState&        CtxState) const;
+                                     class GLContextState&        CtxState,
+                                     const TBindings&             BaseBindings) const;
 
     Uint32 GetImmutableSamplerIdx(const ResourceAttribs& Res) const
     {
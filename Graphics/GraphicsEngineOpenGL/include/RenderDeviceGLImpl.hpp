@@ -36,6 +36,7 @@
 #include "BaseInterfacesGL.h"
 #include "FBOCache.hpp"
 #include "GLProgramCache.hpp"
+#include "GLDynamicHeap.hpp"
 
 namespace Diligent
 {
@@ -171,6 +172,18 @@ public:
                                                        RESOURCE_STATE     InitialState,
                                                        ITexture**         ppTexture) override final;
 
+    /// Implementation of IRenderDeviceGL::LoadProgramBinaries().
+    virtual Bool DILIGENT_CALL_TYPE LoadProgramBinaries(const IDataBlob* pData) override final;
+
+    /// Implementation of IRenderDeviceGL::StoreProgramBinaries().
+    virtual void DILIGENT_CALL_TYPE StoreProgramBinaries(IDataBlob** ppData) override final;
+
+    /// Implementation of IRenderDeviceGL::GetProgramBinaryCacheStats().
+    virtual ProgramBinaryCacheStatsGL DILIGENT_CALL_TYPE GetProgramBinaryCacheStats() const override final
+    {
+        return m_ProgramCache.GetBinaryCacheStats();
+    }
+
     /// Implementation of IRenderDevice::ReleaseStaleResources() in OpenGL backend.
     virtual void DILIGENT_CALL_TYPE ReleaseStaleResources(bool ForceRelease = false) override final {}
 
@@ -209,6 +222,9 @@ public:
 
     GLProgramCache& GetProgramCache() { return m_ProgramCache; }
 
+    // Returns null if the dynamic heap is disabled or not supported by the device
+    GLDynamicHeap* GetDynamicHeap() { return m_pDynamicHeap.get(); }
+
     size_t GetCommandQueueCount() const { return 1; }
     Uint64 GetCommandQueueMask() const { return Uint64{1}; }
 
@@ -251,11 +267,15 @@ protected:
 
     GLProgramCache m_ProgramCache;
 
+    std::unique_ptr<GLDynamicHeap> m_pDynamicHeap;
+
 private:
     virtual void TestTextureFormat(TEXTURE_FORMAT TexFormat) override final;
     bool         CheckExtension(const Char* ExtensionString) const;
     void         FlagSupportedTexFormats();
     void         InitAdapterInfo();
+    void         InitProgramBinaryCache();
+    void         InitDynamicHeap(Uint32 Size);
 
     int m_ShowDebugGLOutput = 1;
 
@@ -54,6 +54,12 @@ public:
     ~ShaderResourceBindingGLImpl();
 
     IMPLEMENT_QUERY_INTERFACE_IN_PLACE(IID_ShaderResourceBindingGL, TBase)
+
+    // Binds the resources through the implementations of the variables of different resource types.
+    // Hides ShaderResourceBindingBase::BindVariables().
+    void BindVariables(const ShaderVariableBinding* pBindings,
+                       Uint32                       NumBindings,
+                       SET_SHADER_RESOURCE_FLAGS    Flags);
 };
 
 } // namespace Diligent
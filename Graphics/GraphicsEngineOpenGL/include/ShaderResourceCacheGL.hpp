@@ -79,7 +79,14 @@ public:
         // buffer is USAGE_DYNAMIC or not.
         bool IsDynamic() const
         {
-            return pBuffer && RangeSize < pBuffer->GetDesc().Size;
+            // Buffers that use the dynamic heap get a new offset every time they are mapped
+            return pBuffer && (RangeSize < pBuffer->GetDesc().Size || pBuffer->UsesDynamicHeap());
+        }
+
+        GLintptr GetBindOffset() const
+        {
+            VERIFY_EXPR(pBuffer);
+            return static_cast<GLintptr>(BaseOffset) + static_cast<GLintptr>(DynamicOffset) + static_cast<GLintptr>(pBuffer->GetDynamicOffset());
         }
 
         void SetInlineConstants(const void* pSrcConstants, Uint32 FirstConstant, Uint32 NumConstants)
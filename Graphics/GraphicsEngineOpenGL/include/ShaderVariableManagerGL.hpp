@@ -57,6 +57,7 @@
 #include "Object.h"
 #include "PipelineResourceAttribsGL.hpp"
 #include "ShaderResourceVariableBase.hpp"
+#include "ShaderResourceBinding.h"
 #include "ShaderResourceCacheGL.hpp"
 
 namespace Diligent
@@ -206,6 +207,12 @@ public:
     IShaderResourceVariable* GetVariable(const Char* Name) const;
     IShaderResourceVariable* GetVariable(Uint32 Index) const;
 
+    // Binds the objects to the elements of the variable with the given index.
+    // Unlike IShaderResourceVariable::SetArray(), the binding is not validated.
+    void BindVariable(Uint32                       Index,
+                      const ShaderVariableBinding& Binding,
+                      SET_SHADER_RESOURCE_FLAGS    Flags) const;
+
     IObject& GetOwner() { return m_Owner; }
 
     Uint32 GetVariableCount() const
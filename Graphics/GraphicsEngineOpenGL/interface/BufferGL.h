@@ -49,6 +49,11 @@ static DILIGENT_CONSTEXPR INTERFACE_ID IID_BufferGL =
 DILIGENT_BEGIN_INTERFACE(IBufferGL, IBuffer)
 {
     /// Returns OpenGL buffer handle
+
+    /// \remarks   If the buffer is allocated from the dynamic heap (see Diligent::EngineGLCreateInfo::DynamicHeapSize),
+    ///            the method returns the handle of the heap buffer that is shared by all such buffers.
+    ///            The buffer data is located at an offset in the heap buffer that changes every time
+    ///            the buffer is mapped, so the handle can't be used to access the buffer data.
     VIRTUAL GLuint METHOD(GetGLBufferHandle)(THIS) CONST PURE;
 };
 DILIGENT_END_INTERFACE
@@ -49,6 +49,32 @@ static DILIGENT_CONSTEXPR INTERFACE_ID IID_DeviceContextGL =
 
 // clang-format off
 
+/// Resource binding statistics of the OpenGL device context.
+
+/// Every counter is the number of GL calls issued to bind resources of the corresponding type.
+/// A single multi-bind call (e.g. `glBindTextures`) that binds several slots counts as one call.
+struct DeviceContextGLBindingStats
+{
+    /// The number of `glBindTexture` and `glBindTextures` calls.
+    Uint32 TextureBindCalls       DEFAULT_INITIALIZER(0);
+
+    /// The number of `glBindSampler` and `glBindSamplers` calls.
+    Uint32 SamplerBindCalls       DEFAULT_INITIALIZER(0);
+
+    /// The number of `glBindBufferRange` and `glBindBuffersRange` calls for uniform buffers.
+    Uint32 UniformBufferBindCalls DEFAULT_INITIALIZER(0);
+
+    /// The number of `glBindBufferRange` and `glBindBuffersRange` calls for shader storage buffers.
+    Uint32 StorageBufferBindCalls DEFAULT_INITIALIZER(0);
+
+    /// The number of `glBindImageTexture` and `glBindImageTextures` calls.
+    Uint32 ImageBindCalls         DEFAULT_INITIALIZER(0);
+
+    /// The number of multi-bind calls included in the counters above.
+    Uint32 MultiBindCalls         DEFAULT_INITIALIZER(0);
+};
+typedef struct DeviceContextGLBindingStats DeviceContextGLBindingStats;
+
 /// Exposes OpenGL-specific functionality of a device context.
 DILIGENT_BEGIN_INTERFACE(IDeviceContextGL, IDeviceContext)
 {
@@ -72,6 +98,17 @@ DILIGENT_BEGIN_INTERFACE(IDeviceContextGL, IDeviceContext)
     /// to obtain the default FBO handle.
     VIRTUAL void METHOD(SetSwapChain)(THIS_
                                       struct ISwapChainGL* pSwapChain) PURE;
+
+    /// Returns resource binding statistics accumulated since the last call to ClearBindingStats().
+
+    /// \remarks   When `GL_ARB_multi_bind` is available, resources in contiguous binding
+    ///             slots are bound with a single call (`glBindTextures`, `glBindSamplers`,
+    ///             `glBindBuffersRange`, `glBindImageTextures`). The statistics can be used to
+    ///             verify the number of GL calls issued per draw command.
+    VIRTUAL const DeviceContextGLBindingStats REF METHOD(GetBindingStats)(THIS) CONST PURE;
+
+    /// Resets resource binding statistics.
+    VIRTUAL void METHOD(ClearBindingStats)(THIS) PURE;
 };
 DILIGENT_END_INTERFACE
 
@@ -84,6 +121,8 @@ DILIGENT_END_INTERFACE
 #    define IDeviceContextGL_UpdateCurrentGLContext(This)      CALL_IFACE_METHOD(DeviceContextGL, UpdateCurrentGLContext,      This)
 #    define IDeviceContextGL_PurgeCurrentGLContextCaches(This) CALL_IFACE_METHOD(DeviceContextGL, PurgeCurrentGLContextCaches, This)
 #    define IDeviceContextGL_SetSwapChain(This, ...)           CALL_IFACE_METHOD(DeviceContextGL, SetSwapChain,                This, __VA_ARGS__)
+#    define IDeviceContextGL_GetBindingStats(This)             CALL_IFACE_METHOD(DeviceContextGL, GetBindingStats,             This)
+#    define IDeviceContextGL_ClearBindingStats(This)           CALL_IFACE_METHOD(DeviceContextGL, ClearBindingStats,           This)
 
 // clang-format on
 
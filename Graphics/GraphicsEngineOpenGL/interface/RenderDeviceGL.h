@@ -80,6 +80,21 @@ typedef struct NativeGLContextAttribsAndroid NativeGLContextAttribsAndroid;
 typedef struct NativeGLContextAttribsAndroid NativeGLContextAttribs;
 #endif
 
+/// Program binary cache statistics, see IRenderDeviceGL::GetProgramBinaryCacheStats().
+struct ProgramBinaryCacheStatsGL
+{
+    /// The number of programs that were created from cached binaries.
+    Uint32 NumBinaryHits     DEFAULT_INITIALIZER(0);
+
+    /// The number of programs that were not found in the cache and were linked from source.
+    Uint32 NumBinaryMisses   DEFAULT_INITIALIZER(0);
+
+    /// The number of cached binaries that were rejected by the driver.
+    /// Programs whose binaries were rejected are linked from source and are also counted as misses.
+    Uint32 NumBinaryRejected DEFAULT_INITIALIZER(0);
+};
+typedef struct ProgramBinaryCacheStatsGL ProgramBinaryCacheStatsGL;
+
 /// Exposes OpenGL-specific functionality of a render device.
 DILIGENT_BEGIN_INTERFACE(IRenderDeviceGL, IRenderDevice)
 {
@@ -149,6 +164,36 @@ DILIGENT_BEGIN_INTERFACE(IRenderDeviceGL, IRenderDevice)
                                             RESOURCE_STATE        InitialState,
                                             ITexture**            ppTexture) PURE;
 
+
+    /// Loads program binaries previously written by IRenderDeviceGL::StoreProgramBinaries().
+
+    /// \param [in] pData - Program binary data.
+    ///
+    /// \return     true if the binaries were loaded successfully, and false otherwise.
+    ///             The function returns false if the data was written by a different
+    ///             driver or GPU, or if the program binary cache is not enabled
+    ///             (see Diligent::EngineGLCreateInfo::EnableProgramBinaryCache).
+    ///
+    /// \remarks    Programs created after this call are loaded from the binaries, if possible.
+    ///             If the driver rejects a binary, the binary is discarded and the program is linked
+    ///             from source.
+    VIRTUAL Bool METHOD(LoadProgramBinaries)(THIS_
+                                             const IDataBlob* pData) PURE;
+
+    /// Writes the binaries of all programs in the program binary cache to a data blob.
+
+    /// \param [out] ppData - Address of the memory location where the pointer to the data
+    ///                       blob will be written. If the program binary cache is not enabled,
+    ///                       null will be written.
+    VIRTUAL void METHOD(StoreProgramBinaries)(THIS_
+                                              IDataBlob** ppData) PURE;
+
+    /// Returns the program binary cache statistics.
+
+    /// \remarks   The statistics are accumulated over the lifetime of the device.
+    ///             If the program binary cache is not enabled, all counters are zero.
+    VIRTUAL ProgramBinaryCacheStatsGL METHOD(GetProgramBinaryCacheStats)(THIS) CONST PURE;
+
 #if PLATFORM_WIN32 || PLATFORM_ANDROID
     /// Returns platform-specific GL context attributes
     VIRTUAL NativeGLContextAttribs METHOD(GetNativeGLContextAttribs)(THIS) CONST PURE;
@@ -165,6 +210,9 @@ DILIGENT_END_INTERFACE
 #    define IRenderDeviceGL_CreateTextureFromGLHandle(This, ...)CALL_IFACE_METHOD(RenderDeviceGL, CreateTextureFromGLHandle, This, __VA_ARGS__)
 #    define IRenderDeviceGL_CreateBufferFromGLHandle(This, ...) CALL_IFACE_METHOD(RenderDeviceGL, CreateBufferFromGLHandle,  This, __VA_ARGS__)
 #    define IRenderDeviceGL_CreateDummyTexture(This, ...)       CALL_IFACE_METHOD(RenderDeviceGL, CreateDummyTexture,        This, __VA_ARGS__)
+#    define IRenderDeviceGL_LoadProgramBinaries(This, ...)      CALL_IFACE_METHOD(RenderDeviceGL, LoadProgramBinaries,       This, __VA_ARGS__)
+#    define IRenderDeviceGL_StoreProgramBinaries(This, ...)     CALL_IFACE_METHOD(RenderDeviceGL, StoreProgramBinaries,      This, __VA_ARGS__)
+#    define IRenderDeviceGL_GetProgramBinaryCacheStats(This)    CALL_IFACE_METHOD(RenderDeviceGL, GetProgramBinaryCacheStats,This)
 #    define IRenderDeviceGL_GetNativeGLContextAttribs(This)     CALL_IFACE_METHOD(RenderDeviceGL, GetNativeGLContextAttribs, This)
 
 // clang-format on
@@ -69,6 +69,17 @@ static GLenum GetBufferBindTarget(const BufferDesc& Desc)
 
     return Target;
 }
+
+static GLDynamicHeap* GetBufferDynamicHeap(RenderDeviceGLImpl* pDeviceGL, const BufferDesc& Desc)
+{
+    // Only dynamic uniform buffers are allocated from the dynamic heap. VAOs and buffer views
+    // reference the GL buffer object directly, so all other buffers need their own buffer object.
+    if (Desc.Usage == USAGE_DYNAMIC && Desc.BindFlags == BIND_UNIFORM_BUFFER)
+        return pDeviceGL->GetDynamicHeap();
+    else
+        return nullptr;
+}
+
 BufferGLImpl::BufferGLImpl(IReferenceCounters*        pRefCounters,
                            FixedBlockMemoryAllocator& BuffViewObjMemAllocator,
                            RenderDeviceGLImpl*        pDeviceGL,
@@ -85,9 +96,10 @@ BufferGLImpl::BufferGLImpl(IReferenceCounters*        pRefCounters,
         BuffDesc,
         bIsDeviceInternal
     },
-    m_GlBuffer    {true                          }, // Create buffer immediately
-    m_BindTarget  {GetBufferBindTarget(BuffDesc) },
-    m_GLUsageHint {UsageToGLUsage(BuffDesc)}
+    m_GlBuffer    {GetBufferDynamicHeap(pDeviceGL, BuffDesc) == nullptr}, // Create buffer immediately unless it uses the dynamic heap
+    m_BindTarget  {GetBufferBindTarget(BuffDesc)                       },
+    m_GLUsageHint {UsageToGLUsage(BuffDesc)                            },
+    m_pDynamicHeap{GetBufferDynamicHeap(pDeviceGL, BuffDesc)           }
 // clang-format on
 {
     ValidateBufferInitData(BuffDesc, pBuffData);
@@ -97,6 +109,15 @@ BufferGLImpl::BufferGLImpl(IReferenceCounters*        pRefCounters,
         LOG_ERROR_AND_THROW("Unified resources are not supported in OpenGL/GLES");
     }
 
+    m_MemoryProperties = MEMORY_PROPERTY_HOST_COHERENT;
+
+    if (m_pDynamicHeap != nullptr)
+    {
+        // The space is allocated from the dynamic heap when the buffer is mapped
+        m_DynamicOffset = GLDynamicHeap::InvalidOffset;
+        return;
+    }
+
     // TODO: find out if it affects performance if the buffer is originally bound to one target
     // and then bound to another (such as first to GL_ARRAY_BUFFER and then to GL_UNIFORM_BUFFER)
 
@@ -148,8 +169,6 @@ BufferGLImpl::BufferGLImpl(IReferenceCounters*        pRefCounters,
     DEV_CHECK_GL_ERROR("glBufferData() failed");
     GLState.BindBuffer(m_BindTarget, GLObjectWrappers::GLBufferObj::Null(), ResetVAO);
 
-    m_MemoryProperties = MEMORY_PROPERTY_HOST_COHERENT;
-
     m_GlBuffer.SetName(m_Desc.Name);
 }
 
@@ -214,6 +233,12 @@ BufferGLImpl::~BufferGLImpl()
 
 void BufferGLImpl::UpdateData(GLContextState& CtxState, Uint64 Offset, Uint64 Size, const void* pData)
 {
+    if (m_pDynamicHeap != nullptr)
+    {
+        DEV_ERROR("Buffer '", m_Desc.Name, "' uses the dynamic heap and must be updated via Map()");
+        return;
+    }
+
     BufferMemoryBarrier(
         MEMORY_BARRIER_BUFFER_UPDATE, // Reads or writes to buffer objects via any OpenGL API functions that allow
                                       // modifying their contents will reflect data written by shaders prior to the barrier.
@@ -234,6 +259,12 @@ void BufferGLImpl::UpdateData(GLContextState& CtxState, Uint64 Offset, Uint64 Si
 
 void BufferGLImpl::CopyData(GLContextState& CtxState, BufferGLImpl& SrcBufferGL, Uint64 SrcOffset, Uint64 DstOffset, Uint64 Size)
 {
+    if (m_pDynamicHeap != nullptr)
+    {
+        DEV_ERROR("Buffer '", m_Desc.Name, "' uses the dynamic heap and cannot be a copy destination");
+        return;
+    }
+
     BufferMemoryBarrier(
         MEMORY_BARRIER_BUFFER_UPDATE, // Reads or writes to buffer objects via any OpenGL API functions that allow
                                       // modifying their contents will reflect data written by shaders prior to the barrier.
@@ -251,7 +282,8 @@ void BufferGLImpl::CopyData(GLContextState& CtxState, BufferGLImpl& SrcBufferGL,
     // what was bound to the target before your copy.
     constexpr bool ResetVAO = false; // No need to reset VAO for READ/WRITE targets
     CtxState.BindBuffer(GL_COPY_WRITE_BUFFER, m_GlBuffer, ResetVAO);
-    CtxState.BindBuffer(GL_COPY_READ_BUFFER, SrcBufferGL.m_GlBuffer, ResetVAO);
+    CtxState.BindBuffer(GL_COPY_READ_BUFFER, SrcBufferGL.GetGLHandle(), ResetVAO);
+    SrcOffset += SrcBufferGL.GetDynamicOffset();
     glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, StaticCast<GLintptr>(SrcOffset), StaticCast<GLintptr>(DstOffset), StaticCast<GLsizeiptr>(Size));
     DEV_CHECK_GL_ERROR("glCopyBufferSubData() failed");
     CtxState.BindBuffer(GL_COPY_READ_BUFFER, GLObjectWrappers::GLBufferObj::Null(), ResetVAO);
@@ -260,6 +292,22 @@ void BufferGLImpl::CopyData(GLContextState& CtxState, BufferGLImpl& SrcBufferGL,
 
 void BufferGLImpl::Map(GLContextState& CtxState, MAP_TYPE MapType, Uint32 MapFlags, PVoid& pMappedData)
 {
+    if (m_pDynamicHeap != nullptr)
+    {
+        VERIFY(MapType == MAP_WRITE, "Dynamic buffers can only be mapped for writing");
+        if ((MapFlags & MAP_FLAG_NO_OVERWRITE) == 0 || m_DynamicOffset == GLDynamicHeap::InvalidOffset)
+        {
+            // Discarding the buffer is a simple ring buffer allocation. The previous allocation
+            // remains valid until the GPU is done with the frame that used it.
+            m_DynamicOffset = m_pDynamicHeap->Allocate(StaticCast<GLDynamicHeap::OffsetType>(m_Desc.Size));
+#ifdef DILIGENT_DEVELOPMENT
+            m_DvpMapFrameNumber = m_pDynamicHeap->GetFrameNumber();
+#endif
+        }
+        pMappedData = m_DynamicOffset != GLDynamicHeap::InvalidOffset ? m_pDynamicHeap->GetCPUAddress(m_DynamicOffset) : nullptr;
+        return;
+    }
+
     MapRange(CtxState, MapType, MapFlags, 0, m_Desc.Size, pMappedData);
 }
 
@@ -375,6 +423,12 @@ void BufferGLImpl::MapRange(GLContextState& CtxState, MAP_TYPE MapType, Uint32 M
 
 void BufferGLImpl::Unmap(GLContextState& CtxState)
 {
+    if (m_pDynamicHeap != nullptr)
+    {
+        // The heap buffer is persistently and coherently mapped
+        return;
+    }
+
     constexpr bool ResetVAO = true;
     CtxState.BindBuffer(m_BindTarget, m_GlBuffer, ResetVAO);
     GLboolean Result = glUnmapBuffer(m_BindTarget);
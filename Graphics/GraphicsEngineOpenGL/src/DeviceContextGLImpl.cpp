@@ -757,7 +757,7 @@ void DeviceContextGLImpl::BindProgramResources(Uint32 BindSRBMask, bool DynamicB
             {
                 if (PipelineResourceSignatureGLImpl* pSign = m_pPipelineState->GetResourceSignature(sign))
                 {
-                    pSign->UpdateInlineConstantBuffers(*pResourceCache, GetContextState());
+                    pSign->UpdateInlineConstantBuffers(*pResourceCache, GetContextState(), BaseBindings);
                 }
                 else
                 {
@@ -1601,6 +1601,9 @@ void DeviceContextGLImpl::Flush()
 
 void DeviceContextGLImpl::FinishFrame()
 {
+    if (GLDynamicHeap* pDynamicHeap = m_pDevice->GetDynamicHeap())
+        pDynamicHeap->FinishFrame();
+
     TDeviceContextBase::EndFrame();
 }
 
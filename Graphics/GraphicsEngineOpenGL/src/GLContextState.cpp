@@ -36,6 +36,9 @@
 
 #include "AsyncWritableResource.hpp"
 #include "GLTypeConversions.hpp"
+#include "TextureViewGLImpl.hpp"
+
+#include <algorithm>
 
 using namespace GLObjectWrappers;
 
@@ -66,6 +69,12 @@ GLContextState::GLContextState(RenderDeviceGLImpl* pDeviceGL)
         VERIFY_EXPR(m_Caps.MaxUniformBufferBindings > 0);
     }
 
+#if GL_ARB_multi_bind
+    m_Caps.IsMultiBindSupported =
+        (pDeviceGL->GetDeviceInfo().APIVersion >= Version{4, 4} || pDeviceGL->CheckExtension("GL_ARB_multi_bind")) &&
+        glBindTextures != nullptr && glBindSamplers != nullptr && glBindBuffersRange != nullptr && glBindImageTextures != nullptr;
+#endif
+
     m_BoundTextures.reserve(m_Caps.MaxCombinedTexUnits);
     m_BoundSamplers.reserve(32);
     m_BoundImages.reserve(32);
@@ -110,6 +119,10 @@ void GLContextState::Invalidate()
     m_BoundUniformBuffers.clear();
     m_BoundStorageBlocks.clear();
 
+    VERIFY(m_StagedTextures.empty() && m_StagedSamplers.empty() && m_StagedImages.empty() &&
+               m_StagedUniformBuffers.empty() && m_StagedStorageBlocks.empty(),
+           "Staged bindings must be committed before the state is invalidated");
+
     m_DSState = DepthStencilGLState{};
     m_RSState = RasterizerGLState{};
 
@@ -243,11 +256,21 @@ void GLContextState::BindTexture(Int32 Index, GLenum BindTarget, const GLObjectW
         {
             glBindTexture(BoundTex.BindTarget, 0);
             DEV_CHECK_GL_ERROR("Failed to unbind texture from target ", BindTarget, " slot ", Index, ".");
+            ++m_BindingStats.TextureBindCalls;
         }
         glBindTexture(BindTarget, TexObj);
         DEV_CHECK_GL_ERROR("Failed to bind texture to target ", BindTarget, " slot ", Index, ".");
+        ++m_BindingStats.TextureBindCalls;
 
         BoundTex = NewTex;
+
+        if (!m_StagedTextures.empty())
+        {
+            // Make sure that the staged binding does not override this one
+            m_StagedTextures.erase(std::remove_if(m_StagedTextures.begin(), m_StagedTextures.end(),
+                                                  [Index](const StagedObject& Staged) { return Staged.Slot == static_cast<Uint32>(Index); }),
+                                   m_StagedTextures.end());
+        }
     }
 }
 
@@ -261,6 +284,7 @@ void GLContextState::BindSampler(Uint32 Index, const GLObjectWrappers::GLSampler
     {
         glBindSampler(Index, GLSamplerHandle);
         DEV_CHECK_GL_ERROR("Failed to bind sampler to slot ", Index);
+        ++m_BindingStats.SamplerBindCalls;
     }
 }
 
@@ -290,6 +314,7 @@ void GLContextState::BindImage(Uint32             Index,
         m_BoundImages[Index] = NewImageInfo;
         glBindImageTexture(Index, NewImageInfo.GLHandle, MipLevel, IsLayered, Layer, Access, Format);
         DEV_CHECK_GL_ERROR("glBindImageTexture() failed");
+        ++m_BindingStats.ImageBindCalls;
     }
 #else
     UNSUPPORTED("GL_ARB_shader_image_load_store is not supported");
@@ -316,6 +341,7 @@ void GLContextState::BindImage(Uint32 Index, BufferViewGLImpl* pBuffView, GLenum
         m_BoundImages[Index] = NewImageInfo;
         glBindImageTexture(Index, NewImageInfo.GLHandle, 0, GL_FALSE, 0, Access, Format);
         DEV_CHECK_GL_ERROR("glBindImageTexture() failed");
+        ++m_BindingStats.ImageBindCalls;
     }
 #else
     UNSUPPORTED("GL_ARB_shader_image_load_store is not supported");
@@ -372,6 +398,7 @@ void GLContextState::BindUniformBuffer(Int32 Index, const GLObjectWrappers::GLBu
         // buffer to the generic buffer binding point specified by target.
         glBindBufferRange(GL_UNIFORM_BUFFER, Index, GLBufferHandle, Offset, Size);
         DEV_CHECK_GL_ERROR("Failed to bind uniform buffer to slot ", Index);
+        ++m_BindingStats.UniformBufferBindCalls;
     }
 }
 
@@ -390,12 +417,280 @@ void GLContextState::BindStorageBlock(Int32 Index, const GLObjectWrappers::GLBuf
         // buffer to the generic buffer binding point specified by target.
         glBindBufferRange(GL_SHADER_STORAGE_BUFFER, Index, GLBufferHandle, Offset, Size);
         DEV_CHECK_GL_ERROR("Failed to bind shader storage block to slot ", Index);
+        ++m_BindingStats.StorageBufferBindCalls;
     }
 #else
     UNSUPPORTED("GL_ARB_shader_image_load_store is not supported");
 #endif
 }
 
+template <typename StagedType>
+static void StageBinding(std::vector<StagedType>& StagedBindings, const StagedType& NewBinding)
+{
+    // Only a handful of slots are staged between commits, so linear search is fine.
+    for (StagedType& Staged : StagedBindings)
+    {
+        if (Staged.Slot == NewBinding.Slot)
+        {
+            Staged = NewBinding;
+            return;
+        }
+    }
+    StagedBindings.push_back(NewBinding);
+}
+
+void GLContextState::StageTexture(Uint32 Index, GLenum BindTarget, const GLObjectWrappers::GLTextureObj& TexObj)
+{
+    if (!m_Caps.IsMultiBindSupported)
+    {
+        BindTexture(static_cast<Int32>(Index), BindTarget, TexObj);
+        return;
+    }
+
+    VERIFY_EXPR(BindTarget != 0);
+    VERIFY(static_cast<Int32>(Index) < m_Caps.MaxCombinedTexUnits, "Texture unit is out of range");
+
+    if (static_cast<size_t>(Index) >= m_BoundTextures.size())
+        m_BoundTextures.resize(size_t{Index} + 1);
+
+    BoundTextureInfo  NewTex{TexObj ? TexObj.GetUniqueID() : 0, BindTarget};
+    BoundTextureInfo& BoundTex = m_BoundTextures[Index];
+    if (BoundTex != NewTex)
+    {
+        // glBindTextures() binds the texture to the target defined by its type and does not
+        // unbind other targets, so unbind the texture from the previous target now.
+        if (BoundTex.BindTarget != 0 && BoundTex.BindTarget != BindTarget && BoundTex.TexID != 0)
+        {
+            SetActiveTexture(static_cast<Int32>(Index));
+            glBindTexture(BoundTex.BindTarget, 0);
+            DEV_CHECK_GL_ERROR("Failed to unbind texture from target ", BindTarget, " slot ", Index, ".");
+            ++m_BindingStats.TextureBindCalls;
+        }
+
+        BoundTex = NewTex;
+        StageBinding(m_StagedTextures, StagedObject{Index, static_cast<GLuint>(TexObj)});
+    }
+}
+
+void GLContextState::StageSampler(Uint32 Index, const GLObjectWrappers::GLSamplerObj& GLSampler)
+{
+    if (!m_Caps.IsMultiBindSupported)
+    {
+        BindSampler(Index, GLSampler);
+        return;
+    }
+
+    if (static_cast<size_t>(Index) >= m_BoundSamplers.size())
+        m_BoundSamplers.resize(size_t{Index} + 1, -1);
+
+    GLuint GLSamplerHandle = 0;
+    if (UpdateBoundObject(m_BoundSamplers[Index], GLSampler, GLSamplerHandle))
+    {
+        StageBinding(m_StagedSamplers, StagedObject{Index, GLSamplerHandle});
+    }
+}
+
+void GLContextState::StageUniformBuffer(Uint32 Index, const GLObjectWrappers::GLBufferObj& Buff, GLintptr Offset, GLsizeiptr Size)
+{
+    if (!m_Caps.IsMultiBindSupported)
+    {
+        BindUniformBuffer(static_cast<Int32>(Index), Buff, Offset, Size);
+        return;
+    }
+
+    VERIFY(static_cast<Int32>(Index) < m_Caps.MaxUniformBufferBindings, "Uniform buffer index is out of range");
+
+    BoundBufferInfo NewUBOInfo{Buff.GetUniqueID(), Offset, Size};
+    if (Index >= m_BoundUniformBuffers.size())
+        m_BoundUniformBuffers.resize(size_t{Index} + 1);
+
+    if (m_BoundUniformBuffers[Index] != NewUBOInfo)
+    {
+        m_BoundUniformBuffers[Index] = NewUBOInfo;
+        StageBinding(m_StagedUniformBuffers, StagedBuffer{Index, static_cast<GLuint>(Buff), Offset, Size});
+    }
+}
+
+void GLContextState::StageStorageBlock(Uint32 Index, const GLObjectWrappers::GLBufferObj& Buff, GLintptr Offset, GLsizeiptr Size)
+{
+    if (!m_Caps.IsMultiBindSupported)
+    {
+        BindStorageBlock(static_cast<Int32>(Index), Buff, Offset, Size);
+        return;
+    }
+
+    BoundBufferInfo NewSSBOInfo{Buff.GetUniqueID(), Offset, Size};
+    if (Index >= m_BoundStorageBlocks.size())
+        m_BoundStorageBlocks.resize(size_t{Index} + 1);
+
+    if (m_BoundStorageBlocks[Index] != NewSSBOInfo)
+    {
+        m_BoundStorageBlocks[Index] = NewSSBOInfo;
+        StageBinding(m_StagedStorageBlocks, StagedBuffer{Index, static_cast<GLuint>(Buff), Offset, Size});
+    }
+}
+
+static bool IsLayeredTextureTarget(GLenum BindTarget)
+{
+    switch (BindTarget)
+    {
+#if GL_TEXTURE_1D_ARRAY
+        case GL_TEXTURE_1D_ARRAY:
+#endif
+        case GL_TEXTURE_2D_ARRAY:
+#if GL_TEXTURE_2D_MULTISAMPLE_ARRAY
+        case GL_TEXTURE_2D_MULTISAMPLE_ARRAY:
+#endif
+        case GL_TEXTURE_3D:
+        case GL_TEXTURE_CUBE_MAP:
+#if GL_TEXTURE_CUBE_MAP_ARRAY
+        case GL_TEXTURE_CUBE_MAP_ARRAY:
+#endif
+            return true;
+
+        default:
+            return false;
+    }
+}
+
+void GLContextState::StageImage(Uint32             Index,
+                                TextureViewGLImpl* pTexView,
+                                GLint              MipLevel,
+                                GLboolean          IsLayered,
+                                GLint              Layer,
+                                GLenum             Access,
+                                GLenum             Format)
+{
+    // glBindImageTextures() always binds level 0 of the texture with read-write access using the
+    // texture internal format, and binds all layers of layered textures. Other bindings
+    // must use glBindImageTexture().
+    const TextureBaseGL* pTexGL = pTexView->GetTexture<TextureBaseGL>();
+    const bool           IsDefaultImageBinding =
+        MipLevel == 0 &&
+        Layer == 0 &&
+        Access == GL_READ_WRITE &&
+        Format == pTexGL->GetGLTexFormat() &&
+        (IsLayered != GL_FALSE) == IsLayeredTextureTarget(pTexView->GetBindTarget()) &&
+        (IsLayered == GL_FALSE || pTexView->GetDesc().NumArrayOrDepthSlices() == pTexGL->GetDesc().ArraySizeOrDepth());
+    if (!m_Caps.IsMultiBindSupported || !IsDefaultImageBinding)
+    {
+        BindImage(Index, pTexView, MipLevel, IsLayered, Layer, Access, Format);
+        return;
+    }
+
+    BoundImageInfo NewImageInfo //
+        {
+            pTexView->GetUniqueID(),
+            pTexView->GetHandle(),
+            MipLevel,
+            IsLayered,
+            Layer,
+            Access,
+            Format //
+        };
+    if (Index >= m_BoundImages.size())
+        m_BoundImages.resize(size_t{Index} + 1);
+    if (m_BoundImages[Index] != NewImageInfo)
+    {
+        m_BoundImages[Index] = NewImageInfo;
+        StageBinding(m_StagedImages, StagedObject{Index, NewImageInfo.GLHandle});
+    }
+}
+
+// Calls BindRun(FirstSlot, FirstIdx, Count) for every run of contiguous slots in StagedBindings
+template <typename StagedType, typename BindRunType>
+static void ProcessStagedRuns(std::vector<StagedType>& StagedBindings, BindRunType&& BindRun)
+{
+    if (StagedBindings.empty())
+        return;
+
+    // Resources are normally staged in the slot order
+    const auto SlotLess = [](const StagedType& lhs, const StagedType& rhs) {
+        return lhs.Slot < rhs.Slot;
+    };
+    if (!std::is_sorted(StagedBindings.begin(), StagedBindings.end(), SlotLess))
+        std::sort(StagedBindings.begin(), StagedBindings.end(), SlotLess);
+
+    size_t RunStart = 0;
+    for (size_t i = 1; i <= StagedBindings.size(); ++i)
+    {
+        if (i == StagedBindings.size() || StagedBindings[i].Slot != StagedBindings[i - 1].Slot + 1)
+        {
+            BindRun(StagedBindings[RunStart].Slot, RunStart, static_cast<GLsizei>(i - RunStart));
+            RunStart = i;
+        }
+    }
+    StagedBindings.clear();
+}
+
+void GLContextState::CommitStagedBindings()
+{
+#if GL_ARB_multi_bind
+    const auto CollectHandles = [this](const auto& StagedBindings, size_t FirstIdx, GLsizei Count) {
+        m_MultiBindHandles.resize(Count);
+        for (GLsizei i = 0; i < Count; ++i)
+            m_MultiBindHandles[i] = StagedBindings[FirstIdx + i].GLHandle;
+    };
+
+    const auto CollectBuffers = [this](const std::vector<StagedBuffer>& StagedBindings, size_t FirstIdx, GLsizei Count) {
+        m_MultiBindHandles.resize(Count);
+        m_MultiBindOffsets.resize(Count);
+        m_MultiBindSizes.resize(Count);
+        for (GLsizei i = 0; i < Count; ++i)
+        {
+            const StagedBuffer& Staged = StagedBindings[FirstIdx + i];
+            m_MultiBindHandles[i]      = Staged.GLHandle;
+            m_MultiBindOffsets[i]      = Staged.Offset;
+            m_MultiBindSizes[i]        = Staged.Size;
+        }
+    };
+
+    ProcessStagedRuns(m_StagedTextures, [&](Uint32 FirstSlot, size_t FirstIdx, GLsizei Count) {
+        CollectHandles(m_StagedTextures, FirstIdx, Count);
+        glBindTextures(FirstSlot, Count, m_MultiBindHandles.data());
+        DEV_CHECK_GL_ERROR("glBindTextures() failed");
+        ++m_BindingStats.TextureBindCalls;
+        ++m_BindingStats.MultiBindCalls;
+    });
+
+    ProcessStagedRuns(m_StagedSamplers, [&](Uint32 FirstSlot, size_t FirstIdx, GLsizei Count) {
+        CollectHandles(m_StagedSamplers, FirstIdx, Count);
+        glBindSamplers(FirstSlot, Count, m_MultiBindHandles.data());
+        DEV_CHECK_GL_ERROR("glBindSamplers() failed");
+        ++m_BindingStats.SamplerBindCalls;
+        ++m_BindingStats.MultiBindCalls;
+    });
+
+    ProcessStagedRuns(m_StagedImages, [&](Uint32 FirstSlot, size_t FirstIdx, GLsizei Count) {
+        CollectHandles(m_StagedImages, FirstIdx, Count);
+        glBindImageTextures(FirstSlot, Count, m_MultiBindHandles.data());
+        DEV_CHECK_GL_ERROR("glBindImageTextures() failed");
+        ++m_BindingStats.ImageBindCalls;
+        ++m_BindingStats.MultiBindCalls;
+    });
+
+    ProcessStagedRuns(m_StagedUniformBuffers, [&](Uint32 FirstSlot, size_t FirstIdx, GLsizei Count) {
+        CollectBuffers(m_StagedUniformBuffers, FirstIdx, Count);
+        glBindBuffersRange(GL_UNIFORM_BUFFER, FirstSlot, Count, m_MultiBindHandles.data(), m_MultiBindOffsets.data(), m_MultiBindSizes.data());
+        DEV_CHECK_GL_ERROR("glBindBuffersRange(GL_UNIFORM_BUFFER) failed");
+        ++m_BindingStats.UniformBufferBindCalls;
+        ++m_BindingStats.MultiBindCalls;
+    });
+
+    ProcessStagedRuns(m_StagedStorageBlocks, [&](Uint32 FirstSlot, size_t FirstIdx, GLsizei Count) {
+        CollectBuffers(m_StagedStorageBlocks, FirstIdx, Count);
+        glBindBuffersRange(GL_SHADER_STORAGE_BUFFER, FirstSlot, Count, m_MultiBindHandles.data(), m_MultiBindOffsets.data(), m_MultiBindSizes.data());
+        DEV_CHECK_GL_ERROR("glBindBuffersRange(GL_SHADER_STORAGE_BUFFER) failed");
+        ++m_BindingStats.StorageBufferBindCalls;
+        ++m_BindingStats.MultiBindCalls;
+    });
+#else
+    VERIFY(m_StagedTextures.empty() && m_StagedSamplers.empty() && m_StagedImages.empty() &&
+               m_StagedUniformBuffers.empty() && m_StagedStorageBlocks.empty(),
+           "Bindings can only be staged when multi-bind is supported");
+#endif
+}
+
 void GLContextState::BindBuffer(GLenum BindTarget, const GLObjectWrappers::GLBufferObj& Buff, bool ResetVAO)
 {
     // Binding ARRAY_BUFFER or ELEMENT_ARRAY_BUFFER affects currently bound VAO
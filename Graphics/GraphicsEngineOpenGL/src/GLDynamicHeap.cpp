@@ -0,0 +1,186 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "pch.h"
+
+#include "GLDynamicHeap.hpp"
+
+#include <algorithm>
+#include <iomanip>
+#include <limits>
+
+#include "GraphicsAccessories.hpp"
+#include "EngineMemory.h"
+#include "Align.hpp"
+
+namespace Diligent
+{
+
+bool GLDynamicHeap::IsSupported(const Version& GLVersion, bool HasBufferStorageExt)
+{
+#if GL_ARB_buffer_storage && !PLATFORM_WEB
+    return (GLVersion >= Version{4, 4} || HasBufferStorageExt) && glBufferStorage != nullptr;
+#else
+    return false;
+#endif
+}
+
+GLDynamicHeap::GLDynamicHeap(Uint32 Size, Uint32 Alignment) :
+    // clang-format off
+    m_GLBuffer  {true},
+    m_Size      {AlignUp(OffsetType{Size}, OffsetType{Alignment})},
+    m_Alignment {Alignment},
+    m_RingBuffer{m_Size, GetRawAllocator()}
+// clang-format on
+{
+    VERIFY(IsPowerOfTwo(m_Alignment), "Alignment must be a power of two");
+
+#if GL_ARB_buffer_storage && !PLATFORM_WEB
+    // The heap is created before the immediate context, so the context state is not
+    // available yet. GL_COPY_WRITE_BUFFER target is used to not disturb any other bindings.
+    glBindBuffer(GL_COPY_WRITE_BUFFER, m_GLBuffer);
+    DEV_CHECK_GL_ERROR("Failed to bind dynamic heap buffer");
+
+    // Coherent mapping makes CPU writes visible to the GPU without explicit flushes or
+    // GL_CLIENT_MAPPED_BUFFER_BARRIER_BIT barriers.
+    constexpr GLbitfield StorageFlags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+    glBufferStorage(GL_COPY_WRITE_BUFFER, StaticCast<GLsizeiptr>(m_Size), nullptr, StorageFlags);
+    if (glGetError() != GL_NO_ERROR)
+    {
+        glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+        LOG_ERROR_AND_THROW("Failed to allocate storage for the dynamic heap");
+    }
+
+    // GL_MAP_INVALIDATE_*, GL_MAP_FLUSH_EXPLICIT_BIT and GL_MAP_UNSYNCHRONIZED_BIT
+    // are not used with persistent mapping.
+    m_pCPUAddress = static_cast<Uint8*>(glMapBufferRange(GL_COPY_WRITE_BUFFER, 0, StaticCast<GLsizeiptr>(m_Size), StorageFlags));
+    const GLenum MapErr = glGetError();
+    glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+    if (m_pCPUAddress == nullptr || MapErr != GL_NO_ERROR)
+    {
+        LOG_ERROR_AND_THROW("Failed to persistently map the dynamic heap buffer");
+    }
+
+    m_GLBuffer.SetName("Dynamic heap buffer");
+
+    LOG_INFO_MESSAGE("GL dynamic heap created. Total buffer size: ", FormatMemorySize(m_Size, 2));
+#else
+    LOG_ERROR_AND_THROW("Persistently mapped buffers are not supported on this platform");
+#endif
+}
+
+GLDynamicHeap::~GLDynamicHeap()
+{
+    // The buffer is unmapped automatically when it is deleted. Pending fences do not need to be
+    // waited for as GL defers the deletion of the buffer until it is no longer in use.
+    m_RingBuffer.FinishCurrentFrame(m_NextFenceValue);
+    m_RingBuffer.ReleaseCompletedFrames(m_NextFenceValue);
+    m_PendingFences.clear();
+
+    LOG_INFO_MESSAGE("GL dynamic heap peak usage: ", FormatMemorySize(m_PeakUsedSize, 2, m_Size), " / ", FormatMemorySize(m_Size, 2, m_Size),
+                     ". Peak utilization: ", std::fixed, std::setprecision(1), static_cast<double>(m_PeakUsedSize) / static_cast<double>(std::max(m_Size, OffsetType{1})) * 100.0, '%');
+}
+
+GLDynamicHeap::OffsetType GLDynamicHeap::Allocate(OffsetType Size)
+{
+    if (Size == 0 || Size > m_Size)
+    {
+        LOG_ERROR_MESSAGE("Requested dynamic allocation size (", Size, ") exceeds the dynamic heap size (", m_Size,
+                          "). Increase EngineGLCreateInfo::DynamicHeapSize.");
+        return InvalidOffset;
+    }
+
+    const OffsetType AlignedSize = AlignUp(Size, m_Alignment);
+
+    OffsetType Offset = m_RingBuffer.Allocate(AlignedSize, m_Alignment);
+    while (Offset == InvalidOffset && !m_PendingFences.empty())
+    {
+        // Wait until the GPU is done with the oldest frame and retry
+        ReleaseCompletedFrames(/*WaitForOldest = */ true);
+        Offset = m_RingBuffer.Allocate(AlignedSize, m_Alignment);
+    }
+
+    if (Offset == InvalidOffset)
+    {
+        LOG_ERROR_MESSAGE("Space in the dynamic heap is exhausted: all ", FormatMemorySize(m_Size, 2),
+                          " have been used in the current frame. Increase EngineGLCreateInfo::DynamicHeapSize.");
+        return InvalidOffset;
+    }
+
+    m_CurrFrameSize += AlignedSize;
+    m_PeakUsedSize = std::max(m_PeakUsedSize, m_RingBuffer.GetUsedSize());
+
+    return Offset;
+}
+
+void GLDynamicHeap::FinishFrame()
+{
+    if (m_CurrFrameSize != 0)
+    {
+        GLObjectWrappers::GLSyncObj Fence{glFenceSync(
+            GL_SYNC_GPU_COMMANDS_COMPLETE, // Condition must always be GL_SYNC_GPU_COMMANDS_COMPLETE
+            0                              // Flags, must be 0
+            )};
+        DEV_CHECK_GL_ERROR("Failed to create gl fence");
+
+        const Uint64 FenceValue = m_NextFenceValue++;
+        m_RingBuffer.FinishCurrentFrame(FenceValue);
+        m_PendingFences.emplace_back(FenceValue, std::move(Fence));
+        m_CurrFrameSize = 0;
+    }
+
+    ReleaseCompletedFrames(/*WaitForOldest = */ false);
+
+    ++m_FrameNumber;
+}
+
+void GLDynamicHeap::ReleaseCompletedFrames(bool WaitForOldest)
+{
+    Uint64 CompletedFenceValue = 0;
+    while (!m_PendingFences.empty())
+    {
+        const std::pair<Uint64, GLObjectWrappers::GLSyncObj>& ValFence = m_PendingFences.front();
+
+        const GLenum res = glClientWaitSync(ValFence.second,
+                                            WaitForOldest ? GL_SYNC_FLUSH_COMMANDS_BIT : 0,
+                                            WaitForOldest ? std::numeric_limits<GLuint64>::max() : 0);
+        if (res != GL_ALREADY_SIGNALED && res != GL_CONDITION_SATISFIED)
+        {
+            VERIFY(!WaitForOldest, "Failed to wait for the dynamic heap fence");
+            break;
+        }
+
+        CompletedFenceValue = ValFence.first;
+        m_PendingFences.pop_front();
+        // Only block on the oldest fence
+        WaitForOldest = false;
+    }
+
+    if (CompletedFenceValue != 0)
+        m_RingBuffer.ReleaseCompletedFrames(CompletedFenceValue);
+}
+
+} // namespace Diligent
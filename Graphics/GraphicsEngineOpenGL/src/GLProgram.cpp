@@ -27,16 +27,21 @@
 #include "pch.h"
 
 #include "GLProgram.hpp"
+#include "GLProgramCache.hpp"
 #include "ShaderGLImpl.hpp"
 #include "RenderDeviceGLImpl.hpp"
 
 namespace Diligent
 {
 
-GLProgram::GLProgram(ShaderGLImpl* const* ppShaders,
-                     Uint32               NumShaders,
-                     bool                 IsSeparableProgram) noexcept :
-    m_AttachedShaders{ppShaders, ppShaders + NumShaders}
+GLProgram::GLProgram(ShaderGLImpl* const*      ppShaders,
+                     Uint32                    NumShaders,
+                     bool                      IsSeparableProgram,
+                     GLProgramCache*           pBinaryCache,
+                     const GLProgramBinaryKey& BinaryKey) noexcept :
+    m_AttachedShaders{ppShaders, ppShaders + NumShaders},
+    m_pBinaryCache{pBinaryCache},
+    m_BinaryKey{BinaryKey}
 {
     VERIFY(!IsSeparableProgram || NumShaders == 1, "Number of shaders must be 1 when separable program is created");
 
@@ -47,6 +52,17 @@ GLProgram::GLProgram(ShaderGLImpl* const* ppShaders,
         DEV_CHECK_GL_ERROR("glProgramParameteri(GL_PROGRAM_SEPARABLE) failed");
     }
 
+#if !PLATFORM_WEB
+    // Some drivers only keep the binary if the hint is set before linking.
+    if (m_pBinaryCache != nullptr)
+    {
+        glProgramParameteri(m_GLProg, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+        DEV_CHECK_GL_ERROR("glProgramParameteri(GL_PROGRAM_BINARY_RETRIEVABLE_HINT) failed");
+    }
+#else
+    m_pBinaryCache = nullptr;
+#endif
+
     for (Uint32 i = 0; i < NumShaders; ++i)
     {
         ShaderGLImpl* pCurrShader = ppShaders[i];
@@ -75,6 +91,35 @@ GLProgram::GLProgram(ShaderGLImpl* const* ppShaders,
     m_LinkStatus = LinkStatus::InProgress;
 }
 
+GLProgram::GLProgram(const void* pBinary,
+                     size_t      BinarySize,
+                     GLenum      BinaryFormat,
+                     bool        IsSeparableProgram) noexcept
+{
+#if !PLATFORM_WEB
+    // GL_PROGRAM_SEPARABLE parameter must be set before loading the binary
+    if (IsSeparableProgram)
+    {
+        glProgramParameteri(m_GLProg, GL_PROGRAM_SEPARABLE, GL_TRUE);
+        DEV_CHECK_GL_ERROR("glProgramParameteri(GL_PROGRAM_SEPARABLE) failed");
+    }
+
+    // Note that the driver may reject the binary (e.g. after a driver update), in which case
+    // GL_LINK_STATUS is set to GL_FALSE, but no GL error is generated.
+    glProgramBinary(m_GLProg, BinaryFormat, pBinary, static_cast<GLsizei>(BinarySize));
+    if (glGetError() != GL_NO_ERROR)
+    {
+        m_LinkStatus = LinkStatus::Failed;
+        return;
+    }
+
+    m_LinkStatus = LinkStatus::InProgress;
+#else
+    UNEXPECTED("Program binaries are not supported in WebGL");
+    m_LinkStatus = LinkStatus::Failed;
+#endif
+}
+
 GLProgram::~GLProgram()
 {
 }
@@ -101,6 +146,29 @@ GLProgram::LinkStatus GLProgram::GetLinkStatus(bool WaitForCompletion) noexcept
     if (IsLinked)
     {
         m_LinkStatus = LinkStatus::Succeeded;
+
+#if !PLATFORM_WEB
+        if (m_pBinaryCache != nullptr)
+        {
+            GLint BinaryLength = 0;
+            glGetProgramiv(m_GLProg, GL_PROGRAM_BINARY_LENGTH, &BinaryLength);
+            DEV_CHECK_GL_ERROR("glGetProgramiv(GL_PROGRAM_BINARY_LENGTH) failed");
+            if (BinaryLength > 0)
+            {
+                std::vector<Uint8> Binary(static_cast<size_t>(BinaryLength));
+
+                GLenum  BinaryFormat = 0;
+                GLsizei Length       = 0;
+                glGetProgramBinary(m_GLProg, BinaryLength, &Length, &BinaryFormat, Binary.data());
+                if (glGetError() == GL_NO_ERROR && Length > 0)
+                {
+                    Binary.resize(static_cast<size_t>(Length));
+                    m_pBinaryCache->AddProgramBinary(m_BinaryKey, BinaryFormat, std::move(Binary));
+                }
+            }
+            m_pBinaryCache = nullptr;
+        }
+#endif
     }
     else
     {
@@ -31,10 +31,67 @@
 #include "RenderDeviceGLImpl.hpp"
 #include "PipelineResourceSignatureGLImpl.hpp"
 #include "HashUtils.hpp"
+#include "Serializer.hpp"
+#include "DataBlobImpl.hpp"
 
 namespace Diligent
 {
 
+namespace
+{
+
+constexpr Uint32 ProgramBinaryCacheVersion = 1;
+
+// 128-bit FNV-1a hash.
+// Unlike std::hash, the result does not depend on the standard library implementation,
+// which is required as the keys are stored together with the binaries.
+class FNV1a128Hasher
+{
+public:
+    void Update(const void* pData, size_t Size) noexcept
+    {
+        const Uint8* pBytes = static_cast<const Uint8*>(pData);
+        for (size_t i = 0; i < Size; ++i)
+        {
+            m_Lo ^= pBytes[i];
+            MultiplyByPrime();
+        }
+    }
+
+    template <typename T>
+    void Update(const T& Value) noexcept
+    {
+        static_assert(std::is_arithmetic<T>::value, "Only arithmetic types are supported");
+        Update(&Value, sizeof(Value));
+    }
+
+    GLProgramBinaryKey GetKey() const noexcept
+    {
+        return GLProgramBinaryKey{m_Hi, m_Lo};
+    }
+
+private:
+    // Multiplies the hash by the FNV prime 2^88 + 0x13B modulo 2^128.
+    void MultiplyByPrime() noexcept
+    {
+        constexpr Uint64 PrimeLo = 0x13B;
+
+        const Uint64 LoLo  = (m_Lo & 0xFFFFFFFFu) * PrimeLo;
+        const Uint64 LoHi  = (m_Lo >> 32u) * PrimeLo;
+        const Uint64 Mid   = (LoLo >> 32u) + (LoHi & 0xFFFFFFFFu);
+        const Uint64 Carry = (LoHi >> 32u) + (Mid >> 32u);
+
+        m_Hi = m_Hi * PrimeLo + Carry + (m_Lo << 24u);
+        m_Lo = (Mid << 32u) | (LoLo & 0xFFFFFFFFu);
+    }
+
+private:
+    Uint64 m_Hi = 0x6C62272E07BB0142ull;
+    Uint64 m_Lo = 0x62B821756295C58Dull;
+};
+
+} // namespace
+
 GLProgramCache::GLProgramCache()
 {
 }
@@ -115,8 +172,28 @@ GLProgramCache::SharedGLProgramObjPtr GLProgramCache::GetProgram(const GetProgra
     // multiple threads will create the same program. Only one program will be added to the cache
     // and the rest will be destroyed.
 
-    // Linking the program may take a considerable amount of time.
-    std::shared_ptr<GLProgram> NewProgram = std::make_shared<GLProgram>(Attribs.ppShaders, Attribs.NumShaders, Attribs.IsSeparableProgram);
+    std::shared_ptr<GLProgram> NewProgram;
+    if (m_BinaryCacheEnabled)
+    {
+        const GLProgramBinaryKey BinaryKey = ComputeBinaryKey(Attribs);
+
+        NewProgram = CreateProgramFromBinary(BinaryKey, Attribs.IsSeparableProgram);
+        if (NewProgram)
+        {
+            m_NumBinaryHits.fetch_add(1);
+        }
+        else
+        {
+            m_NumBinaryMisses.fetch_add(1);
+            // The binary will be added to the cache when the program is linked
+            NewProgram = std::make_shared<GLProgram>(Attribs.ppShaders, Attribs.NumShaders, Attribs.IsSeparableProgram, this, BinaryKey);
+        }
+    }
+    else
+    {
+        // Linking the program may take a considerable amount of time.
+        NewProgram = std::make_shared<GLProgram>(Attribs.ppShaders, Attribs.NumShaders, Attribs.IsSeparableProgram);
+    }
 
     std::lock_guard<std::mutex> Lock{m_CacheMtx};
 
@@ -133,4 +210,182 @@ GLProgramCache::SharedGLProgramObjPtr GLProgramCache::GetProgram(const GetProgra
     }
 }
 
+GLProgramBinaryKey GLProgramCache::ComputeBinaryKey(const GetProgramAttribs& Attribs)
+{
+    // Resource bindings are applied after the program is linked and are not part of the binary,
+    // so the key only depends on the shaders.
+    FNV1a128Hasher Hasher;
+    Hasher.Update(Uint32{Attribs.IsSeparableProgram ? 1u : 0u});
+    Hasher.Update(Attribs.NumShaders);
+    for (Uint32 i = 0; i < Attribs.NumShaders; ++i)
+    {
+        const ShaderGLImpl* pShader = Attribs.ppShaders[i];
+
+        const void* pSource    = nullptr;
+        Uint64      SourceSize = 0;
+        pShader->GetBytecode(&pSource, SourceSize);
+
+        Hasher.Update(static_cast<Uint32>(pShader->GetDesc().ShaderType));
+        Hasher.Update(SourceSize);
+        if (pSource != nullptr)
+            Hasher.Update(pSource, static_cast<size_t>(SourceSize));
+    }
+    return Hasher.GetKey();
+}
+
+GLProgramCache::SharedGLProgramObjPtr GLProgramCache::CreateProgramFromBinary(const GLProgramBinaryKey& Key, bool IsSeparableProgram)
+{
+    std::shared_ptr<const ProgramBinary> pBinary;
+    {
+        std::lock_guard<std::mutex> Lock{m_BinariesMtx};
+
+        auto it = m_Binaries.find(Key);
+        if (it == m_Binaries.end())
+            return {};
+
+        pBinary = it->second;
+    }
+
+    SharedGLProgramObjPtr Program = std::make_shared<GLProgram>(pBinary->Data.data(), pBinary->Data.size(), pBinary->Format, IsSeparableProgram);
+    // Loading the binary is fast, so there is no point in deferring the status check
+    if (Program->GetLinkStatus(/*WaitForCompletion = */ true) == GLProgram::LinkStatus::Succeeded)
+        return Program;
+
+    LOG_INFO_MESSAGE("Program binary was rejected by the driver. The program will be linked from source.");
+    m_NumBinaryRejected.fetch_add(1);
+
+    std::lock_guard<std::mutex> Lock{m_BinariesMtx};
+
+    auto it = m_Binaries.find(Key);
+    if (it != m_Binaries.end() && it->second == pBinary)
+        m_Binaries.erase(it);
+
+    return {};
+}
+
+void GLProgramCache::EnableBinaryCache(std::string DriverId)
+{
+    m_DriverId           = std::move(DriverId);
+    m_BinaryCacheEnabled = true;
+}
+
+void GLProgramCache::AddProgramBinary(const GLProgramBinaryKey& Key, GLenum Format, std::vector<Uint8>&& Binary)
+{
+    VERIFY_EXPR(m_BinaryCacheEnabled);
+    std::shared_ptr<const ProgramBinary> pBinary{new ProgramBinary{Format, std::move(Binary)}};
+
+    std::lock_guard<std::mutex> Lock{m_BinariesMtx};
+    m_Binaries[Key] = std::move(pBinary);
+}
+
+bool GLProgramCache::LoadProgramBinaries(const void* pData, size_t Size)
+{
+    if (!m_BinaryCacheEnabled)
+        return false;
+
+    if (pData == nullptr || Size == 0)
+        return false;
+
+    Serializer<SerializerMode::Read> Ser{SerializedData{const_cast<void*>(pData), Size}};
+
+    Uint32      Version     = 0;
+    const char* DriverId    = nullptr;
+    Uint32      NumBinaries = 0;
+    if (!Ser(Version, DriverId, NumBinaries))
+    {
+        LOG_ERROR_MESSAGE("Failed to read the program binary cache header");
+        return false;
+    }
+
+    if (Version != ProgramBinaryCacheVersion)
+    {
+        LOG_INFO_MESSAGE("Program binary cache version (", Version, ") does not match the expected version (", ProgramBinaryCacheVersion, "). The cache will be ignored.");
+        return false;
+    }
+
+    if (m_DriverId != DriverId)
+    {
+        LOG_INFO_MESSAGE("Program binary cache was written by a different driver. The cache will be ignored.");
+        return false;
+    }
+
+    ProgramBinaryMap Binaries;
+    for (Uint32 i = 0; i < NumBinaries; ++i)
+    {
+        GLProgramBinaryKey Key;
+        Uint32             Format     = 0;
+        const void*        pBytes     = nullptr;
+        size_t             BinarySize = 0;
+        if (!Ser(Key.Hash0, Key.Hash1, Format) || !Ser.SerializeBytes(pBytes, BinarySize))
+        {
+            LOG_ERROR_MESSAGE("Failed to read program binary ", i, " from the program binary cache");
+            return false;
+        }
+
+        const Uint8* pBinaryData = static_cast<const Uint8*>(pBytes);
+        Binaries.emplace(Key, std::shared_ptr<const ProgramBinary>{new ProgramBinary{Format, {pBinaryData, pBinaryData + BinarySize}}});
+    }
+    if (!Ser.IsEnded())
+    {
+        LOG_ERROR_MESSAGE("Program binary cache data contains ", Ser.GetRemainingSize(), " unexpected trailing bytes");
+        return false;
+    }
+
+    std::lock_guard<std::mutex> Lock{m_BinariesMtx};
+    // Binaries retrieved in this session take precedence
+    m_Binaries.insert(std::make_move_iterator(Binaries.begin()), std::make_move_iterator(Binaries.end()));
+
+    return true;
+}
+
+ProgramBinaryCacheStatsGL GLProgramCache::GetBinaryCacheStats() const
+{
+    ProgramBinaryCacheStatsGL Stats;
+    Stats.NumBinaryHits     = m_NumBinaryHits.load();
+    Stats.NumBinaryMisses   = m_NumBinaryMisses.load();
+    Stats.NumBinaryRejected = m_NumBinaryRejected.load();
+    return Stats;
+}
+
+void GLProgramCache::StoreProgramBinaries(IDataBlob** ppData)
+{
+    DEV_CHECK_ERR(ppData != nullptr, "ppData must not be null");
+    DEV_CHECK_ERR(*ppData == nullptr, "Data blob pointer address is not null. This may result in memory leak");
+    if (!m_BinaryCacheEnabled)
+        return;
+
+    std::lock_guard<std::mutex> Lock{m_BinariesMtx};
+
+    auto SerializeThis = [this](auto& Ser) {
+        const char*  DriverId    = m_DriverId.c_str();
+        const Uint32 NumBinaries = static_cast<Uint32>(m_Binaries.size());
+
+        bool res = Ser(ProgramBinaryCacheVersion, DriverId, NumBinaries);
+        VERIFY(res, "Failed to serialize the program binary cache header");
+        for (const auto& it : m_Binaries)
+        {
+            const GLProgramBinaryKey& Key    = it.first;
+            const ProgramBinary&      Binary = *it.second;
+
+            const Uint32 Format     = Binary.Format;
+            const void*  pBytes     = Binary.Data.data();
+            const size_t BinarySize = Binary.Data.size();
+
+            res = Ser(Key.Hash0, Key.Hash1, Format) && Ser.SerializeBytes(pBytes, BinarySize);
+            VERIFY(res, "Failed to serialize program binary");
+        }
+    };
+
+    Serializer<SerializerMode::Measure> Measurer;
+    SerializeThis(Measurer);
+
+    RefCntAutoPtr<DataBlobImpl> pDataBlob = DataBlobImpl::Create(Measurer.GetSize());
+
+    Serializer<SerializerMode::Write> Writer{SerializedData{pDataBlob->GetDataPtr(), pDataBlob->GetSize()}};
+    SerializeThis(Writer);
+    VERIFY_EXPR(Writer.IsEnded());
+
+    *ppData = pDataBlob.Detach();
+}
+
 } // namespace Diligent
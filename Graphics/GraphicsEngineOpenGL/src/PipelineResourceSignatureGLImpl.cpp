@@ -551,7 +551,8 @@ void PipelineResourceSignatureGLImpl::CopyStaticResources(ShaderResourceCacheGL&
 }
 
 void PipelineResourceSignatureGLImpl::UpdateInlineConstantBuffers(const ShaderResourceCacheGL& ResourceCache,
-                                                                  GLContextState&              CtxState) const
+                                                                  GLContextState&              CtxState,
+                                                                  const TBindings&             BaseBindings) const
 {
     for (Uint32 i = 0; i < m_NumInlineConstantBuffers; ++i)
     {
@@ -579,6 +580,13 @@ void PipelineResourceSignatureGLImpl::UpdateInlineConstantBuffers(const ShaderRe
         pBuffer->Map(CtxState, MAP_WRITE, MAP_FLAG_DISCARD, pMappedData);
         memcpy(pMappedData, InlineCB.pInlineConstantData, BufferSize);
         pBuffer->Unmap(CtxState);
+
+        if (pBuffer->UsesDynamicHeap())
+        {
+            // Mapping the buffer allocated new space in the dynamic heap, so the buffer must be rebound
+            CtxState.BindUniformBuffer(BaseBindings[BINDING_RANGE_UNIFORM_BUFFER] + InlineCBAttr.CacheOffset,
+                                       pBuffer->GetGLHandle(), InlineCB.GetBindOffset(), InlineCB.RangeSize);
+        }
     }
 }
 
@@ -285,6 +285,12 @@ RenderDeviceGLImpl::RenderDeviceGLImpl(IReferenceCounters*       pRefCounters,
 
     InitAdapterInfo();
 
+    if (EngineCI.EnableProgramBinaryCache)
+        InitProgramBinaryCache();
+
+    if (EngineCI.DynamicHeapSize != 0)
+        InitDynamicHeap(EngineCI.DynamicHeapSize);
+
     // Enable requested device features
     m_DeviceInfo.Features = EnableDeviceFeatures(m_AdapterInfo.Features, EngineCI.Features);
     if (m_AdapterInfo.Features.SeparablePrograms && !EngineCI.Features.SeparablePrograms)
@@ -560,6 +566,19 @@ void RenderDeviceGLImpl::CreateDummyTexture(const TextureDesc& TexDesc, RESOURCE
     );
 }
 
+Bool RenderDeviceGLImpl::LoadProgramBinaries(const IDataBlob* pData)
+{
+    if (pData == nullptr)
+        return false;
+
+    return m_ProgramCache.LoadProgramBinaries(pData->GetConstDataPtr(), StaticCast<size_t>(pData->GetSize()));
+}
+
+void RenderDeviceGLImpl::StoreProgramBinaries(IDataBlob** ppData)
+{
+    m_ProgramCache.StoreProgramBinaries(ppData);
+}
+
 void RenderDeviceGLImpl::CreateSampler(const SamplerDesc& SamplerDesc, ISampler** ppSampler, bool bIsDeviceInternal)
 {
     CreateSamplerImpl(ppSampler, SamplerDesc, bIsDeviceInternal);
@@ -695,6 +714,59 @@ bool RenderDeviceGLImpl::CheckExtension(const Char* ExtensionString) const
     return m_ExtensionStrings.find(ExtensionString) != m_ExtensionStrings.end();
 }
 
+void RenderDeviceGLImpl::InitProgramBinaryCache()
+{
+#if !PLATFORM_WEB
+    GLint NumBinaryFormats = 0;
+    glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &NumBinaryFormats);
+    if (glGetError() != GL_NO_ERROR || NumBinaryFormats == 0)
+    {
+        LOG_WARNING_MESSAGE("Program binary cache is requested, but the device does not support any program binary formats.");
+        return;
+    }
+
+    // Binaries are only compatible with the driver and the GPU they were created with
+    constexpr GLenum DriverStrings[] = {GL_VENDOR, GL_RENDERER, GL_VERSION};
+
+    std::string DriverId;
+    for (GLenum Name : DriverStrings)
+    {
+        if (const GLubyte* Str = glGetString(Name))
+            DriverId += reinterpret_cast<const char*>(Str);
+        DriverId += '\n';
+    }
+    m_ProgramCache.EnableBinaryCache(std::move(DriverId));
+#else
+    LOG_WARNING_MESSAGE("Program binary cache is not supported in WebGL.");
+#endif
+}
+
+void RenderDeviceGLImpl::InitDynamicHeap(Uint32 Size)
+{
+    if (!GLDynamicHeap::IsSupported(m_DeviceInfo.APIVersion, CheckExtension("GL_ARB_buffer_storage")))
+    {
+        LOG_INFO_MESSAGE("Persistently mapped buffers are not supported by the device. Dynamic buffers will be mapped using glMapBufferRange.");
+        return;
+    }
+
+    GLint UBOffsetAlignment = 0;
+    glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &UBOffsetAlignment);
+    if (glGetError() != GL_NO_ERROR || UBOffsetAlignment <= 0 || !IsPowerOfTwo(UBOffsetAlignment))
+    {
+        LOG_WARNING_MESSAGE("Failed to query uniform buffer offset alignment. Using 256 bytes.");
+        UBOffsetAlignment = 256;
+    }
+
+    try
+    {
+        m_pDynamicHeap = std::make_unique<GLDynamicHeap>(Size, static_cast<Uint32>(UBOffsetAlignment));
+    }
+    catch (const std::runtime_error&)
+    {
+        LOG_WARNING_MESSAGE("Failed to create the dynamic heap. Dynamic buffers will be mapped using glMapBufferRange.");
+    }
+}
+
 void RenderDeviceGLImpl::InitAdapterInfo()
 {
     const Version GLVersion = m_DeviceInfo.APIVersion;
@@ -45,4 +45,20 @@ ShaderResourceBindingGLImpl::~ShaderResourceBindingGLImpl()
 {
 }
 
+void ShaderResourceBindingGLImpl::BindVariables(const ShaderVariableBinding* pBindings,
+                                                Uint32                       NumBindings,
+                                                SET_SHADER_RESOURCE_FLAGS    Flags)
+{
+    for (Uint32 i = 0; i < NumBindings; ++i)
+    {
+        const ShaderVariableBinding& Binding = pBindings[i];
+
+        const ShaderVariableManagerGL* pVarMgr = nullptr;
+        if (GetBindingVariable(Binding, &pVarMgr) == nullptr)
+            continue;
+
+        pVarMgr->BindVariable(Binding.VariableIndex, Binding, Flags);
+    }
+}
+
 } // namespace Diligent
@@ -176,7 +176,7 @@ void ShaderResourceCacheGL::BindResources(GLContextState&              GLState,
                                            // will reflect data written by shaders prior to the barrier
             GLState);
 
-        GLState.BindUniformBuffer(binding, UB.pBuffer->GetGLHandle(), static_cast<GLintptr>(UB.BaseOffset) + static_cast<GLintptr>(UB.DynamicOffset), UB.RangeSize);
+        GLState.StageUniformBuffer(binding, UB.pBuffer->GetGLHandle(), UB.GetBindOffset(), UB.RangeSize);
     }
 
     for (Uint32 s = 0, binding = BaseBindings[BINDING_RANGE_TEXTURE]; s < GetTextureCount(); ++s, ++binding)
@@ -191,7 +191,7 @@ void ShaderResourceCacheGL::BindResources(GLContextState&              GLState,
             TextureViewGLImpl* pTexViewGL = Tex.pView.RawPtr<TextureViewGLImpl>();
             TextureBaseGL*     pTextureGL = Tex.pTexture;
             VERIFY_EXPR(pTextureGL == pTexViewGL->GetTexture());
-            GLState.BindTexture(binding, pTexViewGL->GetBindTarget(), pTexViewGL->GetHandle());
+            GLState.StageTexture(binding, pTexViewGL->GetBindTarget(), pTexViewGL->GetHandle());
 
             pTextureGL->TextureMemoryBarrier(
                 MEMORY_BARRIER_TEXTURE_FETCH, // Texture fetches from shaders, including fetches from buffer object
@@ -201,11 +201,11 @@ void ShaderResourceCacheGL::BindResources(GLContextState&              GLState,
 
             if (Tex.pSampler)
             {
-                GLState.BindSampler(binding, Tex.pSampler->GetHandle());
+                GLState.StageSampler(binding, Tex.pSampler->GetHandle());
             }
             else
             {
-                GLState.BindSampler(binding, GLObjectWrappers::GLSamplerObj{false});
+                GLState.StageSampler(binding, GLObjectWrappers::GLSamplerObj{false});
             }
         }
         else if (Tex.pBuffer != nullptr)
@@ -214,8 +214,8 @@ void ShaderResourceCacheGL::BindResources(GLContextState&              GLState,
             BufferGLImpl*     pBufferGL  = Tex.pBuffer;
             VERIFY_EXPR(pBufferGL == pBufViewGL->GetBuffer());
 
-            GLState.BindTexture(binding, GL_TEXTURE_BUFFER, pBufViewGL->GetTexBufferHandle());
-            GLState.BindSampler(binding, GLObjectWrappers::GLSamplerObj{false}); // Use default texture sampling parameters
+            GLState.StageTexture(binding, GL_TEXTURE_BUFFER, pBufViewGL->GetTexBufferHandle());
+            GLState.StageSampler(binding, GLObjectWrappers::GLSamplerObj{false}); // Use default texture sampling parameters
 
             pBufferGL->BufferMemoryBarrier(
                 MEMORY_BARRIER_TEXEL_BUFFER, // Texture fetches from shaders, including fetches from buffer object
@@ -283,7 +283,7 @@ void ShaderResourceCacheGL::BindResources(GLContextState&              GLState,
             // That means that if an integer texture is being bound, its
             // GL_TEXTURE_MIN_FILTER and GL_TEXTURE_MAG_FILTER must be NEAREST,
             // otherwise it will be incomplete
-            GLState.BindImage(binding, pTexViewGL, ViewDesc.MostDetailedMip, Layered, Layer, GLAccess, GlTexFormat);
+            GLState.StageImage(binding, pTexViewGL, ViewDesc.MostDetailedMip, Layered, Layer, GLAccess, GlTexFormat);
             // Do not use binding points from reflection as they may not be initialized
         }
         else if (Img.pBuffer != nullptr)
@@ -330,15 +330,17 @@ void ShaderResourceCacheGL::BindResources(GLContextState&              GLState,
                                            // will reflect writes prior to the barrier
             GLState);
 
-        GLState.BindStorageBlock(binding,
-                                 pBufferGL->GetGLHandle(),
-                                 StaticCast<GLintptr>(ViewDesc.ByteOffset + SSBO.DynamicOffset),
-                                 StaticCast<GLsizeiptr>(ViewDesc.ByteWidth));
+        GLState.StageStorageBlock(binding,
+                                  pBufferGL->GetGLHandle(),
+                                  StaticCast<GLintptr>(ViewDesc.ByteOffset + SSBO.DynamicOffset),
+                                  StaticCast<GLsizeiptr>(ViewDesc.ByteWidth));
 
         if (ViewDesc.ViewType == BUFFER_VIEW_UNORDERED_ACCESS)
             WritableBuffers.push_back(pBufferGL);
     }
 #endif
+
+    GLState.CommitStagedBindings();
 }
 
 void ShaderResourceCacheGL::BindDynamicBuffers(GLContextState&              GLState,
@@ -351,9 +353,7 @@ void ShaderResourceCacheGL::BindDynamicBuffers(GLContextState&              GLSt
         const Uint32    UBOIdx = PlatformMisc::GetLSB(UBOBit);
         const CachedUB& UB     = GetConstUB(UBOIdx);
         VERIFY_EXPR(UB.IsDynamic());
-        GLState.BindUniformBuffer(BaseUBOBinding + UBOIdx, UB.pBuffer->GetGLHandle(),
-                                  static_cast<GLintptr>(UB.BaseOffset) + static_cast<GLintptr>(UB.DynamicOffset),
-                                  UB.RangeSize);
+        GLState.StageUniformBuffer(BaseUBOBinding + UBOIdx, UB.pBuffer->GetGLHandle(), UB.GetBindOffset(), UB.RangeSize);
     }
 
 
@@ -369,11 +369,13 @@ void ShaderResourceCacheGL::BindDynamicBuffers(GLContextState&              GLSt
         const BufferGLImpl*     pBufferGL     = pBufferViewGL->GetBuffer<const BufferGLImpl>();
         const BufferViewDesc&   ViewDesc      = pBufferViewGL->GetDesc();
 
-        GLState.BindStorageBlock(BaseSSBOBinding + SSBOIdx,
-                                 pBufferGL->GetGLHandle(),
-                                 StaticCast<GLintptr>(ViewDesc.ByteOffset + SSBO.DynamicOffset),
-                                 StaticCast<GLsizeiptr>(ViewDesc.ByteWidth));
+        GLState.StageStorageBlock(BaseSSBOBinding + SSBOIdx,
+                                  pBufferGL->GetGLHandle(),
+                                  StaticCast<GLintptr>(ViewDesc.ByteOffset + SSBO.DynamicOffset),
+                                  StaticCast<GLsizeiptr>(ViewDesc.ByteWidth));
     }
+
+    GLState.CommitStagedBindings();
 }
 
 void ShaderResourceCacheGL::CopyInlineConstants(const ShaderResourceCacheGL& SrcCache,
@@ -452,6 +452,8 @@ static ShaderCodeBufferDescX PrepareUBReflection(std::vector<ShaderCodeVariableD
 
 void ShaderResourcesGL::LoadUniforms(const LoadUniformsAttribs& Attribs)
 {
+    DILIGENT_CPU_PROFILE_ZONE("LoadUniforms", "Reflection");
+
     VERIFY(Attribs.SamplerResourceFlag == PIPELINE_RESOURCE_FLAG_NONE || Attribs.SamplerResourceFlag == PIPELINE_RESOURCE_FLAG_COMBINED_SAMPLER,
            "Only NONE (for GLSL source) and COMBINED_SAMPLER (for HLSL source) are valid sampler resource flags");
 
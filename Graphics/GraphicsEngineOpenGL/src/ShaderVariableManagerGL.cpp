@@ -503,7 +503,7 @@ public:
     }
 
     template <typename ResourceType>
-    IShaderResourceVariable* TryResource(Uint32 NumResources)
+    ResourceType* TryResource(Uint32 NumResources)
     {
         if (Index < NumResources)
             return &Mgr.GetResource<ResourceType>(Index);
@@ -540,6 +540,32 @@ IShaderResourceVariable* ShaderVariableManagerGL::GetVariable(Uint32 Index) cons
     return nullptr;
 }
 
+void ShaderVariableManagerGL::BindVariable(Uint32                       Index,
+                                           const ShaderVariableBinding& Binding,
+                                           SET_SHADER_RESOURCE_FLAGS    Flags) const
+{
+    auto BindElements = [&](auto* pVar) {
+        for (Uint32 elem = 0; elem < Binding.NumElements; ++elem)
+            pVar->BindResource(BindResourceInfo{Binding.FirstElement + elem, Binding.ppObjects[elem], Flags, Binding.BufferOffset, Binding.BufferRange});
+    };
+
+    ShaderVariableLocator VarLocator(*this, Index);
+
+    if (UniformBuffBindInfo* pUB = VarLocator.TryResource<UniformBuffBindInfo>(GetNumUBs()))
+        return BindElements(pUB);
+
+    if (TextureBindInfo* pTexture = VarLocator.TryResource<TextureBindInfo>(GetNumTextures()))
+        return BindElements(pTexture);
+
+    if (ImageBindInfo* pImage = VarLocator.TryResource<ImageBindInfo>(GetNumImages()))
+        return BindElements(pImage);
+
+    if (StorageBufferBindInfo* pSSBO = VarLocator.TryResource<StorageBufferBindInfo>(GetNumStorageBuffers()))
+        return BindElements(pSSBO);
+
+    LOG_ERROR(Index, " is not a valid variable index.");
+}
+
 
 
 class ShaderVariableIndexLocator
@@ -113,9 +113,14 @@ SwapChainGLImpl::~SwapChainGLImpl()
 
 void SwapChainGLImpl::Present(Uint32 SyncInterval)
 {
-#if PLATFORM_WIN32 || PLATFORM_LINUX || PLATFORM_ANDROID
     RenderDeviceGLImpl* pDeviceGL = m_pRenderDevice.RawPtr<RenderDeviceGLImpl>();
-    auto&               GLContext = pDeviceGL->m_GLContext;
+
+    // Protect dynamic heap space used by this frame with a fence
+    if (GLDynamicHeap* pDynamicHeap = pDeviceGL->GetDynamicHeap())
+        pDynamicHeap->FinishFrame();
+
+#if PLATFORM_WIN32 || PLATFORM_LINUX || PLATFORM_ANDROID
+    auto& GLContext = pDeviceGL->m_GLContext;
     GLContext.SwapBuffers(static_cast<int>(SyncInterval));
 #elif PLATFORM_MACOS
     LOG_ERROR("Swap buffers operation must be performed by the app on macOS");
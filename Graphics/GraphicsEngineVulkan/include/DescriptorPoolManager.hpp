@@ -34,8 +34,11 @@
 #include <deque>
 #include <mutex>
 #include <atomic>
+#include <array>
 
+#include "RenderDeviceVk.h"
 #include "VulkanUtilities/ObjectWrappers.hpp"
+#include "MPSCQueue.hpp"
 
 namespace Diligent
 {
@@ -46,7 +49,7 @@ class RenderDeviceVkImpl;
 // This class manages descriptor set allocation.
 // The class destructor calls DescriptorSetAllocator::FreeDescriptorSet() that moves
 // the set into the release queue.
-// sizeof(DescriptorSetAllocation) == 32 (x64)
+// sizeof(DescriptorSetAllocation) == 40 (x64)
 class DescriptorSetAllocation
 {
 public:
@@ -54,11 +57,13 @@ public:
     DescriptorSetAllocation(VkDescriptorSet         _Set,
                             VkDescriptorPool        _Pool,
                             Uint64                  _CmdQueueMask,
-                            DescriptorSetAllocator& _DescrSetAllocator)noexcept :
+                            DescriptorSetAllocator& _DescrSetAllocator,
+                            Uint32                  _BucketIdx)noexcept :
         Set              {_Set               },
         Pool             {_Pool              },
         CmdQueueMask     {_CmdQueueMask      },
-        DescrSetAllocator{&_DescrSetAllocator}
+        DescrSetAllocator{&_DescrSetAllocator},
+        BucketIdx        {_BucketIdx         }
     {}
     DescriptorSetAllocation()noexcept{}
 
@@ -69,7 +74,8 @@ public:
         Set              {rhs.Set              },
         Pool             {rhs.Pool             },
         CmdQueueMask     {rhs.CmdQueueMask     },
-        DescrSetAllocator{rhs.DescrSetAllocator}
+        DescrSetAllocator{rhs.DescrSetAllocator},
+        BucketIdx        {rhs.BucketIdx        }
     {
         rhs.Reset();
     }
@@ -83,6 +89,7 @@ public:
         CmdQueueMask      = rhs.CmdQueueMask;
         Pool              = rhs.Pool;
         DescrSetAllocator = rhs.DescrSetAllocator;
+        BucketIdx         = rhs.BucketIdx;
 
         rhs.Reset();
 
@@ -100,6 +107,7 @@ public:
         Pool              = VK_NULL_HANDLE;
         CmdQueueMask      = 0;
         DescrSetAllocator = nullptr;
+        BucketIdx         = 0;
     }
 
     void Release();
@@ -116,6 +124,7 @@ private:
     VkDescriptorPool        Pool              = VK_NULL_HANDLE;
     Uint64                  CmdQueueMask      = 0;
     DescriptorSetAllocator* DescrSetAllocator = nullptr;
+    Uint32                  BucketIdx         = 0;
 };
 
 
@@ -183,7 +192,22 @@ private:
 
 
 // The class allocates descriptor sets from the main descriptor pool.
-// Descriptors sets can be released and returned to the pool
+// Descriptors sets can be released and returned to the pool.
+//
+// Pools are distributed between several buckets, and every thread is assigned its own bucket
+// to reduce the lock contention when descriptor sets are allocated by multiple threads.
+// Released sets are pushed to the lock-free queue of the bucket they were allocated from and
+// are returned to their pools in batches by the next allocation from this bucket or by ReclaimReleasedSets().
+//
+//      __________________________________________________________
+//     |                                                          |
+//     |                  DescriptorSetAllocator                  |
+//     |                                                          |
+//     |   Bucket[0]: | Pool[0] | Pool[1] | ... |  <- Released sets
+//     |   Bucket[1]: | Pool[0] | ... |            <- Released sets
+//     |   ...                                                    |
+//     |__________________________________________________________|
+//
 class DescriptorSetAllocator : public DescriptorPoolManager
 {
 public:
@@ -213,6 +237,18 @@ public:
 
     DescriptorSetAllocation Allocate(Uint64 CommandQueueMask, VkDescriptorSetLayout SetLayout, const char* DebugName = "");
 
+    // Allocates NumSets descriptor sets with the given layouts, using as few vkAllocateDescriptorSets calls as possible.
+    void Allocate(Uint64                       CommandQueueMask,
+                  const VkDescriptorSetLayout* pSetLayouts,
+                  Uint32                       NumSets,
+                  DescriptorSetAllocation*     pAllocations,
+                  const char*                  DebugName = "");
+
+    // Returns all released descriptor sets to their pools.
+    void ReclaimReleasedSets();
+
+    DescriptorSetAllocatorStatsVk GetStats() const;
+
 #ifdef DILIGENT_DEVELOPMENT
     Int32 GetAllocatedDescriptorSetCounter() const
     {
@@ -221,7 +257,63 @@ public:
 #endif
 
 private:
-    void FreeDescriptorSet(VkDescriptorSet Set, VkDescriptorPool Pool, Uint64 QueueMask);
+    void FreeDescriptorSet(VkDescriptorSet Set, VkDescriptorPool Pool, Uint64 QueueMask, Uint32 BucketIdx);
+
+    struct ReleasedSet
+    {
+        VkDescriptorSet  Set  = VK_NULL_HANDLE;
+        VkDescriptorPool Pool = VK_NULL_HANDLE;
+    };
+
+    struct PoolBucket
+    {
+        std::mutex Mtx;
+
+        // Pools are sorted by the last successful allocation, the most recent one is in front
+        std::deque<VulkanUtilities::DescriptorPoolWrapper> Pools;
+
+        // Sets that are no longer used by the GPU and are waiting to be returned to their pools.
+        // Producers are release queues, the consumer is the thread that holds the bucket mutex.
+        MPSCQueue<ReleasedSet> ReleasedSets;
+
+        // Scratch space used to batch vkFreeDescriptorSets calls
+        std::vector<ReleasedSet> ReclaimBuffer;
+    };
+
+    static Uint32 GetThreadBucket();
+
+    // Returns released sets of the bucket to their pools. The bucket mutex must be locked.
+    void ReclaimReleasedSets(PoolBucket& Bucket);
+
+    // Tries to allocate NumSets descriptor sets from one of the existing pools of the bucket.
+    // The bucket mutex must be locked.
+    VkDescriptorPool AllocateFromBucket(PoolBucket&                  Bucket,
+                                        const VkDescriptorSetLayout* pSetLayouts,
+                                        Uint32                       NumSets,
+                                        VkDescriptorSet*             pSets,
+                                        const char*                  DebugName);
+
+    // Allocates up to MaxAllocBatchSize descriptor sets from a single pool.
+    VkDescriptorPool AllocateBatch(const VkDescriptorSetLayout* pSetLayouts,
+                                   Uint32                       NumSets,
+                                   VkDescriptorSet*             pSets,
+                                   const char*                  DebugName,
+                                   Uint32&                      BucketIdx);
+
+    static constexpr Uint32 NumThreadBuckets = 4;
+    // Maximum number of sets allocated by a single vkAllocateDescriptorSets call
+    static constexpr Uint32 MaxAllocBatchSize = 16;
+    // Maximum number of sets returned to a pool by a single vkFreeDescriptorSets call
+    static constexpr Uint32 MaxFreeBatchSize = 16;
+
+    std::array<PoolBucket, NumThreadBuckets> m_Buckets;
+
+    std::atomic<Uint32> m_NumPools{0};
+    std::atomic<Uint64> m_NumSetsAllocated{0};
+    std::atomic<Uint64> m_NumSetsReclaimed{0};
+    std::atomic<Uint64> m_NumAllocateCalls{0};
+    std::atomic<Uint64> m_NumPoolMisses{0};
+    std::atomic<Uint64> m_NumBucketFallbacks{0};
 
 #ifdef DILIGENT_DEVELOPMENT
     std::atomic<Int32> m_AllocatedSetCounter;
@@ -43,6 +43,8 @@
 #include "QueryVkImpl.hpp"
 #include "FramebufferVkImpl.hpp"
 #include "RenderPassVkImpl.hpp"
+#include "FramebufferCache.hpp"
+#include "RenderPassCache.hpp"
 #include "BottomLevelASVkImpl.hpp"
 #include "TopLevelASVkImpl.hpp"
 #include "ShaderBindingTableVkImpl.hpp"
@@ -584,6 +586,12 @@ private:
     /// This framebuffer may or may not be currently set in the command buffer
     VkFramebuffer m_vkFramebuffer = VK_NULL_HANDLE;
 
+    /// Most recently used implicit render passes and framebuffers. These caches are checked
+    /// before the shared device caches, so that the context does not lock them on every
+    /// SetRenderTargets call.
+    RenderPassCache::FrontCacheType  m_RenderPassFrontCache;
+    FramebufferCache::FrontCacheType m_FramebufferFrontCache;
+
     /// Dynamic rendering info.
     std::unique_ptr<VulkanUtilities::RenderingInfoWrapper> m_DynamicRenderingInfo;
 
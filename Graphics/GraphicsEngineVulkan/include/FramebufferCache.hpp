@@ -33,9 +33,12 @@
 #include <unordered_map>
 #include <mutex>
 #include <memory>
+#include <atomic>
 
 #include "VulkanUtilities/ObjectWrappers.hpp"
 #include "VulkanUtilities/RenderingInfoWrapper.hpp"
+#include "SharedMutex.hpp"
+#include "MRUCache.hpp"
 
 namespace Diligent
 {
@@ -75,7 +78,21 @@ public:
         mutable size_t Hash = 0;
     };
 
+private:
+    struct FramebufferCacheKeyHash
+    {
+        std::size_t operator()(const FramebufferCacheKey& Key) const
+        {
+            return Key.GetHash();
+        }
+    };
+
+public:
+    // Per-context cache of the most recently used framebuffers that is checked before the shared cache.
+    using FrontCacheType = MRUCache<FramebufferCacheKey, VkFramebuffer, 4, FramebufferCacheKeyHash>;
+
     VkFramebuffer GetFramebuffer(const FramebufferCacheKey& Key, uint32_t width, uint32_t height, uint32_t layers);
+    VkFramebuffer GetFramebuffer(FrontCacheType& FrontCache, const FramebufferCacheKey& Key, uint32_t width, uint32_t height, uint32_t layers);
     void          OnDestroyImageView(VkImageView ImgView);
     void          OnDestroyRenderPass(VkRenderPass Pass);
 
@@ -98,17 +115,15 @@ public:
 private:
     RenderDeviceVkImpl& m_DeviceVk;
 
-    struct FramebufferCacheKeyHash
-    {
-        std::size_t operator()(const FramebufferCacheKey& Key) const
-        {
-            return Key.GetHash();
-        }
-    };
-
-    std::mutex                                                                                            m_Mutex;
+    // Cache hits only take a shared lock
+    Threading::SharedMutex                                                                                m_Mutex;
     std::unordered_map<FramebufferCacheKey, VulkanUtilities::FramebufferWrapper, FramebufferCacheKeyHash> m_Cache;
 
+    // Incremented every time a framebuffer is removed from the cache, which invalidates all front caches.
+    // Image view and render pass handles may be reused after the objects are destroyed, so a stale
+    // front cache entry could otherwise match a new key.
+    std::atomic<Uint32> m_Generation{0};
+
     std::unordered_multimap<VkImageView, FramebufferCacheKey>  m_ViewToKeyMap;
     std::unordered_multimap<VkRenderPass, FramebufferCacheKey> m_RenderPassToKeyMap;
 };
@@ -0,0 +1,174 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Declaration of Diligent::InitialDataUploadManagerVk class
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "RenderDeviceVk.h"
+#include "IndexWrapper.hpp"
+#include "VulkanUtilities/CommandBuffer.hpp"
+#include "VulkanUtilities/MemoryManager.hpp"
+#include "VulkanUtilities/ObjectWrappers.hpp"
+
+namespace Diligent
+{
+
+class RenderDeviceVkImpl;
+
+// Initial data upload manager copies the initial data of buffers and textures to the GPU.
+//
+// Every command queue has its own batch that consists of a transient command buffer and a list
+// of host-visible staging chunks. Initial data is suballocated from the current chunk and the copy
+// commands are recorded into the batch command buffer:
+//
+//    Batch
+//    |
+//    |-- Command buffer:  | Barrier | Copy(Chunk[0], Buffer0) | Copy(Chunk[0], Texture1) | ... |
+//    |
+//    |-- Chunk[0]:        | Data0 | Data1 | ... |
+//    |-- Chunk[1]:        | DataN | ... |
+//
+// The batch is submitted to the queue when the total size of the staging data reaches the batch size,
+// when Flush() is called, or before any other command buffer is submitted to the same queue.
+// After the batch is submitted, the command buffer and the staging chunks are moved to the release queue
+// with the fence value of the submission.
+//
+// If the batch size is zero, every upload is submitted immediately, which is equivalent to
+// using a dedicated staging buffer and a dedicated command buffer for every resource.
+class InitialDataUploadManagerVk
+{
+public:
+    InitialDataUploadManagerVk(RenderDeviceVkImpl& DeviceVk, Uint64 BatchSize);
+    ~InitialDataUploadManagerVk();
+
+    // clang-format off
+    InitialDataUploadManagerVk             (const InitialDataUploadManagerVk&)  = delete;
+    InitialDataUploadManagerVk             (      InitialDataUploadManagerVk&&) = delete;
+    InitialDataUploadManagerVk& operator = (const InitialDataUploadManagerVk&)  = delete;
+    InitialDataUploadManagerVk& operator = (      InitialDataUploadManagerVk&&) = delete;
+    // clang-format on
+
+    struct StagingRegion
+    {
+        VulkanUtilities::CommandBuffer& CmdBuffer;
+
+        // Staging buffer and the offset of the region in this buffer
+        const VkBuffer     vkBuffer;
+        const VkDeviceSize Offset;
+
+        // CPU address of the region
+        Uint8* const pData;
+    };
+
+    // Allocates Size bytes in the staging memory of the command queue batch and calls the handler
+    // that must write the data to StagingRegion::pData and record copy commands into StagingRegion::CmdBuffer.
+    template <typename HandlerType>
+    void Upload(SoftwareQueueIndex QueueId, VkDeviceSize Size, VkDeviceSize Alignment, HandlerType&& Handler) noexcept(false)
+    {
+        QueueBatch&                 Batch = GetBatch(QueueId);
+        std::lock_guard<std::mutex> Lock{Batch.Mtx};
+
+        Handler(Allocate(QueueId, Batch, Size, Alignment));
+
+        if (Batch.PendingSize >= m_BatchSize.load())
+            Submit(QueueId, Batch);
+    }
+
+    // Submits the pending batch of the command queue, if any, and returns the fence value
+    // of the last batch submitted to this queue.
+    Uint64 Flush(SoftwareQueueIndex QueueId);
+
+    // Submits pending batches of all command queues.
+    void FlushAll();
+
+    bool HasPendingUploads(SoftwareQueueIndex QueueId) const
+    {
+        return m_Batches[QueueId]->NumPendingUploads.load() > 0;
+    }
+
+    Uint64 GetBatchSize() const { return m_BatchSize.load(); }
+
+    // Sets the new batch size and submits the pending batches of all command queues.
+    void SetBatchSize(Uint64 BatchSize);
+
+    InitialDataUploadStatsVk GetStats() const;
+
+private:
+    struct StagingChunk
+    {
+        VulkanUtilities::BufferWrapper    Buffer;
+        VulkanUtilities::MemoryAllocation Memory;
+
+        Uint8*       pData = nullptr;
+        VkDeviceSize Size  = 0;
+        VkDeviceSize Used  = 0;
+    };
+
+    struct QueueBatch
+    {
+        std::mutex Mtx;
+
+        VulkanUtilities::CommandPoolWrapper CmdPool;
+        VulkanUtilities::CommandBuffer      CmdBuffer;
+
+        std::vector<StagingChunk> Chunks;
+
+        VkDeviceSize        PendingSize = 0;
+        std::atomic<Uint32> NumPendingUploads{0};
+
+        // Fence value of the last submitted batch
+        Uint64 LastFenceValue = 0;
+    };
+
+    QueueBatch& GetBatch(SoftwareQueueIndex QueueId)
+    {
+        VERIFY_EXPR(QueueId < m_Batches.size());
+        return *m_Batches[QueueId];
+    }
+
+    StagingRegion Allocate(SoftwareQueueIndex QueueId, QueueBatch& Batch, VkDeviceSize Size, VkDeviceSize Alignment) noexcept(false);
+    StagingChunk  CreateStagingChunk(VkDeviceSize Size) noexcept(false);
+    void          Submit(SoftwareQueueIndex QueueId, QueueBatch& Batch);
+
+private:
+    RenderDeviceVkImpl& m_DeviceVk;
+    std::atomic<Uint64> m_BatchSize{0};
+
+    std::vector<std::unique_ptr<QueueBatch>> m_Batches;
+
+    std::atomic<Uint64> m_NumUploads{0};
+    std::atomic<Uint64> m_NumSubmissions{0};
+    std::atomic<Uint64> m_StagingDataSize{0};
+};
+
+} // namespace Diligent
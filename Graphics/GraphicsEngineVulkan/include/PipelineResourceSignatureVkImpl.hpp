@@ -31,6 +31,8 @@
 /// Declaration of Diligent::PipelineResourceSignatureVkImpl class
 
 #include <array>
+#include <mutex>
+#include <vector>
 
 #include "EngineVkImplTraits.hpp"
 #include "PipelineResourceSignatureBase.hpp"
@@ -212,12 +214,33 @@ private:
 
     void CreateSetLayouts(bool IsSerialized);
 
+    // Creates the descriptor update template that writes all dynamic resources with a single call
+    void CreateDynamicSetUpdateTemplate();
+
+    // Returns the index of the SRB cache set that keeps descriptor infos for the update template
+    Uint32 GetSRBDescriptorInfoSet() const;
+
+    // Returns a static/mutable descriptor set for a new SRB
+    DescriptorSetAllocation AllocateStaticMutableSet(VkDescriptorSetLayout vkLayout, const char* DebugName);
+
     static inline CACHE_GROUP       GetResourceCacheGroup(const PipelineResourceDesc& Res);
     static inline DESCRIPTOR_SET_ID VarTypeToDescriptorSetId(SHADER_RESOURCE_VARIABLE_TYPE VarType);
 
 private:
     std::array<VulkanUtilities::DescriptorSetLayoutWrapper, DESCRIPTOR_SET_ID_NUM_SETS> m_VkDescrSetLayouts;
 
+    // Descriptor update template for the dynamic descriptor set. The template reads descriptor
+    // infos of all dynamic resources except immutable samplers from the SRB resource cache.
+    VulkanUtilities::DescriptorUpdateTemplateWrapper m_DynamicSetUpdateTemplate;
+
+    // Static/mutable descriptor sets allocated in advance for new SRBs.
+    // Sets are allocated in batches with a single vkAllocateDescriptorSets call.
+    std::mutex                           m_SpareSetsMtx;
+    std::vector<DescriptorSetAllocation> m_SpareStaticMutableSets;
+    // The number of sets allocated by the next batch. It doubles with every batch
+    // so that signatures that only have a few SRBs do not hold many unused sets.
+    Uint32 m_NextSpareSetBatchSize = 1;
+
     // Descriptor set sizes indexed by the set index in the layout (not DESCRIPTOR_SET_ID!)
     std::array<Uint32, MAX_DESCRIPTOR_SETS> m_DescriptorSetSizes = {~0U, ~0U};
 
@@ -53,6 +53,7 @@
 #include "RenderPassCache.hpp"
 #include "CommandPoolManager.hpp"
 #include "DXCompiler.hpp"
+#include "InitialDataUploadManagerVk.hpp"
 
 namespace Diligent
 {
@@ -215,7 +216,25 @@ public:
                                   VulkanUtilities::CommandPoolWrapper& CmdPool,
                                   VulkanUtilities::CommandBuffer&      CmdBuffer,
                                   const Char*                          DebugPoolName = nullptr);
-    void ExecuteAndDisposeTransientCmdBuff(SoftwareQueueIndex CommandQueueId, VkCommandBuffer vkCmdBuff, VulkanUtilities::CommandPoolWrapper&& CmdPool);
+    // Returns the fence value associated with the submitted command buffer
+    Uint64 ExecuteAndDisposeTransientCmdBuff(SoftwareQueueIndex CommandQueueId, VkCommandBuffer vkCmdBuff, VulkanUtilities::CommandPoolWrapper&& CmdPool);
+
+    /// Implementation of IRenderDeviceVk::FlushInitialDataUploads().
+    virtual Uint64 DILIGENT_CALL_TYPE FlushInitialDataUploads(Uint32 QueueIndex) override final;
+
+    /// Implementation of IRenderDeviceVk::SetInitialDataUploadBatchSize().
+    virtual void DILIGENT_CALL_TYPE SetInitialDataUploadBatchSize(Uint32 BatchSize) override final;
+
+    /// Implementation of IRenderDeviceVk::GetInitialDataUploadStats().
+    virtual void DILIGENT_CALL_TYPE GetInitialDataUploadStats(InitialDataUploadStatsVk& Stats) const override final;
+
+    /// Implementation of IRenderDeviceVk::GetMemoryStats().
+    virtual void DILIGENT_CALL_TYPE GetMemoryStats(DeviceMemoryStatsVk& Stats) const override final;
+
+    /// Implementation of IRenderDeviceVk::GetDescriptorSetAllocatorStats().
+    virtual void DILIGENT_CALL_TYPE GetDescriptorSetAllocatorStats(DescriptorSetAllocatorStatsVk& Stats) const override final;
+
+    InitialDataUploadManagerVk& GetInitialDataUploadManager() { return *m_InitialDataUploadMgr; }
 
     /// Implementation of IRenderDevice::ReleaseStaleResources() in Vulkan backend.
     virtual void DILIGENT_CALL_TYPE ReleaseStaleResources(bool ForceRelease = false) override final;
@@ -239,6 +258,14 @@ public:
     {
         return m_DescriptorSetAllocator.Allocate(CommandQueueMask, SetLayout, DebugName);
     }
+    void AllocateDescriptorSets(Uint64                       CommandQueueMask,
+                                const VkDescriptorSetLayout* pSetLayouts,
+                                Uint32                       NumSets,
+                                DescriptorSetAllocation*     pAllocations,
+                                const char*                  DebugName = "")
+    {
+        m_DescriptorSetAllocator.Allocate(CommandQueueMask, pSetLayouts, NumSets, pAllocations, DebugName);
+    }
     DescriptorPoolManager& GetDynamicDescriptorPool() { return m_DynamicDescriptorPool; }
 
     std::shared_ptr<const VulkanUtilities::Instance> GetInstance() const { return m_Instance; }
@@ -249,9 +276,9 @@ public:
     FramebufferCache* GetFramebufferCache() { return m_FramebufferCache.get(); }
     RenderPassCache*  GetImplicitRenderPassCache() { return m_ImplicitRenderPassCache.get(); }
 
-    VulkanUtilities::MemoryAllocation AllocateMemory(const VkMemoryRequirements& MemReqs, VkMemoryPropertyFlags MemoryProperties, VkMemoryAllocateFlags AllocateFlags = 0)
+    VulkanUtilities::MemoryAllocation AllocateMemory(const VkMemoryRequirements& MemReqs, VkMemoryPropertyFlags MemoryProperties, VkMemoryAllocateFlags AllocateFlags = 0, VkImage DedicatedImage = VK_NULL_HANDLE)
     {
-        return m_MemoryMgr.Allocate(MemReqs, MemoryProperties, AllocateFlags);
+        return m_MemoryMgr.Allocate(MemReqs, MemoryProperties, AllocateFlags, DedicatedImage);
     }
     VulkanUtilities::MemoryAllocation AllocateMemory(VkDeviceSize Size, VkDeviceSize Alignment, uint32_t MemoryTypeIndex, VkMemoryAllocateFlags AllocateFlags = 0)
     {
@@ -289,6 +316,10 @@ public:
 private:
     virtual void TestTextureFormat(TEXTURE_FORMAT TexFormat) override final;
 
+    // Submits the pending initial data uploads of the queue. Must be called before any other
+    // submission to the queue, since the submitted commands may use the uploaded resources.
+    void FlushPendingInitialDataUploads(SoftwareQueueIndex CommandQueueId);
+
     // Submits command buffer(s) for execution to the command queue and
     // returns the submitted command buffer(s) number and the fence value.
     // If SubmitInfo contains multiple command buffers, they all are treated
@@ -328,6 +359,9 @@ private:
     VulkanDynamicMemoryManager m_DynamicMemoryManager;
 
     std::unique_ptr<IDXCompiler> m_pDxCompiler;
+
+    // Batches staging copies of initial buffer and texture data
+    std::unique_ptr<InitialDataUploadManagerVk> m_InitialDataUploadMgr;
 };
 
 } // namespace Diligent
@@ -32,12 +32,15 @@
 
 #include <unordered_map>
 #include <mutex>
+#include <atomic>
 
 #include "GraphicsTypes.h"
 #include "Constants.h"
 #include "HashUtils.hpp"
 #include "VulkanUtilities/ObjectWrappers.hpp"
 #include "RefCntAutoPtr.hpp"
+#include "SharedMutex.hpp"
+#include "MRUCache.hpp"
 
 namespace Diligent
 {
@@ -126,10 +129,6 @@ public:
         mutable size_t Hash = 0;
     };
 
-    RenderPassVkImpl* GetRenderPass(const RenderPassCacheKey& Key);
-
-    void Destroy();
-
 private:
     struct RenderPassCacheKeyHash
     {
@@ -139,10 +138,24 @@ private:
         }
     };
 
+public:
+    // Per-context cache of the most recently used render passes that is checked before the shared cache.
+    using FrontCacheType = MRUCache<RenderPassCacheKey, RenderPassVkImpl*, 4, RenderPassCacheKeyHash>;
+
+    RenderPassVkImpl* GetRenderPass(const RenderPassCacheKey& Key);
+    RenderPassVkImpl* GetRenderPass(FrontCacheType& FrontCache, const RenderPassCacheKey& Key);
+
+    void Destroy();
+
+private:
     RenderDeviceVkImpl& m_DeviceVkImpl;
 
-    std::mutex                                                                                      m_Mutex;
+    // Cache hits only take a shared lock
+    Threading::SharedMutex                                                                          m_Mutex;
     std::unordered_map<RenderPassCacheKey, RefCntAutoPtr<RenderPassVkImpl>, RenderPassCacheKeyHash> m_Cache;
+
+    // Render passes are only removed from the cache by Destroy(), which invalidates all front caches.
+    std::atomic<Uint32> m_Generation{0};
 };
 
 } // namespace Diligent
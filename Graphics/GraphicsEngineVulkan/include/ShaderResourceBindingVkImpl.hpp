@@ -55,6 +55,12 @@ public:
     ~ShaderResourceBindingVkImpl();
 
     IMPLEMENT_QUERY_INTERFACE_IN_PLACE(IID_ShaderResourceBindingVk, TBase)
+
+    // Binds the resources and writes all descriptors with a single vkUpdateDescriptorSets call.
+    // Hides ShaderResourceBindingBase::BindVariables().
+    void BindVariables(const ShaderVariableBinding* pBindings,
+                       Uint32                       NumBindings,
+                       SET_SHADER_RESOURCE_FLAGS    Flags);
 };
 
 } // namespace Diligent
@@ -37,7 +37,7 @@
 //  m_pMemory                                |   |              m_pResources, m_NumResources == m            |
 //  |               m_DescriptorSetAllocation|   |                                                           |
 //  V                                        |   |                                                           V
-//  |  DescriptorSet[0]  |   ....    |  DescriptorSet[Ns-1]  |  Res[0]  |  ... |  Res[n-1]  |    ....     | Res[0]  |  ... |  Res[m-1]  | Inline constant values |
+//  |  DescriptorSet[0]  |   ....    |  DescriptorSet[Ns-1]  |  Res[0]  |  ... |  Res[n-1]  |    ....     | Res[0]  |  ... |  Res[m-1]  | Descriptor infos | Inline constant values |
 //         |    |                                                A \
 //         |    |                                                |  \
 //         |    |________________________________________________|   \RefCntAutoPtr
@@ -52,9 +52,14 @@
 //
 // Descriptor set for static and mutable resources is assigned during cache initialization
 // Descriptor set for dynamic resources is assigned at every draw call
+//
+// Optionally, the cache keeps Vulkan descriptor infos for all resources of one set (the dynamic set of the SRB).
+// The infos are updated when resources are bound, so that the set can be written with a single
+// vkUpdateDescriptorSetWithTemplate call that reads them directly from the cache memory.
 
 #include <vector>
 #include <memory>
+#include <tuple>
 
 #include "DescriptorPoolManager.hpp"
 #include "SPIRVShaderResources.hpp"
@@ -68,7 +73,7 @@ namespace Diligent
 
 class DeviceContextVkImpl;
 
-// sizeof(ShaderResourceCacheVk) == 24 (x64, msvc, Release)
+// sizeof(ShaderResourceCacheVk) == 32 (x64, msvc, Release)
 class ShaderResourceCacheVk : public ShaderResourceCacheBase
 {
 public:
@@ -89,17 +94,23 @@ public:
 
     ~ShaderResourceCacheVk();
 
+    static constexpr Uint32 InvalidSetIndex = ~0u;
+
     static size_t GetRequiredMemorySize(Uint32        NumSets,
                                         const Uint32* SetSizes,
-                                        Uint32        TotalInlineConstants);
+                                        Uint32        TotalInlineConstants,
+                                        Uint32        DescriptorInfoSet = InvalidSetIndex);
 
     // Allocates memory for descriptor sets and resources, including space for inline constants.
+    // If DescriptorInfoSet is not InvalidSetIndex, the cache also keeps descriptor infos for
+    // all resources of this set (see GetDescriptorInfos()).
     // IMPORTANT: This function only allocates memory. After calling InitializeSets(), you must
     //            call InitializeResources/InitializeInlineConstantBuffer to construct Resource objects.
     void InitializeSets(IMemoryAllocator& MemAllocator,
                         Uint32            NumSets,
                         const Uint32*     SetSizes,
-                        Uint32            TotalInlineConstants = 0);
+                        Uint32            TotalInlineConstants = 0,
+                        Uint32            DescriptorInfoSet    = InvalidSetIndex);
 
     void InitializeResources(Uint32         Set,
                              Uint32         Offset,
@@ -173,9 +184,22 @@ public:
         bool IsNull() const { return pObject == nullptr; }
 
         explicit operator bool() const { return !IsNull(); }
+
+        // Immutable separate samplers are permanently bound into the set layout and are never written
+        bool IsWritable() const { return Type != DescriptorType::Sampler || !HasImmutableSampler; }
+    };
+
+    // Descriptor info in the format read by descriptor update templates.
+    // Every resource of the descriptor info set has the info at its cache offset.
+    union DescriptorInfo
+    {
+        VkDescriptorImageInfo      ImageInfo;
+        VkDescriptorBufferInfo     BufferInfo;
+        VkBufferView               TexelBufferView;
+        VkAccelerationStructureKHR AccelStruct;
     };
 
-    // sizeof(DescriptorSet) == 48 (x64, msvc, Release)
+    // sizeof(DescriptorSet) == 56 (x64, msvc, Release)
     class DescriptorSet
     {
     public:
@@ -209,7 +233,7 @@ public:
 /* 0 */ const Uint32            m_NumResources = 0;
 /* 8 */ Resource* const         m_pResources   = nullptr;
 /*16 */ DescriptorSetAllocation m_DescriptorSetAllocation;
-/*48 */ // End of structure
+/*56 */ // End of structure
         // clang-format on
 
     private:
@@ -235,6 +259,66 @@ public:
         DescrSet.m_DescriptorSetAllocation = std::move(Allocation);
     }
 
+    // Collects descriptor writes to non-null descriptor sets and issues them with a single
+    // vkUpdateDescriptorSets call. Writes to consecutive array elements of the same binding
+    // are combined into one VkWriteDescriptorSet.
+    // The batch reads resources from the cache when it is flushed, so only the last
+    // resource written to every slot is used.
+    class DescriptorWriteBatch
+    {
+    public:
+        DescriptorWriteBatch(const ShaderResourceCacheVk&          ResourceCache,
+                             const VulkanUtilities::LogicalDevice& LogicalDevice) noexcept :
+            m_ResourceCache{ResourceCache},
+            m_LogicalDevice{LogicalDevice}
+        {}
+
+        // clang-format off
+        DescriptorWriteBatch             (const DescriptorWriteBatch&) = delete;
+        DescriptorWriteBatch             (DescriptorWriteBatch&&)      = delete;
+        DescriptorWriteBatch& operator = (const DescriptorWriteBatch&) = delete;
+        DescriptorWriteBatch& operator = (DescriptorWriteBatch&&)      = delete;
+        // clang-format on
+
+        ~DescriptorWriteBatch()
+        {
+            Flush();
+        }
+
+        void AddWrite(Uint32 DescrSetIndex, Uint32 CacheOffset, Uint32 BindingIndex, Uint32 ArrayIndex)
+        {
+            m_Writes.push_back({DescrSetIndex, CacheOffset, BindingIndex, ArrayIndex});
+        }
+
+        // Writes all pending descriptors
+        void Flush();
+
+        const ShaderResourceCacheVk& GetResourceCache() const { return m_ResourceCache; }
+
+    private:
+        struct PendingWrite
+        {
+            Uint32 DescrSetIndex;
+            Uint32 CacheOffset;
+            Uint32 BindingIndex;
+            Uint32 ArrayIndex;
+
+            bool operator<(const PendingWrite& RHS) const
+            {
+                return std::tie(DescrSetIndex, BindingIndex, ArrayIndex) < std::tie(RHS.DescrSetIndex, RHS.BindingIndex, RHS.ArrayIndex);
+            }
+            bool operator==(const PendingWrite& RHS) const
+            {
+                return DescrSetIndex == RHS.DescrSetIndex && BindingIndex == RHS.BindingIndex && ArrayIndex == RHS.ArrayIndex;
+            }
+        };
+
+        const ShaderResourceCacheVk&          m_ResourceCache;
+        const VulkanUtilities::LogicalDevice& m_LogicalDevice;
+
+        std::vector<PendingWrite> m_Writes;
+    };
+
     struct SetResourceInfo
     {
         const Uint32 BindingIndex = 0;
@@ -264,11 +348,13 @@ public:
         {
         }
     };
-    // Sets the resource at the given descriptor set index and offset
+    // Sets the resource at the given descriptor set index and offset.
+    // If pWriteBatch is not null, the descriptor write is deferred until the batch is flushed.
     const Resource& SetResource(const VulkanUtilities::LogicalDevice* pLogicalDevice,
                                 Uint32                                DescrSetIndex,
                                 Uint32                                CacheOffset,
-                                SetResourceInfo&&                     SrcRes);
+                                SetResourceInfo&&                     SrcRes,
+                                DescriptorWriteBatch*                 pWriteBatch = nullptr);
 
     const Resource& ResetResource(Uint32 SetIndex,
                                   Uint32 Offset)
@@ -297,6 +383,15 @@ public:
                             Uint32      FirstConstant,
                             Uint32      NumConstants);
 
+    // Returns the descriptor infos of the set, which are laid out in the cache offset order,
+    // or null if the cache does not keep infos for this set or if some of its resources are not bound.
+    const DescriptorInfo* GetDescriptorInfos(Uint32 SetIndex) const
+    {
+        return SetIndex == m_DescriptorInfoSet && m_NumNullDescriptorInfos == 0 ?
+            GetFirstDescriptorInfoPtr() :
+            nullptr;
+    }
+
     Uint32 GetNumDescriptorSets() const { return m_NumSets; }
     bool   HasDynamicResources() const { return m_NumDynamicBuffers > 0; }
 
@@ -348,12 +443,30 @@ private:
         return static_cast<DescriptorSet*>(m_pMemory.get())[Index];
     }
 
+    DescriptorInfo* GetFirstDescriptorInfoPtr()
+    {
+        static_assert(alignof(DescriptorInfo) <= alignof(Resource), "Descriptor infos are not properly aligned");
+        return reinterpret_cast<DescriptorInfo*>(GetFirstResourcePtr() + m_TotalResources);
+    }
+    const DescriptorInfo* GetFirstDescriptorInfoPtr() const
+    {
+        return reinterpret_cast<const DescriptorInfo*>(GetFirstResourcePtr() + m_TotalResources);
+    }
+
+    Uint32 GetNumDescriptorInfos() const
+    {
+        return m_DescriptorInfoSet != InvalidDescriptorInfoSet ? GetDescriptorSet(m_DescriptorInfoSet).GetSize() : 0;
+    }
+
     // Returns pointer to inline constant storage at the given offset
     void* GetInlineConstantStorage(Uint32 FirstConstant = 0)
     {
-        return reinterpret_cast<Uint8*>(GetFirstResourcePtr() + m_TotalResources) + FirstConstant * sizeof(Uint32);
+        return reinterpret_cast<Uint8*>(GetFirstDescriptorInfoPtr() + GetNumDescriptorInfos()) + FirstConstant * sizeof(Uint32);
     }
 
+    // Updates the descriptor info of the resource in the descriptor info set
+    void UpdateDescriptorInfo(Uint32 CacheOffset, const Resource& Res, bool WasNull);
+
 private:
     std::unique_ptr<void, STDDeleter<void, IMemoryAllocator>> m_pMemory;
 
@@ -371,6 +484,14 @@ private:
     // Indicates whether the cache contains inline constants
     Uint32 m_HasInlineConstants : 1;
 
+    static constexpr Uint16 InvalidDescriptorInfoSet = 0xFFFF;
+
+    // The index of the set that keeps descriptor infos, or InvalidDescriptorInfoSet
+    Uint16 m_DescriptorInfoSet = InvalidDescriptorInfoSet;
+
+    // The number of writable resources in the descriptor info set that are not bound
+    Uint32 m_NumNullDescriptorInfos = 0;
+
 #ifdef DILIGENT_DEBUG
     // Debug array that stores flags indicating if resources in the cache have been initialized
     std::vector<std::vector<bool>> m_DbgInitializedResources;
@@ -92,7 +92,10 @@ public:
     ShaderVariableVkImpl* GetVariable(const Char* Name) const;
     ShaderVariableVkImpl* GetVariable(Uint32 Index) const;
 
-    void BindResource(Uint32 ResIndex, const BindResourceInfo& BindInfo);
+    // If pWriteBatch is not null, the descriptor write is deferred until the batch is flushed
+    void BindResource(Uint32                                       ResIndex,
+                      const BindResourceInfo&                      BindInfo,
+                      ShaderResourceCacheVk::DescriptorWriteBatch* pWriteBatch = nullptr);
 
     void SetBufferDynamicOffset(Uint32 ResIndex,
                                 Uint32 ArrayIndex,
@@ -162,9 +165,10 @@ public:
         return m_ParentManager.Get(ArrayIndex, m_ResIndex);
     }
 
-    void BindResource(const BindResourceInfo& BindInfo) const
+    void BindResource(const BindResourceInfo&                      BindInfo,
+                      ShaderResourceCacheVk::DescriptorWriteBatch* pWriteBatch = nullptr) const
     {
-        m_ParentManager.BindResource(m_ResIndex, BindInfo);
+        m_ParentManager.BindResource(m_ResIndex, BindInfo, pWriteBatch);
     }
 
     void SetDynamicOffset(Uint32 ArrayIndex,
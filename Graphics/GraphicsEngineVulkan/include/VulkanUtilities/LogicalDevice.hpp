@@ -59,7 +59,8 @@ enum class VulkanHandleTypeId : uint32_t
     Event,
     QueryPool,
     AccelerationStructureKHR,
-    PipelineCache
+    PipelineCache,
+    DescriptorUpdateTemplate
 };
 
 template <typename VulkanObjectType, VulkanHandleTypeId>
@@ -85,6 +86,7 @@ using SemaphoreWrapper           = DEFINE_VULKAN_OBJECT_WRAPPER(Semaphore);
 using QueryPoolWrapper           = DEFINE_VULKAN_OBJECT_WRAPPER(QueryPool);
 using AccelStructWrapper         = DEFINE_VULKAN_OBJECT_WRAPPER(AccelerationStructureKHR);
 using PipelineCacheWrapper       = DEFINE_VULKAN_OBJECT_WRAPPER(PipelineCache);
+using DescriptorUpdateTemplateWrapper = DEFINE_VULKAN_OBJECT_WRAPPER(DescriptorUpdateTemplate);
 #undef DEFINE_VULKAN_OBJECT_WRAPPER
 
 class LogicalDevice : public std::enable_shared_from_this<LogicalDevice>
@@ -159,9 +161,12 @@ public:
 
     VkCommandBuffer     AllocateVkCommandBuffer(const VkCommandBufferAllocateInfo& AllocInfo, const char* DebugName = "") const;
     VkDescriptorSet     AllocateVkDescriptorSet(const VkDescriptorSetAllocateInfo& AllocInfo, const char* DebugName = "") const;
+    VkResult            AllocateVkDescriptorSets(const VkDescriptorSetAllocateInfo& AllocInfo, VkDescriptorSet* pSets, const char* DebugName = "") const;
 
     PipelineCacheWrapper CreatePipelineCache(const VkPipelineCacheCreateInfo &CI, const char* DebugName = "") const;
 
+    DescriptorUpdateTemplateWrapper CreateDescriptorUpdateTemplate(const VkDescriptorUpdateTemplateCreateInfo& CI, const char* DebugName = "") const;
+
     void ReleaseVulkanObject(CommandPoolWrapper&&  CmdPool) const;
     void ReleaseVulkanObject(BufferWrapper&&       Buffer) const;
     void ReleaseVulkanObject(BufferViewWrapper&&   BufferView) const;
@@ -181,8 +186,9 @@ public:
     void ReleaseVulkanObject(QueryPoolWrapper&&     QueryPool) const;
     void ReleaseVulkanObject(AccelStructWrapper&&   AccelStruct) const;
     void ReleaseVulkanObject(PipelineCacheWrapper&& PSOCache) const;
+    void ReleaseVulkanObject(DescriptorUpdateTemplateWrapper&& UpdateTemplate) const;
 
-    void FreeDescriptorSet(VkDescriptorPool Pool, VkDescriptorSet Set) const;
+    void FreeDescriptorSets(VkDescriptorPool Pool, uint32_t NumSets, const VkDescriptorSet* pSets) const;
     void FreeCommandBuffer(VkCommandPool Pool, VkCommandBuffer CmdBuffer) const;
 
     VkMemoryRequirements GetBufferMemoryRequirements(VkBuffer vkBuffer) const;
@@ -215,6 +221,10 @@ public:
                               uint32_t                    descriptorCopyCount,
                               const VkCopyDescriptorSet*  pDescriptorCopies) const;
 
+    void UpdateDescriptorSetWithTemplate(VkDescriptorSet            descriptorSet,
+                                         VkDescriptorUpdateTemplate descriptorUpdateTemplate,
+                                         const void*                pData) const;
+
     VkResult ResetCommandPool(VkCommandPool           vkCmdPool,
                               VkCommandPoolResetFlags flags = 0) const;
 
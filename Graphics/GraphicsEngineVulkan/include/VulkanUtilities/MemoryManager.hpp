@@ -29,11 +29,13 @@
 
 #include <mutex>
 #include <array>
-#include <unordered_map>
+#include <vector>
+#include <memory>
 #include <atomic>
 #include <string>
 #include "MemoryAllocator.h"
-#include "VariableSizeAllocationsManager.hpp"
+#include "RenderDeviceVk.h"
+#include "TLSFAllocationsManager.hpp"
 #include "VulkanUtilities/PhysicalDevice.hpp"
 #include "VulkanUtilities/LogicalDevice.hpp"
 #include "VulkanUtilities/ObjectWrappers.hpp"
@@ -104,54 +106,92 @@ struct MemoryAllocation
 class MemoryPage
 {
 public:
+    // If DedicatedImage is not VK_NULL_HANDLE, the memory is allocated with VkMemoryDedicatedAllocateInfo
+    // and can only be bound to this image.
     MemoryPage(MemoryManager&        ParentMemoryMgr,
                VkDeviceSize          PageSize,
                uint32_t              MemoryTypeIndex,
                bool                  IsHostVisible,
-               VkMemoryAllocateFlags AllocateFlags);
+               VkMemoryAllocateFlags AllocateFlags,
+               bool                  IsDedicated    = false,
+               VkImage               DedicatedImage = VK_NULL_HANDLE);
     ~MemoryPage();
 
     // clang-format off
-    MemoryPage(MemoryPage&& rhs)noexcept :
-        m_ParentMemoryMgr {rhs.m_ParentMemoryMgr         },
-        m_AllocationMgr   {std::move(rhs.m_AllocationMgr)},
-        m_VkMemory        {std::move(rhs.m_VkMemory)     },
-        m_CPUMemory       {rhs.m_CPUMemory               }
-    {
-        rhs.m_CPUMemory = nullptr;
-    }
-
     MemoryPage            (const MemoryPage&) = delete;
-    MemoryPage& operator= (MemoryPage&)       = delete;
-    MemoryPage& operator= (MemoryPage&& rhs)  = delete;
+    MemoryPage            (MemoryPage&&)      = delete;
+    MemoryPage& operator= (const MemoryPage&) = delete;
+    MemoryPage& operator= (MemoryPage&&)      = delete;
 
     bool IsEmpty() const { return m_AllocationMgr.IsEmpty(); }
     bool IsFull()  const { return m_AllocationMgr.IsFull();  }
-    VkDeviceSize GetPageSize() const { return m_AllocationMgr.GetMaxSize();  }
+    VkDeviceSize GetPageSize() const { return m_PageSize; }
     VkDeviceSize GetUsedSize() const { return m_AllocationMgr.GetUsedSize(); }
 
+    uint32_t              GetMemoryTypeIndex() const { return m_MemoryTypeIndex; }
+    VkMemoryAllocateFlags GetAllocateFlags()   const { return m_AllocateFlags;   }
+    bool                  IsHostVisible()      const { return m_CPUMemory != nullptr; }
+    bool                  IsDedicated()        const { return m_IsDedicated;     }
     // clang-format on
 
+    struct Stats
+    {
+        VkDeviceSize UsedSize         = 0;
+        VkDeviceSize MaxFreeBlockSize = 0;
+        size_t       NumFreeBlocks    = 0;
+        size_t       NumAllocations   = 0;
+    };
+    Stats GetStats() const;
+
     MemoryAllocation Allocate(VkDeviceSize size, VkDeviceSize alignment);
 
     VkDeviceMemory GetVkMemory() const { return m_VkMemory; }
     void*          GetCPUMemory() const { return m_CPUMemory; }
 
 private:
-    using AllocationsMgrOffsetType = Diligent::VariableSizeAllocationsManager::OffsetType;
+    using AllocationsMgrOffsetType = Diligent::TLSFAllocationsManager::OffsetType;
 
     friend struct MemoryAllocation;
 
     // Memory is reclaimed immediately. The application is responsible to ensure it is not in use by the GPU
     void Free(MemoryAllocation&& Allocation);
 
-    MemoryManager&                           m_ParentMemoryMgr;
-    std::mutex                               m_Mutex;
-    Diligent::VariableSizeAllocationsManager m_AllocationMgr;
-    VulkanUtilities::DeviceMemoryWrapper     m_VkMemory;
-    void*                                    m_CPUMemory = nullptr;
+    // Returns the parent manager's counter of empty pages of the same kind as this page
+    std::atomic<uint32_t>& GetEmptyPageCounter() const;
+
+    MemoryManager&                       m_ParentMemoryMgr;
+    mutable std::mutex                   m_Mutex;
+    Diligent::TLSFAllocationsManager     m_AllocationMgr;
+    VulkanUtilities::DeviceMemoryWrapper m_VkMemory;
+    void*                                m_CPUMemory = nullptr;
+
+    const VkDeviceSize          m_PageSize;
+    const uint32_t              m_MemoryTypeIndex;
+    const VkMemoryAllocateFlags m_AllocateFlags;
+    const bool                  m_IsDedicated;
 };
 
+// Memory manager allocates device memory pages and suballocates resources from them.
+//
+// Pages are grouped by memory type and host visibility. Pages of every group are further
+// split between several buckets, each protected by its own mutex:
+//
+//    Memory type 0, device-local:  Bucket 0: | Page | Page | ... |
+//                                  Bucket 1: | Page | ... |
+//                                  ...
+//    Memory type 0, host-visible:  Bucket 0: | Page | ... |
+//    ...
+//
+// Every thread is assigned a bucket when it first allocates memory. Allocations are served from
+// the pages in this bucket first, and from pages of other buckets of the same group only when none
+// of the bucket pages has enough space, so that threads that stream resources in parallel mostly work
+// on different pages and do not contend for the same locks. Pages use TLSF suballocation.
+//
+// Allocations whose size is at least half the page size are placed into dedicated pages of exactly the
+// required size. Dedicated image pages use VkMemoryDedicatedAllocateInfo when it is available.
+// Empty dedicated pages are always released by ShrinkMemory(). Other empty pages are released when
+// the total allocated size exceeds the reserve size, or when the memory heap is over the budget reported
+// by VK_EXT_memory_budget.
 class MemoryManager
 {
 public:
@@ -173,45 +213,28 @@ public:
         m_DeviceLocalReserveSize{DeviceLocalReserveSize},
         m_HostVisibleReserveSize{HostVisibleReserveSize}
     {}
-
-
-    // We have to write this constructor because on msvc default
-    // constructor is not labeled with noexcept, which makes all
-    // std containers use copy instead of move
-    MemoryManager(MemoryManager&& rhs)noexcept :
-        m_MgrName         {std::move(rhs.m_MgrName)},
-        m_LogicalDevice   {rhs.m_LogicalDevice     },
-        m_PhysicalDevice  {rhs.m_PhysicalDevice    },
-        m_Allocator       {rhs.m_Allocator         },
-        m_Pages           {std::move(rhs.m_Pages)  },
-
-        m_DeviceLocalPageSize    {rhs.m_DeviceLocalPageSize   },
-        m_HostVisiblePageSize    {rhs.m_HostVisiblePageSize   },
-        m_DeviceLocalReserveSize {rhs.m_DeviceLocalReserveSize},
-        m_HostVisibleReserveSize {rhs.m_HostVisibleReserveSize},
-
-        //m_CurrUsedSize      {rhs.m_CurrUsedSize},
-        m_PeakUsedSize      {rhs.m_PeakUsedSize     },
-        m_CurrAllocatedSize {rhs.m_CurrAllocatedSize},
-        m_PeakAllocatedSize {rhs.m_PeakAllocatedSize}
-    {
-        // clang-format on
-        for (size_t i = 0; i < m_CurrUsedSize.size(); ++i)
-            m_CurrUsedSize[i].store(rhs.m_CurrUsedSize[i].load());
-    }
+    // clang-format on
 
     ~MemoryManager();
 
     // clang-format off
     MemoryManager            (const MemoryManager&) = delete;
+    MemoryManager            (MemoryManager&&)      = delete;
     MemoryManager& operator= (const MemoryManager&) = delete;
     MemoryManager& operator= (MemoryManager&&)      = delete;
     // clang-format on
 
-    MemoryAllocation Allocate(VkDeviceSize Size, VkDeviceSize Alignment, uint32_t MemoryTypeIndex, bool HostVisible, VkMemoryAllocateFlags AllocateFlags);
-    MemoryAllocation Allocate(const VkMemoryRequirements& MemReqs, VkMemoryPropertyFlags MemoryProps, VkMemoryAllocateFlags AllocateFlags);
+    // If DedicatedImage is not VK_NULL_HANDLE and the allocation is placed into a dedicated page,
+    // the page memory is allocated for this image only.
+    MemoryAllocation Allocate(VkDeviceSize Size, VkDeviceSize Alignment, uint32_t MemoryTypeIndex, bool HostVisible, VkMemoryAllocateFlags AllocateFlags, VkImage DedicatedImage = VK_NULL_HANDLE);
+    MemoryAllocation Allocate(const VkMemoryRequirements& MemReqs, VkMemoryPropertyFlags MemoryProps, VkMemoryAllocateFlags AllocateFlags, VkImage DedicatedImage = VK_NULL_HANDLE);
     void             ShrinkMemory();
 
+    void GetStats(Diligent::DeviceMemoryStatsVk& Stats) const;
+
+    // The number of page buckets in every memory type group
+    static constexpr size_t NumThreadBuckets = 4;
+
 protected:
     friend class MemoryPage;
 
@@ -225,39 +248,32 @@ protected:
 
     Diligent::IMemoryAllocator& m_Allocator;
 
-    std::mutex m_PagesMtx;
-    struct MemoryPageIndex
+    struct PageBucket
     {
-        const uint32_t              MemoryTypeIndex;
-        const VkMemoryAllocateFlags AllocateFlags;
-        const bool                  IsHostVisible;
-
-        // clang-format off
-        MemoryPageIndex(uint32_t              _MemoryTypeIndex,
-                        bool                  _IsHostVisible,
-                        VkMemoryAllocateFlags _AllocateFlags) :
-            MemoryTypeIndex{_MemoryTypeIndex},
-            AllocateFlags  {_AllocateFlags},
-            IsHostVisible  {_IsHostVisible}
-        {}
-
-        bool operator == (const MemoryPageIndex& rhs)const
-        {
-            return MemoryTypeIndex == rhs.MemoryTypeIndex &&
-                   AllocateFlags   == rhs.AllocateFlags   &&
-                   IsHostVisible   == rhs.IsHostVisible;
-        }
-        // clang-format on
-
-        struct Hasher
-        {
-            size_t operator()(const MemoryPageIndex& PageIndex) const
-            {
-                return Diligent::ComputeHash(PageIndex.MemoryTypeIndex, PageIndex.AllocateFlags, PageIndex.IsHostVisible);
-            }
-        };
+        mutable std::mutex                       Mtx;
+        std::vector<std::unique_ptr<MemoryPage>> Pages;
     };
-    std::unordered_multimap<MemoryPageIndex, MemoryPage, MemoryPageIndex::Hasher> m_Pages;
+    // On integrated GPUs, there is no difference between host-visible and GPU-only
+    // memory, so MemoryTypeIndex is the same. As GPU-only pages do not have CPU address,
+    // we need to use HostVisible flag to differentiate the two.
+    using PageGroup = std::array<PageBucket, NumThreadBuckets>;
+    // [MemoryTypeIndex][HostVisible]
+    std::array<std::array<PageGroup, 2>, VK_MAX_MEMORY_TYPES> m_PageGroups;
+
+    static size_t GetThreadBucket();
+
+    MemoryAllocation AllocateFromBucket(PageBucket& Bucket, VkDeviceSize Size, VkDeviceSize Alignment, VkMemoryAllocateFlags AllocateFlags);
+    MemoryAllocation AllocateFromNewPage(PageBucket&           Bucket,
+                                         VkDeviceSize          Size,
+                                         VkDeviceSize          Alignment,
+                                         uint32_t              MemoryTypeIndex,
+                                         bool                  HostVisible,
+                                         VkMemoryAllocateFlags AllocateFlags,
+                                         bool                  IsDedicated,
+                                         VkImage               DedicatedImage);
+
+    // Returns a bit mask of memory heaps whose usage exceeds the budget.
+    uint32_t GetOverBudgetHeaps();
 
     const VkDeviceSize m_DeviceLocalPageSize;
     const VkDeviceSize m_HostVisiblePageSize;
@@ -267,12 +283,23 @@ protected:
     void OnFreeAllocation(VkDeviceSize Size, bool IsHostVisible);
 
     // 0 == Device local, 1 == Host-visible
-    std::array<std::atomic<int64_t>, 2> m_CurrUsedSize      = {};
-    std::array<VkDeviceSize, 2>         m_PeakUsedSize      = {};
-    std::array<VkDeviceSize, 2>         m_CurrAllocatedSize = {};
-    std::array<VkDeviceSize, 2>         m_PeakAllocatedSize = {};
-
-    // If adding new member, do not forget to update move ctor
+    std::array<std::atomic<int64_t>, 2>      m_CurrUsedSize      = {};
+    std::array<std::atomic<VkDeviceSize>, 2> m_PeakUsedSize      = {};
+    std::array<std::atomic<VkDeviceSize>, 2> m_CurrAllocatedSize = {};
+    std::array<std::atomic<VkDeviceSize>, 2> m_PeakAllocatedSize = {};
+
+    // The number of empty dedicated and suballocated pages. ShrinkMemory() can only release
+    // empty pages and uses these counters to skip scanning the buckets when there are none.
+    std::atomic<uint32_t> m_NumEmptyDedicatedPages{0};
+    std::atomic<uint32_t> m_NumEmptySuballocatedPages{0};
+
+    std::atomic<uint64_t> m_NumPagesCreated{0};
+    std::atomic<uint64_t> m_NumPagesDestroyed{0};
+
+    // Memory budget is only queried when pages have been created or destroyed since the last query.
+    std::mutex m_BudgetMtx;
+    uint64_t   m_BudgetPageChurn     = ~uint64_t{0};
+    uint32_t   m_OverBudgetHeapsMask = 0;
 };
 
 } // namespace VulkanUtilities
@@ -79,6 +79,7 @@ public:
         bool HasPortabilitySubset = false;
         bool RenderPass2          = false;
         bool DrawIndirectCount    = false;
+        bool MemoryBudget         = false;
     };
 
     struct ExtensionProperties
@@ -134,6 +135,10 @@ public:
 
     bool IsUMA() const;
 
+    // Queries the current budget and usage of every memory heap.
+    // Returns false if VK_EXT_memory_budget is not supported.
+    bool GetMemoryBudget(VkPhysicalDeviceMemoryBudgetPropertiesEXT& Budget) const;
+
 private:
     PhysicalDevice(const CreateInfo& CI);
 
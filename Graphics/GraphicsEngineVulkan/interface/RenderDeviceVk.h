@@ -38,6 +38,107 @@ DILIGENT_BEGIN_NAMESPACE(Diligent)
 static DILIGENT_CONSTEXPR INTERFACE_ID IID_RenderDeviceVk =
     {0xab8cf3a6, 0xd959, 0x41c1, {0xae, 0x0, 0xa5, 0x8a, 0xe9, 0x82, 0xe, 0x6a}};
 
+/// Initial data upload statistics, see IRenderDeviceVk::GetInitialDataUploadStats().
+struct InitialDataUploadStatsVk
+{
+    /// The total number of buffers and textures whose initial data was copied through the staging memory.
+    Uint64 NumUploads DEFAULT_INITIALIZER(0);
+
+    /// The total number of command buffers submitted to copy the initial data.
+    Uint64 NumSubmissions DEFAULT_INITIALIZER(0);
+
+    /// The total size of the initial data copied through the staging memory, in bytes.
+    Uint64 StagingDataSize DEFAULT_INITIALIZER(0);
+};
+typedef struct InitialDataUploadStatsVk InitialDataUploadStatsVk;
+
+/// Device memory statistics of a single Vulkan memory type, see Diligent::DeviceMemoryStatsVk.
+struct MemoryTypeStatsVk
+{
+    /// The number of device memory pages allocated from this memory type, including dedicated pages.
+    Uint32 NumPages DEFAULT_INITIALIZER(0);
+
+    /// The number of dedicated pages, where every page contains a single large resource.
+    Uint32 NumDedicatedPages DEFAULT_INITIALIZER(0);
+
+    /// The number of live suballocations in all pages.
+    Uint32 NumAllocations DEFAULT_INITIALIZER(0);
+
+    /// The number of free blocks in all pages.
+
+    /// \note  A large number of free blocks relative to the number of allocations indicates fragmentation.
+    Uint32 NumFreeBlocks DEFAULT_INITIALIZER(0);
+
+    /// The total size of device memory allocated from this memory type, in bytes.
+    Uint64 AllocatedSize DEFAULT_INITIALIZER(0);
+
+    /// The total size of all suballocations, in bytes.
+    Uint64 UsedSize DEFAULT_INITIALIZER(0);
+
+    /// The size of the largest free block in any page, in bytes.
+
+    /// \note  External fragmentation can be estimated as 1 - MaxFreeBlockSize / (AllocatedSize - UsedSize).
+    Uint64 MaxFreeBlockSize DEFAULT_INITIALIZER(0);
+};
+typedef struct MemoryTypeStatsVk MemoryTypeStatsVk;
+
+/// Device memory statistics, see IRenderDeviceVk::GetMemoryStats().
+struct DeviceMemoryStatsVk
+{
+    /// The number of valid elements in the MemoryTypes array.
+    Uint32 NumMemoryTypes DEFAULT_INITIALIZER(0);
+
+    /// The number of valid elements in the HeapBudget and HeapUsage arrays.
+    Uint32 NumMemoryHeaps DEFAULT_INITIALIZER(0);
+
+    /// Statistics of every memory type of the physical device.
+    MemoryTypeStatsVk MemoryTypes[VK_MAX_MEMORY_TYPES] DEFAULT_INITIALIZER({});
+
+    /// The memory budget of every memory heap, in bytes, as reported by VK_EXT_memory_budget.
+
+    /// \note  If VK_EXT_memory_budget is not supported, the values are zero.
+    Uint64 HeapBudget[VK_MAX_MEMORY_HEAPS] DEFAULT_INITIALIZER({});
+
+    /// The current usage of every memory heap by all processes, in bytes, as reported by VK_EXT_memory_budget.
+
+    /// \note  If VK_EXT_memory_budget is not supported, the values are zero.
+    Uint64 HeapUsage[VK_MAX_MEMORY_HEAPS] DEFAULT_INITIALIZER({});
+
+    /// The total number of device memory pages created by the memory manager.
+    Uint64 NumPagesCreated DEFAULT_INITIALIZER(0);
+
+    /// The total number of device memory pages released by the memory manager.
+    Uint64 NumPagesDestroyed DEFAULT_INITIALIZER(0);
+};
+typedef struct DeviceMemoryStatsVk DeviceMemoryStatsVk;
+
+/// Statistics of the allocator of static and mutable descriptor sets, see IRenderDeviceVk::GetDescriptorSetAllocatorStats().
+struct DescriptorSetAllocatorStatsVk
+{
+    /// The number of descriptor pools created by the allocator.
+    Uint32 NumPools DEFAULT_INITIALIZER(0);
+
+    /// The total number of descriptor sets allocated.
+    Uint64 NumSetsAllocated DEFAULT_INITIALIZER(0);
+
+    /// The total number of released descriptor sets returned to their pools.
+    Uint64 NumSetsReclaimed DEFAULT_INITIALIZER(0);
+
+    /// The total number of vkAllocateDescriptorSets calls.
+    Uint64 NumAllocateCalls DEFAULT_INITIALIZER(0);
+
+    /// The number of times an existing pool was out of space.
+    Uint64 NumPoolMisses DEFAULT_INITIALIZER(0);
+
+    /// The number of allocations served by a pool of another thread's bucket.
+
+    /// \note  Pools are distributed between several buckets, and every thread allocates
+    ///        from its own bucket first. A large number of fallbacks indicates that
+    ///        descriptor sets are mostly allocated by a few threads.
+    Uint64 NumBucketFallbacks DEFAULT_INITIALIZER(0);
+};
+typedef struct DescriptorSetAllocatorStatsVk DescriptorSetAllocatorStatsVk;
+
 #define DILIGENT_INTERFACE_NAME IRenderDeviceVk
 #include "../../../Primitives/interface/DefineInterfaceHelperMacros.h"
 
@@ -169,6 +270,47 @@ DILIGENT_BEGIN_INTERFACE(IRenderDeviceVk, IRenderDevice)
 
     /// Returns DX compiler interface, or null if the compiler is not loaded.
     VIRTUAL struct IDXCompiler* METHOD(GetDXCompiler)(THIS) CONST PURE;
+
+    /// Submits pending initial data uploads to the command queue.
+
+    /// \param [in] QueueIndex - Index of the software command queue.
+    ///
+    /// \return     Fence value of the command queue that will be signaled when the last
+    ///             batch of the initial data uploads submitted to this queue is complete
+    ///             (see ICommandQueue::GetCompletedFenceValue()).
+    ///
+    /// \remarks    Initial data uploads are only batched when the batch size is not zero
+    ///             (see EngineVkCreateInfo::InitialDataUploadBatchSize and SetInitialDataUploadBatchSize()).
+    ///             Pending uploads are also submitted automatically before any other command
+    ///             buffer is submitted to the same queue.
+    VIRTUAL Uint64 METHOD(FlushInitialDataUploads)(THIS_
+                                                   Uint32 QueueIndex) PURE;
+
+    /// Sets the size of the staging memory batch used to upload initial data of buffers and textures.
+
+    /// \param [in] BatchSize - New batch size, see EngineVkCreateInfo::InitialDataUploadBatchSize.
+    ///                         Zero value disables batching.
+    ///
+    /// \remarks    Pending uploads of all command queues are submitted before the method returns.
+    ///             The method may be used e.g. to only batch uploads while the application loads
+    ///             its resources.
+    VIRTUAL void METHOD(SetInitialDataUploadBatchSize)(THIS_
+                                                       Uint32 BatchSize) PURE;
+
+    /// Returns initial data upload statistics, see Diligent::InitialDataUploadStatsVk.
+    VIRTUAL void METHOD(GetInitialDataUploadStats)(THIS_
+                                                   InitialDataUploadStatsVk REF Stats) CONST PURE;
+
+    /// Returns device memory statistics of the global memory manager, see Diligent::DeviceMemoryStatsVk.
+
+    /// \remarks   The method locks all memory pages and is intended for diagnostics rather than
+    ///             for calling every frame.
+    VIRTUAL void METHOD(GetMemoryStats)(THIS_
+                                        DeviceMemoryStatsVk REF Stats) CONST PURE;
+
+    /// Returns statistics of the allocator of static and mutable descriptor sets, see Diligent::DescriptorSetAllocatorStatsVk.
+    VIRTUAL void METHOD(GetDescriptorSetAllocatorStats)(THIS_
+                                                        DescriptorSetAllocatorStatsVk REF Stats) CONST PURE;
 };
 DILIGENT_END_INTERFACE
 
@@ -188,6 +330,11 @@ DILIGENT_END_INTERFACE
 #    define IRenderDeviceVk_CreateFenceFromVulkanResource(This, ...)  CALL_IFACE_METHOD(RenderDeviceVk, CreateFenceFromVulkanResource,  This, __VA_ARGS__)
 #    define IRenderDeviceVk_GetDeviceFeaturesVk(This, ...)            CALL_IFACE_METHOD(RenderDeviceVk, GetDeviceFeaturesVk,            This, __VA_ARGS__)
 #    define IRenderDeviceVk_GetDXCompiler(This)                       CALL_IFACE_METHOD(RenderDeviceVk, GetDXCompiler,                  This)
+#    define IRenderDeviceVk_FlushInitialDataUploads(This, ...)        CALL_IFACE_METHOD(RenderDeviceVk, FlushInitialDataUploads,        This, __VA_ARGS__)
+#    define IRenderDeviceVk_SetInitialDataUploadBatchSize(This, ...)  CALL_IFACE_METHOD(RenderDeviceVk, SetInitialDataUploadBatchSize,  This, __VA_ARGS__)
+#    define IRenderDeviceVk_GetInitialDataUploadStats(This, ...)      CALL_IFACE_METHOD(RenderDeviceVk, GetInitialDataUploadStats,      This, __VA_ARGS__)
+#    define IRenderDeviceVk_GetMemoryStats(This, ...)                 CALL_IFACE_METHOD(RenderDeviceVk, GetMemoryStats,                 This, __VA_ARGS__)
+#    define IRenderDeviceVk_GetDescriptorSetAllocatorStats(This, ...) CALL_IFACE_METHOD(RenderDeviceVk, GetDescriptorSetAllocatorStats, This, __VA_ARGS__)
 
 // clang-format on
 
@@ -355,87 +355,33 @@ BufferVkImpl::BufferVkImpl(IReferenceCounters*        pRefCounters,
             }
             else
             {
-                VkBufferCreateInfo VkStaginBuffCI = VkBuffCI;
-                VkStaginBuffCI.usage              = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
-
-                std::string StagingBufferName = "Upload buffer for '";
-                StagingBufferName += m_Desc.Name;
-                StagingBufferName += '\'';
-                VulkanUtilities::BufferWrapper StagingBuffer = LogicalDevice.CreateBuffer(VkStaginBuffCI, StagingBufferName.c_str());
-
-                VkMemoryRequirements StagingBufferMemReqs = LogicalDevice.GetBufferMemoryRequirements(StagingBuffer);
-                VERIFY(IsPowerOfTwo(StagingBufferMemReqs.alignment), "Alignment is not power of 2!");
-
-                // VK_MEMORY_PROPERTY_HOST_COHERENT_BIT bit specifies that the host cache management commands vkFlushMappedMemoryRanges
-                // and vkInvalidateMappedMemoryRanges are NOT needed to flush host writes to the device or make device writes visible
-                // to the host (10.2)
-                VulkanUtilities::MemoryAllocation StagingMemoryAllocation = pRenderDeviceVk->AllocateMemory(StagingBufferMemReqs, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
-                if (!StagingMemoryAllocation)
-                    LOG_ERROR_AND_THROW("Failed to allocate staging memory for buffer '", m_Desc.Name, "'.");
-
-                VkDeviceMemory StagingBufferMemory     = StagingMemoryAllocation.Page->GetVkMemory();
-                VkDeviceSize   AlignedStagingMemOffset = AlignUp(VkDeviceSize{StagingMemoryAllocation.UnalignedOffset}, StagingBufferMemReqs.alignment);
-                VERIFY_EXPR(StagingMemoryAllocation.Size >= StagingBufferMemReqs.size + (AlignedStagingMemOffset - StagingMemoryAllocation.UnalignedOffset));
-
-                uint8_t* StagingData = reinterpret_cast<uint8_t*>(StagingMemoryAllocation.Page->GetCPUMemory());
-                if (StagingData == nullptr)
-                    LOG_ERROR_AND_THROW("Failed to allocate staging data for buffer '", m_Desc.Name, '\'');
-                memcpy(StagingData + AlignedStagingMemOffset, pBuffData->pData, StaticCast<size_t>(InitialDataSize));
-
-                err = LogicalDevice.BindBufferMemory(StagingBuffer, StagingBufferMemory, AlignedStagingMemOffset);
-                CHECK_VK_ERROR_AND_THROW(err, "Failed to bind staging buffer memory");
-
                 const SoftwareQueueIndex CmdQueueInd = pBuffData->pContext ?
                     ClassPtrCast<DeviceContextVkImpl>(pBuffData->pContext)->GetCommandQueueId() :
                     SoftwareQueueIndex{PlatformMisc::GetLSB(m_Desc.ImmediateContextMask)};
 
-                VulkanUtilities::CommandPoolWrapper CmdPool;
-                VulkanUtilities::CommandBuffer      CmdBuffer;
-                pRenderDeviceVk->AllocateTransientCmdPool(CmdQueueInd, CmdPool, CmdBuffer, "Transient command pool to copy staging data to a device buffer");
-
-                CmdBuffer.MemoryBarrier(VK_ACCESS_HOST_WRITE_BIT, VK_ACCESS_TRANSFER_READ_BIT, VK_PIPELINE_STAGE_HOST_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT);
-                InitialState              = RESOURCE_STATE_COPY_DEST;
-                VkAccessFlags AccessFlags = ResourceStateFlagsToVkAccessFlags(InitialState);
-                VERIFY_EXPR(AccessFlags == VK_ACCESS_TRANSFER_WRITE_BIT);
-                CmdBuffer.MemoryBarrier(0, AccessFlags, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT);
-
-                // Copy commands MUST be recorded outside of a render pass instance. This is OK here
-                // as copy will be the only command in the cmd buffer
-                VkBufferCopy BuffCopy{};
-                BuffCopy.srcOffset = 0;
-                BuffCopy.dstOffset = 0;
-                BuffCopy.size      = VkBuffCI.size;
-                CmdBuffer.CopyBuffer(StagingBuffer, m_VulkanBuffer, 1, &BuffCopy);
-
-                pRenderDeviceVk->ExecuteAndDisposeTransientCmdBuff(CmdQueueInd, CmdBuffer.GetVkCmdBuffer(), std::move(CmdPool));
-
-
-                // After command buffer is submitted, safe-release staging resources. This strategy
-                // is little overconservative as the resources will only be released after the
-                // first command buffer submitted through the immediate context is complete
-
-                // Next Cmd Buff| Next Fence |               This Thread                      |           Immediate Context
-                //              |            |                                                |
-                //      N       |     F      |                                                |
-                //              |            |                                                |
-                //              |            |  ExecuteAndDisposeTransientCmdBuff(vkCmdBuff)  |
-                //              |            |  - SubmittedCmdBuffNumber = N                  |
-                //              |            |  - SubmittedFenceValue = F                     |
-                //     N+1 -  - | -  F+1  -  |                                                |
-                //              |            |  Release(StagingBuffer)                        |
-                //              |            |  - {N+1, StagingBuffer} -> Stale Objects       |
-                //              |            |                                                |
-                //              |            |                                                |
-                //              |            |                                                | ExecuteCommandBuffer()
-                //              |            |                                                | - SubmittedCmdBuffNumber = N+1
-                //              |            |                                                | - SubmittedFenceValue = F+1
-                //     N+2 -  - | -  F+2  -  |  -   -   -   -   -   -   -   -   -   -   -   - |
-                //              |            |                                                | - DiscardStaleVkObjects(N+1, F+1)
-                //              |            |                                                |   - {F+1, StagingBuffer} -> Release Queue
-                //              |            |                                                |
-
-                pRenderDeviceVk->SafeReleaseDeviceObject(std::move(StagingBuffer), Uint64{1} << Uint64{CmdQueueInd});
-                pRenderDeviceVk->SafeReleaseDeviceObject(std::move(StagingMemoryAllocation), Uint64{1} << Uint64{CmdQueueInd});
+                InitialState = RESOURCE_STATE_COPY_DEST;
+
+                // The data is copied to the staging memory of the command queue batch. The batch
+                // is submitted before any other command buffer is submitted to the same queue, and
+                // the staging memory is released once the batch is complete.
+                pRenderDeviceVk->GetInitialDataUploadManager().Upload(
+                    CmdQueueInd, InitialDataSize, 16,
+                    [&](const InitialDataUploadManagerVk::StagingRegion& Region) //
+                    {
+                        memcpy(Region.pData, pBuffData->pData, StaticCast<size_t>(InitialDataSize));
+
+                        const VkAccessFlags AccessFlags = ResourceStateFlagsToVkAccessFlags(InitialState);
+                        VERIFY_EXPR(AccessFlags == VK_ACCESS_TRANSFER_WRITE_BIT);
+                        Region.CmdBuffer.MemoryBarrier(0, AccessFlags, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT);
+
+                        // Copy commands MUST be recorded outside of a render pass instance. This is OK here
+                        // as the batch command buffer only contains copy commands
+                        VkBufferCopy BuffCopy{};
+                        BuffCopy.srcOffset = Region.Offset;
+                        BuffCopy.dstOffset = 0;
+                        BuffCopy.size      = InitialDataSize;
+                        Region.CmdBuffer.CopyBuffer(Region.vkBuffer, m_VulkanBuffer, 1, &BuffCopy);
+                    });
             }
         }
 
@@ -29,6 +29,8 @@
 #include "DescriptorPoolManager.hpp"
 #include "RenderDeviceVkImpl.hpp"
 
+#include <algorithm>
+
 namespace Diligent
 {
 
@@ -37,7 +39,7 @@ void DescriptorSetAllocation::Release()
     if (Set != VK_NULL_HANDLE)
     {
         VERIFY_EXPR(DescrSetAllocator != nullptr && Pool != VK_NULL_HANDLE);
-        DescrSetAllocator->FreeDescriptorSet(Set, Pool, CmdQueueMask);
+        DescrSetAllocator->FreeDescriptorSet(Set, Pool, CmdQueueMask, BucketIdx);
 
         Reset();
     }
@@ -189,55 +191,242 @@ static VkDescriptorSet AllocateDescriptorSet(const VulkanUtilities::LogicalDevic
     return LogicalDevice.AllocateVkDescriptorSet(DescrSetAllocInfo, DebugName);
 }
 
+static bool AllocateDescriptorSets(const VulkanUtilities::LogicalDevice& LogicalDevice,
+                                   VkDescriptorPool                      Pool,
+                                   const VkDescriptorSetLayout*          pSetLayouts,
+                                   Uint32                                NumSets,
+                                   VkDescriptorSet*                      pSets,
+                                   const char*                           DebugName)
+{
+    VkDescriptorSetAllocateInfo DescrSetAllocInfo = {};
+
+    DescrSetAllocInfo.sType              = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+    DescrSetAllocInfo.pNext              = nullptr;
+    DescrSetAllocInfo.descriptorPool     = Pool;
+    DescrSetAllocInfo.descriptorSetCount = NumSets;
+    DescrSetAllocInfo.pSetLayouts        = pSetLayouts;
+    // If the allocation fails, all sets that were successfully created are freed (13.2.3)
+    return LogicalDevice.AllocateVkDescriptorSets(DescrSetAllocInfo, pSets, DebugName) == VK_SUCCESS;
+}
 
 DescriptorSetAllocator::~DescriptorSetAllocator()
 {
+    ReclaimReleasedSets();
+
     DEV_CHECK_ERR(m_AllocatedSetCounter == 0, m_AllocatedSetCounter, " descriptor set(s) have not been returned to the allocator. If there are outstanding references to the sets in release queues, the app will crash when DescriptorSetAllocator::FreeDescriptorSet() is called");
+
+    const DescriptorSetAllocatorStatsVk Stats = GetStats();
+    LOG_INFO_MESSAGE(m_PoolName, " stats: allocated ", Stats.NumSetsAllocated, " descriptor set(s) in ", Stats.NumAllocateCalls,
+                     " call(s); pool misses: ", Stats.NumPoolMisses, "; bucket fallbacks: ", Stats.NumBucketFallbacks);
+
+    // Move all pools to the base class that will destroy them
+    for (PoolBucket& Bucket : m_Buckets)
+    {
+        for (VulkanUtilities::DescriptorPoolWrapper& Pool : Bucket.Pools)
+            m_Pools.emplace_back(std::move(Pool));
+        Bucket.Pools.clear();
+    }
 }
 
-DescriptorSetAllocation DescriptorSetAllocator::Allocate(Uint64 CommandQueueMask, VkDescriptorSetLayout SetLayout, const char* DebugName)
+Uint32 DescriptorSetAllocator::GetThreadBucket()
 {
-    // Descriptor pools are externally synchronized, meaning that the application must not allocate
-    // and/or free descriptor sets from the same pool in multiple threads simultaneously (13.2.3)
-    std::lock_guard<std::mutex> Lock{m_Mutex};
+    // Assign buckets to threads in round-robin order
+    static std::atomic<Uint32> NextBucket{0};
+    thread_local const Uint32  ThreadBucket = NextBucket.fetch_add(1) % NumThreadBuckets;
+    return ThreadBucket;
+}
+
+void DescriptorSetAllocator::ReclaimReleasedSets(PoolBucket& Bucket)
+{
+    std::vector<ReleasedSet>& Sets = Bucket.ReclaimBuffer;
+    VERIFY_EXPR(Sets.empty());
+
+    ReleasedSet Released;
+    while (Bucket.ReleasedSets.Dequeue(Released))
+        Sets.push_back(Released);
+
+    if (Sets.empty())
+        return;
+
+    // Group the sets by pool to free them with as few vkFreeDescriptorSets calls as possible
+    std::sort(Sets.begin(), Sets.end(),
+              [](const ReleasedSet& lhs, const ReleasedSet& rhs) {
+                  return lhs.Pool < rhs.Pool;
+              });
+
+    const VulkanUtilities::LogicalDevice& LogicalDevice = m_DeviceVkImpl.GetLogicalDevice();
+
+    std::array<VkDescriptorSet, MaxFreeBatchSize> vkSets;
+    for (size_t i = 0; i < Sets.size();)
+    {
+        const VkDescriptorPool vkPool  = Sets[i].Pool;
+        Uint32                 NumSets = 0;
+        for (; i < Sets.size() && Sets[i].Pool == vkPool && NumSets < MaxFreeBatchSize; ++i)
+            vkSets[NumSets++] = Sets[i].Set;
+
+        LogicalDevice.FreeDescriptorSets(vkPool, NumSets, vkSets.data());
+    }
+
+    m_NumSetsReclaimed.fetch_add(Sets.size());
+    Sets.clear();
+}
+
+void DescriptorSetAllocator::ReclaimReleasedSets()
+{
+    for (PoolBucket& Bucket : m_Buckets)
+    {
+        std::lock_guard<std::mutex> Lock{Bucket.Mtx};
+        ReclaimReleasedSets(Bucket);
+    }
+}
+
+VkDescriptorPool DescriptorSetAllocator::AllocateFromBucket(PoolBucket&                  Bucket,
+                                                            const VkDescriptorSetLayout* pSetLayouts,
+                                                            Uint32                       NumSets,
+                                                            VkDescriptorSet*             pSets,
+                                                            const char*                  DebugName)
+{
+    // Return the sets released since the last allocation to make their space available
+    ReclaimReleasedSets(Bucket);
 
     const VulkanUtilities::LogicalDevice& LogicalDevice = m_DeviceVkImpl.GetLogicalDevice();
     // Try all pools starting from the frontmost
-    for (auto it = m_Pools.begin(); it != m_Pools.end(); ++it)
+    for (auto it = Bucket.Pools.begin(); it != Bucket.Pools.end(); ++it)
     {
-        VkDescriptorSet vkSet = AllocateDescriptorSet(LogicalDevice, *it, SetLayout, DebugName);
-        if (vkSet != VK_NULL_HANDLE)
+        m_NumAllocateCalls.fetch_add(1);
+        if (AllocateDescriptorSets(LogicalDevice, *it, pSetLayouts, NumSets, pSets, DebugName))
         {
             VkDescriptorPool vkPool = *it;
             // Move the pool to the front
-            if (it != m_Pools.begin())
+            if (it != Bucket.Pools.begin())
             {
-                std::swap(*it, m_Pools.front());
+                std::swap(*it, Bucket.Pools.front());
             }
+            return vkPool;
+        }
+        m_NumPoolMisses.fetch_add(1);
+    }
 
-#ifdef DILIGENT_DEVELOPMENT
-            ++m_AllocatedSetCounter;
-#endif
-            return {vkSet, vkPool, CommandQueueMask, *this};
+    return VK_NULL_HANDLE;
+}
+
+VkDescriptorPool DescriptorSetAllocator::AllocateBatch(const VkDescriptorSetLayout* pSetLayouts,
+                                                       Uint32                       NumSets,
+                                                       VkDescriptorSet*             pSets,
+                                                       const char*                  DebugName,
+                                                       Uint32&                      BucketIdx)
+{
+    VERIFY_EXPR(NumSets > 0 && NumSets <= MaxAllocBatchSize);
+
+    // Descriptor pools are externally synchronized, meaning that the application must not allocate
+    // and/or free descriptor sets from the same pool in multiple threads simultaneously (13.2.3)
+    const Uint32 ThreadBucket = GetThreadBucket();
+    {
+        PoolBucket&                 Bucket = m_Buckets[ThreadBucket];
+        std::lock_guard<std::mutex> Lock{Bucket.Mtx};
+        if (VkDescriptorPool vkPool = AllocateFromBucket(Bucket, pSetLayouts, NumSets, pSets, DebugName))
+        {
+            BucketIdx = ThreadBucket;
+            return vkPool;
         }
     }
 
-    // Failed to allocate descriptor from existing pools -> create a new one
+    // Try buckets of other threads, but do not wait for them
+    for (Uint32 i = 1; i < NumThreadBuckets; ++i)
+    {
+        const Uint32 Idx    = (ThreadBucket + i) % NumThreadBuckets;
+        PoolBucket&  Bucket = m_Buckets[Idx];
+
+        std::unique_lock<std::mutex> Lock{Bucket.Mtx, std::try_to_lock};
+        if (!Lock.owns_lock())
+            continue;
+
+        if (VkDescriptorPool vkPool = AllocateFromBucket(Bucket, pSetLayouts, NumSets, pSets, DebugName))
+        {
+            m_NumBucketFallbacks.fetch_add(1);
+            BucketIdx = Idx;
+            return vkPool;
+        }
+    }
+
+    // Failed to allocate descriptor sets from existing pools -> create a new one.
+    // The pool is not visible to other threads until it is added to the bucket,
+    // so there is no need to hold the lock while it is being created.
     LOG_INFO_MESSAGE("Allocated new descriptor pool");
-    m_Pools.emplace_front(CreateDescriptorPool("Descriptor pool"));
+    VulkanUtilities::DescriptorPoolWrapper NewPool = CreateDescriptorPool("Descriptor pool");
+    m_NumPools.fetch_add(1);
+
+    m_NumAllocateCalls.fetch_add(1);
+    const bool Allocated = AllocateDescriptorSets(m_DeviceVkImpl.GetLogicalDevice(), NewPool, pSetLayouts, NumSets, pSets, DebugName);
+    // A batch may not fit into an empty pool if the pool is small. Allocate() retries such batches one set at a time.
+    DEV_CHECK_ERR(Allocated || NumSets > 1, "Failed to allocate descriptor set");
 
-    VulkanUtilities::DescriptorPoolWrapper& NewPool = m_Pools.front();
-    VkDescriptorSet                         vkSet   = AllocateDescriptorSet(LogicalDevice, NewPool, SetLayout, DebugName);
-    DEV_CHECK_ERR(vkSet != VK_NULL_HANDLE, "Failed to allocate descriptor set");
+    const VkDescriptorPool vkPool = Allocated ? static_cast<VkDescriptorPool>(NewPool) : VK_NULL_HANDLE;
+    {
+        PoolBucket&                 Bucket = m_Buckets[ThreadBucket];
+        std::lock_guard<std::mutex> Lock{Bucket.Mtx};
+        Bucket.Pools.emplace_front(std::move(NewPool));
+    }
+
+    BucketIdx = ThreadBucket;
+    return vkPool;
+}
+
+void DescriptorSetAllocator::Allocate(Uint64                       CommandQueueMask,
+                                      const VkDescriptorSetLayout* pSetLayouts,
+                                      Uint32                       NumSets,
+                                      DescriptorSetAllocation*     pAllocations,
+                                      const char*                  DebugName)
+{
+    VERIFY_EXPR(pSetLayouts != nullptr && pAllocations != nullptr);
+
+    std::array<VkDescriptorSet, MaxAllocBatchSize> vkSets;
+    for (Uint32 FirstSet = 0; FirstSet < NumSets; FirstSet += MaxAllocBatchSize)
+    {
+        const Uint32 BatchSize = std::min({NumSets - FirstSet, MaxAllocBatchSize, m_MaxSets});
 
+        Uint32           BucketIdx = 0;
+        VkDescriptorPool vkPool    = AllocateBatch(pSetLayouts + FirstSet, BatchSize, vkSets.data(), DebugName, BucketIdx);
+        if (vkPool == VK_NULL_HANDLE && BatchSize > 1)
+        {
+            // The batch does not fit into a single pool - allocate the sets one by one
+            for (Uint32 i = 0; i < BatchSize; ++i)
+                Allocate(CommandQueueMask, pSetLayouts + FirstSet + i, 1, pAllocations + FirstSet + i, DebugName);
+            continue;
+        }
+        if (vkPool == VK_NULL_HANDLE)
+            continue;
+
+        for (Uint32 i = 0; i < BatchSize; ++i)
+            pAllocations[FirstSet + i] = DescriptorSetAllocation{vkSets[i], vkPool, CommandQueueMask, *this, BucketIdx};
+
+        m_NumSetsAllocated.fetch_add(BatchSize);
 #ifdef DILIGENT_DEVELOPMENT
-    ++m_AllocatedSetCounter;
+        m_AllocatedSetCounter.fetch_add(static_cast<Int32>(BatchSize));
 #endif
+    }
+}
 
-    return {vkSet, NewPool, CommandQueueMask, *this};
+DescriptorSetAllocation DescriptorSetAllocator::Allocate(Uint64 CommandQueueMask, VkDescriptorSetLayout SetLayout, const char* DebugName)
+{
+    DescriptorSetAllocation Allocation;
+    Allocate(CommandQueueMask, &SetLayout, 1, &Allocation, DebugName);
+    return Allocation;
+}
+
+DescriptorSetAllocatorStatsVk DescriptorSetAllocator::GetStats() const
+{
+    DescriptorSetAllocatorStatsVk Stats;
+    Stats.NumPools           = m_NumPools.load();
+    Stats.NumSetsAllocated   = m_NumSetsAllocated.load();
+    Stats.NumSetsReclaimed   = m_NumSetsReclaimed.load();
+    Stats.NumAllocateCalls   = m_NumAllocateCalls.load();
+    Stats.NumPoolMisses      = m_NumPoolMisses.load();
+    Stats.NumBucketFallbacks = m_NumBucketFallbacks.load();
+    return Stats;
 }
 
-void DescriptorSetAllocator::FreeDescriptorSet(VkDescriptorSet Set, VkDescriptorPool Pool, Uint64 QueueMask)
+void DescriptorSetAllocator::FreeDescriptorSet(VkDescriptorSet Set, VkDescriptorPool Pool, Uint64 QueueMask, Uint32 BucketIdx)
 {
     class DescriptorSetDeleter
     {
@@ -245,10 +434,12 @@ void DescriptorSetAllocator::FreeDescriptorSet(VkDescriptorSet Set, VkDescriptor
         // clang-format off
         DescriptorSetDeleter(DescriptorSetAllocator& _Allocator,
                              VkDescriptorSet         _Set,
-                             VkDescriptorPool        _Pool) :
+                             VkDescriptorPool        _Pool,
+                             Uint32                  _BucketIdx) :
             Allocator {&_Allocator},
             Set       {_Set       },
-            Pool      {_Pool      }
+            Pool      {_Pool      },
+            BucketIdx {_BucketIdx }
         {}
 
         DescriptorSetDeleter             (const DescriptorSetDeleter&) = delete;
@@ -258,7 +449,8 @@ void DescriptorSetAllocator::FreeDescriptorSet(VkDescriptorSet Set, VkDescriptor
         DescriptorSetDeleter(DescriptorSetDeleter&& rhs)noexcept :
             Allocator {rhs.Allocator},
             Set       {rhs.Set      },
-            Pool      {rhs.Pool     }
+            Pool      {rhs.Pool     },
+            BucketIdx {rhs.BucketIdx}
         {
             rhs.Allocator = nullptr;
             rhs.Set       = VK_NULL_HANDLE;
@@ -270,8 +462,9 @@ void DescriptorSetAllocator::FreeDescriptorSet(VkDescriptorSet Set, VkDescriptor
         {
             if (Allocator != nullptr)
             {
-                std::lock_guard<std::mutex> Lock{Allocator->m_Mutex};
-                Allocator->m_DeviceVkImpl.GetLogicalDevice().FreeDescriptorSet(Pool, Set);
+                // Do not lock the bucket here: the set is returned to the pool
+                // by the next thread that allocates from this bucket.
+                Allocator->m_Buckets[BucketIdx].ReleasedSets.Enqueue({Set, Pool});
 #ifdef DILIGENT_DEVELOPMENT
                 --Allocator->m_AllocatedSetCounter;
 #endif
@@ -282,8 +475,10 @@ void DescriptorSetAllocator::FreeDescriptorSet(VkDescriptorSet Set, VkDescriptor
         DescriptorSetAllocator* Allocator;
         VkDescriptorSet         Set;
         VkDescriptorPool        Pool;
+        Uint32                  BucketIdx;
     };
-    m_DeviceVkImpl.SafeReleaseDeviceObject(DescriptorSetDeleter{*this, Set, Pool}, QueueMask);
+    VERIFY_EXPR(BucketIdx < NumThreadBuckets);
+    m_DeviceVkImpl.SafeReleaseDeviceObject(DescriptorSetDeleter{*this, Set, Pool, BucketIdx}, QueueMask);
 }
 
 
@@ -2041,12 +2041,12 @@ void DeviceContextVkImpl::ChooseRenderPassAndFramebuffer()
     RenderPassCache*  RPCache = m_pDevice->GetImplicitRenderPassCache();
     if (FBCache != nullptr && RPCache != nullptr)
     {
-        if (RenderPassVkImpl* pRenderPass = RPCache->GetRenderPass(RenderPassKey))
+        if (RenderPassVkImpl* pRenderPass = RPCache->GetRenderPass(m_RenderPassFrontCache, RenderPassKey))
         {
             m_vkRenderPass         = pRenderPass->GetVkRenderPass();
             FBKey.Pass             = m_vkRenderPass;
             FBKey.CommandQueueMask = ~Uint64{0};
-            m_vkFramebuffer        = FBCache->GetFramebuffer(FBKey, m_FramebufferWidth, m_FramebufferHeight, m_FramebufferSlices);
+            m_vkFramebuffer        = FBCache->GetFramebuffer(m_FramebufferFrontCache, FBKey, m_FramebufferWidth, m_FramebufferHeight, m_FramebufferSlices);
         }
         else
         {
@@ -1242,6 +1242,15 @@ void EngineFactoryVkImpl::CreateDeviceAndContextsVk(const EngineVkCreateInfo& En
                 }
             }
 
+            // Memory budget is used by the memory manager to release unused pages when
+            // the heap usage exceeds the budget.
+            if (DeviceExtFeatures.MemoryBudget)
+            {
+                VERIFY_EXPR(PhysicalDevice->IsExtensionSupported(VK_EXT_MEMORY_BUDGET_EXTENSION_NAME));
+                DeviceExtensions.push_back(VK_EXT_MEMORY_BUDGET_EXTENSION_NAME);
+                EnabledExtFeats.MemoryBudget = true;
+            }
+
             if (EnabledFeatures.NativeMultiDraw != DEVICE_FEATURE_STATE_DISABLED)
             {
                 VERIFY_EXPR(PhysicalDevice->IsExtensionSupported(VK_EXT_MULTI_DRAW_EXTENSION_NAME));
@@ -81,8 +81,17 @@ bool FramebufferCache::FramebufferCacheKey::UsesImageView(VkImageView View) cons
 
 VkFramebuffer FramebufferCache::GetFramebuffer(const FramebufferCacheKey& Key, uint32_t width, uint32_t height, uint32_t layers)
 {
-    std::lock_guard<std::mutex> Lock{m_Mutex};
+    {
+        std::shared_lock<Threading::SharedMutex> ReadLock{m_Mutex};
+
+        auto it = m_Cache.find(Key);
+        if (it != m_Cache.end())
+            return it->second;
+    }
 
+    std::unique_lock<Threading::SharedMutex> WriteLock{m_Mutex};
+
+    // The framebuffer may have been created by another thread while the lock was released
     auto it = m_Cache.find(Key);
     if (it != m_Cache.end())
     {
@@ -137,6 +146,18 @@ VkFramebuffer FramebufferCache::GetFramebuffer(const FramebufferCacheKey& Key, u
     }
 }
 
+VkFramebuffer FramebufferCache::GetFramebuffer(FrontCacheType& FrontCache, const FramebufferCacheKey& Key, uint32_t width, uint32_t height, uint32_t layers)
+{
+    // The generation must be read before the shared cache is accessed
+    const Uint32 Generation = m_Generation.load(std::memory_order_acquire);
+    if (const VkFramebuffer* pFramebuffer = FrontCache.Find(Key, Generation))
+        return *pFramebuffer;
+
+    VkFramebuffer Framebuffer = GetFramebuffer(Key, width, height, layers);
+    FrontCache.Add(Key, Framebuffer, Generation);
+    return Framebuffer;
+}
+
 std::unique_ptr<VulkanUtilities::RenderingInfoWrapper> FramebufferCache::CreateDyanmicRenderInfo(const FramebufferCacheKey&            Key,
                                                                                                  const CreateDyanmicRenderInfoAttribs& Attribs)
 {
@@ -197,9 +218,13 @@ FramebufferCache::~FramebufferCache()
 
 void FramebufferCache::OnDestroyImageView(VkImageView ImgView)
 {
-    std::lock_guard<std::mutex> Lock{m_Mutex};
+    std::unique_lock<Threading::SharedMutex> Lock{m_Mutex};
 
     auto equal_range = m_ViewToKeyMap.equal_range(ImgView);
+    if (equal_range.first == equal_range.second)
+        return;
+
+    m_Generation.fetch_add(1, std::memory_order_release);
     for (auto it = equal_range.first; it != equal_range.second; ++it)
     {
         const FramebufferCacheKey& Key = it->second;
@@ -230,9 +255,13 @@ void FramebufferCache::OnDestroyImageView(VkImageView ImgView)
 
 void FramebufferCache::OnDestroyRenderPass(VkRenderPass Pass)
 {
-    std::lock_guard<std::mutex> Lock{m_Mutex};
+    std::unique_lock<Threading::SharedMutex> Lock{m_Mutex};
 
     auto equal_range = m_RenderPassToKeyMap.equal_range(Pass);
+    if (equal_range.first == equal_range.second)
+        return;
+
+    m_Generation.fetch_add(1, std::memory_order_release);
     for (auto it = equal_range.first; it != equal_range.second; ++it)
     {
         const FramebufferCacheKey& Key = it->second;
@@ -0,0 +1,193 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "pch.h"
+
+#include "InitialDataUploadManagerVk.hpp"
+#include "RenderDeviceVkImpl.hpp"
+#include "Align.hpp"
+#include "FormatString.hpp"
+
+namespace Diligent
+{
+
+InitialDataUploadManagerVk::InitialDataUploadManagerVk(RenderDeviceVkImpl& DeviceVk, Uint64 BatchSize) :
+    m_DeviceVk{DeviceVk},
+    m_BatchSize{BatchSize}
+{
+    m_Batches.resize(m_DeviceVk.GetCommandQueueCount());
+    for (std::unique_ptr<QueueBatch>& pBatch : m_Batches)
+        pBatch = std::make_unique<QueueBatch>();
+}
+
+InitialDataUploadManagerVk::~InitialDataUploadManagerVk()
+{
+    for (const std::unique_ptr<QueueBatch>& pBatch : m_Batches)
+    {
+        DEV_CHECK_ERR(pBatch->CmdBuffer.GetVkCmdBuffer() == VK_NULL_HANDLE && pBatch->Chunks.empty(),
+                      "All initial data uploads must have been submitted before the manager is destroyed");
+    }
+
+    const InitialDataUploadStatsVk Stats = GetStats();
+    // Only report the statistics if any uploads were batched
+    if (Stats.NumSubmissions < Stats.NumUploads)
+    {
+        LOG_INFO_MESSAGE("Initial data upload manager: ", Stats.NumUploads, " uploads (",
+                         FormatMemorySize(Stats.StagingDataSize, 2), ") in ", Stats.NumSubmissions, " submissions");
+    }
+}
+
+InitialDataUploadManagerVk::StagingChunk InitialDataUploadManagerVk::CreateStagingChunk(VkDeviceSize Size) noexcept(false)
+{
+    const VulkanUtilities::LogicalDevice& LogicalDevice = m_DeviceVk.GetLogicalDevice();
+
+    VkBufferCreateInfo VkStagingBuffCI{};
+    VkStagingBuffCI.sType       = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    VkStagingBuffCI.size        = Size;
+    VkStagingBuffCI.usage       = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
+    VkStagingBuffCI.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+
+    StagingChunk Chunk;
+    Chunk.Buffer = LogicalDevice.CreateBuffer(VkStagingBuffCI, "Initial data staging buffer");
+    Chunk.Size   = Size;
+
+    VkMemoryRequirements MemReqs = LogicalDevice.GetBufferMemoryRequirements(Chunk.Buffer);
+    VERIFY(IsPowerOfTwo(MemReqs.alignment), "Alignment is not power of 2!");
+
+    // VK_MEMORY_PROPERTY_HOST_COHERENT_BIT bit specifies that the host cache management commands vkFlushMappedMemoryRanges
+    // and vkInvalidateMappedMemoryRanges are NOT needed to flush host writes to the device or make device writes visible
+    // to the host (10.2)
+    Chunk.Memory = m_DeviceVk.AllocateMemory(MemReqs, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+    if (!Chunk.Memory)
+        LOG_ERROR_AND_THROW("Failed to allocate ", Size, " bytes of staging memory for initial data");
+
+    const VkDeviceSize AlignedOffset = AlignUp(VkDeviceSize{Chunk.Memory.UnalignedOffset}, MemReqs.alignment);
+    VERIFY_EXPR(Chunk.Memory.Size >= MemReqs.size + (AlignedOffset - Chunk.Memory.UnalignedOffset));
+
+    Chunk.pData = reinterpret_cast<Uint8*>(Chunk.Memory.Page->GetCPUMemory());
+    if (Chunk.pData == nullptr)
+        LOG_ERROR_AND_THROW("Staging memory for initial data is not mapped");
+    Chunk.pData += AlignedOffset;
+
+    VkResult err = LogicalDevice.BindBufferMemory(Chunk.Buffer, Chunk.Memory.Page->GetVkMemory(), AlignedOffset);
+    CHECK_VK_ERROR_AND_THROW(err, "Failed to bind staging buffer memory");
+
+    return Chunk;
+}
+
+InitialDataUploadManagerVk::StagingRegion InitialDataUploadManagerVk::Allocate(SoftwareQueueIndex QueueId,
+                                                                               QueueBatch&        Batch,
+                                                                               VkDeviceSize       Size,
+                                                                               VkDeviceSize       Alignment) noexcept(false)
+{
+    VERIFY_EXPR(Size > 0 && Alignment > 0);
+
+    if (Batch.CmdBuffer.GetVkCmdBuffer() == VK_NULL_HANDLE)
+    {
+        m_DeviceVk.AllocateTransientCmdPool(QueueId, Batch.CmdPool, Batch.CmdBuffer, "Transient command pool to copy initial data");
+
+        // Host writes to staging memory must be visible to copy commands
+        Batch.CmdBuffer.MemoryBarrier(VK_ACCESS_HOST_WRITE_BIT, VK_ACCESS_TRANSFER_READ_BIT, VK_PIPELINE_STAGE_HOST_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT);
+    }
+
+    // Alignment is not necessarily a power of two (e.g. 12 bytes for RGB32 formats)
+    VkDeviceSize Offset = !Batch.Chunks.empty() ? AlignUpNonPw2(Batch.Chunks.back().Used, Alignment) : 0;
+    if (Batch.Chunks.empty() || Offset + Size > Batch.Chunks.back().Size)
+    {
+        // Large uploads get a dedicated chunk
+        Batch.Chunks.emplace_back(CreateStagingChunk(std::max(Size, VkDeviceSize{m_BatchSize.load()})));
+        Offset = 0;
+    }
+
+    StagingChunk& Chunk = Batch.Chunks.back();
+    Chunk.Used          = Offset + Size;
+    Batch.PendingSize += Size;
+    Batch.NumPendingUploads.fetch_add(1);
+
+    m_NumUploads.fetch_add(1);
+    m_StagingDataSize.fetch_add(Size);
+
+    return StagingRegion{Batch.CmdBuffer, Chunk.Buffer, Offset, Chunk.pData + Offset};
+}
+
+void InitialDataUploadManagerVk::Submit(SoftwareQueueIndex QueueId, QueueBatch& Batch)
+{
+    if (Batch.CmdBuffer.GetVkCmdBuffer() == VK_NULL_HANDLE)
+        return;
+
+    Batch.LastFenceValue = m_DeviceVk.ExecuteAndDisposeTransientCmdBuff(QueueId, Batch.CmdBuffer.GetVkCmdBuffer(), std::move(Batch.CmdPool));
+    Batch.CmdBuffer.Reset();
+
+    // We know exactly which queue the staging memory was used by and the fence value
+    // of the submission, so the chunks can be moved directly to the release queue.
+    auto& ReleaseQueue = m_DeviceVk.GetReleaseQueue(QueueId);
+    for (StagingChunk& Chunk : Batch.Chunks)
+    {
+        ReleaseQueue.DiscardResource(std::move(Chunk.Buffer), Batch.LastFenceValue);
+        ReleaseQueue.DiscardResource(std::move(Chunk.Memory), Batch.LastFenceValue);
+    }
+    Batch.Chunks.clear();
+
+    Batch.PendingSize = 0;
+    Batch.NumPendingUploads.store(0);
+
+    m_NumSubmissions.fetch_add(1);
+}
+
+Uint64 InitialDataUploadManagerVk::Flush(SoftwareQueueIndex QueueId)
+{
+    QueueBatch&                 Batch = GetBatch(QueueId);
+    std::lock_guard<std::mutex> Lock{Batch.Mtx};
+    Submit(QueueId, Batch);
+    return Batch.LastFenceValue;
+}
+
+void InitialDataUploadManagerVk::FlushAll()
+{
+    for (Uint32 q = 0; q < m_Batches.size(); ++q)
+    {
+        if (HasPendingUploads(SoftwareQueueIndex{q}))
+            Flush(SoftwareQueueIndex{q});
+    }
+}
+
+void InitialDataUploadManagerVk::SetBatchSize(Uint64 BatchSize)
+{
+    m_BatchSize.store(BatchSize);
+    // Uploads that were batched with the previous size must not wait for the next flush
+    FlushAll();
+}
+
+InitialDataUploadStatsVk InitialDataUploadManagerVk::GetStats() const
+{
+    InitialDataUploadStatsVk Stats;
+    Stats.NumUploads      = m_NumUploads.load();
+    Stats.NumSubmissions  = m_NumSubmissions.load();
+    Stats.StagingDataSize = m_StagingDataSize.load();
+    return Stats;
+}
+
+} // namespace Diligent
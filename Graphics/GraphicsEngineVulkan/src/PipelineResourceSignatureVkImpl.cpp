@@ -29,6 +29,8 @@
 
 #include "PipelineResourceSignatureVkImpl.hpp"
 
+#include <algorithm>
+
 #include "RenderDeviceVkImpl.hpp"
 #include "SamplerVkImpl.hpp"
 #include "TextureViewVkImpl.hpp"
@@ -158,7 +160,7 @@ PipelineResourceSignatureVkImpl::PipelineResourceSignatureVkImpl(IReferenceCount
             },
             [this]() //
             {
-                return ShaderResourceCacheVk::GetRequiredMemorySize(GetNumDescriptorSets(), m_DescriptorSetSizes.data(), m_TotalInlineConstants);
+                return ShaderResourceCacheVk::GetRequiredMemorySize(GetNumDescriptorSets(), m_DescriptorSetSizes.data(), m_TotalInlineConstants, GetSRBDescriptorInfoSet());
             });
     }
     catch (...)
@@ -534,9 +536,64 @@ void PipelineResourceSignatureVkImpl::CreateSetLayouts(const bool IsSerialized)
             m_VkDescrSetLayouts[i]   = LogicalDevice.CreateDescriptorSetLayout(SetLayoutCI);
         }
         VERIFY_EXPR(NumSets == GetNumDescriptorSets());
+
+        if (HasDescriptorSet(DESCRIPTOR_SET_ID_DYNAMIC))
+            CreateDynamicSetUpdateTemplate();
     }
 }
 
+void PipelineResourceSignatureVkImpl::CreateDynamicSetUpdateTemplate()
+{
+#if DILIGENT_USE_VOLK
+    // Descriptor update templates are core in Vulkan 1.1
+    if (GetDevice()->GetVkVersion() < VK_API_VERSION_1_1)
+        return;
+
+    const std::pair<Uint32, Uint32> DynResIdxRange = GetResourceIndexRange(SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC);
+
+    std::vector<VkDescriptorUpdateTemplateEntry> Entries;
+    Entries.reserve(DynResIdxRange.second - DynResIdxRange.first);
+
+    for (Uint32 ResIdx = DynResIdxRange.first; ResIdx < DynResIdxRange.second; ++ResIdx)
+    {
+        const PipelineResourceDesc&        Res  = GetResourceDesc(ResIdx);
+        const PipelineResourceAttribsType& Attr = GetResourceAttribs(ResIdx);
+
+        // Only a few elements of a run-time sized array are typically bound,
+        // so writing the entire array with the template is not practical.
+        if ((Res.Flags & PIPELINE_RESOURCE_FLAG_RUNTIME_ARRAY) != 0)
+            return;
+
+        const DescriptorType DescrType = Attr.GetDescriptorType();
+        // Immutable samplers are permanently bound into the set layout
+        if (DescrType == DescriptorType::Sampler && Attr.IsImmutableSamplerAssigned())
+            continue;
+
+        // The template reads descriptor infos that the SRB resource cache keeps at the resource cache offsets
+        VkDescriptorUpdateTemplateEntry Entry{};
+        Entry.dstBinding      = Attr.BindingIndex;
+        Entry.dstArrayElement = 0;
+        Entry.descriptorCount = Attr.ArraySize;
+        Entry.descriptorType  = DescriptorTypeToVkDescriptorType(DescrType);
+        Entry.offset          = size_t{Attr.CacheOffset(ResourceCacheContentType::SRB)} * sizeof(ShaderResourceCacheVk::DescriptorInfo);
+        Entry.stride          = sizeof(ShaderResourceCacheVk::DescriptorInfo);
+        Entries.push_back(Entry);
+    }
+
+    if (Entries.empty())
+        return;
+
+    VkDescriptorUpdateTemplateCreateInfo TemplateCI{};
+    TemplateCI.sType                      = VK_STRUCTURE_TYPE_DESCRIPTOR_UPDATE_TEMPLATE_CREATE_INFO;
+    TemplateCI.descriptorUpdateEntryCount = StaticCast<uint32_t>(Entries.size());
+    TemplateCI.pDescriptorUpdateEntries   = Entries.data();
+    TemplateCI.templateType               = VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_DESCRIPTOR_SET;
+    TemplateCI.descriptorSetLayout        = m_VkDescrSetLayouts[DESCRIPTOR_SET_ID_DYNAMIC];
+
+    m_DynamicSetUpdateTemplate = GetDevice()->GetLogicalDevice().CreateDescriptorUpdateTemplate(TemplateCI, m_Desc.Name);
+#endif
+}
+
 PipelineResourceSignatureVkImpl::~PipelineResourceSignatureVkImpl()
 {
     Destruct();
@@ -544,6 +601,12 @@ PipelineResourceSignatureVkImpl::~PipelineResourceSignatureVkImpl()
 
 void PipelineResourceSignatureVkImpl::Destruct()
 {
+    // Return the spare sets to the allocator
+    m_SpareStaticMutableSets.clear();
+
+    if (m_DynamicSetUpdateTemplate)
+        GetDevice()->SafeReleaseDeviceObject(std::move(m_DynamicSetUpdateTemplate), ~0ull);
+
     for (VulkanUtilities::DescriptorSetLayoutWrapper& Layout : m_VkDescrSetLayouts)
     {
         if (Layout)
@@ -553,6 +616,35 @@ void PipelineResourceSignatureVkImpl::Destruct()
     TPipelineResourceSignatureBase::Destruct();
 }
 
+DescriptorSetAllocation PipelineResourceSignatureVkImpl::AllocateStaticMutableSet(VkDescriptorSetLayout vkLayout, const char* DebugName)
+{
+    // Maximum number of sets allocated in one batch
+    static constexpr Uint32 MaxSpareSetBatchSize = 16;
+
+    std::lock_guard<std::mutex> Lock{m_SpareSetsMtx};
+    if (m_SpareStaticMutableSets.empty())
+    {
+        const Uint32 NumSets    = m_NextSpareSetBatchSize;
+        m_NextSpareSetBatchSize = std::min(m_NextSpareSetBatchSize * 2, MaxSpareSetBatchSize);
+
+        std::array<VkDescriptorSetLayout, MaxSpareSetBatchSize> vkLayouts;
+        vkLayouts.fill(vkLayout);
+
+        m_SpareStaticMutableSets.resize(NumSets);
+        GetDevice()->AllocateDescriptorSets(~Uint64{0}, vkLayouts.data(), NumSets, m_SpareStaticMutableSets.data(), DebugName);
+        // Sets that failed to allocate are null. Remove them so that the next SRB tries again.
+        m_SpareStaticMutableSets.erase(std::remove_if(m_SpareStaticMutableSets.begin(), m_SpareStaticMutableSets.end(),
+                                                      [](const DescriptorSetAllocation& Set) { return !Set; }),
+                                       m_SpareStaticMutableSets.end());
+        if (m_SpareStaticMutableSets.empty())
+            return {};
+    }
+
+    DescriptorSetAllocation SetAllocation = std::move(m_SpareStaticMutableSets.back());
+    m_SpareStaticMutableSets.pop_back();
+    return SetAllocation;
+}
+
 void PipelineResourceSignatureVkImpl::InitSRBResourceCache(ShaderResourceCacheVk& ResourceCache)
 {
     const Uint32 NumSets = GetNumDescriptorSets();
@@ -562,7 +654,7 @@ void PipelineResourceSignatureVkImpl::InitSRBResourceCache(ShaderResourceCacheVk
 #endif
 
     IMemoryAllocator& CacheMemAllocator = m_SRBMemAllocator.GetResourceCacheDataAllocator(0);
-    ResourceCache.InitializeSets(CacheMemAllocator, NumSets, m_DescriptorSetSizes.data(), m_TotalInlineConstants);
+    ResourceCache.InitializeSets(CacheMemAllocator, NumSets, m_DescriptorSetSizes.data(), m_TotalInlineConstants, GetSRBDescriptorInfoSet());
 
     if (VkDescriptorSetLayout vkLayout = GetVkDescriptorSetLayout(DESCRIPTOR_SET_ID_STATIC_MUTABLE))
     {
@@ -572,7 +664,7 @@ void PipelineResourceSignatureVkImpl::InitSRBResourceCache(ShaderResourceCacheVk
         _DescrSetName.append(" - static/mutable set");
         DescrSetName = _DescrSetName.c_str();
 #endif
-        DescriptorSetAllocation SetAllocation = GetDevice()->AllocateDescriptorSet(~Uint64{0}, vkLayout, DescrSetName);
+        DescriptorSetAllocation SetAllocation = AllocateStaticMutableSet(vkLayout, DescrSetName);
         ResourceCache.AssignDescriptorSetAllocation(GetDescriptorSetIndex<DESCRIPTOR_SET_ID_STATIC_MUTABLE>(), std::move(SetAllocation));
     }
 
@@ -633,6 +725,9 @@ void PipelineResourceSignatureVkImpl::CopyStaticResources(ShaderResourceCacheVk&
     const ResourceCacheContentType              SrcCacheType     = SrcResourceCache.GetContentType();
     const ResourceCacheContentType              DstCacheType     = DstResourceCache.GetContentType();
 
+    // Write all static descriptors with a single vkUpdateDescriptorSets call
+    ShaderResourceCacheVk::DescriptorWriteBatch WriteBatch{DstResourceCache, GetDevice()->GetLogicalDevice()};
+
     for (Uint32 r = ResIdxRange.first; r < ResIdxRange.second; ++r)
     {
         const PipelineResourceDesc& ResDesc = GetResourceDesc(r);
@@ -696,11 +791,13 @@ void PipelineResourceSignatureVkImpl::CopyStaticResources(ShaderResourceCacheVk&
                                                      RefCntAutoPtr<IDeviceObject>{SrcCachedRes.pObject},
                                                      SrcCachedRes.BufferBaseOffset,
                                                      SrcCachedRes.BufferRangeSize //
-                                                 });
+                                                 },
+                                                 &WriteBatch);
                 }
             }
         }
     }
+    WriteBatch.Flush();
 
 #ifdef DILIGENT_DEBUG
     DstResourceCache.DbgVerifyDynamicBuffersCounter();
@@ -721,6 +818,11 @@ Uint32 PipelineResourceSignatureVkImpl::GetDescriptorSetIndex<PipelineResourceSi
     return HasDescriptorSet(DESCRIPTOR_SET_ID_STATIC_MUTABLE) ? 1 : 0;
 }
 
+Uint32 PipelineResourceSignatureVkImpl::GetSRBDescriptorInfoSet() const
+{
+    return m_DynamicSetUpdateTemplate ? GetDescriptorSetIndex<DESCRIPTOR_SET_ID_DYNAMIC>() : ShaderResourceCacheVk::InvalidSetIndex;
+}
+
 void PipelineResourceSignatureVkImpl::CommitDynamicResources(const ShaderResourceCacheVk& ResourceCache,
                                                              VkDescriptorSet              vkDynamicDescriptorSet) const
 {
@@ -728,6 +830,18 @@ void PipelineResourceSignatureVkImpl::CommitDynamicResources(const ShaderResourc
     VERIFY_EXPR(vkDynamicDescriptorSet != VK_NULL_HANDLE);
     VERIFY_EXPR(ResourceCache.GetContentType() == ResourceCacheContentType::SRB);
 
+    // Use the template whenever all resources are bound, which is the common case.
+    // The template reads the descriptor infos directly from the resource cache.
+    // Otherwise, fall back to individual descriptor writes that skip null elements.
+    if (m_DynamicSetUpdateTemplate)
+    {
+        if (const ShaderResourceCacheVk::DescriptorInfo* pDescriptorInfos = ResourceCache.GetDescriptorInfos(GetDescriptorSetIndex<DESCRIPTOR_SET_ID_DYNAMIC>()))
+        {
+            GetDevice()->GetLogicalDevice().UpdateDescriptorSetWithTemplate(vkDynamicDescriptorSet, m_DynamicSetUpdateTemplate, pDescriptorInfos);
+            return;
+        }
+    }
+
 #ifdef DILIGENT_DEBUG
     static constexpr size_t ImgUpdateBatchSize          = 4;
     static constexpr size_t BuffUpdateBatchSize         = 2;
@@ -1080,7 +1194,7 @@ PipelineResourceSignatureVkImpl::PipelineResourceSignatureVkImpl(IReferenceCount
             },
             [this]() //
             {
-                return ShaderResourceCacheVk::GetRequiredMemorySize(GetNumDescriptorSets(), m_DescriptorSetSizes.data(), m_TotalInlineConstants);
+                return ShaderResourceCacheVk::GetRequiredMemorySize(GetNumDescriptorSets(), m_DescriptorSetSizes.data(), m_TotalInlineConstants, GetSRBDescriptorInfoSet());
             });
     }
     catch (...)
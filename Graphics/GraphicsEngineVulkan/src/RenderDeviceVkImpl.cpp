@@ -201,6 +201,8 @@ RenderDeviceVkImpl::RenderDeviceVkImpl(IReferenceCounters*
         m_QueryMgrs.emplace_back(std::make_unique<QueryManagerVk>(this, EngineCI.QueryPoolSizes, SoftwareQueueIndex{q}));
     }
 
+    m_InitialDataUploadMgr = std::make_unique<InitialDataUploadManagerVk>(*this, EngineCI.InitialDataUploadBatchSize);
+
     for (Uint32 fmt = 1; fmt < m_TextureFormatsInfo.size(); ++fmt)
         m_TextureFormatsInfo[fmt].Supported = true; // We will test every format on a specific hardware device
 
@@ -289,9 +291,9 @@ void RenderDeviceVkImpl::AllocateTransientCmdPool(SoftwareQueueIndex
 }
 
 
-void RenderDeviceVkImpl::ExecuteAndDisposeTransientCmdBuff(SoftwareQueueIndex                    CommandQueueId,
-                                                           VkCommandBuffer                       vkCmdBuff,
-                                                           VulkanUtilities::CommandPoolWrapper&& CmdPool)
+Uint64 RenderDeviceVkImpl::ExecuteAndDisposeTransientCmdBuff(SoftwareQueueIndex                    CommandQueueId,
+                                                             VkCommandBuffer                       vkCmdBuff,
+                                                             VulkanUtilities::CommandPoolWrapper&& CmdPool)
 {
     VERIFY_EXPR(vkCmdBuff != VK_NULL_HANDLE);
 
@@ -401,6 +403,8 @@ void RenderDeviceVkImpl::ExecuteAndDisposeTransientCmdBuff(SoftwareQueueIndex
         },
         FenceValue);
     // clang-format on
+
+    return FenceValue;
 }
 
 void RenderDeviceVkImpl::SubmitCommandBuffer(SoftwareQueueIndex                                          CommandQueueId,
@@ -410,6 +414,8 @@ void RenderDeviceVkImpl::SubmitCommandBuffer(SoftwareQueueIndex
                                              std::vector<std::pair<Uint64, RefCntAutoPtr<FenceVkImpl>>>* pSignalFences           // List of fences to signal
 )
 {
+    FlushPendingInitialDataUploads(CommandQueueId);
+
     // Submit the command list to the queue
     SubmittedCommandBufferInfo CmbBuffInfo = TRenderDeviceBase::SubmitCommandBuffer(CommandQueueId, true, SubmitInfo);
     SubmittedFenceValue                    = CmbBuffInfo.FenceValue;
@@ -444,13 +450,22 @@ Uint64 RenderDeviceVkImpl::ExecuteCommandBuffer(SoftwareQueueIndex CommandQueueI
 
 void RenderDeviceVkImpl::IdleGPU()
 {
+    m_InitialDataUploadMgr->FlushAll();
     IdleAllCommandQueues(true);
     m_LogicalDevice->WaitIdle();
     ReleaseStaleResources();
 }
 
+void RenderDeviceVkImpl::FlushPendingInitialDataUploads(SoftwareQueueIndex CommandQueueId)
+{
+    if (m_InitialDataUploadMgr->HasPendingUploads(CommandQueueId))
+        m_InitialDataUploadMgr->Flush(CommandQueueId);
+}
+
 void RenderDeviceVkImpl::FlushStaleResources(SoftwareQueueIndex CmdQueueIndex)
 {
+    FlushPendingInitialDataUploads(CmdQueueIndex);
+
     // Submit empty command buffer to the queue. This will effectively signal the fence and
     // discard all resources
     VkSubmitInfo DummySubmitInfo{};
@@ -458,10 +473,38 @@ void RenderDeviceVkImpl::FlushStaleResources(SoftwareQueueIndex CmdQueueIndex)
     TRenderDeviceBase::SubmitCommandBuffer(CmdQueueIndex, true, DummySubmitInfo);
 }
 
+Uint64 RenderDeviceVkImpl::FlushInitialDataUploads(Uint32 QueueIndex)
+{
+    DEV_CHECK_ERR(QueueIndex < GetCommandQueueCount(), "Command queue index (", QueueIndex, ") is out of range");
+    return m_InitialDataUploadMgr->Flush(SoftwareQueueIndex{QueueIndex});
+}
+
+void RenderDeviceVkImpl::SetInitialDataUploadBatchSize(Uint32 BatchSize)
+{
+    m_InitialDataUploadMgr->SetBatchSize(BatchSize);
+}
+
+void RenderDeviceVkImpl::GetInitialDataUploadStats(InitialDataUploadStatsVk& Stats) const
+{
+    Stats = m_InitialDataUploadMgr->GetStats();
+}
+
+void RenderDeviceVkImpl::GetMemoryStats(DeviceMemoryStatsVk& Stats) const
+{
+    m_MemoryMgr.GetStats(Stats);
+}
+
+void RenderDeviceVkImpl::GetDescriptorSetAllocatorStats(DescriptorSetAllocatorStatsVk& Stats) const
+{
+    Stats = m_DescriptorSetAllocator.GetStats();
+}
+
 void RenderDeviceVkImpl::ReleaseStaleResources(bool ForceRelease)
 {
     m_MemoryMgr.ShrinkMemory();
     PurgeReleaseQueues(ForceRelease);
+    // Return the descriptor sets released by the queues to their pools
+    m_DescriptorSetAllocator.ReclaimReleasedSets();
 }
 
 
@@ -53,6 +53,9 @@ RenderPassCache::~RenderPassCache()
 
 void RenderPassCache::Destroy()
 {
+    std::unique_lock<Threading::SharedMutex> Lock{m_Mutex};
+
+    m_Generation.fetch_add(1, std::memory_order_release);
     if (FramebufferCache* FBCache = m_DeviceVkImpl.GetFramebufferCache())
     {
         for (auto it = m_Cache.begin(); it != m_Cache.end(); ++it)
@@ -191,8 +194,18 @@ static RenderPassDesc GetImplicitRenderPassDesc(
 
 RenderPassVkImpl* RenderPassCache::GetRenderPass(const RenderPassCacheKey& Key)
 {
-    std::lock_guard<std::mutex> Lock{m_Mutex};
-    auto                        it = m_Cache.find(Key);
+    {
+        std::shared_lock<Threading::SharedMutex> ReadLock{m_Mutex};
+
+        auto it = m_Cache.find(Key);
+        if (it != m_Cache.end())
+            return it->second;
+    }
+
+    std::unique_lock<Threading::SharedMutex> WriteLock{m_Mutex};
+
+    // The render pass may have been created by another thread while the lock was released
+    auto it = m_Cache.find(Key);
     if (it == m_Cache.end())
     {
         // Do not zero-initialize arrays
@@ -250,4 +263,17 @@ RenderPassVkImpl* RenderPassCache::GetRenderPass(const RenderPassCacheKey& Key)
     return it->second;
 }
 
+RenderPassVkImpl* RenderPassCache::GetRenderPass(FrontCacheType& FrontCache, const RenderPassCacheKey& Key)
+{
+    // The generation must be read before the shared cache is accessed
+    const Uint32 Generation = m_Generation.load(std::memory_order_acquire);
+    if (RenderPassVkImpl* const* ppRenderPass = FrontCache.Find(Key, Generation))
+        return *ppRenderPass;
+
+    RenderPassVkImpl* pRenderPass = GetRenderPass(Key);
+    if (pRenderPass != nullptr)
+        FrontCache.Add(Key, pRenderPass, Generation);
+    return pRenderPass;
+}
+
 } // namespace Diligent
@@ -43,4 +43,26 @@ ShaderResourceBindingVkImpl::~ShaderResourceBindingVkImpl()
 {
 }
 
+void ShaderResourceBindingVkImpl::BindVariables(const ShaderVariableBinding* pBindings,
+                                                Uint32                       NumBindings,
+                                                SET_SHADER_RESOURCE_FLAGS    Flags)
+{
+    ShaderResourceCacheVk::DescriptorWriteBatch WriteBatch{m_ShaderResourceCache, GetSignature()->GetDevice()->GetLogicalDevice()};
+    for (Uint32 i = 0; i < NumBindings; ++i)
+    {
+        const ShaderVariableBinding& Binding = pBindings[i];
+
+        ShaderVariableVkImpl* pVar = GetBindingVariable(Binding);
+        if (pVar == nullptr)
+            continue;
+
+        for (Uint32 elem = 0; elem < Binding.NumElements; ++elem)
+        {
+            const BindResourceInfo BindInfo{Binding.FirstElement + elem, Binding.ppObjects[elem], Flags, Binding.BufferOffset, Binding.BufferRange};
+            pVar->BindResource(BindInfo, &WriteBatch);
+        }
+    }
+    // All descriptors are written when the batch is destroyed
+}
+
 } // namespace Diligent
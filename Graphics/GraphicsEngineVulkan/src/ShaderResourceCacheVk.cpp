@@ -43,20 +43,24 @@ namespace Diligent
 
 size_t ShaderResourceCacheVk::GetRequiredMemorySize(Uint32        NumSets,
                                                     const Uint32* SetSizes,
-                                                    Uint32        TotalInlineConstants)
+                                                    Uint32        TotalInlineConstants,
+                                                    Uint32        DescriptorInfoSet)
 {
     Uint32 TotalResources = 0;
     for (Uint32 t = 0; t < NumSets; ++t)
         TotalResources += SetSizes[t];
 
-    size_t MemorySize = NumSets * sizeof(DescriptorSet) + TotalResources * sizeof(Resource) + TotalInlineConstants * sizeof(Uint32);
+    const Uint32 NumDescriptorInfos = DescriptorInfoSet != InvalidSetIndex ? SetSizes[DescriptorInfoSet] : 0;
+
+    size_t MemorySize = NumSets * sizeof(DescriptorSet) + TotalResources * sizeof(Resource) + NumDescriptorInfos * sizeof(DescriptorInfo) + TotalInlineConstants * sizeof(Uint32);
     return MemorySize;
 }
 
 void ShaderResourceCacheVk::InitializeSets(IMemoryAllocator& MemAllocator,
                                            Uint32            NumSets,
                                            const Uint32*     SetSizes,
-                                           Uint32            TotalInlineConstants)
+                                           Uint32            TotalInlineConstants,
+                                           Uint32            DescriptorInfoSet)
 {
     VERIFY(!m_pMemory, "Memory has already been allocated");
 
@@ -65,7 +69,7 @@ void ShaderResourceCacheVk::InitializeSets(IMemoryAllocator& MemAllocator,
     //  m_pMemory
     //  |
     //  V
-    // ||  DescriptorSet[0]  |   ....    |  DescriptorSet[Ns-1]  |  Res[0]  |  ... |  Res[n-1]  |    ....     | Res[0]  |  ... |  Res[m-1]  | Inline constant values ||
+    // ||  DescriptorSet[0]  |   ....    |  DescriptorSet[Ns-1]  |  Res[0]  |  ... |  Res[n-1]  |    ....     | Res[0]  |  ... |  Res[m-1]  | Descriptor infos | Inline constant values ||
     //
     //
     //  Ns = m_NumSets
@@ -80,8 +84,13 @@ void ShaderResourceCacheVk::InitializeSets(IMemoryAllocator& MemAllocator,
         m_TotalResources += SetSizes[t];
     }
 
-    const size_t MemorySize = NumSets * sizeof(DescriptorSet) + m_TotalResources * sizeof(Resource) + TotalInlineConstants * sizeof(Uint32);
-    VERIFY_EXPR(MemorySize == GetRequiredMemorySize(NumSets, SetSizes, TotalInlineConstants));
+    VERIFY_EXPR(DescriptorInfoSet == InvalidSetIndex || DescriptorInfoSet < NumSets);
+    m_DescriptorInfoSet             = DescriptorInfoSet != InvalidSetIndex ? static_cast<Uint16>(DescriptorInfoSet) : InvalidDescriptorInfoSet;
+    m_NumNullDescriptorInfos        = 0;
+    const Uint32 NumDescriptorInfos = DescriptorInfoSet != InvalidSetIndex ? SetSizes[DescriptorInfoSet] : 0;
+
+    const size_t MemorySize = NumSets * sizeof(DescriptorSet) + m_TotalResources * sizeof(Resource) + NumDescriptorInfos * sizeof(DescriptorInfo) + TotalInlineConstants * sizeof(Uint32);
+    VERIFY_EXPR(MemorySize == GetRequiredMemorySize(NumSets, SetSizes, TotalInlineConstants, DescriptorInfoSet));
 #ifdef DILIGENT_DEBUG
     m_DbgInitializedResources.resize(m_NumSets);
     m_DbgAssignedInlineConstants.resize(TotalInlineConstants);
@@ -104,7 +113,7 @@ void ShaderResourceCacheVk::InitializeSets(IMemoryAllocator& MemAllocator,
             m_DbgInitializedResources[t].resize(SetSizes[t]);
 #endif
         }
-        VERIFY_EXPR(reinterpret_cast<Uint8*>(pCurrResPtr) + TotalInlineConstants * sizeof(Uint32) == reinterpret_cast<Uint8*>(m_pMemory.get()) + MemorySize);
+        VERIFY_EXPR(reinterpret_cast<Uint8*>(pCurrResPtr) + NumDescriptorInfos * sizeof(DescriptorInfo) + TotalInlineConstants * sizeof(Uint32) == reinterpret_cast<Uint8*>(m_pMemory.get()) + MemorySize);
     }
 
     m_HasInlineConstants = TotalInlineConstants > 0 ? 1 : 0;
@@ -119,10 +128,12 @@ void ShaderResourceCacheVk::InitializeResources(Uint32         Set,
     DescriptorSet& DescrSet = GetDescriptorSet(Set);
     for (Uint32 res = 0; res < ArraySize; ++res)
     {
-        new (&DescrSet.GetResource(Offset + res)) Resource{
+        const Resource* pRes = new (&DescrSet.GetResource(Offset + res)) Resource{
             Type,
             HasImmutableSampler,
         };
+        if (Set == m_DescriptorInfoSet && pRes->IsWritable())
+            ++m_NumNullDescriptorInfos;
 #ifdef DILIGENT_DEBUG
         VERIFY(!m_DbgInitializedResources[Set][size_t{Offset} + res], "Resource at set ", Set, " offset ", Offset + res, " has already been initialized");
         m_DbgInitializedResources[Set][size_t{Offset} + res] = true;
@@ -146,6 +157,8 @@ void ShaderResourceCacheVk::InitializeInlineConstantBuffer(Uint32
     };
 
     pInlineCB->BufferRangeSize = NumInlineConstants * sizeof(Uint32);
+    if (Set == m_DescriptorInfoSet)
+        ++m_NumNullDescriptorInfos;
 
 #ifdef DILIGENT_DEBUG
     VERIFY(!m_DbgInitializedResources[Set][size_t{Offset}], "Resource at set ", Set, " offset ", Offset, " has already been initialized");
@@ -362,10 +375,12 @@ const ShaderResourceCacheVk::Resource& ShaderResourceCacheVk::SetResource(
     const VulkanUtilities::LogicalDevice* pLogicalDevice,
     Uint32                                DescrSetIndex,
     Uint32                                CacheOffset,
-    SetResourceInfo&&                     SrcRes)
+    SetResourceInfo&&                     SrcRes,
+    DescriptorWriteBatch*                 pWriteBatch)
 {
     DescriptorSet& DescrSet = GetDescriptorSet(DescrSetIndex);
     Resource&      DstRes   = DescrSet.GetResource(CacheOffset);
+    const bool     WasNull  = DstRes.IsNull();
 
     if (IsDynamicBuffer(DstRes))
     {
@@ -398,8 +413,16 @@ const ShaderResourceCacheVk::Resource& ShaderResourceCacheVk::SetResource(
         ++m_NumDynamicBuffers;
     }
 
+    if (DescrSetIndex == m_DescriptorInfoSet)
+        UpdateDescriptorInfo(CacheOffset, DstRes, WasNull);
+
     VkDescriptorSet vkSet = DescrSet.GetVkDescriptorSet();
-    if (vkSet != VK_NULL_HANDLE && DstRes.pObject)
+    if (vkSet != VK_NULL_HANDLE && DstRes.pObject && pWriteBatch != nullptr)
+    {
+        VERIFY(&pWriteBatch->GetResourceCache() == this, "The write batch belongs to another resource cache");
+        pWriteBatch->AddWrite(DescrSetIndex, CacheOffset, SrcRes.BindingIndex, SrcRes.ArrayIndex);
+    }
+    else if (vkSet != VK_NULL_HANDLE && DstRes.pObject)
     {
         VERIFY(pLogicalDevice != nullptr, "Logical device must not be null to write descriptor to a non-null set");
 
@@ -485,6 +508,134 @@ const ShaderResourceCacheVk::Resource& ShaderResourceCacheVk::SetResource(
     return DstRes;
 }
 
+void ShaderResourceCacheVk::DescriptorWriteBatch::Flush()
+{
+    if (m_Writes.empty())
+        return;
+
+    // Sort the writes so that consecutive array elements of the same binding are adjacent
+    std::sort(m_Writes.begin(), m_Writes.end());
+    m_Writes.erase(std::unique(m_Writes.begin(), m_Writes.end()), m_Writes.end());
+
+    const size_t NumWrites = m_Writes.size();
+
+    // Descriptor writes reference the elements of the info arrays, so the arrays must never be reallocated
+    std::vector<VkWriteDescriptorSet>                         vkWrites;
+    std::vector<VkDescriptorImageInfo>                        vkImageInfos;
+    std::vector<VkDescriptorBufferInfo>                       vkBufferInfos;
+    std::vector<VkBufferView>                                 vkBufferViews;
+    std::vector<VkWriteDescriptorSetAccelerationStructureKHR> vkAccelStructInfos;
+    vkWrites.reserve(NumWrites);
+    vkImageInfos.reserve(NumWrites);
+    vkBufferInfos.reserve(NumWrites);
+    vkBufferViews.reserve(NumWrites);
+
+    const PendingWrite* pPrevWrite = nullptr;
+    for (const PendingWrite& Write : m_Writes)
+    {
+        const DescriptorSet& DescrSet = m_ResourceCache.GetDescriptorSet(Write.DescrSetIndex);
+        const Resource&      Res      = DescrSet.GetResource(Write.CacheOffset);
+        if (!Res)
+        {
+            // The resource has been reset after the write was added
+            pPrevWrite = nullptr;
+            continue;
+        }
+
+        // Every acceleration structure write references a single VkWriteDescriptorSetAccelerationStructureKHR,
+        // so they are never combined.
+        const bool AppendToPrevWrite =
+            pPrevWrite != nullptr &&
+            pPrevWrite->DescrSetIndex == Write.DescrSetIndex &&
+            pPrevWrite->BindingIndex == Write.BindingIndex &&
+            pPrevWrite->ArrayIndex + 1 == Write.ArrayIndex &&
+            Res.Type != DescriptorType::AccelerationStructure;
+
+        if (!AppendToPrevWrite)
+        {
+            VkWriteDescriptorSet WriteDescrSet{};
+            WriteDescrSet.sType           = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+            WriteDescrSet.dstSet          = DescrSet.GetVkDescriptorSet();
+            WriteDescrSet.dstBinding      = Write.BindingIndex;
+            WriteDescrSet.dstArrayElement = Write.ArrayIndex;
+            WriteDescrSet.descriptorCount = 0;
+            WriteDescrSet.descriptorType  = DescriptorTypeToVkDescriptorType(Res.Type);
+            VERIFY_EXPR(WriteDescrSet.dstSet != VK_NULL_HANDLE);
+            vkWrites.push_back(WriteDescrSet);
+        }
+
+        VkWriteDescriptorSet& WriteDescrSet = vkWrites.back();
+        VERIFY_EXPR(WriteDescrSet.descriptorType == DescriptorTypeToVkDescriptorType(Res.Type));
+
+        static_assert(static_cast<Uint32>(DescriptorType::Count) == 16, "Please update the switch below to handle the new descriptor type");
+        switch (Res.Type)
+        {
+            case DescriptorType::Sampler:
+                vkImageInfos.push_back(Res.GetSamplerDescriptorWriteInfo());
+                if (WriteDescrSet.pImageInfo == nullptr)
+                    WriteDescrSet.pImageInfo = &vkImageInfos.back();
+                break;
+
+            case DescriptorType::CombinedImageSampler:
+            case DescriptorType::SeparateImage:
+            case DescriptorType::StorageImage:
+                vkImageInfos.push_back(Res.GetImageDescriptorWriteInfo());
+                if (WriteDescrSet.pImageInfo == nullptr)
+                    WriteDescrSet.pImageInfo = &vkImageInfos.back();
+                break;
+
+            case DescriptorType::UniformTexelBuffer:
+            case DescriptorType::StorageTexelBuffer:
+            case DescriptorType::StorageTexelBuffer_ReadOnly:
+                vkBufferViews.push_back(Res.GetBufferViewWriteInfo());
+                if (WriteDescrSet.pTexelBufferView == nullptr)
+                    WriteDescrSet.pTexelBufferView = &vkBufferViews.back();
+                break;
+
+            case DescriptorType::UniformBuffer:
+            case DescriptorType::UniformBufferDynamic:
+                vkBufferInfos.push_back(Res.GetUniformBufferDescriptorWriteInfo());
+                if (WriteDescrSet.pBufferInfo == nullptr)
+                    WriteDescrSet.pBufferInfo = &vkBufferInfos.back();
+                break;
+
+            case DescriptorType::StorageBuffer:
+            case DescriptorType::StorageBuffer_ReadOnly:
+            case DescriptorType::StorageBufferDynamic:
+            case DescriptorType::StorageBufferDynamic_ReadOnly:
+                vkBufferInfos.push_back(Res.GetStorageBufferDescriptorWriteInfo());
+                if (WriteDescrSet.pBufferInfo == nullptr)
+                    WriteDescrSet.pBufferInfo = &vkBufferInfos.back();
+                break;
+
+            case DescriptorType::InputAttachment:
+            case DescriptorType::InputAttachment_General:
+                vkImageInfos.push_back(Res.GetInputAttachmentDescriptorWriteInfo());
+                if (WriteDescrSet.pImageInfo == nullptr)
+                    WriteDescrSet.pImageInfo = &vkImageInfos.back();
+                break;
+
+            case DescriptorType::AccelerationStructure:
+                if (vkAccelStructInfos.capacity() == 0)
+                    vkAccelStructInfos.reserve(NumWrites);
+                vkAccelStructInfos.push_back(Res.GetAccelerationStructureWriteInfo());
+                WriteDescrSet.pNext = &vkAccelStructInfos.back();
+                break;
+
+            default:
+                UNEXPECTED("Unexpected descriptor type");
+        }
+        ++WriteDescrSet.descriptorCount;
+
+        pPrevWrite = &Write;
+    }
+
+    if (!vkWrites.empty())
+        m_LogicalDevice.UpdateDescriptorSets(static_cast<uint32_t>(vkWrites.size()), vkWrites.data(), 0, nullptr);
+
+    m_Writes.clear();
+}
+
 void ShaderResourceCacheVk::SetDynamicBufferOffset(Uint32 DescrSetIndex,
                                                    Uint32 CacheOffset,
                                                    Uint32 DynamicBufferOffset)
@@ -942,6 +1093,72 @@ VkWriteDescriptorSetAccelerationStructureKHR ShaderResourceCacheVk::Resource::Ge
 
 
 
+void ShaderResourceCacheVk::UpdateDescriptorInfo(Uint32 CacheOffset, const Resource& Res, bool WasNull)
+{
+    if (!Res.IsWritable())
+        return;
+
+    if (WasNull && !Res.IsNull())
+    {
+        VERIFY(m_NumNullDescriptorInfos > 0, "The number of null descriptor infos is out of sync");
+        --m_NumNullDescriptorInfos;
+    }
+    else if (!WasNull && Res.IsNull())
+    {
+        ++m_NumNullDescriptorInfos;
+    }
+
+    if (Res.IsNull())
+        return;
+
+    VERIFY_EXPR(CacheOffset < GetNumDescriptorInfos());
+    DescriptorInfo& Info = GetFirstDescriptorInfoPtr()[CacheOffset];
+
+    static_assert(static_cast<Uint32>(DescriptorType::Count) == 16, "Please update the switch below to handle the new descriptor type");
+    switch (Res.Type)
+    {
+        case DescriptorType::UniformBuffer:
+        case DescriptorType::UniformBufferDynamic:
+            Info.BufferInfo = Res.GetUniformBufferDescriptorWriteInfo();
+            break;
+
+        case DescriptorType::StorageBuffer:
+        case DescriptorType::StorageBufferDynamic:
+        case DescriptorType::StorageBuffer_ReadOnly:
+        case DescriptorType::StorageBufferDynamic_ReadOnly:
+            Info.BufferInfo = Res.GetStorageBufferDescriptorWriteInfo();
+            break;
+
+        case DescriptorType::UniformTexelBuffer:
+        case DescriptorType::StorageTexelBuffer:
+        case DescriptorType::StorageTexelBuffer_ReadOnly:
+            Info.TexelBufferView = Res.GetBufferViewWriteInfo();
+            break;
+
+        case DescriptorType::CombinedImageSampler:
+        case DescriptorType::SeparateImage:
+        case DescriptorType::StorageImage:
+            Info.ImageInfo = Res.GetImageDescriptorWriteInfo();
+            break;
+
+        case DescriptorType::InputAttachment:
+        case DescriptorType::InputAttachment_General:
+            Info.ImageInfo = Res.GetInputAttachmentDescriptorWriteInfo();
+            break;
+
+        case DescriptorType::Sampler:
+            Info.ImageInfo = Res.GetSamplerDescriptorWriteInfo();
+            break;
+
+        case DescriptorType::AccelerationStructure:
+            Info.AccelStruct = *Res.GetAccelerationStructureWriteInfo().pAccelerationStructures;
+            break;
+
+        default:
+            UNEXPECTED("Unexpected resource type");
+    }
+}
+
 ShaderResourceCacheVk::WriteDynamicBufferOffsetsResult ShaderResourceCacheVk::WriteDynamicBufferOffsets(
     DeviceContextVkImpl*   pCtx,
     std::vector<uint32_t>& Offsets,
@@ -231,10 +231,11 @@ inline TEXTURE_VIEW_TYPE DvpDescriptorTypeToTextureView(DescriptorType Type)
 
 struct BindResourceHelper
 {
-    BindResourceHelper(const PipelineResourceSignatureVkImpl& Signature,
-                       ShaderResourceCacheVk&                 ResourceCache,
-                       Uint32                                 ResIndex,
-                       Uint32                                 ArrayIndex);
+    BindResourceHelper(const PipelineResourceSignatureVkImpl&       Signature,
+                       ShaderResourceCacheVk&                       ResourceCache,
+                       Uint32                                       ResIndex,
+                       Uint32                                       ArrayIndex,
+                       ShaderResourceCacheVk::DescriptorWriteBatch* pWriteBatch);
 
     void operator()(const BindResourceInfo& BindInfo) const;
 
@@ -268,12 +269,15 @@ private:
     const Uint32                           m_DstResCacheOffset;
     const CachedSet&                       m_CachedSet;
     const ShaderResourceCacheVk::Resource& m_DstRes;
+
+    ShaderResourceCacheVk::DescriptorWriteBatch* const m_pWriteBatch;
 };
 
-BindResourceHelper::BindResourceHelper(const PipelineResourceSignatureVkImpl& Signature,
-                                       ShaderResourceCacheVk&                 ResourceCache,
-                                       Uint32                                 ResIndex,
-                                       Uint32                                 ArrayIndex) :
+BindResourceHelper::BindResourceHelper(const PipelineResourceSignatureVkImpl&       Signature,
+                                       ShaderResourceCacheVk&                       ResourceCache,
+                                       Uint32                                       ResIndex,
+                                       Uint32                                       ArrayIndex,
+                                       ShaderResourceCacheVk::DescriptorWriteBatch* pWriteBatch) :
     // clang-format off
     m_Signature         {Signature},
     m_ResourceCache     {ResourceCache},
@@ -283,7 +287,8 @@ BindResourceHelper::BindResourceHelper(const PipelineResourceSignatureVkImpl& Si
     m_Attribs           {Signature.GetResourceAttribs(ResIndex)},
     m_DstResCacheOffset {m_Attribs.CacheOffset(m_CacheType) + ArrayIndex},
     m_CachedSet         {const_cast<const ShaderResourceCacheVk&>(ResourceCache).GetDescriptorSet(m_Attribs.DescrSet)},
-    m_DstRes            {m_CachedSet.GetResource(m_DstResCacheOffset)}
+    m_DstRes            {m_CachedSet.GetResource(m_DstResCacheOffset)},
+    m_pWriteBatch       {pWriteBatch}
 // clang-format on
 {
     // For inline constants, GetArraySize() returns 1 (actual array size), while ArraySize is the number of constants
@@ -415,7 +420,8 @@ bool BindResourceHelper::UpdateCachedResource(RefCntAutoPtr<ObjectType>&& pObjec
                                         std::move(pObject),
                                         BufferBaseOffset,
                                         BufferRangeSize //
-                                    });
+                                    },
+                                    m_pWriteBatch);
         return true;
     }
     else
@@ -561,7 +567,8 @@ void BindResourceHelper::CacheImage(const BindResourceInfo& BindInfo) const
                         m_Signature,
                         m_ResourceCache,
                         m_Attribs.SamplerInd,
-                        SamplerResDesc.ArraySize == 1 ? 0 : m_ArrayIndex};
+                        SamplerResDesc.ArraySize == 1 ? 0 : m_ArrayIndex,
+                        m_pWriteBatch};
                     BindSeparateSampler(BindResourceInfo{BindSeparateSampler.m_ArrayIndex, pSampler, BindInfo.Flags});
                 }
                 else
@@ -623,13 +630,16 @@ void BindResourceHelper::CacheAccelerationStructure(const BindResourceInfo& Bind
 } // namespace
 
 
-void ShaderVariableManagerVk::BindResource(Uint32 ResIndex, const BindResourceInfo& BindInfo)
+void ShaderVariableManagerVk::BindResource(Uint32                                       ResIndex,
+                                           const BindResourceInfo&                      BindInfo,
+                                           ShaderResourceCacheVk::DescriptorWriteBatch* pWriteBatch)
 {
     BindResourceHelper BindHelper{
         *m_pSignature,
         m_ResourceCache,
         ResIndex,
-        BindInfo.ArrayIndex};
+        BindInfo.ArrayIndex,
+        pWriteBatch};
 
     BindHelper(BindInfo);
 }
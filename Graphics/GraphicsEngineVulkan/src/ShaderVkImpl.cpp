@@ -237,6 +237,8 @@ void ShaderVkImpl::Initialize(const ShaderCreateInfo& ShaderCI,
     {
         if ((ShaderCI.CompileFlags & SHADER_COMPILE_FLAG_SKIP_REFLECTION) == 0)
         {
+            DILIGENT_CPU_PROFILE_ZONE("LoadSPIRVShaderResources", "Reflection");
+
             SPIRVShaderResources::CreateInfo ResCI;
             ResCI.ShaderType                  = m_Desc.ShaderType;
             ResCI.Name                        = m_Desc.Name;
@@ -283,7 +283,8 @@ TextureVkImpl::TextureVkImpl(IReferenceCounters*        pRefCounters,
 
             const VkMemoryPropertyFlags ImageMemoryFlags = IsMemoryless ? VK_MEMORY_PROPERTY_LAZILY_ALLOCATED_BIT : VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
             VERIFY(IsPowerOfTwo(MemReqs.alignment), "Alignment is not power of 2!");
-            m_MemoryAllocation = pRenderDeviceVk->AllocateMemory(MemReqs, ImageMemoryFlags);
+            // Large images are placed into dedicated memory bound to this image only
+            m_MemoryAllocation = pRenderDeviceVk->AllocateMemory(MemReqs, ImageMemoryFlags, 0, m_VulkanImage);
             if (!m_MemoryAllocation)
                 LOG_ERROR_AND_THROW("Failed to allocate memory for texture '", m_Desc.Name, "'.");
 
@@ -419,34 +420,13 @@ void TextureVkImpl::InitializeContentOnDevice(const TextureData&          InitDa
                                               const TextureFormatAttribs& FmtAttribs,
                                               const VkImageCreateInfo&    ImageCI) noexcept(false)
 {
-    const VulkanUtilities::LogicalDevice& LogicalDevice = GetDevice()->GetLogicalDevice();
-
     const SoftwareQueueIndex CmdQueueInd = InitData.pContext ?
         ClassPtrCast<DeviceContextVkImpl>(InitData.pContext)->GetCommandQueueId() :
         SoftwareQueueIndex{PlatformMisc::GetLSB(m_Desc.ImmediateContextMask)};
 
-    // Vulkan validation layers do not like uninitialized memory, so if no initial data
-    // is provided, we will clear the memory
-
-    VulkanUtilities::CommandPoolWrapper CmdPool;
-    VulkanUtilities::CommandBuffer      CmdBuffer;
-    GetDevice()->AllocateTransientCmdPool(CmdQueueInd, CmdPool, CmdBuffer, "Transient command pool to copy staging data to a device buffer");
-
     VERIFY(FmtAttribs.ComponentType != COMPONENT_TYPE_DEPTH_STENCIL, "Initializing depth-stencil texture is currently not supported.");
     const VkImageAspectFlags aspectMask = ComponentTypeToVkAspectMask(FmtAttribs.ComponentType);
 
-    // For either clear or copy command, dst layout must be VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL
-    VkImageSubresourceRange SubresRange;
-    SubresRange.aspectMask     = aspectMask;
-    SubresRange.baseArrayLayer = 0;
-    SubresRange.layerCount     = VK_REMAINING_ARRAY_LAYERS;
-    SubresRange.baseMipLevel   = 0;
-    SubresRange.levelCount     = VK_REMAINING_MIP_LEVELS;
-    CmdBuffer.TransitionImageLayout(m_VulkanImage, ImageCI.initialLayout, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, SubresRange, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT);
-    SetState(RESOURCE_STATE_COPY_DEST);
-    const VkImageLayout CurrentLayout = GetLayout();
-    VERIFY_EXPR(CurrentLayout == VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
-
     Uint32 ExpectedNumSubresources = ImageCI.mipLevels * ImageCI.arrayLayers;
     if (InitData.NumSubresources != ExpectedNumSubresources)
         LOG_ERROR_AND_THROW("Incorrect number of subresources in init data. ", ExpectedNumSubresources, " expected, while ", InitData.NumSubresources, " provided");
@@ -465,7 +445,7 @@ void TextureVkImpl::InitializeContentOnDevice(const TextureData&          InitDa
 
             MipLevelProperties MipInfo = GetMipLevelProperties(m_Desc, mip);
 
-            CopyRegion.bufferOffset = uploadBufferSize; // offset in bytes from the start of the buffer object
+            CopyRegion.bufferOffset = uploadBufferSize; // offset in bytes from the start of the staging region
             // bufferRowLength and bufferImageHeight specify the data in buffer memory as a subregion
             // of a larger two- or three-dimensional image, and control the addressing calculations of
             // data in buffer memory. If either of these values is zero, that aspect of the buffer memory
@@ -495,90 +475,70 @@ void TextureVkImpl::InitializeContentOnDevice(const TextureData&          InitDa
     }
     VERIFY_EXPR(subres == InitData.NumSubresources);
 
-    VkBufferCreateInfo VkStagingBuffCI    = {};
-    VkStagingBuffCI.sType                 = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
-    VkStagingBuffCI.pNext                 = nullptr;
-    VkStagingBuffCI.flags                 = 0;
-    VkStagingBuffCI.size                  = uploadBufferSize;
-    VkStagingBuffCI.usage                 = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
-    VkStagingBuffCI.sharingMode           = VK_SHARING_MODE_EXCLUSIVE;
-    VkStagingBuffCI.queueFamilyIndexCount = 0;
-    VkStagingBuffCI.pQueueFamilyIndices   = nullptr;
-
-    std::string StagingBufferName = "Upload buffer for '";
-    StagingBufferName += m_Desc.Name;
-    StagingBufferName += '\'';
-    VulkanUtilities::BufferWrapper StagingBuffer = LogicalDevice.CreateBuffer(VkStagingBuffCI, StagingBufferName.c_str());
-
-    VkMemoryRequirements StagingBufferMemReqs = LogicalDevice.GetBufferMemoryRequirements(StagingBuffer);
-    VERIFY(IsPowerOfTwo(StagingBufferMemReqs.alignment), "Alignment is not power of 2!");
-    // VK_MEMORY_PROPERTY_HOST_COHERENT_BIT bit specifies that the host cache management commands vkFlushMappedMemoryRanges
-    // and vkInvalidateMappedMemoryRanges are NOT needed to flush host writes to the device or make device writes visible
-    // to the host (10.2)
-    VulkanUtilities::MemoryAllocation StagingMemoryAllocation = GetDevice()->AllocateMemory(StagingBufferMemReqs, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
-    if (!StagingMemoryAllocation)
-        LOG_ERROR_AND_THROW("Failed to allocate staging memory for texture '", m_Desc.Name, "'.");
-
-    VkDeviceMemory StagingBufferMemory     = StagingMemoryAllocation.Page->GetVkMemory();
-    VkDeviceSize   AlignedStagingMemOffset = AlignUp(StagingMemoryAllocation.UnalignedOffset, StagingBufferMemReqs.alignment);
-    VERIFY_EXPR(StagingMemoryAllocation.Size >= StagingBufferMemReqs.size + (AlignedStagingMemOffset - StagingMemoryAllocation.UnalignedOffset));
-
-    uint8_t* StagingData = reinterpret_cast<uint8_t*>(StagingMemoryAllocation.Page->GetCPUMemory());
-    VERIFY_EXPR(StagingData != nullptr);
-    StagingData += AlignedStagingMemOffset;
-
-    subres = 0;
-    for (Uint32 layer = 0; layer < ImageCI.arrayLayers; ++layer)
-    {
-        for (Uint32 mip = 0; mip < ImageCI.mipLevels; ++mip)
+    // The staging region offset must be a multiple of 4 and of the texel block size,
+    // so that all buffer offsets computed above remain properly aligned.
+    VkDeviceSize RegionAlignment = std::max(VkDeviceSize{FmtAttribs.GetElementSize()}, VkDeviceSize{1});
+    while (RegionAlignment % 4 != 0)
+        RegionAlignment *= 2;
+
+    // The data is copied to the staging memory of the command queue batch. The batch
+    // is submitted before any other command buffer is submitted to the same queue, and
+    // the staging memory is released once the batch is complete.
+    GetDevice()->GetInitialDataUploadManager().Upload(
+        CmdQueueInd, uploadBufferSize, RegionAlignment,
+        [&](const InitialDataUploadManagerVk::StagingRegion& Region) //
         {
-            const TextureSubResData& SubResData = InitData.pSubResources[subres];
-            const VkBufferImageCopy& CopyRegion = Regions[subres];
-
-            MipLevelProperties MipInfo = GetMipLevelProperties(m_Desc, mip);
-
-            VERIFY_EXPR(MipInfo.LogicalWidth == CopyRegion.imageExtent.width);
-            VERIFY_EXPR(MipInfo.LogicalHeight == CopyRegion.imageExtent.height);
-            VERIFY_EXPR(MipInfo.Depth == CopyRegion.imageExtent.depth);
-
-            VERIFY(SubResData.Stride == 0 || SubResData.Stride >= MipInfo.RowSize, "Stride is too small");
-            // For compressed-block formats, MipInfo.RowSize is the size of one row of blocks
-            VERIFY(SubResData.DepthStride == 0 || SubResData.DepthStride >= (MipInfo.StorageHeight / FmtAttribs.BlockHeight) * MipInfo.RowSize, "Depth stride is too small");
-
-            for (Uint32 z = 0; z < MipInfo.Depth; ++z)
+            // For either clear or copy command, dst layout must be VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL
+            VkImageSubresourceRange SubresRange;
+            SubresRange.aspectMask     = aspectMask;
+            SubresRange.baseArrayLayer = 0;
+            SubresRange.layerCount     = VK_REMAINING_ARRAY_LAYERS;
+            SubresRange.baseMipLevel   = 0;
+            SubresRange.levelCount     = VK_REMAINING_MIP_LEVELS;
+            Region.CmdBuffer.TransitionImageLayout(m_VulkanImage, ImageCI.initialLayout, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, SubresRange, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT);
+            SetState(RESOURCE_STATE_COPY_DEST);
+            const VkImageLayout CurrentLayout = GetLayout();
+            VERIFY_EXPR(CurrentLayout == VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+
+            subres = 0;
+            for (Uint32 layer = 0; layer < ImageCI.arrayLayers; ++layer)
             {
-                for (Uint32 y = 0; y < MipInfo.StorageHeight; y += FmtAttribs.BlockHeight)
+                for (Uint32 mip = 0; mip < ImageCI.mipLevels; ++mip)
                 {
-                    memcpy(StagingData + CopyRegion.bufferOffset + ((y + z * MipInfo.StorageHeight) / FmtAttribs.BlockHeight) * MipInfo.RowSize,
-                           // SubResData.Stride must be the stride of one row of compressed blocks
-                           reinterpret_cast<const uint8_t*>(SubResData.pData) + (y / FmtAttribs.BlockHeight) * SubResData.Stride + z * SubResData.DepthStride,
-                           StaticCast<size_t>(MipInfo.RowSize));
+                    const TextureSubResData& SubResData = InitData.pSubResources[subres];
+                    VkBufferImageCopy&       CopyRegion = Regions[subres];
+
+                    MipLevelProperties MipInfo = GetMipLevelProperties(m_Desc, mip);
+
+                    VERIFY_EXPR(MipInfo.LogicalWidth == CopyRegion.imageExtent.width);
+                    VERIFY_EXPR(MipInfo.LogicalHeight == CopyRegion.imageExtent.height);
+                    VERIFY_EXPR(MipInfo.Depth == CopyRegion.imageExtent.depth);
+
+                    for (Uint32 z = 0; z < MipInfo.Depth; ++z)
+                    {
+                        for (Uint32 y = 0; y < MipInfo.StorageHeight; y += FmtAttribs.BlockHeight)
+                        {
+                            memcpy(Region.pData + CopyRegion.bufferOffset + ((y + z * MipInfo.StorageHeight) / FmtAttribs.BlockHeight) * MipInfo.RowSize,
+                                   // SubResData.Stride must be the stride of one row of compressed blocks
+                                   reinterpret_cast<const uint8_t*>(SubResData.pData) + (y / FmtAttribs.BlockHeight) * SubResData.Stride + z * SubResData.DepthStride,
+                                   StaticCast<size_t>(MipInfo.RowSize));
+                        }
+                    }
+
+                    // Make the offset relative to the start of the staging buffer
+                    CopyRegion.bufferOffset += Region.Offset;
+
+                    ++subres;
                 }
             }
-
-            ++subres;
-        }
-    }
-    VERIFY_EXPR(subres == InitData.NumSubresources);
-
-    VkResult err = LogicalDevice.BindBufferMemory(StagingBuffer, StagingBufferMemory, AlignedStagingMemOffset);
-    CHECK_VK_ERROR_AND_THROW(err, "Failed to bind staging buffer memory");
-
-    CmdBuffer.MemoryBarrier(VK_ACCESS_HOST_WRITE_BIT, VK_ACCESS_TRANSFER_READ_BIT, VK_PIPELINE_STAGE_HOST_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT);
-
-    // Copy commands MUST be recorded outside of a render pass instance. This is OK here
-    // as copy will be the only command in the cmd buffer
-    CmdBuffer.CopyBufferToImage(StagingBuffer, m_VulkanImage,
-                                CurrentLayout, // dstImageLayout must be VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL or VK_IMAGE_LAYOUT_GENERAL
-                                static_cast<uint32_t>(Regions.size()), Regions.data());
-
-    GetDevice()->ExecuteAndDisposeTransientCmdBuff(CmdQueueInd, CmdBuffer.GetVkCmdBuffer(), std::move(CmdPool));
-
-    // After command buffer is submitted, safe-release resources. This strategy
-    // is little overconservative as the resources will be released after the first
-    // command buffer submitted through the immediate context will be completed
-    GetDevice()->SafeReleaseDeviceObject(std::move(StagingBuffer), Uint64{1} << Uint64{CmdQueueInd});
-    GetDevice()->SafeReleaseDeviceObject(std::move(StagingMemoryAllocation), Uint64{1} << Uint64{CmdQueueInd});
+            VERIFY_EXPR(subres == InitData.NumSubresources);
+
+            // Copy commands MUST be recorded outside of a render pass instance. This is OK here
+            // as the batch command buffer only contains copy commands
+            Region.CmdBuffer.CopyBufferToImage(Region.vkBuffer, m_VulkanImage,
+                                               CurrentLayout, // dstImageLayout must be VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL or VK_IMAGE_LAYOUT_GENERAL
+                                               static_cast<uint32_t>(Regions.size()), Regions.data());
+        });
 }
 
 void TextureVkImpl::CreateStagingTexture(const TextureData* pInitData, const TextureFormatAttribs& FmtAttribs)
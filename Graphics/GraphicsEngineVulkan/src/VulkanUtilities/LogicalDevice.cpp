@@ -432,12 +432,44 @@ VkDescriptorSet LogicalDevice::AllocateVkDescriptorSet(const VkDescriptorSetAllo
     return DescrSet;
 }
 
+VkResult LogicalDevice::AllocateVkDescriptorSets(const VkDescriptorSetAllocateInfo& AllocInfo, VkDescriptorSet* pSets, const char* DebugName) const
+{
+    VERIFY_EXPR(AllocInfo.sType == VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO);
+    VERIFY_EXPR(AllocInfo.descriptorSetCount > 0 && pSets != nullptr);
+
+    if (DebugName == nullptr)
+        DebugName = "";
+
+    VkResult err = vkAllocateDescriptorSets(m_VkDevice, &AllocInfo, pSets);
+    if (err != VK_SUCCESS)
+        return err;
+
+    if (*DebugName != 0)
+    {
+        for (uint32_t i = 0; i < AllocInfo.descriptorSetCount; ++i)
+            SetDescriptorSetName(m_VkDevice, pSets[i], DebugName);
+    }
+
+    return VK_SUCCESS;
+}
+
 PipelineCacheWrapper LogicalDevice::CreatePipelineCache(const VkPipelineCacheCreateInfo& CI, const char* DebugName) const
 {
     VERIFY_EXPR(CI.sType == VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO);
     return CreateVulkanObject<VkPipelineCache, VulkanHandleTypeId::PipelineCache>(vkCreatePipelineCache, CI, DebugName, "pipeline cache");
 }
 
+DescriptorUpdateTemplateWrapper LogicalDevice::CreateDescriptorUpdateTemplate(const VkDescriptorUpdateTemplateCreateInfo& CI, const char* DebugName) const
+{
+#if DILIGENT_USE_VOLK
+    VERIFY_EXPR(CI.sType == VK_STRUCTURE_TYPE_DESCRIPTOR_UPDATE_TEMPLATE_CREATE_INFO);
+    return CreateVulkanObject<VkDescriptorUpdateTemplate, VulkanHandleTypeId::DescriptorUpdateTemplate>(vkCreateDescriptorUpdateTemplate, CI, DebugName, "descriptor update template");
+#else
+    UNSUPPORTED("vkCreateDescriptorUpdateTemplate is only available through Volk");
+    return DescriptorUpdateTemplateWrapper{};
+#endif
+}
+
 void LogicalDevice::ReleaseVulkanObject(CommandPoolWrapper&& CmdPool) const
 {
     vkDestroyCommandPool(m_VkDevice, CmdPool.m_VkObject, m_VkAllocator);
@@ -556,10 +588,20 @@ void LogicalDevice::ReleaseVulkanObject(PipelineCacheWrapper&& PipeCache) const
     PipeCache.m_VkObject = VK_NULL_HANDLE;
 }
 
-void LogicalDevice::FreeDescriptorSet(VkDescriptorPool Pool, VkDescriptorSet Set) const
+void LogicalDevice::ReleaseVulkanObject(DescriptorUpdateTemplateWrapper&& UpdateTemplate) const
+{
+#if DILIGENT_USE_VOLK
+    vkDestroyDescriptorUpdateTemplate(m_VkDevice, UpdateTemplate.m_VkObject, m_VkAllocator);
+    UpdateTemplate.m_VkObject = VK_NULL_HANDLE;
+#else
+    UNSUPPORTED("vkDestroyDescriptorUpdateTemplate is only available through Volk");
+#endif
+}
+
+void LogicalDevice::FreeDescriptorSets(VkDescriptorPool Pool, uint32_t NumSets, const VkDescriptorSet* pSets) const
 {
-    VERIFY_EXPR(Pool != VK_NULL_HANDLE && Set != VK_NULL_HANDLE);
-    vkFreeDescriptorSets(m_VkDevice, Pool, 1, &Set);
+    VERIFY_EXPR(Pool != VK_NULL_HANDLE && NumSets > 0 && pSets != nullptr);
+    vkFreeDescriptorSets(m_VkDevice, Pool, NumSets, pSets);
 }
 
 
@@ -698,6 +740,17 @@ void LogicalDevice::UpdateDescriptorSets(uint32_t                    descriptorW
     vkUpdateDescriptorSets(m_VkDevice, descriptorWriteCount, pDescriptorWrites, descriptorCopyCount, pDescriptorCopies);
 }
 
+void LogicalDevice::UpdateDescriptorSetWithTemplate(VkDescriptorSet            descriptorSet,
+                                                    VkDescriptorUpdateTemplate descriptorUpdateTemplate,
+                                                    const void*                pData) const
+{
+#if DILIGENT_USE_VOLK
+    vkUpdateDescriptorSetWithTemplate(m_VkDevice, descriptorSet, descriptorUpdateTemplate, pData);
+#else
+    UNSUPPORTED("vkUpdateDescriptorSetWithTemplate is only available through Volk");
+#endif
+}
+
 VkResult LogicalDevice::ResetCommandPool(VkCommandPool           vkCmdPool,
                                          VkCommandPoolResetFlags flags) const
 {
@@ -40,37 +40,70 @@ MemoryAllocation::~MemoryAllocation()
     }
 }
 
+static Diligent::TLSFAllocationsManager::CreateInfo GetPageAllocationMgrCI(Diligent::IMemoryAllocator& Allocator, VkDeviceSize PageSize)
+{
+    Diligent::TLSFAllocationsManager::CreateInfo CI{Allocator};
+    // Dedicated pages have the exact size of the resource that may not be a multiple of the minimal alignment.
+    // The range is rounded up, which is safe as the page contains a single allocation at offset 0.
+    CI.MaxSize = static_cast<Diligent::TLSFAllocationsManager::OffsetType>(Diligent::AlignUp(PageSize, VkDeviceSize{CI.MinAlignment}));
+    return CI;
+}
+
 MemoryPage::MemoryPage(MemoryManager&        ParentMemoryMgr,
                        VkDeviceSize          PageSize,
                        uint32_t              MemoryTypeIndex,
                        bool                  IsHostVisible,
-                       VkMemoryAllocateFlags AllocateFlags) :
+                       VkMemoryAllocateFlags AllocateFlags,
+                       bool                  IsDedicated,
+                       VkImage               DedicatedImage) :
     // clang-format off
     m_ParentMemoryMgr{ParentMemoryMgr},
-    m_AllocationMgr  {static_cast<AllocationsMgrOffsetType>(PageSize), ParentMemoryMgr.m_Allocator}
+    m_AllocationMgr  {GetPageAllocationMgrCI(ParentMemoryMgr.m_Allocator, PageSize)},
+    m_PageSize       {PageSize       },
+    m_MemoryTypeIndex{MemoryTypeIndex},
+    m_AllocateFlags  {AllocateFlags  },
+    m_IsDedicated    {IsDedicated    }
 // clang-format on
 {
     VERIFY(PageSize <= std::numeric_limits<AllocationsMgrOffsetType>::max(),
            "PageSize (", PageSize, ") exceeds maximum allowed value ",
            std::numeric_limits<AllocationsMgrOffsetType>::max());
+    VERIFY(DedicatedImage == VK_NULL_HANDLE || IsDedicated, "Dedicated image can only be used with dedicated pages");
 
-    VkMemoryAllocateInfo      MemAlloc    = {};
-    VkMemoryAllocateFlagsInfo MemFlagInfo = {};
+    VkMemoryAllocateInfo          MemAlloc           = {};
+    VkMemoryAllocateFlagsInfo     MemFlagInfo        = {};
+    VkMemoryDedicatedAllocateInfo DedicatedAllocInfo = {};
 
     MemAlloc.pNext           = nullptr;
     MemAlloc.sType           = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
     MemAlloc.allocationSize  = PageSize;
     MemAlloc.memoryTypeIndex = MemoryTypeIndex;
 
+    const void** NextInfo = &MemAlloc.pNext;
     if (AllocateFlags)
     {
-        MemAlloc.pNext    = &MemFlagInfo;
         MemFlagInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_FLAGS_INFO;
         MemFlagInfo.pNext = nullptr;
         MemFlagInfo.flags = AllocateFlags;
+
+        *NextInfo = &MemFlagInfo;
+        NextInfo  = &MemFlagInfo.pNext;
+    }
+
+    if (DedicatedImage != VK_NULL_HANDLE)
+    {
+        // allocationSize must be equal to the image memory requirements size (11.7.4)
+        DedicatedAllocInfo.sType  = VK_STRUCTURE_TYPE_MEMORY_DEDICATED_ALLOCATE_INFO;
+        DedicatedAllocInfo.pNext  = nullptr;
+        DedicatedAllocInfo.image  = DedicatedImage;
+        DedicatedAllocInfo.buffer = VK_NULL_HANDLE;
+
+        *NextInfo = &DedicatedAllocInfo;
+        NextInfo  = &DedicatedAllocInfo.pNext;
     }
 
-    std::string MemoryName = Diligent::FormatString("Device memory page. Size: ", Diligent::FormatMemorySize(PageSize, 2), ", type: ", MemoryTypeIndex);
+    std::string MemoryName = Diligent::FormatString(IsDedicated ? "Dedicated device memory page. Size: " : "Device memory page. Size: ",
+                                                    Diligent::FormatMemorySize(PageSize, 2), ", type: ", MemoryTypeIndex);
     m_VkMemory             = ParentMemoryMgr.m_LogicalDevice.AllocateDeviceMemory(MemAlloc, MemoryName.c_str());
 
     if (IsHostVisible)
@@ -83,6 +116,9 @@ MemoryPage::MemoryPage(MemoryManager&        ParentMemoryMgr,
             &m_CPUMemory);
         CHECK_VK_ERROR_AND_THROW(err, "Failed to map staging memory");
     }
+
+    // The page is empty until the first allocation
+    GetEmptyPageCounter().fetch_add(1);
 }
 
 MemoryPage::~MemoryPage()
@@ -94,6 +130,8 @@ MemoryPage::~MemoryPage()
     }
 
     VERIFY(IsEmpty(), "Destroying a page with not all allocations released");
+    if (IsEmpty())
+        GetEmptyPageCounter().fetch_sub(1);
 }
 
 MemoryAllocation MemoryPage::Allocate(VkDeviceSize size, VkDeviceSize alignment)
@@ -102,13 +140,16 @@ MemoryAllocation MemoryPage::Allocate(VkDeviceSize size, VkDeviceSize alignment)
     VERIFY(size <= std::numeric_limits<AllocationsMgrOffsetType>::max(),
            "Allocation size (", size, ") exceeds maximum allowed value ",
            std::numeric_limits<AllocationsMgrOffsetType>::max());
-    Diligent::VariableSizeAllocationsManager::Allocation Allocation =
+    const bool WasEmpty = m_AllocationMgr.IsEmpty();
+    Diligent::TLSFAllocationsManager::Allocation Allocation =
         m_AllocationMgr.Allocate(static_cast<AllocationsMgrOffsetType>(size), static_cast<AllocationsMgrOffsetType>(alignment));
     if (Allocation.IsValid())
     {
-        // Offset may not necessarily be aligned, but the allocation is guaranteed to be large enough
-        // to accommodate requested alignment
-        VERIFY_EXPR(Diligent::AlignUp(VkDeviceSize{Allocation.UnalignedOffset}, alignment) - Allocation.UnalignedOffset + size <= Allocation.Size);
+        if (WasEmpty)
+            GetEmptyPageCounter().fetch_sub(1);
+
+        // TLSF allocations manager always returns aligned offsets
+        VERIFY_EXPR((Allocation.UnalignedOffset % alignment) == 0 && size <= Allocation.Size);
         return MemoryAllocation{this, Allocation.UnalignedOffset, Allocation.Size};
     }
     else
@@ -125,9 +166,45 @@ void MemoryPage::Free(MemoryAllocation&& Allocation)
     VERIFY_EXPR(Allocation.Size <= std::numeric_limits<AllocationsMgrOffsetType>::max());
     m_AllocationMgr.Free(static_cast<AllocationsMgrOffsetType>(Allocation.UnalignedOffset), static_cast<AllocationsMgrOffsetType>(Allocation.Size));
     Allocation = MemoryAllocation{};
+    if (m_AllocationMgr.IsEmpty())
+        GetEmptyPageCounter().fetch_add(1);
+}
+
+std::atomic<uint32_t>& MemoryPage::GetEmptyPageCounter() const
+{
+    return m_IsDedicated ? m_ParentMemoryMgr.m_NumEmptyDedicatedPages : m_ParentMemoryMgr.m_NumEmptySuballocatedPages;
+}
+
+MemoryPage::Stats MemoryPage::GetStats() const
+{
+    std::lock_guard<std::mutex> Lock{m_Mutex};
+
+    Stats PageStats;
+    PageStats.UsedSize         = m_AllocationMgr.GetUsedSize();
+    PageStats.MaxFreeBlockSize = m_AllocationMgr.GetMaxFreeBlockSize();
+    PageStats.NumFreeBlocks    = m_AllocationMgr.GetNumFreeBlocks();
+    PageStats.NumAllocations   = m_AllocationMgr.GetNumAllocations();
+    return PageStats;
+}
+
+static void UpdatePeakValue(std::atomic<VkDeviceSize>& Peak, VkDeviceSize Value)
+{
+    VkDeviceSize CurrPeak = Peak.load();
+    while (CurrPeak < Value && !Peak.compare_exchange_weak(CurrPeak, Value))
+    {
+    }
+}
+
+size_t MemoryManager::GetThreadBucket()
+{
+    // Assign buckets to threads in round-robin order. Thread ids are not suitable
+    // for this purpose as their hashes may have poor distribution of low bits.
+    static std::atomic<size_t> NextBucket{0};
+    thread_local const size_t  ThreadBucket = NextBucket.fetch_add(1) % NumThreadBuckets;
+    return ThreadBucket;
 }
 
-MemoryAllocation MemoryManager::Allocate(const VkMemoryRequirements& MemReqs, VkMemoryPropertyFlags MemoryProps, VkMemoryAllocateFlags AllocateFlags)
+MemoryAllocation MemoryManager::Allocate(const VkMemoryRequirements& MemReqs, VkMemoryPropertyFlags MemoryProps, VkMemoryAllocateFlags AllocateFlags, VkImage DedicatedImage)
 {
     // memoryTypeBits is a bitmask and contains one bit set for every supported memory type for the resource.
     // Bit i is set if the memory type i in the VkPhysicalDeviceMemoryProperties structure for the
@@ -156,87 +233,245 @@ MemoryAllocation MemoryManager::Allocate(const VkMemoryRequirements& MemReqs, Vk
     }
 
     bool HostVisible = (MemoryProps & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) != 0;
-    return Allocate(MemReqs.size, MemReqs.alignment, MemoryTypeIndex, HostVisible, AllocateFlags);
+    return Allocate(MemReqs.size, MemReqs.alignment, MemoryTypeIndex, HostVisible, AllocateFlags, DedicatedImage);
 }
 
-MemoryAllocation MemoryManager::Allocate(VkDeviceSize Size, VkDeviceSize Alignment, uint32_t MemoryTypeIndex, bool HostVisible, VkMemoryAllocateFlags AllocateFlags)
+MemoryAllocation MemoryManager::AllocateFromBucket(PageBucket& Bucket, VkDeviceSize Size, VkDeviceSize Alignment, VkMemoryAllocateFlags AllocateFlags)
 {
-    MemoryAllocation Allocation;
+    std::lock_guard<std::mutex> Lock{Bucket.Mtx};
+    for (std::unique_ptr<MemoryPage>& pPage : Bucket.Pages)
+    {
+        if (pPage->IsDedicated() || pPage->GetAllocateFlags() != AllocateFlags)
+            continue;
+
+        MemoryAllocation Allocation = pPage->Allocate(Size, Alignment);
+        if (Allocation.Page != nullptr)
+            return Allocation;
+    }
+    return MemoryAllocation{};
+}
+
+MemoryAllocation MemoryManager::AllocateFromNewPage(PageBucket&           Bucket,
+                                                    VkDeviceSize          Size,
+                                                    VkDeviceSize          Alignment,
+                                                    uint32_t              MemoryTypeIndex,
+                                                    bool                  HostVisible,
+                                                    VkMemoryAllocateFlags AllocateFlags,
+                                                    bool                  IsDedicated,
+                                                    VkImage               DedicatedImage)
+{
+    VkDeviceSize PageSize = Size;
+    if (!IsDedicated)
+    {
+        PageSize = HostVisible ? m_HostVisiblePageSize : m_DeviceLocalPageSize;
+        while (PageSize < Size)
+            PageSize *= 2;
+    }
+
+    // Dedicated image memory may only be used if the device supports Vulkan 1.1
+    if (DedicatedImage != VK_NULL_HANDLE && m_PhysicalDevice.GetVkVersion() < VK_API_VERSION_1_1)
+        DedicatedImage = VK_NULL_HANDLE;
+
+    // Allocate device memory outside of the bucket lock
+    std::unique_ptr<MemoryPage> pNewPage = std::make_unique<MemoryPage>(*this, PageSize, MemoryTypeIndex, HostVisible, AllocateFlags, IsDedicated, DedicatedImage);
+
+    const size_t       stat_ind      = HostVisible ? 1 : 0;
+    const VkDeviceSize AllocatedSize = m_CurrAllocatedSize[stat_ind].fetch_add(PageSize) + PageSize;
+    UpdatePeakValue(m_PeakAllocatedSize[stat_ind], AllocatedSize);
+    m_NumPagesCreated.fetch_add(1);
+
+    LOG_INFO_MESSAGE("MemoryManager '", m_MgrName, "': created new ", (IsDedicated ? "dedicated " : ""), (HostVisible ? "host-visible" : "device-local"),
+                     " page. (", Diligent::FormatMemorySize(PageSize, 2), ", type idx: ", MemoryTypeIndex,
+                     "). Current allocated size: ", Diligent::FormatMemorySize(AllocatedSize, 2));
+    OnNewPageCreated(*pNewPage);
+
+    // Allocate from the page before it becomes visible to other threads
+    MemoryAllocation Allocation = pNewPage->Allocate(Size, Alignment);
+    DEV_CHECK_ERR(Allocation.Page != nullptr, "Failed to allocate new memory page");
+
+    std::lock_guard<std::mutex> Lock{Bucket.Mtx};
+    Bucket.Pages.emplace_back(std::move(pNewPage));
+
+    return Allocation;
+}
+
+MemoryAllocation MemoryManager::Allocate(VkDeviceSize Size, VkDeviceSize Alignment, uint32_t MemoryTypeIndex, bool HostVisible, VkMemoryAllocateFlags AllocateFlags, VkImage DedicatedImage)
+{
+    VERIFY(MemoryTypeIndex < VK_MAX_MEMORY_TYPES, "Memory type index (", MemoryTypeIndex, ") is out of range");
 
-    // On integrated GPUs, there is no difference between host-visible and GPU-only
-    // memory, so MemoryTypeIndex is the same. As GPU-only pages do not have CPU address,
-    // we need to use HostVisible flag to differentiate the two.
     // It is likely a good idea to always keep staging pages separate to reduce fragmentation
     // even though on integrated GPUs same pages can be used for both GPU-only and staging
     // allocations. Staging allocations are short-living and will be released when upload is
     // complete, while GPU-only allocations are expected to be long-living.
-    MemoryPageIndex             PageIdx{MemoryTypeIndex, HostVisible, AllocateFlags};
-    std::lock_guard<std::mutex> Lock{m_PagesMtx};
+    PageGroup& Group = m_PageGroups[MemoryTypeIndex][HostVisible ? 1 : 0];
+
+    const size_t ThreadBucket = GetThreadBucket();
+
+    // Large device-local allocations would waste a significant part of a regular page and
+    // are placed into dedicated pages of the exact size. Host-visible allocations are mostly
+    // short-living staging memory, and keeping them in regular pages avoids page churn.
+    const bool IsDedicated = !HostVisible && Size >= m_DeviceLocalPageSize / 2;
 
-    auto range = m_Pages.equal_range(PageIdx);
-    for (auto page_it = range.first; page_it != range.second; ++page_it)
+    MemoryAllocation Allocation;
+    if (!IsDedicated)
     {
-        Allocation = page_it->second.Allocate(Size, Alignment);
-        if (Allocation.Page != nullptr)
-            break;
+        // Try the bucket of this thread first, then buckets of other threads
+        for (size_t i = 0; i < NumThreadBuckets && Allocation.Page == nullptr; ++i)
+        {
+            Allocation = AllocateFromBucket(Group[(ThreadBucket + i) % NumThreadBuckets], Size, Alignment, AllocateFlags);
+        }
     }
 
-    size_t stat_ind = HostVisible ? 1 : 0;
     if (Allocation.Page == nullptr)
     {
-        VkDeviceSize PageSize = HostVisible ? m_HostVisiblePageSize : m_DeviceLocalPageSize;
-        while (PageSize < Size)
-            PageSize *= 2;
-
-        m_CurrAllocatedSize[stat_ind] += PageSize;
-        m_PeakAllocatedSize[stat_ind] = std::max(m_PeakAllocatedSize[stat_ind], m_CurrAllocatedSize[stat_ind]);
-
-        auto it = m_Pages.emplace(PageIdx, MemoryPage{*this, PageSize, MemoryTypeIndex, HostVisible, AllocateFlags});
-        LOG_INFO_MESSAGE("MemoryManager '", m_MgrName, "': created new ", (HostVisible ? "host-visible" : "device-local"),
-                         " page. (", Diligent::FormatMemorySize(PageSize, 2), ", type idx: ", MemoryTypeIndex,
-                         "). Current allocated size: ", Diligent::FormatMemorySize(m_CurrAllocatedSize[stat_ind], 2));
-        OnNewPageCreated(it->second);
-        Allocation = it->second.Allocate(Size, Alignment);
-        DEV_CHECK_ERR(Allocation.Page != nullptr, "Failed to allocate new memory page");
+        Allocation = AllocateFromNewPage(Group[ThreadBucket], Size, Alignment, MemoryTypeIndex, HostVisible, AllocateFlags, IsDedicated, DedicatedImage);
     }
 
     if (Allocation.Page != nullptr)
     {
         VERIFY_EXPR(Size + Diligent::AlignUp(Allocation.UnalignedOffset, Alignment) - Allocation.UnalignedOffset <= Allocation.Size);
-    }
 
-    m_CurrUsedSize[stat_ind].fetch_add(Allocation.Size);
-    m_PeakUsedSize[stat_ind] = std::max(m_PeakUsedSize[stat_ind], static_cast<VkDeviceSize>(m_CurrUsedSize[stat_ind].load()));
+        const size_t  stat_ind = HostVisible ? 1 : 0;
+        const int64_t UsedSize = m_CurrUsedSize[stat_ind].fetch_add(Allocation.Size) + static_cast<int64_t>(Allocation.Size);
+        UpdatePeakValue(m_PeakUsedSize[stat_ind], static_cast<VkDeviceSize>(UsedSize));
+    }
 
     return Allocation;
 }
 
+uint32_t MemoryManager::GetOverBudgetHeaps()
+{
+    if (!m_LogicalDevice.GetEnabledExtFeatures().MemoryBudget)
+        return 0;
+
+    std::lock_guard<std::mutex> Lock{m_BudgetMtx};
+
+    // Querying the budget is not free, so only do this when the set of pages has changed
+    const uint64_t PageChurn = m_NumPagesCreated.load() + m_NumPagesDestroyed.load();
+    if (PageChurn != m_BudgetPageChurn)
+    {
+        m_BudgetPageChurn     = PageChurn;
+        m_OverBudgetHeapsMask = 0;
+
+        VkPhysicalDeviceMemoryBudgetPropertiesEXT Budget{};
+        if (m_PhysicalDevice.GetMemoryBudget(Budget))
+        {
+            const VkPhysicalDeviceMemoryProperties& MemoryProps = m_PhysicalDevice.GetMemoryProperties();
+            for (uint32_t heap = 0; heap < MemoryProps.memoryHeapCount; ++heap)
+            {
+                if (Budget.heapUsage[heap] > Budget.heapBudget[heap])
+                {
+                    m_OverBudgetHeapsMask |= 1u << heap;
+                    LOG_WARNING_MESSAGE("MemoryManager '", m_MgrName, "': memory heap ", heap, " usage (", Diligent::FormatMemorySize(Budget.heapUsage[heap], 2),
+                                        ") exceeds the budget (", Diligent::FormatMemorySize(Budget.heapBudget[heap], 2), ")");
+                }
+            }
+        }
+    }
+
+    return m_OverBudgetHeapsMask;
+}
+
 void MemoryManager::ShrinkMemory()
 {
-    std::lock_guard<std::mutex> Lock{m_PagesMtx};
-    if (m_CurrAllocatedSize[0] <= m_DeviceLocalReserveSize && m_CurrAllocatedSize[1] <= m_HostVisibleReserveSize)
+    // Only empty pages can be released, so there is nothing to do if there are none.
+    // Note that the counters may be concurrently updated by other threads, which is fine
+    // as the pages are re-checked under the bucket lock.
+    const uint32_t NumEmptyDedicatedPages = m_NumEmptyDedicatedPages.load();
+    if (NumEmptyDedicatedPages == 0 && m_NumEmptySuballocatedPages.load() == 0)
         return;
 
-    auto it = m_Pages.begin();
-    while (it != m_Pages.end())
+    const uint32_t OverBudgetHeaps = GetOverBudgetHeaps();
+    if (m_CurrAllocatedSize[0] <= m_DeviceLocalReserveSize &&
+        m_CurrAllocatedSize[1] <= m_HostVisibleReserveSize &&
+        NumEmptyDedicatedPages == 0 &&
+        OverBudgetHeaps == 0)
+        return;
+
+    const VkPhysicalDeviceMemoryProperties& MemoryProps = m_PhysicalDevice.GetMemoryProperties();
+    for (uint32_t MemoryTypeIndex = 0; MemoryTypeIndex < MemoryProps.memoryTypeCount; ++MemoryTypeIndex)
+    {
+        const bool IsOverBudget = (OverBudgetHeaps & (1u << MemoryProps.memoryTypes[MemoryTypeIndex].heapIndex)) != 0;
+        for (size_t stat_ind = 0; stat_ind < 2; ++stat_ind)
+        {
+            const bool         IsHostVisible = stat_ind == 1;
+            const VkDeviceSize ReserveSize   = IsHostVisible ? m_HostVisibleReserveSize : m_DeviceLocalReserveSize;
+            for (PageBucket& Bucket : m_PageGroups[MemoryTypeIndex][stat_ind])
+            {
+                std::lock_guard<std::mutex> Lock{Bucket.Mtx};
+
+                auto it = Bucket.Pages.begin();
+                while (it != Bucket.Pages.end())
+                {
+                    MemoryPage& Page = **it;
+                    if (Page.IsEmpty() && (Page.IsDedicated() || IsOverBudget || m_CurrAllocatedSize[stat_ind] > ReserveSize))
+                    {
+                        const VkDeviceSize PageSize      = Page.GetPageSize();
+                        const VkDeviceSize AllocatedSize = m_CurrAllocatedSize[stat_ind].fetch_sub(PageSize) - PageSize;
+                        LOG_INFO_MESSAGE("MemoryManager '", m_MgrName, "': destroying ", (Page.IsDedicated() ? "dedicated " : ""), (IsHostVisible ? "host-visible" : "device-local"),
+                                         " page (", Diligent::FormatMemorySize(PageSize, 2),
+                                         "). Current allocated size: ",
+                                         Diligent::FormatMemorySize(AllocatedSize, 2));
+                        m_NumPagesDestroyed.fetch_add(1);
+                        OnPageDestroy(Page);
+                        it = Bucket.Pages.erase(it);
+                    }
+                    else
+                    {
+                        ++it;
+                    }
+                }
+            }
+        }
+    }
+}
+
+void MemoryManager::GetStats(Diligent::DeviceMemoryStatsVk& Stats) const
+{
+    Stats = {};
+
+    const VkPhysicalDeviceMemoryProperties& MemoryProps = m_PhysicalDevice.GetMemoryProperties();
+    static_assert(_countof(Stats.MemoryTypes) == VK_MAX_MEMORY_TYPES, "Unexpected number of memory types");
+    Stats.NumMemoryTypes = MemoryProps.memoryTypeCount;
+    Stats.NumMemoryHeaps = MemoryProps.memoryHeapCount;
+
+    for (uint32_t MemoryTypeIndex = 0; MemoryTypeIndex < MemoryProps.memoryTypeCount; ++MemoryTypeIndex)
     {
-        auto curr_it = it;
-        ++it;
-        MemoryPage&  Page          = curr_it->second;
-        bool         IsHostVisible = Page.GetCPUMemory() != nullptr;
-        VkDeviceSize ReserveSize   = IsHostVisible ? m_HostVisibleReserveSize : m_DeviceLocalReserveSize;
-        if (Page.IsEmpty() && m_CurrAllocatedSize[IsHostVisible ? 1 : 0] > ReserveSize)
+        Diligent::MemoryTypeStatsVk& TypeStats = Stats.MemoryTypes[MemoryTypeIndex];
+        for (const PageGroup& Group : m_PageGroups[MemoryTypeIndex])
         {
-            VkDeviceSize PageSize = Page.GetPageSize();
-            m_CurrAllocatedSize[IsHostVisible ? 1 : 0] -= PageSize;
-            LOG_INFO_MESSAGE("MemoryManager '", m_MgrName, "': destroying ", (IsHostVisible ? "host-visible" : "device-local"),
-                             " page (", Diligent::FormatMemorySize(PageSize, 2),
-                             "). Current allocated size: ",
-                             Diligent::FormatMemorySize(m_CurrAllocatedSize[IsHostVisible ? 1 : 0], 2));
-            OnPageDestroy(Page);
-            m_Pages.erase(curr_it);
+            for (const PageBucket& Bucket : Group)
+            {
+                std::lock_guard<std::mutex> Lock{Bucket.Mtx};
+                for (const std::unique_ptr<MemoryPage>& pPage : Bucket.Pages)
+                {
+                    const MemoryPage::Stats PageStats = pPage->GetStats();
+
+                    ++TypeStats.NumPages;
+                    if (pPage->IsDedicated())
+                        ++TypeStats.NumDedicatedPages;
+                    TypeStats.NumAllocations += static_cast<Diligent::Uint32>(PageStats.NumAllocations);
+                    TypeStats.NumFreeBlocks += static_cast<Diligent::Uint32>(PageStats.NumFreeBlocks);
+                    TypeStats.AllocatedSize += pPage->GetPageSize();
+                    TypeStats.UsedSize += PageStats.UsedSize;
+                    TypeStats.MaxFreeBlockSize = std::max(TypeStats.MaxFreeBlockSize, Diligent::Uint64{PageStats.MaxFreeBlockSize});
+                }
+            }
+        }
+    }
+
+    VkPhysicalDeviceMemoryBudgetPropertiesEXT Budget{};
+    if (m_PhysicalDevice.GetMemoryBudget(Budget))
+    {
+        for (uint32_t heap = 0; heap < MemoryProps.memoryHeapCount; ++heap)
+        {
+            Stats.HeapBudget[heap] = Budget.heapBudget[heap];
+            Stats.HeapUsage[heap]  = Budget.heapUsage[heap];
         }
     }
+
+    Stats.NumPagesCreated   = m_NumPagesCreated.load();
+    Stats.NumPagesDestroyed = m_NumPagesDestroyed.load();
 }
 
 void MemoryManager::OnFreeAllocation(VkDeviceSize Size, bool IsHostVisible)
@@ -246,20 +481,35 @@ void MemoryManager::OnFreeAllocation(VkDeviceSize Size, bool IsHostVisible)
 
 MemoryManager::~MemoryManager()
 {
-    VkDeviceSize PeakDeviceLocalPages = m_PeakAllocatedSize[0] / m_DeviceLocalPageSize;
-    VkDeviceSize PeakHostVisiblePages = m_PeakAllocatedSize[1] / m_HostVisiblePageSize;
+    const std::array<VkDeviceSize, 2> PeakUsedSize      = {m_PeakUsedSize[0].load(), m_PeakUsedSize[1].load()};
+    const std::array<VkDeviceSize, 2> PeakAllocatedSize = {m_PeakAllocatedSize[0].load(), m_PeakAllocatedSize[1].load()};
+
+    VkDeviceSize PeakDeviceLocalPages = PeakAllocatedSize[0] / m_DeviceLocalPageSize;
+    VkDeviceSize PeakHostVisiblePages = PeakAllocatedSize[1] / m_HostVisiblePageSize;
     LOG_INFO_MESSAGE("MemoryManager '", m_MgrName, "' stats:\n"
                                                    "                       Peak used/allocated device-local memory size: ",
-                     Diligent::FormatMemorySize(m_PeakUsedSize[0], 2, m_PeakAllocatedSize[0]), " / ",
-                     Diligent::FormatMemorySize(m_PeakAllocatedSize[0], 2, m_PeakAllocatedSize[0]),
+                     Diligent::FormatMemorySize(PeakUsedSize[0], 2, PeakAllocatedSize[0]), " / ",
+                     Diligent::FormatMemorySize(PeakAllocatedSize[0], 2, PeakAllocatedSize[0]),
                      " (", PeakDeviceLocalPages, (PeakDeviceLocalPages == 1 ? " page)" : " pages)"),
                      "\n                       Peak used/allocated host-visible memory size: ",
-                     Diligent::FormatMemorySize(m_PeakUsedSize[1], 2, m_PeakAllocatedSize[1]), " / ",
-                     Diligent::FormatMemorySize(m_PeakAllocatedSize[1], 2, m_PeakAllocatedSize[1]),
-                     " (", PeakHostVisiblePages, (PeakHostVisiblePages == 1 ? " page)" : " pages)"));
+                     Diligent::FormatMemorySize(PeakUsedSize[1], 2, PeakAllocatedSize[1]), " / ",
+                     Diligent::FormatMemorySize(PeakAllocatedSize[1], 2, PeakAllocatedSize[1]),
+                     " (", PeakHostVisiblePages, (PeakHostVisiblePages == 1 ? " page)" : " pages)"),
+                     "\n                       Pages created/destroyed: ", m_NumPagesCreated.load(), " / ", m_NumPagesDestroyed.load());
 
-    for (auto it = m_Pages.begin(); it != m_Pages.end(); ++it)
-        VERIFY(it->second.IsEmpty(), "The page contains outstanding allocations");
+#ifdef DILIGENT_DEBUG
+    for (std::array<PageGroup, 2>& Groups : m_PageGroups)
+    {
+        for (PageGroup& Group : Groups)
+        {
+            for (PageBucket& Bucket : Group)
+            {
+                for (std::unique_ptr<MemoryPage>& pPage : Bucket.Pages)
+                    VERIFY(pPage->IsEmpty(), "The page contains outstanding allocations");
+            }
+        }
+    }
+#endif
     VERIFY(m_CurrUsedSize[0] == 0 && m_CurrUsedSize[1] == 0, "Not all allocations have been released");
 }
 
@@ -309,6 +309,11 @@ PhysicalDevice::PhysicalDevice(const CreateInfo& CI) :
             m_ExtFeatures.DrawIndirectCount = true;
         }
 
+        if (IsExtensionSupported(VK_EXT_MEMORY_BUDGET_EXTENSION_NAME))
+        {
+            m_ExtFeatures.MemoryBudget = true;
+        }
+
         if (IsExtensionSupported(VK_KHR_MAINTENANCE3_EXTENSION_NAME))
         {
             *NextProp = &m_ExtProperties.Maintenance3;
@@ -586,4 +591,24 @@ bool PhysicalDevice::IsUMA() const
     return m_MemoryProperties.memoryHeapCount == 1;
 }
 
+bool PhysicalDevice::GetMemoryBudget(VkPhysicalDeviceMemoryBudgetPropertiesEXT& Budget) const
+{
+    Budget = {};
+#if DILIGENT_USE_VOLK
+    // m_ExtFeatures.MemoryBudget is only set when VK_KHR_get_physical_device_properties2 is enabled
+    if (m_ExtFeatures.MemoryBudget)
+    {
+        Budget.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_BUDGET_PROPERTIES_EXT;
+
+        VkPhysicalDeviceMemoryProperties2 MemProps2{};
+        MemProps2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_PROPERTIES_2;
+        MemProps2.pNext = &Budget;
+        vkGetPhysicalDeviceMemoryProperties2KHR(m_vkDevice, &MemProps2);
+        Budget.pNext = nullptr;
+        return true;
+    }
+#endif
+    return false;
+}
+
 } // namespace VulkanUtilities
@@ -33,6 +33,7 @@
 #include <vector>
 
 #include "WebGPUObjectWrappers.hpp"
+#include "UploadMemoryManagerWebGPU.hpp"
 #include "BasicTypes.h"
 
 namespace Diligent
@@ -41,6 +42,11 @@ namespace Diligent
 // Dynamic memory manager provides dynamic memory allocations for dynamic buffers.
 // The data is copied to the CPU memory and is flushed to the GPU memory before the
 // command list is submitted to the queue.
+//
+// When the staging memory manager is provided, every page is backed by a mapped upload page,
+// so that the data is written directly to the GPU-visible memory. When the page is flushed,
+// the copy from the staging memory to the dynamic buffer is recorded into the command encoder
+// that must be submitted before any command that uses the dynamic memory.
 
 class DynamicMemoryManagerWebGPU
 {
@@ -77,21 +83,30 @@ public:
 
         Allocation Allocate(size_t Size, size_t Alignment = 16);
 
-        void FlushWrites(WGPUQueue wgpuQueue);
+        // In staging mode, the copy from the staging memory is recorded into wgpuCopyEncoder.
+        void FlushWrites(WGPUQueue wgpuQueue, WGPUCommandEncoder wgpuCopyEncoder = nullptr);
         void Recycle();
 
         size_t GetSize() const { return m_Size; }
 
+        size_t GetUsedSize() const { return m_CurrOffset; }
+
     private:
+        friend DynamicMemoryManagerWebGPU;
+
         DynamicMemoryManagerWebGPU* m_pMgr = nullptr;
 
         size_t m_Size       = 0;
         size_t m_CurrOffset = 0;
         // Start offset in the buffer
         size_t m_BufferOffset = 0;
+
+        // Staging memory the data is written to in staging mode
+        UploadMemoryManagerWebGPU::Page m_StagingPage;
     };
 
-    DynamicMemoryManagerWebGPU(WGPUDevice wgpuDevice, size_t PageSize, size_t BufferSize);
+    // If pStagingMemoryMgr is not null, dynamic data is written to its pages instead of the CPU-side shadow copy.
+    DynamicMemoryManagerWebGPU(WGPUDevice wgpuDevice, size_t PageSize, size_t BufferSize, UploadMemoryManagerWebGPU* pStagingMemoryMgr = nullptr);
 
     ~DynamicMemoryManagerWebGPU();
 
@@ -102,8 +117,14 @@ public:
         return m_wgpuBuffer;
     }
 
+    bool UsesStagingMemory() const
+    {
+        return m_pStagingMemoryMgr != nullptr;
+    }
+
 private:
     void RecyclePage(Page&& page);
+    void AttachStagingPage(Page& DynPage);
 
 private:
     const size_t        m_PageSize;
@@ -111,6 +132,8 @@ private:
     size_t              m_CurrentOffset = 0;
     WebGPUBufferWrapper m_wgpuBuffer;
 
+    UploadMemoryManagerWebGPU* const m_pStagingMemoryMgr;
+
     std::mutex         m_AvailablePagesMtx;
     std::vector<Page>  m_AvailablePages;
     std::vector<Uint8> m_MappedData;
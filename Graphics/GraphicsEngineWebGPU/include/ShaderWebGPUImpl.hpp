@@ -35,6 +35,7 @@
 #include "EngineWebGPUImplTraits.hpp"
 #include "ShaderBase.hpp"
 #include "WGSLShaderResources.hpp"
+#include "WGSLUtils.hpp"
 
 namespace Diligent
 {
@@ -95,6 +96,12 @@ public:
         return m_pShaderResources;
     }
 
+    const WGSLResourceBindingTable& GetWGSLBindingTable() const
+    {
+        DEV_CHECK_ERR(!IsCompiling(), "WGSL binding table is not available until the shader is compiled. Use GetStatus() to check the shader status.");
+        return m_WGSLBindingTable;
+    }
+
 private:
     void Initialize(const ShaderCreateInfo& ShaderCI,
                     const CreateInfo&       WebGPUShaderCI) noexcept(false);
@@ -103,6 +110,8 @@ private:
     std::string m_EntryPoint;
 
     std::shared_ptr<const WGSLShaderResources> m_pShaderResources;
+
+    WGSLResourceBindingTable m_WGSLBindingTable;
 };
 
 } // namespace Diligent
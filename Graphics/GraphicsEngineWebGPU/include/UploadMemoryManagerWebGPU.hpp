@@ -34,7 +34,10 @@
 #include <atomic>
 
 #include "WebGPUObjectWrappers.hpp"
+#include "SyncPointWebGPU.hpp"
 #include "BasicTypes.h"
+#include "RefCntAutoPtr.hpp"
+#include "DebugUtilities.hpp"
 
 namespace Diligent
 {
@@ -46,6 +49,11 @@ namespace Diligent
 //
 // The data is first written to the upload memory and the copy command is added to the command list.
 // Upload data is flushed to the GPU memory before the command list is submitted to the queue.
+//
+// When mapped memory is used, every page is a staging buffer that is mapped at creation,
+// and the data is written directly to the GPU-visible memory. The page is unmapped before the
+// command list is submitted, and is mapped again asynchronously when it is recycled. The page
+// can only be reused after the mapping completes.
 class UploadMemoryManagerWebGPU
 {
 public:
@@ -83,26 +91,58 @@ public:
 
         size_t GetSize() const
         {
-            return m_Data.size();
+            return m_Size;
+        }
+
+        WGPUBuffer GetWGPUBuffer() const
+        {
+            return m_wgpuBuffer;
+        }
+
+        // Returns the CPU address of the page memory at the given offset
+        Uint8* GetCPUAddress(size_t Offset)
+        {
+            VERIFY_EXPR(Offset < m_Size);
+            return m_pMappedData != nullptr ? m_pMappedData + Offset : &m_Data[Offset];
         }
 
     private:
+        friend UploadMemoryManagerWebGPU;
+
+        // Returns true if the page is ready to be used.
+        // In mapped mode, the page is ready when the asynchronous mapping is complete.
+        bool IsReady() const;
+
+        // Acquires the mapped range after the asynchronous mapping is complete.
+        bool AcquireMappedRange();
+
         UploadMemoryManagerWebGPU* m_pMgr = nullptr;
         WebGPUBufferWrapper        m_wgpuBuffer;
         std::vector<Uint8>         m_Data;
-        size_t                     m_CurrOffset = 0;
+        Uint8*                     m_pMappedData = nullptr;
+        size_t                     m_Size        = 0;
+        size_t                     m_CurrOffset  = 0;
+
+        // Triggered when the asynchronous mapping of a recycled page completes
+        RefCntAutoPtr<SyncPointWebGPUImpl> m_pMapSyncPoint;
     };
 
-    UploadMemoryManagerWebGPU(WGPUDevice wgpuDevice, size_t PageSize);
+    UploadMemoryManagerWebGPU(WGPUDevice wgpuDevice, size_t PageSize, bool UseMappedMemory = false);
     ~UploadMemoryManagerWebGPU();
 
     Page GetPage(size_t Size);
 
+    bool UsesMappedMemory() const
+    {
+        return m_UseMappedMemory;
+    }
+
 private:
     void RecyclePage(Page&& page);
 
 private:
     const size_t m_PageSize;
+    const bool   m_UseMappedMemory;
     WGPUDevice   m_wgpuDevice;
 
     std::mutex        m_AvailablePagesMtx;
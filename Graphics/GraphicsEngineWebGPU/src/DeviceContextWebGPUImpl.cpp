@@ -1483,21 +1483,40 @@ void DeviceContextWebGPUImpl::Flush()
     }
     m_PendingStagingWrites.clear();
 
-    for (DynamicMemoryManagerWebGPU::Page& MemPage : m_DynamicMemPages)
+    // In staging mode, copies from the staging memory to the dynamic buffer are recorded into a separate
+    // command buffer that is submitted before the main one.
+    WebGPUCommandBufferWrapper wgpuDynamicCopyCmdBuffer;
+    if (m_pDevice->GetDynamicMemoryManager().UsesStagingMemory())
     {
-        MemPage.FlushWrites(m_wgpuQueue);
-        MemPage.Recycle();
+        WebGPUCommandEncoderWrapper wgpuCopyEncoder;
+        for (DynamicMemoryManagerWebGPU::Page& MemPage : m_DynamicMemPages)
+        {
+            if (MemPage.GetUsedSize() > 0 && !wgpuCopyEncoder)
+            {
+                WGPUCommandEncoderDescriptor wgpuCmdEncoderDesc{};
+                wgpuCmdEncoderDesc.label = GetWGPUStringView("Dynamic memory copy encoder");
+                wgpuCopyEncoder.Reset(wgpuDeviceCreateCommandEncoder(m_pDevice->GetWebGPUDevice(), &wgpuCmdEncoderDesc));
+            }
+            MemPage.FlushWrites(m_wgpuQueue, wgpuCopyEncoder);
+        }
+
+        if (wgpuCopyEncoder)
+        {
+            WGPUCommandBufferDescriptor wgpuCmdBufferDesc{};
+            wgpuDynamicCopyCmdBuffer.Reset(wgpuCommandEncoderFinish(wgpuCopyEncoder, &wgpuCmdBufferDesc));
+            DEV_CHECK_ERR(wgpuDynamicCopyCmdBuffer != nullptr, "Failed to finish dynamic memory copy encoder");
+        }
+    }
+    else
+    {
+        for (DynamicMemoryManagerWebGPU::Page& MemPage : m_DynamicMemPages)
+            MemPage.FlushWrites(m_wgpuQueue);
     }
-    m_DynamicMemPages.clear();
 
     for (UploadMemoryManagerWebGPU::Page& MemPage : m_UploadMemPages)
-    {
         MemPage.FlushWrites(m_wgpuQueue);
-        MemPage.Recycle();
-    }
-    m_UploadMemPages.clear();
 
-    if (m_wgpuCommandEncoder || !m_SignaledFences.empty())
+    if (m_wgpuCommandEncoder || !m_SignaledFences.empty() || wgpuDynamicCopyCmdBuffer)
     {
         auto WorkDoneCallback = [](WGPUQueueWorkDoneStatus Status, void* pUserData) {
             VERIFY_EXPR(pUserData != nullptr);
@@ -1525,7 +1544,13 @@ void DeviceContextWebGPUImpl::Flush()
         WebGPUCommandBufferWrapper  wgpuCmdBuffer{wgpuCommandEncoderFinish(GetCommandEncoder(), &wgpuCmdBufferDesc)};
         DEV_CHECK_ERR(wgpuCmdBuffer != nullptr, "Failed to finish command encoder");
 
-        wgpuQueueSubmit(m_wgpuQueue, 1, &wgpuCmdBuffer.Get());
+        WGPUCommandBuffer wgpuCmdBuffers[2] = {};
+        uint32_t          NumCmdBuffers     = 0;
+        if (wgpuDynamicCopyCmdBuffer)
+            wgpuCmdBuffers[NumCmdBuffers++] = wgpuDynamicCopyCmdBuffer;
+        wgpuCmdBuffers[NumCmdBuffers++] = wgpuCmdBuffer;
+
+        wgpuQueueSubmit(m_wgpuQueue, NumCmdBuffers, wgpuCmdBuffers);
         wgpuQueueOnSubmittedWorkDone(m_wgpuQueue, WorkDoneCallback, pWorkDoneSyncPoint.Detach());
         m_wgpuCommandEncoder.Reset(nullptr);
 
@@ -1536,6 +1561,16 @@ void DeviceContextWebGPUImpl::Flush()
         m_PendingStagingReads.clear();
     }
 
+    // Pages must be recycled after the submission since mapped pages are mapped again
+    // asynchronously, and a buffer that is being mapped can't be used by submitted commands.
+    for (DynamicMemoryManagerWebGPU::Page& MemPage : m_DynamicMemPages)
+        MemPage.Recycle();
+    m_DynamicMemPages.clear();
+
+    for (UploadMemoryManagerWebGPU::Page& MemPage : m_UploadMemPages)
+        MemPage.Recycle();
+    m_UploadMemPages.clear();
+
     // Without DeviceTick(), the work done callback is never called
     m_pDevice->DeviceTick();
 }
@@ -46,7 +46,8 @@ DynamicMemoryManagerWebGPU::Page::Page(Page&& RHS) noexcept :
     m_pMgr{RHS.m_pMgr},
     m_Size{RHS.m_Size},
     m_CurrOffset{RHS.m_CurrOffset},
-    m_BufferOffset{RHS.m_BufferOffset}
+    m_BufferOffset{RHS.m_BufferOffset},
+    m_StagingPage{std::move(RHS.m_StagingPage)}
 // clang-format on
 {
     RHS = Page{};
@@ -61,6 +62,7 @@ DynamicMemoryManagerWebGPU::Page& DynamicMemoryManagerWebGPU::Page::operator=(Pa
     m_Size         = RHS.m_Size;
     m_CurrOffset   = RHS.m_CurrOffset;
     m_BufferOffset = RHS.m_BufferOffset;
+    m_StagingPage  = std::move(RHS.m_StagingPage);
 
     RHS.m_pMgr         = nullptr;
     RHS.m_Size         = 0;
@@ -86,7 +88,7 @@ DynamicMemoryManagerWebGPU::Allocation DynamicMemoryManagerWebGPU::Page::Allocat
         size_t     MemoryOffset = m_BufferOffset + Offset;
         Allocation Alloc;
         Alloc.wgpuBuffer = m_pMgr->m_wgpuBuffer;
-        Alloc.pData      = &m_pMgr->m_MappedData[MemoryOffset];
+        Alloc.pData      = m_StagingPage.GetSize() != 0 ? m_StagingPage.GetCPUAddress(Offset) : &m_pMgr->m_MappedData[MemoryOffset];
         Alloc.Offset     = MemoryOffset;
         Alloc.Size       = AllocSize;
 
@@ -96,9 +98,18 @@ DynamicMemoryManagerWebGPU::Allocation DynamicMemoryManagerWebGPU::Page::Allocat
     return Allocation{};
 }
 
-void DynamicMemoryManagerWebGPU::Page::FlushWrites(WGPUQueue wgpuQueue)
+void DynamicMemoryManagerWebGPU::Page::FlushWrites(WGPUQueue wgpuQueue, WGPUCommandEncoder wgpuCopyEncoder)
 {
-    if (m_CurrOffset > 0)
+    if (m_StagingPage.GetSize() != 0)
+    {
+        if (m_CurrOffset > 0)
+        {
+            VERIFY(wgpuCopyEncoder != nullptr, "Copy encoder must not be null in staging mode");
+            wgpuCommandEncoderCopyBufferToBuffer(wgpuCopyEncoder, m_StagingPage.GetWGPUBuffer(), 0, m_pMgr->m_wgpuBuffer, m_BufferOffset, m_CurrOffset);
+        }
+        m_StagingPage.FlushWrites(wgpuQueue);
+    }
+    else if (m_CurrOffset > 0)
     {
         VERIFY_EXPR(m_pMgr != nullptr);
         wgpuQueueWriteBuffer(wgpuQueue, m_pMgr->m_wgpuBuffer, m_BufferOffset, &m_pMgr->m_MappedData[m_BufferOffset], m_CurrOffset);
@@ -112,14 +123,24 @@ void DynamicMemoryManagerWebGPU::Page::Recycle()
         UNEXPECTED("The page is empty.");
         return;
     }
+    if (m_StagingPage.GetSize() != 0)
+    {
+        // The staging page is recycled separately as it can only be reused after the GPU is done with it,
+        // while the dynamic buffer range is available immediately.
+        m_StagingPage.Recycle();
+    }
     m_CurrOffset = 0;
     m_pMgr->RecyclePage(std::move(*this));
 }
 
-DynamicMemoryManagerWebGPU::DynamicMemoryManagerWebGPU(WGPUDevice wgpuDevice, size_t PageSize, size_t BufferSize) :
+DynamicMemoryManagerWebGPU::DynamicMemoryManagerWebGPU(WGPUDevice                 wgpuDevice,
+                                                       size_t                     PageSize,
+                                                       size_t                     BufferSize,
+                                                       UploadMemoryManagerWebGPU* pStagingMemoryMgr) :
     m_PageSize{PageSize},
     m_BufferSize{BufferSize},
-    m_CurrentOffset{0}
+    m_CurrentOffset{0},
+    m_pStagingMemoryMgr{pStagingMemoryMgr}
 {
     WGPUBufferDescriptor wgpuBufferDesc{};
     wgpuBufferDesc.label = GetWGPUStringView("Dynamic buffer");
@@ -133,7 +154,8 @@ DynamicMemoryManagerWebGPU::DynamicMemoryManagerWebGPU(WGPUDevice wgpuDevice, si
         WGPUBufferUsage_Index |
         WGPUBufferUsage_Indirect;
     m_wgpuBuffer.Reset(wgpuDeviceCreateBuffer(wgpuDevice, &wgpuBufferDesc));
-    m_MappedData.resize(BufferSize);
+    if (m_pStagingMemoryMgr == nullptr)
+        m_MappedData.resize(BufferSize);
 
     LOG_INFO_MESSAGE("Created dynamic buffer: ", BufferSize >> 10, " KB");
 }
@@ -162,6 +184,7 @@ DynamicMemoryManagerWebGPU::Page DynamicMemoryManagerWebGPU::GetPage(size_t Size
         {
             Page Result = std::move(*Iter);
             m_AvailablePages.erase(Iter);
+            AttachStagingPage(Result);
             return Result;
         }
         ++Iter;
@@ -176,7 +199,18 @@ DynamicMemoryManagerWebGPU::Page DynamicMemoryManagerWebGPU::GetPage(size_t Size
     size_t Offset = m_CurrentOffset;
     m_CurrentOffset += PageSize;
 
-    return Page{this, PageSize, Offset};
+    Page NewPage{this, PageSize, Offset};
+    AttachStagingPage(NewPage);
+    return NewPage;
+}
+
+void DynamicMemoryManagerWebGPU::AttachStagingPage(Page& DynPage)
+{
+    if (m_pStagingMemoryMgr == nullptr)
+        return;
+
+    VERIFY_EXPR(DynPage.m_StagingPage.GetSize() == 0);
+    DynPage.m_StagingPage = m_pStagingMemoryMgr->GetPage(DynPage.GetSize());
 }
 
 void DynamicMemoryManagerWebGPU::RecyclePage(Page&& Item)
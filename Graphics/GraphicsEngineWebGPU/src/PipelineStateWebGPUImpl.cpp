@@ -328,7 +328,7 @@ void PipelineStateWebGPUImpl::RemapOrVerifyShaderResources(
 
         if (!bVerifyOnly)
         {
-            PatchedWGSL = RemapWGSLResourceBindings(pShader->GetWGSL(), ResMapping, pShader->GetEmulatedArrayIndexSuffix());
+            PatchedWGSL = RemapWGSLResourceBindings(pShader->GetWGSL(), pShader->GetWGSLBindingTable(), ResMapping, pShader->GetEmulatedArrayIndexSuffix());
         }
     }
 }
@@ -108,8 +108,16 @@ RenderDeviceWebGPUImpl::RenderDeviceWebGPUImpl(IReferenceCounters* pRefCounters,
 
     m_DeviceInfo.Features = EnableDeviceFeatures(CI.EnabledFeatures, EngineCI.Features);
 
-    m_pUploadMemoryManager  = std::make_unique<UploadMemoryManagerWebGPU>(m_wgpuDevice, EngineCI.UploadHeapPageSize);
-    m_pDynamicMemoryManager = std::make_unique<DynamicMemoryManagerWebGPU>(m_wgpuDevice, EngineCI.DynamicHeapPageSize, EngineCI.DynamicHeapSize);
+#if PLATFORM_WEB
+    // Mapped upload memory is not used on the Web
+    constexpr bool UseMappedUploadMemory = false;
+#else
+    const bool UseMappedUploadMemory = EngineCI.UseMappedUploadMemory;
+#endif
+
+    m_pUploadMemoryManager  = std::make_unique<UploadMemoryManagerWebGPU>(m_wgpuDevice, EngineCI.UploadHeapPageSize, UseMappedUploadMemory);
+    m_pDynamicMemoryManager = std::make_unique<DynamicMemoryManagerWebGPU>(m_wgpuDevice, EngineCI.DynamicHeapPageSize, EngineCI.DynamicHeapSize,
+                                                                           UseMappedUploadMemory ? m_pUploadMemoryManager.get() : nullptr);
     m_pAttachmentCleaner    = std::make_unique<AttachmentCleanerWebGPU>(*this);
     m_pMipsGenerator        = std::make_unique<GenerateMipsHelperWebGPU>(*this);
     m_pQueryManager         = std::make_unique<QueryManagerWebGPU>(this, EngineCI.QueryPoolSizes);
@@ -232,6 +232,8 @@ void ShaderWebGPUImpl::Initialize(const ShaderCreateInfo& ShaderCI,
     // Load shader resources
     if ((ShaderCI.CompileFlags & SHADER_COMPILE_FLAG_SKIP_REFLECTION) == 0)
     {
+        DILIGENT_CPU_PROFILE_ZONE("LoadWGSLShaderResources", "Reflection");
+
         IMemoryAllocator& Allocator = GetRawAllocator();
 
         std::unique_ptr<void, STDDeleterRawMem<void>> pRawMem{
@@ -249,6 +251,9 @@ void ShaderWebGPUImpl::Initialize(const ShaderCreateInfo& ShaderCI,
                 ShaderCI.WebGPUEmulatedArrayIndexSuffix,
                 ShaderCI.LoadConstantBufferReflection,
                 WebGPUShaderCI.ppCompilerOutput,
+                // Locate resource bindings in the source once, so that they can be remapped for
+                // every pipeline layout by patching the source text.
+                &m_WGSLBindingTable,
             };
         m_pShaderResources.reset(static_cast<WGSLShaderResources*>(pRawMem.release()), STDDeleterRawMem<WGSLShaderResources>(Allocator));
         m_EntryPoint = m_pShaderResources->GetEntryPoint();
@@ -36,20 +36,44 @@ namespace Diligent
 
 UploadMemoryManagerWebGPU::Page::Page(UploadMemoryManagerWebGPU& Mgr, size_t Size) :
     m_pMgr{&Mgr},
-    m_Data(Size)
+    m_Size{Size}
 {
     WGPUBufferDescriptor wgpuBufferDesc{};
-    wgpuBufferDesc.label = GetWGPUStringView("Upload memory page");
-    wgpuBufferDesc.size  = Size;
-    wgpuBufferDesc.usage =
-        WGPUBufferUsage_CopyDst |
-        WGPUBufferUsage_CopySrc |
-        WGPUBufferUsage_Uniform |
-        WGPUBufferUsage_Storage |
-        WGPUBufferUsage_Vertex |
-        WGPUBufferUsage_Index |
-        WGPUBufferUsage_Indirect;
+    wgpuBufferDesc.size = Size;
+    if (m_pMgr->m_UseMappedMemory)
+    {
+        wgpuBufferDesc.label            = GetWGPUStringView("Mapped upload memory page");
+        wgpuBufferDesc.usage            = WGPUBufferUsage_MapWrite | WGPUBufferUsage_CopySrc;
+        wgpuBufferDesc.mappedAtCreation = true;
+    }
+    else
+    {
+        wgpuBufferDesc.label = GetWGPUStringView("Upload memory page");
+        wgpuBufferDesc.usage =
+            WGPUBufferUsage_CopyDst |
+            WGPUBufferUsage_CopySrc |
+            WGPUBufferUsage_Uniform |
+            WGPUBufferUsage_Storage |
+            WGPUBufferUsage_Vertex |
+            WGPUBufferUsage_Index |
+            WGPUBufferUsage_Indirect;
+        m_Data.resize(Size);
+    }
     m_wgpuBuffer.Reset(wgpuDeviceCreateBuffer(m_pMgr->m_wgpuDevice, &wgpuBufferDesc));
+
+    if (m_pMgr->m_UseMappedMemory)
+    {
+        m_pMappedData = static_cast<Uint8*>(wgpuBufferGetMappedRange(m_wgpuBuffer, 0, Size));
+        if (m_pMappedData == nullptr)
+        {
+            LOG_ERROR_MESSAGE("Failed to map upload memory page. Falling back to CPU-side memory.");
+            // The buffer can't be used as a copy source while it is mapped
+            wgpuBufferDesc.usage            = WGPUBufferUsage_CopyDst | WGPUBufferUsage_CopySrc;
+            wgpuBufferDesc.mappedAtCreation = false;
+            m_wgpuBuffer.Reset(wgpuDeviceCreateBuffer(m_pMgr->m_wgpuDevice, &wgpuBufferDesc));
+            m_Data.resize(Size);
+        }
+    }
     LOG_INFO_MESSAGE("Created a new upload memory page, size: ", FormatMemorySize(Size));
 }
 
@@ -58,7 +82,10 @@ UploadMemoryManagerWebGPU::Page::Page(Page&& RHS) noexcept :
     m_pMgr{RHS.m_pMgr},
     m_wgpuBuffer{std::move(RHS.m_wgpuBuffer)},
     m_Data{std::move(RHS.m_Data)},
-    m_CurrOffset{RHS.m_CurrOffset}
+    m_pMappedData{RHS.m_pMappedData},
+    m_Size{RHS.m_Size},
+    m_CurrOffset{RHS.m_CurrOffset},
+    m_pMapSyncPoint{std::move(RHS.m_pMapSyncPoint)}
 // clang-format on
 {
     RHS = Page{};
@@ -69,13 +96,18 @@ UploadMemoryManagerWebGPU::Page& UploadMemoryManagerWebGPU::Page::operator=(Page
     if (&RHS == this)
         return *this;
 
-    m_pMgr       = RHS.m_pMgr;
-    m_wgpuBuffer = std::move(RHS.m_wgpuBuffer);
-    m_Data       = std::move(RHS.m_Data);
-    m_CurrOffset = RHS.m_CurrOffset;
+    m_pMgr          = RHS.m_pMgr;
+    m_wgpuBuffer    = std::move(RHS.m_wgpuBuffer);
+    m_Data          = std::move(RHS.m_Data);
+    m_pMappedData   = RHS.m_pMappedData;
+    m_Size          = RHS.m_Size;
+    m_CurrOffset    = RHS.m_CurrOffset;
+    m_pMapSyncPoint = std::move(RHS.m_pMapSyncPoint);
 
-    RHS.m_pMgr       = nullptr;
-    RHS.m_CurrOffset = 0;
+    RHS.m_pMgr        = nullptr;
+    RHS.m_pMappedData = nullptr;
+    RHS.m_Size        = 0;
+    RHS.m_CurrOffset  = 0;
 
     return *this;
 }
@@ -91,10 +123,10 @@ UploadMemoryManagerWebGPU::Allocation UploadMemoryManagerWebGPU::Page::Allocate(
     Allocation Alloc;
     Alloc.Offset = AlignUp(m_CurrOffset, Alignment);
     Alloc.Size   = AlignUp(Size, Alignment);
-    if (Alloc.Offset + Alloc.Size <= m_Data.size())
+    if (Alloc.Offset + Alloc.Size <= m_Size)
     {
         Alloc.wgpuBuffer = m_wgpuBuffer;
-        Alloc.pData      = &m_Data[Alloc.Offset];
+        Alloc.pData      = GetCPUAddress(Alloc.Offset);
         m_CurrOffset     = Alloc.Offset + Alloc.Size;
         return Alloc;
     }
@@ -103,8 +135,16 @@ UploadMemoryManagerWebGPU::Allocation UploadMemoryManagerWebGPU::Page::Allocate(
 
 void UploadMemoryManagerWebGPU::Page::FlushWrites(WGPUQueue wgpuQueue)
 {
-    if (m_CurrOffset > 0)
+    if (m_pMappedData != nullptr)
+    {
+        // The data is already in the buffer memory. The buffer must be unmapped before
+        // the command list that references it is submitted.
+        wgpuBufferUnmap(m_wgpuBuffer);
+        m_pMappedData = nullptr;
+    }
+    else if (m_CurrOffset > 0)
     {
+        VERIFY_EXPR(!m_Data.empty());
         wgpuQueueWriteBuffer(wgpuQueue, m_wgpuBuffer, 0, m_Data.data(), m_CurrOffset);
     }
 }
@@ -117,13 +157,51 @@ void UploadMemoryManagerWebGPU::Page::Recycle()
         return;
     }
 
+    if (m_Data.empty())
+    {
+        VERIFY(m_pMappedData == nullptr, "The page must be flushed before it is recycled");
+
+        // Map the buffer again. The mapping completes when the GPU is done with all commands
+        // that use the buffer, so the page may be recycled right after the command list is submitted.
+        auto MapAsyncCallback = [](WGPUBufferMapAsyncStatus MapStatus, void* pUserData) {
+            VERIFY_EXPR(pUserData != nullptr);
+            SyncPointWebGPUImpl* pSyncPoint = static_cast<SyncPointWebGPUImpl*>(pUserData);
+            pSyncPoint->Trigger();
+            pSyncPoint->Release();
+        };
+
+        m_pMapSyncPoint = MakeNewRCObj<SyncPointWebGPUImpl>()();
+        // The reference is released by the callback
+        m_pMapSyncPoint->AddRef();
+        wgpuBufferMapAsync(m_wgpuBuffer, WGPUMapMode_Write, 0, m_Size, MapAsyncCallback, m_pMapSyncPoint.RawPtr());
+    }
+
     m_CurrOffset = 0;
     m_pMgr->RecyclePage(std::move(*this));
 }
 
+bool UploadMemoryManagerWebGPU::Page::IsReady() const
+{
+    return !m_pMapSyncPoint || m_pMapSyncPoint->IsTriggered();
+}
+
+bool UploadMemoryManagerWebGPU::Page::AcquireMappedRange()
+{
+    if (!m_pMapSyncPoint)
+        return true;
+
+    VERIFY_EXPR(m_pMapSyncPoint->IsTriggered());
+    m_pMapSyncPoint.Release();
 
-UploadMemoryManagerWebGPU::UploadMemoryManagerWebGPU(WGPUDevice wgpuDevice, size_t PageSize) :
+    // The range is null if the mapping failed (e.g. the device was lost)
+    m_pMappedData = static_cast<Uint8*>(wgpuBufferGetMappedRange(m_wgpuBuffer, 0, m_Size));
+    return m_pMappedData != nullptr;
+}
+
+
+UploadMemoryManagerWebGPU::UploadMemoryManagerWebGPU(WGPUDevice wgpuDevice, size_t PageSize, bool UseMappedMemory) :
     m_PageSize{PageSize},
+    m_UseMappedMemory{UseMappedMemory},
     m_wgpuDevice{wgpuDevice}
 {
     VERIFY(IsPowerOfTwo(m_PageSize), "Page size must be power of two");
@@ -151,11 +229,19 @@ UploadMemoryManagerWebGPU::Page UploadMemoryManagerWebGPU::GetPage(size_t Size)
         auto Iter = m_AvailablePages.begin();
         while (Iter != m_AvailablePages.end())
         {
-            if (PageSize <= Iter->GetSize())
+            // Pages that are still being mapped can't be used yet
+            if (PageSize <= Iter->GetSize() && Iter->IsReady())
             {
                 Page Result = std::move(*Iter);
                 m_AvailablePages.erase(Iter);
-                return Result;
+                if (Result.AcquireMappedRange())
+                    return Result;
+
+                LOG_ERROR_MESSAGE("Failed to map upload memory page. The page will be released.");
+#if DILIGENT_DEBUG
+                m_DbgPageCounter.fetch_sub(1);
+#endif
+                break;
             }
             ++Iter;
         }
@@ -31,6 +31,7 @@
 
 #include <unordered_map>
 #include <mutex>
+#include <memory>
 
 #include "RenderStateCache.h"
 #include "SerializationDevice.h"
@@ -38,6 +39,7 @@
 #include "UniqueIdentifier.hpp"
 #include "ObjectBase.hpp"
 #include "XXH128Hasher.hpp"
+#include "DescriptionInternPool.hpp"
 
 namespace Diligent
 {
@@ -56,10 +58,7 @@ public:
 
     virtual bool DILIGENT_CALL_TYPE Load(const IDataBlob* pArchive,
                                          Uint32           ContentVersion,
-                                         bool             MakeCopy) override final
-    {
-        return m_pDearchiver->LoadArchive(pArchive, ContentVersion, MakeCopy);
-    }
+                                         bool             MakeCopy) override final;
 
     virtual bool DILIGENT_CALL_TYPE CreateShader(const ShaderCreateInfo& ShaderCI,
                                                  IShader**               ppShader) override final;
@@ -119,6 +118,17 @@ public:
 
     RefCntAutoPtr<IShader> FindReloadableShader(IShader* pShader);
 
+    // Returns the pool that keeps strings and description arrays of async pipeline create infos.
+    // When the pool grows past MaxDescInternPoolSize, it is replaced with a new one, and the old
+    // pool is released once the last async pipeline that references it is destroyed.
+    std::shared_ptr<DescriptionInternPool> GetDescriptionInternPool()
+    {
+        std::lock_guard<std::mutex> Guard{m_DescInternPoolMtx};
+        if (m_pDescInternPool->GetMemorySize() >= MaxDescInternPoolSize)
+            m_pDescInternPool = std::make_shared<DescriptionInternPool>();
+        return m_pDescInternPool;
+    }
+
 private:
     static std::string MakeHashStr(const char* Name, const XXH128Hash& Hash);
 
@@ -153,6 +163,11 @@ private:
     std::mutex                                                          m_ReloadablePipelinesMtx;
     std::unordered_map<UniqueIdentifier, RefCntWeakPtr<IPipelineState>> m_ReloadablePipelines;
 
+    // Strings and description arrays shared by async pipelines created by the cache
+    static constexpr size_t                MaxDescInternPoolSize = size_t{16} << 20;
+    std::mutex                             m_DescInternPoolMtx;
+    std::shared_ptr<DescriptionInternPool> m_pDescInternPool = std::make_shared<DescriptionInternPool>();
+
     Uint32 m_ReloadVersion = 0;
 };
 
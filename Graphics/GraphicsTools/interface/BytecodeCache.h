@@ -35,9 +35,38 @@ DILIGENT_BEGIN_NAMESPACE(Diligent)
 struct BytecodeCacheCreateInfo
 {
     enum RENDER_DEVICE_TYPE DeviceType DEFAULT_INITIALIZER(RENDER_DEVICE_TYPE_UNDEFINED);
+
+    /// The maximum total size of the byte code kept in the cache, in bytes.
+
+    /// When the size is exceeded, the least recently used byte code is evicted.
+    /// The budget is evenly split between the internal shards of the cache,
+    /// so the eviction order is approximate.
+    /// Zero means the size of the cache is not limited.
+    Uint64 MaxSize DEFAULT_INITIALIZER(0);
 };
 typedef struct BytecodeCacheCreateInfo BytecodeCacheCreateInfo;
 
+
+/// Byte code cache statistics
+struct BytecodeCacheStats
+{
+    /// The number of byte code entries in the cache
+    Uint64 NumEntries   DEFAULT_INITIALIZER(0);
+
+    /// The total size of the byte code in the cache, in bytes
+    Uint64 TotalSize    DEFAULT_INITIALIZER(0);
+
+    /// The number of GetBytecode() calls that found the byte code
+    Uint64 NumHits      DEFAULT_INITIALIZER(0);
+
+    /// The number of GetBytecode() calls that did not find the byte code
+    Uint64 NumMisses    DEFAULT_INITIALIZER(0);
+
+    /// The number of entries evicted from the cache to stay within the size budget
+    Uint64 NumEvictions DEFAULT_INITIALIZER(0);
+};
+typedef struct BytecodeCacheStats BytecodeCacheStats;
+
 // clang-format on
 
 // {D1F8295F-F9D7-4CD4-9D13-D950FE7572C1}
@@ -53,12 +82,21 @@ static DILIGENT_CONSTEXPR INTERFACE_ID IID_BytecodeCache = {0xD1F8295F, 0xF9D7,
 // clang-format off
 
 /// Byte code cache interface
+
+/// All methods of the cache are thread-safe.
 DILIGENT_BEGIN_INTERFACE(IBytecodeCache, IObject)
 {
     /// Loads the cache data from the binary blob
 
     /// \param [in] pData - A pointer to the cache data.
     /// \return     true if the data was loaded successfully, and false otherwise.
+    ///
+    /// \remarks    The data may be produced by Store() followed by any number of journals
+    ///             produced by StoreJournal(). Later entries replace the earlier ones.
+    ///
+    ///             The byte code is not copied: the cache keeps a reference to the blob and
+    ///             returns the byte code as views into it. An application may thus pass a blob
+    ///             that wraps a memory-mapped cache file.
     VIRTUAL bool METHOD(Load)(THIS_
                               IDataBlob* pData) PURE;
 
@@ -101,9 +139,26 @@ DILIGENT_BEGIN_INTERFACE(IBytecodeCache, IObject)
     VIRTUAL void METHOD(Store)(THIS_
                                IDataBlob** ppDataBlob) PURE;
 
+    /// Writes the changes made since the last call to Store() or StoreJournal() to the binary data blob.
+
+    /// \param [out] ppDataBlob - Address of the memory location where a pointer to the
+    ///                           data blob containing the journal will be written.
+    ///                           The function calls AddRef(), so that the new object will have
+    ///                           one reference.
+    ///
+    /// \remarks    The journal records the added, replaced, removed and evicted byte code.
+    ///             It is intended to be appended to the data produced by Store(), so that the
+    ///             cache file does not need to be rewritten every time new byte code is added.
+    VIRTUAL void METHOD(StoreJournal)(THIS_
+                                      IDataBlob** ppDataBlob) PURE;
+
 
     /// Clears the cache and resets it to default state.
     VIRTUAL void METHOD(Clear)(THIS) PURE;
+
+    /// Returns the cache statistics.
+    VIRTUAL void METHOD(GetStats)(THIS_
+                                  BytecodeCacheStats REF Stats) CONST PURE;
 };
 DILIGENT_END_INTERFACE
 
@@ -117,7 +172,9 @@ DILIGENT_END_INTERFACE
 #    define IBytecodeCache_AddBytecode(This, ...)    CALL_IFACE_METHOD(BytecodeCache, AddBytecode,    This, __VA_ARGS__)
 #    define IBytecodeCache_RemoveBytecode(This, ...) CALL_IFACE_METHOD(BytecodeCache, RemoveBytecode, This, __VA_ARGS__)
 #    define IBytecodeCache_Store(This, ...)          CALL_IFACE_METHOD(BytecodeCache, Store,          This, __VA_ARGS__)
+#    define IBytecodeCache_StoreJournal(This, ...)   CALL_IFACE_METHOD(BytecodeCache, StoreJournal,   This, __VA_ARGS__)
 #    define IBytecodeCache_Clear(This)               CALL_IFACE_METHOD(BytecodeCache, Clear,          This)
+#    define IBytecodeCache_GetStats(This, ...)       CALL_IFACE_METHOD(BytecodeCache, GetStats,       This, __VA_ARGS__)
 // clang-format on
 
 #endif
@@ -0,0 +1,426 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Definition of the Diligent::FrameProfiler class
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "../../GraphicsEngine/interface/RenderDevice.h"
+#include "../../GraphicsEngine/interface/DeviceContext.h"
+#include "../../GraphicsEngine/interface/Query.h"
+#include "../../../Common/interface/RefCntAutoPtr.hpp"
+
+namespace Diligent
+{
+
+/// Hierarchical CPU and GPU frame profiler.
+
+/// The profiler records nested zones on the CPU and on the GPU and places them on a common timeline:
+///
+///     CPU thread 0  | Frame                                    |
+///                   |  | Update |  | Render                |   |
+///     CPU thread 1  |      | Culling |                          |
+///     GPU           |             | Frame                            |
+///                   |             |  | Shadows |  | Main pass |      |
+///
+/// GPU zones are measured with timestamp queries that are allocated from a pool and recycled
+/// once the frame results have been read back. The results are read without stalling, so they
+/// typically become available a few frames after the frame has been recorded.
+///
+/// CPU zones may be recorded by any thread. Every thread writes completed zones into its own
+/// single-producer ring buffer, so recording a zone never takes a lock. The buffers are drained
+/// by EndFrame(). If a buffer overflows, new events are dropped and counted. When a thread exits,
+/// its buffer is retired: the remaining events are collected by the next EndFrame() and the
+/// buffer is then released.
+///
+/// GPU timestamps are converted to the CPU timeline using the offset estimated from the CPU time
+/// at which every frame timestamp query is issued (see Calibrate()).
+///
+/// Rolling statistics are maintained for every zone and for the frame as a whole, and
+/// the recorded events can be exported in the Chrome trace event format that can be loaded
+/// into chrome://tracing or Perfetto UI. The trace is written by ChromeTraceWriter, so it uses
+/// the same clock, process and thread ids as other engine traces and can be merged with them.
+///
+/// \remarks    BeginFrame(), EndFrame() as well as GPU zone methods must be called from the same thread
+///             and with the same device context. CPU zone methods may be called from any thread.
+///             Zone names must be string literals or otherwise outlive the profiler.
+class FrameProfiler
+{
+public:
+    struct CreateInfo
+    {
+        /// The number of timestamp queries to create up-front.
+        Uint32 NumQueriesToReserve = 64;
+
+        /// The expected number of frames whose GPU results are pending.
+        /// A warning is printed if this limit is exceeded.
+        Uint32 ExpectedFrameLatency = 5;
+
+        /// The number of samples used to compute rolling statistics.
+        Uint32 StatisticsWindow = 64;
+
+        /// The number of frames used to estimate the offset between GPU and CPU timelines.
+        Uint32 CalibrationWindow = 256;
+
+        /// The capacity of the per-thread CPU event buffer.
+        Uint32 MaxCPUEventsPerThread = 4096;
+
+        /// The maximum number of events kept for trace export.
+        Uint32 MaxTraceEvents = 65536;
+    };
+
+    /// Creates the profiler.
+
+    /// \param [in] pDevice - Render device that is used to create timestamp queries.
+    ///                       If the device is null or does not support timestamp queries,
+    ///                       only CPU zones are recorded.
+    /// \param [in] CI      - Profiler create info.
+    FrameProfiler(IRenderDevice* pDevice, const CreateInfo& CI);
+    explicit FrameProfiler(IRenderDevice* pDevice);
+    ~FrameProfiler();
+
+    // clang-format off
+    FrameProfiler           (const FrameProfiler&) = delete;
+    FrameProfiler& operator=(const FrameProfiler&) = delete;
+    FrameProfiler           (FrameProfiler&&)      = delete;
+    FrameProfiler& operator=(FrameProfiler&&)      = delete;
+    // clang-format on
+
+
+    /// Begins a new frame.
+
+    /// \param [in] pCtx - Context to record the frame start timestamp. May be null if GPU profiling is disabled.
+    void BeginFrame(IDeviceContext* pCtx);
+
+
+    /// Ends the frame, collects CPU events recorded by all threads and reads back
+    /// the GPU results of previous frames that are already available.
+    void EndFrame(IDeviceContext* pCtx);
+
+
+    /// Begins a GPU zone. GPU zones may be nested and must be recorded between BeginFrame() and EndFrame().
+    void BeginGPUZone(IDeviceContext* pCtx, const char* Name);
+
+    /// Ends the most recent GPU zone.
+    void EndGPUZone(IDeviceContext* pCtx);
+
+
+    /// Begins a CPU zone on the calling thread. CPU zones may be nested.
+    void BeginCPUZone(const char* Name);
+
+    /// Ends the most recent CPU zone of the calling thread.
+    void EndCPUZone();
+
+
+    /// Sets the name of the calling thread that is shown in the trace.
+    void SetThreadName(const char* Name);
+
+
+    /// Measures the offset between the GPU and CPU timelines by waiting for the context to become idle.
+
+    /// The offset is also estimated continuously from the frame timestamps. That estimate is exact
+    /// when the GPU is waiting for the CPU, which is the case this method forces.
+    /// The method stalls the CPU and should not be called every frame.
+    ///
+    /// \return     true if the calibration succeeded, and false otherwise.
+    bool Calibrate(IDeviceContext* pCtx);
+
+
+    enum class ZONE_TYPE : Uint8
+    {
+        CPU,
+        GPU
+    };
+
+    struct RollingStatistics
+    {
+        /// The last sample, in seconds.
+        double Last = 0;
+
+        /// The average, minimum and maximum values over the statistics window, in seconds.
+        double Average = 0;
+        double Min     = 0;
+        double Max     = 0;
+
+        /// The total number of samples.
+        Uint64 Count = 0;
+    };
+
+    struct ZoneStatistics
+    {
+        const char* Name  = nullptr;
+        ZONE_TYPE   Type  = ZONE_TYPE::CPU;
+        Uint32      Depth = 0;
+
+        /// Zone duration statistics. Every zone instance is a separate sample.
+        RollingStatistics Duration;
+    };
+
+    struct FrameStatistics
+    {
+        /// The number of frames recorded and the number of frames whose GPU results have been read back.
+        Uint64 NumFrames         = 0;
+        Uint64 NumResolvedFrames = 0;
+
+        /// The number of CPU events dropped due to buffer overflows.
+        Uint64 NumDroppedCPUEvents = 0;
+
+        /// CPU time between BeginFrame() and EndFrame().
+        RollingStatistics CPUTime;
+
+        /// GPU time between the frame start and end timestamps.
+        RollingStatistics GPUTime;
+
+        /// Time during which the GPU was not executing any top-level GPU zone, starting from the end of
+        /// the previous frame. When all GPU work is enclosed in zones, this is the time the GPU was waiting
+        /// for the CPU to submit commands.
+        RollingStatistics GPUIdleTime;
+
+        /// Time between the end of the frame on the CPU and the end of the frame on the GPU.
+        RollingStatistics Latency;
+
+        /// The offset, in seconds, that is added to GPU time to convert it to the CPU timeline.
+        double GPUToCPUOffset = 0;
+    };
+
+    /// Returns statistics of all zones recorded so far.
+    std::vector<ZoneStatistics> GetZoneStatistics() const;
+
+    /// Returns frame statistics.
+    FrameStatistics GetFrameStatistics() const;
+
+
+    /// Returns the recorded events in the Chrome trace event JSON format.
+    std::string GetChromeTrace() const;
+
+    /// Writes the recorded events in the Chrome trace event JSON format to a file.
+    bool SaveChromeTrace(const char* FilePath) const;
+
+
+    bool IsGPUProfilingEnabled() const { return m_pDevice != nullptr; }
+
+    /// Returns the number of CPU event buffers of the threads that are alive and have recorded zones.
+    size_t GetNumThreadBuffers() const;
+
+private:
+    using TimePoint = std::chrono::steady_clock::time_point;
+
+    // Time, in seconds, since the profiler was created
+    double GetTime() const;
+
+    // Converts the profiler time to the trace clock, see ChromeTraceWriter::GetTimestamp()
+    Uint64 GetTraceTimestamp(double Time) const;
+
+    struct CPUEvent
+    {
+        const char* Name  = nullptr;
+        double      Begin = 0;
+        double      End   = 0;
+        Uint32      Depth = 0;
+    };
+
+    struct ThreadBuffer;
+    struct ThreadRegistry;
+    class ThreadBufferHolder;
+    ThreadBuffer& GetThreadBuffer();
+
+    struct GPUZone
+    {
+        const char* Name  = nullptr;
+        Uint32      Depth = 0;
+
+        RefCntAutoPtr<IQuery> pBegin;
+        RefCntAutoPtr<IQuery> pEnd;
+    };
+
+    struct FrameData
+    {
+        double CPUBegin = 0;
+        double CPUEnd   = 0;
+
+        RefCntAutoPtr<IQuery> pBegin;
+        RefCntAutoPtr<IQuery> pEnd;
+
+        std::vector<GPUZone> Zones;
+    };
+
+    RefCntAutoPtr<IQuery> AllocateQuery();
+    void                  RecycleQuery(RefCntAutoPtr<IQuery>&& pQuery);
+    void                  RecycleFrame(FrameData& Frame);
+
+    void ResolveGPUFrames();
+    void CollectCPUEvents();
+    void AddCalibrationSample(double CPUTime, double GPUTime);
+
+    class SampleWindow
+    {
+    public:
+        explicit SampleWindow(Uint32 Size = 0) :
+            m_Size{std::max(Size, 1u)}
+        {}
+
+        void              Add(double Sample);
+        RollingStatistics Get() const;
+
+    private:
+        Uint32              m_Size;
+        std::vector<double> m_Samples;
+        size_t              m_Pos   = 0;
+        Uint64              m_Count = 0;
+        double              m_Last  = 0;
+    };
+
+    struct ZoneStatisticsEntry
+    {
+        const char*  Name  = nullptr;
+        ZONE_TYPE    Type  = ZONE_TYPE::CPU;
+        Uint32       Depth = 0;
+        SampleWindow Duration;
+    };
+    void AddZoneSample(ZONE_TYPE Type, const char* Name, Uint32 Depth, double Duration);
+
+    struct TraceEvent
+    {
+        const char* Name = nullptr;
+        ZONE_TYPE   Type = ZONE_TYPE::CPU;
+        // Trace thread id for CPU events
+        Uint32 ThreadIdx = 0;
+        double Begin     = 0;
+        double Duration  = 0;
+    };
+    void AddTraceEvent(const TraceEvent& Event);
+
+private:
+    const CreateInfo m_CI;
+    const TimePoint  m_StartTime;
+    const Uint64     m_StartTimestamp;
+
+    // Unique profiler identifier used to find the profiler's buffer among the buffers of the thread
+    const Uint32 m_ProfilerId;
+
+    RefCntAutoPtr<IRenderDevice> m_pDevice;
+
+    // The registry is shared with the threads, so that a thread that exits
+    // after the profiler has been destroyed does not access released memory.
+    const std::shared_ptr<ThreadRegistry> m_pThreadRegistry;
+
+    bool                               m_FrameInProgress = false;
+    FrameData                          m_CurrFrame;
+    std::vector<size_t>                m_GPUZoneStack;
+    std::deque<FrameData>              m_PendingFrames;
+    std::vector<RefCntAutoPtr<IQuery>> m_AvailableQueries;
+
+    // Lower bounds of the GPU to CPU offset, see AddCalibrationSample()
+    std::deque<double> m_CalibrationSamples;
+
+    // GPU time of the end of the last resolved frame
+    double m_LastGPUFrameEnd = 0;
+
+    // Protects statistics and trace events
+    mutable std::mutex m_StatsMtx;
+
+    std::unordered_map<std::string, ZoneStatisticsEntry> m_ZoneStats;
+    // Zone statistics lookup by the name pointer for every zone type
+    std::unordered_map<const char*, ZoneStatisticsEntry*> m_ZoneStatsLookup[2];
+
+    Uint64       m_NumResolvedFrames = 0;
+    double       m_GPUToCPUOffset    = 0;
+    SampleWindow m_CPUFrameTime;
+    SampleWindow m_GPUFrameTime;
+    SampleWindow m_GPUIdleTime;
+    SampleWindow m_Latency;
+
+    std::deque<TraceEvent> m_TraceEvents;
+};
+
+
+/// Records a CPU zone for the lifetime of the object.
+class ScopedCPUZone
+{
+public:
+    ScopedCPUZone(FrameProfiler& Profiler, const char* Name) :
+        m_Profiler{Profiler}
+    {
+        m_Profiler.BeginCPUZone(Name);
+    }
+
+    ~ScopedCPUZone()
+    {
+        m_Profiler.EndCPUZone();
+    }
+
+    // clang-format off
+    ScopedCPUZone           (const ScopedCPUZone&) = delete;
+    ScopedCPUZone& operator=(const ScopedCPUZone&) = delete;
+    ScopedCPUZone           (ScopedCPUZone&&)      = delete;
+    ScopedCPUZone& operator=(ScopedCPUZone&&)      = delete;
+    // clang-format on
+
+private:
+    FrameProfiler& m_Profiler;
+};
+
+
+/// Records a GPU zone for the lifetime of the object.
+class ScopedGPUZone
+{
+public:
+    ScopedGPUZone(FrameProfiler& Profiler, IDeviceContext* pCtx, const char* Name) :
+        m_Profiler{Profiler},
+        m_pCtx{pCtx}
+    {
+        m_Profiler.BeginGPUZone(m_pCtx, Name);
+    }
+
+    ~ScopedGPUZone()
+    {
+        m_Profiler.EndGPUZone(m_pCtx);
+    }
+
+    // clang-format off
+    ScopedGPUZone           (const ScopedGPUZone&) = delete;
+    ScopedGPUZone& operator=(const ScopedGPUZone&) = delete;
+    ScopedGPUZone           (ScopedGPUZone&&)      = delete;
+    ScopedGPUZone& operator=(ScopedGPUZone&&)      = delete;
+    // clang-format on
+
+private:
+    FrameProfiler&  m_Profiler;
+    IDeviceContext* m_pCtx;
+};
+
+} // namespace Diligent
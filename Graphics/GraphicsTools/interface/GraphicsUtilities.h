@@ -228,6 +228,8 @@ IBufferView* DILIGENT_GLOBAL_FUNCTION(GetBufferDefaultUAV)(IObject* pBuffer);
 const char* DILIGENT_GLOBAL_FUNCTION(GetWebGPUEmulatedArrayIndexSuffix)(IShader* pShader);
 
 /// Returns the native texture format (e.g. DXGI_FORMAT, VkFormat) for the given texture format and device type.
+///
+/// The null device has no native formats, and the texture format value itself is returned.
 int64_t DILIGENT_GLOBAL_FUNCTION(GetNativeTextureFormat)(TEXTURE_FORMAT TexFormat, enum RENDER_DEVICE_TYPE DeviceType);
 
 /// Returns the texture format for the given native format (e.g. DXGI_FORMAT, VkFormat) and device type.
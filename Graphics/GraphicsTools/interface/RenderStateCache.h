@@ -254,6 +254,10 @@ DILIGENT_BEGIN_INTERFACE(IRenderStateCache, IObject)
     ///
     /// \remarks    If ContentVersion is `~0u` (aka `0xFFFFFFFF`), the version of the
     ///             previously loaded content will be used, or 0 if none was loaded.
+    ///
+    ///             In OpenGL, if the program binary cache is enabled (see
+    ///             Diligent::EngineGLCreateInfo::EnableProgramBinaryCache), the blob also
+    ///             contains program binaries that are loaded by IRenderStateCache::Load().
     VIRTUAL Bool METHOD(WriteToBlob)(THIS_
                                      Uint32      ContentVersion, 
                                      IDataBlob** ppBlob) PURE;
@@ -30,21 +30,149 @@
 #include <mutex>
 #include <vector>
 #include <deque>
+#include <memory>
+#include <chrono>
+#include <algorithm>
+#include <functional>
 
 #include "../../GraphicsEngine/interface/SwapChain.h"
 #include "../../GraphicsEngine/interface/RenderDevice.h"
 #include "../../GraphicsEngine/interface/DeviceContext.h"
+#include "../../../Primitives/interface/DataBlob.h"
 #include "../../../Common/interface/RefCntAutoPtr.hpp"
+#include "../../../Common/interface/ThreadPool.h"
 
 namespace Diligent
 {
 
+/// Screen capture utility.
+
+/// The class copies the back buffer into a staging texture and signals a fence.
+/// There are two ways to consume the captures:
+///
+/// * Manual: the application calls GetCapture() to get the staging textures whose copies are complete,
+///   maps them, and returns them with RecycleStagingTexture().
+///
+/// * Pipelined: the application calls Poll() once per frame. Poll() maps completed staging textures
+///   and hands the mapped rows to the thread pool (or processes them immediately if no thread pool is given),
+///   where they are converted to RGBA8 and optionally encoded to PNG. The texture is unmapped and
+///   reused when the worker is done with it. The results are delivered through the
+///   CreateInfo::OnCaptureEncoded callback or GetEncodedCapture().
+///
+/// The manual and pipelined modes must not be mixed.
 class ScreenCapture
 {
 public:
+    enum class ENCODING
+    {
+        /// Tightly packed RGBA8 pixels
+        RGBA8,
+
+        /// PNG file data
+        PNG
+    };
+
+    struct EncodedCapture
+    {
+        /// Frame id passed to Capture()
+        Uint32 Id = 0;
+
+        Uint32 Width  = 0;
+        Uint32 Height = 0;
+
+        ENCODING Encoding = ENCODING::PNG;
+
+        /// Encoded image data
+        RefCntAutoPtr<IDataBlob> pData;
+
+        explicit operator bool() const
+        {
+            return pData != nullptr;
+        }
+    };
+
+    struct CreateInfo
+    {
+        /// The maximum number of staging textures in flight, i.e. captures that are being copied
+        /// by the GPU or processed by the workers. When the limit is reached, Capture() either skips the
+        /// frame or waits for the oldest capture, see WaitWhenFull. Zero means no limit.
+        Uint32 MaxCapturesInFlight = 0;
+
+        /// Whether Capture() should wait for the oldest capture when MaxCapturesInFlight is reached.
+        /// If false, the frame is skipped. Waiting is only supported in the pipelined mode.
+        bool WaitWhenFull = false;
+
+        /// An optional thread pool that converts and encodes the captures.
+        /// If null, the captures are processed by Poll().
+        IThreadPool* pThreadPool = nullptr;
+
+        ENCODING Encoding = ENCODING::PNG;
+
+        /// An optional callback that is called when the capture is encoded.
+        /// If the thread pool is used, the callback is called from the worker thread.
+        /// If the callback is not set, the captures are returned by GetEncodedCapture().
+        std::function<void(EncodedCapture&&)> OnCaptureEncoded = nullptr;
+    };
+
+    /// Per-stage latency statistics, in milliseconds.
+    struct LatencyStats
+    {
+        double Average = 0;
+        double Max     = 0;
+        Uint64 Count   = 0;
+
+        void Add(double Value)
+        {
+            Average = (Average * static_cast<double>(Count) + Value) / static_cast<double>(Count + 1);
+            Max     = (std::max)(Max, Value);
+            ++Count;
+        }
+    };
+
+    struct Statistics
+    {
+        /// The number of frames copied to the staging textures
+        Uint64 NumCaptured = 0;
+
+        /// The number of frames skipped because MaxCapturesInFlight was reached
+        Uint64 NumDropped = 0;
+
+        /// The number of captures converted and encoded
+        Uint64 NumEncoded = 0;
+
+        /// Time between Capture() and the moment Poll() finds the copy complete
+        LatencyStats Readback;
+
+        /// Time to map the staging texture
+        LatencyStats Map;
+
+        /// Time between the hand-off to the thread pool and the start of the processing
+        LatencyStats Queue;
+
+        /// Time to convert the pixels to RGBA8
+        LatencyStats Convert;
+
+        /// Time to encode the image
+        LatencyStats Encode;
+
+        /// Time between Capture() and the end of encoding
+        LatencyStats Total;
+    };
+
     ScreenCapture(IRenderDevice* pDevice);
+    ScreenCapture(IRenderDevice* pDevice, const CreateInfo& CI);
+    ~ScreenCapture();
 
-    void Capture(ISwapChain* pSwapChain, IDeviceContext* pContext, Uint32 FrameId);
+    // clang-format off
+    ScreenCapture             (const ScreenCapture&)  = delete;
+    ScreenCapture             (      ScreenCapture&&) = delete;
+    ScreenCapture& operator = (const ScreenCapture&)  = delete;
+    ScreenCapture& operator = (      ScreenCapture&&) = delete;
+    // clang-format on
+
+    /// Copies the current back buffer of the swap chain into a staging texture.
+    /// Returns false if the frame was skipped because MaxCapturesInFlight was reached.
+    bool Capture(ISwapChain* pSwapChain, IDeviceContext* pContext, Uint32 FrameId);
 
     struct CaptureInfo
     {
@@ -68,7 +196,33 @@ public:
         return m_PendingTextures.size();
     }
 
+    /// Advances the capture pipeline: maps the staging textures whose copies are complete and starts
+    /// processing them, and unmaps and recycles the textures that have been processed.
+    /// Must be called from the thread that owns the device context.
+    void Poll(IDeviceContext* pContext);
+
+    /// Waits until all captures are processed. Must be called before the object is destroyed
+    /// if the pipelined mode is used.
+    void WaitForIdle(IDeviceContext* pContext);
+
+    /// Returns the oldest encoded capture, if any, when CreateInfo::OnCaptureEncoded is not set.
+    EncodedCapture GetEncodedCapture();
+
+    Statistics GetStatistics();
+
 private:
+    using TimePoint = std::chrono::steady_clock::time_point;
+
+    struct ProcessingCapture;
+
+    size_t GetNumCapturesInFlight();
+    void   ProcessCapture(ProcessingCapture& Capture);
+    void   RecycleProcessedCaptures(IDeviceContext* pContext, bool Wait);
+    void   AddEncodedCapture(EncodedCapture&& Capture);
+
+private:
+    const CreateInfo m_CI;
+
     RefCntAutoPtr<IFence>        m_pFence;
     RefCntAutoPtr<IRenderDevice> m_pDevice;
 
@@ -78,11 +232,12 @@ private:
     std::mutex m_PendingTexturesMtx;
     struct PendingTextureInfo
     {
-        PendingTextureInfo(RefCntAutoPtr<ITexture>&& _pTex, Uint32 _Id, Uint64 _Fence) :
+        PendingTextureInfo(RefCntAutoPtr<ITexture>&& _pTex, Uint32 _Id, Uint64 _Fence, TimePoint _CaptureTime) :
             // clang-format off
-            pTex    {std::move(_pTex)},
-            Id      {_Id             },
-            Fence   {_Fence          }
+            pTex       {std::move(_pTex)},
+            Id         {_Id             },
+            Fence      {_Fence          },
+            CaptureTime{_CaptureTime    }
         // clang-format on
         {
         }
@@ -90,9 +245,19 @@ private:
         RefCntAutoPtr<ITexture> pTex;
         const Uint32            Id;
         const Uint64            Fence;
+        const TimePoint         CaptureTime;
     };
     std::deque<PendingTextureInfo> m_PendingTextures;
 
+    // Captures whose staging textures are mapped and are being processed
+    std::vector<std::unique_ptr<ProcessingCapture>> m_ProcessingCaptures;
+
+    std::mutex                 m_EncodedCapturesMtx;
+    std::deque<EncodedCapture> m_EncodedCaptures;
+
+    std::mutex m_StatsMtx;
+    Statistics m_Stats;
+
     Uint64 m_CurrentFenceValue = 1;
 };
 
@@ -27,7 +27,10 @@
 
 #pragma once
 
+#include <algorithm>
+#include <atomic>
 #include <functional>
+#include <memory>
 #include <vector>
 #include <string>
 
@@ -35,6 +38,7 @@
 #include "../../GraphicsEngine/interface/DeviceContext.h"
 #include "../../GraphicsEngine/interface/Buffer.h"
 #include "../../../Common/interface/RefCntAutoPtr.hpp"
+#include "../../../Common/interface/Align.hpp"
 #include "MapHelper.hpp"
 
 namespace Diligent
@@ -47,6 +51,10 @@ struct StreamingBufferCreateInfo
     std::function<void(IBuffer*)> OnBufferResizeCallback = nullptr;
     Uint32                        NumContexts            = 1;
     bool                          AllowPersistentMapping = false;
+
+    // Initial capacity of the draw range list of the shared frame (see StreamingBuffer::BeginSharedFrame).
+    // The list grows automatically if a frame records more ranges.
+    Uint32 NumSharedRanges = 256;
 };
 
 class StreamingBuffer
@@ -57,6 +65,8 @@ public:
 
     explicit StreamingBuffer(const StreamingBufferCreateInfo& CI) :
         m_UsePersistentMap{CI.AllowPersistentMapping && (CI.pDevice->GetDeviceInfo().Type == RENDER_DEVICE_TYPE_VULKAN || CI.pDevice->GetDeviceInfo().Type == RENDER_DEVICE_TYPE_D3D12)},
+        m_DiscardEveryFrame{CI.pDevice->GetDeviceInfo().Type != RENDER_DEVICE_TYPE_D3D11 && !CI.pDevice->GetDeviceInfo().IsGLDevice()},
+        m_NumSharedRanges{std::max(CI.NumSharedRanges, 1u)},
         m_BufferSize{CI.BuffDesc.Size},
         m_OnBufferResizeCallback{CI.OnBufferResizeCallback},
         m_MapInfo(CI.NumContexts)
@@ -81,6 +91,7 @@ public:
         {
             VERIFY(!mapInfo.m_MappedData, "Destroying streaming buffer that is still mapped");
         }
+        VERIFY(!m_pSharedFrame || !m_pSharedFrame->MappedData, "Destroying streaming buffer while the shared frame is in progress");
     }
 
     // Returns offset of the allocated region
@@ -97,23 +108,7 @@ public:
             VERIFY_EXPR(MapInfo.m_CurrOffset == 0);
 
             if (Size > m_BufferSize)
-            {
-                while (m_BufferSize < Size)
-                    m_BufferSize *= 2;
-
-                auto BuffDesc = m_pBuffer->GetDesc();
-                BuffDesc.Size = m_BufferSize;
-                // BuffDesc.Name becomes invalid after old buffer is released
-                std::string Name = BuffDesc.Name;
-                BuffDesc.Name    = Name.c_str();
-
-                m_pBuffer.Release();
-                pDevice->CreateBuffer(BuffDesc, nullptr, &m_pBuffer);
-                if (m_OnBufferResizeCallback)
-                    m_OnBufferResizeCallback(m_pBuffer);
-
-                LOG_INFO_MESSAGE("Extended streaming buffer '", BuffDesc.Name, "' to ", m_BufferSize, " bytes");
-            }
+                Resize(pDevice, Size);
         }
 
         if (!m_UsePersistentMap)
@@ -173,9 +168,171 @@ public:
         return m_MapInfo[CtxNum].m_MappedData;
     }
 
+
+    // Shared frame mode allows multiple threads to write data for the same frame:
+    //
+    //  - The render thread calls BeginSharedFrame() that maps the buffer.
+    //  - Worker threads call Allocate() that reserves a range in the mapped region with an atomic
+    //    bump pointer and records it in the frame draw range list. No locks are taken.
+    //  - After all workers have finished writing, the render thread calls EndSharedFrame() that unmaps
+    //    the buffer and returns the list of ranges recorded in this frame sorted by offset.
+    //
+    // Every frame continues from where the previous frame ended and maps the buffer with MAP_FLAG_NO_OVERWRITE.
+    // When the remaining space is not enough for the previous frame's demand, the buffer wraps around and is
+    // mapped with MAP_FLAG_DISCARD, which lets the backend protect the regions still used by the GPU with its
+    // frame fences. Backends whose dynamic buffers are only valid for a single frame (D3D12, Vulkan, etc.) always
+    // discard the buffer at the beginning of the frame.
+    //
+    // If an allocation does not fit into the buffer, Allocate() returns an empty allocation and the
+    // buffer is extended at the beginning of the next frame to accommodate the full demand.
+    // Shared frame mode must not be mixed with Map()/Unmap().
+
+    struct SharedAllocation
+    {
+        Uint32 Offset = 0;
+        Uint32 Size   = 0;
+        void*  pData  = nullptr;
+
+        explicit operator bool() const { return pData != nullptr; }
+    };
+
+    struct DrawRange
+    {
+        Uint32 Offset   = 0;
+        Uint32 Size     = 0;
+        Uint64 UserData = 0;
+    };
+
+    void BeginSharedFrame(IDeviceContext* pCtx, IRenderDevice* pDevice)
+    {
+        if (!m_pSharedFrame)
+            m_pSharedFrame = std::make_unique<SharedFrameState>();
+
+        SharedFrameState& Frame = *m_pSharedFrame;
+        VERIFY(!Frame.MappedData, "The shared frame is already in progress");
+#ifdef DILIGENT_DEBUG
+        for (const auto& mapInfo : m_MapInfo)
+        {
+            VERIFY(!mapInfo.m_MappedData && mapInfo.m_CurrOffset == 0, "Shared frame mode must not be mixed with Map()/Unmap()");
+        }
+#endif
+
+        Uint64 Offset = Frame.EndOffset;
+        if (Frame.LastFrameDemand > m_BufferSize)
+        {
+            Resize(pDevice, Frame.LastFrameDemand);
+            Offset = 0;
+        }
+        if (m_DiscardEveryFrame || Offset + Frame.LastFrameDemand > m_BufferSize)
+            Offset = 0;
+
+        if (Frame.Ranges.size() < m_NumSharedRanges)
+            Frame.Ranges.resize(m_NumSharedRanges);
+
+        Frame.MappedData.Map(pCtx, m_pBuffer, MAP_WRITE, Offset == 0 ? MAP_FLAG_DISCARD : MAP_FLAG_NO_OVERWRITE);
+        VERIFY_EXPR(Frame.MappedData);
+
+        Frame.BeginOffset = static_cast<Uint32>(Offset);
+        Frame.CurrOffset.store(static_cast<Uint32>(Offset));
+        Frame.NumRanges.store(0);
+        Frame.OverflowSize.store(0);
+    }
+
+    // Reserves Size bytes in the shared frame and records the draw range with the given user data.
+    // This method is thread-safe and may be called by any thread between BeginSharedFrame() and EndSharedFrame().
+    SharedAllocation Allocate(Uint32 Size, Uint32 Alignment = 16, Uint64 UserData = 0)
+    {
+        VERIFY_EXPR(Size > 0 && IsPowerOfTwo(Alignment));
+        VERIFY(m_pSharedFrame && m_pSharedFrame->MappedData, "Allocate() must be called between BeginSharedFrame() and EndSharedFrame()");
+
+        SharedFrameState& Frame = *m_pSharedFrame;
+
+        const Uint32 RangeIdx = Frame.NumRanges.fetch_add(1, std::memory_order_relaxed);
+        if (RangeIdx >= Frame.Ranges.size())
+        {
+            // The range list will be extended by EndSharedFrame()
+            return {};
+        }
+
+        Uint32 Offset = Frame.CurrOffset.load(std::memory_order_relaxed);
+        Uint32 AlignedOffset;
+        do
+        {
+            AlignedOffset = AlignUp(Offset, Alignment);
+            if (Uint64{AlignedOffset} + Size > m_BufferSize)
+            {
+                Frame.OverflowSize.fetch_add(Uint64{Size} + Alignment, std::memory_order_relaxed);
+                Frame.Ranges[RangeIdx] = {};
+                return {};
+            }
+        } while (!Frame.CurrOffset.compare_exchange_weak(Offset, AlignedOffset + Size, std::memory_order_relaxed));
+
+        Frame.Ranges[RangeIdx] = {AlignedOffset, Size, UserData};
+
+        return {AlignedOffset, Size, static_cast<Uint8*>(Frame.MappedData) + AlignedOffset};
+    }
+
+    // Unmaps the buffer and returns the draw ranges recorded in the frame sorted by offset.
+    // All threads must have finished writing the data before this method is called.
+    // The returned reference is valid until the next call to EndSharedFrame().
+    const std::vector<DrawRange>& EndSharedFrame()
+    {
+        VERIFY(m_pSharedFrame && m_pSharedFrame->MappedData, "EndSharedFrame() is called without matching BeginSharedFrame()");
+        SharedFrameState& Frame = *m_pSharedFrame;
+
+        Frame.MappedData.Unmap();
+
+        const Uint32 NumRanges = Frame.NumRanges.load();
+        Frame.FrameRanges.clear();
+        for (Uint32 i = 0; i < std::min(NumRanges, static_cast<Uint32>(Frame.Ranges.size())); ++i)
+        {
+            if (Frame.Ranges[i].Size != 0)
+                Frame.FrameRanges.push_back(Frame.Ranges[i]);
+        }
+        std::sort(Frame.FrameRanges.begin(), Frame.FrameRanges.end(),
+                  [](const DrawRange& lhs, const DrawRange& rhs) { return lhs.Offset < rhs.Offset; });
+
+        if (NumRanges > Frame.Ranges.size())
+        {
+            LOG_INFO_MESSAGE(NumRanges - Frame.Ranges.size(), " allocations in streaming buffer '", m_pBuffer->GetDesc().Name,
+                             "' failed because the draw range list is full. The list will be extended.");
+            m_NumSharedRanges = std::max(NumRanges, m_NumSharedRanges * 2);
+        }
+
+        Frame.EndOffset       = Frame.CurrOffset.load();
+        Frame.LastFrameDemand = Frame.EndOffset - Frame.BeginOffset + Frame.OverflowSize.load();
+
+        return Frame.FrameRanges;
+    }
+
+private:
+    void Resize(IRenderDevice* pDevice, Uint64 RequiredSize)
+    {
+        while (m_BufferSize < RequiredSize)
+            m_BufferSize *= 2;
+
+        auto BuffDesc = m_pBuffer->GetDesc();
+        BuffDesc.Size = m_BufferSize;
+        // BuffDesc.Name becomes invalid after old buffer is released
+        std::string Name = BuffDesc.Name;
+        BuffDesc.Name    = Name.c_str();
+
+        m_pBuffer.Release();
+        pDevice->CreateBuffer(BuffDesc, nullptr, &m_pBuffer);
+        if (m_OnBufferResizeCallback)
+            m_OnBufferResizeCallback(m_pBuffer);
+
+        LOG_INFO_MESSAGE("Extended streaming buffer '", BuffDesc.Name, "' to ", m_BufferSize, " bytes");
+    }
+
 private:
     bool m_UsePersistentMap = false;
 
+    // Whether dynamic buffer contents are only valid until the end of the frame
+    bool m_DiscardEveryFrame = false;
+
+    Uint32 m_NumSharedRanges = 0;
+
     Uint64 m_BufferSize = 0;
 
     RefCntAutoPtr<IBuffer> m_pBuffer;
@@ -189,6 +346,28 @@ private:
     };
     // We need to keep track of mapped data for every context
     std::vector<MapInfo> m_MapInfo;
+
+    struct SharedFrameState
+    {
+        MapHelper<Uint8> MappedData;
+
+        // The frame region starts at BeginOffset, CurrOffset is the atomic bump pointer
+        Uint32              BeginOffset = 0;
+        std::atomic<Uint32> CurrOffset{0};
+
+        std::atomic<Uint32>    NumRanges{0};
+        std::vector<DrawRange> Ranges;
+        std::vector<DrawRange> FrameRanges;
+
+        // The total size of the allocations that did not fit into the buffer
+        std::atomic<Uint64> OverflowSize{0};
+
+        // End of the previous frame region and the total size requested by the previous frame
+        Uint64 EndOffset       = 0;
+        Uint64 LastFrameDemand = 0;
+    };
+    // Shared frame state is kept in a separate object to keep the buffer movable
+    std::unique_ptr<SharedFrameState> m_pSharedFrame;
 };
 
 } // namespace Diligent
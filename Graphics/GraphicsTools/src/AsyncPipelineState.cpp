@@ -29,6 +29,7 @@
 #include "RenderStateCacheImpl.hpp"
 #include "ReloadableShader.hpp"
 #include "GraphicsTypesX.hpp"
+#include "DescriptionInternPool.hpp"
 #include "GraphicsAccessories.hpp"
 
 namespace Diligent
@@ -43,14 +44,73 @@ struct AsyncPipelineState::CreateInfoWrapperBase
     virtual SHADER_STATUS GetShadersStatus(bool WaitForCompletion) const = 0;
 };
 
+namespace
+{
+
+void InternPipelineTypeData(GraphicsPipelineStateCreateInfo& CI, DescriptionInternPool& Pool, std::vector<RefCntAutoPtr<IDeviceObject>>& Objects)
+{
+    CI.GraphicsPipeline.InputLayout = Pool.Intern(CI.GraphicsPipeline.InputLayout);
+    if (CI.GraphicsPipeline.pRenderPass != nullptr)
+        Objects.emplace_back(CI.GraphicsPipeline.pRenderPass);
+}
+
+void InternPipelineTypeData(RayTracingPipelineStateCreateInfo& CI, DescriptionInternPool& Pool, std::vector<RefCntAutoPtr<IDeviceObject>>& Objects)
+{
+    CI.pGeneralShaders       = Pool.GetArray(CI.pGeneralShaders, CI.GeneralShaderCount);
+    CI.pTriangleHitShaders   = Pool.GetArray(CI.pTriangleHitShaders, CI.TriangleHitShaderCount);
+    CI.pProceduralHitShaders = Pool.GetArray(CI.pProceduralHitShaders, CI.ProceduralHitShaderCount);
+    CI.pShaderRecordName     = Pool.GetString(CI.pShaderRecordName);
+}
+
+void InternPipelineTypeData(ComputePipelineStateCreateInfo& CI, DescriptionInternPool& Pool, std::vector<RefCntAutoPtr<IDeviceObject>>& Objects)
+{
+}
+
+void InternPipelineTypeData(TilePipelineStateCreateInfo& CI, DescriptionInternPool& Pool, std::vector<RefCntAutoPtr<IDeviceObject>>& Objects)
+{
+}
+
+} // namespace
+
+// Keeps a shallow copy of the pipeline create info. All strings and description arrays are
+// stored in the intern pool of the render state cache, so that identical layouts of many
+// pipelines share the same memory. Only object references and the signature array are
+// owned by the wrapper.
 template <typename CreateInfoType>
 struct AsyncPipelineState::CreateInfoWrapper : CreateInfoWrapperBase
 {
-    CreateInfoWrapper(const CreateInfoType& CI) :
-        m_CI{CI}
+    CreateInfoWrapper(const CreateInfoType& CI, std::shared_ptr<DescriptionInternPool> pInternPool) :
+        m_pInternPool{std::move(pInternPool)},
+        m_CI{CI},
+        m_Signatures(CI.ppResourceSignatures, CI.ppResourceSignatures + CI.ResourceSignaturesCount),
+        m_InternalData{CopyPSOCreateInternalInfo(CI.pInternalData)}
     {
+        DescriptionInternPool& Pool = *m_pInternPool;
+
+        m_CI.PSODesc.Name             = Pool.GetString(CI.PSODesc.Name);
+        m_CI.PSODesc.ResourceLayout   = Pool.Intern(CI.PSODesc.ResourceLayout);
+        m_CI.pSpecializationConstants = Pool.GetArray(CI.pSpecializationConstants, CI.NumSpecializationConstants);
+        m_CI.ppResourceSignatures     = !m_Signatures.empty() ? m_Signatures.data() : nullptr;
+        m_CI.pInternalData            = m_InternalData.get();
+        InternPipelineTypeData(m_CI, Pool, m_Objects);
+
+        for (IPipelineResourceSignature* pSignature : m_Signatures)
+            m_Objects.emplace_back(pSignature);
+        if (m_CI.pPSOCache != nullptr)
+            m_Objects.emplace_back(m_CI.pPSOCache);
+        ProcessPipelineStateCreateInfoShaders(m_CI, [this](IShader* pShader) {
+            if (pShader != nullptr)
+                m_Objects.emplace_back(pShader);
+        });
     }
 
+    // clang-format off
+    CreateInfoWrapper           (const CreateInfoWrapper&)  = delete;
+    CreateInfoWrapper           (      CreateInfoWrapper&&) = delete;
+    CreateInfoWrapper& operator=(const CreateInfoWrapper&)  = delete;
+    CreateInfoWrapper& operator=(      CreateInfoWrapper&&) = delete;
+    // clang-format on
+
     const CreateInfoType& Get() const
     {
         return m_CI;
@@ -67,7 +127,12 @@ struct AsyncPipelineState::CreateInfoWrapper : CreateInfoWrapperBase
     }
 
 protected:
-    typename PipelineStateCreateInfoXTraits<CreateInfoType>::CreateInfoXType m_CI;
+    // Keeps the interned strings and arrays referenced by m_CI alive
+    std::shared_ptr<DescriptionInternPool>    m_pInternPool;
+    CreateInfoType                            m_CI;
+    std::vector<IPipelineResourceSignature*>  m_Signatures;
+    std::unique_ptr<Uint8[]>                  m_InternalData;
+    std::vector<RefCntAutoPtr<IDeviceObject>> m_Objects;
 };
 
 AsyncPipelineState::AsyncPipelineState(IReferenceCounters*            pRefCounters,
@@ -77,24 +142,26 @@ AsyncPipelineState::AsyncPipelineState(IReferenceCounters*            pRefCounte
     m_pStateCache{pStateCache},
     m_UniqueID{}
 {
+    std::shared_ptr<DescriptionInternPool> pInternPool = pStateCache->GetDescriptionInternPool();
+
     static_assert(PIPELINE_TYPE_COUNT == 5, "Did you add a new pipeline type? You may need to handle it here.");
     switch (CreateInfo.PSODesc.PipelineType)
     {
         case PIPELINE_TYPE_GRAPHICS:
         case PIPELINE_TYPE_MESH:
-            m_pCreateInfo = std::make_unique<CreateInfoWrapper<GraphicsPipelineStateCreateInfo>>(static_cast<const GraphicsPipelineStateCreateInfo&>(CreateInfo));
+            m_pCreateInfo = std::make_unique<CreateInfoWrapper<GraphicsPipelineStateCreateInfo>>(static_cast<const GraphicsPipelineStateCreateInfo&>(CreateInfo), std::move(pInternPool));
             break;
 
         case PIPELINE_TYPE_COMPUTE:
-            m_pCreateInfo = std::make_unique<CreateInfoWrapper<ComputePipelineStateCreateInfo>>(static_cast<const ComputePipelineStateCreateInfo&>(CreateInfo));
+            m_pCreateInfo = std::make_unique<CreateInfoWrapper<ComputePipelineStateCreateInfo>>(static_cast<const ComputePipelineStateCreateInfo&>(CreateInfo), std::move(pInternPool));
             break;
 
         case PIPELINE_TYPE_RAY_TRACING:
-            m_pCreateInfo = std::make_unique<CreateInfoWrapper<RayTracingPipelineStateCreateInfo>>(static_cast<const RayTracingPipelineStateCreateInfo&>(CreateInfo));
+            m_pCreateInfo = std::make_unique<CreateInfoWrapper<RayTracingPipelineStateCreateInfo>>(static_cast<const RayTracingPipelineStateCreateInfo&>(CreateInfo), std::move(pInternPool));
             break;
 
         case PIPELINE_TYPE_TILE:
-            m_pCreateInfo = std::make_unique<CreateInfoWrapper<TilePipelineStateCreateInfo>>(static_cast<const TilePipelineStateCreateInfo&>(CreateInfo));
+            m_pCreateInfo = std::make_unique<CreateInfoWrapper<TilePipelineStateCreateInfo>>(static_cast<const TilePipelineStateCreateInfo&>(CreateInfo), std::move(pInternPool));
             break;
 
         default:
@@ -25,9 +25,15 @@
  */
 
 #include <unordered_map>
+#include <list>
+#include <array>
+#include <mutex>
+#include <atomic>
+#include <vector>
 
 #include "RefCntAutoPtr.hpp"
 #include "DataBlobImpl.hpp"
+#include "ProxyDataBlob.hpp"
 #include "ObjectBase.hpp"
 #include "Serializer.hpp"
 #include "BytecodeCache.h"
@@ -38,6 +44,18 @@ namespace Diligent
 {
 
 /// Implementation of IBytecodeCache
+///
+/// The cache is split into shards selected by the byte code hash. Every shard has its own
+/// mutex, LRU list and share of the size budget, so that threads that compile different
+/// shaders rarely contend for the same lock.
+///
+/// The serialized data is a sequence of segments. Store() writes a single segment with all
+/// entries, while StoreJournal() writes a segment with the changes since the last store.
+/// Removed entries are recorded in the journal as tombstones.
+///
+///     | Header | Element | Data | Element | Data | ... || Header | Element | Tombstone | ... |
+///     |<------------------- Store() ----------------->||<-------- StoreJournal() -------->|
+///
 class BytecodeCacheImpl final : public ObjectBase<IBytecodeCache>
 {
 public:
@@ -46,7 +64,7 @@ public:
     struct BytecodeCacheHeader
     {
         static constexpr Uint32 HeaderMagic   = 0x7ADECACE;
-        static constexpr Uint32 HeaderVersion = 1;
+        static constexpr Uint32 HeaderVersion = 2;
 
         Uint32 Magic   = HeaderMagic;
         Uint32 Version = HeaderVersion;
@@ -54,21 +72,24 @@ public:
         Uint64 ElementCount = 0;
 
         template <typename SerType>
-        void Serialize(SerType& Stream)
+        bool Serialize(SerType& Stream)
         {
-            Stream(Magic, Version, ElementCount);
+            return Stream(Magic, Version, ElementCount);
         }
     };
 
     struct BytecodeCacheElementHeader
     {
+        // Data size of the removed element
+        static constexpr Uint64 TombstoneSize = ~Uint64{0};
+
         XXH128Hash Hash     = {};
-        size_t     DataSize = 0;
+        Uint64     DataSize = 0;
 
         template <typename SerType>
-        void Serialize(SerType& Stream)
+        bool Serialize(SerType& Stream)
         {
-            Stream(Hash.LowPart, Hash.HighPart, DataSize);
+            return Stream(Hash.LowPart, Hash.HighPart, DataSize);
         }
     };
 
@@ -76,7 +97,8 @@ public:
     BytecodeCacheImpl(IReferenceCounters*            pRefCounters,
                       const BytecodeCacheCreateInfo& CreateInfo) :
         TBase{pRefCounters},
-        m_DeviceType{CreateInfo.DeviceType}
+        m_DeviceType{CreateInfo.DeviceType},
+        m_ShardMaxSize{CreateInfo.MaxSize != 0 ? std::max(CreateInfo.MaxSize / NumShards, Uint64{1}) : 0}
     {
     }
 
@@ -90,30 +112,98 @@ public:
             return false;
         }
 
-        Serializer<SerializerMode::Read> Stream{SerializedData{pDataBlob->GetDataPtr(), pDataBlob->GetSize()}};
-
-        BytecodeCacheHeader Header;
-        Header.Serialize(Stream);
-        if (Header.Magic != BytecodeCacheHeader::HeaderMagic)
+        const size_t DataSize = pDataBlob->GetSize();
+        if (DataSize == 0)
         {
-            LOG_ERROR_MESSAGE("Incorrect bytecode header magic number");
+            LOG_ERROR_MESSAGE("Bytecode cache data is empty");
             return false;
         }
 
-        if (Header.Version != BytecodeCacheHeader::HeaderVersion)
+        // Parse the data first so that the cache is not modified if the data is corrupted
+        struct LoadedElement
         {
-            LOG_ERROR_MESSAGE("Incorrect bytecode header version (", Header.Version, "). ", Uint32{BytecodeCacheHeader::HeaderVersion}, " is expected.");
-            return false;
+            XXH128Hash  Hash;
+            const void* pData;
+            Uint64      Size;
+        };
+        std::vector<LoadedElement> Elements;
+
+        const Uint8* const pStart = static_cast<const Uint8*>(pDataBlob->GetConstDataPtr());
+        const Uint8* const pEnd   = pStart + DataSize;
+        const Uint8*       pCurr  = pStart;
+
+        // Reads the object at the current position and advances the position
+        auto Read = [&](auto& Object) {
+            Serializer<SerializerMode::Read> Stream{SerializedData{const_cast<Uint8*>(pCurr), static_cast<size_t>(pEnd - pCurr)}};
+            if (!Object.Serialize(Stream))
+                return false;
+            pCurr += Stream.GetSize();
+            return true;
+        };
+
+        while (pCurr < pEnd)
+        {
+            BytecodeCacheHeader Header;
+            if (!Read(Header))
+            {
+                LOG_ERROR_MESSAGE("Failed to read bytecode cache header");
+                return false;
+            }
+
+            if (Header.Magic != BytecodeCacheHeader::HeaderMagic)
+            {
+                LOG_ERROR_MESSAGE("Incorrect bytecode header magic number");
+                return false;
+            }
+
+            if (Header.Version != BytecodeCacheHeader::HeaderVersion)
+            {
+                LOG_ERROR_MESSAGE("Incorrect bytecode header version (", Header.Version, "). ", Uint32{BytecodeCacheHeader::HeaderVersion}, " is expected.");
+                return false;
+            }
+
+            for (Uint64 ItemID = 0; ItemID < Header.ElementCount; ItemID++)
+            {
+                BytecodeCacheElementHeader ElementHeader;
+                if (!Read(ElementHeader))
+                {
+                    LOG_ERROR_MESSAGE("Failed to read bytecode cache element header");
+                    return false;
+                }
+
+                if (ElementHeader.DataSize == BytecodeCacheElementHeader::TombstoneSize)
+                {
+                    Elements.push_back({ElementHeader.Hash, nullptr, 0});
+                    continue;
+                }
+
+                if (ElementHeader.DataSize > static_cast<Uint64>(pEnd - pCurr))
+                {
+                    LOG_ERROR_MESSAGE("Bytecode cache data is truncated");
+                    return false;
+                }
+
+                Elements.push_back({ElementHeader.Hash, pCurr, ElementHeader.DataSize});
+                pCurr += ElementHeader.DataSize;
+            }
         }
 
-        for (Uint64 ItemID = 0; ItemID < Header.ElementCount; ItemID++)
+        for (const LoadedElement& Elem : Elements)
         {
-            BytecodeCacheElementHeader ElementHeader;
-            ElementHeader.Serialize(Stream);
+            Shard& CacheShard = GetShard(Elem.Hash);
 
-            RefCntAutoPtr<DataBlobImpl> pBytecode = DataBlobImpl::Create(ElementHeader.DataSize);
-            Stream.CopyBytes(pBytecode->GetDataPtr(), ElementHeader.DataSize);
-            m_HashMap.emplace(ElementHeader.Hash, pBytecode);
+            std::lock_guard<std::mutex> Lock{CacheShard.Mtx};
+            if (Elem.pData != nullptr)
+            {
+                // Reference the data in the source blob instead of copying it
+                RefCntAutoPtr<IDataBlob> pBytecode{ProxyDataBlob::Create(Elem.pData, static_cast<size_t>(Elem.Size), pDataBlob)};
+                CacheShard.Insert(Elem.Hash, std::move(pBytecode));
+                EnforceBudget(CacheShard);
+            }
+            else
+            {
+                CacheShard.Erase(Elem.Hash);
+            }
         }
 
         return true;
@@ -125,12 +215,25 @@ public:
         DEV_CHECK_ERR(*ppByteCode == nullptr, "*ppByteCode is not null. Make sure you are not overwriting reference to an existing object as this may result in memory leaks.");
         const XXH128Hash Hash = ComputeHash(ShaderCI);
 
-        const auto Iter = m_HashMap.find(Hash);
-        if (Iter != m_HashMap.end())
+        Shard& CacheShard = GetShard(Hash);
         {
-            RefCntAutoPtr<IDataBlob> pObject = Iter->second;
-            *ppByteCode                      = pObject.Detach();
+            std::lock_guard<std::mutex> Lock{CacheShard.Mtx};
+
+            const auto Iter = CacheShard.Entries.find(Hash);
+            if (Iter != CacheShard.Entries.end())
+            {
+                // Move the entry to the front of the LRU list
+                CacheShard.LRU.splice(CacheShard.LRU.begin(), CacheShard.LRU, Iter->second.LRUPos);
+
+                RefCntAutoPtr<IDataBlob> pObject = Iter->second.pBytecode;
+                *ppByteCode                      = pObject.Detach();
+            }
         }
+
+        if (*ppByteCode != nullptr)
+            m_NumHits.fetch_add(1);
+        else
+            m_NumMisses.fetch_add(1);
     }
 
     virtual void DILIGENT_CALL_TYPE AddBytecode(const ShaderCreateInfo& ShaderCI, IDataBlob* pByteCode) override final
@@ -138,15 +241,21 @@ public:
         DEV_CHECK_ERR(pByteCode != nullptr, "pByteCode must not be null.");
         const XXH128Hash Hash = ComputeHash(ShaderCI);
 
-        const auto Iter = m_HashMap.emplace(Hash, pByteCode);
-        if (!Iter.second)
-            Iter.first->second = pByteCode;
+        Shard&                      CacheShard = GetShard(Hash);
+        std::lock_guard<std::mutex> Lock{CacheShard.Mtx};
+        CacheShard.Insert(Hash, RefCntAutoPtr<IDataBlob>{pByteCode});
+        CacheShard.Journal[Hash] = pByteCode;
+        EnforceBudget(CacheShard);
     }
 
     virtual void DILIGENT_CALL_TYPE RemoveBytecode(const ShaderCreateInfo& ShaderCI) override final
     {
         const XXH128Hash Hash = ComputeHash(ShaderCI);
-        m_HashMap.erase(Hash);
+
+        Shard&                      CacheShard = GetShard(Hash);
+        std::lock_guard<std::mutex> Lock{CacheShard.Mtx};
+        if (CacheShard.Erase(Hash))
+            CacheShard.Journal[Hash] = nullptr;
     }
 
     virtual void DILIGENT_CALL_TYPE Store(IDataBlob** ppDataBlob) override final
@@ -154,22 +263,161 @@ public:
         DEV_CHECK_ERR(ppDataBlob != nullptr, "ppDataBlob must not be null.");
         DEV_CHECK_ERR(*ppDataBlob == nullptr, "*ppDataBlob is not null. Make sure you are not overwriting reference to an existing object as this may result in memory leaks.");
 
+        // Take a snapshot of all entries so that the shards are not locked while the data is written
+        std::vector<std::pair<XXH128Hash, RefCntAutoPtr<IDataBlob>>> Snapshot;
+        for (Shard& CacheShard : m_Shards)
+        {
+            std::lock_guard<std::mutex> Lock{CacheShard.Mtx};
+            for (const auto& it : CacheShard.Entries)
+                Snapshot.emplace_back(it.first, it.second.pBytecode);
+            // The snapshot contains all changes
+            CacheShard.Journal.clear();
+        }
+
+        *ppDataBlob = WriteSegment(Snapshot).Detach();
+    }
+
+    virtual void DILIGENT_CALL_TYPE StoreJournal(IDataBlob** ppDataBlob) override final
+    {
+        DEV_CHECK_ERR(ppDataBlob != nullptr, "ppDataBlob must not be null.");
+        DEV_CHECK_ERR(*ppDataBlob == nullptr, "*ppDataBlob is not null. Make sure you are not overwriting reference to an existing object as this may result in memory leaks.");
+
+        std::vector<std::pair<XXH128Hash, RefCntAutoPtr<IDataBlob>>> Changes;
+        for (Shard& CacheShard : m_Shards)
+        {
+            std::lock_guard<std::mutex> Lock{CacheShard.Mtx};
+            for (auto& it : CacheShard.Journal)
+                Changes.emplace_back(it.first, std::move(it.second));
+            CacheShard.Journal.clear();
+        }
+
+        *ppDataBlob = WriteSegment(Changes).Detach();
+    }
+
+    virtual void DILIGENT_CALL_TYPE Clear() override final
+    {
+        for (Shard& CacheShard : m_Shards)
+        {
+            std::lock_guard<std::mutex> Lock{CacheShard.Mtx};
+            for (const auto& it : CacheShard.Entries)
+                CacheShard.Journal[it.first] = nullptr;
+            CacheShard.Entries.clear();
+            CacheShard.LRU.clear();
+            CacheShard.TotalSize = 0;
+        }
+    }
+
+    virtual void DILIGENT_CALL_TYPE GetStats(BytecodeCacheStats& Stats) const override final
+    {
+        Stats = {};
+        for (const Shard& CacheShard : m_Shards)
+        {
+            std::lock_guard<std::mutex> Lock{CacheShard.Mtx};
+            Stats.NumEntries += CacheShard.Entries.size();
+            Stats.TotalSize += CacheShard.TotalSize;
+        }
+        Stats.NumHits      = m_NumHits.load();
+        Stats.NumMisses    = m_NumMisses.load();
+        Stats.NumEvictions = m_NumEvictions.load();
+    }
+
+private:
+    XXH128Hash ComputeHash(const ShaderCreateInfo& ShaderCI) const
+    {
+        XXH128State Hasher;
+        Hasher.Update(ShaderCI, m_DeviceType);
+        return Hasher.Digest();
+    }
+
+    struct Shard
+    {
+        mutable std::mutex Mtx;
+
+        struct Entry
+        {
+            RefCntAutoPtr<IDataBlob>        pBytecode;
+            std::list<XXH128Hash>::iterator LRUPos;
+        };
+        std::unordered_map<XXH128Hash, Entry> Entries;
+
+        // The most recently used entry is at the front
+        std::list<XXH128Hash> LRU;
+
+        Uint64 TotalSize = 0;
+
+        // Changes since the last Store() or StoreJournal(). Null byte code means the entry was removed.
+        std::unordered_map<XXH128Hash, RefCntAutoPtr<IDataBlob>> Journal;
+
+        void Insert(const XXH128Hash& Hash, RefCntAutoPtr<IDataBlob> pBytecode)
+        {
+            auto it = Entries.find(Hash);
+            if (it == Entries.end())
+            {
+                LRU.push_front(Hash);
+                it = Entries.emplace(Hash, Entry{RefCntAutoPtr<IDataBlob>{}, LRU.begin()}).first;
+            }
+            else
+            {
+                TotalSize -= it->second.pBytecode->GetSize();
+                LRU.splice(LRU.begin(), LRU, it->second.LRUPos);
+            }
+            TotalSize += pBytecode->GetSize();
+            it->second.pBytecode = std::move(pBytecode);
+        }
+
+        bool Erase(const XXH128Hash& Hash)
+        {
+            auto it = Entries.find(Hash);
+            if (it == Entries.end())
+                return false;
+
+            TotalSize -= it->second.pBytecode->GetSize();
+            LRU.erase(it->second.LRUPos);
+            Entries.erase(it);
+            return true;
+        }
+    };
+
+    Shard& GetShard(const XXH128Hash& Hash)
+    {
+        return m_Shards[static_cast<size_t>(Hash.LowPart % NumShards)];
+    }
+
+    // Evicts the least recently used entries until the shard fits into its budget.
+    // The most recently used entry is never evicted. The shard mutex must be locked.
+    void EnforceBudget(Shard& CacheShard)
+    {
+        if (m_ShardMaxSize == 0)
+            return;
+
+        while (CacheShard.TotalSize > m_ShardMaxSize && CacheShard.LRU.size() > 1)
+        {
+            const XXH128Hash Hash = CacheShard.LRU.back();
+            CacheShard.Erase(Hash);
+            CacheShard.Journal[Hash] = nullptr;
+            m_NumEvictions.fetch_add(1);
+        }
+    }
+
+    static RefCntAutoPtr<IDataBlob> WriteSegment(const std::vector<std::pair<XXH128Hash, RefCntAutoPtr<IDataBlob>>>& Elements)
+    {
         auto WriteData = [&](auto& Stream) //
         {
             BytecodeCacheHeader Header{};
-            Header.ElementCount = m_HashMap.size();
+            Header.ElementCount = Elements.size();
             Header.Serialize(Stream);
 
-            for (auto const& Pair : m_HashMap)
+            for (auto const& Pair : Elements)
             {
                 const RefCntAutoPtr<IDataBlob>& pBytecode = Pair.second;
 
                 BytecodeCacheElementHeader ElementHeader;
                 ElementHeader.Hash     = Pair.first;
-                ElementHeader.DataSize = pBytecode->GetSize();
+                ElementHeader.DataSize = pBytecode ? pBytecode->GetSize() : BytecodeCacheElementHeader::TombstoneSize;
                 ElementHeader.Serialize(Stream);
 
-                Stream.CopyBytes(pBytecode->GetConstDataPtr(), ElementHeader.DataSize);
+                if (pBytecode)
+                    Stream.CopyBytes(pBytecode->GetConstDataPtr(), pBytecode->GetSize());
             }
         };
 
@@ -182,26 +430,20 @@ public:
         WriteData(WriteStream);
         VERIFY_EXPR(WriteStream.IsEnded());
 
-        *ppDataBlob = DataBlobImpl::Create(Memory.Size(), Memory.Ptr()).Detach();
-    }
-
-    virtual void DILIGENT_CALL_TYPE Clear() override final
-    {
-        m_HashMap.clear();
+        return RefCntAutoPtr<IDataBlob>{DataBlobImpl::Create(Memory.Size(), Memory.Ptr())};
     }
 
 private:
-    XXH128Hash ComputeHash(const ShaderCreateInfo& ShaderCI) const
-    {
-        XXH128State Hasher;
-        Hasher.Update(ShaderCI, m_DeviceType);
-        return Hasher.Digest();
-    }
+    static constexpr size_t NumShards = 16;
 
-private:
-    RENDER_DEVICE_TYPE m_DeviceType;
+    const RENDER_DEVICE_TYPE m_DeviceType;
+    const Uint64             m_ShardMaxSize;
+
+    std::array<Shard, NumShards> m_Shards;
 
-    std::unordered_map<XXH128Hash, RefCntAutoPtr<IDataBlob>> m_HashMap;
+    std::atomic<Uint64> m_NumHits{0};
+    std::atomic<Uint64> m_NumMisses{0};
+    std::atomic<Uint64> m_NumEvictions{0};
 };
 
 void CreateBytecodeCache(const BytecodeCacheCreateInfo& CreateInfo,
@@ -0,0 +1,789 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "FrameProfiler.hpp"
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+
+#include "ChromeTraceWriter.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+std::atomic<Uint32> g_NextProfilerId{0};
+
+// The maximum number of names of the exited threads kept for trace export
+constexpr size_t MaxRetiredThreadNames = 256;
+
+double TimestampToSeconds(const QueryDataTimestamp& Data)
+{
+    return Data.Frequency != 0 ?
+        static_cast<double>(Data.Counter) / static_cast<double>(Data.Frequency) :
+        0;
+}
+
+} // namespace
+
+struct FrameProfiler::ThreadBuffer
+{
+    ThreadBuffer(Uint32 _ThreadId, Uint32 Capacity) :
+        ThreadId{_ThreadId},
+        Events(std::max(Capacity, 1u))
+    {}
+
+    // Trace id of the owning thread, see ChromeTraceWriter::GetThreadId()
+    const Uint32 ThreadId;
+
+    // Protected by ThreadRegistry::Mtx
+    std::string Name;
+
+    // Single-producer single-consumer ring buffer of completed events.
+    // WriteIdx is only modified by the owning thread, ReadIdx is only modified by EndFrame().
+    std::vector<CPUEvent> Events;
+    std::atomic<Uint64>   WriteIdx{0};
+    std::atomic<Uint64>   ReadIdx{0};
+    std::atomic<Uint64>   NumDropped{0};
+
+    // Open zones. Only accessed by the owning thread.
+    std::vector<CPUEvent> Stack;
+
+    bool HasUnreadEvents() const
+    {
+        return WriteIdx.load(std::memory_order_acquire) != ReadIdx.load(std::memory_order_relaxed);
+    }
+};
+
+struct FrameProfiler::ThreadRegistry
+{
+    std::mutex Mtx;
+
+    // Buffers of the threads that are alive
+    std::vector<std::unique_ptr<ThreadBuffer>> Buffers;
+
+    // Buffers of the exited threads whose events have not been collected yet.
+    // The buffers are released by CollectCPUEvents().
+    std::vector<std::unique_ptr<ThreadBuffer>> RetiredBuffers;
+
+    // The number of events dropped by the exited threads
+    Uint64 NumRetiredDropped = 0;
+
+    // Names of the exited threads, oldest first
+    std::deque<std::pair<Uint32, std::string>> RetiredThreadNames;
+
+    ThreadBuffer* CreateBuffer(Uint32 Capacity)
+    {
+        std::lock_guard<std::mutex> Lock{Mtx};
+        Buffers.emplace_back(std::make_unique<ThreadBuffer>(ChromeTraceWriter::GetThreadId(), Capacity));
+        return Buffers.back().get();
+    }
+
+    // Called when the thread that owns the buffer exits.
+    void RetireBuffer(ThreadBuffer* pBuffer)
+    {
+        std::lock_guard<std::mutex> Lock{Mtx};
+
+        auto it = std::find_if(Buffers.begin(), Buffers.end(),
+                               [pBuffer](const std::unique_ptr<ThreadBuffer>& pBuff) { return pBuff.get() == pBuffer; });
+        if (it == Buffers.end())
+        {
+            UNEXPECTED("Thread buffer is not found in the registry");
+            return;
+        }
+
+        NumRetiredDropped += pBuffer->NumDropped.load(std::memory_order_relaxed);
+        if (!pBuffer->Name.empty())
+        {
+            RetiredThreadNames.emplace_back(pBuffer->ThreadId, std::move(pBuffer->Name));
+            while (RetiredThreadNames.size() > MaxRetiredThreadNames)
+                RetiredThreadNames.pop_front();
+        }
+
+        if (pBuffer->HasUnreadEvents())
+            RetiredBuffers.emplace_back(std::move(*it));
+        Buffers.erase(it);
+    }
+};
+
+// Holds the buffers of all profilers used by the thread and retires them when the thread exits.
+class FrameProfiler::ThreadBufferHolder
+{
+public:
+    ThreadBufferHolder() = default;
+
+    ~ThreadBufferHolder()
+    {
+        for (Entry& BufferEntry : m_Entries)
+        {
+            // The profiler may have been destroyed before the thread exits
+            if (std::shared_ptr<ThreadRegistry> pRegistry = BufferEntry.wpRegistry.lock())
+                pRegistry->RetireBuffer(BufferEntry.pBuffer);
+        }
+    }
+
+    // clang-format off
+    ThreadBufferHolder           (const ThreadBufferHolder&)  = delete;
+    ThreadBufferHolder           (      ThreadBufferHolder&&) = delete;
+    ThreadBufferHolder& operator=(const ThreadBufferHolder&)  = delete;
+    ThreadBufferHolder& operator=(      ThreadBufferHolder&&) = delete;
+    // clang-format on
+
+    ThreadBuffer* Find(Uint32 ProfilerId)
+    {
+        // Recording CPU zones does not require a lookup in the common case of a single profiler
+        if (m_LastProfilerId == ProfilerId)
+            return m_pLastBuffer;
+
+        for (const Entry& BufferEntry : m_Entries)
+        {
+            if (BufferEntry.ProfilerId == ProfilerId)
+            {
+                m_LastProfilerId = ProfilerId;
+                m_pLastBuffer    = BufferEntry.pBuffer;
+                return m_pLastBuffer;
+            }
+        }
+        return nullptr;
+    }
+
+    void Add(Uint32 ProfilerId, const std::shared_ptr<ThreadRegistry>& pRegistry, ThreadBuffer* pBuffer)
+    {
+        // Profiler ids are never reused, so the entries of the destroyed profilers can be removed
+        m_Entries.erase(std::remove_if(m_Entries.begin(), m_Entries.end(),
+                                       [](const Entry& BufferEntry) { return BufferEntry.wpRegistry.expired(); }),
+                        m_Entries.end());
+        m_Entries.push_back({ProfilerId, pRegistry, pBuffer});
+
+        m_LastProfilerId = ProfilerId;
+        m_pLastBuffer    = pBuffer;
+    }
+
+private:
+    struct Entry
+    {
+        Uint32                        ProfilerId = ~0u;
+        std::weak_ptr<ThreadRegistry> wpRegistry;
+        ThreadBuffer*                 pBuffer = nullptr;
+    };
+    std::vector<Entry> m_Entries;
+
+    Uint32        m_LastProfilerId = ~0u;
+    ThreadBuffer* m_pLastBuffer    = nullptr;
+};
+
+void FrameProfiler::SampleWindow::Add(double Sample)
+{
+    if (m_Samples.size() < m_Size)
+        m_Samples.push_back(Sample);
+    else
+        m_Samples[m_Pos] = Sample;
+    m_Pos  = (m_Pos + 1) % m_Size;
+    m_Last = Sample;
+    ++m_Count;
+}
+
+FrameProfiler::RollingStatistics FrameProfiler::SampleWindow::Get() const
+{
+    RollingStatistics Stats;
+    if (m_Samples.empty())
+        return Stats;
+
+    Stats.Last  = m_Last;
+    Stats.Count = m_Count;
+    Stats.Min   = m_Samples[0];
+    Stats.Max   = m_Samples[0];
+
+    double Sum = 0;
+    for (double Sample : m_Samples)
+    {
+        Sum += Sample;
+        Stats.Min = std::min(Stats.Min, Sample);
+        Stats.Max = std::max(Stats.Max, Sample);
+    }
+    Stats.Average = Sum / static_cast<double>(m_Samples.size());
+
+    return Stats;
+}
+
+FrameProfiler::FrameProfiler(IRenderDevice* pDevice, const CreateInfo& CI) :
+    m_CI{CI},
+    m_StartTime{std::chrono::steady_clock::now()},
+    m_StartTimestamp{ChromeTraceWriter::GetTimestamp(m_StartTime)},
+    m_ProfilerId{g_NextProfilerId.fetch_add(1)},
+    m_pThreadRegistry{std::make_shared<ThreadRegistry>()},
+    m_CPUFrameTime{CI.StatisticsWindow},
+    m_GPUFrameTime{CI.StatisticsWindow},
+    m_GPUIdleTime{CI.StatisticsWindow},
+    m_Latency{CI.StatisticsWindow}
+{
+    if (pDevice != nullptr)
+    {
+        if (pDevice->GetDeviceInfo().Features.TimestampQueries != DEVICE_FEATURE_STATE_DISABLED)
+        {
+            m_pDevice = pDevice;
+        }
+        else
+        {
+            LOG_WARNING_MESSAGE("Timestamp queries are not supported by the device. GPU profiling will be disabled.");
+        }
+    }
+
+    if (m_pDevice)
+    {
+        m_AvailableQueries.reserve(m_CI.NumQueriesToReserve);
+        for (Uint32 i = 0; i < m_CI.NumQueriesToReserve; ++i)
+            m_AvailableQueries.emplace_back(AllocateQuery());
+    }
+}
+
+FrameProfiler::FrameProfiler(IRenderDevice* pDevice) :
+    FrameProfiler{pDevice, CreateInfo{}}
+{
+}
+
+FrameProfiler::~FrameProfiler()
+{
+    DEV_CHECK_ERR(!m_FrameInProgress, "Frame profiler is destroyed while the frame is in progress");
+}
+
+double FrameProfiler::GetTime() const
+{
+    return std::chrono::duration<double>{std::chrono::steady_clock::now() - m_StartTime}.count();
+}
+
+FrameProfiler::ThreadBuffer& FrameProfiler::GetThreadBuffer()
+{
+    // Objects with thread storage duration are destroyed when the thread exits
+    thread_local ThreadBufferHolder Holder;
+
+    ThreadBuffer* pBuffer = Holder.Find(m_ProfilerId);
+    if (pBuffer == nullptr)
+    {
+        pBuffer = m_pThreadRegistry->CreateBuffer(m_CI.MaxCPUEventsPerThread);
+        Holder.Add(m_ProfilerId, m_pThreadRegistry, pBuffer);
+    }
+    return *pBuffer;
+}
+
+void FrameProfiler::BeginCPUZone(const char* Name)
+{
+    ThreadBuffer& Buffer = GetThreadBuffer();
+
+    CPUEvent Event;
+    Event.Name  = Name;
+    Event.Depth = static_cast<Uint32>(Buffer.Stack.size());
+    Event.Begin = GetTime();
+    Buffer.Stack.push_back(Event);
+}
+
+void FrameProfiler::EndCPUZone()
+{
+    const double EndTime = GetTime();
+
+    ThreadBuffer& Buffer = GetThreadBuffer();
+    if (Buffer.Stack.empty())
+    {
+        LOG_ERROR_MESSAGE("There are no open CPU zones on this thread, which likely indicates inconsistent BeginCPUZone()/EndCPUZone() calls");
+        return;
+    }
+
+    CPUEvent Event = Buffer.Stack.back();
+    Buffer.Stack.pop_back();
+    Event.End = EndTime;
+
+    const Uint64 WriteIdx = Buffer.WriteIdx.load(std::memory_order_relaxed);
+    if (WriteIdx - Buffer.ReadIdx.load(std::memory_order_acquire) >= Buffer.Events.size())
+    {
+        // The buffer is full until the next EndFrame()
+        Buffer.NumDropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    Buffer.Events[WriteIdx % Buffer.Events.size()] = Event;
+    Buffer.WriteIdx.store(WriteIdx + 1, std::memory_order_release);
+}
+
+void FrameProfiler::SetThreadName(const char* Name)
+{
+    ThreadBuffer& Buffer = GetThreadBuffer();
+
+    std::lock_guard<std::mutex> Lock{m_pThreadRegistry->Mtx};
+    Buffer.Name = Name != nullptr ? Name : "";
+}
+
+size_t FrameProfiler::GetNumThreadBuffers() const
+{
+    std::lock_guard<std::mutex> Lock{m_pThreadRegistry->Mtx};
+    return m_pThreadRegistry->Buffers.size();
+}
+
+RefCntAutoPtr<IQuery> FrameProfiler::AllocateQuery()
+{
+    VERIFY_EXPR(m_pDevice);
+    if (!m_AvailableQueries.empty())
+    {
+        RefCntAutoPtr<IQuery> pQuery = std::move(m_AvailableQueries.back());
+        m_AvailableQueries.pop_back();
+        return pQuery;
+    }
+
+    QueryDesc Desc{QUERY_TYPE_TIMESTAMP};
+    Desc.Name = "Frame profiler timestamp query";
+
+    RefCntAutoPtr<IQuery> pQuery;
+    m_pDevice->CreateQuery(Desc, &pQuery);
+    VERIFY(pQuery, "Failed to create timestamp query");
+
+    return pQuery;
+}
+
+void FrameProfiler::RecycleQuery(RefCntAutoPtr<IQuery>&& pQuery)
+{
+    if (!pQuery)
+        return;
+
+    pQuery->Invalidate();
+    m_AvailableQueries.emplace_back(std::move(pQuery));
+}
+
+void FrameProfiler::RecycleFrame(FrameData& Frame)
+{
+    RecycleQuery(std::move(Frame.pBegin));
+    RecycleQuery(std::move(Frame.pEnd));
+    for (GPUZone& Zone : Frame.Zones)
+    {
+        RecycleQuery(std::move(Zone.pBegin));
+        RecycleQuery(std::move(Zone.pEnd));
+    }
+    Frame.Zones.clear();
+}
+
+void FrameProfiler::BeginFrame(IDeviceContext* pCtx)
+{
+    if (m_FrameInProgress)
+    {
+        LOG_ERROR_MESSAGE("BeginFrame() is called while the frame is already in progress");
+        return;
+    }
+    m_FrameInProgress = true;
+
+    BeginCPUZone("Frame");
+
+    m_CurrFrame.CPUBegin = GetTime();
+    if (m_pDevice)
+    {
+        VERIFY(pCtx != nullptr, "Device context must not be null when GPU profiling is enabled");
+        m_CurrFrame.pBegin   = AllocateQuery();
+        m_CurrFrame.CPUBegin = GetTime();
+        pCtx->EndQuery(m_CurrFrame.pBegin);
+    }
+}
+
+void FrameProfiler::EndFrame(IDeviceContext* pCtx)
+{
+    if (!m_FrameInProgress)
+    {
+        LOG_ERROR_MESSAGE("EndFrame() is called without matching BeginFrame()");
+        return;
+    }
+
+    if (!m_GPUZoneStack.empty())
+    {
+        LOG_ERROR_MESSAGE(m_GPUZoneStack.size(), " GPU zone(s) are not closed at the end of the frame");
+        while (!m_GPUZoneStack.empty())
+            EndGPUZone(pCtx);
+    }
+
+    if (m_pDevice)
+    {
+        m_CurrFrame.pEnd   = AllocateQuery();
+        m_CurrFrame.CPUEnd = GetTime();
+        pCtx->EndQuery(m_CurrFrame.pEnd);
+    }
+    else
+    {
+        m_CurrFrame.CPUEnd = GetTime();
+    }
+
+    EndCPUZone();
+    m_FrameInProgress = false;
+
+    {
+        std::lock_guard<std::mutex> Lock{m_StatsMtx};
+        m_CPUFrameTime.Add(m_CurrFrame.CPUEnd - m_CurrFrame.CPUBegin);
+    }
+
+    if (m_pDevice)
+    {
+        m_PendingFrames.emplace_back(std::move(m_CurrFrame));
+        if (m_PendingFrames.size() > m_CI.ExpectedFrameLatency)
+        {
+            LOG_WARNING_MESSAGE("There are ", m_PendingFrames.size(), " frames with pending GPU results which exceeds the expected frame latency (",
+                                m_CI.ExpectedFrameLatency, ")");
+        }
+    }
+    m_CurrFrame = {};
+
+    ResolveGPUFrames();
+    CollectCPUEvents();
+}
+
+void FrameProfiler::BeginGPUZone(IDeviceContext* pCtx, const char* Name)
+{
+    if (!m_pDevice)
+        return;
+
+    if (!m_FrameInProgress)
+    {
+        LOG_ERROR_MESSAGE("GPU zone '", Name, "' must be recorded between BeginFrame() and EndFrame()");
+        return;
+    }
+
+    GPUZone Zone;
+    Zone.Name   = Name;
+    Zone.Depth  = static_cast<Uint32>(m_GPUZoneStack.size());
+    Zone.pBegin = AllocateQuery();
+    pCtx->EndQuery(Zone.pBegin);
+
+    m_GPUZoneStack.push_back(m_CurrFrame.Zones.size());
+    m_CurrFrame.Zones.emplace_back(std::move(Zone));
+}
+
+void FrameProfiler::EndGPUZone(IDeviceContext* pCtx)
+{
+    if (!m_pDevice)
+        return;
+
+    if (m_GPUZoneStack.empty())
+    {
+        LOG_ERROR_MESSAGE("There are no open GPU zones, which likely indicates inconsistent BeginGPUZone()/EndGPUZone() calls");
+        return;
+    }
+
+    GPUZone& Zone = m_CurrFrame.Zones[m_GPUZoneStack.back()];
+    m_GPUZoneStack.pop_back();
+
+    Zone.pEnd = AllocateQuery();
+    pCtx->EndQuery(Zone.pEnd);
+}
+
+// GPU timestamps and CPU time are measured by different clocks, so that for any event
+//
+//      CPUTime = GPUTime + Offset
+//
+// When the timestamp query is issued at CPU time T, it is executed by the GPU no earlier
+// than that, so every sample (T - GPUTime) is a lower bound of the offset. The bound is
+// tight when the GPU is idle waiting for the commands, and the maximum over the recent
+// frames is used as the estimate. The window allows for a slow drift of the clocks.
+void FrameProfiler::AddCalibrationSample(double CPUTime, double GPUTime)
+{
+    m_CalibrationSamples.push_back(CPUTime - GPUTime);
+    while (m_CalibrationSamples.size() > std::max(m_CI.CalibrationWindow, 1u))
+        m_CalibrationSamples.pop_front();
+
+    m_GPUToCPUOffset = *std::max_element(m_CalibrationSamples.begin(), m_CalibrationSamples.end());
+}
+
+bool FrameProfiler::Calibrate(IDeviceContext* pCtx)
+{
+    if (!m_pDevice)
+        return false;
+
+    RefCntAutoPtr<IQuery> pQuery = AllocateQuery();
+
+    // Make sure the GPU is idle so that the timestamp is executed as soon as it is submitted
+    pCtx->WaitForIdle();
+    pCtx->EndQuery(pQuery);
+    const double CPUTime = GetTime();
+    pCtx->WaitForIdle();
+
+    QueryDataTimestamp Data;
+    const bool         DataAvailable = pQuery->GetData(&Data, sizeof(Data), false) && Data.Frequency != 0;
+    if (DataAvailable)
+    {
+        std::lock_guard<std::mutex> Lock{m_StatsMtx};
+        AddCalibrationSample(CPUTime, TimestampToSeconds(Data));
+    }
+    else
+    {
+        LOG_WARNING_MESSAGE("Calibration timestamp is not available after the context has become idle");
+    }
+
+    RecycleQuery(std::move(pQuery));
+
+    return DataAvailable;
+}
+
+void FrameProfiler::ResolveGPUFrames()
+{
+    std::vector<std::pair<double, double>> ZoneTimes;
+    while (!m_PendingFrames.empty())
+    {
+        FrameData& Frame = m_PendingFrames.front();
+
+        // The end timestamp is the last query of the frame, so if it is available, all other queries are too.
+        // Do not invalidate the queries as some of the results may still be unavailable on some backends.
+        QueryDataTimestamp EndData;
+        if (!Frame.pEnd->GetData(&EndData, sizeof(EndData), false))
+            break;
+
+        QueryDataTimestamp BeginData;
+        bool               DataAvailable = Frame.pBegin->GetData(&BeginData, sizeof(BeginData), false);
+
+        ZoneTimes.resize(Frame.Zones.size());
+        for (size_t i = 0; i < Frame.Zones.size() && DataAvailable; ++i)
+        {
+            QueryDataTimestamp ZoneBeginData, ZoneEndData;
+            DataAvailable =
+                Frame.Zones[i].pBegin->GetData(&ZoneBeginData, sizeof(ZoneBeginData), false) &&
+                Frame.Zones[i].pEnd->GetData(&ZoneEndData, sizeof(ZoneEndData), false);
+            ZoneTimes[i] = {TimestampToSeconds(ZoneBeginData), TimestampToSeconds(ZoneEndData)};
+        }
+        if (!DataAvailable)
+            break;
+
+        const double GPUBegin = TimestampToSeconds(BeginData);
+        const double GPUEnd   = TimestampToSeconds(EndData);
+
+        {
+            std::lock_guard<std::mutex> Lock{m_StatsMtx};
+
+            AddCalibrationSample(Frame.CPUBegin, GPUBegin);
+            AddCalibrationSample(Frame.CPUEnd, GPUEnd);
+            const double Offset = m_GPUToCPUOffset;
+
+            m_GPUFrameTime.Add(GPUEnd - GPUBegin);
+            m_Latency.Add(std::max(GPUEnd + Offset - Frame.CPUEnd, 0.0));
+            AddTraceEvent({"Frame", ZONE_TYPE::GPU, 0, GPUBegin + Offset, GPUEnd - GPUBegin});
+
+            if (!Frame.Zones.empty())
+            {
+                // Count the time not covered by the top-level zones, starting from the end of the previous frame
+                double Cursor = (m_NumResolvedFrames > 0 && m_LastGPUFrameEnd <= GPUBegin) ? m_LastGPUFrameEnd : GPUBegin;
+                double Idle   = 0;
+                for (size_t i = 0; i < Frame.Zones.size(); ++i)
+                {
+                    if (Frame.Zones[i].Depth != 0)
+                        continue;
+                    if (ZoneTimes[i].first > Cursor)
+                        Idle += ZoneTimes[i].first - Cursor;
+                    Cursor = std::max(Cursor, ZoneTimes[i].second);
+                }
+                if (GPUEnd > Cursor)
+                    Idle += GPUEnd - Cursor;
+                m_GPUIdleTime.Add(Idle);
+            }
+
+            for (size_t i = 0; i < Frame.Zones.size(); ++i)
+            {
+                const GPUZone& Zone     = Frame.Zones[i];
+                const double   Duration = ZoneTimes[i].second - ZoneTimes[i].first;
+                AddZoneSample(ZONE_TYPE::GPU, Zone.Name, Zone.Depth, Duration);
+                AddTraceEvent({Zone.Name, ZONE_TYPE::GPU, 0, ZoneTimes[i].first + Offset, Duration});
+            }
+
+            ++m_NumResolvedFrames;
+        }
+        m_LastGPUFrameEnd = GPUEnd;
+
+        RecycleFrame(Frame);
+        m_PendingFrames.pop_front();
+    }
+}
+
+void FrameProfiler::CollectCPUEvents()
+{
+    // Buffers may only be retired and released while the registry is locked
+    std::lock_guard<std::mutex> RegistryLock{m_pThreadRegistry->Mtx};
+    std::lock_guard<std::mutex> StatsLock{m_StatsMtx};
+
+    auto CollectEvents = [this](ThreadBuffer& Buffer) {
+        const Uint64 WriteIdx = Buffer.WriteIdx.load(std::memory_order_acquire);
+        const Uint64 ReadIdx  = Buffer.ReadIdx.load(std::memory_order_relaxed);
+        for (Uint64 i = ReadIdx; i < WriteIdx; ++i)
+        {
+            const CPUEvent& Event = Buffer.Events[i % Buffer.Events.size()];
+            AddZoneSample(ZONE_TYPE::CPU, Event.Name, Event.Depth, Event.End - Event.Begin);
+            AddTraceEvent({Event.Name, ZONE_TYPE::CPU, Buffer.ThreadId, Event.Begin, Event.End - Event.Begin});
+        }
+        Buffer.ReadIdx.store(WriteIdx, std::memory_order_release);
+    };
+
+    for (std::unique_ptr<ThreadBuffer>& pBuffer : m_pThreadRegistry->RetiredBuffers)
+        CollectEvents(*pBuffer);
+    m_pThreadRegistry->RetiredBuffers.clear();
+
+    for (std::unique_ptr<ThreadBuffer>& pBuffer : m_pThreadRegistry->Buffers)
+        CollectEvents(*pBuffer);
+}
+
+void FrameProfiler::AddZoneSample(ZONE_TYPE Type, const char* Name, Uint32 Depth, double Duration)
+{
+    // Zones are identified by name. Look up the name pointer first to avoid constructing the key string.
+    ZoneStatisticsEntry*& pEntry = m_ZoneStatsLookup[static_cast<size_t>(Type)][Name];
+    if (pEntry == nullptr)
+    {
+        std::string Key = (Type == ZONE_TYPE::GPU ? "GPU/" : "CPU/");
+        Key += Name;
+
+        auto it = m_ZoneStats.find(Key);
+        if (it == m_ZoneStats.end())
+        {
+            ZoneStatisticsEntry Entry;
+            Entry.Name     = Name;
+            Entry.Type     = Type;
+            Entry.Depth    = Depth;
+            Entry.Duration = SampleWindow{m_CI.StatisticsWindow};
+            it             = m_ZoneStats.emplace(std::move(Key), std::move(Entry)).first;
+        }
+        pEntry = &it->second;
+    }
+
+    pEntry->Duration.Add(Duration);
+}
+
+void FrameProfiler::AddTraceEvent(const TraceEvent& Event)
+{
+    if (m_CI.MaxTraceEvents == 0)
+        return;
+
+    m_TraceEvents.push_back(Event);
+    while (m_TraceEvents.size() > m_CI.MaxTraceEvents)
+        m_TraceEvents.pop_front();
+}
+
+std::vector<FrameProfiler::ZoneStatistics> FrameProfiler::GetZoneStatistics() const
+{
+    std::vector<ZoneStatistics> Stats;
+    {
+        std::lock_guard<std::mutex> Lock{m_StatsMtx};
+        Stats.reserve(m_ZoneStats.size());
+        for (const auto& it : m_ZoneStats)
+        {
+            const ZoneStatisticsEntry& Entry = it.second;
+
+            ZoneStatistics ZoneStats;
+            ZoneStats.Name     = Entry.Name;
+            ZoneStats.Type     = Entry.Type;
+            ZoneStats.Depth    = Entry.Depth;
+            ZoneStats.Duration = Entry.Duration.Get();
+            Stats.emplace_back(ZoneStats);
+        }
+    }
+
+    std::sort(Stats.begin(), Stats.end(),
+              [](const ZoneStatistics& lhs, const ZoneStatistics& rhs) {
+                  if (lhs.Type != rhs.Type)
+                      return lhs.Type < rhs.Type;
+                  if (lhs.Depth != rhs.Depth)
+                      return lhs.Depth < rhs.Depth;
+                  return strcmp(lhs.Name, rhs.Name) < 0;
+              });
+
+    return Stats;
+}
+
+FrameProfiler::FrameStatistics FrameProfiler::GetFrameStatistics() const
+{
+    FrameStatistics Stats;
+    {
+        std::lock_guard<std::mutex> Lock{m_pThreadRegistry->Mtx};
+        Stats.NumDroppedCPUEvents = m_pThreadRegistry->NumRetiredDropped;
+        for (const std::unique_ptr<ThreadBuffer>& pBuffer : m_pThreadRegistry->Buffers)
+            Stats.NumDroppedCPUEvents += pBuffer->NumDropped.load(std::memory_order_relaxed);
+    }
+
+    std::lock_guard<std::mutex> Lock{m_StatsMtx};
+    Stats.CPUTime           = m_CPUFrameTime.Get();
+    Stats.GPUTime           = m_GPUFrameTime.Get();
+    Stats.GPUIdleTime       = m_GPUIdleTime.Get();
+    Stats.Latency           = m_Latency.Get();
+    Stats.NumFrames         = Stats.CPUTime.Count;
+    Stats.NumResolvedFrames = m_NumResolvedFrames;
+    Stats.GPUToCPUOffset    = m_GPUToCPUOffset;
+
+    return Stats;
+}
+
+Uint64 FrameProfiler::GetTraceTimestamp(double Time) const
+{
+    // GPU events converted to the CPU timeline may start slightly before the profiler was created
+    const double Timestamp = static_cast<double>(m_StartTimestamp) + Time * 1e+9;
+    return Timestamp > 0 ? static_cast<Uint64>(std::llround(Timestamp)) : 0;
+}
+
+std::string FrameProfiler::GetChromeTrace() const
+{
+    ChromeTraceWriter Writer;
+    Writer.AddProcessName(ChromeTraceWriter::CPUProcessId, "CPU");
+    Writer.AddProcessName(ChromeTraceWriter::GPUProcessId, "GPU");
+
+    {
+        std::lock_guard<std::mutex> Lock{m_pThreadRegistry->Mtx};
+        for (const auto& ThreadName : m_pThreadRegistry->RetiredThreadNames)
+            Writer.AddThreadName(ChromeTraceWriter::CPUProcessId, ThreadName.first, ThreadName.second.c_str());
+
+        for (const std::unique_ptr<ThreadBuffer>& pBuffer : m_pThreadRegistry->Buffers)
+        {
+            if (!pBuffer->Name.empty())
+            {
+                Writer.AddThreadName(ChromeTraceWriter::CPUProcessId, pBuffer->ThreadId, pBuffer->Name.c_str());
+            }
+            else
+            {
+                const std::string Name = "Thread " + std::to_string(pBuffer->ThreadId);
+                Writer.AddThreadName(ChromeTraceWriter::CPUProcessId, pBuffer->ThreadId, Name.c_str());
+            }
+        }
+    }
+
+    {
+        std::lock_guard<std::mutex> Lock{m_StatsMtx};
+        for (const TraceEvent& Event : m_TraceEvents)
+        {
+            const bool IsGPU = Event.Type == ZONE_TYPE::GPU;
+            Writer.AddCompleteEvent(Event.Name,
+                                    IsGPU ? "GPU" : "CPU",
+                                    IsGPU ? ChromeTraceWriter::GPUProcessId : ChromeTraceWriter::CPUProcessId,
+                                    Event.ThreadIdx,
+                                    GetTraceTimestamp(Event.Begin),
+                                    static_cast<Uint64>(std::llround(std::max(Event.Duration, 0.0) * 1e+9)));
+        }
+    }
+
+    return Writer.Finish();
+}
+
+bool FrameProfiler::SaveChromeTrace(const char* FilePath) const
+{
+    return ChromeTraceWriter::Save(FilePath, GetChromeTrace());
+}
+
+} // namespace Diligent
@@ -582,7 +582,7 @@ const char* GetWebGPUEmulatedArrayIndexSuffix(IShader* pShader)
 
 int64_t GetNativeTextureFormat(TEXTURE_FORMAT TexFormat, RENDER_DEVICE_TYPE DeviceType)
 {
-    static_assert(RENDER_DEVICE_TYPE_COUNT == 8, "Please handle the new device type below");
+    static_assert(RENDER_DEVICE_TYPE_COUNT == 9, "Please handle the new device type below");
     switch (DeviceType)
     {
 #if D3D11_SUPPORTED
@@ -616,6 +616,10 @@ int64_t GetNativeTextureFormat(TEXTURE_FORMAT TexFormat, RENDER_DEVICE_TYPE Devi
             return GetNativeTextureFormatWebGPU(TexFormat);
 #endif
 
+        case RENDER_DEVICE_TYPE_NULL:
+            // The null device has no native formats and uses Diligent formats instead
+            return static_cast<int64_t>(TexFormat);
+
         default:
             UNSUPPORTED("Unsupported device type");
             return 0;
@@ -624,7 +628,7 @@ int64_t GetNativeTextureFormat(TEXTURE_FORMAT TexFormat, RENDER_DEVICE_TYPE Devi
 
 TEXTURE_FORMAT GetTextureFormatFromNative(int64_t NativeFormat, RENDER_DEVICE_TYPE DeviceType)
 {
-    static_assert(RENDER_DEVICE_TYPE_COUNT == 8, "Please handle the new device type below");
+    static_assert(RENDER_DEVICE_TYPE_COUNT == 9, "Please handle the new device type below");
     switch (DeviceType)
     {
 #if D3D11_SUPPORTED
@@ -658,6 +662,12 @@ TEXTURE_FORMAT GetTextureFormatFromNative(int64_t NativeFormat, RENDER_DEVICE_TY
             return GetTextureFormatFromNativeWebGPU(NativeFormat);
 #endif
 
+        case RENDER_DEVICE_TYPE_NULL:
+            // See GetNativeTextureFormat()
+            return NativeFormat >= 0 && NativeFormat < TEX_FORMAT_NUM_FORMATS ?
+                static_cast<TEXTURE_FORMAT>(NativeFormat) :
+                TEX_FORMAT_UNKNOWN;
+
         default:
             UNSUPPORTED("Unsupported device type");
             return TEX_FORMAT_UNKNOWN;
@@ -744,7 +754,7 @@ IDXCompiler* GetDeviceDXCompiler(IRenderDevice* pDevice)
     }
 
     const RENDER_DEVICE_TYPE DeviceType = pDevice->GetDeviceInfo().Type;
-    static_assert(RENDER_DEVICE_TYPE_COUNT == 8, "Please handle the new device type below");
+    static_assert(RENDER_DEVICE_TYPE_COUNT == 9, "Please handle the new device type below");
     switch (DeviceType)
     {
 #if D3D11_SUPPORTED
@@ -778,6 +788,11 @@ IDXCompiler* GetDeviceDXCompiler(IRenderDevice* pDevice)
             return nullptr;
 #endif
 
+#if NULL_SUPPORTED
+        case RENDER_DEVICE_TYPE_NULL:
+            return nullptr;
+#endif
+
         default:
             UNSUPPORTED("Unsupported device type");
             return nullptr;
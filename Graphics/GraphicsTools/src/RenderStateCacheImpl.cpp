@@ -50,9 +50,34 @@
 #include "ShaderSourceFactoryUtils.hpp"
 #include "DXCompiler.hpp"
 
+#if GL_SUPPORTED || GLES_SUPPORTED
+#    include "RenderDeviceGL.h"
+#endif
+
 namespace Diligent
 {
 
+bool RenderStateCacheImpl::Load(const IDataBlob* pArchive,
+                                Uint32           ContentVersion,
+                                bool             MakeCopy)
+{
+    if (!m_pDearchiver->LoadArchive(pArchive, ContentVersion, MakeCopy))
+        return false;
+
+#if GL_SUPPORTED || GLES_SUPPORTED
+    // OpenGL program binaries are stored in the device-specific data section of the archive
+    if (RefCntAutoPtr<IRenderDeviceGL> pDeviceGL{m_pDevice, IID_RenderDeviceGL})
+    {
+        RefCntAutoPtr<IDataBlob> pBinaries;
+        m_pDearchiver->GetDeviceData(m_DeviceType, &pBinaries);
+        if (pBinaries)
+            pDeviceGL->LoadProgramBinaries(pBinaries);
+    }
+#endif
+
+    return true;
+}
+
 Bool RenderStateCacheImpl::WriteToBlob(Uint32 ContentVersion, IDataBlob** ppBlob)
 {
     if (ContentVersion == ~0u)
@@ -80,6 +105,17 @@ Bool RenderStateCacheImpl::WriteToBlob(Uint32 ContentVersion, IDataBlob** ppBlob
 
     m_pArchiver->Reset();
 
+#if GL_SUPPORTED || GLES_SUPPORTED
+    if (RefCntAutoPtr<IRenderDeviceGL> pDeviceGL{m_pDevice, IID_RenderDeviceGL})
+    {
+        RefCntAutoPtr<IDataBlob> pBinaries;
+        pDeviceGL->StoreProgramBinaries(&pBinaries);
+        // If the program binary cache is disabled, the binaries of the loaded archives are kept
+        if (pBinaries)
+            m_pDearchiver->SetDeviceData(m_DeviceType, pBinaries);
+    }
+#endif
+
     return m_pDearchiver->Store(ppBlob);
 }
 
@@ -104,6 +140,12 @@ void RenderStateCacheImpl::Reset()
     m_ReloadableShaders.clear();
     m_Pipelines.clear();
     m_ReloadablePipelines.clear();
+
+    {
+        // Existing async pipelines keep the old pool alive
+        std::lock_guard<std::mutex> Guard{m_DescInternPoolMtx};
+        m_pDescInternPool = std::make_shared<DescriptionInternPool>();
+    }
 }
 
 RefCntAutoPtr<IShader> RenderStateCacheImpl::FindReloadableShader(IShader* pShader)
@@ -209,6 +251,12 @@ RenderStateCacheImpl::RenderStateCacheImpl(IReferenceCounters*               pRe
         case RENDER_DEVICE_TYPE_WEBGPU:
             break;
 
+        case RENDER_DEVICE_TYPE_NULL:
+            // Archives do not store device-specific data for the null device (see RenderDeviceTypeToArchiveDeviceType),
+            // so there is nothing the cache could serialize or unpack.
+            LOG_ERROR_AND_THROW("Render state cache is not supported by the null device");
+            break;
+
         default:
             UNEXPECTED("Unknown device type");
     }
@@ -27,10 +27,147 @@
 
 #include "ScreenCapture.hpp"
 
+#include <cstring>
+
+#include "ThreadPool.hpp"
+#include "DataBlobImpl.hpp"
+#include "Float16.hpp"
+#include "GraphicsAccessories.hpp"
+
+#if defined(__clang__)
+#    pragma clang diagnostic push
+#    pragma clang diagnostic ignored "-Wunused-function"
+#elif defined(__GNUC__)
+#    pragma GCC diagnostic push
+#    pragma GCC diagnostic ignored "-Wunused-function"
+#endif
+#define STB_IMAGE_WRITE_IMPLEMENTATION
+#define STB_IMAGE_WRITE_STATIC
+#define STBI_WRITE_NO_STDIO
+#include "../../../ThirdParty/stb/stb_image_write.h"
+#if defined(__clang__)
+#    pragma clang diagnostic pop
+#elif defined(__GNUC__)
+#    pragma GCC diagnostic pop
+#endif
+
 namespace Diligent
 {
 
+struct ScreenCapture::ProcessingCapture
+{
+    RefCntAutoPtr<ITexture> pTex;
+
+    Uint32 Id     = 0;
+    Uint32 Width  = 0;
+    Uint32 Height = 0;
+
+    TEXTURE_FORMAT Format = TEX_FORMAT_UNKNOWN;
+
+    // Mapped staging texture data
+    const Uint8* pData  = nullptr;
+    Uint64       Stride = 0;
+
+    TimePoint CaptureTime;
+    TimePoint HandOffTime;
+
+    RefCntAutoPtr<IAsyncTask> pTask;
+};
+
+namespace
+{
+
+double GetElapsedMs(std::chrono::steady_clock::time_point Start, std::chrono::steady_clock::time_point End)
+{
+    return std::chrono::duration<double, std::milli>(End - Start).count();
+}
+
+Uint8 UnormToUint8(float Value)
+{
+    return static_cast<Uint8>(std::min(std::max(Value, 0.f), 1.f) * 255.f + 0.5f);
+}
+
+// Converts the mapped rows to tightly packed RGBA8 pixels
+bool ConvertToRGBA8(const Uint8* pSrc, Uint64 SrcStride, Uint32 Width, Uint32 Height, TEXTURE_FORMAT Format, Uint8* pDst)
+{
+    const size_t DstStride = size_t{Width} * 4;
+    for (Uint32 y = 0; y < Height; ++y)
+    {
+        const Uint8* pSrcRow = pSrc + y * SrcStride;
+        Uint8*       pDstRow = pDst + y * DstStride;
+        switch (Format)
+        {
+            case TEX_FORMAT_RGBA8_TYPELESS:
+            case TEX_FORMAT_RGBA8_UNORM:
+            case TEX_FORMAT_RGBA8_UNORM_SRGB:
+                std::memcpy(pDstRow, pSrcRow, DstStride);
+                break;
+
+            case TEX_FORMAT_BGRA8_TYPELESS:
+            case TEX_FORMAT_BGRA8_UNORM:
+            case TEX_FORMAT_BGRA8_UNORM_SRGB:
+            case TEX_FORMAT_BGRX8_TYPELESS:
+            case TEX_FORMAT_BGRX8_UNORM:
+            case TEX_FORMAT_BGRX8_UNORM_SRGB:
+            {
+                const bool HasAlpha = Format == TEX_FORMAT_BGRA8_TYPELESS || Format == TEX_FORMAT_BGRA8_UNORM || Format == TEX_FORMAT_BGRA8_UNORM_SRGB;
+                for (Uint32 x = 0; x < Width; ++x)
+                {
+                    pDstRow[x * 4 + 0] = pSrcRow[x * 4 + 2];
+                    pDstRow[x * 4 + 1] = pSrcRow[x * 4 + 1];
+                    pDstRow[x * 4 + 2] = pSrcRow[x * 4 + 0];
+                    pDstRow[x * 4 + 3] = HasAlpha ? pSrcRow[x * 4 + 3] : 255;
+                }
+                break;
+            }
+
+            case TEX_FORMAT_RGB10A2_TYPELESS:
+            case TEX_FORMAT_RGB10A2_UNORM:
+                for (Uint32 x = 0; x < Width; ++x)
+                {
+                    Uint32 Texel;
+                    std::memcpy(&Texel, pSrcRow + x * 4, sizeof(Texel));
+                    pDstRow[x * 4 + 0] = static_cast<Uint8>(((Texel >> 0) & 0x3FFu) * 255u / 1023u);
+                    pDstRow[x * 4 + 1] = static_cast<Uint8>(((Texel >> 10) & 0x3FFu) * 255u / 1023u);
+                    pDstRow[x * 4 + 2] = static_cast<Uint8>(((Texel >> 20) & 0x3FFu) * 255u / 1023u);
+                    pDstRow[x * 4 + 3] = static_cast<Uint8>(((Texel >> 30) & 0x3u) * 255u / 3u);
+                }
+                break;
+
+            case TEX_FORMAT_RGBA16_FLOAT:
+                for (Uint32 x = 0; x < Width * 4; ++x)
+                {
+                    Uint16 Half;
+                    std::memcpy(&Half, pSrcRow + x * 2, sizeof(Half));
+                    pDstRow[x] = UnormToUint8(Float16::HalfBitsToFloat(Half));
+                }
+                break;
+
+            case TEX_FORMAT_RGBA32_FLOAT:
+                for (Uint32 x = 0; x < Width * 4; ++x)
+                {
+                    float Value;
+                    std::memcpy(&Value, pSrcRow + x * 4, sizeof(Value));
+                    pDstRow[x] = UnormToUint8(Value);
+                }
+                break;
+
+            default:
+                return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
 ScreenCapture::ScreenCapture(IRenderDevice* pDevice) :
+    ScreenCapture{pDevice, CreateInfo{}}
+{
+}
+
+ScreenCapture::ScreenCapture(IRenderDevice* pDevice, const CreateInfo& CI) :
+    m_CI{CI},
     m_pDevice{pDevice}
 {
     FenceDesc fenceDesc;
@@ -38,8 +175,58 @@ ScreenCapture::ScreenCapture(IRenderDevice* pDevice) :
     m_pDevice->CreateFence(fenceDesc, &m_pFence);
 }
 
-void ScreenCapture::Capture(ISwapChain* pSwapChain, IDeviceContext* pContext, Uint32 FrameId)
+ScreenCapture::~ScreenCapture()
 {
+    DEV_CHECK_ERR(m_ProcessingCaptures.empty(), "There are captures that are still being processed. Call WaitForIdle() before destroying the screen capture object.");
+    // Make sure that the workers do not access the object after it is destroyed
+    for (std::unique_ptr<ProcessingCapture>& pCapture : m_ProcessingCaptures)
+    {
+        if (pCapture->pTask)
+            pCapture->pTask->WaitForCompletion();
+    }
+}
+
+size_t ScreenCapture::GetNumCapturesInFlight()
+{
+    std::lock_guard<std::mutex> Lock{m_PendingTexturesMtx};
+    return m_PendingTextures.size() + m_ProcessingCaptures.size();
+}
+
+bool ScreenCapture::Capture(ISwapChain* pSwapChain, IDeviceContext* pContext, Uint32 FrameId)
+{
+    if (m_CI.MaxCapturesInFlight != 0)
+    {
+        while (GetNumCapturesInFlight() >= m_CI.MaxCapturesInFlight)
+        {
+            if (!m_CI.WaitWhenFull)
+            {
+                std::lock_guard<std::mutex> Lock{m_StatsMtx};
+                ++m_Stats.NumDropped;
+                return false;
+            }
+
+            Uint64 OldestFence = 0;
+            {
+                std::lock_guard<std::mutex> Lock{m_PendingTexturesMtx};
+                if (!m_PendingTextures.empty())
+                    OldestFence = m_PendingTextures.front().Fence;
+            }
+
+            if (OldestFence != 0)
+            {
+                // Wait for the GPU to finish the oldest copy
+                pContext->Flush();
+                m_pFence->Wait(OldestFence);
+                Poll(pContext);
+            }
+            else
+            {
+                // All staging textures are being processed by the workers - wait for the oldest one
+                RecycleProcessedCaptures(pContext, true);
+            }
+        }
+    }
+
     ITextureView*        pCurrentRTV        = pSwapChain->GetCurrentBackBufferRTV();
     ITexture*            pCurrentBackBuffer = pCurrentRTV->GetTexture();
     const SwapChainDesc& SCDesc             = pSwapChain->GetDesc();
@@ -81,10 +268,17 @@ void ScreenCapture::Capture(ISwapChain* pSwapChain, IDeviceContext* pContext, Ui
 
     {
         std::lock_guard<std::mutex> Lock{m_PendingTexturesMtx};
-        m_PendingTextures.emplace_back(std::move(pStagingTexture), FrameId, m_CurrentFenceValue);
+        m_PendingTextures.emplace_back(std::move(pStagingTexture), FrameId, m_CurrentFenceValue, std::chrono::steady_clock::now());
+    }
+
+    {
+        std::lock_guard<std::mutex> Lock{m_StatsMtx};
+        ++m_Stats.NumCaptured;
     }
 
     ++m_CurrentFenceValue;
+
+    return true;
 }
 
 
@@ -128,4 +322,198 @@ void ScreenCapture::RecycleStagingTexture(RefCntAutoPtr<ITexture>&& pTexture)
     m_AvailableTextures.emplace_back(std::move(pTexture));
 }
 
+void ScreenCapture::Poll(IDeviceContext* pContext)
+{
+    RecycleProcessedCaptures(pContext, false);
+
+    const Uint64 CompletedFenceValue = m_pFence->GetCompletedValue();
+    while (true)
+    {
+        std::unique_ptr<ProcessingCapture> pCapture;
+        {
+            std::lock_guard<std::mutex> Lock{m_PendingTexturesMtx};
+            if (m_PendingTextures.empty() || m_PendingTextures.front().Fence > CompletedFenceValue)
+                break;
+
+            PendingTextureInfo& OldestCapture = m_PendingTextures.front();
+
+            pCapture              = std::make_unique<ProcessingCapture>();
+            pCapture->pTex        = std::move(OldestCapture.pTex);
+            pCapture->Id          = OldestCapture.Id;
+            pCapture->CaptureTime = OldestCapture.CaptureTime;
+            m_PendingTextures.pop_front();
+        }
+
+        const TextureDesc& TexDesc = pCapture->pTex->GetDesc();
+        pCapture->Width            = TexDesc.Width;
+        pCapture->Height           = TexDesc.Height;
+        pCapture->Format           = TexDesc.Format;
+
+        const TimePoint ReadbackTime = std::chrono::steady_clock::now();
+
+        MappedTextureSubresource MappedData;
+        pContext->MapTextureSubresource(pCapture->pTex, 0, 0, MAP_READ, MAP_FLAG_DO_NOT_WAIT, nullptr, MappedData);
+        if (MappedData.pData == nullptr)
+        {
+            LOG_ERROR_MESSAGE("Failed to map the staging texture of capture ", pCapture->Id);
+            RecycleStagingTexture(std::move(pCapture->pTex));
+            continue;
+        }
+        pCapture->pData       = static_cast<const Uint8*>(MappedData.pData);
+        pCapture->Stride      = MappedData.Stride;
+        pCapture->HandOffTime = std::chrono::steady_clock::now();
+
+        {
+            std::lock_guard<std::mutex> Lock{m_StatsMtx};
+            m_Stats.Readback.Add(GetElapsedMs(pCapture->CaptureTime, ReadbackTime));
+            m_Stats.Map.Add(GetElapsedMs(ReadbackTime, pCapture->HandOffTime));
+        }
+
+        if (m_CI.pThreadPool != nullptr)
+        {
+            ProcessingCapture* pCaptureRaw = pCapture.get();
+            pCapture->pTask                = EnqueueAsyncWork(m_CI.pThreadPool,
+                                                              [this, pCaptureRaw](Uint32) {
+                                                   ProcessCapture(*pCaptureRaw);
+                                                   return ASYNC_TASK_STATUS_COMPLETE;
+                                               });
+        }
+        else
+        {
+            ProcessCapture(*pCapture);
+        }
+
+        m_ProcessingCaptures.emplace_back(std::move(pCapture));
+    }
+
+    RecycleProcessedCaptures(pContext, false);
+}
+
+void ScreenCapture::RecycleProcessedCaptures(IDeviceContext* pContext, bool Wait)
+{
+    for (auto it = m_ProcessingCaptures.begin(); it != m_ProcessingCaptures.end();)
+    {
+        ProcessingCapture& Capture = **it;
+        if (Capture.pTask && !Capture.pTask->IsFinished())
+        {
+            if (!Wait)
+            {
+                ++it;
+                continue;
+            }
+            Capture.pTask->WaitForCompletion();
+            // Only wait for the oldest capture
+            Wait = false;
+        }
+
+        pContext->UnmapTextureSubresource(Capture.pTex, 0, 0);
+        RecycleStagingTexture(std::move(Capture.pTex));
+        it = m_ProcessingCaptures.erase(it);
+    }
+}
+
+void ScreenCapture::ProcessCapture(ProcessingCapture& Capture)
+{
+    const TimePoint StartTime = std::chrono::steady_clock::now();
+
+    RefCntAutoPtr<DataBlobImpl> pPixels = DataBlobImpl::Create(size_t{Capture.Width} * size_t{Capture.Height} * 4);
+    if (!ConvertToRGBA8(Capture.pData, Capture.Stride, Capture.Width, Capture.Height, Capture.Format, pPixels->GetDataPtr<Uint8>()))
+    {
+        LOG_ERROR_MESSAGE("Screen capture does not support format ", GetTextureFormatAttribs(Capture.Format).Name);
+        return;
+    }
+
+    const TimePoint ConvertTime = std::chrono::steady_clock::now();
+
+    EncodedCapture Encoded;
+    Encoded.Id       = Capture.Id;
+    Encoded.Width    = Capture.Width;
+    Encoded.Height   = Capture.Height;
+    Encoded.Encoding = m_CI.Encoding;
+    if (m_CI.Encoding == ENCODING::PNG)
+    {
+        std::vector<Uint8> PNGData;
+
+        auto WriteFunc = [](void* pContext, void* pData, int Size) {
+            std::vector<Uint8>& Data   = *static_cast<std::vector<Uint8>*>(pContext);
+            const Uint8*        pBytes = static_cast<const Uint8*>(pData);
+            Data.insert(Data.end(), pBytes, pBytes + Size);
+        };
+
+        const int Stride = static_cast<int>(Capture.Width * 4);
+        if (stbi_write_png_to_func(WriteFunc, &PNGData, static_cast<int>(Capture.Width), static_cast<int>(Capture.Height), 4, pPixels->GetConstDataPtr(), Stride) == 0)
+        {
+            LOG_ERROR_MESSAGE("Failed to encode screen capture ", Capture.Id);
+            return;
+        }
+
+        Encoded.pData = DataBlobImpl::Create(PNGData.size(), PNGData.data());
+    }
+    else
+    {
+        Encoded.pData = std::move(pPixels);
+    }
+
+    const TimePoint EndTime = std::chrono::steady_clock::now();
+
+    {
+        std::lock_guard<std::mutex> Lock{m_StatsMtx};
+        ++m_Stats.NumEncoded;
+        m_Stats.Queue.Add(GetElapsedMs(Capture.HandOffTime, StartTime));
+        m_Stats.Convert.Add(GetElapsedMs(StartTime, ConvertTime));
+        m_Stats.Encode.Add(GetElapsedMs(ConvertTime, EndTime));
+        m_Stats.Total.Add(GetElapsedMs(Capture.CaptureTime, EndTime));
+    }
+
+    AddEncodedCapture(std::move(Encoded));
+}
+
+void ScreenCapture::AddEncodedCapture(EncodedCapture&& Capture)
+{
+    if (m_CI.OnCaptureEncoded)
+    {
+        m_CI.OnCaptureEncoded(std::move(Capture));
+    }
+    else
+    {
+        std::lock_guard<std::mutex> Lock{m_EncodedCapturesMtx};
+        m_EncodedCaptures.emplace_back(std::move(Capture));
+    }
+}
+
+ScreenCapture::EncodedCapture ScreenCapture::GetEncodedCapture()
+{
+    EncodedCapture Capture;
+
+    std::lock_guard<std::mutex> Lock{m_EncodedCapturesMtx};
+    if (!m_EncodedCaptures.empty())
+    {
+        Capture = std::move(m_EncodedCaptures.front());
+        m_EncodedCaptures.pop_front();
+    }
+    return Capture;
+}
+
+void ScreenCapture::WaitForIdle(IDeviceContext* pContext)
+{
+    {
+        std::lock_guard<std::mutex> Lock{m_PendingTexturesMtx};
+        if (!m_PendingTextures.empty())
+        {
+            pContext->Flush();
+            m_pFence->Wait(m_PendingTextures.back().Fence);
+        }
+    }
+    Poll(pContext);
+
+    while (!m_ProcessingCaptures.empty())
+        RecycleProcessedCaptures(pContext, true);
+}
+
+ScreenCapture::Statistics ScreenCapture::GetStatistics()
+{
+    std::lock_guard<std::mutex> Lock{m_StatsMtx};
+    return m_Stats;
+}
+
 } // namespace Diligent
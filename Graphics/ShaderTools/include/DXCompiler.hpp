@@ -33,6 +33,7 @@
 #include "Constants.h"
 #include "Shader.h"
 #include "DataBlob.h"
+#include "RefCntAutoPtr.hpp"
 #include "ResourceBindingMap.hpp"
 
 // defined in dxcapi.h
@@ -45,6 +46,8 @@ struct ID3D12ShaderReflection;
 namespace Diligent
 {
 
+struct IThreadPool;
+
 enum class DXCompilerTarget
 {
     Direct3D12, // compiles to DXIL
@@ -86,7 +89,8 @@ struct IDXCompiler
     /// Compiles HLSL source code to DXIL or SPIRV.
     ///
     /// \remarks    The method is thread-safe.
-    ///             For each compilation, the method creates a new IDxcCompiler instance.
+    ///             DXC objects must be created and used on the same thread, so every thread
+    ///             uses its own set of DXC instances that is released when the thread exits.
     virtual bool Compile(const CompileAttribs& Attribs) = 0;
 
     virtual void Compile(const ShaderCreateInfo& ShaderCI,
@@ -96,6 +100,49 @@ struct IDXCompiler
                          std::vector<uint32_t>*  pByteCode,
                          IDataBlob**             ppCompilerOutput) noexcept(false) = 0;
 
+    struct BatchCompileItem
+    {
+        /// Shader create info. The struct and all the data it references
+        /// must remain valid until CompileBatch() returns.
+        const ShaderCreateInfo* pShaderCI = nullptr;
+
+        /// Shader model, see Compile().
+        ShaderVersion ShaderModel;
+
+        /// Optional preamble, see Compile().
+        const char* Preamble = nullptr;
+
+        /// Output: compiled byte code. Empty if the compilation failed.
+        std::vector<uint32_t> ByteCode;
+
+        /// Output: compiler messages, if any.
+        RefCntAutoPtr<IDataBlob> pCompilerOutput;
+
+        /// Output: whether the shader was compiled successfully.
+        bool Succeeded = false;
+    };
+
+    /// Compiles a batch of shaders.
+    ///
+    /// \param [in, out] pItems      - Pointer to the array of NumItems items to compile.
+    ///                                The output members of every item are overwritten.
+    /// \param [in]      NumItems    - The number of items.
+    /// \param [in]      pThreadPool - Optional thread pool. If not null, the items are compiled
+    ///                                in parallel by the pool threads and the calling thread,
+    ///                                so up to N + 1 items are compiled at a time, where N
+    ///                                is the number of threads in the pool.
+    ///                                Otherwise, all items are compiled by the calling thread.
+    ///
+    /// \return     The number of successfully compiled items.
+    ///
+    /// \remarks    The method blocks until all items are compiled.
+    ///             Include files are read once per batch and shared by all compilations,
+    ///             so a shader source stream factory must return the same file contents
+    ///             for the duration of the call.
+    virtual Uint32 CompileBatch(BatchCompileItem* pItems,
+                                size_t            NumItems,
+                                IThreadPool*      pThreadPool) = 0;
+
 
     using BindInfo            = ResourceBinding::BindInfo;
     using TResourceBindingMap = ResourceBinding::TMap;
@@ -56,6 +56,7 @@ namespace Diligent
 {
 
 class StringPool;
+struct WGSLResourceBindingTable;
 
 struct WGSLShaderResourceAttribs
 {
@@ -188,15 +189,18 @@ static_assert(sizeof(WGSLSpecializationConstantAttribs) % sizeof(void*) == 0, "S
 class WGSLShaderResources
 {
 public:
-    WGSLShaderResources(IMemoryAllocator&      Allocator,
-                        const std::string&     WGSL,
-                        SHADER_SOURCE_LANGUAGE SourceLanguage,
-                        const char*            ShaderName,
-                        const char*            CombinedSamplerSuffix,
-                        const char*            EntryPoint,
-                        const char*            EmulatedArrayIndexSuffix,
-                        bool                   LoadUniformBufferReflection,
-                        IDataBlob**            ppTintOutput) noexcept(false);
+    /// If pBindingTable is not null, it receives the resource binding table built from
+    /// the same parsed program, see Diligent::BuildWGSLResourceBindingTable().
+    WGSLShaderResources(IMemoryAllocator&         Allocator,
+                        const std::string&        WGSL,
+                        SHADER_SOURCE_LANGUAGE    SourceLanguage,
+                        const char*               ShaderName,
+                        const char*               CombinedSamplerSuffix,
+                        const char*               EntryPoint,
+                        const char*               EmulatedArrayIndexSuffix,
+                        bool                      LoadUniformBufferReflection,
+                        IDataBlob**               ppTintOutput,
+                        WGSLResourceBindingTable* pBindingTable = nullptr) noexcept(false);
 
     // clang-format off
     WGSLShaderResources             (const WGSLShaderResources&)  = delete;
@@ -42,6 +42,9 @@ struct ResourceBinding;
 namespace Diligent
 {
 
+/// Converts SPIR-V to WGSL.
+/// Conversion results are memoized by the SPIR-V content hash, so converting
+/// the same module again returns the cached WGSL.
 std::string ConvertSPIRVtoWGSL(const std::vector<uint32_t>& SPIRV);
 
 struct WGSLResourceBindingInfo
@@ -56,6 +59,52 @@ std::string RemapWGSLResourceBindings(const std::string&         WGSL,
                                       const WGSLResourceMapping& ResMapping,
                                       const char*                EmulatedArrayIndexSuffix);
 
+/// Locations of resource binding attributes in WGSL source.
+
+/// The table is built once per shader and allows remapping resource bindings for
+/// different pipeline layouts by patching the source text instead of parsing
+/// the source and regenerating it with tint each time.
+struct WGSLResourceBindingTable
+{
+    struct BindingSite
+    {
+        /// Resource variable name
+        std::string Name;
+
+        /// Alternative resource name, see GetWGSLResourceAlternativeName()
+        std::string AltName;
+
+        /// Source range of the @group attribute value
+        size_t GroupStart = 0;
+        size_t GroupEnd   = 0;
+
+        /// Source range of the @binding attribute value
+        size_t BindingStart = 0;
+        size_t BindingEnd   = 0;
+    };
+    std::vector<BindingSite> Sites;
+
+    /// Whether the table was successfully built.
+    /// An empty table is valid if the source does not use any resources.
+    bool IsValid = false;
+};
+
+/// Parses WGSL source and builds the resource binding table.
+/// If the binding sites can't be located in the source, the returned table is invalid.
+WGSLResourceBindingTable BuildWGSLResourceBindingTable(const std::string& WGSL);
+
+/// Builds the resource binding table from the program parsed from the WGSL source.
+/// Use this overload to avoid parsing the source again when the program is already available.
+WGSLResourceBindingTable BuildWGSLResourceBindingTable(const tint::Program& Program, const std::string& WGSL);
+
+/// Remaps resource bindings using the binding table previously built for the same WGSL source
+/// by BuildWGSLResourceBindingTable(). If the table is invalid, the function falls back to
+/// remapping with tint.
+std::string RemapWGSLResourceBindings(const std::string&              WGSL,
+                                      const WGSLResourceBindingTable& BindingTable,
+                                      const WGSLResourceMapping&      ResMapping,
+                                      const char*                     EmulatedArrayIndexSuffix);
+
 
 /// When WGSL is generated from SPIR-V, the names of resources may be mangled
 ///
@@ -30,10 +30,14 @@
 #endif
 
 #include <memory>
+#include <vector>
 #include <mutex>
 #include <atomic>
 #include <array>
 #include <sstream>
+#include <thread>
+#include <unordered_map>
+#include <algorithm>
 
 #if PLATFORM_WIN32 || PLATFORM_UNIVERSAL_WINDOWS
 #    include "WinHPreface.h"
@@ -61,6 +65,8 @@
 #include "RefCntAutoPtr.hpp"
 #include "ShaderSourcePath.hpp"
 #include "ShaderToolsCommon.hpp"
+#include "ThreadPool.hpp"
+#include "HashUtils.hpp"
 
 #include "HLSLUtils.hpp"
 
@@ -75,6 +81,8 @@ constexpr Uint32 VK_API_VERSION_1_1 = (1u << 22) | (1u << 12);
 constexpr Uint32 VK_API_VERSION_1_2 = (1u << 22) | (2u << 12);
 
 
+class DxcIncludeCache;
+
 class DXCompilerImpl final : public IDXCompiler
 {
 public:
@@ -83,6 +91,14 @@ public:
         m_APIVersion{APIVersion}
     {}
 
+    ~DXCompilerImpl()
+    {
+        // Release the instances of the threads that are still alive. Their releasers
+        // will find the registry empty when the threads exit.
+        std::lock_guard<std::mutex> Lock{m_pThreadInstances->Mtx};
+        m_pThreadInstances->Instances.clear();
+    }
+
     ShaderVersion GetMaxShaderModel() override final
     {
         // Force loading the library
@@ -123,8 +139,78 @@ public:
                                        IDxcBlob*                  pSrcBytecode,
                                        IDxcBlob**                 ppDstByteCode) override final;
 
+    virtual Uint32 CompileBatch(BatchCompileItem* pItems,
+                                size_t            NumItems,
+                                IThreadPool*      pThreadPool) override final;
+
 private:
-    bool ValidateAndSign(DxcCreateInstanceProc CreateInstance, IDxcLibrary* pdxcLibrary, CComPtr<IDxcBlob>& pCompiled, IDxcBlob** ppOutput) const noexcept(false);
+    // Objects created by DxcCreateInstance must be created and used on the same thread,
+    // so every thread that compiles shaders gets its own set of objects.
+    struct DxcInstances
+    {
+        CComPtr<IDxcLibrary>   pLibrary;
+        CComPtr<IDxcCompiler>  pCompiler;
+        CComPtr<IDxcValidator> pValidator;
+    };
+
+    // Instance sets of all threads that used this compiler. The registry is shared with the
+    // thread-local releasers that remove the thread's set when the thread exits.
+    struct ThreadInstanceRegistry
+    {
+        std::mutex                                                         Mtx;
+        std::unordered_map<std::thread::id, std::unique_ptr<DxcInstances>> Instances;
+    };
+
+    // Removes the instance sets of the calling thread from all registries it was added to
+    // when the thread exits.
+    class ThreadInstanceReleaser
+    {
+    public:
+        static void Register(const std::shared_ptr<ThreadInstanceRegistry>& pRegistry)
+        {
+            thread_local ThreadInstanceReleaser Releaser;
+
+            // Drop the registries of the compilers that have been destroyed
+            auto& Registries = Releaser.m_Registries;
+            Registries.erase(std::remove_if(Registries.begin(), Registries.end(),
+                                            [](const std::weak_ptr<ThreadInstanceRegistry>& wpRegistry) { return wpRegistry.expired(); }),
+                             Registries.end());
+            Registries.emplace_back(pRegistry);
+        }
+
+        ~ThreadInstanceReleaser()
+        {
+            const std::thread::id ThreadId = std::this_thread::get_id();
+            for (const std::weak_ptr<ThreadInstanceRegistry>& wpRegistry : m_Registries)
+            {
+                if (std::shared_ptr<ThreadInstanceRegistry> pRegistry = wpRegistry.lock())
+                {
+                    // The instances are released under the lock so that the compiler
+                    // cannot unload the library while they are being destroyed.
+                    std::lock_guard<std::mutex> Lock{pRegistry->Mtx};
+                    pRegistry->Instances.erase(ThreadId);
+                }
+            }
+        }
+
+    private:
+        std::vector<std::weak_ptr<ThreadInstanceRegistry>> m_Registries;
+    };
+
+    // Returns the instance set of the calling thread, creating it if necessary.
+    DxcInstances& GetThreadInstances(DxcCreateInstanceProc CreateInstance) noexcept(false);
+
+    bool CompileImpl(const CompileAttribs& Attribs, DxcIncludeCache* pIncludeCache);
+
+    void CompileShader(const ShaderCreateInfo& ShaderCI,
+                       ShaderVersion           ShaderModel,
+                       const char*             Preamble,
+                       IDxcBlob**              ppByteCodeBlob,
+                       std::vector<uint32_t>*  pByteCode,
+                       IDataBlob**             ppCompilerOutput,
+                       DxcIncludeCache*        pIncludeCache) noexcept(false);
+
+    bool ValidateAndSign(DxcCreateInstanceProc CreateInstance, DxcInstances& Instances, CComPtr<IDxcBlob>& pCompiled, IDxcBlob** ppOutput) noexcept(false);
 
     enum RES_TYPE : Uint32
     {
@@ -162,6 +248,9 @@ private:
 private:
     DXCompilerLibrary m_Library;
     const Uint32      m_APIVersion;
+
+    // Must be declared after m_Library so that the objects are released before the library is unloaded
+    std::shared_ptr<ThreadInstanceRegistry> m_pThreadInstances = std::make_shared<ThreadInstanceRegistry>();
 };
 
 #define CHECK_D3D_RESULT(Expr, Message)   \
@@ -174,12 +263,67 @@ private:
         }                                 \
     } while (false)
 
+// Returns null if the file is not found
+RefCntAutoPtr<IDataBlob> ReadIncludeFile(IShaderSourceInputStreamFactory* pStreamFactory, const String& FileName)
+{
+    RefCntAutoPtr<IFileStream> pSourceStream;
+    pStreamFactory->CreateInputStream2(FileName.c_str(), CREATE_SHADER_SOURCE_INPUT_STREAM_FLAG_SILENT, &pSourceStream);
+    if (pSourceStream == nullptr)
+        return {};
+
+    RefCntAutoPtr<DataBlobImpl> pFileData = DataBlobImpl::Create();
+    pSourceStream->ReadBlob(pFileData);
+    return RefCntAutoPtr<IDataBlob>{std::move(pFileData)};
+}
+
+// Include file cache shared by all compilations of a batch.
+// DXC probes every include search path for every #include directive, so the cache
+// also remembers the files that were not found.
+class DxcIncludeCache
+{
+public:
+    // Returns null if the file is not found
+    RefCntAutoPtr<IDataBlob> LoadFile(IShaderSourceInputStreamFactory* pStreamFactory, const String& FileName)
+    {
+        FileKey Key{pStreamFactory, FileName};
+        {
+            std::lock_guard<std::mutex> Lock{m_Mtx};
+
+            auto it = m_Files.find(Key);
+            if (it != m_Files.end())
+                return it->second;
+        }
+
+        // Read the file without holding the lock
+        RefCntAutoPtr<IDataBlob> pFileData = ReadIncludeFile(pStreamFactory, FileName);
+
+        std::lock_guard<std::mutex> Lock{m_Mtx};
+        // If another thread has read the same file in the meantime, use its copy
+        return m_Files.emplace(std::move(Key), std::move(pFileData)).first->second;
+    }
+
+private:
+    using FileKey = std::pair<IShaderSourceInputStreamFactory*, String>;
+    struct FileKeyHasher
+    {
+        size_t operator()(const FileKey& Key) const
+        {
+            return ComputeHash(Key.first, Key.second);
+        }
+    };
+
+    std::mutex                                                         m_Mtx;
+    std::unordered_map<FileKey, RefCntAutoPtr<IDataBlob>, FileKeyHasher> m_Files;
+};
+
 class DxcIncludeHandlerImpl final : public IDxcIncludeHandler
 {
 public:
-    explicit DxcIncludeHandlerImpl(IShaderSourceInputStreamFactory* pStreamFactory, CComPtr<IDxcLibrary> pdxcLibrary) :
-        m_pdxcLibrary{std::move(pdxcLibrary)},
-        m_pStreamFactory{pStreamFactory}
+    // pIncludeCache is optional. If it is null, include files are read from the stream factory directly.
+    DxcIncludeHandlerImpl(IShaderSourceInputStreamFactory* pStreamFactory, IDxcLibrary* pdxcLibrary, DxcIncludeCache* pIncludeCache) :
+        m_pdxcLibrary{pdxcLibrary},
+        m_pStreamFactory{pStreamFactory},
+        m_pIncludeCache{pIncludeCache}
     {
     }
 
@@ -211,21 +355,20 @@ public:
         if (fileName.size() > 2 && fileName[0] == '.' && (fileName[1] == '\\' || fileName[1] == '/'))
             fileName.erase(0, 2);
 
-        RefCntAutoPtr<IFileStream> pSourceStream;
-        m_pStreamFactory->CreateInputStream2(fileName.c_str(), CREATE_SHADER_SOURCE_INPUT_STREAM_FLAG_SILENT, &pSourceStream);
-        if (pSourceStream == nullptr)
+        RefCntAutoPtr<IDataBlob> pFileData = m_pIncludeCache != nullptr ?
+            m_pIncludeCache->LoadFile(m_pStreamFactory, fileName) :
+            ReadIncludeFile(m_pStreamFactory, fileName);
+        if (pFileData == nullptr)
         {
             // S_OK with a null source tells DXC that this candidate was not found,
             // allowing it to try the next include path.
             return S_OK;
         }
 
-        RefCntAutoPtr<DataBlobImpl> pFileData = DataBlobImpl::Create();
-        pSourceStream->ReadBlob(pFileData);
-
         CComPtr<IDxcBlobEncoding> pSourceBlob;
 
-        HRESULT hr = m_pdxcLibrary->CreateBlobWithEncodingFromPinned(pFileData->GetDataPtr(), static_cast<UINT32>(pFileData->GetSize()), CP_UTF8, &pSourceBlob);
+        // Cached file data is shared between threads, but the pinned blob only reads it
+        HRESULT hr = m_pdxcLibrary->CreateBlobWithEncodingFromPinned(pFileData->GetConstDataPtr(), static_cast<UINT32>(pFileData->GetSize()), CP_UTF8, &pSourceBlob);
         if (FAILED(hr))
         {
             LOG_ERROR_MESSAGE("Failed to allocate space for shader include file ", fileName, ".");
@@ -257,6 +400,7 @@ public:
 private:
     CComPtr<IDxcLibrary>                   m_pdxcLibrary;
     IShaderSourceInputStreamFactory* const m_pStreamFactory;
+    DxcIncludeCache* const                 m_pIncludeCache;
     std::atomic_long                       m_RefCount{0};
     std::vector<RefCntAutoPtr<IDataBlob>>  m_FileDataCache;
 };
@@ -333,7 +477,38 @@ std::unique_ptr<IDXCompiler> CreateDXCompiler(DXCompilerTarget Target, Uint32 AP
     return std::make_unique<DXCompilerImpl>(Target, APIVersion, pLibraryName);
 }
 
+DXCompilerImpl::DxcInstances& DXCompilerImpl::GetThreadInstances(DxcCreateInstanceProc CreateInstance) noexcept(false)
+{
+    const std::thread::id ThreadId = std::this_thread::get_id();
+    {
+        std::lock_guard<std::mutex> Lock{m_pThreadInstances->Mtx};
+
+        auto it = m_pThreadInstances->Instances.find(ThreadId);
+        if (it != m_pThreadInstances->Instances.end())
+            return *it->second;
+    }
+
+    // NOTE: The call to DxcCreateInstance is thread-safe, but objects created by DxcCreateInstance aren't thread-safe.
+    // Compiler objects should be created and then used on the same thread.
+    // https://github.com/microsoft/DirectXShaderCompiler/wiki/Using-dxc.exe-and-dxcompiler.dll#dxcompiler-dll-interface
+    std::unique_ptr<DxcInstances> pInstances = std::make_unique<DxcInstances>();
+    CHECK_D3D_RESULT(CreateInstance(CLSID_DxcLibrary, IID_PPV_ARGS(&pInstances->pLibrary)), "Failed to create DXC Library");
+    CHECK_D3D_RESULT(CreateInstance(CLSID_DxcCompiler, IID_PPV_ARGS(&pInstances->pCompiler)), "Failed to create DXC Compiler");
+
+    ThreadInstanceReleaser::Register(m_pThreadInstances);
+
+    std::lock_guard<std::mutex> Lock{m_pThreadInstances->Mtx};
+    // Only the calling thread adds its own entry, so the emplacement always succeeds
+    auto it = m_pThreadInstances->Instances.emplace(ThreadId, std::move(pInstances)).first;
+    return *it->second;
+}
+
 bool DXCompilerImpl::Compile(const CompileAttribs& Attribs)
+{
+    return CompileImpl(Attribs, nullptr);
+}
+
+bool DXCompilerImpl::CompileImpl(const CompileAttribs& Attribs, DxcIncludeCache* pIncludeCache)
 {
     try
     {
@@ -351,20 +526,14 @@ bool DXCompilerImpl::Compile(const CompileAttribs& Attribs)
 
         HRESULT hr;
 
-        // NOTE: The call to DxcCreateInstance is thread-safe, but objects created by DxcCreateInstance aren't thread-safe.
-        // Compiler objects should be created and then used on the same thread.
-        // https://github.com/microsoft/DirectXShaderCompiler/wiki/Using-dxc.exe-and-dxcompiler.dll#dxcompiler-dll-interface
-
-        CComPtr<IDxcLibrary> pdxcLibrary;
-        CHECK_D3D_RESULT(CreateInstance(CLSID_DxcLibrary, IID_PPV_ARGS(&pdxcLibrary)), "Failed to create DXC Library");
-
-        CComPtr<IDxcCompiler> pdxcCompiler;
-        CHECK_D3D_RESULT(CreateInstance(CLSID_DxcCompiler, IID_PPV_ARGS(&pdxcCompiler)), "Failed to create DXC Compiler");
+        DxcInstances& Instances    = GetThreadInstances(CreateInstance);
+        IDxcLibrary*  pdxcLibrary  = Instances.pLibrary;
+        IDxcCompiler* pdxcCompiler = Instances.pCompiler;
 
         CComPtr<IDxcBlobEncoding> pSourceBlob;
         CHECK_D3D_RESULT(pdxcLibrary->CreateBlobWithEncodingFromPinned(Attribs.Source, UINT32{Attribs.SourceLength}, CP_UTF8, &pSourceBlob), "Failed to create DXC Blob Encoding");
 
-        DxcIncludeHandlerImpl IncludeHandler{Attribs.pShaderSourceStreamFactory, pdxcLibrary};
+        DxcIncludeHandlerImpl IncludeHandler{Attribs.pShaderSourceStreamFactory, pdxcLibrary, pIncludeCache};
 
         CComPtr<IDxcOperationResult> pdxcResult;
         hr = pdxcCompiler->Compile(
@@ -405,7 +574,7 @@ bool DXCompilerImpl::Compile(const CompileAttribs& Attribs)
         // Validate and sign
         if (m_Library.GetTarget() == DXCompilerTarget::Direct3D12)
         {
-            return ValidateAndSign(CreateInstance, pdxcLibrary, pCompiledBlob, Attribs.ppBlobOut);
+            return ValidateAndSign(CreateInstance, Instances, pCompiledBlob, Attribs.ppBlobOut);
         }
         else
         {
@@ -419,13 +588,13 @@ bool DXCompilerImpl::Compile(const CompileAttribs& Attribs)
     }
 }
 
-bool DXCompilerImpl::ValidateAndSign(DxcCreateInstanceProc CreateInstance, IDxcLibrary* library, CComPtr<IDxcBlob>& compiled, IDxcBlob** ppBlobOut) const noexcept(false)
+bool DXCompilerImpl::ValidateAndSign(DxcCreateInstanceProc CreateInstance, DxcInstances& Instances, CComPtr<IDxcBlob>& compiled, IDxcBlob** ppBlobOut) noexcept(false)
 {
-    CComPtr<IDxcValidator> pdxcValidator;
-    CHECK_D3D_RESULT(CreateInstance(CLSID_DxcValidator, IID_PPV_ARGS(&pdxcValidator)), "Failed to create DXC Validator");
+    if (!Instances.pValidator)
+        CHECK_D3D_RESULT(CreateInstance(CLSID_DxcValidator, IID_PPV_ARGS(&Instances.pValidator)), "Failed to create DXC Validator");
 
     CComPtr<IDxcOperationResult> pdxcResult;
-    CHECK_D3D_RESULT(pdxcValidator->Validate(compiled, DxcValidatorFlags_InPlaceEdit, &pdxcResult), "Failed to validate shader bytecode");
+    CHECK_D3D_RESULT(Instances.pValidator->Validate(compiled, DxcValidatorFlags_InPlaceEdit, &pdxcResult), "Failed to validate shader bytecode");
 
     HRESULT status = E_FAIL;
     pdxcResult->GetStatus(&status);
@@ -443,7 +612,7 @@ bool DXCompilerImpl::ValidateAndSign(DxcCreateInstanceProc CreateInstance, IDxcL
         CComPtr<IDxcBlobEncoding> pdxcOutput;
         CComPtr<IDxcBlobEncoding> pdxcOutputUtf8;
         pdxcResult->GetErrorBuffer(&pdxcOutput);
-        library->GetBlobAsUtf8(pdxcOutput, &pdxcOutputUtf8);
+        Instances.pLibrary->GetBlobAsUtf8(pdxcOutput, &pdxcOutputUtf8);
 
         const SIZE_T ValidationMsgLen = pdxcOutputUtf8 ? pdxcOutputUtf8->GetBufferSize() : 0;
         const char*  ValidationMsg    = ValidationMsgLen > 0 ? static_cast<const char*>(pdxcOutputUtf8->GetBufferPointer()) : "";
@@ -730,6 +899,17 @@ void DXCompilerImpl::Compile(const ShaderCreateInfo& ShaderCI,
                              IDxcBlob**              ppByteCodeBlob,
                              std::vector<uint32_t>*  pByteCode,
                              IDataBlob**             ppCompilerOutput) noexcept(false)
+{
+    CompileShader(ShaderCI, ShaderModel, Preamble, ppByteCodeBlob, pByteCode, ppCompilerOutput, nullptr);
+}
+
+void DXCompilerImpl::CompileShader(const ShaderCreateInfo& ShaderCI,
+                                   ShaderVersion           ShaderModel,
+                                   const char*             Preamble,
+                                   IDxcBlob**              ppByteCodeBlob,
+                                   std::vector<uint32_t>*  pByteCode,
+                                   IDataBlob**             ppCompilerOutput,
+                                   DxcIncludeCache*        pIncludeCache) noexcept(false)
 {
     if (!IsLoaded())
     {
@@ -839,7 +1019,7 @@ void DXCompilerImpl::Compile(const ShaderCreateInfo& ShaderCI,
     CA.ppBlobOut                  = &pDXIL;
     CA.ppCompilerOutput           = &pDxcLog;
 
-    bool result = Compile(CA);
+    bool result = CompileImpl(CA, pIncludeCache);
     HandleHLSLCompilerResult(result, pDxcLog.p, Source, ShaderCI.Desc.Name, ppCompilerOutput);
 
     if (result && pDXIL && pDXIL->GetBufferSize() > 0)
@@ -853,6 +1033,47 @@ void DXCompilerImpl::Compile(const ShaderCreateInfo& ShaderCI,
     }
 }
 
+Uint32 DXCompilerImpl::CompileBatch(BatchCompileItem* pItems,
+                                    size_t            NumItems,
+                                    IThreadPool*      pThreadPool)
+{
+    if (NumItems == 0)
+        return 0;
+
+    DEV_CHECK_ERR(pItems != nullptr, "pItems must not be null");
+
+    DxcIncludeCache     IncludeCache;
+    std::atomic<Uint32> NumSucceeded{0};
+    ParallelFor(pThreadPool, NumItems,
+                [&](size_t i) {
+                    BatchCompileItem& Item = pItems[i];
+                    Item.ByteCode.clear();
+                    Item.pCompilerOutput.Release();
+
+                    if (Item.pShaderCI != nullptr)
+                    {
+                        try
+                        {
+                            CompileShader(*Item.pShaderCI, Item.ShaderModel, Item.Preamble, nullptr, &Item.ByteCode, &Item.pCompilerOutput, &IncludeCache);
+                        }
+                        catch (...)
+                        {
+                            // The error has already been logged. Continue with the next item.
+                        }
+                    }
+                    else
+                    {
+                        UNEXPECTED("pShaderCI of batch item ", i, " is null");
+                    }
+
+                    Item.Succeeded = !Item.ByteCode.empty();
+                    if (Item.Succeeded)
+                        NumSucceeded.fetch_add(1);
+                });
+
+    return NumSucceeded.load();
+}
+
 bool DXCompilerImpl::RemapResourceBindings(const TResourceBindingMap& ResourceMap,
                                            IDxcBlob*                  pSrcBytecode,
                                            IDxcBlob**                 ppDstByteCode)
@@ -869,15 +1090,13 @@ bool DXCompilerImpl::RemapResourceBindings(const TResourceBindingMap& ResourceMa
             return false;
         }
 
-        CComPtr<IDxcLibrary> pdxcLibrary;
-        CHECK_D3D_RESULT(CreateInstance(CLSID_DxcLibrary, IID_PPV_ARGS(&pdxcLibrary)), "Failed to create DXC Library");
+        DxcInstances& Instances    = GetThreadInstances(CreateInstance);
+        IDxcLibrary*  pdxcLibrary  = Instances.pLibrary;
+        IDxcCompiler* pdxcCompiler = Instances.pCompiler;
 
         CComPtr<IDxcAssembler> pdxcAssembler;
         CHECK_D3D_RESULT(CreateInstance(CLSID_DxcAssembler, IID_PPV_ARGS(&pdxcAssembler)), "Failed to create DXC assembler");
 
-        CComPtr<IDxcCompiler> pdxcCompiler;
-        CHECK_D3D_RESULT(CreateInstance(CLSID_DxcCompiler, IID_PPV_ARGS(&pdxcCompiler)), "Failed to create DXC Compiler");
-
         CComPtr<IDxcBlobEncoding> pdxcDisasm;
         CHECK_D3D_RESULT(pdxcCompiler->Disassemble(pSrcBytecode, &pdxcDisasm), "Failed to disassemble bytecode");
 
@@ -1030,7 +1249,7 @@ bool DXCompilerImpl::RemapResourceBindings(const TResourceBindingMap& ResourceMa
         CComPtr<IDxcBlob> pCompiledBlob;
         CHECK_D3D_RESULT(pdxcResult->GetResult(static_cast<IDxcBlob**>(&pCompiledBlob)), "Failed to get compiled blob from DXC result");
 
-        return ValidateAndSign(CreateInstance, pdxcLibrary, pCompiledBlob, ppDstByteCode);
+        return ValidateAndSign(CreateInstance, Instances, pCompiledBlob, ppDstByteCode);
     }
     catch (...)
     {
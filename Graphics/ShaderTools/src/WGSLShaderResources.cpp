@@ -759,15 +759,16 @@ ShaderCodeBufferDescX LoadUBReflection(const tint::Program& Program, const tint:
 
 } // namespace
 
-WGSLShaderResources::WGSLShaderResources(IMemoryAllocator&      Allocator,
-                                         const std::string&     WGSL,
-                                         SHADER_SOURCE_LANGUAGE SourceLanguage,
-                                         const char*            ShaderName,
-                                         const char*            CombinedSamplerSuffix,
-                                         const char*            EntryPoint,
-                                         const char*            EmulatedArrayIndexSuffix,
-                                         bool                   LoadUniformBufferReflection,
-                                         IDataBlob**            ppTintOutput) noexcept(false)
+WGSLShaderResources::WGSLShaderResources(IMemoryAllocator&         Allocator,
+                                         const std::string&        WGSL,
+                                         SHADER_SOURCE_LANGUAGE    SourceLanguage,
+                                         const char*               ShaderName,
+                                         const char*               CombinedSamplerSuffix,
+                                         const char*               EntryPoint,
+                                         const char*               EmulatedArrayIndexSuffix,
+                                         bool                      LoadUniformBufferReflection,
+                                         IDataBlob**               ppTintOutput,
+                                         WGSLResourceBindingTable* pBindingTable) noexcept(false)
 {
     VERIFY_EXPR(ShaderName != nullptr);
 
@@ -791,6 +792,9 @@ WGSLShaderResources::WGSLShaderResources(IMemoryAllocator&      Allocator,
                             Diagnostics, "\n");
     }
 
+    if (pBindingTable != nullptr)
+        *pBindingTable = BuildWGSLResourceBindingTable(Program, WGSL);
+
     tint::inspector::Inspector Inspector{Program};
 
     const auto EntryPoints = Inspector.GetEntryPoints();
@@ -25,10 +25,17 @@
  */
 
 #include "WGSLUtils.hpp"
+
+#include <mutex>
+#include <unordered_set>
+#include <algorithm>
+
 #include "DebugUtilities.hpp"
 #include "ParsingTools.hpp"
 #include "ShaderToolsCommon.hpp"
 
+#include "xxhash.h"
+
 #ifdef _MSC_VER
 #    pragma warning(push)
 #    pragma warning(disable : 4324) //  warning C4324: structure was padded due to alignment specifier
@@ -40,6 +47,8 @@
 #include "src/tint/lang/wgsl/ast/module.h"
 #include "src/tint/lang/wgsl/ast/identifier_expression.h"
 #include "src/tint/lang/wgsl/ast/identifier.h"
+#include "src/tint/lang/wgsl/ast/group_attribute.h"
+#include "src/tint/lang/wgsl/ast/binding_attribute.h"
 #include "src/tint/lang/wgsl/sem/variable.h"
 #include "src/tint/lang/core/type/atomic.h"
 #include "src/tint/lang/core/type/array.h"
@@ -89,7 +98,83 @@ WGSLEmulatedResourceArrayElement GetWGSLEmulatedArrayElement(const std::string&
     return {Name, -1};
 }
 
-std::string ConvertSPIRVtoWGSL(const std::vector<uint32_t>& SPIRV)
+namespace
+{
+
+// Memoizes SPIR-V to WGSL conversion results.
+// The same SPIR-V module is often converted multiple times, e.g. when the same
+// shader is used by multiple pipelines or is loaded from different archives.
+// Entries are keyed by the 128-bit hash of the SPIR-V, so collisions are not a practical
+// concern and the SPIR-V itself is not kept for verification.
+class SPIRVToWGSLCache
+{
+public:
+    struct Key
+    {
+        uint64_t Low  = 0;
+        uint64_t High = 0;
+
+        explicit Key(const std::vector<uint32_t>& SPIRV)
+        {
+            const XXH128_hash_t Hash = XXH3_128bits(SPIRV.data(), SPIRV.size() * sizeof(SPIRV[0]));
+
+            Low  = Hash.low64;
+            High = Hash.high64;
+        }
+
+        bool operator==(const Key& RHS) const
+        {
+            return Low == RHS.Low && High == RHS.High;
+        }
+
+        struct Hasher
+        {
+            size_t operator()(const Key& K) const
+            {
+                return static_cast<size_t>(K.Low);
+            }
+        };
+    };
+
+    bool Find(const Key& Hash, std::string& WGSL)
+    {
+        std::lock_guard<std::mutex> Lock{m_Mtx};
+
+        auto it = m_Entries.find(Hash);
+        if (it == m_Entries.end())
+            return false;
+
+        WGSL = it->second;
+        return true;
+    }
+
+    void Add(const Key& Hash, const std::string& WGSL)
+    {
+        std::lock_guard<std::mutex> Lock{m_Mtx};
+
+        // Keep the memory usage bounded
+        if (m_Entries.size() >= MaxEntries)
+            m_Entries.clear();
+
+        m_Entries.emplace(Hash, WGSL);
+    }
+
+private:
+    static constexpr size_t MaxEntries = 256;
+
+    std::mutex                                        m_Mtx;
+    std::unordered_map<Key, std::string, Key::Hasher> m_Entries;
+};
+
+SPIRVToWGSLCache& GetSPIRVToWGSLCache()
+{
+    static SPIRVToWGSLCache Cache;
+    return Cache;
+}
+
+} // namespace
+
+static std::string ConvertSPIRVtoWGSLImpl(const std::vector<uint32_t>& SPIRV)
 {
     tint::spirv::reader::Options SPIRVReaderOptions{true, {tint::wgsl::AllowedFeatures::Everything()}};
     tint::Program                Program = Read(SPIRV, SPIRVReaderOptions);
@@ -110,6 +195,21 @@ std::string ConvertSPIRVtoWGSL(const std::vector<uint32_t>& SPIRV)
     return GenerationResult->wgsl;
 }
 
+std::string ConvertSPIRVtoWGSL(const std::vector<uint32_t>& SPIRV)
+{
+    const SPIRVToWGSLCache::Key Hash{SPIRV};
+
+    std::string WGSL;
+    if (GetSPIRVToWGSLCache().Find(Hash, WGSL))
+        return WGSL;
+
+    WGSL = ConvertSPIRVtoWGSLImpl(SPIRV);
+    if (!WGSL.empty())
+        GetSPIRVToWGSLCache().Add(Hash, WGSL);
+
+    return WGSL;
+}
+
 static bool IsAtomic(const tint::core::type::Type* WGSLType)
 {
     if (WGSLType == nullptr)
@@ -267,9 +367,37 @@ static WGSLResourceMapping::const_iterator FindResourceAsArrayElement(const WGSL
     return ResMapping.end();
 }
 
-std::string RemapWGSLResourceBindings(const std::string&         WGSL,
-                                      const WGSLResourceMapping& ResMapping,
-                                      const char*                EmulatedArrayIndexSuffix)
+// Finds the resource in the mapping by its name or alternative name, also considering
+// that the resource may be an element of an emulated array.
+static WGSLResourceMapping::const_iterator FindResourceBinding(const WGSLResourceMapping& ResMapping,
+                                                               const char*                EmulatedArrayIndexSuffix,
+                                                               const std::string&         Name,
+                                                               const std::string&         AltName,
+                                                               Uint32&                    ArrayIndex)
+{
+    ArrayIndex = 0;
+
+    auto DstBindigIt = ResMapping.find(Name);
+    if (EmulatedArrayIndexSuffix != nullptr && DstBindigIt == ResMapping.end())
+    {
+        DstBindigIt = FindResourceAsArrayElement(ResMapping, EmulatedArrayIndexSuffix, Name, ArrayIndex);
+    }
+
+    if (DstBindigIt == ResMapping.end() && !AltName.empty())
+    {
+        DstBindigIt = ResMapping.find(AltName);
+        if (EmulatedArrayIndexSuffix != nullptr && DstBindigIt == ResMapping.end())
+        {
+            DstBindigIt = FindResourceAsArrayElement(ResMapping, EmulatedArrayIndexSuffix, AltName, ArrayIndex);
+        }
+    }
+
+    return DstBindigIt;
+}
+
+static std::string RemapWGSLResourceBindingsWithTint(const std::string&         WGSL,
+                                                     const WGSLResourceMapping& ResMapping,
+                                                     const char*                EmulatedArrayIndexSuffix)
 {
     tint::Source::File srcFile("", WGSL);
     tint::Program      Program = tint::wgsl::reader::Parse(&srcFile, {tint::wgsl::AllowedFeatures::Everything()});
@@ -287,27 +415,8 @@ std::string RemapWGSLResourceBindings(const std::string&         WGSL,
     {
         for (tint::inspector::ResourceBinding& Binding : Inspector.GetResourceBindings(EntryPoint.name))
         {
-            Uint32 ArrayIndex = 0;
-
-            auto DstBindigIt = ResMapping.find(Binding.variable_name);
-            if (EmulatedArrayIndexSuffix != nullptr && DstBindigIt == ResMapping.end())
-            {
-                DstBindigIt = FindResourceAsArrayElement(ResMapping, EmulatedArrayIndexSuffix, Binding.variable_name, ArrayIndex);
-            }
-
-            if (DstBindigIt == ResMapping.end())
-            {
-                const std::string AltName = GetWGSLResourceAlternativeName(Program, Binding);
-                if (!AltName.empty())
-                {
-                    DstBindigIt = ResMapping.find(AltName);
-                    if (EmulatedArrayIndexSuffix != nullptr && DstBindigIt == ResMapping.end())
-                    {
-                        DstBindigIt = FindResourceAsArrayElement(ResMapping, EmulatedArrayIndexSuffix, AltName, ArrayIndex);
-                    }
-                }
-            }
-
+            Uint32     ArrayIndex  = 0;
+            const auto DstBindigIt = FindResourceBinding(ResMapping, EmulatedArrayIndexSuffix, Binding.variable_name, GetWGSLResourceAlternativeName(Program, Binding), ArrayIndex);
             if (DstBindigIt != ResMapping.end())
             {
                 const WGSLResourceBindingInfo& DstBindig = DstBindigIt->second;
@@ -346,4 +455,166 @@ std::string RemapWGSLResourceBindings(const std::string&         WGSL,
     return PatchedWGSL;
 }
 
+// Converts tint source range to the offsets in the source string.
+// Returns false if the range is invalid.
+static bool GetSourceRangeOffsets(const std::vector<size_t>& LineOffsets,
+                                  const std::string&         WGSL,
+                                  const tint::Source::Range& Range,
+                                  size_t&                    Start,
+                                  size_t&                    End)
+{
+    // Lines and columns are 1-based
+    if (Range.begin.line == 0 || Range.begin.line > LineOffsets.size() ||
+        Range.end.line == 0 || Range.end.line > LineOffsets.size() ||
+        Range.begin.column == 0 || Range.end.column == 0)
+        return false;
+
+    Start = LineOffsets[Range.begin.line - 1] + Range.begin.column - 1;
+    End   = LineOffsets[Range.end.line - 1] + Range.end.column - 1;
+    if (Start >= End || End > WGSL.length())
+        return false;
+
+    // Make sure that the range is the attribute argument, e.g. @group(0)
+    //                                                                 ^
+    size_t Pos = Start;
+    while (Pos > 0 && IsWhitespace(WGSL[Pos - 1]))
+        --Pos;
+    if (Pos == 0 || WGSL[Pos - 1] != '(')
+        return false;
+
+    Pos = End;
+    while (Pos < WGSL.length() && IsWhitespace(WGSL[Pos]))
+        ++Pos;
+    if (Pos == WGSL.length() || (WGSL[Pos] != ')' && WGSL[Pos] != ','))
+        return false;
+
+    return true;
+}
+
+WGSLResourceBindingTable BuildWGSLResourceBindingTable(const std::string& WGSL)
+{
+    tint::Source::File srcFile("", WGSL);
+    tint::Program      Program = tint::wgsl::reader::Parse(&srcFile, {tint::wgsl::AllowedFeatures::Everything()});
+    if (!Program.IsValid())
+    {
+        LOG_ERROR_MESSAGE("Tint WGSL reader failure:\nParser: ", Program.Diagnostics().Str(), "\n");
+        return {};
+    }
+
+    return BuildWGSLResourceBindingTable(Program, WGSL);
+}
+
+WGSLResourceBindingTable BuildWGSLResourceBindingTable(const tint::Program& Program, const std::string& WGSL)
+{
+    WGSLResourceBindingTable Table;
+    if (!Program.IsValid())
+        return Table;
+
+    std::vector<size_t> LineOffsets{0};
+    for (size_t i = 0; i < WGSL.length(); ++i)
+    {
+        if (WGSL[i] == '\n')
+            LineOffsets.push_back(i + 1);
+    }
+
+    std::unordered_map<std::string, const tint::ast::Variable*> GlobalVariables;
+    for (const tint::ast::Variable* Var : Program.AST().GlobalVariables())
+        GlobalVariables.emplace(Var->name->symbol.Name(), Var);
+
+    std::unordered_set<std::string> ProcessedVariables;
+
+    tint::inspector::Inspector Inspector{Program};
+    for (tint::inspector::EntryPoint& EntryPoint : Inspector.GetEntryPoints())
+    {
+        for (tint::inspector::ResourceBinding& Binding : Inspector.GetResourceBindings(EntryPoint.name))
+        {
+            // The same variable may be used by multiple entry points
+            if (!ProcessedVariables.insert(Binding.variable_name).second)
+                continue;
+
+            auto VarIt = GlobalVariables.find(Binding.variable_name);
+            if (VarIt == GlobalVariables.end())
+                return Table;
+
+            const tint::ast::Variable*         Var       = VarIt->second;
+            const tint::ast::GroupAttribute*   GroupAttr = tint::ast::GetAttribute<tint::ast::GroupAttribute>(Var->attributes);
+            const tint::ast::BindingAttribute* BindAttr  = tint::ast::GetAttribute<tint::ast::BindingAttribute>(Var->attributes);
+            if (GroupAttr == nullptr || BindAttr == nullptr)
+                return Table;
+
+            WGSLResourceBindingTable::BindingSite Site;
+            if (!GetSourceRangeOffsets(LineOffsets, WGSL, GroupAttr->expr->source.range, Site.GroupStart, Site.GroupEnd) ||
+                !GetSourceRangeOffsets(LineOffsets, WGSL, BindAttr->expr->source.range, Site.BindingStart, Site.BindingEnd))
+                return Table;
+
+            Site.Name    = Binding.variable_name;
+            Site.AltName = GetWGSLResourceAlternativeName(Program, Binding);
+            Table.Sites.emplace_back(std::move(Site));
+        }
+    }
+
+    Table.IsValid = true;
+    return Table;
+}
+
+std::string RemapWGSLResourceBindings(const std::string&              WGSL,
+                                      const WGSLResourceBindingTable& BindingTable,
+                                      const WGSLResourceMapping&      ResMapping,
+                                      const char*                     EmulatedArrayIndexSuffix)
+{
+    if (!BindingTable.IsValid)
+        return RemapWGSLResourceBindingsWithTint(WGSL, ResMapping, EmulatedArrayIndexSuffix);
+
+    struct Replacement
+    {
+        size_t   Start;
+        size_t   End;
+        uint32_t Value;
+
+        bool operator<(const Replacement& RHS) const { return Start < RHS.Start; }
+    };
+    std::vector<Replacement> Replacements;
+    Replacements.reserve(BindingTable.Sites.size() * 2);
+
+    for (const WGSLResourceBindingTable::BindingSite& Site : BindingTable.Sites)
+    {
+        Uint32     ArrayIndex  = 0;
+        const auto DstBindigIt = FindResourceBinding(ResMapping, EmulatedArrayIndexSuffix, Site.Name, Site.AltName, ArrayIndex);
+        if (DstBindigIt != ResMapping.end())
+        {
+            const WGSLResourceBindingInfo& DstBindig = DstBindigIt->second;
+            Replacements.push_back({Site.GroupStart, Site.GroupEnd, DstBindig.Group});
+            Replacements.push_back({Site.BindingStart, Site.BindingEnd, DstBindig.Index + ArrayIndex});
+        }
+        else
+        {
+            LOG_ERROR_MESSAGE("Binding for variable '", Site.Name, "' is not found in the remap indices");
+        }
+    }
+    // Attributes may appear in any order, e.g. @binding(1) @group(0)
+    std::sort(Replacements.begin(), Replacements.end());
+
+    std::string PatchedWGSL;
+    PatchedWGSL.reserve(WGSL.length() + Replacements.size() * 4);
+
+    size_t Pos = 0;
+    for (const Replacement& Repl : Replacements)
+    {
+        VERIFY_EXPR(Repl.Start >= Pos && Repl.End <= WGSL.length());
+        PatchedWGSL.append(WGSL, Pos, Repl.Start - Pos);
+        PatchedWGSL.append(std::to_string(Repl.Value));
+        Pos = Repl.End;
+    }
+    PatchedWGSL.append(WGSL, Pos, std::string::npos);
+
+    return PatchedWGSL;
+}
+
+std::string RemapWGSLResourceBindings(const std::string&         WGSL,
+                                      const WGSLResourceMapping& ResMapping,
+                                      const char*                EmulatedArrayIndexSuffix)
+{
+    return RemapWGSLResourceBindings(WGSL, BuildWGSLResourceBindingTable(WGSL), ResMapping, EmulatedArrayIndexSuffix);
+}
+
 } // namespace Diligent
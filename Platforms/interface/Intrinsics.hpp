@@ -44,3 +44,14 @@
 #if DILIGENT_AVX2_SUPPORTED && defined(__AVX2__)
 #    define DILIGENT_AVX2_ENABLED 1
 #endif
+
+// Function attributes that enable an instruction set for a single function only,
+// so that the function can be selected at run time on CPUs that support the instruction set.
+// MSVC allows using any intrinsics without the attributes.
+#if DILIGENT_AVX2_SUPPORTED && (defined(__clang__) || defined(__GNUC__))
+#    define DILIGENT_TARGET_SSE41 __attribute__((target("sse4.1")))
+#    define DILIGENT_TARGET_AVX2  __attribute__((target("avx2")))
+#else
+#    define DILIGENT_TARGET_SSE41
+#    define DILIGENT_TARGET_AVX2
+#endif
@@ -0,0 +1,149 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+// Measures the throughput of HLSL to SPIR-V compilation with DXC when the shaders
+// are compiled in parallel by IDXCompiler::CompileBatch().
+// The corpus is the set of HLSL shaders used by the SPIR-V unit tests. By default, the
+// benchmark expects to be run from the Tests/DiligentCoreTest/assets directory.
+//
+// Usage: DXCompilerBenchmark [ShaderDirectory [NumRounds]]
+
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <vector>
+
+#include "EngineFactoryNull.h"
+#include "DXCompiler.hpp"
+#include "ThreadPool.hpp"
+#include "RefCntAutoPtr.hpp"
+#include "Timer.hpp"
+
+using namespace Diligent;
+
+namespace
+{
+
+constexpr const char* ShaderFiles[] = {
+    "InputAttachments.psh",
+    "MixedResources.psh",
+    "PushConstants.psh",
+    "SpecializationConstants.psh",
+    "StorageBuffers.psh",
+    "StorageImages.psh",
+    "TexelBuffers.psh",
+    "Textures.psh",
+    "UniformBuffers.psh",
+    "IncludeNestedParentRelative/Main.psh",
+};
+
+constexpr Uint32 ThreadCounts[] = {1, 2, 4, 8, 16};
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    const char* ShaderDirectory = argc > 1 ? argv[1] : "shaders/SPIRV";
+
+    Uint32 NumRounds = 8;
+    if (argc > 2)
+    {
+        NumRounds = static_cast<Uint32>(std::strtoul(argv[2], nullptr, 10));
+        if (NumRounds == 0)
+        {
+            std::printf("Usage: %s [ShaderDirectory [NumRounds]]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    std::unique_ptr<IDXCompiler> pCompiler = CreateDXCompiler(DXCompilerTarget::Vulkan, 0, nullptr);
+    if (!pCompiler || !pCompiler->IsLoaded())
+    {
+        std::printf("DXC is not available, skipping the benchmark\n");
+        return 0;
+    }
+
+    RefCntAutoPtr<IShaderSourceInputStreamFactory> pShaderSourceFactory;
+    LoadAndGetEngineFactoryNull()->CreateDefaultShaderSourceStreamFactory(ShaderDirectory, &pShaderSourceFactory);
+    if (!pShaderSourceFactory)
+    {
+        std::printf("Failed to create shader source stream factory\n");
+        return 1;
+    }
+
+    std::vector<ShaderCreateInfo> ShaderCIs(_countof(ShaderFiles));
+    for (size_t i = 0; i < ShaderCIs.size(); ++i)
+    {
+        ShaderCreateInfo& ShaderCI          = ShaderCIs[i];
+        ShaderCI.SourceLanguage             = SHADER_SOURCE_LANGUAGE_HLSL;
+        ShaderCI.FilePath                   = ShaderFiles[i];
+        ShaderCI.Desc                       = {ShaderFiles[i], SHADER_TYPE_PIXEL};
+        ShaderCI.EntryPoint                 = "main";
+        ShaderCI.pShaderSourceStreamFactory = pShaderSourceFactory;
+    }
+
+    // Every round compiles the whole corpus
+    std::vector<IDXCompiler::BatchCompileItem> Items(ShaderCIs.size() * NumRounds);
+    for (size_t i = 0; i < Items.size(); ++i)
+    {
+        Items[i].pShaderCI   = &ShaderCIs[i % ShaderCIs.size()];
+        Items[i].ShaderModel = ShaderVersion{6, 0};
+    }
+
+    std::printf("DXC HLSL to SPIR-V throughput, %u shaders per run\n\n", static_cast<Uint32>(Items.size()));
+    std::printf("%-8s %16s %12s %10s\n", "Threads", "Shaders/sec", "ms/shader", "Speedup");
+
+    double SingleThreadRate = 0;
+    for (Uint32 NumThreads : ThreadCounts)
+    {
+        // The calling thread compiles shaders too
+        RefCntAutoPtr<IThreadPool> pThreadPool;
+        if (NumThreads > 1)
+            pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{NumThreads - 1});
+
+        // Warm up: fill the pool of DXC instances
+        pCompiler->CompileBatch(Items.data(), Items.size(), pThreadPool);
+
+        Timer        T;
+        const Uint32 NumSucceeded = pCompiler->CompileBatch(Items.data(), Items.size(), pThreadPool);
+        const double ElapsedTime  = T.GetElapsedTime();
+        if (NumSucceeded != Items.size())
+        {
+            std::printf("Failed to compile %u out of %u shaders\n", static_cast<Uint32>(Items.size()) - NumSucceeded, static_cast<Uint32>(Items.size()));
+            return 1;
+        }
+
+        const double ShadersPerSec = ElapsedTime > 0 ? static_cast<double>(Items.size()) / ElapsedTime : 0;
+        if (NumThreads == 1)
+            SingleThreadRate = ShadersPerSec;
+
+        std::printf("%-8u %16.1f %12.2f %9.2fx\n", NumThreads, ShadersPerSec,
+                    ShadersPerSec > 0 ? 1000.0 / ShadersPerSec : 0.0,
+                    SingleThreadRate > 0 ? ShadersPerSec / SingleThreadRate : 0.0);
+    }
+
+    return 0;
+}
@@ -1426,7 +1426,7 @@ void CreateComputeShader(IRenderDevice*        pDevice,
     }
 }
 
-void TestComputePipeline(PSO_ARCHIVE_FLAGS ArchiveFlags, bool CompileAsync = false)
+void TestComputePipeline(PSO_ARCHIVE_FLAGS ArchiveFlags, bool CompileAsync = false, bool UnpackBatch = false)
 {
     GPUTestingEnvironment* pEnv             = GPUTestingEnvironment::GetInstance();
     IRenderDevice*         pDevice          = pEnv->GetDevice();
@@ -1615,8 +1615,33 @@ void TestComputePipeline(PSO_ARCHIVE_FLAGS ArchiveFlags, bool CompileAsync = fal
         UnpackInfo.pDevice      = pDevice;
         UnpackInfo.PipelineType = PIPELINE_TYPE_COMPUTE;
 
-        pDearchiver->UnpackPipelineState(UnpackInfo, &pUnpackedPSO);
-        ASSERT_NE(pUnpackedPSO, nullptr);
+        if (UnpackBatch)
+        {
+            // Request the same pipeline several times: it must be unpacked once and
+            // the same object must be returned for every request.
+            const PipelineStateUnpackInfo UnpackInfos[] = {UnpackInfo, UnpackInfo, UnpackInfo};
+            IPipelineState*               ppPSOs[_countof(UnpackInfos)]{};
+            pDearchiver->UnpackPipelineStates(UnpackInfos, _countof(UnpackInfos), pDevice->GetShaderCompilationThreadPool(), ppPSOs);
+
+            RefCntAutoPtr<IPipelineState> pUnpackedPSO2;
+            RefCntAutoPtr<IPipelineState> pUnpackedPSO3;
+            pUnpackedPSO.Attach(ppPSOs[0]);
+            pUnpackedPSO2.Attach(ppPSOs[1]);
+            pUnpackedPSO3.Attach(ppPSOs[2]);
+            ASSERT_NE(pUnpackedPSO, nullptr);
+            EXPECT_EQ(pUnpackedPSO, pUnpackedPSO2);
+            EXPECT_EQ(pUnpackedPSO, pUnpackedPSO3);
+
+            // The pipeline must be found in the cache
+            RefCntAutoPtr<IPipelineState> pCachedPSO;
+            pDearchiver->UnpackPipelineState(UnpackInfo, &pCachedPSO);
+            EXPECT_EQ(pUnpackedPSO, pCachedPSO);
+        }
+        else
+        {
+            pDearchiver->UnpackPipelineState(UnpackInfo, &pUnpackedPSO);
+            ASSERT_NE(pUnpackedPSO, nullptr);
+        }
     }
 
     RefCntAutoPtr<IShaderResourceBinding> pSRB;
@@ -1645,7 +1670,8 @@ void TestComputePipeline(PSO_ARCHIVE_FLAGS ArchiveFlags, bool CompileAsync = fal
     Dispatch(pRefPSO, pTestingSwapChain->GetCurrentBackBufferUAV());
     pSwapChain->Present();
 
-    ASSERT_EQ(pUnpackedPSO->GetStatus(CompileAsync), PIPELINE_STATE_STATUS_READY);
+    // Pipelines unpacked in a batch are created asynchronously if the device supports it
+    ASSERT_EQ(pUnpackedPSO->GetStatus(CompileAsync || UnpackBatch), PIPELINE_STATE_STATUS_READY);
 
     // Dispatch using unpacked PSO
     Dispatch(pUnpackedPSO, pTestingSwapChain->GetCurrentBackBufferUAV());
@@ -1682,6 +1708,16 @@ TEST(ArchiveTest, ComputePipeline_SplitArchive_Async)
     TestComputePipeline(PSO_ARCHIVE_FLAG_DO_NOT_PACK_SIGNATURES, /*CompileAsync = */ true);
 }
 
+TEST(ArchiveTest, ComputePipeline_Batch)
+{
+    TestComputePipeline(PSO_ARCHIVE_FLAG_NONE, /*CompileAsync = */ false, /*UnpackBatch = */ true);
+}
+
+TEST(ArchiveTest, ComputePipeline_SplitArchive_Batch)
+{
+    TestComputePipeline(PSO_ARCHIVE_FLAG_DO_NOT_PACK_SIGNATURES, /*CompileAsync = */ false, /*UnpackBatch = */ true);
+}
+
 void TestRayTracingPipeline(bool CompileAsync = false, bool UseCurrentDeviceArchiveFlags = false)
 {
     GPUTestingEnvironment* pEnv             = GPUTestingEnvironment::GetInstance();
@@ -0,0 +1,212 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <array>
+#include <cstring>
+
+#include "GPUTestingEnvironment.hpp"
+#include "MapHelper.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+constexpr char VSSource[] = R"(
+void main(uint VertexId : SV_VertexId, out float4 Pos : SV_Position)
+{
+    float2 PosXY[3] =
+    {
+        float2(-1.0, -1.0),
+        float2(-1.0, +3.0),
+        float2(+3.0, -1.0)
+    };
+    Pos = float4(PosXY[VertexId], 0.0, 1.0);
+}
+)";
+
+constexpr char PSSource[] = R"(
+cbuffer Constants
+{
+    float4 g_Color;
+};
+
+float4 main(in float4 Pos : SV_Position) : SV_Target
+{
+    return g_Color;
+}
+)";
+
+// Maps a dynamic uniform buffer several times per frame over several frames and checks
+// that every draw reads the data written by the last Map(). When the device uses the
+// dynamic heap (see EngineGLCreateInfo::DynamicHeapSize), every Map() allocates new space
+// in the heap, and the space of the previous frames is recycled.
+TEST(DynamicHeapGLTest, MapAcrossFrames)
+{
+    GPUTestingEnvironment* pEnv     = GPUTestingEnvironment::GetInstance();
+    IRenderDevice*         pDevice  = pEnv->GetDevice();
+    IDeviceContext*        pContext = pEnv->GetDeviceContext();
+
+    if (!pDevice->GetDeviceInfo().IsGLDevice())
+        GTEST_SKIP() << "This test requires an OpenGL device";
+
+    GPUTestingEnvironment::ScopedReset AutoReset;
+
+    constexpr Uint32 RTSize = 4;
+
+    TextureDesc TexDesc;
+    TexDesc.Name      = "Dynamic heap test render target";
+    TexDesc.Type      = RESOURCE_DIM_TEX_2D;
+    TexDesc.Width     = RTSize;
+    TexDesc.Height    = RTSize;
+    TexDesc.Format    = TEX_FORMAT_RGBA8_UNORM;
+    TexDesc.BindFlags = BIND_RENDER_TARGET;
+
+    RefCntAutoPtr<ITexture> pRenderTarget;
+    pDevice->CreateTexture(TexDesc, nullptr, &pRenderTarget);
+    ASSERT_NE(pRenderTarget, nullptr);
+
+    TexDesc.Name           = "Dynamic heap test staging texture";
+    TexDesc.Usage          = USAGE_STAGING;
+    TexDesc.BindFlags      = BIND_NONE;
+    TexDesc.CPUAccessFlags = CPU_ACCESS_READ;
+
+    RefCntAutoPtr<ITexture> pStagingTexture;
+    pDevice->CreateTexture(TexDesc, nullptr, &pStagingTexture);
+    ASSERT_NE(pStagingTexture, nullptr);
+
+    BufferDesc BuffDesc;
+    BuffDesc.Name           = "Dynamic heap test constants";
+    BuffDesc.Size           = sizeof(float4);
+    BuffDesc.Usage          = USAGE_DYNAMIC;
+    BuffDesc.BindFlags      = BIND_UNIFORM_BUFFER;
+    BuffDesc.CPUAccessFlags = CPU_ACCESS_WRITE;
+
+    RefCntAutoPtr<IBuffer> pConstants;
+    pDevice->CreateBuffer(BuffDesc, nullptr, &pConstants);
+    ASSERT_NE(pConstants, nullptr);
+
+    ShaderCreateInfo ShaderCI;
+    ShaderCI.SourceLanguage = SHADER_SOURCE_LANGUAGE_HLSL;
+    ShaderCI.EntryPoint     = "main";
+
+    RefCntAutoPtr<IShader> pVS;
+    {
+        ShaderCI.Desc   = {"Dynamic heap test VS", SHADER_TYPE_VERTEX, true};
+        ShaderCI.Source = VSSource;
+        pDevice->CreateShader(ShaderCI, &pVS);
+        ASSERT_NE(pVS, nullptr);
+    }
+
+    RefCntAutoPtr<IShader> pPS;
+    {
+        ShaderCI.Desc   = {"Dynamic heap test PS", SHADER_TYPE_PIXEL, true};
+        ShaderCI.Source = PSSource;
+        pDevice->CreateShader(ShaderCI, &pPS);
+        ASSERT_NE(pPS, nullptr);
+    }
+
+    GraphicsPipelineStateCreateInfo PSOCreateInfo;
+    PSOCreateInfo.PSODesc.Name = "Dynamic heap test";
+
+    GraphicsPipelineDesc& GraphicsPipeline        = PSOCreateInfo.GraphicsPipeline;
+    GraphicsPipeline.NumRenderTargets             = 1;
+    GraphicsPipeline.RTVFormats[0]                = TexDesc.Format;
+    GraphicsPipeline.PrimitiveTopology            = PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+    GraphicsPipeline.RasterizerDesc.CullMode      = CULL_MODE_NONE;
+    GraphicsPipeline.DepthStencilDesc.DepthEnable = False;
+
+    PSOCreateInfo.pVS = pVS;
+    PSOCreateInfo.pPS = pPS;
+
+    RefCntAutoPtr<IPipelineState> pPSO;
+    pDevice->CreateGraphicsPipelineState(PSOCreateInfo, &pPSO);
+    ASSERT_NE(pPSO, nullptr);
+
+    pPSO->GetStaticVariableByName(SHADER_TYPE_PIXEL, "Constants")->Set(pConstants);
+
+    RefCntAutoPtr<IShaderResourceBinding> pSRB;
+    pPSO->CreateShaderResourceBinding(&pSRB, true);
+    ASSERT_NE(pSRB, nullptr);
+
+    auto DrawAndVerify = [&](const float4& Color, Uint32 Frame) {
+        {
+            MapHelper<float4> MappedConstants{pContext, pConstants, MAP_WRITE, MAP_FLAG_DISCARD};
+            ASSERT_NE(MappedConstants, nullptr);
+            *MappedConstants = Color;
+        }
+
+        ITextureView* pRTV = pRenderTarget->GetDefaultView(TEXTURE_VIEW_RENDER_TARGET);
+        pContext->SetRenderTargets(1, &pRTV, nullptr, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+
+        pContext->SetPipelineState(pPSO);
+        pContext->CommitShaderResources(pSRB, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+        pContext->Draw(DrawAttribs{3, DRAW_FLAG_VERIFY_ALL});
+
+        CopyTextureAttribs CopyAttribs{pRenderTarget, RESOURCE_STATE_TRANSITION_MODE_TRANSITION, pStagingTexture, RESOURCE_STATE_TRANSITION_MODE_TRANSITION};
+        pContext->CopyTexture(CopyAttribs);
+        pContext->WaitForIdle();
+
+        const std::array<Uint8, 4> RefColor{
+            static_cast<Uint8>(Color.r * 255.f),
+            static_cast<Uint8>(Color.g * 255.f),
+            static_cast<Uint8>(Color.b * 255.f),
+            static_cast<Uint8>(Color.a * 255.f),
+        };
+
+        MappedTextureSubresource MappedData;
+        pContext->MapTextureSubresource(pStagingTexture, 0, 0, MAP_READ, MAP_FLAG_DO_NOT_WAIT, nullptr, MappedData);
+        ASSERT_NE(MappedData.pData, nullptr);
+        for (Uint32 y = 0; y < RTSize; ++y)
+        {
+            for (Uint32 x = 0; x < RTSize; ++x)
+            {
+                const Uint8* pTexel = static_cast<const Uint8*>(MappedData.pData) + y * MappedData.Stride + x * 4;
+                EXPECT_EQ(memcmp(pTexel, RefColor.data(), RefColor.size()), 0)
+                    << "Frame: " << Frame << ", x: " << x << ", y: " << y;
+            }
+        }
+        pContext->UnmapTextureSubresource(pStagingTexture, 0, 0);
+    };
+
+    constexpr Uint32 NumFrames = 8;
+    for (Uint32 Frame = 0; Frame < NumFrames; ++Frame)
+    {
+        // Every Map() discards the previous contents, so the second draw in the frame
+        // must read the new allocation rather than the one used by the first draw.
+        const float4 Color0{(Frame & 0x01) ? 1.f : 0.f, (Frame & 0x02) ? 1.f : 0.f, (Frame & 0x04) ? 1.f : 0.f, 1.f};
+        const float4 Color1{1.f - Color0.r, 1.f - Color0.g, 1.f - Color0.b, 1.f};
+        DrawAndVerify(Color0, Frame);
+        DrawAndVerify(Color1, Frame);
+
+        pContext->FinishFrame();
+    }
+}
+
+} // namespace
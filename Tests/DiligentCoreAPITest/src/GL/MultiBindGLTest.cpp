@@ -0,0 +1,224 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "GPUTestingEnvironment.hpp"
+#include "DeviceContextGL.h"
+
+#include <string>
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+static const char g_VSShaderSource[] = R"(
+void VSMain(in uint VertId : SV_VertexID, out float4 Pos : SV_POSITION)
+{
+    float2 Coords[3];
+    Coords[0] = float2(-1.0, -1.0);
+    Coords[1] = float2(-1.0, +3.0);
+    Coords[2] = float2(+3.0, -1.0);
+    Pos = float4(Coords[VertId], 0.0, 1.0);
+}
+)";
+
+static const char g_PSShaderSource[] = R"(
+Texture2D    g_Tex0;
+SamplerState g_Tex0_sampler;
+Texture2D    g_Tex1;
+SamplerState g_Tex1_sampler;
+Texture2D    g_Tex2;
+SamplerState g_Tex2_sampler;
+Texture2D    g_Tex3;
+SamplerState g_Tex3_sampler;
+
+cbuffer CB0
+{
+    float4 g_Color0;
+}
+
+cbuffer CB1
+{
+    float4 g_Color1;
+}
+
+float4 PSMain(in float4 Pos : SV_POSITION) : SV_Target
+{
+    float2 UV = float2(0.5, 0.5);
+    return g_Tex0.Sample(g_Tex0_sampler, UV) +
+           g_Tex1.Sample(g_Tex1_sampler, UV) +
+           g_Tex2.Sample(g_Tex2_sampler, UV) +
+           g_Tex3.Sample(g_Tex3_sampler, UV) +
+           g_Color0 + g_Color1;
+}
+)";
+
+TEST(MultiBindGLTest, BindingStats)
+{
+    GPUTestingEnvironment* pEnv     = GPUTestingEnvironment::GetInstance();
+    IRenderDevice*         pDevice  = pEnv->GetDevice();
+    IDeviceContext*        pContext = pEnv->GetDeviceContext();
+
+    if (!pDevice->GetDeviceInfo().IsGLDevice())
+    {
+        GTEST_SKIP() << "This test is only relevant for OpenGL";
+    }
+
+    RefCntAutoPtr<IDeviceContextGL> pContextGL{pContext, IID_DeviceContextGL};
+    ASSERT_NE(pContextGL, nullptr);
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    ShaderCreateInfo ShaderCI;
+    ShaderCI.SourceLanguage                  = SHADER_SOURCE_LANGUAGE_HLSL;
+    ShaderCI.ShaderCompiler                  = pEnv->GetDefaultCompiler(ShaderCI.SourceLanguage);
+    ShaderCI.Desc.UseCombinedTextureSamplers = true;
+
+    RefCntAutoPtr<IShader> pVS;
+    {
+        ShaderCI.Source          = g_VSShaderSource;
+        ShaderCI.EntryPoint      = "VSMain";
+        ShaderCI.Desc.ShaderType = SHADER_TYPE_VERTEX;
+        ShaderCI.Desc.Name       = "MultiBindGLTest - VS";
+        pDevice->CreateShader(ShaderCI, &pVS);
+        ASSERT_NE(pVS, nullptr);
+    }
+
+    RefCntAutoPtr<IShader> pPS;
+    {
+        ShaderCI.Source          = g_PSShaderSource;
+        ShaderCI.EntryPoint      = "PSMain";
+        ShaderCI.Desc.ShaderType = SHADER_TYPE_PIXEL;
+        ShaderCI.Desc.Name       = "MultiBindGLTest - PS";
+        pDevice->CreateShader(ShaderCI, &pPS);
+        ASSERT_NE(pPS, nullptr);
+    }
+
+    GraphicsPipelineStateCreateInfo PSOCreateInfo;
+    PipelineStateDesc&              PSODesc          = PSOCreateInfo.PSODesc;
+    GraphicsPipelineDesc&           GraphicsPipeline = PSOCreateInfo.GraphicsPipeline;
+
+    PSODesc.Name                                  = "MultiBindGLTest";
+    PSOCreateInfo.pVS                             = pVS;
+    PSOCreateInfo.pPS                             = pPS;
+    GraphicsPipeline.PrimitiveTopology            = PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+    GraphicsPipeline.NumRenderTargets             = 1;
+    GraphicsPipeline.RTVFormats[0]                = TEX_FORMAT_RGBA8_UNORM;
+    GraphicsPipeline.DSVFormat                    = TEX_FORMAT_UNKNOWN;
+    GraphicsPipeline.DepthStencilDesc.DepthEnable = false;
+
+    PSODesc.ResourceLayout.DefaultVariableType = SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE;
+
+    RefCntAutoPtr<IPipelineState> pPSO;
+    pDevice->CreateGraphicsPipelineState(PSOCreateInfo, &pPSO);
+    ASSERT_NE(pPSO, nullptr);
+
+    RefCntAutoPtr<IShaderResourceBinding> pSRB;
+    pPSO->CreateShaderResourceBinding(&pSRB, true);
+    ASSERT_NE(pSRB, nullptr);
+
+    constexpr Uint32 NumTextures = 4;
+
+    TextureDesc TexDesc;
+    TexDesc.Name      = "MultiBindGLTest texture";
+    TexDesc.Type      = RESOURCE_DIM_TEX_2D;
+    TexDesc.Width     = 16;
+    TexDesc.Height    = 16;
+    TexDesc.Format    = TEX_FORMAT_RGBA8_UNORM;
+    TexDesc.BindFlags = BIND_SHADER_RESOURCE;
+
+    RefCntAutoPtr<ITexture> pTextures[NumTextures];
+    for (Uint32 i = 0; i < NumTextures; ++i)
+    {
+        pDevice->CreateTexture(TexDesc, nullptr, &pTextures[i]);
+        ASSERT_NE(pTextures[i], nullptr);
+
+        const std::string        VarName = "g_Tex" + std::to_string(i);
+        IShaderResourceVariable* pVar    = pSRB->GetVariableByName(SHADER_TYPE_PIXEL, VarName.c_str());
+        ASSERT_NE(pVar, nullptr) << VarName;
+        pVar->Set(pTextures[i]->GetDefaultView(TEXTURE_VIEW_SHADER_RESOURCE));
+    }
+
+    RefCntAutoPtr<IBuffer> pCB0 = pEnv->CreateBuffer({"MultiBindGLTest CB0", 16, BIND_UNIFORM_BUFFER});
+    RefCntAutoPtr<IBuffer> pCB1 = pEnv->CreateBuffer({"MultiBindGLTest CB1", 16, BIND_UNIFORM_BUFFER});
+    ASSERT_NE(pCB0, nullptr);
+    ASSERT_NE(pCB1, nullptr);
+    pSRB->GetVariableByName(SHADER_TYPE_PIXEL, "CB0")->Set(pCB0);
+    pSRB->GetVariableByName(SHADER_TYPE_PIXEL, "CB1")->Set(pCB1);
+
+    TextureDesc RTDesc;
+    RTDesc.Name      = "MultiBindGLTest render target";
+    RTDesc.Type      = RESOURCE_DIM_TEX_2D;
+    RTDesc.Width     = 16;
+    RTDesc.Height    = 16;
+    RTDesc.Format    = TEX_FORMAT_RGBA8_UNORM;
+    RTDesc.BindFlags = BIND_RENDER_TARGET;
+    RefCntAutoPtr<ITexture> pRT;
+    pDevice->CreateTexture(RTDesc, nullptr, &pRT);
+    ASSERT_NE(pRT, nullptr);
+
+    ITextureView* pRTV = pRT->GetDefaultView(TEXTURE_VIEW_RENDER_TARGET);
+    pContext->SetRenderTargets(1, &pRTV, nullptr, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    pContext->SetPipelineState(pPSO);
+    pContext->CommitShaderResources(pSRB, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+
+    pContextGL->ClearBindingStats();
+    pContext->Draw(DrawAttribs{3, DRAW_FLAG_VERIFY_ALL});
+
+    const DeviceContextGLBindingStats FirstDrawStats = pContextGL->GetBindingStats();
+    EXPECT_GT(FirstDrawStats.TextureBindCalls, 0u);
+    EXPECT_GT(FirstDrawStats.UniformBufferBindCalls, 0u);
+    if (FirstDrawStats.MultiBindCalls > 0)
+    {
+        // Textures and uniform buffers occupy contiguous slots and must be bound with fewer calls than slots
+        EXPECT_LT(FirstDrawStats.TextureBindCalls, NumTextures);
+        EXPECT_LT(FirstDrawStats.SamplerBindCalls, NumTextures);
+        EXPECT_LT(FirstDrawStats.UniformBufferBindCalls, 2u);
+    }
+    else
+    {
+        EXPECT_GE(FirstDrawStats.TextureBindCalls, NumTextures);
+        EXPECT_GE(FirstDrawStats.UniformBufferBindCalls, 2u);
+    }
+
+    // All resources are already bound, so the second draw must not issue any binding calls
+    pContextGL->ClearBindingStats();
+    pContext->CommitShaderResources(pSRB, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    pContext->Draw(DrawAttribs{3, DRAW_FLAG_VERIFY_ALL});
+
+    const DeviceContextGLBindingStats& SecondDrawStats = pContextGL->GetBindingStats();
+    EXPECT_EQ(SecondDrawStats.TextureBindCalls, 0u);
+    EXPECT_EQ(SecondDrawStats.SamplerBindCalls, 0u);
+    EXPECT_EQ(SecondDrawStats.UniformBufferBindCalls, 0u);
+    EXPECT_EQ(SecondDrawStats.StorageBufferBindCalls, 0u);
+    EXPECT_EQ(SecondDrawStats.ImageBindCalls, 0u);
+    EXPECT_EQ(SecondDrawStats.MultiBindCalls, 0u);
+}
+
+} // namespace
@@ -0,0 +1,233 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <cstring>
+
+#include "RenderDeviceGL.h"
+#include "RenderStateCache.h"
+#include "Dearchiver.h"
+#include "DataBlobImpl.hpp"
+#include "GPUTestingEnvironment.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+constexpr char VSSource[] = R"(
+void main(uint VertexId : SV_VertexId, out float4 Pos : SV_Position)
+{
+    float2 PosXY[3] =
+    {
+        float2(-1.0, -1.0),
+        float2(-1.0, +3.0),
+        float2(+3.0, -1.0)
+    };
+    Pos = float4(PosXY[VertexId], 0.0, 1.0);
+}
+)";
+
+constexpr char PSSource[] = R"(
+float4 main(in float4 Pos : SV_Position) : SV_Target
+{
+    return float4(0.25, 0.5, 0.75, 1.0);
+}
+)";
+
+RefCntAutoPtr<IRenderStateCache> CreateCache(IRenderDevice* pDevice, IDataBlob* pCacheData)
+{
+    RenderStateCacheCreateInfo CacheCI;
+    CacheCI.pDevice          = pDevice;
+    CacheCI.pArchiverFactory = GPUTestingEnvironment::GetInstance()->GetArchiverFactory();
+    CacheCI.LogLevel         = RENDER_STATE_CACHE_LOG_LEVEL_VERBOSE;
+
+    RefCntAutoPtr<IRenderStateCache> pCache;
+    CreateRenderStateCache(CacheCI, &pCache);
+
+    if (pCache && pCacheData != nullptr)
+        EXPECT_TRUE(pCache->Load(pCacheData, 0));
+
+    return pCache;
+}
+
+RefCntAutoPtr<IPipelineState> CreatePSO(IRenderStateCache* pCache, bool PresentInCache)
+{
+    GPUTestingEnvironment* pEnv = GPUTestingEnvironment::GetInstance();
+
+    ShaderCreateInfo ShaderCI;
+    ShaderCI.SourceLanguage = SHADER_SOURCE_LANGUAGE_HLSL;
+    ShaderCI.EntryPoint     = "main";
+
+    RefCntAutoPtr<IShader> pVS;
+    {
+        ShaderCI.Desc   = {"Program binary cache test VS", SHADER_TYPE_VERTEX, true};
+        ShaderCI.Source = VSSource;
+        EXPECT_EQ(pCache->CreateShader(ShaderCI, &pVS), PresentInCache);
+        if (!pVS)
+            return {};
+    }
+
+    RefCntAutoPtr<IShader> pPS;
+    {
+        ShaderCI.Desc   = {"Program binary cache test PS", SHADER_TYPE_PIXEL, true};
+        ShaderCI.Source = PSSource;
+        EXPECT_EQ(pCache->CreateShader(ShaderCI, &pPS), PresentInCache);
+        if (!pPS)
+            return {};
+    }
+
+    GraphicsPipelineStateCreateInfo PSOCreateInfo;
+    PSOCreateInfo.PSODesc.Name = "Program binary cache test";
+
+    GraphicsPipelineDesc& GraphicsPipeline        = PSOCreateInfo.GraphicsPipeline;
+    GraphicsPipeline.NumRenderTargets             = 1;
+    GraphicsPipeline.RTVFormats[0]                = pEnv->GetSwapChain()->GetDesc().ColorBufferFormat;
+    GraphicsPipeline.PrimitiveTopology            = PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+    GraphicsPipeline.RasterizerDesc.CullMode      = CULL_MODE_NONE;
+    GraphicsPipeline.DepthStencilDesc.DepthEnable = False;
+
+    PSOCreateInfo.pVS = pVS;
+    PSOCreateInfo.pPS = pPS;
+
+    RefCntAutoPtr<IPipelineState> pPSO;
+    EXPECT_EQ(pCache->CreateGraphicsPipelineState(PSOCreateInfo, &pPSO), PresentInCache);
+    return pPSO;
+}
+
+void Draw(IPipelineState* pPSO)
+{
+    GPUTestingEnvironment* pEnv       = GPUTestingEnvironment::GetInstance();
+    IDeviceContext*        pCtx       = pEnv->GetDeviceContext();
+    ISwapChain*            pSwapChain = pEnv->GetSwapChain();
+
+    ITextureView* pRTVs[] = {pSwapChain->GetCurrentBackBufferRTV()};
+    pCtx->SetRenderTargets(1, pRTVs, nullptr, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+
+    constexpr float ClearColor[] = {0, 0, 0, 0};
+    pCtx->ClearRenderTarget(pRTVs[0], ClearColor, RESOURCE_STATE_TRANSITION_MODE_VERIFY);
+
+    pCtx->SetPipelineState(pPSO);
+    pCtx->Draw(DrawAttribs{3, DRAW_FLAG_VERIFY_ALL});
+    pCtx->Flush();
+}
+
+// Checks that program binaries are written to the render state cache and loaded back
+TEST(ProgramBinaryCacheGLTest, RenderStateCache)
+{
+    GPUTestingEnvironment* pEnv    = GPUTestingEnvironment::GetInstance();
+    IRenderDevice*         pDevice = pEnv->GetDevice();
+
+    RefCntAutoPtr<IRenderDeviceGL> pDeviceGL{pDevice, IID_RenderDeviceGL};
+    if (!pDeviceGL)
+        GTEST_SKIP() << "This test requires an OpenGL device";
+    if (pEnv->GetArchiverFactory() == nullptr)
+        GTEST_SKIP() << "Archiver library is not loaded";
+
+    GPUTestingEnvironment::ScopedReset AutoReset;
+
+    RefCntAutoPtr<IDataBlob> pCacheData;
+    {
+        RefCntAutoPtr<IRenderStateCache> pCache = CreateCache(pDevice, nullptr);
+        ASSERT_NE(pCache, nullptr);
+
+        const ProgramBinaryCacheStatsGL StatsBefore = pDeviceGL->GetProgramBinaryCacheStats();
+
+        RefCntAutoPtr<IPipelineState> pPSO = CreatePSO(pCache, false);
+        ASSERT_NE(pPSO, nullptr);
+        Draw(pPSO);
+
+        const ProgramBinaryCacheStatsGL StatsAfter = pDeviceGL->GetProgramBinaryCacheStats();
+        EXPECT_EQ(StatsAfter.NumBinaryHits, StatsBefore.NumBinaryHits);
+
+        RefCntAutoPtr<IDataBlob> pBinaries;
+        pDeviceGL->StoreProgramBinaries(&pBinaries);
+        if (!pBinaries)
+            GTEST_SKIP() << "Program binary cache is not enabled or not supported by this device";
+
+        ASSERT_TRUE(pCache->WriteToBlob(0, &pCacheData));
+        ASSERT_NE(pCacheData, nullptr);
+    }
+
+    // The archive must contain the program binaries that the device accepts
+    {
+        RefCntAutoPtr<IDearchiver> pDearchiver;
+        pDevice->GetEngineFactory()->CreateDearchiver(DearchiverCreateInfo{}, &pDearchiver);
+        ASSERT_NE(pDearchiver, nullptr);
+        ASSERT_TRUE(pDearchiver->LoadArchive(pCacheData));
+
+        RefCntAutoPtr<IDataBlob> pBinaries;
+        pDearchiver->GetDeviceData(pDevice->GetDeviceInfo().Type, &pBinaries);
+        ASSERT_NE(pBinaries, nullptr);
+        EXPECT_GT(pBinaries->GetSize(), size_t{0});
+        EXPECT_TRUE(pDeviceGL->LoadProgramBinaries(pBinaries));
+
+        // Truncated data must be rejected
+        RefCntAutoPtr<IDataBlob> pTruncated = DataBlobImpl::Create(pBinaries->GetSize() - 1, pBinaries->GetConstDataPtr());
+        pEnv->SetErrorAllowance(1, "No worries, errors are expected: testing truncated program binaries\n");
+        EXPECT_FALSE(pDeviceGL->LoadProgramBinaries(pTruncated));
+
+        // Data with trailing bytes must be rejected
+        RefCntAutoPtr<DataBlobImpl> pExtended = DataBlobImpl::Create(pBinaries->GetSize() + 1);
+        memcpy(pExtended->GetDataPtr(), pBinaries->GetConstDataPtr(), pBinaries->GetSize());
+        pEnv->SetErrorAllowance(1, "No worries, errors are expected: testing program binaries with trailing data\n");
+        EXPECT_FALSE(pDeviceGL->LoadProgramBinaries(pExtended));
+    }
+
+    // Programs of the cached pipeline are created from the binaries
+    {
+        RefCntAutoPtr<IRenderStateCache> pCache = CreateCache(pDevice, pCacheData);
+        ASSERT_NE(pCache, nullptr);
+
+        const ProgramBinaryCacheStatsGL StatsBefore = pDeviceGL->GetProgramBinaryCacheStats();
+
+        RefCntAutoPtr<IPipelineState> pPSO = CreatePSO(pCache, true);
+        ASSERT_NE(pPSO, nullptr);
+        EXPECT_EQ(pPSO->GetStatus(), PIPELINE_STATE_STATUS_READY);
+        Draw(pPSO);
+
+        const ProgramBinaryCacheStatsGL StatsAfter = pDeviceGL->GetProgramBinaryCacheStats();
+        EXPECT_GT(StatsAfter.NumBinaryHits, StatsBefore.NumBinaryHits);
+        EXPECT_EQ(StatsAfter.NumBinaryMisses, StatsBefore.NumBinaryMisses);
+        EXPECT_EQ(StatsAfter.NumBinaryRejected, StatsBefore.NumBinaryRejected);
+
+        RefCntAutoPtr<IDataBlob> pCacheData2;
+        ASSERT_TRUE(pCache->WriteToBlob(0, &pCacheData2));
+        ASSERT_NE(pCacheData2, nullptr);
+
+        RefCntAutoPtr<IDearchiver> pDearchiver;
+        pDevice->GetEngineFactory()->CreateDearchiver(DearchiverCreateInfo{}, &pDearchiver);
+        ASSERT_TRUE(pDearchiver->LoadArchive(pCacheData2));
+
+        RefCntAutoPtr<IDataBlob> pBinaries;
+        pDearchiver->GetDeviceData(pDevice->GetDeviceInfo().Type, &pBinaries);
+        EXPECT_NE(pBinaries, nullptr);
+    }
+}
+
+} // namespace
@@ -0,0 +1,303 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use this software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+// The null device is not one of the GPU testing environment modes, so these tests
+// create their own device and run regardless of the --mode argument.
+
+#include <array>
+#include <cstring>
+
+#include "EngineFactoryNull.h"
+#include "RefCntAutoPtr.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+class RenderDeviceNullTest : public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        IEngineFactoryNull* pFactory = LoadAndGetEngineFactoryNull();
+        ASSERT_NE(pFactory, nullptr);
+
+        EngineCreateInfo EngineCI;
+        EngineCI.Features = DeviceFeatures{DEVICE_FEATURE_STATE_OPTIONAL};
+        pFactory->CreateDeviceAndContextsNull(EngineCI, &sm_pDevice, &sm_pContext);
+        ASSERT_NE(sm_pDevice, nullptr);
+        ASSERT_NE(sm_pContext, nullptr);
+    }
+
+    static void TearDownTestSuite()
+    {
+        sm_pContext.Release();
+        sm_pDevice.Release();
+    }
+
+    static RefCntAutoPtr<IBuffer> CreateBuffer(const char* Name, USAGE Usage, BIND_FLAGS BindFlags, CPU_ACCESS_FLAGS CPUAccess, Uint64 Size, const void* pInitData = nullptr)
+    {
+        BufferDesc BuffDesc;
+        BuffDesc.Name           = Name;
+        BuffDesc.Size           = Size;
+        BuffDesc.Usage          = Usage;
+        BuffDesc.BindFlags      = BindFlags;
+        BuffDesc.CPUAccessFlags = CPUAccess;
+
+        BufferData InitData{pInitData, Size};
+
+        RefCntAutoPtr<IBuffer> pBuffer;
+        sm_pDevice->CreateBuffer(BuffDesc, pInitData != nullptr ? &InitData : nullptr, &pBuffer);
+        return pBuffer;
+    }
+
+    // Copies the buffer to a staging buffer and returns its contents
+    template <size_t Size>
+    static std::array<Uint8, Size> ReadBuffer(IBuffer* pBuffer)
+    {
+        std::array<Uint8, Size> Data{};
+
+        RefCntAutoPtr<IBuffer> pStaging = CreateBuffer("Null device test staging buffer", USAGE_STAGING, BIND_NONE, CPU_ACCESS_READ, Size);
+        if (!pStaging)
+        {
+            ADD_FAILURE() << "Failed to create staging buffer";
+            return Data;
+        }
+
+        sm_pContext->CopyBuffer(pBuffer, 0, RESOURCE_STATE_TRANSITION_MODE_TRANSITION, pStaging, 0, Size, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+
+        void* pData = nullptr;
+        sm_pContext->MapBuffer(pStaging, MAP_READ, MAP_FLAG_DO_NOT_WAIT, pData);
+        EXPECT_NE(pData, nullptr);
+        if (pData != nullptr)
+            memcpy(Data.data(), pData, Size);
+        sm_pContext->UnmapBuffer(pStaging, MAP_READ);
+        return Data;
+    }
+
+    static RefCntAutoPtr<IRenderDevice>  sm_pDevice;
+    static RefCntAutoPtr<IDeviceContext> sm_pContext;
+};
+
+RefCntAutoPtr<IRenderDevice>  RenderDeviceNullTest::sm_pDevice;
+RefCntAutoPtr<IDeviceContext> RenderDeviceNullTest::sm_pContext;
+
+TEST_F(RenderDeviceNullTest, DeviceInfo)
+{
+    const RenderDeviceInfo& DeviceInfo = sm_pDevice->GetDeviceInfo();
+    EXPECT_EQ(DeviceInfo.Type, RENDER_DEVICE_TYPE_NULL);
+    EXPECT_TRUE(DeviceInfo.IsNullDevice());
+    EXPECT_EQ(sm_pContext->GetDesc().ContextId, 0u);
+}
+
+TEST_F(RenderDeviceNullTest, BufferInitialData)
+{
+    const std::array<Uint8, 16> RefData = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15};
+
+    RefCntAutoPtr<IBuffer> pBuffer = CreateBuffer("Null device test buffer", USAGE_DEFAULT, BIND_VERTEX_BUFFER, CPU_ACCESS_NONE, RefData.size(), RefData.data());
+    ASSERT_NE(pBuffer, nullptr);
+    EXPECT_EQ(ReadBuffer<16>(pBuffer), RefData);
+
+    const Uint8 NewData[4] = {100, 101, 102, 103};
+    sm_pContext->UpdateBuffer(pBuffer, 4, sizeof(NewData), NewData, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+
+    std::array<Uint8, 16> UpdatedData = RefData;
+    memcpy(&UpdatedData[4], NewData, sizeof(NewData));
+    EXPECT_EQ(ReadBuffer<16>(pBuffer), UpdatedData);
+}
+
+TEST_F(RenderDeviceNullTest, DynamicBufferDiscard)
+{
+    constexpr Uint64 BufferSize = 64;
+
+    RefCntAutoPtr<IBuffer> pBuffer = CreateBuffer("Null device test dynamic buffer", USAGE_DYNAMIC, BIND_UNIFORM_BUFFER, CPU_ACCESS_WRITE, BufferSize);
+    ASSERT_NE(pBuffer, nullptr);
+
+    void* pData0 = nullptr;
+    sm_pContext->MapBuffer(pBuffer, MAP_WRITE, MAP_FLAG_DISCARD, pData0);
+    ASSERT_NE(pData0, nullptr);
+    memset(pData0, 1, BufferSize);
+    sm_pContext->UnmapBuffer(pBuffer, MAP_WRITE);
+
+    // Every discard map must return a new region of memory
+    void* pData1 = nullptr;
+    sm_pContext->MapBuffer(pBuffer, MAP_WRITE, MAP_FLAG_DISCARD, pData1);
+    ASSERT_NE(pData1, nullptr);
+    EXPECT_NE(pData1, pData0);
+    memset(pData1, 2, BufferSize / 2);
+    sm_pContext->UnmapBuffer(pBuffer, MAP_WRITE);
+
+    // No-overwrite map must return the region of the last discard map with the data preserved
+    void* pData2 = nullptr;
+    sm_pContext->MapBuffer(pBuffer, MAP_WRITE, MAP_FLAG_NO_OVERWRITE, pData2);
+    ASSERT_NE(pData2, nullptr);
+    EXPECT_EQ(pData2, pData1);
+    EXPECT_EQ(static_cast<const Uint8*>(pData2)[0], 2);
+    memset(static_cast<Uint8*>(pData2) + BufferSize / 2, 3, BufferSize / 2);
+    sm_pContext->UnmapBuffer(pBuffer, MAP_WRITE);
+
+    std::array<Uint8, BufferSize> RefData{};
+    memset(RefData.data(), 2, BufferSize / 2);
+    memset(RefData.data() + BufferSize / 2, 3, BufferSize / 2);
+    EXPECT_EQ(ReadBuffer<BufferSize>(pBuffer), RefData);
+
+    sm_pContext->FinishFrame();
+
+    // Discard maps in many buffers must not alias each other
+    constexpr Uint32 NumBuffers = 64;
+
+    std::array<RefCntAutoPtr<IBuffer>, NumBuffers> Buffers;
+    for (Uint32 i = 0; i < NumBuffers; ++i)
+    {
+        Buffers[i] = CreateBuffer("Null device test dynamic buffer", USAGE_DYNAMIC, BIND_UNIFORM_BUFFER, CPU_ACCESS_WRITE, BufferSize);
+        ASSERT_NE(Buffers[i], nullptr);
+
+        void* pData = nullptr;
+        sm_pContext->MapBuffer(Buffers[i], MAP_WRITE, MAP_FLAG_DISCARD, pData);
+        ASSERT_NE(pData, nullptr);
+        memset(pData, static_cast<int>(i), BufferSize);
+        sm_pContext->UnmapBuffer(Buffers[i], MAP_WRITE);
+    }
+    for (Uint32 i = 0; i < NumBuffers; ++i)
+    {
+        std::array<Uint8, BufferSize> BufferRefData;
+        BufferRefData.fill(static_cast<Uint8>(i));
+        EXPECT_EQ(ReadBuffer<BufferSize>(Buffers[i]), BufferRefData) << "Buffer " << i;
+    }
+
+    sm_pContext->FinishFrame();
+}
+
+TEST_F(RenderDeviceNullTest, DrawWithSignature)
+{
+    TextureDesc RTDesc;
+    RTDesc.Name      = "Null device test render target";
+    RTDesc.Type      = RESOURCE_DIM_TEX_2D;
+    RTDesc.Width     = 64;
+    RTDesc.Height    = 64;
+    RTDesc.Format    = TEX_FORMAT_RGBA8_UNORM;
+    RTDesc.BindFlags = BIND_RENDER_TARGET;
+
+    RefCntAutoPtr<ITexture> pRenderTarget;
+    sm_pDevice->CreateTexture(RTDesc, nullptr, &pRenderTarget);
+    ASSERT_NE(pRenderTarget, nullptr);
+
+    RefCntAutoPtr<IBuffer> pConstants = CreateBuffer("Null device test constants", USAGE_DYNAMIC, BIND_UNIFORM_BUFFER, CPU_ACCESS_WRITE, 256);
+    ASSERT_NE(pConstants, nullptr);
+
+    // The null backend does not reflect shaders, so the resources are defined by an explicit signature
+    const PipelineResourceDesc Resources[] = {
+        {SHADER_TYPE_VS_PS, "cbConstants", 1, SHADER_RESOURCE_TYPE_CONSTANT_BUFFER, SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE},
+    };
+
+    PipelineResourceSignatureDesc SignDesc;
+    SignDesc.Name         = "Null device test signature";
+    SignDesc.Resources    = Resources;
+    SignDesc.NumResources = _countof(Resources);
+
+    RefCntAutoPtr<IPipelineResourceSignature> pSignature;
+    sm_pDevice->CreatePipelineResourceSignature(SignDesc, &pSignature);
+    ASSERT_NE(pSignature, nullptr);
+
+    ShaderCreateInfo ShaderCI;
+    ShaderCI.SourceLanguage = SHADER_SOURCE_LANGUAGE_HLSL;
+    ShaderCI.EntryPoint     = "main";
+    ShaderCI.Source         = "void main() {}";
+
+    RefCntAutoPtr<IShader> pVS;
+    ShaderCI.Desc = {"Null device test VS", SHADER_TYPE_VERTEX, true};
+    sm_pDevice->CreateShader(ShaderCI, &pVS);
+    ASSERT_NE(pVS, nullptr);
+
+    RefCntAutoPtr<IShader> pPS;
+    ShaderCI.Desc = {"Null device test PS", SHADER_TYPE_PIXEL, true};
+    sm_pDevice->CreateShader(ShaderCI, &pPS);
+    ASSERT_NE(pPS, nullptr);
+
+    IPipelineResourceSignature* ppSignatures[] = {pSignature};
+
+    GraphicsPipelineStateCreateInfo PsoCI;
+    PsoCI.PSODesc.Name                                  = "Null device test PSO";
+    PsoCI.pVS                                           = pVS;
+    PsoCI.pPS                                           = pPS;
+    PsoCI.ppResourceSignatures                          = ppSignatures;
+    PsoCI.ResourceSignaturesCount                       = _countof(ppSignatures);
+    PsoCI.GraphicsPipeline.NumRenderTargets             = 1;
+    PsoCI.GraphicsPipeline.RTVFormats[0]                = RTDesc.Format;
+    PsoCI.GraphicsPipeline.PrimitiveTopology            = PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+    PsoCI.GraphicsPipeline.DepthStencilDesc.DepthEnable = false;
+
+    RefCntAutoPtr<IPipelineState> pPSO;
+    sm_pDevice->CreateGraphicsPipelineState(PsoCI, &pPSO);
+    ASSERT_NE(pPSO, nullptr);
+
+    RefCntAutoPtr<IShaderResourceBinding> pSRB;
+    pSignature->CreateShaderResourceBinding(&pSRB, true);
+    ASSERT_NE(pSRB, nullptr);
+
+    IShaderResourceVariable* pVar = pSRB->GetVariableByName(SHADER_TYPE_VERTEX, "cbConstants");
+    ASSERT_NE(pVar, nullptr);
+    pVar->Set(pConstants);
+    EXPECT_EQ(pVar->Get(), pConstants);
+
+    ITextureView* pRTV = pRenderTarget->GetDefaultView(TEXTURE_VIEW_RENDER_TARGET);
+    sm_pContext->SetRenderTargets(1, &pRTV, nullptr, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    sm_pContext->SetPipelineState(pPSO);
+    sm_pContext->CommitShaderResources(pSRB, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    for (Uint32 i = 0; i < 16; ++i)
+    {
+        void* pData = nullptr;
+        sm_pContext->MapBuffer(pConstants, MAP_WRITE, MAP_FLAG_DISCARD, pData);
+        ASSERT_NE(pData, nullptr);
+        sm_pContext->UnmapBuffer(pConstants, MAP_WRITE);
+
+        sm_pContext->Draw({3, DRAW_FLAG_VERIFY_ALL});
+    }
+    sm_pContext->Flush();
+    sm_pContext->FinishFrame();
+}
+
+TEST_F(RenderDeviceNullTest, Fence)
+{
+    FenceDesc Desc;
+    Desc.Name = "Null device test fence";
+    Desc.Type = FENCE_TYPE_GENERAL;
+
+    RefCntAutoPtr<IFence> pFence;
+    sm_pDevice->CreateFence(Desc, &pFence);
+    ASSERT_NE(pFence, nullptr);
+
+    sm_pContext->EnqueueSignal(pFence, 5);
+    sm_pContext->Flush();
+    // The null device completes all commands immediately
+    EXPECT_EQ(pFence->GetCompletedValue(), 5u);
+    sm_pContext->DeviceWaitForFence(pFence, 5);
+}
+
+} // namespace
@@ -0,0 +1,134 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "ScreenCapture.hpp"
+#include "OffScreenSwapChain.hpp"
+#include "ThreadPool.hpp"
+#include "GPUTestingEnvironment.hpp"
+
+#include <cstring>
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+void TestScreenCapturePipeline(IThreadPool* pThreadPool, ScreenCapture::ENCODING Encoding, bool WaitWhenFull)
+{
+    GPUTestingEnvironment* pEnv     = GPUTestingEnvironment::GetInstance();
+    IRenderDevice*         pDevice  = pEnv->GetDevice();
+    IDeviceContext*        pContext = pEnv->GetDeviceContext();
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    SwapChainDesc SCDesc;
+    SCDesc.Width             = 64;
+    SCDesc.Height            = 32;
+    SCDesc.ColorBufferFormat = TEX_FORMAT_RGBA8_UNORM;
+    SCDesc.DepthBufferFormat = TEX_FORMAT_UNKNOWN;
+
+    RefCntAutoPtr<ISwapChain> pSwapChain;
+    CreateOffScreenSwapChain(pDevice, pContext, SCDesc, &pSwapChain);
+    ASSERT_NE(pSwapChain, nullptr);
+
+    ScreenCapture::CreateInfo CI;
+    CI.MaxCapturesInFlight = 3;
+    CI.WaitWhenFull        = WaitWhenFull;
+    CI.pThreadPool         = pThreadPool;
+    CI.Encoding            = Encoding;
+
+    ScreenCapture Capture{pDevice, CI};
+
+    constexpr Uint32 NumFrames    = 16;
+    constexpr float  ClearColor[] = {1, 0.5, 0, 1};
+    for (Uint32 Frame = 0; Frame < NumFrames; ++Frame)
+    {
+        ITextureView* pRTV = pSwapChain->GetCurrentBackBufferRTV();
+        pContext->SetRenderTargets(1, &pRTV, nullptr, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+        pContext->ClearRenderTarget(pRTV, ClearColor, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+
+        Capture.Capture(pSwapChain, pContext, Frame);
+        pSwapChain->Present();
+        Capture.Poll(pContext);
+    }
+    Capture.WaitForIdle(pContext);
+
+    const ScreenCapture::Statistics Stats = Capture.GetStatistics();
+    EXPECT_EQ(Stats.NumCaptured + Stats.NumDropped, NumFrames);
+    EXPECT_EQ(Stats.NumEncoded, Stats.NumCaptured);
+    if (WaitWhenFull)
+        EXPECT_EQ(Stats.NumDropped, 0u);
+
+    Uint32 NumEncoded = 0;
+    Uint32 LastId     = 0;
+    while (ScreenCapture::EncodedCapture Encoded = Capture.GetEncodedCapture())
+    {
+        EXPECT_EQ(Encoded.Width, SCDesc.Width);
+        EXPECT_EQ(Encoded.Height, SCDesc.Height);
+        if (NumEncoded > 0 && pThreadPool == nullptr)
+            EXPECT_GT(Encoded.Id, LastId);
+        LastId = Encoded.Id;
+
+        if (Encoding == ScreenCapture::ENCODING::RGBA8)
+        {
+            ASSERT_EQ(Encoded.pData->GetSize(), size_t{SCDesc.Width} * SCDesc.Height * 4);
+            const Uint8* pPixels = static_cast<const Uint8*>(Encoded.pData->GetConstDataPtr());
+            EXPECT_EQ(pPixels[0], 255);
+            EXPECT_NEAR(pPixels[1], 128, 1);
+            EXPECT_EQ(pPixels[2], 0);
+            EXPECT_EQ(pPixels[3], 255);
+        }
+        else
+        {
+            ASSERT_GT(Encoded.pData->GetSize(), size_t{8});
+            EXPECT_EQ(memcmp(Encoded.pData->GetConstDataPtr(), "\x89PNG", 4), 0);
+        }
+        ++NumEncoded;
+    }
+    EXPECT_EQ(NumEncoded, Stats.NumEncoded);
+}
+
+TEST(ScreenCaptureTest, Pipelined)
+{
+    TestScreenCapturePipeline(nullptr, ScreenCapture::ENCODING::RGBA8, true);
+}
+
+TEST(ScreenCaptureTest, PipelinedPNG)
+{
+    TestScreenCapturePipeline(nullptr, ScreenCapture::ENCODING::PNG, false);
+}
+
+TEST(ScreenCaptureTest, ThreadPool)
+{
+    RefCntAutoPtr<IThreadPool> pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{2});
+    TestScreenCapturePipeline(pThreadPool, ScreenCapture::ENCODING::RGBA8, true);
+    TestScreenCapturePipeline(pThreadPool, ScreenCapture::ENCODING::PNG, false);
+}
+
+} // namespace
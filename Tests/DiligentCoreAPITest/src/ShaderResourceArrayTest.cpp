@@ -302,7 +302,7 @@ float4 main(in PSInput PSIn) : SV_Target
 )"};
 }
 
-TEST(ShaderResourceArrayTest, DynamicArrayIndexing)
+void TestDynamicArrayIndexing(bool UseSetVariables)
 {
     GPUTestingEnvironment*  pEnv       = GPUTestingEnvironment::GetInstance();
     IRenderDevice*          pDevice    = pEnv->GetDevice();
@@ -384,7 +384,6 @@ TEST(ShaderResourceArrayTest, DynamicArrayIndexing)
     float4                 BufferData{2, 0, 0, 0};
     RefCntAutoPtr<IBuffer> pBuffer = pEnv->CreateBuffer(BufferDesc{"ShaderResourceArrayTest.DynamicArrayIndexing", sizeof(BufferData), BIND_UNIFORM_BUFFER, USAGE_DEFAULT}, BufferData.Data());
     ASSERT_NE(pBuffer, nullptr);
-    pSRB->GetVariableByName(SHADER_TYPE_PIXEL, "cbConstants")->Set(pBuffer);
 
     std::vector<Uint32>     BlackTextData(64 * 64, 0);
     std::vector<Uint32>     WhiteTextData(64 * 64, ~0u);
@@ -398,8 +397,26 @@ TEST(ShaderResourceArrayTest, DynamicArrayIndexing)
     ASSERT_NE(pBlackTexSRV, nullptr);
 
     IDeviceObject* pTextures[] = {pBlackTexSRV, pBlackTexSRV, pWhiteTexSRV, pBlackTexSRV};
-    pSRB->GetVariableByName(SHADER_TYPE_PIXEL, "g_Textures")->SetArray(pTextures, 0, _countof(pTextures));
-    pSRB->GetVariableByName(SHADER_TYPE_PIXEL, "g_OtherTexture")->Set(pWhiteTexSRV);
+    if (UseSetVariables)
+    {
+        IDeviceObject* pBufferObj       = pBuffer;
+        IDeviceObject* pOtherTextureObj = pWhiteTexSRV;
+
+        const ShaderVariableBinding Bindings[] = {
+            {SHADER_TYPE_PIXEL, pSRB->GetVariableByName(SHADER_TYPE_PIXEL, "cbConstants")->GetIndex(), &pBufferObj},
+            // Set the array in two ranges to test that writes to consecutive elements are combined
+            {SHADER_TYPE_PIXEL, pSRB->GetVariableByName(SHADER_TYPE_PIXEL, "g_Textures")->GetIndex(), pTextures + 2, 2, 2},
+            {SHADER_TYPE_PIXEL, pSRB->GetVariableByName(SHADER_TYPE_PIXEL, "g_OtherTexture")->GetIndex(), &pOtherTextureObj},
+            {SHADER_TYPE_PIXEL, pSRB->GetVariableByName(SHADER_TYPE_PIXEL, "g_Textures")->GetIndex(), pTextures, 0, 2},
+        };
+        pSRB->SetVariables(Bindings, _countof(Bindings));
+    }
+    else
+    {
+        pSRB->GetVariableByName(SHADER_TYPE_PIXEL, "cbConstants")->Set(pBuffer);
+        pSRB->GetVariableByName(SHADER_TYPE_PIXEL, "g_Textures")->SetArray(pTextures, 0, _countof(pTextures));
+        pSRB->GetVariableByName(SHADER_TYPE_PIXEL, "g_OtherTexture")->Set(pWhiteTexSRV);
+    }
 
     ITextureView* ppRTVs[] = {pSwapChain->GetCurrentBackBufferRTV()};
     pContext->SetRenderTargets(1, ppRTVs, nullptr, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
@@ -414,4 +431,14 @@ TEST(ShaderResourceArrayTest, DynamicArrayIndexing)
     pSwapChain->Present();
 }
 
+TEST(ShaderResourceArrayTest, DynamicArrayIndexing)
+{
+    TestDynamicArrayIndexing(false);
+}
+
+TEST(ShaderResourceArrayTest, SetVariables)
+{
+    TestDynamicArrayIndexing(true);
+}
+
 } // namespace
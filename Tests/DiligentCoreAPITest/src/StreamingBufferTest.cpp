@@ -30,6 +30,9 @@
 
 #include "gtest/gtest.h"
 
+#include <thread>
+#include <vector>
+
 using namespace Diligent;
 using namespace Diligent::Testing;
 
@@ -101,4 +104,92 @@ TEST(StreamingBufferTest, MapUnmap)
     StreamBuff.Reset();
 }
 
+TEST(StreamingBufferTest, SharedFrame)
+{
+    auto* pEnv     = GPUTestingEnvironment::GetInstance();
+    auto* pDevice  = pEnv->GetDevice();
+    auto* pContext = pEnv->GetDeviceContext();
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    StreamingBufferCreateInfo CI;
+    CI.pDevice = pDevice;
+
+    CI.BuffDesc.Name           = "Test shared streaming buffer";
+    CI.BuffDesc.BindFlags      = BIND_VERTEX_BUFFER;
+    CI.BuffDesc.Usage          = USAGE_DYNAMIC;
+    CI.BuffDesc.CPUAccessFlags = CPU_ACCESS_WRITE;
+    CI.BuffDesc.Size           = 1024;
+    CI.NumSharedRanges         = 16;
+
+    StreamingBuffer StreamBuff{CI};
+    ASSERT_TRUE(StreamBuff.GetBuffer() != nullptr);
+
+    constexpr Uint32 NumThreads        = 4;
+    constexpr Uint32 NumRangesPerThread = 16;
+    constexpr Uint32 RangeSize         = 48;
+
+    auto RunFrame = [&](Uint32& NumFailed) {
+        StreamBuff.BeginSharedFrame(pContext, pDevice);
+
+        std::vector<std::thread> Threads;
+        std::vector<Uint32>      NumFailedPerThread(NumThreads);
+        for (Uint32 t = 0; t < NumThreads; ++t)
+        {
+            Threads.emplace_back([&, t]() {
+                for (Uint32 i = 0; i < NumRangesPerThread; ++i)
+                {
+                    StreamingBuffer::SharedAllocation Alloc = StreamBuff.Allocate(RangeSize, 16, t * NumRangesPerThread + i);
+                    if (Alloc)
+                    {
+                        EXPECT_EQ(Alloc.Offset % 16, 0u);
+                        memset(Alloc.pData, static_cast<int>(t), Alloc.Size);
+                    }
+                    else
+                    {
+                        ++NumFailedPerThread[t];
+                    }
+                }
+            });
+        }
+        for (std::thread& Thread : Threads)
+            Thread.join();
+
+        const std::vector<StreamingBuffer::DrawRange>& Ranges = StreamBuff.EndSharedFrame();
+
+        NumFailed = 0;
+        for (Uint32 Failed : NumFailedPerThread)
+            NumFailed += Failed;
+        EXPECT_EQ(Ranges.size() + NumFailed, NumThreads * NumRangesPerThread);
+
+        for (size_t i = 0; i < Ranges.size(); ++i)
+        {
+            EXPECT_EQ(Ranges[i].Size, RangeSize);
+            EXPECT_LT(Ranges[i].UserData, Uint64{NumThreads * NumRangesPerThread});
+            if (i > 0)
+            {
+                EXPECT_GE(Ranges[i].Offset, Ranges[i - 1].Offset + Ranges[i - 1].Size);
+            }
+        }
+        EXPECT_LE(Ranges.empty() ? 0 : Ranges.back().Offset + Ranges.back().Size, StreamBuff.GetBuffer()->GetDesc().Size);
+    };
+
+    // The first frame overflows the range list, the second one overflows the buffer
+    Uint32 NumFailed = 0;
+    RunFrame(NumFailed);
+    EXPECT_GT(NumFailed, 0u);
+    RunFrame(NumFailed);
+    EXPECT_GT(NumFailed, 0u);
+
+    // Both the list and the buffer must have been extended
+    for (Uint32 Frame = 0; Frame < 3; ++Frame)
+    {
+        RunFrame(NumFailed);
+        pContext->Flush();
+        pContext->FinishFrame();
+    }
+    EXPECT_EQ(NumFailed, 0u);
+    EXPECT_GE(StreamBuff.GetBuffer()->GetDesc().Size, Uint64{NumThreads * NumRangesPerThread * RangeSize});
+}
+
 } // namespace
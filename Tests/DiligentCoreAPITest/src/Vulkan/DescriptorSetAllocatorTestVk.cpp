@@ -0,0 +1,168 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <thread>
+#include <vector>
+
+#include "GPUTestingEnvironment.hpp"
+
+#include "RenderDeviceVk.h"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+const char* const MutableResourcesCS = R"(
+cbuffer Constants
+{
+    float4 g_Data;
+};
+
+RWBuffer<float4> g_Output;
+
+[numthreads(1, 1, 1)]
+void main()
+{
+    g_Output[0] = g_Data;
+}
+)";
+
+TEST(DescriptorSetAllocatorVk, MultithreadedAllocation)
+{
+    GPUTestingEnvironment* pEnv    = GPUTestingEnvironment::GetInstance();
+    IRenderDevice*         pDevice = pEnv->GetDevice();
+    if (!pDevice->GetDeviceInfo().IsVulkanDevice())
+    {
+        GTEST_SKIP() << "This test is only for Vulkan device";
+    }
+    if (!pDevice->GetDeviceInfo().Features.ComputeShaders)
+    {
+        GTEST_SKIP() << "Compute shaders are not supported by this device";
+    }
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    RefCntAutoPtr<IRenderDeviceVk> pDeviceVk{pDevice, IID_RenderDeviceVk};
+    ASSERT_NE(pDeviceVk, nullptr);
+
+    ShaderCreateInfo ShaderCI;
+    ShaderCI.SourceLanguage = SHADER_SOURCE_LANGUAGE_HLSL;
+    ShaderCI.ShaderCompiler = pEnv->GetDefaultCompiler(ShaderCI.SourceLanguage);
+    ShaderCI.Desc           = {"Descriptor set allocator test CS", SHADER_TYPE_COMPUTE, true};
+    ShaderCI.EntryPoint     = "main";
+    ShaderCI.Source         = MutableResourcesCS;
+    RefCntAutoPtr<IShader> pCS;
+    pDevice->CreateShader(ShaderCI, &pCS);
+    ASSERT_NE(pCS, nullptr);
+
+    ComputePipelineStateCreateInfo PSOCreateInfo;
+    PSOCreateInfo.PSODesc.Name                               = "Descriptor set allocator test";
+    PSOCreateInfo.PSODesc.PipelineType                       = PIPELINE_TYPE_COMPUTE;
+    PSOCreateInfo.PSODesc.ResourceLayout.DefaultVariableType = SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE;
+    PSOCreateInfo.pCS                                        = pCS;
+
+    RefCntAutoPtr<IPipelineState> pPSO;
+    pDevice->CreateComputePipelineState(PSOCreateInfo, &pPSO);
+    ASSERT_NE(pPSO, nullptr);
+
+    // Release the sets that may have been left by other tests
+    pDevice->IdleGPU();
+    pDevice->ReleaseStaleResources();
+
+    DescriptorSetAllocatorStatsVk StartStats;
+    pDeviceVk->GetDescriptorSetAllocatorStats(StartStats);
+
+    constexpr Uint32 NumThreads       = 8;
+    constexpr Uint32 NumSRBsPerThread = 256;
+
+    // Every thread allocates from its own bucket first
+    std::vector<std::vector<RefCntAutoPtr<IShaderResourceBinding>>> SRBs(NumThreads);
+    {
+        std::vector<std::thread> Threads(NumThreads);
+        for (Uint32 t = 0; t < NumThreads; ++t)
+        {
+            Threads[t] = std::thread{
+                [&, t]() {
+                    SRBs[t].resize(NumSRBsPerThread);
+                    for (RefCntAutoPtr<IShaderResourceBinding>& pSRB : SRBs[t])
+                        pPSO->CreateShaderResourceBinding(&pSRB);
+                }};
+        }
+        for (std::thread& Thread : Threads)
+            Thread.join();
+    }
+
+    for (const std::vector<RefCntAutoPtr<IShaderResourceBinding>>& ThreadSRBs : SRBs)
+    {
+        for (const RefCntAutoPtr<IShaderResourceBinding>& pSRB : ThreadSRBs)
+            ASSERT_NE(pSRB, nullptr);
+    }
+
+    constexpr Uint64 NumSRBs = NumThreads * NumSRBsPerThread;
+
+    DescriptorSetAllocatorStatsVk AllocStats;
+    pDeviceVk->GetDescriptorSetAllocatorStats(AllocStats);
+    // The signature allocates static/mutable sets in batches and keeps the unused ones for the next SRBs
+    constexpr Uint64 MaxSpareSets = 16;
+    EXPECT_GE(AllocStats.NumSetsAllocated - StartStats.NumSetsAllocated, NumSRBs);
+    EXPECT_LT(AllocStats.NumSetsAllocated - StartStats.NumSetsAllocated, NumSRBs + MaxSpareSets);
+    // Every batch is allocated with a single vkAllocateDescriptorSets call, unless the pool is full
+    EXPECT_LT(AllocStats.NumAllocateCalls - StartStats.NumAllocateCalls, NumSRBs);
+    EXPECT_GE(AllocStats.NumPools, 1u);
+
+    // Released sets are returned to their pools by ReleaseStaleResources().
+    // Spare sets are still owned by the signature and are not released.
+    SRBs.clear();
+    pDevice->IdleGPU();
+    pDevice->ReleaseStaleResources();
+
+    DescriptorSetAllocatorStatsVk ReleaseStats;
+    pDeviceVk->GetDescriptorSetAllocatorStats(ReleaseStats);
+    EXPECT_EQ(ReleaseStats.NumSetsReclaimed - StartStats.NumSetsReclaimed, NumSRBs);
+
+    // Reclaimed space must be reused without creating new pools
+    {
+        std::vector<RefCntAutoPtr<IShaderResourceBinding>> ReusedSRBs(NumSRBsPerThread);
+        for (RefCntAutoPtr<IShaderResourceBinding>& pSRB : ReusedSRBs)
+        {
+            pPSO->CreateShaderResourceBinding(&pSRB);
+            ASSERT_NE(pSRB, nullptr);
+        }
+
+        DescriptorSetAllocatorStatsVk ReuseStats;
+        pDeviceVk->GetDescriptorSetAllocatorStats(ReuseStats);
+        EXPECT_EQ(ReuseStats.NumPools, ReleaseStats.NumPools);
+    }
+
+    pDevice->IdleGPU();
+    pDevice->ReleaseStaleResources();
+}
+
+} // namespace
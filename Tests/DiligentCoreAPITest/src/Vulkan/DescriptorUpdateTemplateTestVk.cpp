@@ -0,0 +1,259 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <array>
+#include <cstring>
+
+#include "GPUTestingEnvironment.hpp"
+
+#include "BasicMath.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+// The shader uses two elements of g_Inputs, while the signature declares three.
+// The third element may be left unbound, which makes the signature fall back to
+// individual descriptor writes instead of the descriptor update template.
+const char* const DynamicResourcesCS = R"(
+cbuffer Constants
+{
+    float4 g_Data;
+};
+
+Buffer<float4>   g_Inputs[2];
+RWBuffer<float4> g_Output;
+
+[numthreads(1, 1, 1)]
+void main()
+{
+    g_Output[0] = g_Data;
+    g_Output[1] = g_Inputs[0].Load(0);
+    g_Output[2] = g_Inputs[1].Load(0);
+}
+)";
+
+constexpr Uint32 NumOutputs = 3;
+
+RefCntAutoPtr<IBuffer> CreateFormattedBuffer(const char* Name, BIND_FLAGS BindFlags, Uint32 NumElements, const float4* pData)
+{
+    BufferDesc BuffDesc;
+    BuffDesc.Name              = Name;
+    BuffDesc.Size              = sizeof(float4) * NumElements;
+    BuffDesc.BindFlags         = BindFlags;
+    BuffDesc.Mode              = BUFFER_MODE_FORMATTED;
+    BuffDesc.ElementByteStride = sizeof(float4);
+
+    BufferData InitData{pData, BuffDesc.Size};
+
+    RefCntAutoPtr<IBuffer> pBuffer;
+    GPUTestingEnvironment::GetInstance()->GetDevice()->CreateBuffer(BuffDesc, pData != nullptr ? &InitData : nullptr, &pBuffer);
+    return pBuffer;
+}
+
+RefCntAutoPtr<IBufferView> CreateFormattedView(IBuffer* pBuffer, BUFFER_VIEW_TYPE ViewType)
+{
+    BufferViewDesc ViewDesc;
+    ViewDesc.ViewType             = ViewType;
+    ViewDesc.Format.ValueType     = VT_FLOAT32;
+    ViewDesc.Format.NumComponents = 4;
+
+    RefCntAutoPtr<IBufferView> pView;
+    pBuffer->CreateView(ViewDesc, &pView);
+    return pView;
+}
+
+TEST(DescriptorUpdateTemplateVk, DynamicResources)
+{
+    GPUTestingEnvironment* pEnv     = GPUTestingEnvironment::GetInstance();
+    IRenderDevice*         pDevice  = pEnv->GetDevice();
+    IDeviceContext*        pContext = pEnv->GetDeviceContext();
+    if (!pDevice->GetDeviceInfo().IsVulkanDevice())
+    {
+        GTEST_SKIP() << "This test is only for Vulkan device";
+    }
+    if (!pDevice->GetDeviceInfo().Features.ComputeShaders)
+    {
+        GTEST_SKIP() << "Compute shaders are not supported by this device";
+    }
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    ShaderCreateInfo ShaderCI;
+    ShaderCI.SourceLanguage = SHADER_SOURCE_LANGUAGE_HLSL;
+    ShaderCI.ShaderCompiler = pEnv->GetDefaultCompiler(ShaderCI.SourceLanguage);
+    ShaderCI.Desc           = {"Descriptor update template test CS", SHADER_TYPE_COMPUTE, true};
+    ShaderCI.EntryPoint     = "main";
+    ShaderCI.Source         = DynamicResourcesCS;
+    RefCntAutoPtr<IShader> pCS;
+    pDevice->CreateShader(ShaderCI, &pCS);
+    ASSERT_NE(pCS, nullptr);
+
+    // clang-format off
+    const PipelineResourceDesc Resources[] =
+    {
+        {SHADER_TYPE_COMPUTE, "Constants", 1, SHADER_RESOURCE_TYPE_CONSTANT_BUFFER, SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC},
+        {SHADER_TYPE_COMPUTE, "g_Inputs",  3, SHADER_RESOURCE_TYPE_BUFFER_SRV,      SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC, PIPELINE_RESOURCE_FLAG_FORMATTED_BUFFER},
+        {SHADER_TYPE_COMPUTE, "g_Output",  1, SHADER_RESOURCE_TYPE_BUFFER_UAV,      SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC, PIPELINE_RESOURCE_FLAG_FORMATTED_BUFFER},
+    };
+    // clang-format on
+
+    PipelineResourceSignatureDesc PRSDesc;
+    PRSDesc.Name         = "Descriptor update template test";
+    PRSDesc.Resources    = Resources;
+    PRSDesc.NumResources = _countof(Resources);
+
+    RefCntAutoPtr<IPipelineResourceSignature> pPRS;
+    pDevice->CreatePipelineResourceSignature(PRSDesc, &pPRS);
+    ASSERT_NE(pPRS, nullptr);
+
+    IPipelineResourceSignature* ppSignatures[] = {pPRS};
+
+    ComputePipelineStateCreateInfo PSOCreateInfo;
+    PSOCreateInfo.PSODesc.Name            = "Descriptor update template test";
+    PSOCreateInfo.PSODesc.PipelineType    = PIPELINE_TYPE_COMPUTE;
+    PSOCreateInfo.ppResourceSignatures    = ppSignatures;
+    PSOCreateInfo.ResourceSignaturesCount = _countof(ppSignatures);
+    PSOCreateInfo.pCS                     = pCS;
+
+    RefCntAutoPtr<IPipelineState> pPSO;
+    pDevice->CreateComputePipelineState(PSOCreateInfo, &pPSO);
+    ASSERT_NE(pPSO, nullptr);
+
+    const float4 Data{1, 2, 3, 4};
+
+    RefCntAutoPtr<IBuffer> pConstants;
+    {
+        BufferDesc BuffDesc;
+        BuffDesc.Name      = "Descriptor update template test constants";
+        BuffDesc.Size      = sizeof(Data);
+        BuffDesc.BindFlags = BIND_UNIFORM_BUFFER;
+
+        BufferData InitData{&Data, sizeof(Data)};
+        pDevice->CreateBuffer(BuffDesc, &InitData, &pConstants);
+        ASSERT_NE(pConstants, nullptr);
+    }
+
+    const std::array<float4, 4> InputData = {
+        float4{10, 11, 12, 13},
+        float4{20, 21, 22, 23},
+        float4{30, 31, 32, 33},
+        float4{40, 41, 42, 43},
+    };
+
+    std::array<RefCntAutoPtr<IBuffer>, InputData.size()>     pInputs;
+    std::array<RefCntAutoPtr<IBufferView>, InputData.size()> pInputSRVs;
+    for (size_t i = 0; i < InputData.size(); ++i)
+    {
+        pInputs[i] = CreateFormattedBuffer("Descriptor update template test input", BIND_SHADER_RESOURCE, 1, &InputData[i]);
+        ASSERT_NE(pInputs[i], nullptr);
+        pInputSRVs[i] = CreateFormattedView(pInputs[i], BUFFER_VIEW_SHADER_RESOURCE);
+        ASSERT_NE(pInputSRVs[i], nullptr);
+    }
+
+    RefCntAutoPtr<IBuffer> pOutput = CreateFormattedBuffer("Descriptor update template test output", BIND_UNORDERED_ACCESS, NumOutputs, nullptr);
+    ASSERT_NE(pOutput, nullptr);
+    RefCntAutoPtr<IBufferView> pOutputUAV = CreateFormattedView(pOutput, BUFFER_VIEW_UNORDERED_ACCESS);
+    ASSERT_NE(pOutputUAV, nullptr);
+
+    RefCntAutoPtr<IBuffer> pStagingBuffer;
+    {
+        BufferDesc BuffDesc;
+        BuffDesc.Name           = "Descriptor update template test staging buffer";
+        BuffDesc.Size           = sizeof(float4) * NumOutputs;
+        BuffDesc.Usage          = USAGE_STAGING;
+        BuffDesc.CPUAccessFlags = CPU_ACCESS_READ;
+        pDevice->CreateBuffer(BuffDesc, nullptr, &pStagingBuffer);
+        ASSERT_NE(pStagingBuffer, nullptr);
+    }
+
+    RefCntAutoPtr<IShaderResourceBinding> pSRB;
+    pPRS->CreateShaderResourceBinding(&pSRB);
+    ASSERT_NE(pSRB, nullptr);
+
+    IShaderResourceVariable* pInputsVar = pSRB->GetVariableByName(SHADER_TYPE_COMPUTE, "g_Inputs");
+    ASSERT_NE(pInputsVar, nullptr);
+    pSRB->GetVariableByName(SHADER_TYPE_COMPUTE, "Constants")->Set(pConstants);
+    pSRB->GetVariableByName(SHADER_TYPE_COMPUTE, "g_Output")->Set(pOutputUAV);
+
+    auto DispatchAndVerify = [&](const float4& RefInput0, const float4& RefInput1) {
+        pContext->SetPipelineState(pPSO);
+        pContext->CommitShaderResources(pSRB, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+        pContext->DispatchCompute(DispatchComputeAttribs{1, 1, 1});
+
+        pContext->CopyBuffer(pOutput, 0, RESOURCE_STATE_TRANSITION_MODE_TRANSITION,
+                             pStagingBuffer, 0, sizeof(float4) * NumOutputs, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+        pContext->WaitForIdle();
+
+        std::array<float4, NumOutputs> Results;
+        {
+            void* pData = nullptr;
+            pContext->MapBuffer(pStagingBuffer, MAP_READ, MAP_FLAG_DO_NOT_WAIT, pData);
+            ASSERT_NE(pData, nullptr);
+            memcpy(Results.data(), pData, sizeof(Results));
+            pContext->UnmapBuffer(pStagingBuffer, MAP_READ);
+        }
+
+        EXPECT_EQ(Results[0], Data);
+        EXPECT_EQ(Results[1], RefInput0);
+        EXPECT_EQ(Results[2], RefInput1);
+    };
+
+    // All elements are bound: the dynamic set is written with the descriptor update template
+    {
+        IDeviceObject* ppInputs[] = {pInputSRVs[0], pInputSRVs[1], pInputSRVs[2]};
+        pInputsVar->SetArray(ppInputs, 0, _countof(ppInputs));
+    }
+    DispatchAndVerify(InputData[0], InputData[1]);
+
+    // Rebinding an element must update the descriptor infos stored in the resource cache
+    {
+        IDeviceObject* ppInputs[] = {pInputSRVs[3]};
+        pInputsVar->SetArray(ppInputs, 0, _countof(ppInputs));
+    }
+    DispatchAndVerify(InputData[3], InputData[1]);
+
+    // The element that is not used by the shader is reset to null: the signature
+    // must fall back to individual descriptor writes that skip null elements
+    {
+        IDeviceObject* ppInputs[] = {nullptr};
+        pInputsVar->SetArray(ppInputs, 2, _countof(ppInputs));
+    }
+    DispatchAndVerify(InputData[3], InputData[1]);
+
+    // Binding the element again re-enables the template
+    {
+        IDeviceObject* ppInputs[] = {pInputSRVs[2], pInputSRVs[0]};
+        pInputsVar->SetArray(ppInputs, 1, _countof(ppInputs));
+    }
+    DispatchAndVerify(InputData[3], InputData[2]);
+}
+
+} // namespace
@@ -0,0 +1,170 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <vector>
+
+#include "GPUTestingEnvironment.hpp"
+
+#include "RenderDeviceVk.h"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+// The testing environment does not batch initial data uploads, so the test enables
+// batching for its own resources only.
+class ScopedUploadBatchSize
+{
+public:
+    ScopedUploadBatchSize(IRenderDeviceVk* pDeviceVk, Uint32 BatchSize) :
+        m_pDeviceVk{pDeviceVk}
+    {
+        m_pDeviceVk->SetInitialDataUploadBatchSize(BatchSize);
+    }
+
+    ~ScopedUploadBatchSize()
+    {
+        m_pDeviceVk->SetInitialDataUploadBatchSize(0);
+    }
+
+private:
+    IRenderDeviceVk* const m_pDeviceVk;
+};
+
+TEST(InitialDataUploadVk, Batching)
+{
+    GPUTestingEnvironment* pEnv    = GPUTestingEnvironment::GetInstance();
+    IRenderDevice*         pDevice = pEnv->GetDevice();
+    if (!pDevice->GetDeviceInfo().IsVulkanDevice())
+    {
+        GTEST_SKIP() << "This test is only for Vulkan device";
+    }
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    RefCntAutoPtr<IRenderDeviceVk> pDeviceVk{pDevice, IID_RenderDeviceVk};
+    ASSERT_NE(pDeviceVk, nullptr);
+
+    IDeviceContext* pContext = pEnv->GetDeviceContext();
+
+    ScopedUploadBatchSize BatchSizeGuard{pDeviceVk, 1u << 20};
+
+    InitialDataUploadStatsVk StartStats;
+    pDeviceVk->GetInitialDataUploadStats(StartStats);
+
+    constexpr Uint32 NumResources = 16;
+    constexpr Uint32 TexSize      = 64;
+    constexpr Uint32 NumBuffElems = 1024;
+
+    std::vector<Uint32> TexData(TexSize * TexSize);
+    std::vector<Uint32> BuffData(NumBuffElems);
+
+    std::vector<RefCntAutoPtr<ITexture>> Textures;
+    std::vector<RefCntAutoPtr<IBuffer>>  Buffers;
+    for (Uint32 i = 0; i < NumResources; ++i)
+    {
+        for (size_t j = 0; j < TexData.size(); ++j)
+            TexData[j] = static_cast<Uint32>(i * 1000 + j);
+        for (size_t j = 0; j < BuffData.size(); ++j)
+            BuffData[j] = static_cast<Uint32>(i * 2000 + j);
+
+        TextureDesc TexDesc;
+        TexDesc.Name      = "Initial data upload test texture";
+        TexDesc.Type      = RESOURCE_DIM_TEX_2D;
+        TexDesc.Width     = TexSize;
+        TexDesc.Height    = TexSize;
+        TexDesc.Format    = TEX_FORMAT_RGBA8_UNORM;
+        TexDesc.Usage     = USAGE_IMMUTABLE;
+        TexDesc.BindFlags = BIND_SHADER_RESOURCE;
+
+        TextureSubResData SubResData{TexData.data(), TexSize * sizeof(Uint32)};
+        TextureData       InitData{&SubResData, 1};
+
+        RefCntAutoPtr<ITexture> pTexture;
+        pDevice->CreateTexture(TexDesc, &InitData, &pTexture);
+        ASSERT_NE(pTexture, nullptr);
+        Textures.emplace_back(std::move(pTexture));
+
+        BufferDesc BuffDesc;
+        BuffDesc.Name      = "Initial data upload test buffer";
+        BuffDesc.Size      = NumBuffElems * sizeof(Uint32);
+        BuffDesc.Usage     = USAGE_DEFAULT;
+        BuffDesc.BindFlags = BIND_SHADER_RESOURCE;
+        BuffDesc.Mode      = BUFFER_MODE_RAW;
+
+        BufferData BuffInitData{BuffData.data(), BuffDesc.Size};
+
+        RefCntAutoPtr<IBuffer> pBuffer;
+        pDevice->CreateBuffer(BuffDesc, &BuffInitData, &pBuffer);
+        ASSERT_NE(pBuffer, nullptr);
+        Buffers.emplace_back(std::move(pBuffer));
+    }
+
+    {
+        // Nothing must be submitted until the batch is full or flushed
+        InitialDataUploadStatsVk PendingStats;
+        pDeviceVk->GetInitialDataUploadStats(PendingStats);
+        EXPECT_EQ(PendingStats.NumSubmissions, StartStats.NumSubmissions);
+    }
+
+    // Verify the contents of the last buffer. The pending batch is not flushed explicitly:
+    // it must be submitted before the context's command buffer that reads the buffer.
+    BufferDesc StagingDesc;
+    StagingDesc.Name           = "Initial data upload test staging buffer";
+    StagingDesc.Size           = NumBuffElems * sizeof(Uint32);
+    StagingDesc.Usage          = USAGE_STAGING;
+    StagingDesc.CPUAccessFlags = CPU_ACCESS_READ;
+
+    RefCntAutoPtr<IBuffer> pStagingBuffer;
+    pDevice->CreateBuffer(StagingDesc, nullptr, &pStagingBuffer);
+    ASSERT_NE(pStagingBuffer, nullptr);
+
+    pContext->CopyBuffer(Buffers.back(), 0, RESOURCE_STATE_TRANSITION_MODE_TRANSITION,
+                         pStagingBuffer, 0, StagingDesc.Size, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    pContext->WaitForIdle();
+
+    InitialDataUploadStatsVk EndStats;
+    pDeviceVk->GetInitialDataUploadStats(EndStats);
+
+    // Resources may be initialized on the host, in which case the staging memory is not used.
+    // All uploads that do go through the staging memory must be submitted in one batch.
+    const Uint64 NumUploads     = EndStats.NumUploads - StartStats.NumUploads;
+    const Uint64 NumSubmissions = EndStats.NumSubmissions - StartStats.NumSubmissions;
+    EXPECT_LE(NumUploads, Uint64{NumResources * 2});
+    EXPECT_EQ(NumSubmissions, NumUploads > 0 ? 1u : 0u);
+
+    void* pMappedData = nullptr;
+    pContext->MapBuffer(pStagingBuffer, MAP_READ, MAP_FLAG_DO_NOT_WAIT, pMappedData);
+    ASSERT_NE(pMappedData, nullptr);
+    EXPECT_EQ(memcmp(pMappedData, BuffData.data(), StagingDesc.Size), 0);
+    pContext->UnmapBuffer(pStagingBuffer, MAP_READ);
+}
+
+} // namespace
@@ -0,0 +1,197 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+// The testing environment does not use mapped upload memory unless --wgpu_mapped_upload
+// is specified, so these tests create their own device with the mode enabled.
+
+#include <vector>
+#include <cstring>
+
+#include "GPUTestingEnvironment.hpp"
+
+#include "EngineFactoryWebGPU.h"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+class MappedUploadMemoryWebGPU : public ::testing::Test
+{
+protected:
+    // Small pages make every flush use several pages, so that the pages are recycled
+    // and mapped again between flushes.
+    static constexpr Uint32 UploadPageSize      = 16 << 10;
+    static constexpr Uint32 DynamicHeapPageSize = 16 << 10;
+    static constexpr Uint32 DynamicHeapSize     = 256 << 10;
+
+    static void SetUpTestSuite()
+    {
+        GPUTestingEnvironment* pEnv = GPUTestingEnvironment::GetInstance();
+        if (pEnv->GetDevice()->GetDeviceInfo().Type != RENDER_DEVICE_TYPE_WEBGPU)
+            return;
+
+        RefCntAutoPtr<IEngineFactoryWebGPU> pFactory{pEnv->GetDevice()->GetEngineFactory(), IID_EngineFactoryWebGPU};
+        ASSERT_NE(pFactory, nullptr);
+
+        EngineWebGPUCreateInfo EngineCI;
+        EngineCI.UseMappedUploadMemory = True;
+        EngineCI.UploadHeapPageSize    = UploadPageSize;
+        EngineCI.DynamicHeapPageSize   = DynamicHeapPageSize;
+        EngineCI.DynamicHeapSize       = DynamicHeapSize;
+        pFactory->CreateDeviceAndContextsWebGPU(EngineCI, &sm_pDevice, &sm_pContext);
+        ASSERT_NE(sm_pDevice, nullptr);
+        ASSERT_NE(sm_pContext, nullptr);
+    }
+
+    static void TearDownTestSuite()
+    {
+        if (sm_pContext)
+            sm_pContext->WaitForIdle();
+        sm_pContext.Release();
+        sm_pDevice.Release();
+    }
+
+    void SetUp() override
+    {
+#if PLATFORM_WEB
+        GTEST_SKIP() << "Mapped upload memory is not used on the Web";
+#else
+        if (!sm_pDevice)
+            GTEST_SKIP() << "This test requires WebGPU device";
+#endif
+    }
+
+    static RefCntAutoPtr<IBuffer> CreateBuffer(const char* Name, USAGE Usage, BIND_FLAGS BindFlags, CPU_ACCESS_FLAGS CPUAccess, Uint64 Size)
+    {
+        BufferDesc BuffDesc;
+        BuffDesc.Name           = Name;
+        BuffDesc.Size           = Size;
+        BuffDesc.Usage          = Usage;
+        BuffDesc.BindFlags      = BindFlags;
+        BuffDesc.CPUAccessFlags = CPUAccess;
+
+        RefCntAutoPtr<IBuffer> pBuffer;
+        sm_pDevice->CreateBuffer(BuffDesc, nullptr, &pBuffer);
+        return pBuffer;
+    }
+
+    // Copies the buffer to the staging buffer, waits for the GPU and compares the contents with the reference data
+    static void VerifyBuffer(IBuffer* pBuffer, IBuffer* pStagingBuff, const std::vector<Uint32>& RefData)
+    {
+        const Uint64 Size = RefData.size() * sizeof(Uint32);
+        sm_pContext->CopyBuffer(pBuffer, 0, RESOURCE_STATE_TRANSITION_MODE_TRANSITION, pStagingBuff, 0, Size, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+        sm_pContext->WaitForIdle();
+
+        void* pData = nullptr;
+        sm_pContext->MapBuffer(pStagingBuff, MAP_READ, MAP_FLAG_DO_NOT_WAIT, pData);
+        ASSERT_NE(pData, nullptr);
+        EXPECT_EQ(memcmp(pData, RefData.data(), static_cast<size_t>(Size)), 0);
+        sm_pContext->UnmapBuffer(pStagingBuff, MAP_READ);
+    }
+
+    static void FillData(std::vector<Uint32>& Data, Uint32 Seed)
+    {
+        for (size_t i = 0; i < Data.size(); ++i)
+            Data[i] = Seed * 0x01000193u + static_cast<Uint32>(i);
+    }
+
+    static RefCntAutoPtr<IRenderDevice>  sm_pDevice;
+    static RefCntAutoPtr<IDeviceContext> sm_pContext;
+};
+
+RefCntAutoPtr<IRenderDevice>  MappedUploadMemoryWebGPU::sm_pDevice;
+RefCntAutoPtr<IDeviceContext> MappedUploadMemoryWebGPU::sm_pContext;
+
+// Every iteration writes more data than fits into one upload page. Pages used by the previous
+// iteration are recycled after Flush() and must be mapped again before they are reused.
+TEST_F(MappedUploadMemoryWebGPU, UpdateBuffer)
+{
+    constexpr Uint32 NumIterations = 8;
+    constexpr Uint32 NumUpdates    = 4;
+    constexpr size_t NumElements   = UploadPageSize / sizeof(Uint32);
+
+    RefCntAutoPtr<IBuffer> pBuffer = CreateBuffer("Mapped upload memory test buffer", USAGE_DEFAULT, BIND_SHADER_RESOURCE, CPU_ACCESS_NONE, NumUpdates * NumElements * sizeof(Uint32));
+    ASSERT_NE(pBuffer, nullptr);
+    RefCntAutoPtr<IBuffer> pStagingBuff = CreateBuffer("Mapped upload memory test staging buffer", USAGE_STAGING, BIND_NONE, CPU_ACCESS_READ, pBuffer->GetDesc().Size);
+    ASSERT_NE(pStagingBuff, nullptr);
+
+    std::vector<Uint32> RefData(NumUpdates * NumElements);
+    for (Uint32 Iter = 0; Iter < NumIterations; ++Iter)
+    {
+        FillData(RefData, Iter);
+        for (Uint32 i = 0; i < NumUpdates; ++i)
+        {
+            sm_pContext->UpdateBuffer(pBuffer, i * NumElements * sizeof(Uint32), NumElements * sizeof(Uint32), &RefData[i * NumElements], RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+        }
+        sm_pContext->Flush();
+
+        // Check the data on every other iteration only, so that some of the pages are
+        // recycled while the GPU may still be using them.
+        if (Iter % 2 == 1)
+            VerifyBuffer(pBuffer, pStagingBuff, RefData);
+    }
+    VerifyBuffer(pBuffer, pStagingBuff, RefData);
+}
+
+// Dynamic heap pages are backed by the upload pages in mapped mode.
+TEST_F(MappedUploadMemoryWebGPU, DynamicBuffer)
+{
+    constexpr Uint32 NumIterations  = 8;
+    constexpr Uint32 NumMapsPerIter = 4;
+    constexpr size_t NumElements    = DynamicHeapPageSize / sizeof(Uint32) / 2;
+
+    RefCntAutoPtr<IBuffer> pBuffer = CreateBuffer("Mapped upload memory test dynamic buffer", USAGE_DYNAMIC, BIND_UNIFORM_BUFFER, CPU_ACCESS_WRITE, NumElements * sizeof(Uint32));
+    ASSERT_NE(pBuffer, nullptr);
+    RefCntAutoPtr<IBuffer> pStagingBuff = CreateBuffer("Mapped upload memory test staging buffer", USAGE_STAGING, BIND_NONE, CPU_ACCESS_READ, pBuffer->GetDesc().Size);
+    ASSERT_NE(pStagingBuff, nullptr);
+
+    std::vector<Uint32> RefData(NumElements);
+    for (Uint32 Iter = 0; Iter < NumIterations; ++Iter)
+    {
+        // Every map allocates new dynamic memory. Only the last allocation is verified.
+        for (Uint32 i = 0; i < NumMapsPerIter; ++i)
+        {
+            FillData(RefData, Iter * NumMapsPerIter + i);
+
+            void* pData = nullptr;
+            sm_pContext->MapBuffer(pBuffer, MAP_WRITE, MAP_FLAG_DISCARD, pData);
+            ASSERT_NE(pData, nullptr);
+            memcpy(pData, RefData.data(), RefData.size() * sizeof(Uint32));
+            sm_pContext->UnmapBuffer(pBuffer, MAP_WRITE);
+        }
+
+        VerifyBuffer(pBuffer, pStagingBuff, RefData);
+
+        // Release the dynamic memory of this iteration
+        sm_pContext->FinishFrame();
+    }
+}
+
+} // namespace
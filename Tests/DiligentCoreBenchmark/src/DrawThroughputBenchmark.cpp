@@ -0,0 +1,321 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+// Measures the CPU cost of issuing draw commands through the engine.
+// The benchmark runs on the headless null device, so the results do not depend on
+// the GPU or the driver and only reflect the overhead of the engine itself.
+//
+// Usage: DiligentCoreBenchmark [NumDraws]
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "EngineFactoryNull.h"
+#include "RefCntAutoPtr.hpp"
+#include "Timer.hpp"
+#include "BasicMath.hpp"
+
+using namespace Diligent;
+
+namespace
+{
+
+constexpr Uint32 NumPSOs       = 16;
+constexpr Uint32 NumTextures   = 16;
+constexpr Uint32 NumSRBs       = 256;
+constexpr Uint32 DrawsPerFrame = 1000;
+
+struct DrawConstants
+{
+    float4x4 WorldViewProj;
+    float4   Color;
+};
+
+class DrawThroughputBenchmark
+{
+public:
+    DrawThroughputBenchmark()
+    {
+        IEngineFactoryNull* pFactory = LoadAndGetEngineFactoryNull();
+        if (pFactory == nullptr)
+            return;
+
+        EngineCreateInfo EngineCI;
+        pFactory->CreateDeviceAndContextsNull(EngineCI, &m_pDevice, &m_pContext);
+        if (!m_pDevice || !m_pContext)
+            return;
+
+        CreateResources();
+    }
+
+    bool IsInitialized() const
+    {
+        return m_pDevice && m_pContext && !m_PSOs.empty() && !m_SRBs.empty();
+    }
+
+    struct Scenario
+    {
+        const char* Name;
+        bool        SwitchPSO;
+        bool        SwitchSRB;
+        bool        MapBuffer;
+    };
+
+    // Returns the number of draws per second
+    double Run(const Scenario& Scn, Uint32 NumDraws)
+    {
+        // Warm up
+        RunDraws(Scn, std::min(NumDraws, DrawsPerFrame));
+
+        Timer  T;
+        Uint32 DrawsLeft = NumDraws;
+        while (DrawsLeft > 0)
+        {
+            const Uint32 NumFrameDraws = std::min(DrawsLeft, DrawsPerFrame);
+            RunDraws(Scn, NumFrameDraws);
+            DrawsLeft -= NumFrameDraws;
+        }
+        const double ElapsedTime = T.GetElapsedTime();
+        return ElapsedTime > 0 ? static_cast<double>(NumDraws) / ElapsedTime : 0;
+    }
+
+private:
+    void CreateResources()
+    {
+        TextureDesc RTDesc;
+        RTDesc.Name      = "Benchmark render target";
+        RTDesc.Type      = RESOURCE_DIM_TEX_2D;
+        RTDesc.Width     = 256;
+        RTDesc.Height    = 256;
+        RTDesc.Format    = TEX_FORMAT_RGBA8_UNORM;
+        RTDesc.BindFlags = BIND_RENDER_TARGET;
+        m_pDevice->CreateTexture(RTDesc, nullptr, &m_pRenderTarget);
+        if (!m_pRenderTarget)
+            return;
+
+        TextureDesc TexDesc;
+        TexDesc.Name      = "Benchmark texture";
+        TexDesc.Type      = RESOURCE_DIM_TEX_2D;
+        TexDesc.Width     = 64;
+        TexDesc.Height    = 64;
+        TexDesc.Format    = TEX_FORMAT_RGBA8_UNORM;
+        TexDesc.BindFlags = BIND_SHADER_RESOURCE;
+        TexDesc.Usage     = USAGE_DEFAULT;
+        for (Uint32 i = 0; i < NumTextures; ++i)
+        {
+            RefCntAutoPtr<ITexture> pTex;
+            m_pDevice->CreateTexture(TexDesc, nullptr, &pTex);
+            if (!pTex)
+                return;
+            m_Textures.emplace_back(std::move(pTex));
+        }
+
+        BufferDesc CBDesc;
+        CBDesc.Name           = "Benchmark constants";
+        CBDesc.Size           = sizeof(DrawConstants);
+        CBDesc.Usage          = USAGE_DYNAMIC;
+        CBDesc.BindFlags      = BIND_UNIFORM_BUFFER;
+        CBDesc.CPUAccessFlags = CPU_ACCESS_WRITE;
+        m_pDevice->CreateBuffer(CBDesc, nullptr, &m_pConstants);
+        if (!m_pConstants)
+            return;
+
+        const SamplerDesc LinearClampSampler{
+            FILTER_TYPE_LINEAR, FILTER_TYPE_LINEAR, FILTER_TYPE_LINEAR,
+            TEXTURE_ADDRESS_CLAMP, TEXTURE_ADDRESS_CLAMP, TEXTURE_ADDRESS_CLAMP //
+        };
+
+        // The null backend does not reflect shaders, so the resources are defined by an explicit signature
+        const PipelineResourceDesc Resources[] = {
+            {SHADER_TYPE_VS_PS, "cbConstants", 1, SHADER_RESOURCE_TYPE_CONSTANT_BUFFER, SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE},
+            {SHADER_TYPE_PIXEL, "g_Texture", 1, SHADER_RESOURCE_TYPE_TEXTURE_SRV, SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE},
+        };
+        const ImmutableSamplerDesc ImtblSamplers[] = {
+            {SHADER_TYPE_PIXEL, "g_Texture", LinearClampSampler},
+        };
+
+        PipelineResourceSignatureDesc SignDesc;
+        SignDesc.Name                       = "Benchmark signature";
+        SignDesc.Resources                  = Resources;
+        SignDesc.NumResources               = _countof(Resources);
+        SignDesc.ImmutableSamplers          = ImtblSamplers;
+        SignDesc.NumImmutableSamplers       = _countof(ImtblSamplers);
+        SignDesc.UseCombinedTextureSamplers = true;
+        m_pDevice->CreatePipelineResourceSignature(SignDesc, &m_pSignature);
+        if (!m_pSignature)
+            return;
+
+        ShaderCreateInfo ShaderCI;
+        ShaderCI.SourceLanguage = SHADER_SOURCE_LANGUAGE_HLSL;
+        ShaderCI.EntryPoint     = "main";
+        ShaderCI.Source         = "void main() {}";
+
+        RefCntAutoPtr<IShader> pVS;
+        ShaderCI.Desc = {"Benchmark VS", SHADER_TYPE_VERTEX, true};
+        m_pDevice->CreateShader(ShaderCI, &pVS);
+
+        RefCntAutoPtr<IShader> pPS;
+        ShaderCI.Desc = {"Benchmark PS", SHADER_TYPE_PIXEL, true};
+        m_pDevice->CreateShader(ShaderCI, &pPS);
+        if (!pVS || !pPS)
+            return;
+
+        IPipelineResourceSignature* ppSignatures[] = {m_pSignature};
+
+        GraphicsPipelineStateCreateInfo PsoCI;
+        PsoCI.PSODesc.Name                                  = "Benchmark PSO";
+        PsoCI.pVS                                           = pVS;
+        PsoCI.pPS                                           = pPS;
+        PsoCI.ppResourceSignatures                          = ppSignatures;
+        PsoCI.ResourceSignaturesCount                       = _countof(ppSignatures);
+        PsoCI.GraphicsPipeline.NumRenderTargets             = 1;
+        PsoCI.GraphicsPipeline.RTVFormats[0]                = RTDesc.Format;
+        PsoCI.GraphicsPipeline.PrimitiveTopology            = PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+        PsoCI.GraphicsPipeline.DepthStencilDesc.DepthEnable = false;
+        for (Uint32 i = 0; i < NumPSOs; ++i)
+        {
+            // Make every pipeline state unique
+            PsoCI.GraphicsPipeline.RasterizerDesc.CullMode              = (i & 0x01) ? CULL_MODE_BACK : CULL_MODE_NONE;
+            PsoCI.GraphicsPipeline.RasterizerDesc.FrontCounterClockwise = (i & 0x02) != 0;
+            PsoCI.GraphicsPipeline.RasterizerDesc.DepthBias             = static_cast<Int32>(i >> 3);
+
+            PsoCI.GraphicsPipeline.BlendDesc.RenderTargets[0].BlendEnable = (i & 0x04) != 0;
+
+            RefCntAutoPtr<IPipelineState> pPSO;
+            m_pDevice->CreateGraphicsPipelineState(PsoCI, &pPSO);
+            if (!pPSO)
+                return;
+            m_PSOs.emplace_back(std::move(pPSO));
+        }
+
+        for (Uint32 i = 0; i < NumSRBs; ++i)
+        {
+            RefCntAutoPtr<IShaderResourceBinding> pSRB;
+            m_pSignature->CreateShaderResourceBinding(&pSRB, true);
+            if (!pSRB)
+                return;
+            pSRB->GetVariableByName(SHADER_TYPE_VERTEX, "cbConstants")->Set(m_pConstants);
+            pSRB->GetVariableByName(SHADER_TYPE_PIXEL, "g_Texture")->Set(m_Textures[i % NumTextures]->GetDefaultView(TEXTURE_VIEW_SHADER_RESOURCE));
+            m_SRBs.emplace_back(std::move(pSRB));
+        }
+    }
+
+    void RunDraws(const Scenario& Scn, Uint32 NumDraws)
+    {
+        ITextureView* pRTV = m_pRenderTarget->GetDefaultView(TEXTURE_VIEW_RENDER_TARGET);
+        m_pContext->SetRenderTargets(1, &pRTV, nullptr, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+        m_pContext->SetPipelineState(m_PSOs[0]);
+        m_pContext->CommitShaderResources(m_SRBs[0], RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+
+        // Resources have been transitioned to the required states above, so draw calls only need to verify them
+        const DrawAttribs DrawAttrs{3, DRAW_FLAG_VERIFY_ALL};
+        for (Uint32 i = 0; i < NumDraws; ++i)
+        {
+            if (Scn.SwitchPSO)
+                m_pContext->SetPipelineState(m_PSOs[i % NumPSOs]);
+
+            if (Scn.SwitchSRB)
+                m_pContext->CommitShaderResources(m_SRBs[i % NumSRBs], RESOURCE_STATE_TRANSITION_MODE_VERIFY);
+
+            if (Scn.MapBuffer)
+            {
+                void* pData = nullptr;
+                m_pContext->MapBuffer(m_pConstants, MAP_WRITE, MAP_FLAG_DISCARD, pData);
+                if (pData != nullptr)
+                {
+                    DrawConstants& Constants = *static_cast<DrawConstants*>(pData);
+                    Constants.WorldViewProj  = float4x4::Translation(static_cast<float>(i), 0, 0);
+                    Constants.Color          = float4{1, 1, 1, 1};
+                }
+                m_pContext->UnmapBuffer(m_pConstants, MAP_WRITE);
+            }
+
+            m_pContext->Draw(DrawAttrs);
+        }
+
+        m_pContext->Flush();
+        m_pContext->FinishFrame();
+    }
+
+private:
+    RefCntAutoPtr<IRenderDevice>  m_pDevice;
+    RefCntAutoPtr<IDeviceContext> m_pContext;
+
+    RefCntAutoPtr<ITexture>                    m_pRenderTarget;
+    std::vector<RefCntAutoPtr<ITexture>>       m_Textures;
+    RefCntAutoPtr<IBuffer>                     m_pConstants;
+    RefCntAutoPtr<IPipelineResourceSignature>  m_pSignature;
+    std::vector<RefCntAutoPtr<IPipelineState>> m_PSOs;
+
+    std::vector<RefCntAutoPtr<IShaderResourceBinding>> m_SRBs;
+};
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    Uint32 NumDraws = 1000000;
+    if (argc > 1)
+    {
+        NumDraws = static_cast<Uint32>(std::strtoul(argv[1], nullptr, 10));
+        if (NumDraws == 0)
+        {
+            std::printf("Usage: %s [NumDraws]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    DrawThroughputBenchmark Benchmark;
+    if (!Benchmark.IsInitialized())
+    {
+        std::printf("Failed to initialize the benchmark\n");
+        return 1;
+    }
+
+    const DrawThroughputBenchmark::Scenario Scenarios[] = {
+        // clang-format off
+        {"Draw only",              false, false, false},
+        {"SRB churn",              false, true,  false},
+        {"PSO switch",             true,  false, false},
+        {"Dynamic buffer map",     false, false, true },
+        {"PSO + SRB + buffer map", true,  true,  true },
+        // clang-format on
+    };
+
+    std::printf("Null device draw throughput, %u draws per scenario\n\n", NumDraws);
+    std::printf("%-24s %16s %12s\n", "Scenario", "Draws/sec", "ns/draw");
+    for (const DrawThroughputBenchmark::Scenario& Scn : Scenarios)
+    {
+        const double DrawsPerSec = Benchmark.Run(Scn, NumDraws);
+        std::printf("%-24s %16.0f %12.1f\n", Scn.Name, DrawsPerSec, DrawsPerSec > 0 ? 1e9 / DrawsPerSec : 0.0);
+    }
+
+    return 0;
+}
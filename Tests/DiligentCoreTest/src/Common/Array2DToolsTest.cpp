@@ -1,5 +1,5 @@
 /*
- *  Copyright 2019-2022 Diligent Graphics LLC
+ *  Copyright 2019-2025 Diligent Graphics LLC
  *
  *  Licensed under the Apache License, Version 2.0 (the "License");
  *  you may not use this file except in compliance with the License.
@@ -27,10 +27,14 @@
 #include "Array2DTools.hpp"
 
 #include <algorithm>
+#include <cmath>
+#include <vector>
 
 #include "gtest/gtest.h"
 
 #include "FastRand.hpp"
+#include "Float16.hpp"
+#include "ThreadPool.hpp"
 
 using namespace Diligent;
 
@@ -111,4 +115,119 @@ TEST(Common_Array2DTools, GetArray2DMinMaxValue)
     }
 }
 
+template <typename T>
+void TestGetArray2DMinMaxValue(const T* pData, size_t Stride, Uint32 Width, Uint32 Height, IThreadPool* pThreadPool = nullptr)
+{
+    // Compare values as floats so that the test does not depend on the Float16 representation
+    auto ToFloat = [](const T& Val) { return static_cast<float>(Val); };
+
+    float RefMin = ToFloat(pData[0]);
+    float RefMax = ToFloat(pData[0]);
+    for (size_t row = 0; row < Height; ++row)
+    {
+        for (size_t col = 0; col < Width; ++col)
+        {
+            const float Val = ToFloat(pData[col + row * Stride]);
+            RefMin          = std::min(Val, RefMin);
+            RefMax          = std::max(Val, RefMax);
+        }
+    }
+
+    T Min{}, Max{};
+    GetArray2DMinMaxValue(pData, Stride, Width, Height, Min, Max, pThreadPool);
+    EXPECT_EQ(ToFloat(Min), RefMin) << "Width: " << Width << " Height: " << Height << " Stride: " << Stride;
+    EXPECT_EQ(ToFloat(Max), RefMax) << "Width: " << Width << " Height: " << Height << " Stride: " << Stride;
+}
+
+template <typename T, typename GeneratorType>
+void TestGetArray2DMinMaxValueType(GeneratorType&& Generate, T LowValue, T HighValue)
+{
+    FastRandInt Rnd{0, 0, 1 << 14};
+
+    // Test min/max at different positions
+    for (Uint32 Width = 1; Width <= 40; ++Width)
+    {
+        std::vector<T> Data(Width);
+        for (size_t test = 0; test < Data.size(); ++test)
+        {
+            for (size_t i = 0; i < Data.size(); ++i)
+                Data[i] = Generate();
+            Data[test] = LowValue;
+            Data[(test * 7 + 3) % Data.size()] = HighValue;
+
+            TestGetArray2DMinMaxValue(Data.data(), Width, Width, 1);
+        }
+    }
+
+    for (Uint32 test = 0; test < 128; ++test)
+    {
+        const Uint32 Width  = 1 + (test % 40);
+        const Uint32 Height = 1 + (test / 4);
+        const size_t Stride = Width + test / 10;
+
+        std::vector<T> Data(Stride * size_t{Height});
+        for (auto& Val : Data)
+            Val = Generate();
+        Data[Rnd() % Data.size()] = LowValue;
+        Data[Rnd() % Data.size()] = HighValue;
+        TestGetArray2DMinMaxValue(Data.data(), Stride, Width, Height);
+    }
+}
+
+TEST(Common_Array2DTools, GetArray2DMinMaxValueUint16)
+{
+    FastRandInt Rnd{0, 0, 32766};
+    TestGetArray2DMinMaxValueType<Uint16>([&]() { return static_cast<Uint16>(Rnd() * 2 + 1); }, Uint16{0}, Uint16{65535});
+    TestGetArray2DMinMaxValueType<Uint16>([&]() { return static_cast<Uint16>(Rnd() + 16384); }, Uint16{100}, Uint16{60000});
+}
+
+TEST(Common_Array2DTools, GetArray2DMinMaxValueInt32)
+{
+    FastRandInt Rnd{0, -16383, +16383};
+    TestGetArray2DMinMaxValueType<Int32>([&]() { return static_cast<Int32>(Rnd()) * 1000; }, Int32{-2147483647 - 1}, Int32{2147483647});
+    TestGetArray2DMinMaxValueType<Int32>([&]() { return static_cast<Int32>(Rnd()); }, Int32{-16384}, Int32{16384});
+}
+
+TEST(Common_Array2DTools, GetArray2DMinMaxValueFloat16)
+{
+    FastRandFloat Rnd{0, -100, +100};
+    TestGetArray2DMinMaxValueType<Float16>([&]() { return Float16{Rnd()}; }, Float16{-1000.f}, Float16{1000.f});
+    TestGetArray2DMinMaxValueType<Float16>([&]() { return Float16{std::abs(Rnd()) + 1.f}; }, Float16{0.5f}, Float16{65504.f});
+    TestGetArray2DMinMaxValueType<Float16>([&]() { return Float16{-std::abs(Rnd()) - 1.f}; }, Float16{-65504.f}, Float16{-0.5f});
+}
+
+TEST(Common_Array2DTools, GetArray2DMinMaxValueParallel)
+{
+    RefCntAutoPtr<IThreadPool> pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{4});
+    ASSERT_NE(pThreadPool, nullptr);
+
+    FastRandFloat Rnd{0, -100, +100};
+    FastRandInt   RndPos{1, 0, 1 << 14};
+    for (Uint32 test = 0; test < 8; ++test)
+    {
+        const Uint32 Width  = 1024 + test * 67;
+        const Uint32 Height = 512 + test * 131;
+        const size_t Stride = Width + test;
+
+        std::vector<float>  Data(Stride * size_t{Height});
+        std::vector<Uint16> Data16(Data.size());
+        for (size_t i = 0; i < Data.size(); ++i)
+        {
+            Data[i]   = Rnd();
+            Data16[i] = static_cast<Uint16>(Data[i] * 100.f + 10000.f);
+        }
+
+        // Place the extremes in different tiles
+        const size_t MinPos = (static_cast<size_t>(RndPos()) * 4099) % Data.size();
+        const size_t MaxPos = (static_cast<size_t>(RndPos()) * 8191) % Data.size();
+        Data[MinPos]        = -1000.f;
+        Data[MaxPos]        = +1000.f;
+        Data16[MinPos]      = 5;
+        Data16[MaxPos]      = 60000;
+
+        TestGetArray2DMinMaxValue(Data.data(), Stride, Width, Height, pThreadPool);
+        TestGetArray2DMinMaxValue(Data16.data(), Stride, Width, Height, pThreadPool);
+    }
+}
+
 } // namespace
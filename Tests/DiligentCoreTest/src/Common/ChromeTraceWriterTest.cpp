@@ -0,0 +1,105 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "ChromeTraceWriter.hpp"
+
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+TEST(Common_ChromeTraceWriter, Format)
+{
+    ChromeTraceWriter Writer;
+    Writer.AddProcessName(ChromeTraceWriter::CPUProcessId, "CPU");
+    Writer.AddThreadName(ChromeTraceWriter::CPUProcessId, 3, "Worker");
+    Writer.AddCompleteEvent("Zone", "Category", ChromeTraceWriter::CPUProcessId, 3, 1234567, 1005);
+    Writer.AddCompleteEvent("GPU zone", nullptr, ChromeTraceWriter::GPUProcessId, 0, 2000, 0);
+
+    const std::string Trace = Writer.Finish();
+    EXPECT_EQ(Trace,
+              "{\"traceEvents\":[\n"
+              "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,\"args\":{\"name\":\"CPU\"}},\n"
+              "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":3,\"args\":{\"name\":\"Worker\"}},\n"
+              "{\"name\":\"Zone\",\"cat\":\"Category\",\"ph\":\"X\",\"pid\":1,\"tid\":3,\"ts\":1234.567,\"dur\":1.005},\n"
+              "{\"name\":\"GPU zone\",\"cat\":\"\",\"ph\":\"X\",\"pid\":2,\"tid\":0,\"ts\":2.000,\"dur\":0.000}\n"
+              "],\"displayTimeUnit\":\"ms\"}\n");
+}
+
+TEST(Common_ChromeTraceWriter, EmptyTrace)
+{
+    ChromeTraceWriter Writer;
+    EXPECT_EQ(Writer.Finish(), "{\"traceEvents\":[\n],\"displayTimeUnit\":\"ms\"}\n");
+}
+
+TEST(Common_ChromeTraceWriter, JSONEscaping)
+{
+    std::string Json;
+    ChromeTraceWriter::AppendJSONString(Json, "Quote\"Backslash\\Tab\tNewLine\nBell\x07");
+    EXPECT_EQ(Json, "\"Quote\\\"Backslash\\\\Tab\\u0009NewLine\\u000aBell\\u0007\"");
+
+    Json.clear();
+    ChromeTraceWriter::AppendJSONString(Json, nullptr);
+    EXPECT_EQ(Json, "\"\"");
+}
+
+TEST(Common_ChromeTraceWriter, Timestamp)
+{
+    const auto Time = std::chrono::steady_clock::now();
+    EXPECT_EQ(ChromeTraceWriter::GetTimestamp(Time + std::chrono::microseconds{5}) - ChromeTraceWriter::GetTimestamp(Time), Uint64{5000});
+    EXPECT_LE(ChromeTraceWriter::GetTimestamp(Time), ChromeTraceWriter::GetTimestamp());
+}
+
+TEST(Common_ChromeTraceWriter, ThreadId)
+{
+    const Uint32 MainThreadId = ChromeTraceWriter::GetThreadId();
+    EXPECT_EQ(ChromeTraceWriter::GetThreadId(), MainThreadId);
+
+    constexpr size_t         NumThreads = 4;
+    std::vector<Uint32>      ThreadIds(NumThreads);
+    std::vector<std::thread> Threads(NumThreads);
+    for (size_t i = 0; i < NumThreads; ++i)
+    {
+        Threads[i] = std::thread{[&ThreadIds, i]() {
+            ThreadIds[i] = ChromeTraceWriter::GetThreadId();
+        }};
+    }
+    for (std::thread& Thread : Threads)
+        Thread.join();
+
+    std::set<Uint32> UniqueIds{ThreadIds.begin(), ThreadIds.end()};
+    UniqueIds.insert(MainThreadId);
+    EXPECT_EQ(UniqueIds.size(), NumThreads + 1);
+}
+
+} // namespace
@@ -0,0 +1,273 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "GeometryPrimitives.h"
+
+#include <algorithm>
+#include <cstring>
+#include <deque>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "RefCntAutoPtr.hpp"
+#include "BasicMath.hpp"
+
+using namespace Diligent;
+
+namespace
+{
+
+// Computes the average cache miss ratio (the number of transformed vertices per triangle)
+// for a FIFO post-transform vertex cache of the given size.
+float ComputeACMR(const std::vector<Uint32>& Indices, size_t CacheSize)
+{
+    std::deque<Uint32> Cache;
+
+    size_t NumMisses = 0;
+    for (Uint32 Idx : Indices)
+    {
+        if (std::find(Cache.begin(), Cache.end(), Idx) != Cache.end())
+            continue;
+
+        ++NumMisses;
+        Cache.push_back(Idx);
+        if (Cache.size() > CacheSize)
+            Cache.pop_front();
+    }
+
+    return static_cast<float>(NumMisses) / static_cast<float>(Indices.size() / 3);
+}
+
+std::vector<Uint32> WriteIndices(const GeometryPrimitiveAttributes& Attribs, GeometryPrimitiveStreamAttribs StreamAttribs)
+{
+    GeometryPrimitiveInfo Info;
+    WriteGeometryPrimitive(Attribs, StreamAttribs, &Info);
+
+    std::vector<Uint32> Indices(Info.NumIndices);
+    StreamAttribs.pIndexData = Indices.data();
+    StreamAttribs.NumIndices = Info.NumIndices;
+    WriteGeometryPrimitive(Attribs, StreamAttribs);
+
+    return Indices;
+}
+
+TEST(Common_GeometryPrimitives, LinearOrderMatchesCreate)
+{
+    const SphereGeometryPrimitiveAttributes Attribs{2.f, GEOMETRY_PRIMITIVE_VERTEX_FLAG_ALL, 7};
+
+    RefCntAutoPtr<IDataBlob> pVertices;
+    RefCntAutoPtr<IDataBlob> pIndices;
+    GeometryPrimitiveInfo    Info;
+    CreateGeometryPrimitive(Attribs, &pVertices, &pIndices, &Info);
+    ASSERT_TRUE(pVertices);
+    ASSERT_TRUE(pIndices);
+
+    GeometryPrimitiveStreamAttribs StreamAttribs;
+    StreamAttribs.IndexOrder = GEOMETRY_PRIMITIVE_INDEX_ORDER_LINEAR;
+
+    std::vector<Uint8>  Vertices(pVertices->GetSize());
+    std::vector<Uint32> Indices(Info.NumIndices);
+    StreamAttribs.pVertexData = Vertices.data();
+    StreamAttribs.NumVertices = Info.NumVertices;
+    StreamAttribs.pIndexData  = Indices.data();
+    StreamAttribs.NumIndices  = Info.NumIndices;
+    WriteGeometryPrimitive(Attribs, StreamAttribs);
+
+    EXPECT_EQ(memcmp(Vertices.data(), pVertices->GetConstDataPtr(), Vertices.size()), 0);
+    EXPECT_EQ(memcmp(Indices.data(), pIndices->GetConstDataPtr(), Indices.size() * sizeof(Uint32)), 0);
+}
+
+TEST(Common_GeometryPrimitives, VertexCacheOrder)
+{
+    for (Uint32 NumSubdivisions : {1u, 5u, 16u, 37u, 64u})
+    {
+        const CubeGeometryPrimitiveAttributes Attribs{1.f, GEOMETRY_PRIMITIVE_VERTEX_FLAG_POSITION, NumSubdivisions};
+
+        GeometryPrimitiveStreamAttribs StreamAttribs;
+        StreamAttribs.IndexOrder             = GEOMETRY_PRIMITIVE_INDEX_ORDER_LINEAR;
+        const std::vector<Uint32> LinearIdx = WriteIndices(Attribs, StreamAttribs);
+
+        StreamAttribs.IndexOrder              = GEOMETRY_PRIMITIVE_INDEX_ORDER_VERTEX_CACHE;
+        StreamAttribs.VertexCacheSize         = 16;
+        const std::vector<Uint32> OptimizedIdx = WriteIndices(Attribs, StreamAttribs);
+        ASSERT_EQ(LinearIdx.size(), OptimizedIdx.size());
+
+        // The optimized index list must contain the same triangles
+        auto SortTriangles = [](const std::vector<Uint32>& Indices) {
+            std::vector<std::array<Uint32, 3>> Tris(Indices.size() / 3);
+            for (size_t i = 0; i < Tris.size(); ++i)
+                Tris[i] = {Indices[i * 3 + 0], Indices[i * 3 + 1], Indices[i * 3 + 2]};
+            std::sort(Tris.begin(), Tris.end());
+            return Tris;
+        };
+        EXPECT_EQ(SortTriangles(LinearIdx), SortTriangles(OptimizedIdx)) << "NumSubdivisions: " << NumSubdivisions;
+
+        const float LinearACMR    = ComputeACMR(LinearIdx, StreamAttribs.VertexCacheSize);
+        const float OptimizedACMR = ComputeACMR(OptimizedIdx, StreamAttribs.VertexCacheSize);
+        EXPECT_LE(OptimizedACMR, LinearACMR) << "NumSubdivisions: " << NumSubdivisions;
+        if (NumSubdivisions >= 16)
+        {
+            // Linear order transforms every vertex twice once a row does not fit into the cache
+            EXPECT_GT(LinearACMR, 0.9f) << "NumSubdivisions: " << NumSubdivisions;
+            EXPECT_LT(OptimizedACMR, 0.65f) << "NumSubdivisions: " << NumSubdivisions;
+        }
+    }
+}
+
+TEST(Common_GeometryPrimitives, VertexCount)
+{
+    for (Uint32 NumSubdivisions : {1u, 2u, 7u, 32u})
+    {
+        GeometryPrimitiveInfo CubeInfo;
+        WriteGeometryPrimitive(CubeGeometryPrimitiveAttributes{1.f, GEOMETRY_PRIMITIVE_VERTEX_FLAG_POSITION, NumSubdivisions}, {}, &CubeInfo);
+        // Cube faces do not share vertices to keep the hard edges
+        EXPECT_EQ(CubeInfo.NumVertices, 6 * (NumSubdivisions + 1) * (NumSubdivisions + 1)) << "NumSubdivisions: " << NumSubdivisions;
+
+        const SphereGeometryPrimitiveAttributes Attribs{1.f, GEOMETRY_PRIMITIVE_VERTEX_FLAG_POSITION, NumSubdivisions};
+
+        RefCntAutoPtr<IDataBlob> pVertices;
+        RefCntAutoPtr<IDataBlob> pIndices;
+        GeometryPrimitiveInfo    Info;
+        CreateGeometryPrimitive(Attribs, &pVertices, &pIndices, &Info);
+        ASSERT_TRUE(pVertices);
+        ASSERT_TRUE(pIndices);
+        // Sphere faces share the vertices on the cube edges
+        EXPECT_EQ(Info.NumVertices, 6 * NumSubdivisions * NumSubdivisions + 2) << "NumSubdivisions: " << NumSubdivisions;
+        EXPECT_EQ(Info.NumIndices, 6 * NumSubdivisions * NumSubdivisions * 6) << "NumSubdivisions: " << NumSubdivisions;
+
+        const float3* Positions = pVertices->GetConstDataPtr<float3>();
+
+        // All sphere vertices must be unique
+        std::vector<std::array<float, 3>> SortedPositions(Info.NumVertices);
+        for (Uint32 v = 0; v < Info.NumVertices; ++v)
+            SortedPositions[v] = {Positions[v].x, Positions[v].y, Positions[v].z};
+        std::sort(SortedPositions.begin(), SortedPositions.end());
+        EXPECT_EQ(std::adjacent_find(SortedPositions.begin(), SortedPositions.end()), SortedPositions.end()) << "NumSubdivisions: " << NumSubdivisions;
+
+        // Every vertex must be referenced
+        std::vector<bool> IsUsed(Info.NumVertices);
+        const Uint32*     Indices = pIndices->GetConstDataPtr<Uint32>();
+        for (Uint32 i = 0; i < Info.NumIndices; ++i)
+        {
+            ASSERT_LT(Indices[i], Info.NumVertices);
+            IsUsed[Indices[i]] = true;
+        }
+        EXPECT_EQ(std::count(IsUsed.begin(), IsUsed.end(), false), 0) << "NumSubdivisions: " << NumSubdivisions;
+
+        // The sphere must be watertight: every directed edge must have exactly one opposite edge
+        std::vector<std::pair<Uint32, Uint32>> Edges;
+        for (Uint32 i = 0; i < Info.NumIndices; i += 3)
+        {
+            for (Uint32 e = 0; e < 3; ++e)
+                Edges.emplace_back(Indices[i + e], Indices[i + (e + 1) % 3]);
+        }
+        std::sort(Edges.begin(), Edges.end());
+        EXPECT_EQ(std::adjacent_find(Edges.begin(), Edges.end()), Edges.end()) << "NumSubdivisions: " << NumSubdivisions;
+        for (const auto& Edge : Edges)
+        {
+            ASSERT_TRUE(std::binary_search(Edges.begin(), Edges.end(), std::make_pair(Edge.second, Edge.first))) << "NumSubdivisions: " << NumSubdivisions;
+        }
+    }
+}
+
+TEST(Common_GeometryPrimitives, Chunks)
+{
+    const SphereGeometryPrimitiveAttributes Attribs{1.f, GEOMETRY_PRIMITIVE_VERTEX_FLAG_POS_NORM, 23};
+
+    GeometryPrimitiveStreamAttribs StreamAttribs;
+    GeometryPrimitiveInfo          Info;
+    WriteGeometryPrimitive(Attribs, StreamAttribs, &Info);
+    ASSERT_GT(Info.NumVertices, 0u);
+    ASSERT_GT(Info.NumIndices, 0u);
+    ASSERT_GT(Info.NumMeshlets, 0u);
+
+    std::vector<Uint8>                    RefVertices(size_t{Info.NumVertices} * Info.VertexSize);
+    std::vector<Uint32>                   RefIndices(Info.NumIndices);
+    std::vector<GeometryPrimitiveMeshlet> RefMeshlets(Info.NumMeshlets);
+    {
+        GeometryPrimitiveStreamAttribs FullAttribs = StreamAttribs;
+        FullAttribs.pVertexData                    = RefVertices.data();
+        FullAttribs.NumVertices                    = Info.NumVertices;
+        FullAttribs.pIndexData                     = RefIndices.data();
+        FullAttribs.NumIndices                     = Info.NumIndices;
+        FullAttribs.BaseVertex                     = 100;
+        FullAttribs.pMeshlets                      = RefMeshlets.data();
+        FullAttribs.NumMeshlets                    = Info.NumMeshlets;
+        WriteGeometryPrimitive(Attribs, FullAttribs);
+    }
+
+    constexpr Uint32 ChunkSize = 97;
+
+    std::vector<Uint8> Vertices(RefVertices.size());
+    for (Uint32 v = 0; v < Info.NumVertices; v += ChunkSize)
+    {
+        GeometryPrimitiveStreamAttribs ChunkAttribs = StreamAttribs;
+        ChunkAttribs.pVertexData                    = &Vertices[size_t{v} * Info.VertexSize];
+        ChunkAttribs.FirstVertex                    = v;
+        ChunkAttribs.NumVertices                    = std::min(ChunkSize, Info.NumVertices - v);
+        WriteGeometryPrimitive(Attribs, ChunkAttribs);
+    }
+    EXPECT_EQ(Vertices, RefVertices);
+
+    std::vector<Uint32> Indices(RefIndices.size());
+    for (Uint32 i = 0; i < Info.NumIndices; i += ChunkSize * 3)
+    {
+        GeometryPrimitiveStreamAttribs ChunkAttribs = StreamAttribs;
+        ChunkAttribs.pIndexData                     = &Indices[i];
+        ChunkAttribs.FirstIndex                     = i;
+        ChunkAttribs.NumIndices                     = std::min(ChunkSize * 3, Info.NumIndices - i);
+        ChunkAttribs.BaseVertex                     = 100;
+        WriteGeometryPrimitive(Attribs, ChunkAttribs);
+    }
+    EXPECT_EQ(Indices, RefIndices);
+
+    // Meshlets must cover all indices in order and respect the limits
+    Uint32 NextIndex = 0;
+    for (const GeometryPrimitiveMeshlet& Meshlet : RefMeshlets)
+    {
+        EXPECT_EQ(Meshlet.FirstIndex, NextIndex);
+        EXPECT_LE(Meshlet.NumVertices, StreamAttribs.MaxMeshletVertices);
+        EXPECT_LE(Meshlet.NumIndices / 3, StreamAttribs.MaxMeshletTriangles);
+        NextIndex += Meshlet.NumIndices;
+
+        std::vector<Uint32> MeshletVerts{RefIndices.begin() + Meshlet.FirstIndex, RefIndices.begin() + Meshlet.FirstIndex + Meshlet.NumIndices};
+        std::sort(MeshletVerts.begin(), MeshletVerts.end());
+        MeshletVerts.erase(std::unique(MeshletVerts.begin(), MeshletVerts.end()), MeshletVerts.end());
+        EXPECT_EQ(MeshletVerts.size(), Meshlet.NumVertices);
+
+        const float3 Center{Meshlet.BoundSphereCenter[0], Meshlet.BoundSphereCenter[1], Meshlet.BoundSphereCenter[2]};
+        for (Uint32 v : MeshletVerts)
+        {
+            float3 Pos;
+            memcpy(&Pos, &RefVertices[size_t{v - 100} * Info.VertexSize], sizeof(Pos));
+            EXPECT_LE(length(Pos - Center), Meshlet.BoundSphereRadius + 1e-5f);
+        }
+    }
+    EXPECT_EQ(NextIndex, Info.NumIndices);
+}
+
+} // namespace
@@ -27,10 +27,14 @@
 #include "ImageTools.h"
 
 #include <cmath>
+#include <random>
+#include <vector>
 
 #include "gtest/gtest.h"
 #include <array>
 
+#include "ThreadPool.hpp"
+
 using namespace Diligent;
 
 namespace
@@ -243,4 +247,201 @@ TEST(Common_ImageTools, ComputeImageDifference)
     }
 }
 
+
+struct TestImage
+{
+    Uint32             Width       = 0;
+    Uint32             Height      = 0;
+    Uint32             NumChannels = 0;
+    Uint32             Stride      = 0;
+    std::vector<Uint8> Data;
+
+    TestImage(Uint32 _Width, Uint32 _Height, Uint32 _NumChannels, Uint32 Padding) :
+        Width{_Width},
+        Height{_Height},
+        NumChannels{_NumChannels},
+        Stride{_Width * _NumChannels + Padding},
+        Data(size_t{Stride} * _Height)
+    {}
+};
+
+// Fills two images with the same layout so that about half of the bytes differ by a random amount
+void CreateTestImages(TestImage& Image1, TestImage& Image2, std::mt19937& Gen)
+{
+    std::uniform_int_distribution<int> ValueDistr{0, 255};
+    std::uniform_int_distribution<int> DiffDistr{-40, 40};
+    for (Uint32 row = 0; row < Image1.Height; ++row)
+    {
+        Uint8* pRow1 = &Image1.Data[size_t{row} * Image1.Stride];
+        Uint8* pRow2 = &Image2.Data[size_t{row} * Image2.Stride];
+        for (Uint32 i = 0; i < Image1.Width * Image1.NumChannels; ++i)
+        {
+            pRow1[i] = static_cast<Uint8>(ValueDistr(Gen));
+            pRow2[i] = (Gen() & 1) != 0 ?
+                static_cast<Uint8>(std::min(std::max(pRow1[i] + DiffDistr(Gen), 0), 255)) :
+                pRow1[i];
+        }
+    }
+}
+
+ImageDiffInfo ComputeReferenceDifference(const TestImage& Image1, const TestImage& Image2, Uint32 Threshold, std::vector<Uint8>& DiffImage)
+{
+    ImageDiffInfo Diff;
+    double        SumDiff   = 0;
+    double        SumDiffSq = 0;
+    DiffImage.resize(size_t{Image1.Width} * Image1.Height * Image1.NumChannels);
+    for (Uint32 row = 0; row < Image1.Height; ++row)
+    {
+        for (Uint32 col = 0; col < Image1.Width; ++col)
+        {
+            Uint32 PixelDiff = 0;
+            for (Uint32 ch = 0; ch < Image1.NumChannels; ++ch)
+            {
+                const Uint32 ChannelDiff = static_cast<Uint32>(std::abs(Image1.Data[row * Image1.Stride + col * Image1.NumChannels + ch] -
+                                                                        Image2.Data[row * Image2.Stride + col * Image2.NumChannels + ch]));
+
+                DiffImage[(row * Image1.Width + col) * Image1.NumChannels + ch] = static_cast<Uint8>(ChannelDiff);
+                PixelDiff                                                        = std::max(PixelDiff, ChannelDiff);
+            }
+
+            if (PixelDiff != 0)
+            {
+                ++Diff.NumDiffPixels;
+                if (PixelDiff > Threshold)
+                    ++Diff.NumDiffPixelsAboveThreshold;
+                Diff.MaxDiff = std::max(Diff.MaxDiff, PixelDiff);
+                SumDiff += PixelDiff;
+                SumDiffSq += PixelDiff * PixelDiff;
+            }
+        }
+    }
+
+    if (Diff.NumDiffPixels > 0)
+    {
+        Diff.AvgDiff = static_cast<float>(SumDiff / Diff.NumDiffPixels);
+        Diff.RmsDiff = static_cast<float>(std::sqrt(SumDiffSq / Diff.NumDiffPixels));
+    }
+    return Diff;
+}
+
+ComputeImageDifferenceAttribs GetDiffAttribs(const TestImage& Image1, const TestImage& Image2, Uint32 Threshold)
+{
+    ComputeImageDifferenceAttribs Attribs;
+    Attribs.Width        = Image1.Width;
+    Attribs.Height       = Image1.Height;
+    Attribs.pImage1      = Image1.Data.data();
+    Attribs.NumChannels1 = Image1.NumChannels;
+    Attribs.Stride1      = Image1.Stride;
+    Attribs.pImage2      = Image2.Data.data();
+    Attribs.NumChannels2 = Image2.NumChannels;
+    Attribs.Stride2      = Image2.Stride;
+    Attribs.Threshold    = Threshold;
+    return Attribs;
+}
+
+TEST(Common_ImageTools, ComputeImageDifferenceSIMD)
+{
+    std::mt19937 Gen{0};
+    for (Uint32 NumChannels : {3u, 4u})
+    {
+        // Cover rows that are shorter than a SIMD block and rows with various tails
+        for (Uint32 Width : {1u, 3u, 5u, 6u, 10u, 11u, 16u, 17u, 33u, 100u, 257u})
+        {
+            for (Uint32 Threshold : {0u, 20u, 255u})
+            {
+                TestImage Image1{Width, 7, NumChannels, 3};
+                TestImage Image2{Width, 7, NumChannels, 5};
+                CreateTestImages(Image1, Image2, Gen);
+
+                std::vector<Uint8>  RefDiffImage;
+                const ImageDiffInfo RefDiff = ComputeReferenceDifference(Image1, Image2, Threshold, RefDiffImage);
+
+                std::vector<Uint8> DiffImage(RefDiffImage.size());
+
+                ComputeImageDifferenceAttribs Attribs = GetDiffAttribs(Image1, Image2, Threshold);
+                Attribs.pDiffImage                    = DiffImage.data();
+                Attribs.DiffStride                    = Width * NumChannels;
+
+                ImageDiffInfo Diff;
+                ComputeImageDifference(Attribs, Diff);
+                EXPECT_EQ(Diff.NumDiffPixels, RefDiff.NumDiffPixels) << NumChannels << " " << Width;
+                EXPECT_EQ(Diff.NumDiffPixelsAboveThreshold, RefDiff.NumDiffPixelsAboveThreshold) << NumChannels << " " << Width;
+                EXPECT_EQ(Diff.MaxDiff, RefDiff.MaxDiff) << NumChannels << " " << Width;
+                EXPECT_FLOAT_EQ(Diff.AvgDiff, RefDiff.AvgDiff) << NumChannels << " " << Width;
+                EXPECT_FLOAT_EQ(Diff.RmsDiff, RefDiff.RmsDiff) << NumChannels << " " << Width;
+                EXPECT_EQ(DiffImage, RefDiffImage) << NumChannels << " " << Width;
+            }
+        }
+    }
+}
+
+TEST(Common_ImageTools, ComputeImageDifferenceParallel)
+{
+    RefCntAutoPtr<IThreadPool> pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{4});
+    ASSERT_NE(pThreadPool, nullptr);
+
+    std::mt19937 Gen{1};
+    for (Uint32 NumChannels : {2u, 3u, 4u})
+    {
+        TestImage Image1{517, 301, NumChannels, 1};
+        TestImage Image2{517, 301, NumChannels, 0};
+        CreateTestImages(Image1, Image2, Gen);
+
+        ComputeImageDifferenceAttribs Attribs = GetDiffAttribs(Image1, Image2, 10);
+
+        std::vector<Uint8> RefDiffImage(size_t{Image1.Width} * Image1.Height * NumChannels);
+        Attribs.pDiffImage = RefDiffImage.data();
+        Attribs.DiffStride = Image1.Width * NumChannels;
+
+        ImageDiffInfo RefDiff;
+        ComputeImageDifference(Attribs, RefDiff);
+
+        std::vector<Uint8> DiffImage(RefDiffImage.size());
+        Attribs.pDiffImage  = DiffImage.data();
+        Attribs.pThreadPool = pThreadPool;
+
+        ImageDiffInfo Diff;
+        ComputeImageDifference(Attribs, Diff);
+        // The results must be identical to the serial version
+        EXPECT_EQ(Diff.NumDiffPixels, RefDiff.NumDiffPixels);
+        EXPECT_EQ(Diff.NumDiffPixelsAboveThreshold, RefDiff.NumDiffPixelsAboveThreshold);
+        EXPECT_EQ(Diff.MaxDiff, RefDiff.MaxDiff);
+        EXPECT_EQ(Diff.AvgDiff, RefDiff.AvgDiff);
+        EXPECT_EQ(Diff.RmsDiff, RefDiff.RmsDiff);
+        EXPECT_EQ(DiffImage, RefDiffImage);
+    }
+}
+
+TEST(Common_ImageTools, ComputeImageDifferenceEarlyExit)
+{
+    RefCntAutoPtr<IThreadPool> pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{4});
+    ASSERT_NE(pThreadPool, nullptr);
+
+    // Every pixel differs by 100
+    TestImage Image1{256, 256, 4, 0};
+    TestImage Image2{256, 256, 4, 0};
+    std::fill(Image2.Data.begin(), Image2.Data.end(), Uint8{100});
+
+    constexpr Uint32 NumPixels = 256 * 256;
+
+    for (IThreadPool* pPool : {static_cast<IThreadPool*>(nullptr), pThreadPool.RawPtr()})
+    {
+        ComputeImageDifferenceAttribs Attribs = GetDiffAttribs(Image1, Image2, 50);
+        Attribs.pThreadPool                   = pPool;
+        Attribs.MaxDiffPixelsAboveThreshold   = 1000;
+
+        ImageDiffInfo Diff;
+        ComputeImageDifference(Attribs, Diff);
+        EXPECT_GT(Diff.NumDiffPixelsAboveThreshold, 1000u);
+        EXPECT_LT(Diff.NumDiffPixelsAboveThreshold, NumPixels);
+        EXPECT_EQ(Diff.MaxDiff, 100u);
+
+        // The budget is not exceeded
+        Attribs.MaxDiffPixelsAboveThreshold = NumPixels;
+        ComputeImageDifference(Attribs, Diff);
+        EXPECT_EQ(Diff.NumDiffPixels, NumPixels);
+        EXPECT_EQ(Diff.NumDiffPixelsAboveThreshold, NumPixels);
+    }
+}
+
 } // namespace
@@ -0,0 +1,94 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "MRUCache.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+TEST(Common_MRUCache, FindAdd)
+{
+    MRUCache<int, int, 3> Cache;
+    EXPECT_EQ(Cache.Find(1, 0), nullptr);
+
+    Cache.Add(1, 10, 0);
+    Cache.Add(2, 20, 0);
+    Cache.Add(3, 30, 0);
+    EXPECT_EQ(Cache.GetNumEntries(), size_t{3});
+
+    for (int i = 1; i <= 3; ++i)
+    {
+        const int* pData = Cache.Find(i, 0);
+        ASSERT_NE(pData, nullptr);
+        EXPECT_EQ(*pData, i * 10);
+    }
+
+    // 1 is the least recently used entry
+    Cache.Add(4, 40, 0);
+    EXPECT_EQ(Cache.GetNumEntries(), size_t{3});
+    EXPECT_EQ(Cache.Find(1, 0), nullptr);
+    ASSERT_NE(Cache.Find(4, 0), nullptr);
+    EXPECT_EQ(*Cache.Find(4, 0), 40);
+
+    // Use 2 so that 3 becomes the least recently used entry
+    ASSERT_NE(Cache.Find(2, 0), nullptr);
+    Cache.Add(5, 50, 0);
+    EXPECT_EQ(Cache.Find(3, 0), nullptr);
+    EXPECT_NE(Cache.Find(2, 0), nullptr);
+    EXPECT_NE(Cache.Find(4, 0), nullptr);
+    EXPECT_NE(Cache.Find(5, 0), nullptr);
+}
+
+TEST(Common_MRUCache, Generation)
+{
+    MRUCache<int, int> Cache;
+
+    Cache.Add(1, 10, 0);
+    Cache.Add(2, 20, 0);
+    EXPECT_NE(Cache.Find(1, 0), nullptr);
+
+    // New generation invalidates all entries
+    EXPECT_EQ(Cache.Find(1, 1), nullptr);
+    EXPECT_EQ(Cache.GetNumEntries(), size_t{0});
+    EXPECT_EQ(Cache.Find(2, 1), nullptr);
+
+    Cache.Add(1, 11, 1);
+    ASSERT_NE(Cache.Find(1, 1), nullptr);
+    EXPECT_EQ(*Cache.Find(1, 1), 11);
+
+    // Data retrieved with a stale generation replaces the cache contents,
+    // and is discarded by the next lookup with the current generation.
+    Cache.Add(2, 20, 0);
+    EXPECT_EQ(Cache.GetNumEntries(), size_t{1});
+    EXPECT_EQ(Cache.Find(2, 1), nullptr);
+    EXPECT_EQ(Cache.Find(1, 1), nullptr);
+}
+
+} // namespace
@@ -172,4 +172,82 @@ TEST(SerializerTest, SerializerTest)
     }
 }
 
+TEST(SerializerTest, ZeroCopyArrays)
+{
+    const Uint32 RefArraySize           = 4;
+    const Uint32 RefArray[RefArraySize] = {0x1251, 0x620, 0x8816, 0x7312};
+    const Uint8  RefU8                  = 0x72;
+
+    auto& RawAllocator{DefaultRawMemoryAllocator::GetAllocator()};
+
+    DynamicLinearAllocator TmpAllocator{RawAllocator};
+    const auto             WriteData = [&](auto& Ser) {
+        // Count (4 bytes) + elements: array data is 4-byte aligned
+        const Uint32* pArray = RefArray;
+        EXPECT_TRUE(Ser.SerializeArrayRaw(&TmpAllocator, pArray, RefArraySize));
+        EXPECT_TRUE(Ser(RefU8));
+        // Count at offset 21, elements at offset 25: array data is not aligned
+        EXPECT_TRUE(Ser.SerializeArrayRaw(&TmpAllocator, pArray, RefArraySize));
+    };
+
+    Serializer<SerializerMode::Measure> MSer;
+    WriteData(MSer);
+
+    auto Data = MSer.AllocateData(RawAllocator);
+    {
+        Serializer<SerializerMode::Write> WSer{Data};
+        WriteData(WSer);
+        EXPECT_TRUE(WSer.IsEnded());
+    }
+
+    const auto IsInData = [&Data](const void* Ptr) {
+        return Ptr >= Data.Ptr() && Ptr < Data.Ptr<const Uint8>() + Data.Size();
+    };
+
+    for (SerializerArrayReadMode ReadMode : {SerializerArrayReadMode::Copy, SerializerArrayReadMode::ZeroCopy})
+    {
+        Serializer<SerializerMode::Read> RSer{Data, ReadMode};
+
+        {
+            Uint32        ArraySize = 0;
+            const Uint32* pArray    = nullptr;
+            EXPECT_TRUE(RSer.SerializeArrayRaw(&TmpAllocator, pArray, ArraySize));
+            ASSERT_EQ(ArraySize, RefArraySize);
+            for (Uint32 i = 0; i < RefArraySize; ++i)
+                EXPECT_EQ(RefArray[i], pArray[i]);
+            EXPECT_EQ(IsInData(pArray), ReadMode == SerializerArrayReadMode::ZeroCopy);
+        }
+
+        {
+            Uint8 U8 = 0;
+            EXPECT_TRUE(RSer(U8));
+            EXPECT_EQ(U8, RefU8);
+        }
+
+        {
+            // Misaligned array data must be copied
+            Uint32        ArraySize = 0;
+            const Uint32* pArray    = nullptr;
+            EXPECT_TRUE(RSer.SerializeArrayRaw(&TmpAllocator, pArray, ArraySize));
+            ASSERT_EQ(ArraySize, RefArraySize);
+            for (Uint32 i = 0; i < RefArraySize; ++i)
+                EXPECT_EQ(RefArray[i], pArray[i]);
+            EXPECT_FALSE(IsInData(pArray));
+        }
+
+        EXPECT_TRUE(RSer.IsEnded());
+    }
+
+    {
+        // Non-const arrays are always copied
+        Serializer<SerializerMode::Read> RSer{Data, SerializerArrayReadMode::ZeroCopy};
+
+        Uint32  ArraySize = 0;
+        Uint32* pArray    = nullptr;
+        EXPECT_TRUE(RSer.SerializeArrayRaw(&TmpAllocator, pArray, ArraySize));
+        ASSERT_EQ(ArraySize, RefArraySize);
+        EXPECT_FALSE(IsInData(pArray));
+    }
+}
+
 } // namespace
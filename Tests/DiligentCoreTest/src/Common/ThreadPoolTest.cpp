@@ -65,6 +65,7 @@ TEST(Common_ThreadPool, EnqueueTask)
 
     auto pThreadPool = CreateThreadPool(PoolCI);
     ASSERT_NE(pThreadPool, nullptr);
+    EXPECT_EQ(pThreadPool->GetThreadCount(), NumThreads);
 
     std::array<std::atomic<float>, NumTasks>        Results{};
     std::array<std::atomic<bool>, NumTasks>         WorkComplete{};
@@ -975,4 +976,49 @@ TEST(Common_ThreadPool, ReRunTasks)
         EXPECT_EQ(ReRunCounters[i], 0) << i;
 }
 
+TEST(Common_ThreadPool, ParallelFor)
+{
+    auto pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{4});
+    ASSERT_NE(pThreadPool, nullptr);
+
+    constexpr size_t              NumItems = 1000;
+    std::vector<std::atomic<int>> Counters(NumItems);
+
+    ParallelFor(pThreadPool, NumItems, [&Counters](size_t i) { Counters[i].fetch_add(1); });
+    for (size_t i = 0; i < NumItems; ++i)
+        EXPECT_EQ(Counters[i], 1) << i;
+
+    ParallelFor(nullptr, NumItems, [&Counters](size_t i) { Counters[i].fetch_add(1); });
+    for (size_t i = 0; i < NumItems; ++i)
+        EXPECT_EQ(Counters[i], 2) << i;
+
+    ParallelFor(pThreadPool, 0, [](size_t i) { ADD_FAILURE() << "No items must be processed"; });
+
+    pThreadPool->WaitForAllTasks();
+}
+
+TEST(Common_ThreadPool, ParallelForFromPoolThread)
+{
+    // The only worker thread runs the task that calls ParallelFor, so the
+    // calling thread must process all items without waiting for the queued tasks.
+    auto pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{1});
+    ASSERT_NE(pThreadPool, nullptr);
+
+    constexpr size_t    NumItems = 64;
+    std::atomic<size_t> NumProcessed{0};
+
+    RefCntAutoPtr<IAsyncTask> pTask = EnqueueAsyncWork(
+        pThreadPool,
+        [&](Uint32 ThreadId) //
+        {
+            ParallelFor(pThreadPool, NumItems, [&NumProcessed](size_t i) { NumProcessed.fetch_add(1); });
+            return ASYNC_TASK_STATUS_COMPLETE;
+        });
+
+    pTask->WaitForCompletion();
+    EXPECT_EQ(NumProcessed, NumItems);
+
+    pThreadPool->WaitForAllTasks();
+}
+
 } // namespace
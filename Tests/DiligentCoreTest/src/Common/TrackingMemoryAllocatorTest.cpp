@@ -0,0 +1,192 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "TrackingMemoryAllocator.hpp"
+#include "ObjectBase.hpp"
+#include "RefCntAutoPtr.hpp"
+
+#include <thread>
+#include <vector>
+#include <algorithm>
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+const TrackingMemoryAllocator::TagStats* FindTag(const std::vector<TrackingMemoryAllocator::TagStats>& Stats, const char* Tag)
+{
+    auto it = std::find_if(Stats.begin(), Stats.end(), [Tag](const TrackingMemoryAllocator::TagStats& Stat) { return Stat.Tag == Tag; });
+    return it != Stats.end() ? &*it : nullptr;
+}
+
+TEST(Common_TrackingMemoryAllocator, AllocDealloc)
+{
+    TrackingMemoryAllocator Allocator;
+
+    void* pA0 = Allocator.Allocate(100, "Tag A", __FILE__, __LINE__);
+    void* pA1 = Allocator.Allocate(28, "Tag A", __FILE__, __LINE__);
+    void* pB  = Allocator.AllocateAligned(256, 64, "Tag B", __FILE__, __LINE__);
+    ASSERT_NE(pA0, nullptr);
+    ASSERT_NE(pA1, nullptr);
+    ASSERT_NE(pB, nullptr);
+    EXPECT_EQ(reinterpret_cast<size_t>(pB) % 64, size_t{0});
+
+    {
+        const auto  Stats = Allocator.GetStats();
+        const auto* pTagA = FindTag(Stats, "Tag A");
+        const auto* pTagB = FindTag(Stats, "Tag B");
+        ASSERT_NE(pTagA, nullptr);
+        ASSERT_NE(pTagB, nullptr);
+        EXPECT_EQ(pTagA->LiveBytes, 128);
+        EXPECT_EQ(pTagA->LiveAllocations, 2);
+        EXPECT_EQ(pTagB->LiveBytes, 256);
+        EXPECT_EQ(pTagB->LiveAllocations, 1);
+
+        // Stats are sorted by live bytes
+        EXPECT_EQ(Stats[0].Tag, "Tag B");
+    }
+
+    Allocator.Free(pA0);
+    Allocator.Free(pA1);
+    Allocator.FreeAligned(pB);
+
+    const auto Totals = Allocator.GetTotals();
+    EXPECT_EQ(Totals.LiveBytes, 0);
+    EXPECT_EQ(Totals.LiveAllocations, 0);
+    EXPECT_EQ(Totals.NumAllocations, Uint64{3});
+    EXPECT_EQ(Totals.NumFrees, Uint64{3});
+    EXPECT_EQ(Totals.AllocatedBytes, Uint64{384});
+
+    const auto Report = Allocator.GetReport();
+    EXPECT_NE(Report.find("Tag A"), std::string::npos);
+    EXPECT_NE(Report.find("Tag B"), std::string::npos);
+}
+
+TEST(Common_TrackingMemoryAllocator, TagsAreMatchedByContent)
+{
+    TrackingMemoryAllocator Allocator;
+
+    // Different pointers to the same string must be accounted to the same tag
+    const std::string Tag0 = "Dynamic tag";
+    const std::string Tag1 = "Dynamic tag";
+
+    void* p0 = Allocator.Allocate(10, Tag0.c_str(), __FILE__, __LINE__);
+    void* p1 = Allocator.Allocate(20, Tag1.c_str(), __FILE__, __LINE__);
+    void* p2 = Allocator.Allocate(30, nullptr, __FILE__, __LINE__);
+
+    const auto Stats = Allocator.GetStats();
+    ASSERT_EQ(Stats.size(), size_t{2});
+    const auto* pTag = FindTag(Stats, "Dynamic tag");
+    ASSERT_NE(pTag, nullptr);
+    EXPECT_EQ(pTag->LiveBytes, 30);
+    EXPECT_EQ(pTag->NumAllocations, Uint64{2});
+
+    Allocator.Free(p0);
+    Allocator.Free(p1);
+    Allocator.Free(p2);
+}
+
+TEST(Common_TrackingMemoryAllocator, RefCountedObject)
+{
+    class TestObject : public ObjectBase<IObject>
+    {
+    public:
+        TestObject(IReferenceCounters* pRefCounters) :
+            ObjectBase<IObject>{pRefCounters}
+        {}
+
+    private:
+        Uint8 m_Data[64] = {};
+    };
+
+    TrackingMemoryAllocator Allocator;
+    {
+        // The object description must reach the allocator in all build configurations
+        RefCntAutoPtr<TestObject> pObj{NEW_RC_OBJ(Allocator, "Tracked object", TestObject)()};
+        ASSERT_NE(pObj, nullptr);
+
+        const auto  Stats = Allocator.GetStats();
+        const auto* pTag  = FindTag(Stats, "Tracked object");
+        ASSERT_NE(pTag, nullptr);
+        EXPECT_GE(pTag->LiveBytes, static_cast<Int64>(sizeof(TestObject)));
+        EXPECT_EQ(pTag->LiveAllocations, 1);
+    }
+
+    const auto  Stats = Allocator.GetStats();
+    const auto* pTag  = FindTag(Stats, "Tracked object");
+    if (pTag != nullptr)
+    {
+        EXPECT_EQ(pTag->LiveBytes, 0);
+        EXPECT_EQ(pTag->LiveAllocations, 0);
+    }
+}
+
+TEST(Common_TrackingMemoryAllocator, MultipleThreads)
+{
+    TrackingMemoryAllocator Allocator;
+
+    constexpr size_t NumThreads     = 4;
+    constexpr size_t NumAllocations = 1000;
+
+    std::vector<std::vector<void*>> Allocations(NumThreads);
+
+    std::vector<std::thread> Threads;
+    for (size_t t = 0; t < NumThreads; ++t)
+    {
+        Threads.emplace_back([&Allocator, &Allocations, t]() {
+            for (size_t i = 0; i < NumAllocations; ++i)
+                Allocations[t].push_back(Allocator.Allocate(16, "Thread allocation", __FILE__, __LINE__));
+        });
+    }
+    for (auto& Thread : Threads)
+        Thread.join();
+
+    {
+        const auto Totals = Allocator.GetTotals();
+        EXPECT_EQ(Totals.LiveBytes, static_cast<Int64>(NumThreads * NumAllocations * 16));
+        EXPECT_EQ(Totals.LiveAllocations, static_cast<Int64>(NumThreads * NumAllocations));
+    }
+
+    // Free memory on a different thread than it was allocated on
+    std::thread{[&]() {
+        for (auto& ThreadAllocations : Allocations)
+        {
+            for (void* Ptr : ThreadAllocations)
+                Allocator.Free(Ptr);
+        }
+    }}.join();
+
+    const auto Totals = Allocator.GetTotals();
+    EXPECT_EQ(Totals.LiveBytes, 0);
+    EXPECT_EQ(Totals.LiveAllocations, 0);
+    EXPECT_EQ(Totals.NumAllocations, Uint64{NumThreads * NumAllocations});
+    EXPECT_EQ(Totals.NumFrees, Uint64{NumThreads * NumAllocations});
+}
+
+} // namespace
@@ -1270,7 +1270,7 @@ TEST(GraphicsAccessories_GraphicsAccessories, SwapChainUsageFlagsToBindFlags)
 
 TEST(GraphicsAccessories_GraphicsAccessories, GetRenderDeviceTypeString)
 {
-    static_assert(RENDER_DEVICE_TYPE_COUNT == 8, "Please add the new device type to the test");
+    static_assert(RENDER_DEVICE_TYPE_COUNT == 9, "Please add the new device type to the test");
 
     EXPECT_STREQ(GetRenderDeviceTypeString(RENDER_DEVICE_TYPE_UNDEFINED), "Undefined");
     EXPECT_STREQ(GetRenderDeviceTypeString(RENDER_DEVICE_TYPE_D3D11), "Direct3D11");
@@ -1280,6 +1280,7 @@ TEST(GraphicsAccessories_GraphicsAccessories, GetRenderDeviceTypeString)
     EXPECT_STREQ(GetRenderDeviceTypeString(RENDER_DEVICE_TYPE_VULKAN), "Vulkan");
     EXPECT_STREQ(GetRenderDeviceTypeString(RENDER_DEVICE_TYPE_METAL), "Metal");
     EXPECT_STREQ(GetRenderDeviceTypeString(RENDER_DEVICE_TYPE_WEBGPU), "WebGPU");
+    EXPECT_STREQ(GetRenderDeviceTypeString(RENDER_DEVICE_TYPE_NULL), "Null");
 
     EXPECT_STREQ(GetRenderDeviceTypeString(RENDER_DEVICE_TYPE_UNDEFINED, true), "RENDER_DEVICE_TYPE_UNDEFINED");
     EXPECT_STREQ(GetRenderDeviceTypeString(RENDER_DEVICE_TYPE_D3D11, true), "RENDER_DEVICE_TYPE_D3D11");
@@ -1289,11 +1290,12 @@ TEST(GraphicsAccessories_GraphicsAccessories, GetRenderDeviceTypeString)
     EXPECT_STREQ(GetRenderDeviceTypeString(RENDER_DEVICE_TYPE_VULKAN, true), "RENDER_DEVICE_TYPE_VULKAN");
     EXPECT_STREQ(GetRenderDeviceTypeString(RENDER_DEVICE_TYPE_METAL, true), "RENDER_DEVICE_TYPE_METAL");
     EXPECT_STREQ(GetRenderDeviceTypeString(RENDER_DEVICE_TYPE_WEBGPU, true), "RENDER_DEVICE_TYPE_WEBGPU");
+    EXPECT_STREQ(GetRenderDeviceTypeString(RENDER_DEVICE_TYPE_NULL, true), "RENDER_DEVICE_TYPE_NULL");
 }
 
 TEST(GraphicsAccessories_GraphicsAccessories, GetRenderDeviceTypeShortString)
 {
-    static_assert(RENDER_DEVICE_TYPE_COUNT == 8, "Please add the new device type to the test");
+    static_assert(RENDER_DEVICE_TYPE_COUNT == 9, "Please add the new device type to the test");
 
     EXPECT_STREQ(GetRenderDeviceTypeShortString(RENDER_DEVICE_TYPE_UNDEFINED), "undefined");
     EXPECT_STREQ(GetRenderDeviceTypeShortString(RENDER_DEVICE_TYPE_D3D11), "d3d11");
@@ -1303,6 +1305,7 @@ TEST(GraphicsAccessories_GraphicsAccessories, GetRenderDeviceTypeShortString)
     EXPECT_STREQ(GetRenderDeviceTypeShortString(RENDER_DEVICE_TYPE_VULKAN), "vk");
     EXPECT_STREQ(GetRenderDeviceTypeShortString(RENDER_DEVICE_TYPE_METAL), "mtl");
     EXPECT_STREQ(GetRenderDeviceTypeShortString(RENDER_DEVICE_TYPE_WEBGPU), "wgpu");
+    EXPECT_STREQ(GetRenderDeviceTypeShortString(RENDER_DEVICE_TYPE_NULL), "null");
 
 
     EXPECT_STREQ(GetRenderDeviceTypeShortString(RENDER_DEVICE_TYPE_UNDEFINED, true), "UNDEFINED");
@@ -1313,6 +1316,7 @@ TEST(GraphicsAccessories_GraphicsAccessories, GetRenderDeviceTypeShortString)
     EXPECT_STREQ(GetRenderDeviceTypeShortString(RENDER_DEVICE_TYPE_VULKAN, true), "VK");
     EXPECT_STREQ(GetRenderDeviceTypeShortString(RENDER_DEVICE_TYPE_METAL, true), "MTL");
     EXPECT_STREQ(GetRenderDeviceTypeShortString(RENDER_DEVICE_TYPE_WEBGPU, true), "WGPU");
+    EXPECT_STREQ(GetRenderDeviceTypeShortString(RENDER_DEVICE_TYPE_NULL, true), "NULL");
 }
 
 TEST(GraphicsAccessories_GraphicsAccessories, GetAdapterTypeString)
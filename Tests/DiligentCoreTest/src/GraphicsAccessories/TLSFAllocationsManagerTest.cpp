@@ -0,0 +1,203 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "TLSFAllocationsManager.hpp"
+#include "DefaultRawMemoryAllocator.hpp"
+#include "FastRand.hpp"
+
+#include <vector>
+#include <algorithm>
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+using OffsetType = TLSFAllocationsManager::OffsetType;
+
+TEST(GraphicsAccessories_TLSFAllocationsManager, AllocateFree)
+{
+    auto& Allocator = DefaultRawMemoryAllocator::GetAllocator();
+
+    TLSFAllocationsManager Mgr{1024, Allocator};
+    EXPECT_TRUE(Mgr.IsEmpty());
+    EXPECT_EQ(Mgr.GetNumFreeBlocks(), size_t{1});
+    EXPECT_EQ(Mgr.GetFreeSize(), OffsetType{1024});
+    EXPECT_EQ(Mgr.GetMaxFreeBlockSize(), OffsetType{1024});
+
+    // Sizes are rounded up to the minimal alignment (16)
+    auto a1 = Mgr.Allocate(17, 4);
+    EXPECT_EQ(a1.UnalignedOffset, OffsetType{0});
+    EXPECT_EQ(a1.Size, OffsetType{32});
+    EXPECT_EQ(Mgr.GetUsedSize(), OffsetType{32});
+    EXPECT_EQ(Mgr.GetNumFreeBlocks(), size_t{1});
+
+    auto a2 = Mgr.Allocate(16, 16);
+    EXPECT_EQ(a2.UnalignedOffset, OffsetType{32});
+    EXPECT_EQ(a2.Size, OffsetType{16});
+
+    // Alignment padding is returned to the free list
+    auto a3 = Mgr.Allocate(64, 128);
+    EXPECT_EQ(a3.UnalignedOffset, OffsetType{128});
+    EXPECT_EQ(a3.Size, OffsetType{64});
+    EXPECT_EQ(Mgr.GetNumFreeBlocks(), size_t{2});
+    EXPECT_EQ(Mgr.GetUsedSize(), OffsetType{32 + 16 + 64});
+    EXPECT_EQ(Mgr.GetNumAllocations(), size_t{3});
+
+    // The padding block is reused
+    auto a4 = Mgr.Allocate(48, 16);
+    EXPECT_EQ(a4.UnalignedOffset, OffsetType{48});
+    EXPECT_EQ(a4.Size, OffsetType{48});
+
+    Mgr.Free(std::move(a2));
+    EXPECT_FALSE(a2.IsValid());
+    Mgr.Free(std::move(a1));
+    // a1 and a2 are merged
+    EXPECT_EQ(Mgr.GetNumFreeBlocks(), size_t{3});
+
+    Mgr.Free(std::move(a4));
+    // a1, a2, a4 and the rest of the padding are merged
+    EXPECT_EQ(Mgr.GetNumFreeBlocks(), size_t{2});
+    EXPECT_EQ(Mgr.GetMaxFreeBlockSize(), OffsetType{1024 - 192});
+
+    Mgr.Free(a3.UnalignedOffset, a3.Size);
+    EXPECT_TRUE(Mgr.IsEmpty());
+    EXPECT_EQ(Mgr.GetNumFreeBlocks(), size_t{1});
+    EXPECT_EQ(Mgr.GetMaxFreeBlockSize(), OffsetType{1024});
+}
+
+TEST(GraphicsAccessories_TLSFAllocationsManager, Exhaust)
+{
+    auto& Allocator = DefaultRawMemoryAllocator::GetAllocator();
+
+    TLSFAllocationsManager Mgr{1024, Allocator};
+
+    // Allocation of the entire range must succeed
+    auto Full = Mgr.Allocate(1024, 16);
+    EXPECT_TRUE(Full.IsValid());
+    EXPECT_TRUE(Mgr.IsFull());
+    EXPECT_EQ(Mgr.GetNumFreeBlocks(), size_t{0});
+    EXPECT_EQ(Mgr.GetMaxFreeBlockSize(), OffsetType{0});
+    EXPECT_FALSE(Mgr.Allocate(16, 16).IsValid());
+    Mgr.Free(std::move(Full));
+
+    std::vector<TLSFAllocationsManager::Allocation> Allocations;
+    for (Uint32 i = 0; i < 1024 / 16; ++i)
+    {
+        Allocations.push_back(Mgr.Allocate(16, 16));
+        EXPECT_EQ(Allocations.back().UnalignedOffset, OffsetType{i * 16});
+    }
+    EXPECT_TRUE(Mgr.IsFull());
+    EXPECT_FALSE(Mgr.Allocate(16, 16).IsValid());
+
+    // Free every other block
+    for (size_t i = 0; i < Allocations.size(); i += 2)
+        Mgr.Free(std::move(Allocations[i]));
+    EXPECT_EQ(Mgr.GetNumFreeBlocks(), Allocations.size() / 2);
+    EXPECT_EQ(Mgr.GetMaxFreeBlockSize(), OffsetType{16});
+    // There is enough free space, but no contiguous block
+    EXPECT_FALSE(Mgr.Allocate(32, 16).IsValid());
+
+    for (size_t i = 1; i < Allocations.size(); i += 2)
+        Mgr.Free(std::move(Allocations[i]));
+    EXPECT_TRUE(Mgr.IsEmpty());
+    EXPECT_EQ(Mgr.GetNumFreeBlocks(), size_t{1});
+}
+
+TEST(GraphicsAccessories_TLSFAllocationsManager, BestFitInLastClass)
+{
+    auto& Allocator = DefaultRawMemoryAllocator::GetAllocator();
+
+    // The size of the only free block is not a size-class boundary, so rounding
+    // the request up skips the class that contains the block.
+    TLSFAllocationsManager Mgr{1008, Allocator};
+    auto                   a = Mgr.Allocate(1000, 16);
+    EXPECT_TRUE(a.IsValid());
+    EXPECT_EQ(a.Size, OffsetType{1008});
+    Mgr.Free(std::move(a));
+}
+
+TEST(GraphicsAccessories_TLSFAllocationsManager, Random)
+{
+    auto& Allocator = DefaultRawMemoryAllocator::GetAllocator();
+
+    constexpr OffsetType MaxSize = OffsetType{1} << 20;
+
+    TLSFAllocationsManager Mgr{MaxSize, Allocator};
+
+    FastRandInt Rnd{0, 0, 1 << 12};
+
+    std::vector<TLSFAllocationsManager::Allocation> Allocations;
+    for (Uint32 i = 0; i < 20000; ++i)
+    {
+        if (Allocations.empty() || Rnd() % 3 != 0)
+        {
+            const OffsetType Size      = static_cast<OffsetType>(Rnd() + 1);
+            const OffsetType Alignment = OffsetType{1} << (Rnd() % 9);
+
+            auto Allocation = Mgr.Allocate(Size, Alignment);
+            if (!Allocation.IsValid())
+                continue;
+
+            EXPECT_EQ(Allocation.UnalignedOffset % Alignment, OffsetType{0});
+            EXPECT_GE(Allocation.Size, Size);
+            EXPECT_LE(Allocation.UnalignedOffset + Allocation.Size, MaxSize);
+            Allocations.push_back(Allocation);
+        }
+        else
+        {
+            const size_t Idx = Rnd() % Allocations.size();
+            std::swap(Allocations[Idx], Allocations.back());
+            Mgr.Free(std::move(Allocations.back()));
+            Allocations.pop_back();
+        }
+    }
+
+    // Verify that allocations do not overlap
+    std::sort(Allocations.begin(), Allocations.end(),
+              [](const auto& lhs, const auto& rhs) { return lhs.UnalignedOffset < rhs.UnalignedOffset; });
+    OffsetType UsedSize = 0;
+    for (size_t i = 0; i < Allocations.size(); ++i)
+    {
+        if (i > 0)
+        {
+            EXPECT_LE(Allocations[i - 1].UnalignedOffset + Allocations[i - 1].Size, Allocations[i].UnalignedOffset);
+        }
+        UsedSize += Allocations[i].Size;
+    }
+    EXPECT_EQ(Mgr.GetUsedSize(), UsedSize);
+    EXPECT_EQ(Mgr.GetNumAllocations(), Allocations.size());
+
+    for (auto& Allocation : Allocations)
+        Mgr.Free(std::move(Allocation));
+
+    EXPECT_TRUE(Mgr.IsEmpty());
+    EXPECT_EQ(Mgr.GetNumFreeBlocks(), size_t{1});
+}
+
+} // namespace
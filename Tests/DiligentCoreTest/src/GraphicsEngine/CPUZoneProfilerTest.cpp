@@ -0,0 +1,187 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "CPUZoneProfiler.hpp"
+#include "ChromeTraceWriter.hpp"
+
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+class CPUZoneProfilerTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        CPUZoneProfiler::Reset();
+    }
+
+    void TearDown() override
+    {
+        CPUZoneProfiler::Enable(false);
+        CPUZoneProfiler::Reset();
+    }
+};
+
+TEST_F(CPUZoneProfilerTest, Disabled)
+{
+    {
+        DILIGENT_CPU_PROFILE_ZONE("Zone", "Test");
+    }
+    EXPECT_TRUE(CPUZoneProfiler::GetEvents().empty());
+}
+
+TEST_F(CPUZoneProfilerTest, NestedZones)
+{
+    CPUZoneProfiler::Enable(true);
+    {
+        DILIGENT_CPU_PROFILE_ZONE("Outer", "Test");
+        {
+            DILIGENT_CPU_PROFILE_ZONE("Inner", "Test");
+            std::this_thread::sleep_for(std::chrono::milliseconds{1});
+        }
+    }
+    CPUZoneProfiler::Enable(false);
+
+    const std::vector<CPUZoneProfiler::Event> Events = CPUZoneProfiler::GetEvents();
+    ASSERT_EQ(Events.size(), size_t{2});
+    // Events are sorted by start time
+    EXPECT_STREQ(Events[0].Name, "Outer");
+    EXPECT_STREQ(Events[1].Name, "Inner");
+    EXPECT_STREQ(Events[0].Category, "Test");
+    EXPECT_EQ(Events[0].ThreadId, Events[1].ThreadId);
+    EXPECT_EQ(Events[0].ThreadId, ChromeTraceWriter::GetThreadId());
+    EXPECT_LE(Events[0].StartTime, Events[1].StartTime);
+    EXPECT_GE(Events[0].StartTime + Events[0].Duration, Events[1].StartTime + Events[1].Duration);
+    EXPECT_GE(Events[1].Duration, Uint64{1000000});
+
+    const std::string Trace = CPUZoneProfiler::GetChromeTrace();
+    EXPECT_NE(Trace.find("\"traceEvents\""), std::string::npos);
+    EXPECT_NE(Trace.find("\"name\":\"Outer\""), std::string::npos);
+    EXPECT_NE(Trace.find("\"name\":\"Inner\""), std::string::npos);
+    EXPECT_NE(Trace.find("\"ph\":\"X\",\"pid\":" + std::to_string(ChromeTraceWriter::CPUProcessId)), std::string::npos);
+
+    CPUZoneProfiler::Reset();
+    EXPECT_TRUE(CPUZoneProfiler::GetEvents().empty());
+}
+
+TEST_F(CPUZoneProfilerTest, RingBufferOverflow)
+{
+    constexpr size_t NumEvents = CPUZoneProfiler::RingBufferSize + 100;
+    for (size_t i = 0; i < NumEvents; ++i)
+        CPUZoneProfiler::RecordEvent("Event", "Test", i, i + 1);
+
+    const std::vector<CPUZoneProfiler::Event> Events = CPUZoneProfiler::GetEvents();
+    ASSERT_EQ(Events.size(), CPUZoneProfiler::RingBufferSize);
+    // The oldest events must be overwritten
+    EXPECT_EQ(Events.front().StartTime, Uint64{100});
+    EXPECT_EQ(Events.back().StartTime, Uint64{NumEvents - 1});
+}
+
+TEST_F(CPUZoneProfilerTest, Multithreading)
+{
+    CPUZoneProfiler::Enable(true);
+
+    constexpr size_t NumThreads = 4;
+    constexpr size_t NumZones   = 1000;
+
+    std::vector<std::thread> Threads;
+    for (size_t t = 0; t < NumThreads; ++t)
+    {
+        Threads.emplace_back([]() {
+            for (size_t i = 0; i < NumZones; ++i)
+            {
+                DILIGENT_CPU_PROFILE_ZONE("Zone", "Test");
+            }
+        });
+    }
+    for (std::thread& Thread : Threads)
+        Thread.join();
+
+    CPUZoneProfiler::Enable(false);
+
+    const std::vector<CPUZoneProfiler::Event> Events = CPUZoneProfiler::GetEvents();
+    EXPECT_EQ(Events.size(), NumThreads * NumZones);
+
+    std::vector<size_t> ThreadEvents;
+    for (const CPUZoneProfiler::Event& Evt : Events)
+    {
+        if (Evt.ThreadId >= ThreadEvents.size())
+            ThreadEvents.resize(Evt.ThreadId + 1);
+        ++ThreadEvents[Evt.ThreadId];
+    }
+    size_t NumActiveThreads = 0;
+    for (size_t Count : ThreadEvents)
+    {
+        if (Count != 0)
+        {
+            EXPECT_EQ(Count, NumZones);
+            ++NumActiveThreads;
+        }
+    }
+    EXPECT_EQ(NumActiveThreads, NumThreads);
+}
+
+TEST_F(CPUZoneProfilerTest, ExitedThreads)
+{
+    const size_t NumBuffers = CPUZoneProfiler::GetNumThreadRingBuffers();
+
+    constexpr size_t NumThreads = 16;
+    constexpr size_t NumZones   = 10;
+    for (size_t t = 0; t < NumThreads; ++t)
+    {
+        std::thread Thread{[]() {
+            for (size_t i = 0; i < NumZones; ++i)
+                CPUZoneProfiler::RecordEvent("Zone", "Test", i, i + 1);
+        }};
+        Thread.join();
+    }
+
+    // The buffers of the exited threads must be released, but their events must be kept
+    EXPECT_EQ(CPUZoneProfiler::GetNumThreadRingBuffers(), NumBuffers);
+    EXPECT_EQ(CPUZoneProfiler::GetEvents().size(), NumThreads * NumZones);
+
+    CPUZoneProfiler::Reset();
+    EXPECT_TRUE(CPUZoneProfiler::GetEvents().empty());
+}
+
+TEST_F(CPUZoneProfilerTest, JSONEscaping)
+{
+    CPUZoneProfiler::RecordEvent("Quote\"Backslash\\Tab\tBell\x07", "Test", 0, 1);
+
+    const std::string Trace = CPUZoneProfiler::GetChromeTrace();
+    EXPECT_NE(Trace.find("\"name\":\"Quote\\\"Backslash\\\\Tab\\u0009Bell\\u0007\""), std::string::npos) << Trace;
+}
+
+} // namespace
@@ -0,0 +1,194 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "DescriptionInternPool.hpp"
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "GraphicsTypesX.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+TEST(DescriptionInternPoolTest, Strings)
+{
+    DescriptionInternPool Pool;
+
+    EXPECT_EQ(Pool.GetString(nullptr), nullptr);
+
+    const std::string Str1{"String"};
+    const std::string Str2{"String"};
+    const char*       pStr1 = Pool.GetString(Str1.c_str());
+    const char*       pStr2 = Pool.GetString(Str2.c_str());
+    EXPECT_STREQ(pStr1, "String");
+    EXPECT_NE(pStr1, Str1.c_str());
+    EXPECT_EQ(pStr1, pStr2);
+
+    const char* pEmpty = Pool.GetString("");
+    EXPECT_STREQ(pEmpty, "");
+    EXPECT_NE(pEmpty, pStr1);
+
+    const DescriptionInternPool::Statistics Stats = Pool.GetStatistics();
+    EXPECT_EQ(Stats.NumStrings, size_t{2});
+    EXPECT_EQ(Stats.NumRequests, Uint64{3});
+    EXPECT_EQ(Stats.NumHits, Uint64{1});
+    EXPECT_GT(Stats.MemorySize, size_t{0});
+    EXPECT_EQ(Pool.GetMemorySize(), Stats.MemorySize);
+}
+
+TEST(DescriptionInternPoolTest, InputLayout)
+{
+    DescriptionInternPool Pool;
+
+    InputLayoutDescX Layout1;
+    Layout1.Add(0u, 0u, 3u, VT_FLOAT32).Add(1u, 0u, 2u, VT_FLOAT32);
+    InputLayoutDescX Layout2{Layout1};
+    InputLayoutDescX Layout3{Layout1};
+    Layout3.Add(2u, 1u, 4u, VT_UINT8, True);
+
+    const InputLayoutDesc Interned1 = Pool.Intern(Layout1);
+    const InputLayoutDesc Interned2 = Pool.Intern(Layout2);
+    const InputLayoutDesc Interned3 = Pool.Intern(Layout3);
+    EXPECT_EQ(Interned1, Layout1.Get());
+    EXPECT_EQ(Interned3, Layout3.Get());
+
+    EXPECT_NE(Interned1.LayoutElements, Layout1.Get().LayoutElements);
+    EXPECT_EQ(Interned1.LayoutElements, Interned2.LayoutElements);
+    EXPECT_NE(Interned1.LayoutElements, Interned3.LayoutElements);
+
+    // Strings referenced by the elements must be interned
+    EXPECT_EQ(Interned1.LayoutElements[0].HLSLSemantic, Interned3.LayoutElements[0].HLSLSemantic);
+    EXPECT_EQ(Interned1.LayoutElements[0].HLSLSemantic, Pool.GetString(LayoutElement{}.HLSLSemantic));
+
+    EXPECT_EQ(Pool.Intern(InputLayoutDesc{}).LayoutElements, nullptr);
+}
+
+TEST(DescriptionInternPoolTest, ResourceSignature)
+{
+    DescriptionInternPool Pool;
+
+    auto MakeDesc = [](const char* Name) {
+        PipelineResourceSignatureDescX Desc{Name};
+        Desc
+            .AddResource(SHADER_TYPE_VERTEX, "g_Buffer", 1u, SHADER_RESOURCE_TYPE_CONSTANT_BUFFER, SHADER_RESOURCE_VARIABLE_TYPE_STATIC)
+            .AddResource(SHADER_TYPE_PIXEL, "g_Texture", 4u, SHADER_RESOURCE_TYPE_TEXTURE_SRV, SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE)
+            .AddImmutableSampler(SHADER_TYPE_PIXEL, "g_Texture", SamplerDesc{FILTER_TYPE_LINEAR, FILTER_TYPE_LINEAR, FILTER_TYPE_LINEAR});
+        return Desc;
+    };
+
+    const PipelineResourceSignatureDescX Desc1 = MakeDesc("Signature 1");
+    const PipelineResourceSignatureDescX Desc2 = MakeDesc("Signature 2");
+
+    const PipelineResourceSignatureDesc Interned1 = Pool.Intern(Desc1);
+    const PipelineResourceSignatureDesc Interned2 = Pool.Intern(Desc2);
+    EXPECT_EQ(Interned1, static_cast<const PipelineResourceSignatureDesc&>(Desc1));
+    EXPECT_EQ(Interned2, static_cast<const PipelineResourceSignatureDesc&>(Desc2));
+
+    // Different names, but the same arrays
+    EXPECT_NE(Interned1.Name, Interned2.Name);
+    EXPECT_EQ(Interned1.Resources, Interned2.Resources);
+    EXPECT_EQ(Interned1.ImmutableSamplers, Interned2.ImmutableSamplers);
+    EXPECT_EQ(Interned1.CombinedSamplerSuffix, Interned2.CombinedSamplerSuffix);
+
+    PipelineResourceLayoutDescX Layout;
+    Layout
+        .AddVariable(SHADER_TYPE_PIXEL, "g_Texture", SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC)
+        .AddImmutableSampler(SHADER_TYPE_PIXEL, "g_Texture", SamplerDesc{FILTER_TYPE_LINEAR, FILTER_TYPE_LINEAR, FILTER_TYPE_LINEAR});
+
+    const PipelineResourceLayoutDesc InternedLayout = Pool.Intern(Layout);
+    EXPECT_EQ(InternedLayout, static_cast<const PipelineResourceLayoutDesc&>(Layout));
+    EXPECT_EQ(InternedLayout.ImmutableSamplers, Interned1.ImmutableSamplers);
+    EXPECT_EQ(InternedLayout.Variables[0].Name, Interned1.Resources[1].Name);
+}
+
+TEST(DescriptionInternPoolTest, SpecializationConstants)
+{
+    DescriptionInternPool Pool;
+
+    const float  Data1[] = {1, 2, 3};
+    const float  Data2[] = {1, 2, 3};
+    const Uint32 Data3   = 4;
+
+    const SpecializationConstant Consts1[] = {{"Const1", SHADER_TYPE_VERTEX, sizeof(Data1), Data1}, {"Const2", SHADER_TYPE_PIXEL, sizeof(Data3), &Data3}};
+    const SpecializationConstant Consts2[] = {{"Const1", SHADER_TYPE_VERTEX, sizeof(Data2), Data2}, {"Const2", SHADER_TYPE_PIXEL, sizeof(Data3), &Data3}};
+
+    const SpecializationConstant* pInterned1 = Pool.GetArray(Consts1, 2);
+    const SpecializationConstant* pInterned2 = Pool.GetArray(Consts2, 2);
+    EXPECT_EQ(pInterned1, pInterned2);
+    EXPECT_EQ(pInterned1[0], Consts1[0]);
+    EXPECT_EQ(pInterned1[1], Consts1[1]);
+    EXPECT_NE(pInterned1[0].pData, Data1);
+}
+
+TEST(DescriptionInternPoolTest, Multithreading)
+{
+    DescriptionInternPool Pool;
+
+    constexpr size_t NumThreads = 8;
+    constexpr size_t NumNames   = 256;
+
+    std::vector<std::vector<const char*>>                       Results(NumThreads);
+    std::vector<std::vector<const ShaderResourceVariableDesc*>> ArrayResults(NumThreads);
+    std::vector<std::thread>                                    Threads;
+    for (size_t t = 0; t < NumThreads; ++t)
+    {
+        Threads.emplace_back([&Pool, &Res = Results[t], &ArrayRes = ArrayResults[t]]() {
+            for (size_t i = 0; i < NumNames; ++i)
+            {
+                const std::string Name = "Name" + std::to_string(i);
+                Res.push_back(Pool.GetString(Name.c_str()));
+
+                const ShaderResourceVariableDesc Var{SHADER_TYPE_PIXEL, Name.c_str(), SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE};
+                ArrayRes.push_back(Pool.GetArray(&Var, 1));
+            }
+        });
+    }
+    for (std::thread& Thread : Threads)
+        Thread.join();
+
+    for (size_t t = 1; t < NumThreads; ++t)
+    {
+        EXPECT_EQ(Results[t], Results[0]);
+        EXPECT_EQ(ArrayResults[t], ArrayResults[0]);
+    }
+    for (size_t i = 0; i < NumNames; ++i)
+        EXPECT_EQ(ArrayResults[0][i]->Name, Results[0][i]);
+
+    // Each iteration requests the name twice (directly and through the variable array) and the array once
+    const DescriptionInternPool::Statistics Stats = Pool.GetStatistics();
+    EXPECT_EQ(Stats.NumStrings, NumNames);
+    EXPECT_EQ(Stats.NumArrays, NumNames);
+    EXPECT_EQ(Stats.NumRequests, Uint64{NumThreads * NumNames * 3});
+    EXPECT_EQ(Stats.NumHits, Stats.NumRequests - NumNames * 2);
+}
+
+} // namespace
@@ -0,0 +1,107 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "../../../../Graphics/GraphicsEngine/include/DeviceObjectArchive.hpp"
+
+#include <cstring>
+
+#include "gtest/gtest.h"
+
+#include "DataBlobImpl.hpp"
+
+using namespace Diligent;
+
+namespace
+{
+
+using DeviceType = DeviceObjectArchive::DeviceType;
+
+RefCntAutoPtr<IDataBlob> SerializeArchive(const DeviceObjectArchive& Archive)
+{
+    RefCntAutoPtr<IDataBlob> pData;
+    Archive.Serialize(&pData);
+    return pData;
+}
+
+bool DeviceDataEqual(const DeviceObjectArchive& Archive, DeviceType Type, const char* RefData)
+{
+    const SerializedData& Data = Archive.GetDeviceData(Type);
+    return Data.Size() == strlen(RefData) && memcmp(Data.Ptr(), RefData, Data.Size()) == 0;
+}
+
+TEST(DeviceObjectArchiveTest, DeviceData)
+{
+    constexpr char GLData[] = "OpenGL program binaries";
+    constexpr char VkData[] = "Vulkan data";
+
+    DeviceObjectArchive Archive{42};
+    Archive.SetDeviceData(DeviceType::OpenGL, GLData, strlen(GLData));
+    Archive.SetDeviceData(DeviceType::Vulkan, VkData, strlen(VkData));
+
+    RefCntAutoPtr<IDataBlob> pData = SerializeArchive(Archive);
+    ASSERT_NE(pData, nullptr);
+
+    DeviceObjectArchive Archive2{DeviceObjectArchive::CreateInfo{pData}};
+    EXPECT_EQ(Archive2.GetContentVersion(), 42u);
+    EXPECT_TRUE(DeviceDataEqual(Archive2, DeviceType::OpenGL, GLData));
+    EXPECT_TRUE(DeviceDataEqual(Archive2, DeviceType::Vulkan, VkData));
+    EXPECT_FALSE(Archive2.GetDeviceData(DeviceType::Direct3D12));
+
+    Archive2.RemoveDeviceData(DeviceType::OpenGL);
+    EXPECT_FALSE(Archive2.GetDeviceData(DeviceType::OpenGL));
+    EXPECT_TRUE(DeviceDataEqual(Archive2, DeviceType::Vulkan, VkData));
+
+    DeviceObjectArchive Archive3;
+    Archive3.AppendDeviceData(Archive, DeviceType::OpenGL);
+    EXPECT_TRUE(DeviceDataEqual(Archive3, DeviceType::OpenGL, GLData));
+    EXPECT_FALSE(Archive3.GetDeviceData(DeviceType::Vulkan));
+}
+
+TEST(DeviceObjectArchiveTest, MergeDeviceData)
+{
+    constexpr char GLData[] = "OpenGL program binaries";
+    constexpr char VkData[] = "Vulkan data";
+
+    DeviceObjectArchive Src;
+    Src.SetDeviceData(DeviceType::OpenGL, GLData, strlen(GLData));
+    Src.SetDeviceData(DeviceType::Vulkan, VkData, strlen(VkData));
+
+    constexpr char OldVkData[] = "Old Vulkan data";
+
+    DeviceObjectArchive Dst;
+    Dst.SetDeviceData(DeviceType::Vulkan, OldVkData, strlen(OldVkData));
+    Dst.Merge(Src);
+
+    EXPECT_TRUE(DeviceDataEqual(Dst, DeviceType::OpenGL, GLData));
+    // Existing data is not overwritten
+    EXPECT_TRUE(DeviceDataEqual(Dst, DeviceType::Vulkan, OldVkData));
+
+    DeviceObjectArchive Dst2{DeviceObjectArchive::CreateInfo{SerializeArchive(Dst)}};
+    EXPECT_TRUE(DeviceDataEqual(Dst2, DeviceType::OpenGL, GLData));
+    EXPECT_TRUE(DeviceDataEqual(Dst2, DeviceType::Vulkan, OldVkData));
+}
+
+} // namespace
@@ -27,8 +27,13 @@
 #include "BytecodeCache.h"
 #include "DataBlobImpl.hpp"
 #include "DefaultShaderSourceStreamFactory.h"
+#include "TestingEnvironment.hpp"
 #include "gtest/gtest.h"
 
+#include <string>
+#include <thread>
+#include <vector>
+
 using namespace Diligent;
 
 namespace
@@ -186,4 +191,200 @@ TEST(BytecodeCacheTest, Include)
     }
 }
 
+RefCntAutoPtr<IDataBlob> CreateBytecode(const std::string& Data)
+{
+    return RefCntAutoPtr<IDataBlob>{DataBlobImpl::Create(Data.length(), Data.c_str())};
+}
+
+ShaderCreateInfo GetTestShaderCI(const char* Source)
+{
+    ShaderCreateInfo ShaderCI{};
+    ShaderCI.Desc.ShaderType = SHADER_TYPE_COMPUTE;
+    ShaderCI.Desc.Name       = "TestName";
+    ShaderCI.Source          = Source;
+    return ShaderCI;
+}
+
+void CheckBytecode(IBytecodeCache* pCache, const ShaderCreateInfo& ShaderCI, const char* RefData)
+{
+    RefCntAutoPtr<IDataBlob> pBytecode;
+    pCache->GetBytecode(ShaderCI, &pBytecode);
+    if (RefData == nullptr)
+    {
+        EXPECT_EQ(pBytecode, nullptr);
+        return;
+    }
+
+    ASSERT_NE(pBytecode, nullptr);
+    EXPECT_EQ(std::string(static_cast<const char*>(pBytecode->GetConstDataPtr()), pBytecode->GetSize()), RefData);
+}
+
+TEST(BytecodeCacheTest, Journal)
+{
+    RefCntAutoPtr<IBytecodeCache> pCache;
+    CreateBytecodeCache({RENDER_DEVICE_TYPE_VULKAN}, &pCache);
+    ASSERT_NE(pCache, nullptr);
+
+    const ShaderCreateInfo ShaderCI0 = GetTestShaderCI("Code0");
+    const ShaderCreateInfo ShaderCI1 = GetTestShaderCI("Code1");
+    const ShaderCreateInfo ShaderCI2 = GetTestShaderCI("Code2");
+
+    pCache->AddBytecode(ShaderCI0, CreateBytecode("Bytecode0"));
+    pCache->AddBytecode(ShaderCI1, CreateBytecode("Bytecode1"));
+
+    RefCntAutoPtr<IDataBlob> pData;
+    pCache->Store(&pData);
+    ASSERT_NE(pData, nullptr);
+
+    // Empty journal
+    {
+        RefCntAutoPtr<IDataBlob> pJournal;
+        pCache->StoreJournal(&pJournal);
+        ASSERT_NE(pJournal, nullptr);
+
+        RefCntAutoPtr<IBytecodeCache> pCache2;
+        CreateBytecodeCache({RENDER_DEVICE_TYPE_VULKAN}, &pCache2);
+        EXPECT_TRUE(pCache2->Load(pJournal));
+
+        BytecodeCacheStats Stats;
+        pCache2->GetStats(Stats);
+        EXPECT_EQ(Stats.NumEntries, 0u);
+    }
+
+    pCache->AddBytecode(ShaderCI2, CreateBytecode("Bytecode2"));
+    pCache->AddBytecode(ShaderCI1, CreateBytecode("Bytecode1_v2"));
+    pCache->RemoveBytecode(ShaderCI0);
+
+    RefCntAutoPtr<IDataBlob> pJournal;
+    pCache->StoreJournal(&pJournal);
+    ASSERT_NE(pJournal, nullptr);
+    EXPECT_LT(pJournal->GetSize(), pData->GetSize() + 64);
+
+    // Append the journal to the stored data
+    RefCntAutoPtr<DataBlobImpl> pFileData = DataBlobImpl::Create(pData->GetSize() + pJournal->GetSize());
+    memcpy(pFileData->GetDataPtr(), pData->GetConstDataPtr(), pData->GetSize());
+    memcpy(pFileData->GetDataPtr(pData->GetSize()), pJournal->GetConstDataPtr(), pJournal->GetSize());
+
+    RefCntAutoPtr<IBytecodeCache> pCache2;
+    CreateBytecodeCache({RENDER_DEVICE_TYPE_VULKAN}, &pCache2);
+    ASSERT_NE(pCache2, nullptr);
+    EXPECT_TRUE(pCache2->Load(pFileData));
+
+    CheckBytecode(pCache2, ShaderCI0, nullptr);
+    CheckBytecode(pCache2, ShaderCI1, "Bytecode1_v2");
+    CheckBytecode(pCache2, ShaderCI2, "Bytecode2");
+
+    // Truncated data must be rejected
+    RefCntAutoPtr<DataBlobImpl> pTruncated = DataBlobImpl::Create(pFileData->GetSize() - 1, pFileData->GetConstDataPtr());
+    RefCntAutoPtr<IBytecodeCache> pCache3;
+    CreateBytecodeCache({RENDER_DEVICE_TYPE_VULKAN}, &pCache3);
+    {
+        Testing::TestingEnvironment::ErrorScope ExpectedErrors{"Bytecode cache data is truncated"};
+        EXPECT_FALSE(pCache3->Load(pTruncated));
+    }
+}
+
+TEST(BytecodeCacheTest, Eviction)
+{
+    BytecodeCacheCreateInfo CI;
+    CI.DeviceType = RENDER_DEVICE_TYPE_VULKAN;
+    CI.MaxSize    = 16 * 64;
+
+    RefCntAutoPtr<IBytecodeCache> pCache;
+    CreateBytecodeCache(CI, &pCache);
+    ASSERT_NE(pCache, nullptr);
+
+    const std::string Bytecode(48, 'x');
+
+    std::vector<std::string> Sources;
+    for (int i = 0; i < 256; ++i)
+        Sources.emplace_back("Code" + std::to_string(i));
+
+    for (const std::string& Source : Sources)
+        pCache->AddBytecode(GetTestShaderCI(Source.c_str()), CreateBytecode(Bytecode));
+
+    BytecodeCacheStats Stats;
+    pCache->GetStats(Stats);
+    EXPECT_LE(Stats.TotalSize, CI.MaxSize);
+    EXPECT_EQ(Stats.TotalSize, Stats.NumEntries * Bytecode.size());
+    EXPECT_EQ(Stats.NumEntries + Stats.NumEvictions, Sources.size());
+    EXPECT_GT(Stats.NumEvictions, 0u);
+
+    // The most recently added bytecode must still be in the cache
+    CheckBytecode(pCache, GetTestShaderCI(Sources.back().c_str()), Bytecode.c_str());
+
+    // Evicted entries must be recorded in the journal
+    RefCntAutoPtr<IDataBlob> pJournal;
+    pCache->StoreJournal(&pJournal);
+
+    RefCntAutoPtr<IBytecodeCache> pCache2;
+    CreateBytecodeCache({RENDER_DEVICE_TYPE_VULKAN}, &pCache2);
+    EXPECT_TRUE(pCache2->Load(pJournal));
+
+    BytecodeCacheStats Stats2;
+    pCache2->GetStats(Stats2);
+    EXPECT_EQ(Stats2.NumEntries, Stats.NumEntries);
+}
+
+TEST(BytecodeCacheTest, Stats)
+{
+    RefCntAutoPtr<IBytecodeCache> pCache;
+    CreateBytecodeCache({RENDER_DEVICE_TYPE_VULKAN}, &pCache);
+    ASSERT_NE(pCache, nullptr);
+
+    const ShaderCreateInfo ShaderCI0 = GetTestShaderCI("Code0");
+    const ShaderCreateInfo ShaderCI1 = GetTestShaderCI("Code1");
+    pCache->AddBytecode(ShaderCI0, CreateBytecode("Bytecode0"));
+
+    CheckBytecode(pCache, ShaderCI0, "Bytecode0");
+    CheckBytecode(pCache, ShaderCI0, "Bytecode0");
+    CheckBytecode(pCache, ShaderCI1, nullptr);
+
+    BytecodeCacheStats Stats;
+    pCache->GetStats(Stats);
+    EXPECT_EQ(Stats.NumEntries, 1u);
+    EXPECT_EQ(Stats.TotalSize, 9u);
+    EXPECT_EQ(Stats.NumHits, 2u);
+    EXPECT_EQ(Stats.NumMisses, 1u);
+    EXPECT_EQ(Stats.NumEvictions, 0u);
+
+    pCache->Clear();
+    pCache->GetStats(Stats);
+    EXPECT_EQ(Stats.NumEntries, 0u);
+    EXPECT_EQ(Stats.TotalSize, 0u);
+}
+
+TEST(BytecodeCacheTest, MultiThreaded)
+{
+    RefCntAutoPtr<IBytecodeCache> pCache;
+    CreateBytecodeCache({RENDER_DEVICE_TYPE_VULKAN}, &pCache);
+    ASSERT_NE(pCache, nullptr);
+
+    constexpr int NumThreads         = 4;
+    constexpr int NumShadersInThread = 64;
+
+    std::vector<std::thread> Threads;
+    for (int t = 0; t < NumThreads; ++t)
+    {
+        Threads.emplace_back([&pCache, t]() {
+            for (int i = 0; i < NumShadersInThread; ++i)
+            {
+                const std::string Source = "Code" + std::to_string(t) + "_" + std::to_string(i);
+                const std::string Data   = "Bytecode" + std::to_string(t) + "_" + std::to_string(i);
+
+                const ShaderCreateInfo ShaderCI = GetTestShaderCI(Source.c_str());
+                pCache->AddBytecode(ShaderCI, CreateBytecode(Data));
+                CheckBytecode(pCache, ShaderCI, Data.c_str());
+            }
+        });
+    }
+    for (std::thread& Thread : Threads)
+        Thread.join();
+
+    BytecodeCacheStats Stats;
+    pCache->GetStats(Stats);
+    EXPECT_EQ(Stats.NumEntries, Uint64{NumThreads * NumShadersInThread});
+    EXPECT_EQ(Stats.NumHits, Uint64{NumThreads * NumShadersInThread});
+}
+
 } // namespace
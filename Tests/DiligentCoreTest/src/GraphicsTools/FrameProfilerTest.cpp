@@ -0,0 +1,301 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "FrameProfiler.hpp"
+#include "ChromeTraceWriter.hpp"
+#include "TestingEnvironment.hpp"
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Diligent;
+
+namespace
+{
+
+const FrameProfiler::ZoneStatistics* FindZone(const std::vector<FrameProfiler::ZoneStatistics>& Stats, const char* Name)
+{
+    for (const FrameProfiler::ZoneStatistics& Zone : Stats)
+    {
+        if (strcmp(Zone.Name, Name) == 0)
+            return &Zone;
+    }
+    return nullptr;
+}
+
+TEST(FrameProfilerTest, CPUZones)
+{
+    FrameProfiler::CreateInfo CI;
+    CI.StatisticsWindow = 4;
+
+    FrameProfiler Profiler{nullptr, CI};
+    EXPECT_FALSE(Profiler.IsGPUProfilingEnabled());
+
+    constexpr Uint32 NumFrames = 10;
+    for (Uint32 Frame = 0; Frame < NumFrames; ++Frame)
+    {
+        Profiler.BeginFrame(nullptr);
+        {
+            ScopedCPUZone Update{Profiler, "Update"};
+            {
+                ScopedCPUZone Physics{Profiler, "Physics"};
+                std::this_thread::sleep_for(std::chrono::milliseconds{1});
+            }
+        }
+        Profiler.EndFrame(nullptr);
+    }
+
+    const FrameProfiler::FrameStatistics FrameStats = Profiler.GetFrameStatistics();
+    EXPECT_EQ(FrameStats.NumFrames, NumFrames);
+    EXPECT_EQ(FrameStats.NumResolvedFrames, 0u);
+    EXPECT_EQ(FrameStats.NumDroppedCPUEvents, 0u);
+    EXPECT_GE(FrameStats.CPUTime.Min, 1e-3);
+    EXPECT_LE(FrameStats.CPUTime.Min, FrameStats.CPUTime.Average);
+    EXPECT_LE(FrameStats.CPUTime.Average, FrameStats.CPUTime.Max);
+
+    const std::vector<FrameProfiler::ZoneStatistics> ZoneStats = Profiler.GetZoneStatistics();
+    ASSERT_EQ(ZoneStats.size(), 3u);
+
+    const FrameProfiler::ZoneStatistics* pFrame   = FindZone(ZoneStats, "Frame");
+    const FrameProfiler::ZoneStatistics* pUpdate  = FindZone(ZoneStats, "Update");
+    const FrameProfiler::ZoneStatistics* pPhysics = FindZone(ZoneStats, "Physics");
+    ASSERT_NE(pFrame, nullptr);
+    ASSERT_NE(pUpdate, nullptr);
+    ASSERT_NE(pPhysics, nullptr);
+
+    EXPECT_EQ(pFrame->Depth, 0u);
+    EXPECT_EQ(pUpdate->Depth, 1u);
+    EXPECT_EQ(pPhysics->Depth, 2u);
+    EXPECT_EQ(pPhysics->Type, FrameProfiler::ZONE_TYPE::CPU);
+    EXPECT_EQ(pPhysics->Duration.Count, NumFrames);
+    EXPECT_GE(pUpdate->Duration.Last, pPhysics->Duration.Last);
+    EXPECT_GE(pFrame->Duration.Last, pUpdate->Duration.Last);
+}
+
+TEST(FrameProfilerTest, MultipleThreads)
+{
+    FrameProfiler Profiler{nullptr};
+
+    constexpr size_t NumThreads     = 4;
+    constexpr Uint32 NumZones       = 1000;
+    const char*      ThreadNames[4] = {"Worker 0", "Worker 1", "Worker 2", "Worker 3"};
+
+    Profiler.BeginFrame(nullptr);
+    {
+        std::vector<std::thread> Threads;
+        for (size_t t = 0; t < NumThreads; ++t)
+        {
+            Threads.emplace_back([&, t]() {
+                Profiler.SetThreadName(ThreadNames[t]);
+                for (Uint32 i = 0; i < NumZones; ++i)
+                {
+                    ScopedCPUZone Task{Profiler, "Task"};
+                    ScopedCPUZone SubTask{Profiler, "SubTask"};
+                }
+            });
+        }
+        for (std::thread& Thread : Threads)
+            Thread.join();
+    }
+    Profiler.EndFrame(nullptr);
+
+    const std::vector<FrameProfiler::ZoneStatistics> ZoneStats = Profiler.GetZoneStatistics();
+
+    const FrameProfiler::ZoneStatistics* pTask    = FindZone(ZoneStats, "Task");
+    const FrameProfiler::ZoneStatistics* pSubTask = FindZone(ZoneStats, "SubTask");
+    ASSERT_NE(pTask, nullptr);
+    ASSERT_NE(pSubTask, nullptr);
+    EXPECT_EQ(pTask->Duration.Count, NumThreads * NumZones);
+    EXPECT_EQ(pSubTask->Duration.Count, NumThreads * NumZones);
+    EXPECT_EQ(Profiler.GetFrameStatistics().NumDroppedCPUEvents, 0u);
+
+    const std::string Trace = Profiler.GetChromeTrace();
+    for (const char* Name : ThreadNames)
+        EXPECT_NE(Trace.find(Name), std::string::npos) << Name;
+}
+
+// Buffers of the exited threads are released, and a new thread never inherits the buffer of an exited thread,
+// even if it gets the same std::thread::id.
+TEST(FrameProfilerTest, ThreadExit)
+{
+    FrameProfiler Profiler{nullptr};
+
+    constexpr size_t NumThreads = 8;
+    constexpr Uint32 NumZones   = 10;
+
+    std::vector<Uint32> TraceThreadIds(NumThreads);
+
+    Profiler.BeginFrame(nullptr);
+    EXPECT_EQ(Profiler.GetNumThreadBuffers(), 1u);
+    for (size_t t = 0; t < NumThreads; ++t)
+    {
+        // Threads are run one at a time, so that their ids are likely to be reused
+        std::thread{[&, t]() {
+            for (Uint32 i = 0; i < NumZones; ++i)
+            {
+                ScopedCPUZone Task{Profiler, "Task"};
+            }
+            TraceThreadIds[t] = ChromeTraceWriter::GetThreadId();
+            EXPECT_EQ(Profiler.GetNumThreadBuffers(), 2u);
+        }}.join();
+        EXPECT_EQ(Profiler.GetNumThreadBuffers(), 1u);
+    }
+    Profiler.EndFrame(nullptr);
+
+    // Events of the exited threads are collected by EndFrame()
+    const std::vector<FrameProfiler::ZoneStatistics> ZoneStats = Profiler.GetZoneStatistics();
+    const FrameProfiler::ZoneStatistics*             pTask     = FindZone(ZoneStats, "Task");
+    ASSERT_NE(pTask, nullptr);
+    EXPECT_EQ(pTask->Duration.Count, NumThreads * NumZones);
+
+    // Every thread's events are written under its own trace thread id
+    EXPECT_EQ(std::set<Uint32>(TraceThreadIds.begin(), TraceThreadIds.end()).size(), NumThreads);
+    const std::string Trace = Profiler.GetChromeTrace();
+    for (Uint32 ThreadId : TraceThreadIds)
+    {
+        const std::string TaskEvent = "\"name\":\"Task\",\"cat\":\"CPU\",\"ph\":\"X\",\"pid\":" + std::to_string(ChromeTraceWriter::CPUProcessId) +
+            ",\"tid\":" + std::to_string(ThreadId) + ",";
+        EXPECT_NE(Trace.find(TaskEvent), std::string::npos) << ThreadId;
+    }
+}
+
+TEST(FrameProfilerTest, ThreadOutlivesProfiler)
+{
+    std::atomic<bool> ZoneRecorded{false};
+    std::atomic<bool> ProfilerDestroyed{false};
+
+    std::thread Thread;
+    {
+        FrameProfiler Profiler{nullptr};
+        Thread = std::thread{[&]() {
+            {
+                ScopedCPUZone Task{Profiler, "Task"};
+            }
+            ZoneRecorded.store(true);
+            // The thread buffer is retired after the profiler has been destroyed
+            while (!ProfilerDestroyed.load())
+                std::this_thread::yield();
+        }};
+        while (!ZoneRecorded.load())
+            std::this_thread::yield();
+    }
+    ProfilerDestroyed.store(true);
+    Thread.join();
+}
+
+TEST(FrameProfilerTest, Overflow)
+{
+    FrameProfiler::CreateInfo CI;
+    CI.MaxCPUEventsPerThread = 8;
+    CI.MaxTraceEvents        = 4;
+
+    FrameProfiler Profiler{nullptr, CI};
+    Profiler.BeginFrame(nullptr);
+    for (Uint32 i = 0; i < 10; ++i)
+    {
+        ScopedCPUZone Zone{Profiler, "Zone"};
+    }
+    Profiler.EndFrame(nullptr);
+
+    // 8 zones fit into the buffer, the remaining 2 zones and the frame zone are dropped
+    const FrameProfiler::FrameStatistics FrameStats = Profiler.GetFrameStatistics();
+    EXPECT_EQ(FrameStats.NumDroppedCPUEvents, 3u);
+
+    const std::vector<FrameProfiler::ZoneStatistics> ZoneStats = Profiler.GetZoneStatistics();
+    const FrameProfiler::ZoneStatistics*             pZone     = FindZone(ZoneStats, "Zone");
+    ASSERT_NE(pZone, nullptr);
+    EXPECT_EQ(pZone->Duration.Count, 8u);
+
+    // The buffer is drained by EndFrame()
+    Profiler.BeginFrame(nullptr);
+    {
+        ScopedCPUZone Zone{Profiler, "Zone"};
+    }
+    Profiler.EndFrame(nullptr);
+    EXPECT_EQ(Profiler.GetFrameStatistics().NumDroppedCPUEvents, 3u);
+
+    const std::string Trace = Profiler.GetChromeTrace();
+
+    size_t NumEvents = 0;
+    for (size_t Pos = Trace.find("\"ph\":\"X\""); Pos != std::string::npos; Pos = Trace.find("\"ph\":\"X\"", Pos + 1))
+        ++NumEvents;
+    EXPECT_EQ(NumEvents, CI.MaxTraceEvents);
+}
+
+TEST(FrameProfilerTest, ChromeTrace)
+{
+    FrameProfiler Profiler{nullptr};
+    Profiler.SetThreadName("Main \"thread\"");
+
+    Profiler.BeginFrame(nullptr);
+    {
+        ScopedCPUZone Zone{Profiler, "Zone\\With\"Quotes\""};
+    }
+    Profiler.EndFrame(nullptr);
+
+    const std::string Trace = Profiler.GetChromeTrace();
+    EXPECT_EQ(Trace.find("{\"traceEvents\":["), 0u);
+    EXPECT_NE(Trace.find("\"Main \\\"thread\\\"\""), std::string::npos);
+    EXPECT_NE(Trace.find("\"name\":\"Zone\\\\With\\\"Quotes\\\"\""), std::string::npos);
+    EXPECT_NE(Trace.find("\"displayTimeUnit\":\"ms\"}"), std::string::npos);
+
+    // CPU events use the same process and thread ids as other engine traces
+    const std::string FrameEvent = "\"name\":\"Frame\",\"cat\":\"CPU\",\"ph\":\"X\",\"pid\":" + std::to_string(ChromeTraceWriter::CPUProcessId) +
+        ",\"tid\":" + std::to_string(ChromeTraceWriter::GetThreadId()) + ",\"ts\":";
+    const size_t FrameEventPos = Trace.find(FrameEvent);
+    ASSERT_NE(FrameEventPos, std::string::npos) << Trace;
+
+    // Timestamps are on the trace clock
+    const Uint64 FrameStart = static_cast<Uint64>(std::stod(Trace.substr(FrameEventPos + FrameEvent.size())) * 1000.0);
+    const Uint64 Now        = ChromeTraceWriter::GetTimestamp();
+    EXPECT_LE(FrameStart, Now);
+    EXPECT_GE(FrameStart + Uint64{60} * 1000000000, Now);
+}
+
+TEST(FrameProfilerTest, InconsistentCalls)
+{
+    FrameProfiler Profiler{nullptr};
+
+    {
+        Testing::TestingEnvironment::ErrorScope ExpectedErrors{"There are no open CPU zones"};
+        Profiler.EndCPUZone();
+    }
+
+    {
+        Testing::TestingEnvironment::ErrorScope ExpectedErrors{"EndFrame() is called without matching BeginFrame()"};
+        Profiler.EndFrame(nullptr);
+    }
+
+    Profiler.BeginFrame(nullptr);
+    Profiler.EndFrame(nullptr);
+    EXPECT_EQ(Profiler.GetFrameStatistics().NumFrames, 1u);
+}
+
+} // namespace
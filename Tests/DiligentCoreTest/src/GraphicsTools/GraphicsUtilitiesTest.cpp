@@ -174,6 +174,8 @@ TEST(GraphicsUtilitiesTest, GetNativeTextureFormat_GetTextureFormatFromNative)
             Test(RENDER_DEVICE_TYPE_WEBGPU);
         }
 #endif
+
+        Test(RENDER_DEVICE_TYPE_NULL);
     }
 }
 
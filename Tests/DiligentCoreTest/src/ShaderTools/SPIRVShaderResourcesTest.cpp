@@ -33,6 +33,7 @@
 #include "EngineMemory.h"
 #include "BasicFileSystem.hpp"
 #include "SPIRVTools.hpp"
+#include "ThreadPool.hpp"
 
 #include <unordered_map>
 #include <string>
@@ -778,4 +779,76 @@ TEST_F(SPIRVShaderResourcesTest, NestedLocalAndSystemIncludesFromMemory_HLSL_GLS
     EXPECT_FALSE(SPIRV.empty());
 }
 
+TEST_F(SPIRVShaderResourcesTest, BatchCompile_DXC)
+{
+    if (!DXCompiler || !DXCompiler->IsLoaded())
+        GTEST_SKIP() << "DXC compiler is not available";
+
+    RefCntAutoPtr<IShaderSourceInputStreamFactory> pShaderSourceStreamFactory;
+    CreateDefaultShaderSourceStreamFactory("shaders/SPIRV", &pShaderSourceStreamFactory);
+    ASSERT_TRUE(pShaderSourceStreamFactory);
+
+    const char* FilePaths[] = {
+        "UniformBuffers.psh",
+        "StorageBuffers.psh",
+        "Textures.psh",
+        "MixedResources.psh",
+        "IncludeNestedParentRelative/Main.psh",
+    };
+
+    std::vector<ShaderCreateInfo> ShaderCIs(_countof(FilePaths));
+    for (size_t i = 0; i < ShaderCIs.size(); ++i)
+    {
+        ShaderCIs[i].SourceLanguage             = SHADER_SOURCE_LANGUAGE_HLSL;
+        ShaderCIs[i].FilePath                   = FilePaths[i];
+        ShaderCIs[i].Desc                       = {"SPIRV test shader", SHADER_TYPE_PIXEL};
+        ShaderCIs[i].EntryPoint                 = "main";
+        ShaderCIs[i].pShaderSourceStreamFactory = pShaderSourceStreamFactory;
+    }
+
+    // Every shader is compiled several times so that the same include files are requested concurrently
+    constexpr size_t NumRounds = 4;
+
+    auto TestBatch = [&](IThreadPool* pThreadPool) {
+        std::vector<IDXCompiler::BatchCompileItem> Items(ShaderCIs.size() * NumRounds);
+        for (size_t i = 0; i < Items.size(); ++i)
+        {
+            Items[i].pShaderCI   = &ShaderCIs[i % ShaderCIs.size()];
+            Items[i].ShaderModel = ShaderVersion{6, 0};
+        }
+
+        EXPECT_EQ(DXCompiler->CompileBatch(Items.data(), Items.size(), pThreadPool), Items.size());
+        for (size_t i = 0; i < Items.size(); ++i)
+        {
+            const char* FilePath = FilePaths[i % ShaderCIs.size()];
+            EXPECT_TRUE(Items[i].Succeeded) << FilePath;
+            // Batch compilation must produce the same byte code as the regular compilation
+            EXPECT_EQ(Items[i].ByteCode, LoadSPIRVFromHLSL(FilePath, SHADER_TYPE_PIXEL, SHADER_COMPILER_DXC)) << FilePath;
+        }
+    };
+
+    TestBatch(nullptr);
+
+    RefCntAutoPtr<IThreadPool> pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{4});
+    TestBatch(pThreadPool);
+
+    // Shaders that fail to compile must not affect the rest of the batch
+    ShaderCreateInfo InvalidShaderCI = ShaderCIs[0];
+    InvalidShaderCI.FilePath         = nullptr;
+    InvalidShaderCI.Source           = "float4 main() : SV_Target { return undefined_variable; }";
+
+    std::vector<IDXCompiler::BatchCompileItem> Items(3);
+    Items[0].pShaderCI = &ShaderCIs[0];
+    Items[1].pShaderCI = &InvalidShaderCI;
+    Items[2].pShaderCI = &ShaderCIs[1];
+    {
+        TestingEnvironment::ErrorScope ExpectedErrors{"Failed to compile"};
+        EXPECT_EQ(DXCompiler->CompileBatch(Items.data(), Items.size(), pThreadPool), 2u);
+    }
+    EXPECT_TRUE(Items[0].Succeeded);
+    EXPECT_FALSE(Items[1].Succeeded);
+    EXPECT_TRUE(Items[1].ByteCode.empty());
+    EXPECT_TRUE(Items[2].Succeeded);
+}
+
 } // namespace
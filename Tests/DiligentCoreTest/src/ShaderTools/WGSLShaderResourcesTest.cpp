@@ -73,7 +73,8 @@ void TestWGSLResources(const char*                                   FilePath,
     const auto WGSL = HLSLtoWGLS(FilePath);
     ASSERT_FALSE(WGSL.empty());
 
-    WGSLShaderResources Resources{
+    WGSLResourceBindingTable BindingTable;
+    WGSLShaderResources      Resources{
         GetRawAllocator(),
         WGSL,
         SHADER_SOURCE_LANGUAGE_HLSL,
@@ -82,10 +83,18 @@ void TestWGSLResources(const char*                                   FilePath,
         nullptr, // EntryPoint
         "_",     // ArrayIndexSuffix
         false,   // LoadUniformBufferReflection
-        nullptr  // ppTintOutput
+        nullptr, // ppTintOutput
+        &BindingTable,
     };
     LOG_INFO_MESSAGE("WGSL Resources:\n", Resources.DumpResources());
 
+    // The binding table built from the reflection parse must match the standalone one
+    {
+        const WGSLResourceBindingTable RefTable = BuildWGSLResourceBindingTable(WGSL);
+        EXPECT_TRUE(BindingTable.IsValid);
+        EXPECT_EQ(BindingTable.Sites.size(), RefTable.Sites.size());
+    }
+
     EXPECT_EQ(size_t{Resources.GetTotalResources()}, RefResources.size());
 
     std::unordered_map<std::string, const WGSLShaderResourceAttribs*> RefResourcesMap;
@@ -128,17 +128,8 @@ std::string HLSLtoWGLS(const char* FilePath)
     return ConvertSPIRVtoWGSL(SPIRV);
 }
 
-void TestResourceRemapping(const char*                FilePath,
-                           const WGSLResourceMapping& ResRemapping,
-                           WGSLResourceMapping        RefResources = {})
+void VerifyResourceBindings(const std::string& RemappedWGSL, const WGSLResourceMapping& RefResources)
 {
-    if (RefResources.empty())
-        RefResources = ResRemapping;
-
-    const auto WGSL = HLSLtoWGLS(FilePath);
-    ASSERT_FALSE(WGSL.empty());
-
-    const auto RemappedWGSL = RemapWGSLResourceBindings(WGSL, ResRemapping, "_");
     ASSERT_FALSE(RemappedWGSL.empty());
 
     tint::Source::File srcFile("", RemappedWGSL);
@@ -174,6 +165,28 @@ void TestResourceRemapping(const char*                FilePath,
     }
 }
 
+void TestResourceRemapping(const char*                FilePath,
+                           const WGSLResourceMapping& ResRemapping,
+                           WGSLResourceMapping        RefResources = {})
+{
+    if (RefResources.empty())
+        RefResources = ResRemapping;
+
+    const auto WGSL = HLSLtoWGLS(FilePath);
+    ASSERT_FALSE(WGSL.empty());
+
+    {
+        const auto BindingTable = BuildWGSLResourceBindingTable(WGSL);
+        EXPECT_TRUE(BindingTable.IsValid);
+        VerifyResourceBindings(RemapWGSLResourceBindings(WGSL, BindingTable, ResRemapping, "_"), RefResources);
+    }
+
+    {
+        // Fall back to remapping with tint
+        VerifyResourceBindings(RemapWGSLResourceBindings(WGSL, WGSLResourceBindingTable{}, ResRemapping, "_"), RefResources);
+    }
+}
+
 TEST(WGSLUtils, RemapUniformBuffers)
 {
     TestResourceRemapping("UniformBuffers.psh",
@@ -184,6 +197,39 @@ TEST(WGSLUtils, RemapUniformBuffers)
                           });
 }
 
+TEST(WGSLUtils, RemapWithBindingTable)
+{
+    const auto WGSL = HLSLtoWGLS("UniformBuffers.psh");
+    ASSERT_FALSE(WGSL.empty());
+
+    const auto BindingTable = BuildWGSLResourceBindingTable(WGSL);
+    ASSERT_TRUE(BindingTable.IsValid);
+    EXPECT_EQ(BindingTable.Sites.size(), size_t{3});
+
+    // The same table must be usable for any number of layouts
+    const WGSLResourceMapping Layout0{
+        {"CB0", {1, 2}},
+        {"CB1", {3, 4}},
+        {"CB2", {5, 6}},
+    };
+    const WGSLResourceMapping Layout1{
+        {"CB0", {0, 10}},
+        {"CB1", {0, 100}},
+        {"CB2", {2, 0}},
+    };
+    VerifyResourceBindings(RemapWGSLResourceBindings(WGSL, BindingTable, Layout0, "_"), Layout0);
+    VerifyResourceBindings(RemapWGSLResourceBindings(WGSL, BindingTable, Layout1, "_"), Layout1);
+}
+
+TEST(WGSLUtils, ConvertSPIRVtoWGSLIsDeterministic)
+{
+    // The second conversion is served from the cache
+    const auto WGSL0 = HLSLtoWGLS("UniformBuffers.psh");
+    const auto WGSL1 = HLSLtoWGLS("UniformBuffers.psh");
+    ASSERT_FALSE(WGSL0.empty());
+    EXPECT_EQ(WGSL0, WGSL1);
+}
+
 TEST(WGSLUtils, RemapTextures)
 {
     TestResourceRemapping("Textures.psh",
@@ -59,6 +59,7 @@ public:
         Uint32             AdapterId              = DEFAULT_ADAPTER_ID;
         Uint32             NumDeferredContexts    = 4;
         bool               EnableDeviceSimulation = false;
+        bool               WebGPUMappedUpload     = false;
 
         DeviceFeatures   Features{DEVICE_FEATURE_STATE_OPTIONAL};
         DeviceFeaturesVk FeaturesVk{DEVICE_FEATURE_STATE_OPTIONAL};
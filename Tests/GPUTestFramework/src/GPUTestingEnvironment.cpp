@@ -353,9 +353,11 @@ GPUTestingEnvironment::GPUTestingEnvironment(const CreateInfo& EnvCI, const Swap
             // Always enable validation
             EngineCI.SetValidationLevel(VALIDATION_LEVEL_1);
 
-            EngineCI.Window   = Window;
-            EngineCI.Features = EnvCI.Features;
-            NumDeferredCtx    = 0;
+            EngineCI.Window                   = Window;
+            EngineCI.Features                 = EnvCI.Features;
+            EngineCI.EnableProgramBinaryCache = true;
+            EngineCI.DynamicHeapSize          = 4 << 20;
+            NumDeferredCtx                    = 0;
             ppContexts.resize((std::max)(size_t{1}, ContextCI.size()) + NumDeferredCtx);
             RefCntAutoPtr<ISwapChain> pSwapChain; // We will use testing swap chain instead
             pFactoryOpenGL->CreateDeviceAndSwapChainGL(
@@ -468,7 +470,8 @@ GPUTestingEnvironment::GPUTestingEnvironment(const CreateInfo& EnvCI, const Swap
             pFactoryWGPU->SetBreakOnError(false);
 
             EngineWebGPUCreateInfo EngineCI{};
-            EngineCI.Features = EnvCI.Features;
+            EngineCI.Features              = EnvCI.Features;
+            EngineCI.UseMappedUploadMemory = EnvCI.WebGPUMappedUpload;
             ppContexts.resize((std::max)(size_t{1}, ContextCI.size()) + NumDeferredCtx);
             pFactoryWGPU->CreateDeviceAndContextsWebGPU(EngineCI, &m_pDevice, ppContexts.data());
         }
@@ -1007,6 +1010,10 @@ GPUTestingEnvironment* GPUTestingEnvironment::Initialize(int argc, char** argv)
         {
             TestEnvCI.EnableDeviceSimulation = true;
         }
+        else if (strcmp(arg, "--wgpu_mapped_upload") == 0)
+        {
+            TestEnvCI.WebGPUMappedUpload = true;
+        }
         else if (ParseFeatureState(arg, TestEnvCI.Features, TestEnvCI.FeaturesVk))
         {
             // Feature state has been updated by ParseFeatureState
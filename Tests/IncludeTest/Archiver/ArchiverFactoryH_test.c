@@ -36,4 +36,6 @@ void TestArchiverFactory_CInterface(IArchiverFactory* pArchiverFactory)
     IArchiverFactory_MergeArchives(pArchiverFactory, (const IDataBlob**)NULL, 0, (IDataBlob**)NULL);
     IArchiverFactory_PrintArchiveContent(pArchiverFactory, (IDataBlob*)NULL);
     IArchiverFactory_SetMessageCallback(pArchiverFactory, (DebugMessageCallbackType)NULL);
+    IArchiverFactory_EnableCPUProfiler(pArchiverFactory, True);
+    IArchiverFactory_GetCPUProfilerTrace(pArchiverFactory, (IDataBlob**)NULL);
 }
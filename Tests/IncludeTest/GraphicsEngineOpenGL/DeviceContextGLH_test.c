@@ -33,4 +33,8 @@ void TestDeviceContextGL_CInterface(IDeviceContextGL* pCtxGL)
     (void)res;
     IDeviceContextGL_PurgeCurrentGLContextCaches(pCtxGL);
     IDeviceContextGL_SetSwapChain(pCtxGL, (struct ISwapChainGL*)NULL);
+
+    const struct DeviceContextGLBindingStats* pStats = IDeviceContextGL_GetBindingStats(pCtxGL);
+    (void)pStats;
+    IDeviceContextGL_ClearBindingStats(pCtxGL);
 }
@@ -32,4 +32,9 @@ void TestRenderDeviceGL_CInterface(IRenderDeviceGL* pDevice)
     IRenderDeviceGL_CreateTextureFromGLHandle(pDevice, (Uint32)0, (Uint32)0, (TextureDesc*)NULL, RESOURCE_STATE_SHADER_RESOURCE, (ITexture**)NULL);
     IRenderDeviceGL_CreateBufferFromGLHandle(pDevice, (Uint32)0, (BufferDesc*)NULL, RESOURCE_STATE_CONSTANT_BUFFER, (IBuffer**)NULL);
     IRenderDeviceGL_CreateDummyTexture(pDevice, (TextureDesc*)NULL, RESOURCE_STATE_SHADER_RESOURCE, (ITexture**)NULL);
+    bool Loaded = IRenderDeviceGL_LoadProgramBinaries(pDevice, (IDataBlob*)NULL);
+    (void)Loaded;
+    IRenderDeviceGL_StoreProgramBinaries(pDevice, (IDataBlob**)NULL);
+    ProgramBinaryCacheStatsGL Stats = IRenderDeviceGL_GetProgramBinaryCacheStats(pDevice);
+    (void)Stats;
 }
@@ -44,4 +44,18 @@ void TestRenderDeviceVkCInterface(IRenderDeviceVk* pDevice)
     IRenderDeviceVk_CreateBLASFromVulkanResource(pDevice, (VkAccelerationStructureKHR)NULL, (BottomLevelASDesc*)NULL, RESOURCE_STATE_BUILD_AS_READ, (IBottomLevelAS**)NULL);
     IRenderDeviceVk_CreateTLASFromVulkanResource(pDevice, (VkAccelerationStructureKHR)NULL, (TopLevelASDesc*)NULL, RESOURCE_STATE_BUILD_AS_READ, (ITopLevelAS**)NULL);
     IRenderDeviceVk_CreateFenceFromVulkanResource(pDevice, (VkSemaphore)NULL, (const FenceDesc*)NULL, (IFence**)NULL);
+
+    Uint64 FenceValue = IRenderDeviceVk_FlushInitialDataUploads(pDevice, 0);
+    (void)FenceValue;
+
+    IRenderDeviceVk_SetInitialDataUploadBatchSize(pDevice, 0);
+
+    InitialDataUploadStatsVk Stats;
+    IRenderDeviceVk_GetInitialDataUploadStats(pDevice, &Stats);
+
+    DeviceMemoryStatsVk MemStats;
+    IRenderDeviceVk_GetMemoryStats(pDevice, &MemStats);
+
+    DescriptorSetAllocatorStatsVk DescrSetStats;
+    IRenderDeviceVk_GetDescriptorSetAllocatorStats(pDevice, &DescrSetStats);
 }
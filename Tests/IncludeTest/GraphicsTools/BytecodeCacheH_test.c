@@ -38,5 +38,7 @@ void TestBytecodeCacheCInterface()
     IBytecodeCache_AddBytecode(pCache, (ShaderCreateInfo*)NULL, (IDataBlob*)NULL);
     IBytecodeCache_RemoveBytecode(pCache, (ShaderCreateInfo*)NULL);
     IBytecodeCache_Store(pCache, (IDataBlob**)NULL);
+    IBytecodeCache_StoreJournal(pCache, (IDataBlob**)NULL);
     IBytecodeCache_Clear(pCache);
+    IBytecodeCache_GetStats(pCache, (BytecodeCacheStats*)NULL);
 }